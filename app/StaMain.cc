@@ -113,8 +113,11 @@ void
 evalTclInit(Tcl_Interp *interp,
 	    const char *inits[])
 {
-  char *unencoded = unencode(inits);
-  if (Tcl_Eval(interp, unencoded) != TCL_OK) {
+  size_t length;
+  char *unencoded = unencode(inits, length);
+  // Tcl_EvalEx with the known script length skips a strlen over the
+  // scripts and evaluates without building a command object.
+  if (Tcl_EvalEx(interp, unencoded, length, TCL_EVAL_GLOBAL) != TCL_OK) {
     // Get a backtrace for the error.
     Tcl_Eval(interp, "$errorInfo");
     const char *tcl_err = Tcl_GetStringResult(interp);
@@ -128,23 +131,30 @@ evalTclInit(Tcl_Interp *interp,
 char *
 unencode(const char *inits[])
 {
-  size_t length = 0;
+  size_t length;
+  return unencode(inits, length);
+}
+
+char *
+unencode(const char *inits[],
+	 size_t &length)
+{
+  size_t encoded_length = 0;
   for (const char **e = inits; *e; e++) {
     const char *init = *e;
-    length += strlen(init);
+    encoded_length += strlen(init);
   }
-  char *unencoded = new char[length / 3 + 1];
+  char *unencoded = new char[encoded_length / 3 + 1];
   char *u = unencoded;
   for (const char **e = inits; *e; e++) {
     const char *init = *e;
     size_t init_length = strlen(init);
-    for (const char *s = init; s < &init[init_length]; s += 3) {
-      char code[4] = {s[0], s[1], s[2], '\0'};
-      char ch = atoi(code);
-      *u++ = ch;
-    }
+    for (const char *s = init; s < &init[init_length]; s += 3)
+      // Three digit decimal character code.
+      *u++ = (s[0] - '0') * 100 + (s[1] - '0') * 10 + (s[2] - '0');
   }
   *u = '\0';
+  length = u - unencoded;
   return unencoded;
 }
 
@@ -382,9 +382,12 @@ CcsCeffDelayCalc::loadDelaySlew(const Pin *load_pin,
   }
 
   vl_fail_ = false;
-  double t_vl = findVlTime(vl_, elmore);
-  double t_vth = findVlTime(vth_, elmore);
-  double t_vh = findVlTime(vh_, elmore);
+  const double vths[3] = {vl_, vth_, vh_};
+  double times[3];
+  findVlTimes(vths, 3, elmore, times);
+  double t_vl = times[0];
+  double t_vth = times[1];
+  double t_vh = times[2];
   if (!vl_fail_) {
     delay = t_vth - region_times_[region_vth_idx_];
     slew = t_vh - t_vl;
@@ -472,6 +475,43 @@ CcsCeffDelayCalc::findVlTime(double v,
   return time;
 }
 
+// Find t such that vl(t)=v[i] for several thresholds.  The load
+// waveform is monotonic so the crossings share a bracket and iterate
+// in lockstep, retiring as they converge.
+void
+CcsCeffDelayCalc::findVlTimes(const double v[],
+                              int count,
+                              double elmore,
+                              // Return value.
+                              double times[])
+{
+  auto vl_func = [&] (const double t[],
+                      const bool active[],
+                      int lane_count,
+                      // Return values.
+                      double y[],
+                      double dy[]) {
+    for (int i = 0; i < lane_count; i++) {
+      if (active[i]) {
+        vl(t[i], elmore, y[i], dy[i]);
+        y[i] -= v[i];
+      }
+    }
+  };
+  double t_init = region_ramp_times_[0];
+  double t_final = region_ramp_times_[region_count_] + elmore * 3.0;
+  double x1[find_roots_max_lanes];
+  double x2[find_roots_max_lanes];
+  bool fail[find_roots_max_lanes];
+  for (int i = 0; i < count; i++) {
+    x1[i] = t_init;
+    x2[i] = t_final;
+  }
+  findRoots(vl_func, count, x1, x2, .001, 20, times, fail);
+  for (int i = 0; i < count; i++)
+    vl_fail_ |= fail[i];
+}
+
 ////////////////////////////////////////////////////////////////
 
 // Waveform accessors for swig/tcl.
@@ -96,6 +96,11 @@ protected:
                      Slew &slew);
   double findVlTime(double v,
                     double elmore);
+  void findVlTimes(const double v[],
+                   int count,
+                   double elmore,
+                   // Return value.
+                   double times[]);
   bool makeWaveformPreamble(const Pin *in_pin,
                             const RiseFall *in_rf,
                             const Pin *drvr_pin,
@@ -56,12 +56,25 @@ set_delay_calculator_cmd(const char *alg)
   sta::Sta::sta()->setArcDelayCalc(alg);
 }
 
+void
+refine_delays_cmd(const char *delay_calc_name,
+                  float slack_margin)
+{
+  Sta::sta()->refineDelays(delay_calc_name, slack_margin);
+}
+
 void
 set_delay_calc_incremental_tolerance(float tol)
 {
   Sta::sta()->setIncrementalDelayTolerance(tol);
 }
 
+void
+set_delay_calc_cache_tolerance(float tol)
+{
+  Sta::sta()->setDelayCalcCacheTolerance(tol);
+}
+
 string
 report_delay_calc_cmd(Edge *edge,
 		      TimingArc *arc,
@@ -139,6 +139,33 @@ define_cmd_args "set_pocv_sigma_factor" { factor }
 
 ################################################################
 
+define_cmd_args "refine_timing" \
+  {[-delay_calc name] [-slack_margin margin]}
+
+# Progressive-accuracy signoff: time the design with a cheap delay
+# calculator (set_delay_calculator lumped_cap), then re-time only the
+# fanin cones of endpoints with slack below -slack_margin using the
+# accurate delay calculator.
+proc refine_timing { args } {
+  parse_key_args "refine_timing" args keys {-delay_calc -slack_margin} flags {}
+  check_argc_eq0 "refine_timing" $args
+  set delay_calc "dmp_ceff_elmore"
+  if { [info exists keys(-delay_calc)] } {
+    set delay_calc $keys(-delay_calc)
+    if { ![is_delay_calc_name $delay_calc] } {
+      sta_error 2216 "delay calculator $delay_calc not found."
+    }
+  }
+  set slack_margin 0.0
+  if { [info exists keys(-slack_margin)] } {
+    check_float "-slack_margin" $keys(-slack_margin)
+    set slack_margin [time_ui_sta $keys(-slack_margin)]
+  }
+  refine_delays_cmd $delay_calc $slack_margin
+}
+
+################################################################
+
 define_cmd_args "set_assigned_delay" \
   {-cell|-net [-rise] [-fall] [-corner corner] [-min] [-max]\
      [-from from_pins] [-to to_pins] delay}
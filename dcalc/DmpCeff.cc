@@ -202,13 +202,19 @@ protected:
   void findDriverDelaySlew(// Return values.
                            double &delay,
 			   double &slew);
-  double findVoCrossing(double vth,
-                        double lower_bound,
-                        double upper_bound);
+  void findVoCrossings(double t_lower,
+                       double t_upper,
+                       // Return values.
+                       double &t_vth,
+                       double &t_vl,
+                       double &t_vh);
   void showVo();
-  double findVlCrossing(double vth,
-                        double lower_bound,
-                        double upper_bound);
+  void findVlCrossings(double t_lower,
+                       double t_upper,
+                       // Return values.
+                       double &t_vth,
+                       double &t_vl,
+                       double &t_vh);
   void showVl();
   void fail(const char *reason);
 
@@ -481,33 +487,50 @@ DmpAlg::findDriverDelaySlew(// Return values.
 			    double &slew)
 {
   double t_upper = voCrossingUpperBound();
-  delay = findVoCrossing(vth_, t0_, t_upper);
-  double tl = findVoCrossing(vl_, t0_, delay);
-  double th = findVoCrossing(vh_, delay, t_upper);
+  double tl, th;
+  findVoCrossings(t0_, t_upper, delay, tl, th);
   // Convert measured slew to table slew.
   slew = (th - tl) / slew_derate_;
 }
 
-// Find t such that vo(t)=v.
-double
-DmpAlg::findVoCrossing(double vth,
-                       double t_lower,
-                       double t_upper)
-{
-  FindRootFunc vo_func = [&] (double t,
-                              double &y,
-                              double &dy) {
-    double vo, vo_dt;
-    Vo(t, vo, vo_dt);
-    y = vo - vth;
-    dy = vo_dt;
+// Find t such that vo(t)=vth/vl/vh.  The waveform is monotonic so the
+// three crossings share the [t_lower, t_upper] bracket and iterate in
+// lockstep, retiring as they converge.
+void
+DmpAlg::findVoCrossings(double t_lower,
+                        double t_upper,
+                        // Return values.
+                        double &t_vth,
+                        double &t_vl,
+                        double &t_vh)
+{
+  const double vths[3] = {vth_, vl_, vh_};
+  auto vo_func = [&] (const double t[],
+                      const bool active[],
+                      int count,
+                      // Return values.
+                      double y[],
+                      double dy[]) {
+    for (int i = 0; i < count; i++) {
+      if (active[i]) {
+        double vo, vo_dt;
+        Vo(t[i], vo, vo_dt);
+        y[i] = vo - vths[i];
+        dy[i] = vo_dt;
+      }
+    }
   };
-  bool fail;
-  double t_vth = findRoot(vo_func, t_lower, t_upper, vth_time_tol,
-                          find_root_max_iter, fail);
-  if (fail)
+  const double x1[3] = {t_lower, t_lower, t_lower};
+  const double x2[3] = {t_upper, t_upper, t_upper};
+  double roots[3];
+  bool fail[3];
+  findRoots(vo_func, 3, x1, x2, vth_time_tol, find_root_max_iter,
+            roots, fail);
+  if (fail[0] || fail[1] || fail[2])
     throw DmpError("find Vo crossing failed");
-  return t_vth;
+  t_vth = roots[0];
+  t_vl = roots[1];
+  t_vh = roots[2];
 }
 
 void
@@ -575,9 +598,8 @@ DmpAlg::loadDelaySlew(const Pin *,
       p3_ = 1.0 / elmore;
       double t_lower = t0_;
       double t_upper = vlCrossingUpperBound();
-      double load_delay = findVlCrossing(vth_, t_lower, t_upper);
-      double tl = findVlCrossing(vl_, t_lower, load_delay);
-      double th = findVlCrossing(vh_, load_delay, t_upper);
+      double load_delay, tl, th;
+      findVlCrossings(t_lower, t_upper, load_delay, tl, th);
       // Measure delay from Vo, the load dependent source excitation.
       double delay1 = load_delay - vo_delay_;
       // Convert measured slew to reported/table slew.
@@ -606,26 +628,42 @@ DmpAlg::loadDelaySlew(const Pin *,
   }
 }
 
-// Find t such that vl(t)=v.
-double
-DmpAlg::findVlCrossing(double vth,
-                       double t_lower,
-                       double t_upper)
-{
-  FindRootFunc vl_func = [&] (double t,
-                              double &y,
-                              double &dy) {
-    double vl, vl_dt;
-    Vl(t, vl, vl_dt);
-    y = vl - vth;
-    dy = vl_dt;
+// Find t such that vl(t)=vth/vl/vh, in lockstep as for Vo.
+void
+DmpAlg::findVlCrossings(double t_lower,
+                        double t_upper,
+                        // Return values.
+                        double &t_vth,
+                        double &t_vl,
+                        double &t_vh)
+{
+  const double vths[3] = {vth_, vl_, vh_};
+  auto vl_func = [&] (const double t[],
+                      const bool active[],
+                      int count,
+                      // Return values.
+                      double y[],
+                      double dy[]) {
+    for (int i = 0; i < count; i++) {
+      if (active[i]) {
+        double vl, vl_dt;
+        Vl(t[i], vl, vl_dt);
+        y[i] = vl - vths[i];
+        dy[i] = vl_dt;
+      }
+    }
   };
-  bool fail;
-  double t_vth = findRoot(vl_func, t_lower, t_upper, vth_time_tol,
-                          find_root_max_iter, fail);
-  if (fail)
+  const double x1[3] = {t_lower, t_lower, t_lower};
+  const double x2[3] = {t_upper, t_upper, t_upper};
+  double roots[3];
+  bool fail[3];
+  findRoots(vl_func, 3, x1, x2, vth_time_tol, find_root_max_iter,
+            roots, fail);
+  if (fail[0] || fail[1] || fail[2])
     throw DmpError("find Vl crossing failed");
-  return t_vth;
+  t_vth = roots[0];
+  t_vl = roots[1];
+  t_vh = roots[2];
 }
 
 double
@@ -141,6 +141,10 @@ public:
   Parasitic *findParasitic(const Pin *drvr_pin,
                            const RiseFall *rf,
                            const DcalcAnalysisPt *dcalc_ap) override;
+  Parasitic *reduceParasitic(const Parasitic *parasitic_network,
+                             const Pin *drvr_pin,
+                             const RiseFall *rf,
+                             const DcalcAnalysisPt *dcalc_ap) override;
   ArcDcalcResult inputPortDelay(const Pin *port_pin,
                                 float in_slew,
                                 const RiseFall *rf,
@@ -253,6 +257,23 @@ DmpCeffTwoPoleDelayCalc::findParasitic(const Pin *drvr_pin,
   return parasitic;
 }
 
+// Reduce-on-read (read_spef -reduce) produces the pole residue form
+// this delay calculator prefers so the detailed RC network can be
+// discarded as each net section is parsed.
+Parasitic *
+DmpCeffTwoPoleDelayCalc::reduceParasitic(const Parasitic *parasitic_network,
+                                         const Pin *drvr_pin,
+                                         const RiseFall *rf,
+                                         const DcalcAnalysisPt *dcalc_ap)
+{
+  const Corner *corner = dcalc_ap->corner();
+  const ParasiticAnalysisPt *parasitic_ap = dcalc_ap->parasiticAnalysisPt();
+  return parasitics_->reduceToPiPoleResidue2(parasitic_network, drvr_pin, rf,
+                                             corner,
+                                             dcalc_ap->constraintMinMax(),
+                                             parasitic_ap);
+}
+
 ArcDcalcResult
 DmpCeffTwoPoleDelayCalc::inputPortDelay(const Pin *,
                                         float in_slew,
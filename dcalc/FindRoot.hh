@@ -1,56 +1,239 @@
 // OpenSTA, Static Timing Analyzer
 // Copyright (c) 2025, Parallax Software, Inc.
-// 
+//
 // This program is free software: you can redistribute it and/or modify
 // it under the terms of the GNU General Public License as published by
 // the Free Software Foundation, either version 3 of the License, or
 // (at your option) any later version.
-// 
+//
 // This program is distributed in the hope that it will be useful,
 // but WITHOUT ANY WARRANTY; without even the implied warranty of
 // MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
 // GNU General Public License for more details.
-// 
+//
 // You should have received a copy of the GNU General Public License
 // along with this program. If not, see <https://www.gnu.org/licenses/>.
-// 
+//
 // The origin of this software must not be misrepresented; you must not
 // claim that you wrote the original software.
-// 
+//
 // Altered source versions must be plainly marked as such, and must not be
 // misrepresented as being the original software.
-// 
+//
 // This notice may not be removed or altered from any source distribution.
 
 #pragma once
 
-#include <functional>
+#include <cmath> // abs
+#include <utility> // swap
 
 namespace sta {
 
-typedef const std::function<void (double x,
-                                  // Return values.
-                                  double &y,
-                                  double &dy)> FindRootFunc;
+// FindRootFunc is any callable void(double x, double &y, double &dy).
+// The solvers are templates rather than taking std::function so the
+// closures built at each call site in the delay calculation inner
+// loops do not heap allocate.
 
+template <class FindRootFunc>
 double
-findRoot(FindRootFunc func,
+findRoot(FindRootFunc &&func,
 	 double x1,
-	 double x2,
+	 double y1,
+         double x2,
+	 double y2,
 	 double x_tol,
 	 int max_iter,
          // Return value.
-         bool &fail);
+         bool &fail)
+{
+  using std::abs;
+
+  if ((y1 > 0.0 && y2 > 0.0) || (y1 < 0.0 && y2 < 0.0)) {
+    // Initial bounds do not surround a root.
+    fail = true;
+    return 0.0;
+  }
 
+  if (y1 == 0.0) {
+    fail = false;
+    return x1;
+  }
+
+  if (y2 == 0.0) {
+    fail = false;
+    return x2;
+  }
+
+  if (y1 > 0.0)
+    // Swap x1/x2 so func(x1) < 0.
+    std::swap(x1, x2);
+  double root = (x1 + x2) * 0.5;
+  double dx_prev = abs(x2 - x1);
+  double dx = dx_prev;
+  double y, dy;
+  func(root, y, dy);
+  for (int iter = 0; iter < max_iter; iter++) {
+    // Newton/raphson out of range.
+    if ((((root - x2) * dy - y) * ((root - x1) * dy - y) > 0.0)
+	// Not decreasing fast enough.
+	|| (abs(2.0 * y) > abs(dx_prev * dy))) {
+      // Bisect x1/x2 interval.
+      dx_prev = dx;
+      dx = (x2 - x1) * 0.5;
+      root = x1 + dx;
+    }
+    else {
+      dx_prev = dx;
+      dx = y / dy;
+      root -= dx;
+    }
+    if (abs(dx) <= x_tol * abs(root)) {
+      // Converged.
+      fail = false;
+      return root;
+    }
+
+    func(root, y, dy);
+    if (y < 0.0)
+      x1 = root;
+    else
+      x2 = root;
+  }
+  fail = true;
+  return root;
+}
+
+template <class FindRootFunc>
 double
-findRoot(FindRootFunc func,
+findRoot(FindRootFunc &&func,
 	 double x1,
-	 double y1,
-         double x2,
-	 double y2,
+	 double x2,
 	 double x_tol,
 	 int max_iter,
          // Return value.
-         bool &fail);
+         bool &fail)
+{
+  double y1, y2, dy1;
+  func(x1, y1, dy1);
+  func(x2, y2, dy1);
+  return findRoot(func, x1, y1, x2, y2, x_tol, max_iter, fail);
+}
+
+// Maximum lane count for findRoots.
+constexpr int find_roots_max_lanes = 8;
+
+// Solve count (<= find_roots_max_lanes) independent root finding
+// problems in lockstep.  func is any callable
+// void(const double x[], const bool active[], int count, double y[], double dy[])
+// that fills in y/dy for the lanes with active[lane] true.  It is
+// called once per iteration for all unconverged lanes so the
+// evaluations amortize the iteration overhead and can vectorize
+// across lanes; converged lanes retire early.
+// The per-lane state mirrors the scalar loop above; lanes drop out of
+// the active set as they converge or fail to bracket a root.
+template <class FindRootsFunc>
+void
+findRoots(FindRootsFunc &&func,
+          int count,
+          const double x1_init[],
+          const double x2_init[],
+          double x_tol,
+          int max_iter,
+          // Return values.
+          double roots[],
+          bool fail[])
+{
+  using std::abs;
+
+  double x1[find_roots_max_lanes];
+  double x2[find_roots_max_lanes];
+  double dx[find_roots_max_lanes];
+  double dx_prev[find_roots_max_lanes];
+  double y[find_roots_max_lanes];
+  double dy[find_roots_max_lanes];
+  bool active[find_roots_max_lanes];
+
+  for (int i = 0; i < count; i++) {
+    x1[i] = x1_init[i];
+    x2[i] = x2_init[i];
+    active[i] = true;
+  }
+  double y1[find_roots_max_lanes];
+  double y2[find_roots_max_lanes];
+  func(x1, active, count, y1, dy);
+  func(x2, active, count, y2, dy);
+
+  int active_count = 0;
+  for (int i = 0; i < count; i++) {
+    if ((y1[i] > 0.0 && y2[i] > 0.0) || (y1[i] < 0.0 && y2[i] < 0.0)) {
+      // Initial bounds do not surround a root.
+      fail[i] = true;
+      roots[i] = 0.0;
+      active[i] = false;
+    }
+    else if (y1[i] == 0.0) {
+      fail[i] = false;
+      roots[i] = x1[i];
+      active[i] = false;
+    }
+    else if (y2[i] == 0.0) {
+      fail[i] = false;
+      roots[i] = x2[i];
+      active[i] = false;
+    }
+    else {
+      if (y1[i] > 0.0)
+        // Swap x1/x2 so func(x1) < 0.
+        std::swap(x1[i], x2[i]);
+      roots[i] = (x1[i] + x2[i]) * 0.5;
+      dx_prev[i] = dx[i] = abs(x2[i] - x1[i]);
+      // Fails unless the lane converges.
+      fail[i] = true;
+      active_count++;
+    }
+  }
+  if (active_count == 0)
+    return;
+
+  func(roots, active, count, y, dy);
+  for (int iter = 0; iter < max_iter; iter++) {
+    for (int i = 0; i < count; i++) {
+      if (active[i]) {
+        // Newton/raphson out of range.
+        if ((((roots[i] - x2[i]) * dy[i] - y[i])
+             * ((roots[i] - x1[i]) * dy[i] - y[i]) > 0.0)
+            // Not decreasing fast enough.
+            || (abs(2.0 * y[i]) > abs(dx_prev[i] * dy[i]))) {
+          // Bisect x1/x2 interval.
+          dx_prev[i] = dx[i];
+          dx[i] = (x2[i] - x1[i]) * 0.5;
+          roots[i] = x1[i] + dx[i];
+        }
+        else {
+          dx_prev[i] = dx[i];
+          dx[i] = y[i] / dy[i];
+          roots[i] -= dx[i];
+        }
+        if (abs(dx[i]) <= x_tol * abs(roots[i])) {
+          // Converged; retire the lane.
+          fail[i] = false;
+          active[i] = false;
+          active_count--;
+        }
+      }
+    }
+    if (active_count == 0)
+      return;
+    func(roots, active, count, y, dy);
+    for (int i = 0; i < count; i++) {
+      if (active[i]) {
+        if (y[i] < 0.0)
+          x1[i] = roots[i];
+        else
+          x2[i] = roots[i];
+      }
+    }
+  }
+}
 
 } // namespace
@@ -24,8 +24,16 @@
 
 #include "GraphDelayCalc.hh"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 #include "Debug.hh"
+#include "DispatchQueue.hh"
+#include "Hash.hh"
 #include "Stats.hh"
+#include "Profile.hh"
+#include "QueryStats.hh"
 #include "MinMax.hh"
 #include "Mutex.hh"
 #include "TimingRole.hh"
@@ -70,7 +78,8 @@ GraphDelayCalc::GraphDelayCalc(StaState *sta) :
   search_non_latch_pred_(new SearchPredNonLatch2(sta)),
   clk_pred_(new ClkTreeSearchPred(sta)),
   iter_(new BfsFwdIterator(BfsIndex::dcalc, search_non_latch_pred_, sta)),
-  incremental_delay_tolerance_(0.0)
+  incremental_delay_tolerance_(0.0),
+  dcalc_cache_tolerance_(0.0)
 {
 }
 
@@ -127,6 +136,21 @@ GraphDelayCalc::setIncrementalDelayTolerance(float tol)
   incremental_delay_tolerance_ = tol;
 }
 
+float
+GraphDelayCalc::delayCalcCacheTolerance()
+{
+  return dcalc_cache_tolerance_;
+}
+
+void
+GraphDelayCalc::setDelayCalcCacheTolerance(float tol)
+{
+  dcalc_cache_tolerance_ = tol;
+  // Buckets change width.
+  LockGuard lock(dcalc_cache_lock_);
+  dcalc_cache_.clear();
+}
+
 void
 GraphDelayCalc::setObserver(DelayCalcObserver *observer)
 {
@@ -146,12 +170,70 @@ GraphDelayCalc::delaysInvalid()
   invalid_delays_->clear();
   invalid_check_edges_.clear();
   invalid_latch_edges_.clear();
+  invalid_delay_corners_.clear();
+  dcalc_cache_.clear();
+  net_caps_cache_.clear();
+  net_caps_valid_.clear();
+}
+
+// Corner scoped invalidation.  The whole graph is re-swept but
+// annotation is restricted to the corner's analysis points
+// (findDelaysFor), so the other corners' delays and slews stay live
+// and arrivals are only invalidated (by the observer) where the
+// recomputed delays actually change.
+void
+GraphDelayCalc::delaysInvalid(const Corner *corner)
+{
+  if (corner == nullptr
+      || !delays_exist_)
+    delaysInvalid();
+  else {
+    debugPrint(debug_, "delay_calc", 1, "delays invalid corner %s",
+               corner->name());
+    invalid_delay_corners_.insert(corner);
+    delays_seeded_ = false;
+    incremental_ = false;
+    iter_->clear();
+    // The full sweep covers pending incremental updates.
+    invalid_delays_->clear();
+    invalid_check_edges_.clear();
+    invalid_latch_edges_.clear();
+    dcalc_cache_.clear();
+    net_caps_cache_.clear();
+    net_caps_valid_.clear();
+  }
+}
+
+// True when dcalc_ap is recomputed by the pending sweep; false for
+// analysis points left live by a corner scoped delaysInvalid.
+bool
+GraphDelayCalc::findDelaysFor(const DcalcAnalysisPt *dcalc_ap) const
+{
+  return invalid_delay_corners_.empty()
+    || invalid_delay_corners_.hasKey(dcalc_ap->corner());
+}
+
+void
+GraphDelayCalc::delaysRestored()
+{
+  debugPrint(debug_, "delay_calc", 1, "delays restored");
+  delays_exist_ = true;
+  delays_seeded_ = true;
+  incremental_ = true;
+  iter_->clear();
+  invalid_delays_->clear();
+  invalid_check_edges_.clear();
+  invalid_latch_edges_.clear();
+  invalid_delay_corners_.clear();
+  dcalc_cache_.clear();
+  net_caps_cache_.clear();
+  net_caps_valid_.clear();
 }
 
 void
 GraphDelayCalc::delayInvalid(const Pin *pin)
 {
-  if (graph_ && incremental_) {
+  if (graph_) {
     if (network_->isHierarchical(pin)) {
       EdgesThruHierPinIterator edge_iter(pin, network_, graph_);
       while (edge_iter.hasNext()) {
@@ -173,14 +255,42 @@ GraphDelayCalc::delayInvalid(const Pin *pin)
 void
 GraphDelayCalc::delayInvalid(Vertex *vertex)
 {
-  debugPrint(debug_, "delay_calc", 2, "delay invalid %s",
+  debugPrintHot(debug_, "delay_calc", 2, "delay invalid %s",
              vertex->to_string(this).c_str());
-  if (graph_ && incremental_) {
-    invalid_delays_->insert(vertex);
-    // Invalidate driver that triggers dcalc for multi-driver nets.
-    MultiDrvrNet *multi_drvr = multiDrvrNet(vertex);
-    if (multi_drvr)
-      invalid_delays_->insert(multi_drvr->dcalcDrvr());
+  if (graph_) {
+    // A pin level edit affects every corner; widen a pending corner
+    // scoped invalidation to a full one.
+    if (!invalid_delay_corners_.empty())
+      delaysInvalid();
+    netCapsInvalid(vertex);
+    if (incremental_) {
+      invalid_delays_->insert(vertex);
+      // Invalidate driver that triggers dcalc for multi-driver nets.
+      MultiDrvrNet *multi_drvr = multiDrvrNet(vertex);
+      if (multi_drvr)
+        invalid_delays_->insert(multi_drvr->dcalcDrvr());
+    }
+  }
+}
+
+// Cap changes on a load pin show up in the driver net caps, so
+// invalidate the drivers of the vertex's wire edges along with the
+// vertex itself.
+void
+GraphDelayCalc::netCapsInvalid(Vertex *vertex)
+{
+  LockGuard lock(net_caps_lock_);
+  VertexId id = graph_->id(vertex);
+  if (id < net_caps_valid_.size())
+    net_caps_valid_[id] = false;
+  VertexInEdgeIterator edge_iter(vertex, graph_);
+  while (edge_iter.hasNext()) {
+    Edge *edge = edge_iter.next();
+    if (edge->isWire()) {
+      VertexId drvr_id = graph_->id(edge->from(graph_));
+      if (drvr_id < net_caps_valid_.size())
+        net_caps_valid_[drvr_id] = false;
+    }
   }
 }
 
@@ -203,6 +313,8 @@ GraphDelayCalc::deleteVertexBefore(Vertex *vertex)
   iter_->deleteVertexBefore(vertex);
   if (incremental_)
     invalid_delays_->erase(vertex);
+  // Vertex IDs are recycled.
+  netCapsInvalid(vertex);
   MultiDrvrNet *multi_drvr = multiDrvrNet(vertex);
   if (multi_drvr) {
     // Don't bother incrementally updating MultiDrvrNet.
@@ -225,6 +337,11 @@ public:
 protected:
   GraphDelayCalc *graph_delay_calc_;
   ArcDelayCalc *arc_delay_calc_;
+  // Check/latch edges found by this visitor's thread, staged without
+  // locking and merged into the shared invalid edge sets when the
+  // visitor is destroyed.
+  EdgeSeq invalid_check_edges_;
+  EdgeSeq invalid_latch_edges_;
 };
 
 FindVertexDelays::FindVertexDelays(GraphDelayCalc *graph_delay_calc) :
@@ -236,6 +353,8 @@ FindVertexDelays::FindVertexDelays(GraphDelayCalc *graph_delay_calc) :
 
 FindVertexDelays::~FindVertexDelays()
 {
+  graph_delay_calc_->mergeInvalidEdges(invalid_check_edges_,
+                                       invalid_latch_edges_);
   delete arc_delay_calc_;
 }
 
@@ -250,7 +369,9 @@ FindVertexDelays::copy() const
 void
 FindVertexDelays::visit(Vertex *vertex)
 {
-  graph_delay_calc_->findVertexDelay(vertex, arc_delay_calc_, true);
+  graph_delay_calc_->findVertexDelay(vertex, arc_delay_calc_, true,
+                                     &invalid_check_edges_,
+                                     &invalid_latch_edges_);
 }
 
 // The logical structure of incremental delay calculation closely
@@ -260,6 +381,7 @@ void
 GraphDelayCalc::findDelays(Level level)
 {
   if (arc_delay_calc_) {
+    ProfilePhase phase("Find delays");
     Stats stats(debug_, report_);
     int dcalc_count = 0;
     debugPrint(debug_, "delay_calc", 1, "find delays to level %d", level);
@@ -280,21 +402,78 @@ GraphDelayCalc::findDelays(Level level)
 
     // Timing checks require slews at both ends of the arc,
     // so find their delays after all slews are known.
-    for (Edge *check_edge : invalid_check_edges_)
-      findCheckEdgeDelays(check_edge, arc_delay_calc_);
-    invalid_check_edges_.clear();
-
-    for (Edge *latch_edge : invalid_latch_edges_)
-      findLatchEdgeDelays(latch_edge);
-    invalid_latch_edges_.clear();
+    findInvalidCheckDelays();
+    findInvalidLatchDelays();
 
     delays_exist_ = true;
     incremental_ = true;
+    invalid_delay_corners_.clear();
     debugPrint(debug_, "delay_calc", 1, "found %d delays", dcalc_count);
     stats.report("Delay calc");
   }
 }
 
+// Check edge delays are independent of each other, so they are split
+// across the dispatch queue threads after the level visits.  Each
+// thread gets its own arc delay calc copy so delay calculator state
+// (arnoldi reduction workspaces etc) is not shared.
+void
+GraphDelayCalc::findInvalidCheckDelays()
+{
+  if (dispatch_queue_
+      && static_cast<int>(invalid_check_edges_.size()) > thread_count_) {
+    std::vector<ArcDelayCalc*> dcalcs(thread_count_);
+    for (int k = 0; k < thread_count_; k++)
+      dcalcs[k] = arc_delay_calc_->copy();
+    for (Edge *check_edge : invalid_check_edges_) {
+      dispatch_queue_->dispatch([this, check_edge, &dcalcs](int i) {
+        findCheckEdgeDelays(check_edge, dcalcs[i]);
+      });
+    }
+    dispatch_queue_->finishTasks();
+    for (ArcDelayCalc *dcalc : dcalcs)
+      delete dcalc;
+  }
+  else {
+    for (Edge *check_edge : invalid_check_edges_)
+      findCheckEdgeDelays(check_edge, arc_delay_calc_);
+  }
+  invalid_check_edges_.clear();
+}
+
+void
+GraphDelayCalc::findInvalidLatchDelays()
+{
+  // Group D->Q edges by driver vertex; a driver's slews and wire
+  // delays must be annotated from one thread.
+  Map<Vertex*, EdgeSeq> drvr_latch_edges;
+  for (Edge *latch_edge : invalid_latch_edges_)
+    drvr_latch_edges[latch_edge->to(graph_)].push_back(latch_edge);
+  invalid_latch_edges_.clear();
+  if (dispatch_queue_
+      && static_cast<int>(drvr_latch_edges.size()) > thread_count_) {
+    std::vector<ArcDelayCalc*> dcalcs(thread_count_);
+    for (int k = 0; k < thread_count_; k++)
+      dcalcs[k] = arc_delay_calc_->copy();
+    for (const auto &drvr_edges : drvr_latch_edges) {
+      const EdgeSeq *latch_edges = &drvr_edges.second;
+      dispatch_queue_->dispatch([this, latch_edges, &dcalcs](int i) {
+        for (Edge *latch_edge : *latch_edges)
+          findLatchEdgeDelays(latch_edge, dcalcs[i]);
+      });
+    }
+    dispatch_queue_->finishTasks();
+    for (ArcDelayCalc *dcalc : dcalcs)
+      delete dcalc;
+  }
+  else {
+    for (const auto &drvr_edges : drvr_latch_edges) {
+      for (Edge *latch_edge : drvr_edges.second)
+        findLatchEdgeDelays(latch_edge, arc_delay_calc_);
+    }
+  }
+}
+
 void
 GraphDelayCalc::seedInvalidDelays()
 {
@@ -332,7 +511,7 @@ GraphDelayCalc::seedDrvrSlew(Vertex *drvr_vertex,
                              ArcDelayCalc *arc_delay_calc)
 {
   const Pin *drvr_pin = drvr_vertex->pin();
-  debugPrint(debug_, "delay_calc", 2, "seed driver slew %s",
+  debugPrintHot(debug_, "delay_calc", 2, "seed driver slew %s",
              drvr_vertex->to_string(this).c_str());
   InputDrive *drive = 0;
   if (network_->isTopLevelPort(drvr_pin)) {
@@ -341,6 +520,8 @@ GraphDelayCalc::seedDrvrSlew(Vertex *drvr_vertex,
   }
   for (const RiseFall *rf : RiseFall::range()) {
     for (const DcalcAnalysisPt *dcalc_ap : corners_->dcalcAnalysisPts()) {
+      if (!findDelaysFor(dcalc_ap))
+	continue;
       if (drive) {
 	const MinMax *cnst_min_max = dcalc_ap->constraintMinMax();
 	const LibertyCell *drvr_cell;
@@ -454,14 +635,15 @@ void
 GraphDelayCalc::seedLoadSlew(Vertex *vertex)
 {
   const Pin *pin = vertex->pin();
-  debugPrint(debug_, "delay_calc", 2, "seed load slew %s",
+  debugPrintHot(debug_, "delay_calc", 2, "seed load slew %s",
              vertex->to_string(this).c_str());
   ClockSet *clks = sdc_->findLeafPinClocks(pin);
   initSlew(vertex);
   for (const RiseFall *rf : RiseFall::range()) {
     for (const DcalcAnalysisPt *dcalc_ap : corners_->dcalcAnalysisPts()) {
       const MinMax *slew_min_max = dcalc_ap->slewMinMax();
-      if (!vertex->slewAnnotated(rf, slew_min_max)) {
+      if (findDelaysFor(dcalc_ap)
+	  && !vertex->slewAnnotated(rf, slew_min_max)) {
 	float slew = 0.0;
 	if (clks) {
 	  slew = slew_min_max->initValue();
@@ -528,7 +710,7 @@ GraphDelayCalc::findInputDriverDelay(const LibertyCell *drvr_cell,
                                      const LibertyPort *to_port,
                                      const DcalcAnalysisPt *dcalc_ap)
 {
-  debugPrint(debug_, "delay_calc", 2, "  driver cell %s %s",
+  debugPrintHot(debug_, "delay_calc", 2, "  driver cell %s %s",
              drvr_cell->name(),
              rf->to_string().c_str());
   for (TimingArcSet *arc_set : drvr_cell->timingArcSets(from_port, to_port)) {
@@ -552,7 +734,7 @@ GraphDelayCalc::findInputArcDelay(const Pin *drvr_pin,
                                   float from_slew,
                                   const DcalcAnalysisPt *dcalc_ap)
 {
-  debugPrint(debug_, "delay_calc", 3, "  %s %s -> %s %s (%s)",
+  debugPrintHot(debug_, "delay_calc", 3, "  %s %s -> %s %s (%s)",
              arc->from()->name(),
              arc->fromEdge()->to_string().c_str(),
              arc->to()->name(),
@@ -566,22 +748,24 @@ GraphDelayCalc::findInputArcDelay(const Pin *drvr_pin,
     parasiticLoad(drvr_pin, drvr_rf, dcalc_ap, nullptr, arc_delay_calc_,
                   load_cap, parasitic);
 
+    // Drive cells are shared by many ports with the same input slew
+    // and similar boundary loads, so both evaluations memoize well.
     LoadPinIndexMap load_pin_index_map = makeLoadPinIndexMap(drvr_vertex);
     ArcDcalcResult intrinsic_result =
-      arc_delay_calc_->gateDelay(drvr_pin, arc, Slew(from_slew), 0.0, nullptr,
-                                 load_pin_index_map, dcalc_ap);
+      gateDelayCached(drvr_pin, arc, Slew(from_slew), 0.0, nullptr,
+                      load_pin_index_map, dcalc_ap, arc_delay_calc_);
     ArcDelay intrinsic_delay = intrinsic_result.gateDelay();
 
-    ArcDcalcResult gate_result = arc_delay_calc_->gateDelay(drvr_pin, arc,
-                                                            Slew(from_slew), load_cap,
-                                                            parasitic, 
-                                                            load_pin_index_map,
-                                                            dcalc_ap);
+    ArcDcalcResult gate_result = gateDelayCached(drvr_pin, arc,
+                                                 Slew(from_slew), load_cap,
+                                                 parasitic,
+                                                 load_pin_index_map,
+                                                 dcalc_ap, arc_delay_calc_);
     ArcDelay gate_delay = gate_result.gateDelay();
     Slew gate_slew = gate_result.drvrSlew();
 
     ArcDelay load_delay = gate_delay - intrinsic_delay;
-    debugPrint(debug_, "delay_calc", 3,
+    debugPrintHot(debug_, "delay_calc", 3,
                "    gate delay = %s intrinsic = %s slew = %s",
                delayAsString(gate_delay, this),
                delayAsString(intrinsic_delay, this),
@@ -604,8 +788,19 @@ GraphDelayCalc::findVertexDelay(Vertex *vertex,
                                 ArcDelayCalc *arc_delay_calc,
                                 bool propagate)
 {
+  findVertexDelay(vertex, arc_delay_calc, propagate, nullptr, nullptr);
+}
+
+void
+GraphDelayCalc::findVertexDelay(Vertex *vertex,
+                                ArcDelayCalc *arc_delay_calc,
+                                bool propagate,
+                                EdgeSeq *staged_check_edges,
+                                EdgeSeq *staged_latch_edges)
+{
+  incrQueryCounter(QueryCounter::delay_calc);
   const Pin *pin = vertex->pin();
-  debugPrint(debug_, "delay_calc", 2, "find delays %s (%s)",
+  debugPrintHot(debug_, "delay_calc", 2, "find delays %s (%s)",
              vertex->to_string(this).c_str(),
              network_->cellName(network_->instance(pin)));
   if (vertex->isRoot()) {
@@ -623,7 +818,8 @@ GraphDelayCalc::findVertexDelay(Vertex *vertex,
         findDriverDelays(vertex, arc_delay_calc, load_pin_index_map);
 	if (propagate) {
 	  if (network_->direction(pin)->isInternal())
-	    enqueueTimingChecksEdges(vertex);
+	    enqueueTimingChecksEdges(vertex, staged_check_edges,
+                                     staged_latch_edges);
           // Enqueue adjacent vertices even if the load slews did not
 	  // change when non-incremental to stride past annotations.
 	  if (!incremental_
@@ -633,7 +829,7 @@ GraphDelayCalc::findVertexDelay(Vertex *vertex,
       }
       else {
 	// Load vertex.
-	enqueueTimingChecksEdges(vertex);
+	enqueueTimingChecksEdges(vertex, staged_check_edges, staged_latch_edges);
 	// Enqueue driver vertices from this input load.
 	if (propagate)
 	  iter_->enqueueAdjacentVertices(vertex);
@@ -656,13 +852,17 @@ GraphDelayCalc::loadSlews(LoadPinIndexMap &load_pin_index_map)
     Vertex *load_vertex = graph_->pinLoadVertex(pin);
     SlewSeq &slews = load_slews[index];;
     slews.resize(slew_count);
-    Slew *vertex_slews = load_vertex->slews();
+    const DelayStorage *vertex_slews = load_vertex->slews();
     for (size_t i = 0; i < slew_count; i++)
       slews[i] = vertex_slews[i];
   }
   return load_slews;
 }
 
+// Damp incremental propagation: descending stops when the recomputed
+// load slews match the previous values within the incremental delay
+// tolerance, so an eco that converges after a couple of stages does
+// not recompute its whole forward cone.
 bool
 GraphDelayCalc::loadSlewsChanged(DrvrLoadSlews &load_slews_prev,
                                  LoadPinIndexMap &load_pin_index_map)
@@ -671,49 +871,86 @@ GraphDelayCalc::loadSlewsChanged(DrvrLoadSlews &load_slews_prev,
   for (auto const [pin, index] : load_pin_index_map) {
     Vertex *load_vertex = graph_->pinLoadVertex(pin);
     SlewSeq &slews_prev = load_slews_prev[index];;
-    const Slew *slews = load_vertex->slews();
+    const DelayStorage *slews = load_vertex->slews();
     for (size_t i = 0; i < slew_count; i++) {
-      if (!delayEqual(slews[i], slews_prev[i]))
-        return true;
+      if (!delayEqual(slews[i], slews_prev[i])) {
+        float slew1 = delayAsFloat(slews[i]);
+        float slew_prev1 = delayAsFloat(slews_prev[i]);
+        if (slew_prev1 == 0.0
+            || (abs(slew1 - slew_prev1) / slew_prev1
+                > incremental_delay_tolerance_))
+          return true;
+      }
     }
   }
   return false;
 }
 
+// Stage the edges into the visitor's thread when staging buffers are
+// supplied so the level visit does not contend on the invalid edge lock.
 void
-GraphDelayCalc::enqueueTimingChecksEdges(Vertex *vertex)
+GraphDelayCalc::enqueueTimingChecksEdges(Vertex *vertex,
+                                         EdgeSeq *staged_check_edges,
+                                         EdgeSeq *staged_latch_edges)
+{
+  if (staged_check_edges)
+    enqueueTimingChecksEdges(vertex, *staged_check_edges, *staged_latch_edges);
+  else {
+    EdgeSeq check_edges;
+    EdgeSeq latch_edges;
+    enqueueTimingChecksEdges(vertex, check_edges, latch_edges);
+    mergeInvalidEdges(check_edges, latch_edges);
+  }
+}
+
+void
+GraphDelayCalc::enqueueTimingChecksEdges(Vertex *vertex,
+                                         EdgeSeq &check_edges,
+                                         EdgeSeq &latch_edges)
 {
   if (vertex->hasChecks()) {
     VertexInEdgeIterator edge_iter(vertex, graph_);
-    LockGuard lock(invalid_edge_lock_);
     while (edge_iter.hasNext()) {
       Edge *edge = edge_iter.next();
       if (edge->role()->isTimingCheck())
-        invalid_check_edges_.insert(edge);
+        check_edges.push_back(edge);
     }
   }
   if (vertex->isCheckClk()) {
     VertexOutEdgeIterator edge_iter(vertex, graph_);
-    LockGuard lock(invalid_edge_lock_);
     while (edge_iter.hasNext()) {
       Edge *edge = edge_iter.next();
       if (edge->role()->isTimingCheck())
-        invalid_check_edges_.insert(edge);
+        check_edges.push_back(edge);
     }
   }
   if (network_->isLatchData(vertex->pin())) {
     // Latch D->Q arcs have to be re-evaled if level(D) > level(E)
     // because levelization does not traverse D->Q arcs to break loops.
     VertexOutEdgeIterator edge_iter(vertex, graph_);
-    LockGuard lock(invalid_edge_lock_);
     while (edge_iter.hasNext()) {
       Edge *edge = edge_iter.next();
       if (edge->role() == TimingRole::latchDtoQ())
-        invalid_latch_edges_.insert(edge);
+        latch_edges.push_back(edge);
     }
   }
 }
 
+// Publish staged edges to the shared invalid edge sets; one lock per
+// visitor rather than one per vertex.
+void
+GraphDelayCalc::mergeInvalidEdges(const EdgeSeq &check_edges,
+                                  const EdgeSeq &latch_edges)
+{
+  if (!check_edges.empty() || !latch_edges.empty()) {
+    LockGuard lock(invalid_edge_lock_);
+    for (Edge *edge : check_edges)
+      invalid_check_edges_.insert(edge);
+    for (Edge *edge : latch_edges)
+      invalid_latch_edges_.insert(edge);
+  }
+}
+
 void
 GraphDelayCalc::findDriverDelays(Vertex *drvr_vertex,
                                  ArcDelayCalc *arc_delay_calc,
@@ -801,7 +1038,7 @@ GraphDelayCalc::makeMultiDrvrNet(Vertex *drvr_vertex)
 {
   Vertex *load_vertex = firstLoad(drvr_vertex);
   if (load_vertex) {
-    debugPrint(debug_, "delay_calc", 3, "multi-driver net");
+    debugPrintHot(debug_, "delay_calc", 3, "multi-driver net");
     MultiDrvrNet *multi_drvr = new MultiDrvrNet;
     VertexSeq &drvr_vertices = multi_drvr->drvrs();
     Level max_drvr_level = 0;
@@ -813,7 +1050,7 @@ GraphDelayCalc::makeMultiDrvrNet(Vertex *drvr_vertex)
         Vertex *drvr = edge->from(graph_);
         const Pin *drvr_pin = drvr->pin();
         if (isLeafDriver(drvr_pin, network_)) {
-          debugPrint(debug_, "delay_calc", 3, " %s",
+          debugPrintHot(debug_, "delay_calc", 3, " %s",
                      network_->pathName(drvr_pin));
           multi_drvr_net_map_[drvr] = multi_drvr;
           drvr_vertices.push_back(drvr);
@@ -843,6 +1080,8 @@ GraphDelayCalc::initLoadSlews(Vertex *drvr_vertex)
     if (wire_edge->isWire()) {
       Vertex *load_vertex = wire_edge->to(graph_);
       for (const DcalcAnalysisPt *dcalc_ap : corners_->dcalcAnalysisPts()) {
+        if (!findDelaysFor(dcalc_ap))
+          continue;
         const MinMax *slew_min_max = dcalc_ap->slewMinMax();
         Slew slew_init_value(slew_min_max->initValue());
         DcalcAPIndex ap_index = dcalc_ap->index();
@@ -892,6 +1131,8 @@ void
 GraphDelayCalc::initRootSlews(Vertex *vertex)
 {
   for (const DcalcAnalysisPt *dcalc_ap : corners_->dcalcAnalysisPts()) {
+    if (!findDelaysFor(dcalc_ap))
+      continue;
     const MinMax *slew_min_max = dcalc_ap->slewMinMax();
     DcalcAPIndex ap_index = dcalc_ap->index();
     for (const RiseFall *rf : RiseFall::range()) {
@@ -902,17 +1143,18 @@ GraphDelayCalc::initRootSlews(Vertex *vertex)
 }
 
 void
-GraphDelayCalc::findLatchEdgeDelays(Edge *edge)
+GraphDelayCalc::findLatchEdgeDelays(Edge *edge,
+                                    ArcDelayCalc *arc_delay_calc)
 {
   Vertex *drvr_vertex = edge->to(graph_);
   const Pin *drvr_pin = drvr_vertex->pin();
   Instance *drvr_inst = network_->instance(drvr_pin);
-  debugPrint(debug_, "delay_calc", 2, "find latch D->Q %s",
+  debugPrintHot(debug_, "delay_calc", 2, "find latch D->Q %s",
              sdc_network_->pathName(drvr_inst));
   array<bool, RiseFall::index_count> delay_exists = {false, false};
   LoadPinIndexMap load_pin_index_map = makeLoadPinIndexMap(drvr_vertex);
   bool delay_changed = findDriverEdgeDelays(drvr_vertex, nullptr, edge,
-                                            arc_delay_calc_, load_pin_index_map,
+                                            arc_delay_calc, load_pin_index_map,
                                             delay_exists);
   if (delay_changed && observer_)
     observer_->delayChangedTo(drvr_vertex);
@@ -930,13 +1172,13 @@ GraphDelayCalc::findDriverEdgeDelays(Vertex *drvr_vertex,
   Vertex *from_vertex = edge->from(graph_);
   const TimingArcSet *arc_set = edge->timingArcSet();
   bool delay_changed = false;
-  for (const DcalcAnalysisPt *dcalc_ap : corners_->dcalcAnalysisPts()) {
-    for (const TimingArc *arc : arc_set->arcs()) {
-      delay_changed |= findDriverArcDelays(drvr_vertex, multi_drvr, edge, arc,
-                                           dcalc_ap, arc_delay_calc,
-                                           load_pin_index_map);
-      delay_exists[arc->toEdge()->asRiseFall()->index()] = true;
-    }
+  // Arc-major loop: each arc is visited once and evaluated for all
+  // analysis points together so the arc state and driver parasitic
+  // lookups are shared across corners.
+  for (const TimingArc *arc : arc_set->arcs()) {
+    delay_changed |= findDriverArcDelays(drvr_vertex, multi_drvr, edge, arc,
+                                         arc_delay_calc, load_pin_index_map);
+    delay_exists[arc->toEdge()->asRiseFall()->index()] = true;
   }
   if (delay_changed && observer_) {
     observer_->delayChangedFrom(from_vertex);
@@ -959,6 +1201,183 @@ GraphDelayCalc::findDriverArcDelays(Vertex *drvr_vertex,
                       arc_delay_calc, load_pin_index_map);
 }
 
+ArcDcalcCacheKey::ArcDcalcCacheKey() :
+  arc_(nullptr),
+  ap_index_(0),
+  slew_bucket_(0),
+  cap_bucket_(0),
+  parasitic_hash_(0),
+  load_count_(0)
+{
+}
+
+ArcDcalcCacheKey::ArcDcalcCacheKey(const TimingArc *arc,
+                                   int ap_index,
+                                   int64_t slew_bucket,
+                                   int64_t cap_bucket,
+                                   size_t parasitic_hash,
+                                   size_t load_count) :
+  arc_(arc),
+  ap_index_(ap_index),
+  slew_bucket_(slew_bucket),
+  cap_bucket_(cap_bucket),
+  parasitic_hash_(parasitic_hash),
+  load_count_(load_count)
+{
+}
+
+bool
+ArcDcalcCacheKey::operator==(const ArcDcalcCacheKey &key) const
+{
+  return arc_ == key.arc_
+    && ap_index_ == key.ap_index_
+    && slew_bucket_ == key.slew_bucket_
+    && cap_bucket_ == key.cap_bucket_
+    && parasitic_hash_ == key.parasitic_hash_
+    && load_count_ == key.load_count_;
+}
+
+size_t
+ArcDcalcCacheKey::hash() const
+{
+  size_t hash = hash_init_value;
+  hashIncr(hash, reinterpret_cast<size_t>(arc_));
+  hashIncr(hash, ap_index_);
+  hashIncr(hash, static_cast<size_t>(slew_bucket_));
+  hashIncr(hash, static_cast<size_t>(cap_bucket_));
+  hashIncr(hash, parasitic_hash_);
+  hashIncr(hash, load_count_);
+  return hash;
+}
+
+// Quantize a positive value to relative buckets of width tolerance.
+// Shared with the internal power memo cache in Power.
+int64_t
+dcalcCacheBucket(float value,
+                 float tolerance)
+{
+  if (value <= 0.0)
+    return std::numeric_limits<int64_t>::min();
+  return std::llround(std::log(value) / std::log1p(tolerance));
+}
+
+// Memo key for a gate delay evaluation.  Cacheable evaluations are a
+// function of the timing arc, analysis point, input slew and load, so
+// identically loaded repeats of the same cell (clock tree buffers)
+// land in the same bucket.  Returns false when the evaluation depends
+// on state the key does not cover.
+bool
+GraphDelayCalc::makeDcalcCacheKey(const Pin *drvr_pin,
+                                  const TimingArc *arc,
+                                  const Slew &in_slew,
+                                  float load_cap,
+                                  const Parasitic *parasitic,
+                                  LoadPinIndexMap &load_pin_index_map,
+                                  const DcalcAnalysisPt *dcalc_ap,
+                                  // Return value.
+                                  ArcDcalcCacheKey &key)
+{
+  float tol = dcalc_cache_tolerance_;
+  if (tol <= 0.0
+      // Slews are distributions with pocv; only cache scalar delays.
+      || variables_->pocvEnabled()
+      // Instance operating conditions make delays instance specific.
+      || sdc_->pvt(network_->instance(drvr_pin),
+                   dcalc_ap->constraintMinMax()) != nullptr)
+    return false;
+  size_t parasitic_hash = hash_init_value;
+  if (parasitic) {
+    if (parasitics_->isPiElmore(parasitic)) {
+      float c2, rpi, c1;
+      parasitics_->piModel(parasitic, c2, rpi, c1);
+      hashIncr(parasitic_hash, static_cast<size_t>(dcalcCacheBucket(c2, tol)));
+      hashIncr(parasitic_hash, static_cast<size_t>(dcalcCacheBucket(rpi, tol)));
+      hashIncr(parasitic_hash, static_cast<size_t>(dcalcCacheBucket(c1, tol)));
+      // Load delays and slews depend on the elmore to each load, in
+      // load pin index order.
+      for (const auto &load_index : load_pin_index_map) {
+        float elmore;
+        bool exists;
+        parasitics_->findElmore(parasitic, load_index.first, elmore, exists);
+        if (!exists)
+          return false;
+        hashIncr(parasitic_hash,
+                 static_cast<size_t>(dcalcCacheBucket(elmore, tol)));
+      }
+    }
+    else
+      // Detailed parasitics are unique to their nets; there is no
+      // fingerprint cheap enough to pay for itself.
+      return false;
+  }
+  key = ArcDcalcCacheKey(arc, dcalc_ap->index(),
+                         dcalcCacheBucket(delayAsFloat(in_slew), tol),
+                         dcalcCacheBucket(load_cap, tol),
+                         parasitic_hash,
+                         load_pin_index_map.size());
+  return true;
+}
+
+// Gate delay evaluation memoized by the dcalc cache when the
+// evaluation is cacheable.
+ArcDcalcResult
+GraphDelayCalc::gateDelayCached(const Pin *drvr_pin,
+                                const TimingArc *arc,
+                                const Slew &in_slew,
+                                float load_cap,
+                                const Parasitic *parasitic,
+                                LoadPinIndexMap &load_pin_index_map,
+                                const DcalcAnalysisPt *dcalc_ap,
+                                ArcDelayCalc *arc_delay_calc)
+{
+  ArcDcalcCacheKey key;
+  bool cacheable = makeDcalcCacheKey(drvr_pin, arc, in_slew, load_cap,
+                                     parasitic, load_pin_index_map,
+                                     dcalc_ap, key);
+  if (cacheable) {
+    LockGuard lock(dcalc_cache_lock_);
+    const auto cached = dcalc_cache_.find(key);
+    if (cached != dcalc_cache_.end())
+      return cached->second;
+  }
+  ArcDcalcResult dcalc_result =
+    arc_delay_calc->gateDelay(drvr_pin, arc, in_slew, load_cap, parasitic,
+                              load_pin_index_map, dcalc_ap);
+  if (cacheable) {
+    LockGuard lock(dcalc_cache_lock_);
+    dcalc_cache_[key] = dcalc_result;
+  }
+  return dcalc_result;
+}
+
+// Fused corner evaluation: one visit of the arc evaluates every
+// analysis point, sharing the arc bookkeeping and the driver
+// parasitic lookups across corners instead of refetching them
+// corner by corner.
+bool
+GraphDelayCalc::findDriverArcDelays(Vertex *drvr_vertex,
+                                    const MultiDrvrNet *multi_drvr,
+                                    Edge *edge,
+                                    const TimingArc *arc,
+                                    ArcDelayCalc *arc_delay_calc,
+                                    LoadPinIndexMap &load_pin_index_map)
+{
+  bool delay_changed = false;
+  const RiseFall *from_rf = arc->fromEdge()->asRiseFall();
+  const RiseFall *drvr_rf = arc->toEdge()->asRiseFall();
+  if (from_rf && drvr_rf) {
+    for (const DcalcAnalysisPt *dcalc_ap : corners_->dcalcAnalysisPts()) {
+      if (findDelaysFor(dcalc_ap))
+        delay_changed |= findDriverArcDelays1(drvr_vertex, multi_drvr, edge, arc,
+                                              from_rf, drvr_rf, dcalc_ap,
+                                              arc_delay_calc,
+                                              load_pin_index_map);
+    }
+    arc_delay_calc->finishDrvrPin();
+  }
+  return delay_changed;
+}
+
 bool
 GraphDelayCalc::findDriverArcDelays(Vertex *drvr_vertex,
                                     const MultiDrvrNet *multi_drvr,
@@ -972,38 +1391,56 @@ GraphDelayCalc::findDriverArcDelays(Vertex *drvr_vertex,
   const RiseFall *from_rf = arc->fromEdge()->asRiseFall();
   const RiseFall *drvr_rf = arc->toEdge()->asRiseFall();
   if (from_rf && drvr_rf) {
-    const Pin *drvr_pin = drvr_vertex->pin();
-    const Parasitic *parasitic;
-    float load_cap;
-    parasiticLoad(drvr_pin, drvr_rf, dcalc_ap, multi_drvr, arc_delay_calc,
-                  load_cap, parasitic);
+    delay_changed = findDriverArcDelays1(drvr_vertex, multi_drvr, edge, arc,
+                                         from_rf, drvr_rf, dcalc_ap,
+                                         arc_delay_calc, load_pin_index_map);
+    arc_delay_calc->finishDrvrPin();
+  }
+  return delay_changed;
+}
 
-    if (multi_drvr
-        && multi_drvr->parallelGates(network_)) {
-      ArcDcalcArgSeq dcalc_args = makeArcDcalcArgs(drvr_vertex, multi_drvr,
-                                                   edge, arc, dcalc_ap,
-                                                   arc_delay_calc);
-      ArcDcalcResultSeq dcalc_results =
-        arc_delay_calc->gateDelays(dcalc_args, load_pin_index_map, dcalc_ap);
-      for (size_t drvr_idx = 0; drvr_idx < dcalc_args.size(); drvr_idx++) {
-        ArcDcalcArg &dcalc_arg = dcalc_args[drvr_idx];
-        ArcDcalcResult &dcalc_result = dcalc_results[drvr_idx];
-        delay_changed |= annotateDelaysSlews(dcalc_arg.edge(), dcalc_arg.arc(),
-                                             dcalc_result, load_pin_index_map,
-                                             dcalc_ap);
-      }
-    }
-    else {
-      Vertex *from_vertex = edge->from(graph_);
-      const Slew in_slew = edgeFromSlew(from_vertex, from_rf, edge, dcalc_ap);
-      ArcDcalcResult dcalc_result = arc_delay_calc->gateDelay(drvr_pin, arc, in_slew,
-                                                              load_cap, parasitic,
-                                                              load_pin_index_map,
-                                                              dcalc_ap);
-      delay_changed |= annotateDelaysSlews(edge, arc, dcalc_result,
-                                           load_pin_index_map, dcalc_ap);
+bool
+GraphDelayCalc::findDriverArcDelays1(Vertex *drvr_vertex,
+                                     const MultiDrvrNet *multi_drvr,
+                                     Edge *edge,
+                                     const TimingArc *arc,
+                                     const RiseFall *from_rf,
+                                     const RiseFall *drvr_rf,
+                                     const DcalcAnalysisPt *dcalc_ap,
+                                     ArcDelayCalc *arc_delay_calc,
+                                     LoadPinIndexMap &load_pin_index_map)
+{
+  bool delay_changed = false;
+  const Pin *drvr_pin = drvr_vertex->pin();
+  const Parasitic *parasitic;
+  float load_cap;
+  parasiticLoad(drvr_pin, drvr_rf, dcalc_ap, multi_drvr, arc_delay_calc,
+                load_cap, parasitic);
+
+  if (multi_drvr
+      && multi_drvr->parallelGates(network_)) {
+    ArcDcalcArgSeq dcalc_args = makeArcDcalcArgs(drvr_vertex, multi_drvr,
+                                                 edge, arc, dcalc_ap,
+                                                 arc_delay_calc);
+    ArcDcalcResultSeq dcalc_results =
+      arc_delay_calc->gateDelays(dcalc_args, load_pin_index_map, dcalc_ap);
+    for (size_t drvr_idx = 0; drvr_idx < dcalc_args.size(); drvr_idx++) {
+      ArcDcalcArg &dcalc_arg = dcalc_args[drvr_idx];
+      ArcDcalcResult &dcalc_result = dcalc_results[drvr_idx];
+      delay_changed |= annotateDelaysSlews(dcalc_arg.edge(), dcalc_arg.arc(),
+                                           dcalc_result, load_pin_index_map,
+                                           dcalc_ap);
     }
-    arc_delay_calc->finishDrvrPin();
+  }
+  else {
+    Vertex *from_vertex = edge->from(graph_);
+    const Slew in_slew = edgeFromSlew(from_vertex, from_rf, edge, dcalc_ap);
+    ArcDcalcResult dcalc_result = gateDelayCached(drvr_pin, arc, in_slew,
+                                                  load_cap, parasitic,
+                                                  load_pin_index_map,
+                                                  dcalc_ap, arc_delay_calc);
+    delay_changed |= annotateDelaysSlews(edge, arc, dcalc_result,
+                                         load_pin_index_map, dcalc_ap);
   }
   return delay_changed;
 }
@@ -1115,7 +1552,7 @@ GraphDelayCalc::annotateDelaySlew(Edge *edge,
 {
   bool delay_changed = false;
   DcalcAPIndex ap_index = dcalc_ap->index();
-  debugPrint(debug_, "delay_calc", 3,
+  debugPrintHot(debug_, "delay_calc", 3,
              "  %s %s -> %s %s (%s) corner:%s/%s",
              arc->from()->name(),
              arc->fromEdge()->to_string().c_str(),
@@ -1124,7 +1561,7 @@ GraphDelayCalc::annotateDelaySlew(Edge *edge,
              arc->role()->to_string().c_str(),
              dcalc_ap->corner()->name(),
              dcalc_ap->delayMinMax()->to_string().c_str());
-  debugPrint(debug_, "delay_calc", 3,
+  debugPrintHot(debug_, "delay_calc", 3,
              "    gate delay = %s slew = %s",
              delayAsString(gate_delay, this),
              delayAsString(gate_slew, this));
@@ -1174,7 +1611,7 @@ GraphDelayCalc::annotateLoadDelays(Vertex *drvr_vertex,
       size_t load_idx = load_pin_index_map[load_pin];
       ArcDelay wire_delay = dcalc_result.wireDelay(load_idx);
       Slew load_slew = dcalc_result.loadSlew(load_idx);
-      debugPrint(debug_, "delay_calc", 3,
+      debugPrintHot(debug_, "delay_calc", 3,
                  "    %s load delay = %s slew = %s",
                  load_vertex->to_string(this).c_str(),
                  delayAsString(wire_delay, this),
@@ -1253,6 +1690,22 @@ GraphDelayCalc::loadCap(const Pin *drvr_pin,
   return load_cap;
 }
 
+// External, thread safe with a caller supplied arc delay calc.
+float
+GraphDelayCalc::loadCap(const Pin *drvr_pin,
+                        const DcalcAnalysisPt *dcalc_ap,
+                        ArcDelayCalc *arc_delay_calc) const
+{
+  const MinMax *min_max = dcalc_ap->constraintMinMax();
+  float load_cap = min_max->initValue();
+  for (const RiseFall *drvr_rf : RiseFall::range()) {
+    float cap = loadCap(drvr_pin, drvr_rf, dcalc_ap, arc_delay_calc);
+    load_cap = min_max->minMax(cap, load_cap);
+  }
+  arc_delay_calc->finishDrvrPin();
+  return load_cap;
+}
+
 // External
 float
 GraphDelayCalc::loadCap(const Pin *drvr_pin,
@@ -1380,6 +1833,33 @@ GraphDelayCalc::netCaps(const Pin *drvr_pin,
   if (multi_drvr)
     multi_drvr->netCaps(rf, dcalc_ap,
 			pin_cap, wire_cap, fanout, has_net_load);
+  else if (graph_) {
+    const Vertex *drvr_vertex = graph_->pinDrvrVertex(drvr_pin);
+    VertexId drvr_id = graph_->id(drvr_vertex);
+    size_t ap_rf_count = RiseFall::index_count
+      * corners_->dcalcAnalysisPtCount();
+    size_t index = drvr_id * ap_rf_count
+      + dcalc_ap->index() * RiseFall::index_count + rf->index();
+    {
+      LockGuard lock(net_caps_lock_);
+      if (drvr_id < net_caps_valid_.size()
+          && net_caps_valid_[drvr_id]) {
+        const NetCaps &net_caps = net_caps_cache_[index];
+        pin_cap = net_caps.pinCap();
+        wire_cap = net_caps.wireCap();
+        fanout = net_caps.fanout();
+        has_net_load = net_caps.hasNetLoad();
+        return;
+      }
+    }
+    findNetCaps(drvr_pin, drvr_vertex);
+    LockGuard lock(net_caps_lock_);
+    const NetCaps &net_caps = net_caps_cache_[index];
+    pin_cap = net_caps.pinCap();
+    wire_cap = net_caps.wireCap();
+    fanout = net_caps.fanout();
+    has_net_load = net_caps.hasNetLoad();
+  }
   else {
     const Corner *corner = dcalc_ap->corner();
     const MinMax *min_max = dcalc_ap->constraintMinMax();
@@ -1389,13 +1869,54 @@ GraphDelayCalc::netCaps(const Pin *drvr_pin,
   }
 }
 
+// Find and cache the net caps for all the analysis pts/transitions of
+// a driver in one pass, mirroring MultiDrvrNet::findCaps for single
+// driver nets.
+void
+GraphDelayCalc::findNetCaps(const Pin *drvr_pin,
+                            const Vertex *drvr_vertex) const
+{
+  size_t ap_rf_count = RiseFall::index_count
+    * corners_->dcalcAnalysisPtCount();
+  // Net pin walks happen outside the lock; concurrent misses on the
+  // same driver find identical caps.
+  std::vector<NetCaps> caps(ap_rf_count);
+  for (const DcalcAnalysisPt *dcalc_ap : corners_->dcalcAnalysisPts()) {
+    DcalcAPIndex ap_index = dcalc_ap->index();
+    const Corner *corner = dcalc_ap->corner();
+    const MinMax *min_max = dcalc_ap->constraintMinMax();
+    for (const RiseFall *drvr_rf : RiseFall::range()) {
+      float pin_cap, wire_cap, fanout;
+      bool has_net_load;
+      // Find pin and external pin/wire capacitance.
+      sdc_->connectedCap(drvr_pin, drvr_rf, corner, min_max,
+			 pin_cap, wire_cap, fanout, has_net_load);
+      caps[ap_index * RiseFall::index_count + drvr_rf->index()]
+        .init(pin_cap, wire_cap, fanout, has_net_load);
+    }
+  }
+  VertexId drvr_id = graph_->id(drvr_vertex);
+  LockGuard lock(net_caps_lock_);
+  if (drvr_id >= net_caps_valid_.size()) {
+    // Sized for the whole graph the first time through; vertex IDs
+    // can exceed the vertex count after deletions.
+    VertexId count = std::max(drvr_id + 1, graph_->vertexCount() + 1);
+    net_caps_valid_.resize(count);
+    net_caps_cache_.resize(count * ap_rf_count);
+  }
+  std::copy(caps.begin(), caps.end(),
+            net_caps_cache_.begin() + drvr_id * ap_rf_count);
+  net_caps_valid_[drvr_id] = true;
+}
+
 void
 GraphDelayCalc::initSlew(Vertex *vertex)
 {
   for (const RiseFall *rf : RiseFall::range()) {
     for (const DcalcAnalysisPt *dcalc_ap : corners_->dcalcAnalysisPts()) {
       const MinMax *slew_min_max = dcalc_ap->slewMinMax();
-      if (!vertex->slewAnnotated(rf, slew_min_max)) {
+      if (findDelaysFor(dcalc_ap)
+	  && !vertex->slewAnnotated(rf, slew_min_max)) {
 	DcalcAPIndex ap_index = dcalc_ap->index();
 	graph_->setSlew(vertex, rf, ap_index, slew_min_max->initValue());
       }
@@ -1408,6 +1929,8 @@ GraphDelayCalc::zeroSlewAndWireDelays(Vertex *drvr_vertex,
                                       const RiseFall *rf)
 {
   for (const DcalcAnalysisPt *dcalc_ap : corners_->dcalcAnalysisPts()) {
+    if (!findDelaysFor(dcalc_ap))
+      continue;
     DcalcAPIndex ap_index = dcalc_ap->index();
     const MinMax *slew_min_max = dcalc_ap->slewMinMax();
     // Init drvr slew.
@@ -1440,6 +1963,8 @@ GraphDelayCalc::initWireDelays(Vertex *drvr_vertex)
     Edge *wire_edge = edge_iter.next();
     if (wire_edge->isWire()) {
       for (const DcalcAnalysisPt * dcalc_ap : corners_->dcalcAnalysisPts()) {
+	if (!findDelaysFor(dcalc_ap))
+	  continue;
 	const MinMax *delay_min_max = dcalc_ap->delayMinMax();
 	Delay delay_init_value(delay_min_max->initValue());
 	DcalcAPIndex ap_index = dcalc_ap->index();
@@ -1486,7 +2011,7 @@ GraphDelayCalc::findCheckEdgeDelays(Edge *edge,
   TimingArcSet *arc_set = edge->timingArcSet();
   const Pin *to_pin = to_vertex->pin();
   Instance *inst = network_->instance(to_pin);
-  debugPrint(debug_, "delay_calc", 2, "find check %s %s -> %s",
+  debugPrintHot(debug_, "delay_calc", 2, "find check %s %s -> %s",
              sdc_network_->pathName(inst),
              network_->portName(from_vertex->pin()),
              network_->portName(to_pin));
@@ -1501,12 +2026,13 @@ GraphDelayCalc::findCheckEdgeDelays(Edge *edge,
 	related_out_pin = network_->findPin(inst, related_out_port);
       for (const DcalcAnalysisPt *dcalc_ap : corners_->dcalcAnalysisPts()) {
 	DcalcAPIndex ap_index = dcalc_ap->index();
-	if (!graph_->arcDelayAnnotated(edge, arc, ap_index)) {
+	if (findDelaysFor(dcalc_ap)
+	    && !graph_->arcDelayAnnotated(edge, arc, ap_index)) {
 	  const Slew &from_slew = checkEdgeClkSlew(from_vertex, from_rf,
 						   dcalc_ap);
 	  int slew_index = dcalc_ap->checkDataSlewIndex();
 	  const Slew &to_slew = graph_->slew(to_vertex, to_rf, slew_index);
-	  debugPrint(debug_, "delay_calc", 3,
+	  debugPrintHot(debug_, "delay_calc", 3,
                      "  %s %s -> %s %s (%s) corner:%s/%s",
                      arc_set->from()->name(),
                      arc->fromEdge()->to_string().c_str(),
@@ -1515,7 +2041,7 @@ GraphDelayCalc::findCheckEdgeDelays(Edge *edge,
                      arc_set->role()->to_string().c_str(),
                      dcalc_ap->corner()->name(),
                      dcalc_ap->delayMinMax()->to_string().c_str());
-	  debugPrint(debug_, "delay_calc", 3,
+	  debugPrintHot(debug_, "delay_calc", 3,
                      "    from_slew = %s to_slew = %s",
                      delayAsString(from_slew, this),
                      delayAsString(to_slew, this));
@@ -1525,12 +2051,12 @@ GraphDelayCalc::findCheckEdgeDelays(Edge *edge,
           ArcDelay check_delay = arc_delay_calc->checkDelay(to_pin, arc, from_slew,
                                                             to_slew, related_out_cap,
                                                             dcalc_ap);
-	  debugPrint(debug_, "delay_calc", 3,
+	  debugPrintHot(debug_, "delay_calc", 3,
                      "    check_delay = %s",
                      delayAsString(check_delay, this));
 	  graph_->setArcDelay(edge, arc, ap_index, check_delay);
 	  delay_changed = true;
-          arc_delay_calc_->finishDrvrPin();
+          arc_delay_calc->finishDrvrPin();
 	}
       }
     }
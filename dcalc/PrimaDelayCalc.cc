@@ -48,6 +48,7 @@ namespace sta {
 using std::string;
 using std::abs;
 using std::make_shared;
+using std::make_unique;
 using Eigen::SparseLU;
 using Eigen::HouseholderQR;
 using Eigen::ColPivHouseholderQR;
@@ -67,6 +68,7 @@ PrimaDelayCalc::PrimaDelayCalc(StaState *sta) :
   load_pin_index_map_(nullptr),
   pin_node_map_(network_),
   node_index_map_(ParasiticNodeLess(parasitics_, network_)),
+  g_solver_parasitic_(nullptr),
   prima_order_(3),
   make_waveforms_(false),
   waveform_drvr_pin_(nullptr),
@@ -82,6 +84,7 @@ PrimaDelayCalc::PrimaDelayCalc(const PrimaDelayCalc &dcalc) :
   load_pin_index_map_(nullptr),
   pin_node_map_(network_),
   node_index_map_(ParasiticNodeLess(parasitics_, network_)),
+  g_solver_parasitic_(nullptr),
   prima_order_(dcalc.prima_order_),
   make_waveforms_(false),
   waveform_drvr_pin_(nullptr),
@@ -516,8 +519,8 @@ PrimaDelayCalc::setXinit()
 void
 PrimaDelayCalc::stampEqns()
 {
-  G_.setZero();
-  C_.setZero();
+  g_triplets_.clear();
+  c_triplets_.clear();
   B_.setZero();
 
   for (size_t node_idx = 0; node_idx < node_count_; node_idx++)
@@ -540,13 +543,18 @@ PrimaDelayCalc::stampEqns()
   for (size_t drvr_idx = 0; drvr_idx < drvr_count_; drvr_idx++) {
     const ArcDcalcArg &dcalc_arg = (*dcalc_args_)[drvr_idx];
     size_t drvr_node = pin_node_map_[dcalc_arg.drvrPin()];
-    G_.coeffRef(node_count_ + drvr_idx, drvr_node) = 1.0;
-    G_.coeffRef(node_count_ + drvr_idx, node_count_ + drvr_idx) = -1.0;
+    g_triplets_.emplace_back(node_count_ + drvr_idx, drvr_node, 1.0);
+    g_triplets_.emplace_back(node_count_ + drvr_idx, node_count_ + drvr_idx, -1.0);
     // special sauce
-    G_.coeffRef(drvr_node, drvr_node) += 1e-6;
+    g_triplets_.emplace_back(drvr_node, drvr_node, 1e-6);
     B_.coeffRef(drvr_node, drvr_idx) = 1.0;
   }
 
+  // setFromTriplets sums duplicate entries and builds the compressed
+  // matrices in one pass instead of inserting coefficients one at a time.
+  G_.setFromTriplets(g_triplets_.begin(), g_triplets_.end());
+  C_.setFromTriplets(c_triplets_.begin(), c_triplets_.end());
+
   if (debug_->check("ccs_dcalc", 3)) {
     reportMatrix("G", G_);
     reportMatrix("C", C_);
@@ -559,7 +567,7 @@ void
 PrimaDelayCalc::stampConductance(size_t n1,
                                  double g)
 {
-  G_.coeffRef(n1, n1) += g;
+  g_triplets_.emplace_back(n1, n1, g);
 }
 
 // Floating resistor.
@@ -568,10 +576,10 @@ PrimaDelayCalc::stampConductance(size_t n1,
                                  size_t n2,
                                  double g)
 {
-  G_.coeffRef(n1, n1) += g;
-  G_.coeffRef(n2, n2) += g;
-  G_.coeffRef(n1, n2) -= g;
-  G_.coeffRef(n2, n1) -= g;
+  g_triplets_.emplace_back(n1, n1, g);
+  g_triplets_.emplace_back(n2, n2, g);
+  g_triplets_.emplace_back(n1, n2, -g);
+  g_triplets_.emplace_back(n2, n1, -g);
 }
 
 // Grounded capacitance.
@@ -579,7 +587,7 @@ void
 PrimaDelayCalc::stampCapacitance(size_t n1,
                                  double cap)
 {
-  C_.coeffRef(n1, n1) += cap;
+  c_triplets_.emplace_back(n1, n1, cap);
 }
 
 // Floating capacitance.
@@ -588,10 +596,10 @@ PrimaDelayCalc::stampCapacitance(size_t n1,
                                  size_t n2,
                                  double cap)
 {
-  C_.coeffRef(n1, n1) += cap;
-  C_.coeffRef(n2, n2) += cap;
-  C_.coeffRef(n1, n2) -= cap;
-  C_.coeffRef(n2, n1) -= cap;
+  c_triplets_.emplace_back(n1, n1, cap);
+  c_triplets_.emplace_back(n2, n2, cap);
+  c_triplets_.emplace_back(n1, n2, -cap);
+  c_triplets_.emplace_back(n2, n1, -cap);
 }
 
 ////////////////////////////////////////////////////////////////
@@ -762,16 +770,48 @@ PrimaDelayCalc::setPrimaReduceOrder(size_t order)
   prima_order_ = order;
 }
 
+// G depends only on the parasitic network and driver pins, not the
+// transition or min/max, so the factorization survives across the
+// rise/fall and min/max evaluations of the same net.
+Eigen::SparseLU<MatrixSd> &
+PrimaDelayCalc::gSolver()
+{
+  std::vector<const Pin*> drvr_pins;
+  drvr_pins.reserve(drvr_count_);
+  for (size_t drvr_idx = 0; drvr_idx < drvr_count_; drvr_idx++)
+    drvr_pins.push_back((*dcalc_args_)[drvr_idx].drvrPin());
+  if (g_solver_ == nullptr
+      || parasitic_network_ != g_solver_parasitic_
+      || drvr_pins != g_solver_drvr_pins_) {
+    G_.makeCompressed();
+    g_solver_ = make_unique<SparseLU<MatrixSd>>();
+    g_solver_->compute(G_);
+    if (g_solver_->info() != Eigen::Success)
+      report_->error(1752, "G matrix is singular.");
+    g_solver_parasitic_ = parasitic_network_;
+    g_solver_drvr_pins_ = std::move(drvr_pins);
+  }
+  return *g_solver_;
+}
+
+// Parasitics can be deleted once the driver's arcs are finished, so the
+// cached G factorization cannot outlive them.
+void
+PrimaDelayCalc::finishDrvrPin()
+{
+  g_solver_ = nullptr;
+  g_solver_parasitic_ = nullptr;
+  g_solver_drvr_pins_.clear();
+  DelayCalcBase::finishDrvrPin();
+}
+
 // This version fills in one column of the orthonomal matrix
 // at a time as in the Gram-Schmidt wikipedia algorithm.
 void
 PrimaDelayCalc::primaReduce()
 {
-  G_.makeCompressed();
   // Step 3: solve G*R = B for R
-  SparseLU<MatrixSd> G_solver(G_);
-  if (G_solver.info() != Eigen::Success)
-    report_->error(1752, "G matrix is singular.");
+  SparseLU<MatrixSd> &G_solver = gSolver();
   Eigen::MatrixXd R(order_, port_count_);
   R = G_solver.solve(B_);
 
@@ -823,9 +863,8 @@ PrimaDelayCalc::primaReduce()
 void
 PrimaDelayCalc::primaReduce2()
 {
-  G_.makeCompressed();
   // Step 3: solve G*R = B for R
-  Eigen::SparseLU<MatrixSd> G_solver(G_);
+  Eigen::SparseLU<MatrixSd> &G_solver = gSolver();
   Eigen::MatrixXd R(order_, port_count_);
   R = G_solver.solve(B_);
 
@@ -26,6 +26,7 @@
 
 #include <vector>
 #include <map>
+#include <memory>
 #include <Eigen/SparseCore>
 #include <Eigen/SparseLU>
 
@@ -63,6 +64,7 @@ public:
   void copyState(const StaState *sta) override;
   const char *name() const override { return "prima"; }
   void setPrimaReduceOrder(size_t order);
+  void finishDrvrPin() override;
   Parasitic *findParasitic(const Pin *drvr_pin,
                            const RiseFall *rf,
                            const DcalcAnalysisPt *dcalc_ap) override;
@@ -151,6 +153,7 @@ protected:
                      const MinMax *min_max);
   void primaReduce();
   void primaReduce2();
+  Eigen::SparseLU<MatrixSd> &gSolver();
 
   void reportMatrix(const char *name,
                     MatrixSd &matrix);
@@ -194,6 +197,18 @@ protected:
   Eigen::VectorXd x_init_;
   Eigen::VectorXd u_;
 
+  // Stamping scratch; setFromTriplets builds the sparse matrices in one
+  // pass instead of inserting coefficients one at a time.
+  std::vector<Eigen::Triplet<double>> g_triplets_;
+  std::vector<Eigen::Triplet<double>> c_triplets_;
+
+  // G depends only on the parasitic network and driver pins, so its
+  // factorization is shared by the rise/fall and min/max evaluations
+  // of the same net.
+  std::unique_ptr<Eigen::SparseLU<MatrixSd>> g_solver_;
+  const Parasitic *g_solver_parasitic_;
+  std::vector<const Pin*> g_solver_drvr_pins_;
+
   // Prima reduced MNA eqns
   size_t prima_order_;
   Eigen::MatrixXd Vq_;
@@ -208,6 +208,13 @@ DelayDbl::operator+=(const Delay &delay)
   sigma2_ += delay.sigma2_;
 }
 
+void
+DelayDbl::operator+=(const DelayDbl &delay)
+{
+  mean_ += delay.mean_;
+  sigma2_ += delay.sigma2_;
+}
+
 void
 DelayDbl::operator-=(const Delay &delay)
 {
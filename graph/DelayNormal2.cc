@@ -233,6 +233,14 @@ DelayDbl::operator+=(const Delay &delay)
   sigma2_[late_index] += delay.sigma2_[late_index];
 }
 
+void
+DelayDbl::operator+=(const DelayDbl &delay)
+{
+  mean_ += delay.mean_;
+  sigma2_[early_index] += delay.sigma2_[early_index];
+  sigma2_[late_index] += delay.sigma2_[late_index];
+}
+
 void
 DelayDbl::operator-=(const Delay &delay)
 {
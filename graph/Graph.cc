@@ -24,7 +24,12 @@
 
 #include "Graph.hh"
 
+#include <algorithm> // min
+#include <new>
+#include <thread>
+
 #include "Debug.hh"
+#include "DispatchQueue.hh"
 #include "Stats.hh"
 #include "MinMax.hh"
 #include "Mutex.hh"
@@ -36,6 +41,7 @@
 #include "Network.hh"
 #include "DcalcAnalysisPt.hh"
 #include "FuncExpr.hh"
+#include "VertexVisitor.hh"
 
 namespace sta {
 
@@ -56,7 +62,11 @@ Graph::Graph(StaState *sta,
   slew_rf_count_(slew_rf_count),
   ap_count_(ap_count),
   period_check_annotations_(nullptr),
-  reg_clk_vertices_(new VertexSet(graph_))
+  have_delay_annotations_(false),
+  reg_clk_vertices_(new VertexSet(graph_)),
+  defer_delay_init_(false),
+  edge_ranges_valid_(false),
+  delay_journal_active_(false)
 {
   // For the benifit of reg_clk_vertices_ that references graph_.
   graph_ = this;
@@ -76,8 +86,14 @@ void
 Graph::makeGraph()
 {
   Stats stats(debug_, report_);
+  // Defer the per-object slew and arc delay allocation to a parallel
+  // pass over the finished graph; it dominates construction time on
+  // large designs and each vertex and edge is independent.
+  defer_delay_init_ = true;
   makeVerticesAndEdges();
   makeWireEdges();
+  defer_delay_init_ = false;
+  initSlews();
   stats.report("Make graph");
 }
 
@@ -90,6 +106,8 @@ Graph::makeVerticesAndEdges()
 {
   vertices_ = new VertexTable;
   edges_ = new EdgeTable;
+  // Preallocate one contiguous vertex slab; most pins make one vertex.
+  vertices_->reserve(network_->leafPinCount());
 
   LeafInstanceIterator *leaf_iter = network_->leafInstanceIterator();
   while (leaf_iter->hasNext()) {
@@ -438,9 +456,11 @@ Graph::makeVertex(Pin *pin,
 {
   Vertex *vertex = vertices_->make();
   vertex->init(pin, is_bidirect_drvr, is_reg_clk);
-  initSlews(vertex);
+  if (!defer_delay_init_)
+    initSlews(vertex);
   if (is_reg_clk)
     reg_clk_vertices_->insert(vertex);
+  edge_ranges_valid_ = false;
   return vertex;
 }
 
@@ -475,6 +495,7 @@ Graph::pinLoadVertex(const Pin *pin) const
 void
 Graph::deleteVertex(Vertex *vertex)
 {
+  edge_ranges_valid_ = false;
   if (vertex->isRegClk())
     reg_clk_vertices_->erase(vertex);
   Pin *pin = vertex->pin_;
@@ -578,7 +599,7 @@ Path *
 Graph::makePaths(Vertex *vertex,
                  uint32_t count)
 {
-  Path *paths = new Path[count];
+  Path *paths = allocPaths(count);
   vertex->setPaths(paths);
   return paths;
 }
@@ -592,28 +613,113 @@ Graph::paths(const Vertex *vertex) const
 void
 Graph::deletePaths(Vertex *vertex)
 {
-  vertex->setPaths(nullptr);
+  Path *paths = vertex->paths();
+  if (paths) {
+    vertex->setPaths(nullptr);
+    freePaths(paths);
+  }
   vertex->tag_group_index_ = tag_group_index_max;
 }
 
+// Bulk free of the path arrays for every vertex when a search
+// generation is invalidated.  Releasing the arena chunks wholesale
+// skips the per-array destructor calls and free list bookkeeping;
+// vertex paths are never enum paths, so their destructors are no-ops.
+void
+Graph::clearPaths()
+{
+  VertexIterator vertex_iter(this);
+  while (vertex_iter.hasNext()) {
+    Vertex *vertex = vertex_iter.next();
+    vertex->setPaths(nullptr);
+    vertex->tag_group_index_ = tag_group_index_max;
+  }
+  for (PathAlloc &path_alloc : path_allocs_) {
+    path_alloc.free_lists.clear();
+    path_alloc.arena.clear();
+  }
+}
+
+void
+Graph::setPathSpillEnabled(bool enabled)
+{
+  for (PathAlloc &path_alloc : path_allocs_) {
+    LockGuard lock(path_alloc.lock);
+    path_alloc.arena.setFileBacked(enabled);
+  }
+}
+
+// Coding guidelines preclude thread_local, so the calling thread
+// hashes to an allocator shard instead.
+Graph::PathAlloc &
+Graph::pathAlloc()
+{
+  size_t hash = std::hash<std::thread::id>()(std::this_thread::get_id());
+  return path_allocs_[hash % path_alloc_shard_count];
+}
+
+// The path count is recorded ahead of each array so freePaths can
+// recycle it; the header is max_align_t sized to preserve the array
+// alignment.
+static constexpr size_t path_header_size = alignof(std::max_align_t);
+
+Path *
+Graph::allocPaths(uint32_t count)
+{
+  Path *paths = nullptr;
+  PathAlloc &path_alloc = pathAlloc();
+  {
+    LockGuard lock(path_alloc.lock);
+    if (count < path_alloc.free_lists.size()
+        && path_alloc.free_lists[count]) {
+      paths = path_alloc.free_lists[count];
+      path_alloc.free_lists[count] = *reinterpret_cast<Path**>(paths);
+    }
+    else {
+      char *mem =
+        static_cast<char*>(path_alloc.arena.alloc(path_header_size
+                                                  + count * sizeof(Path)));
+      *reinterpret_cast<uint32_t*>(mem) = count;
+      paths = reinterpret_cast<Path*>(mem + path_header_size);
+    }
+  }
+  for (uint32_t i = 0; i < count; i++)
+    new (&paths[i]) Path();
+  return paths;
+}
+
+void
+Graph::freePaths(Path *paths)
+{
+  const char *mem = reinterpret_cast<const char*>(paths) - path_header_size;
+  uint32_t count = *reinterpret_cast<const uint32_t*>(mem);
+  for (uint32_t i = 0; i < count; i++)
+    paths[i].~Path();
+  PathAlloc &path_alloc = pathAlloc();
+  LockGuard lock(path_alloc.lock);
+  if (count >= path_alloc.free_lists.size())
+    path_alloc.free_lists.resize(count + 1);
+  // Link through the first entry.
+  *reinterpret_cast<Path**>(paths) = path_alloc.free_lists[count];
+  path_alloc.free_lists[count] = paths;
+}
+
 ////////////////////////////////////////////////////////////////
 
-const Slew &
+Slew
 Graph::slew(const Vertex *vertex,
             const RiseFall *rf,
             DcalcAPIndex ap_index)
 {
   if (slew_rf_count_) {
-    const Slew *slews = vertex->slews();
+    const DelayStorage *slews = vertex->slews();
     size_t slew_index = (slew_rf_count_ == 1)
       ? ap_index
       : ap_index*slew_rf_count_+rf->index();
     return slews[slew_index];
   }
-  else {
-    static Slew slew(0.0);
-    return slew;
-  }
+  else
+    return Slew(0.0);
 }
 
 void
@@ -623,21 +729,53 @@ Graph::setSlew(Vertex *vertex,
                const Slew &slew)
 {
   if (slew_rf_count_) {
-    Slew *slews = vertex->slews();
+    DelayStorage *slews = vertex->slews();
     if (slews == nullptr) {
       int slew_count = slew_rf_count_ * ap_count_;
-      slews = new Slew[slew_count];
+      slews = new DelayStorage[slew_count];
       vertex->setSlews(slews);
     }
     size_t slew_index = (slew_rf_count_ == 1)
       ? ap_index
       : ap_index*slew_rf_count_+rf->index();
+    if (delay_journal_active_)
+      journalDelay(&slews[slew_index]);
     slews[slew_index] = slew;
   }
 }
 
 ////////////////////////////////////////////////////////////////
 
+void
+Graph::beginDelayJournal()
+{
+  delay_journal_.clear();
+  delay_journal_active_ = true;
+}
+
+void
+Graph::rollbackDelayJournal()
+{
+  // Replay in reverse so a slot overwritten repeatedly settles back
+  // to its pre-probe value.
+  for (auto entry = delay_journal_.rbegin();
+       entry != delay_journal_.rend();
+       entry++)
+    *entry->first = entry->second;
+  delay_journal_.clear();
+  delay_journal_active_ = false;
+}
+
+void
+Graph::journalDelay(DelayStorage *slot)
+{
+  // Lock for delay calc threads.
+  LockGuard lock(delay_journal_lock_);
+  delay_journal_.push_back({slot, *slot});
+}
+
+////////////////////////////////////////////////////////////////
+
 Edge *
 Graph::edge(EdgeId edge_id) const
 {
@@ -670,7 +808,9 @@ Graph::makeEdge(Vertex *from,
   edge->vertex_in_link_ = to->in_edges_;
   to->in_edges_ = edge_id;
 
-  initArcDelays(edge);
+  if (!defer_delay_init_)
+    initArcDelays(edge);
+  edge_ranges_valid_ = false;
   return edge;
 }
 
@@ -683,6 +823,76 @@ Graph::deleteEdge(Edge *edge)
   deleteInEdge(to, edge);
   edge->clear();
   edges_->destroy(edge);
+  edge_ranges_valid_ = false;
+}
+
+void
+Graph::ensureEdgeRanges()
+{
+  if (!edge_ranges_valid_)
+    makeEdgeRanges();
+}
+
+// Pack each vertex's in/out edges into contiguous arrays so edge
+// iteration is a linear scan.  The edge lists stay the source of
+// truth for edits; the ranges are a read-only snapshot rebuilt here
+// after topology changes.
+void
+Graph::makeEdgeRanges()
+{
+  VertexId id_limit = vertices_->idLimit();
+  in_edge_begin_.assign(id_limit, 0);
+  in_edge_end_.assign(id_limit, 0);
+  out_edge_begin_.assign(id_limit, 0);
+  out_edge_end_.assign(id_limit, 0);
+  in_edge_ranges_.clear();
+  out_edge_ranges_.clear();
+  in_edge_ranges_.reserve(edges_->size());
+  out_edge_ranges_.reserve(edges_->size());
+  VertexIterator vertex_iter(this);
+  while (vertex_iter.hasNext()) {
+    Vertex *vertex = vertex_iter.next();
+    VertexId vertex_id = id(vertex);
+    in_edge_begin_[vertex_id] = in_edge_ranges_.size();
+    for (EdgeId edge_id = vertex->in_edges_; edge_id; ) {
+      Edge *edge = Graph::edge(edge_id);
+      in_edge_ranges_.push_back(edge);
+      edge_id = edge->vertex_in_link_;
+    }
+    in_edge_end_[vertex_id] = in_edge_ranges_.size();
+    out_edge_begin_[vertex_id] = out_edge_ranges_.size();
+    for (EdgeId edge_id = vertex->out_edges_; edge_id; ) {
+      Edge *edge = Graph::edge(edge_id);
+      out_edge_ranges_.push_back(edge);
+      edge_id = edge->vertex_out_next_;
+    }
+    out_edge_end_[vertex_id] = out_edge_ranges_.size();
+  }
+  edge_ranges_valid_ = true;
+}
+
+void
+Graph::inEdgeRange(const Vertex *vertex,
+		   // Return values.
+		   Edge *const *&begin,
+		   Edge *const *&end) const
+{
+  VertexId vertex_id = id(vertex);
+  Edge *const *edges = in_edge_ranges_.data();
+  begin = edges + in_edge_begin_[vertex_id];
+  end = edges + in_edge_end_[vertex_id];
+}
+
+void
+Graph::outEdgeRange(const Vertex *vertex,
+		    // Return values.
+		    Edge *const *&begin,
+		    Edge *const *&end) const
+{
+  VertexId vertex_id = id(vertex);
+  Edge *const *edges = out_edge_ranges_.data();
+  begin = edges + out_edge_begin_[vertex_id];
+  end = edges + out_edge_end_[vertex_id];
 }
 
 ArcDelay
@@ -690,7 +900,7 @@ Graph::arcDelay(const Edge *edge,
 		const TimingArc *arc,
 		DcalcAPIndex ap_index) const
 {
-  ArcDelay *delays = edge->arcDelays();
+  const DelayStorage *delays = edge->arcDelays();
   size_t index = arc->index() * ap_count_ + ap_index;
   return delays[index];
 }
@@ -701,17 +911,19 @@ Graph::setArcDelay(Edge *edge,
 		   DcalcAPIndex ap_index,
 		   ArcDelay delay)
 {
-  ArcDelay *arc_delays = edge->arcDelays();
+  DelayStorage *arc_delays = edge->arcDelays();
   size_t index = arc->index() * ap_count_ + ap_index;
+  if (delay_journal_active_)
+    journalDelay(&arc_delays[index]);
   arc_delays[index] = delay;
 }
 
-const ArcDelay &
+ArcDelay
 Graph::wireArcDelay(const Edge *edge,
 		    const RiseFall *rf,
 		    DcalcAPIndex ap_index)
 {
-  ArcDelay *delays = edge->arcDelays();
+  const DelayStorage *delays = edge->arcDelays();
   size_t index = rf->index() * ap_count_ + ap_index;
   return delays[index];
 }
@@ -722,8 +934,10 @@ Graph::setWireArcDelay(Edge *edge,
 		       DcalcAPIndex ap_index,
 		       const ArcDelay &delay)
 {
-  ArcDelay *delays = edge->arcDelays();
+  DelayStorage *delays = edge->arcDelays();
   size_t index = rf->index() * ap_count_ + ap_index;
+  if (delay_journal_active_)
+    journalDelay(&delays[index]);
   delays[index] = delay;
 }
 
@@ -734,7 +948,12 @@ Graph::arcDelayAnnotated(const Edge *edge,
 			 const TimingArc *arc,
 			 DcalcAPIndex ap_index) const
 {
-  return edge->arcDelayAnnotated(arc, ap_index, ap_count_);
+  // One test answers the common case of no SDF annotations, and the
+  // block summary skips unannotated regions of a partially annotated
+  // design without touching the edge.
+  return have_delay_annotations_
+    && edgeBlockAnnotated(edge)
+    && edge->arcDelayAnnotated(arc, ap_index, ap_count_);
 }
 
 void
@@ -743,7 +962,9 @@ Graph::setArcDelayAnnotated(Edge *edge,
 			    DcalcAPIndex ap_index,
 			    bool annotated)
 {
-  return edge->setArcDelayAnnotated(arc, ap_index, ap_count_, annotated);
+  edge->setArcDelayAnnotated(arc, ap_index, ap_count_, annotated);
+  if (annotated)
+    setEdgeBlockAnnotated(edge);
 }
 
 bool
@@ -753,7 +974,7 @@ Graph::wireDelayAnnotated(const Edge *edge,
 {
   int arc_index = TimingArcSet::wireArcIndex(rf);
   TimingArc *arc = TimingArcSet::wireTimingArcSet()->findTimingArc(arc_index);
-  return edge->arcDelayAnnotated(arc, ap_index, ap_count_);
+  return arcDelayAnnotated(edge, arc, ap_index);
 }
 
 void
@@ -764,7 +985,27 @@ Graph::setWireDelayAnnotated(Edge *edge,
 {
   int arc_index = TimingArcSet::wireArcIndex(rf);
   TimingArc *arc = TimingArcSet::wireTimingArcSet()->findTimingArc(arc_index);
-  return edge->setArcDelayAnnotated(arc, ap_index, ap_count_, annotated);
+  setArcDelayAnnotated(edge, arc, ap_index, annotated);
+}
+
+bool
+Graph::edgeBlockAnnotated(const Edge *edge) const
+{
+  size_t block = id(edge) >> EdgeTable::idx_bits;
+  size_t word = block >> 6;
+  return word < annotated_edge_blocks_.size()
+    && (annotated_edge_blocks_[word] >> (block & 0x3f)) & 1;
+}
+
+void
+Graph::setEdgeBlockAnnotated(const Edge *edge)
+{
+  size_t block = id(edge) >> EdgeTable::idx_bits;
+  size_t word = block >> 6;
+  if (word >= annotated_edge_blocks_.size())
+    annotated_edge_blocks_.resize(word + 1, 0);
+  annotated_edge_blocks_[word] |= uint64_t(1) << (block & 0x3f);
+  have_delay_annotations_ = true;
 }
 
 void
@@ -791,16 +1032,40 @@ Graph::setDelayCount(DcalcAPIndex ap_count)
 void
 Graph::initSlews()
 {
+  VertexSeq vertices;
+  vertices.reserve(vertices_->size());
   VertexIterator vertex_iter(graph_);
-  while (vertex_iter.hasNext()) {
-    Vertex *vertex = vertex_iter.next();
-    initSlews(vertex);
-
-    VertexOutEdgeIterator edge_iter(vertex, graph_);
-    while (edge_iter.hasNext()) {
-      Edge *edge = edge_iter.next();
-      initArcDelays(edge);
+  while (vertex_iter.hasNext())
+    vertices.push_back(vertex_iter.next());
+  size_t vertex_count = vertices.size();
+  size_t thread_count = thread_count_;
+  if (dispatch_queue_ && thread_count > 1) {
+    size_t chunk_size = vertex_count / thread_count + 1;
+    size_t from = 0;
+    for (size_t k = 0; k < thread_count && from < vertex_count; k++) {
+      size_t to = std::min(from + chunk_size, vertex_count);
+      dispatch_queue_->dispatch([this, &vertices, from, to](int) {
+	for (size_t i = from; i < to; i++)
+	  initVertexDelays(vertices[i]);
+      });
+      from = to;
     }
+    dispatch_queue_->finishTasks();
+  }
+  else {
+    for (Vertex *vertex : vertices)
+      initVertexDelays(vertex);
+  }
+}
+
+void
+Graph::initVertexDelays(Vertex *vertex)
+{
+  initSlews(vertex);
+  VertexOutEdgeIterator edge_iter(vertex, graph_);
+  while (edge_iter.hasNext()) {
+    Edge *edge = edge_iter.next();
+    initArcDelays(edge);
   }
 }
 
@@ -808,7 +1073,7 @@ void
 Graph::initSlews(Vertex *vertex)
 {
   size_t slew_count = slewCount();
-  Slew *slews = new Slew[slew_count];
+  DelayStorage *slews = new DelayStorage[slew_count];
   vertex->setSlews(slews);
   for (size_t i = 0; i < slew_count; i++)
     slews[i] = 0.0;
@@ -820,12 +1085,123 @@ Graph::slewCount()
   return slew_rf_count_ * ap_count_;
 }
 
+void
+Graph::visitVerticesParallel(VertexVisitor *visitor) const
+{
+  VertexSeq vertices;
+  vertices.reserve(vertices_->size());
+  VertexIterator vertex_iter(graph_);
+  while (vertex_iter.hasNext())
+    vertices.push_back(vertex_iter.next());
+  size_t vertex_count = vertices.size();
+  size_t thread_count = thread_count_;
+  if (dispatch_queue_ && thread_count > 1 && vertex_count >= thread_count) {
+    std::vector<VertexVisitor*> visitors;
+    for (size_t k = 0; k < thread_count; k++)
+      visitors.push_back(visitor->copy());
+    size_t chunk_size = vertex_count / thread_count + 1;
+    size_t from = 0;
+    for (size_t k = 0; k < thread_count && from < vertex_count; k++) {
+      size_t to = std::min(from + chunk_size, vertex_count);
+      dispatch_queue_->dispatch([&, k, from, to](int) {
+	visitors[k]->visitVertices(&vertices[from], to - from);
+      });
+      from = to;
+    }
+    dispatch_queue_->finishTasks();
+    for (VertexVisitor *visitor1 : visitors)
+      delete visitor1;
+  }
+  else
+    visitor->visitVertices(vertices.data(), vertex_count);
+}
+
+void
+Graph::visitVerticesParallelLevelized(VertexVisitor *visitor) const
+{
+  VertexSeq vertices;
+  vertices.reserve(vertices_->size());
+  VertexIterator vertex_iter(graph_);
+  while (vertex_iter.hasNext())
+    vertices.push_back(vertex_iter.next());
+  size_t vertex_count = vertices.size();
+  // Sort by level so each level is a contiguous run.
+  std::sort(vertices.begin(), vertices.end(),
+	    [](const Vertex *vertex1, const Vertex *vertex2) {
+	      return vertex1->level() < vertex2->level();
+	    });
+  size_t thread_count = thread_count_;
+  std::vector<VertexVisitor*> visitors;
+  if (dispatch_queue_ && thread_count > 1) {
+    for (size_t k = 0; k < thread_count; k++)
+      visitors.push_back(visitor->copy());
+  }
+  size_t from = 0;
+  while (from < vertex_count) {
+    Level level = vertices[from]->level();
+    size_t to = from + 1;
+    while (to < vertex_count && vertices[to]->level() == level)
+      to++;
+    size_t level_count = to - from;
+    if (!visitors.empty() && level_count >= thread_count) {
+      size_t chunk_size = level_count / thread_count + 1;
+      size_t start = from;
+      for (size_t k = 0; k < thread_count && start < to; k++) {
+	size_t end = std::min(start + chunk_size, to);
+	dispatch_queue_->dispatch([&, k, start, end](int) {
+	  visitors[k]->visitVertices(&vertices[start], end - start);
+	});
+	start = end;
+      }
+      dispatch_queue_->finishTasks();
+    }
+    else
+      visitor->visitVertices(&vertices[from], level_count);
+    visitor->levelFinished();
+    from = to;
+  }
+  for (VertexVisitor *visitor1 : visitors)
+    delete visitor1;
+}
+
+void
+Graph::memoryUsage(size_t &object_count,
+		   size_t &bytes) const
+{
+  object_count = vertices_->size() + edges_->size();
+  bytes = vertices_->memoryUsage() + edges_->memoryUsage();
+  // Slew and arc delay arrays.
+  size_t slew_bytes = slew_rf_count_ * ap_count_ * sizeof(DelayStorage);
+  VertexIterator vertex_iter(graph_);
+  while (vertex_iter.hasNext()) {
+    Vertex *vertex = vertex_iter.next();
+    if (vertex->slews())
+      bytes += slew_bytes;
+    VertexOutEdgeIterator edge_iter(vertex, graph_);
+    while (edge_iter.hasNext()) {
+      Edge *edge = edge_iter.next();
+      if (edge->arcDelays())
+	bytes += edge->timingArcSet()->arcCount() * ap_count_
+	  * sizeof(DelayStorage);
+    }
+  }
+  // Contiguous edge arrays.
+  bytes += (in_edge_ranges_.capacity() + out_edge_ranges_.capacity())
+    * sizeof(Edge*)
+    + (in_edge_begin_.capacity() + in_edge_end_.capacity()
+       + out_edge_begin_.capacity() + out_edge_end_.capacity())
+    * sizeof(uint32_t);
+  // Arrival/required path arrays.
+  for (const PathAlloc &path_alloc : path_allocs_)
+    bytes += path_alloc.arena.memoryUsage();
+}
+
 void
 Graph::initArcDelays(Edge *edge)
 {
   size_t arc_count = edge->timingArcSet()->arcCount();
   size_t delay_count = arc_count * ap_count_;
-  ArcDelay *arc_delays = new ArcDelay[delay_count];
+  DelayStorage *arc_delays = new DelayStorage[delay_count];
   edge->setArcDelays(arc_delays);
   for (size_t i = 0; i < delay_count; i++)
     arc_delays[i] = 0.0;
@@ -950,13 +1326,18 @@ Graph::removeDelaySlewAnnotations()
   VertexIterator vertex_iter(graph_);
   while (vertex_iter.hasNext()) {
     Vertex *vertex = vertex_iter.next();
-    VertexOutEdgeIterator edge_iter(vertex, graph_);
-    while (edge_iter.hasNext()) {
-      Edge *edge = edge_iter.next();
-      removeDelayAnnotated(edge);
+    if (have_delay_annotations_) {
+      VertexOutEdgeIterator edge_iter(vertex, graph_);
+      while (edge_iter.hasNext()) {
+        Edge *edge = edge_iter.next();
+        if (edgeBlockAnnotated(edge))
+          removeDelayAnnotated(edge);
+      }
     }
     vertex->removeSlewAnnotated();
   }
+  annotated_edge_blocks_.clear();
+  have_delay_annotations_ = false;
   removePeriodCheckAnnotations();
 }
 
@@ -1009,7 +1390,7 @@ Vertex::clear()
 {
   delete [] slews_;
   slews_ = nullptr;
-  delete [] paths_;
+  // Owned by the graph path arena.
   paths_ = nullptr;
 }
 
@@ -1076,7 +1457,7 @@ Vertex::setVisited2(bool visited)
 }
 
 void
-Vertex::setSlews(Slew *slews)
+Vertex::setSlews(DelayStorage *slews)
 {
   delete [] slews_;
   slews_ = slews;
@@ -1133,7 +1514,6 @@ Vertex::setTagGroupIndex(TagGroupIndex tag_index)
 void
 Vertex::setPaths(Path *paths)
 {
-  delete [] paths_;
   paths_ = paths;
 }
 
@@ -1301,7 +1681,7 @@ Edge::setTimingArcSet(TimingArcSet *set)
 }
 
 void
-Edge::setArcDelays(ArcDelay *arc_delays)
+Edge::setArcDelays(DelayStorage *arc_delays)
 {
   delete [] arc_delays_;
   arc_delays_ = arc_delays;
@@ -1519,21 +1899,37 @@ VertexIterator::findNext()
 
 VertexInEdgeIterator::VertexInEdgeIterator(Vertex *vertex,
 					   const Graph *graph) :
-  next_(graph->edge(vertex->in_edges_)),
   graph_(graph)
 {
+  init(vertex, graph);
 }
 
 VertexInEdgeIterator::VertexInEdgeIterator(VertexId vertex_id,
 					   const Graph *graph) :
-  next_(graph->edge(graph->vertex(vertex_id)->in_edges_)),
   graph_(graph)
 {
+  init(graph->vertex(vertex_id), graph);
+}
+
+void
+VertexInEdgeIterator::init(const Vertex *vertex,
+			   const Graph *graph)
+{
+  if (graph->edgeRangesValid()) {
+    next_ = nullptr;
+    graph->inEdgeRange(vertex, range_, range_end_);
+  }
+  else {
+    next_ = graph->edge(vertex->in_edges_);
+    range_ = range_end_ = nullptr;
+  }
 }
 
 Edge *
 VertexInEdgeIterator::next()
 {
+  if (range_ != range_end_)
+    return *range_++;
   Edge *next = next_;
   if (next_)
     next_ = graph_->edge(next_->vertex_in_link_);
@@ -1542,14 +1938,23 @@ VertexInEdgeIterator::next()
 
 VertexOutEdgeIterator::VertexOutEdgeIterator(Vertex *vertex,
 					     const Graph *graph) :
-  next_(graph->edge(vertex->out_edges_)),
   graph_(graph)
 {
+  if (graph->edgeRangesValid()) {
+    next_ = nullptr;
+    graph->outEdgeRange(vertex, range_, range_end_);
+  }
+  else {
+    next_ = graph->edge(vertex->out_edges_);
+    range_ = range_end_ = nullptr;
+  }
 }
 
 Edge *
 VertexOutEdgeIterator::next()
 {
+  if (range_ != range_end_)
+    return *range_++;
   Edge *next = next_;
   if (next_)
     next_ = graph_->edge(next_->vertex_out_next_);
@@ -117,6 +117,18 @@ remove_delay_slew_annotations()
   Sta::sta()->removeDelaySlewAnnotations();
 }
 
+bool
+path_spill_enabled()
+{
+  return Sta::sta()->pathSpillEnabled();
+}
+
+void
+set_path_spill_enabled(bool enabled)
+{
+  Sta::sta()->setPathSpillEnabled(enabled);
+}
+
 %} // inline
 
 ////////////////////////////////////////////////////////////////
@@ -0,0 +1,84 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2025, Parallax Software, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+//
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// This notice may not be removed or altered from any source distribution.
+
+#pragma once
+
+#include <cstddef>
+
+#include "Vector.hh"
+
+namespace sta {
+
+// Bump allocator that hands out objects from large chunks.
+// Individual objects are never freed; all of the chunks are released
+// when the arena is destroyed.  Objects allocated from an arena must
+// have their destructors called explicitly because operator delete
+// cannot be used on them.
+class Arena
+{
+public:
+  Arena();
+  ~Arena();
+  void *alloc(size_t size);
+  // Bytes of chunk storage.
+  size_t memoryUsage() const;
+  // Release all of the chunks, invalidating every object allocated
+  // from the arena.
+  void clear();
+  // Back new chunks with mappings of an unlinked scratch file instead
+  // of the heap so cold pages can be written back and evicted under
+  // memory pressure, then faulted back in on access.  Applies to
+  // chunks made after the call; existing chunks keep their backing
+  // until clear.
+  void setFileBacked(bool file_backed);
+
+private:
+  struct Chunk
+  {
+    char *mem;
+    size_t size;
+    // Scratch file descriptor backing the mapping, or -1 for a heap
+    // chunk.
+    int fd;
+  };
+  void makeChunk(size_t min_size);
+  char *makeFileChunk(size_t size,
+                      int &fd);
+  void freeChunk(const Chunk &chunk);
+
+  char *next_;
+  char *end_;
+  size_t chunk_size_;
+  bool file_backed_;
+  Vector<Chunk> chunks_;
+
+  static constexpr size_t chunk_size_min = 8192;
+  static constexpr size_t chunk_size_max = 262144;
+};
+
+} // namespace
+
+void *operator new(size_t size, sta::Arena &arena);
+// Called if a constructor throws; the memory stays in the arena.
+void operator delete(void *ptr, sta::Arena &arena) noexcept;
@@ -36,6 +36,7 @@ namespace sta {
 
 typedef std::map<const LibertyPort*, DdNode*, LibertyPortLess> BddPortVarMap;
 typedef std::map<unsigned, const LibertyPort*> BddVarIdxPortMap;
+typedef std::map<const FuncExpr*, DdNode*> BddFuncMap;
 
 class Bdd : public StaState
 {
@@ -49,13 +50,20 @@ public:
   const LibertyPort *varIndexPort(int var_index);
   BddPortVarMap &portVarMap() { return bdd_port_var_map_; }
 
+  // Bulk reset of the variable bindings and memoized function bdds.
+  // Call between runs (or after liberty changes), not per evaluation;
+  // the memo only pays off while the bindings persist.
   void clearVarMap();
   DdManager *cuddMgr() const { return cudd_mgr_; }
 
 private:
+  DdNode *funcBdd1(const FuncExpr *expr);
+
   DdManager *cudd_mgr_;
   BddPortVarMap bdd_port_var_map_;
   BddVarIdxPortMap bdd_var_idx_port_map_;
+  // Memoized funcBdd results, one reference held per entry.
+  BddFuncMap bdd_func_map_;
 };
 
 } // namespace
@@ -24,11 +24,15 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <mutex>
+#include <vector>
 
 #include "Iterator.hh"
 #include "Set.hh"
 #include "GraphClass.hh"
+#include "Graph.hh"
 #include "VertexVisitor.hh"
 #include "StaState.hh"
 
@@ -90,6 +94,16 @@ public:
   // Returns the number of vertices that are visited.
   int visitParallel(Level to_level,
 		    VertexVisitor *visitor);
+  // Progress of a visit in flight, updated at level boundaries.
+  // Safe to read from another thread while the visit runs.
+  Level visitLevel() const { return visit_level_; }
+  int visitCount() const { return visit_count_; }
+  // Ask visit/visitParallel to return at the next level boundary.
+  // Unvisited vertices stay in the queue, so a later visit resumes
+  // where the canceled one stopped.
+  void cancelVisit() { visit_cancel_ = true; }
+  bool visitCanceled() const { return visit_cancel_; }
+  void clearVisitCancel() { visit_cancel_ = false; }
 
 protected:
   BfsIterator(BfsIndex bfs_index,
@@ -105,20 +119,40 @@ protected:
 				Level level2) const = 0;
   virtual void incrLevel(Level &level) const = 0;
   void findNext(Level to_level);
+  // Visit a run of consecutive small levels in one dispatch with a
+  // spin barrier between levels to avoid joining the thread pool
+  // once per level. Returns the number of vertices visited.
+  int visitLevelsParallel(Level level,
+                          Level to_level,
+                          std::vector<VertexVisitor*> &visitors,
+                          VertexVisitor *visitor);
   void deleteEntries();
   void checkLevel(Vertex *vertex,
                   Level level);
+  void sortLevelQueue(VertexSeq &level_vertices,
+		      bool back_first) const;
 
   BfsIndex bfs_index_;
   Level level_min_;
   Level level_max_;
   SearchPred *search_pred_;
   LevelQueue queue_;
+  // Guards first_level_/last_level_; taken only when an enqueue
+  // widens the queued level range.
   std::mutex queue_lock_;
+  // Striped by level so concurrent enqueues from the parallel visits
+  // serialize per level instead of on one lock.
+  static constexpr size_t queue_lock_count = 64;
+  std::array<std::mutex, queue_lock_count> queue_level_locks_;
   // Min (max) level of queued vertices.
   Level first_level_;
   // Max (min) level of queued vertices.
   Level last_level_;
+  // Visit progress and cancellation, shared with a command shell
+  // thread when the visit runs in the background.
+  std::atomic<Level> visit_level_;
+  std::atomic<int> visit_count_;
+  std::atomic<bool> visit_cancel_;
 
   friend class BfsFwdIterator;
   friend class BfsBkwdIterator;
@@ -135,6 +169,28 @@ public:
 				       SearchPred *search_pred,
 				       Level to_level);
   using BfsIterator::enqueueAdjacentVertices;
+  // Devirtualized form for concrete predicate classes.  When the
+  // predicate type is known at the call site the searchFrom/Thru/To
+  // calls inline into the edge loop instead of dispatching three
+  // virtual calls per edge.  The SearchPred overload remains for
+  // runtime-selected predicates.
+  template <class PRED>
+  void enqueueAdjacentVertices(Vertex *vertex,
+			       PRED *search_pred,
+			       Level to_level = level_max)
+  {
+    if (search_pred->searchFrom(vertex)) {
+      VertexOutEdgeIterator edge_iter(vertex, graph_);
+      while (edge_iter.hasNext()) {
+	Edge *edge = edge_iter.next();
+	Vertex *to_vertex = edge->to(graph_);
+	if (to_vertex->level() <= to_level
+	    && search_pred->searchThru(edge)
+	    && search_pred->searchTo(to_vertex))
+	  enqueue(to_vertex);
+      }
+    }
+  }
 
 protected:
   virtual bool levelLessOrEqual(Level level1,
@@ -155,6 +211,25 @@ public:
 				       SearchPred *search_pred,
 				       Level to_level);
   using BfsIterator::enqueueAdjacentVertices;
+  // Devirtualized form for concrete predicate classes; see
+  // BfsFwdIterator::enqueueAdjacentVertices.
+  template <class PRED>
+  void enqueueAdjacentVertices(Vertex *vertex,
+			       PRED *search_pred,
+			       Level to_level = 0)
+  {
+    if (search_pred->searchTo(vertex)) {
+      VertexInEdgeIterator edge_iter(vertex, graph_);
+      while (edge_iter.hasNext()) {
+	Edge *edge = edge_iter.next();
+	Vertex *from_vertex = edge->from(graph_);
+	if (from_vertex->level() >= to_level
+	    && search_pred->searchFrom(from_vertex)
+	    && search_pred->searchThru(edge))
+	  enqueue(from_vertex);
+      }
+    }
+  }
 
 protected:
   virtual bool levelLessOrEqual(Level level1,
@@ -26,6 +26,7 @@
 
 #include "Map.hh"
 #include "Set.hh"
+#include "UnorderedSet.hh"
 #include "StaState.hh"
 #include "NetworkClass.hh"
 #include "GraphClass.hh"
@@ -33,6 +34,8 @@
 
 namespace sta {
 
+class SearchPred;
+
 typedef Map<const Pin*, ClockSet> PinClksMap;
 typedef Map<const Clock *, PinSet*> ClkPinsMap;
 
@@ -55,6 +58,8 @@ public:
   const ClockSet *idealClocks(const Pin *pin);
   const PinSet *pins(const Clock *clk);
   void clkPinsInvalid();
+  // Invalidate the classification of clk's cone only.
+  void clkPinsInvalid(Clock *clk);
   float idealClkSlew(const Pin *pin,
                      const RiseFall *rf,
                      const MinMax *min_max);
@@ -63,14 +68,36 @@ protected:
   void deletePinBefore(const Pin *pin);
   void connectPinAfter(const Pin *pin);
   void disconnectPinBefore(const Pin *pin);
+  void deleteClkBefore(Clock *clk);
   friend class Sta;
 
 private:
   void findClkPins();
-  void findClkPins(bool ideal_only,
-		   PinClksMap &clk_pin_map);
+  void findClkPins(Clock *clk,
+		   PinSet *clk_pins,
+		   PinClksMap &pin_clks_map,
+		   PinClksMap &pin_ideal_clks_map);
+  void findClkPins(Clock *clk,
+		   bool ideal_only,
+		   PinSet *clk_pins,
+		   PinClksMap &pin_clks_map);
+  void findClkPins1(Clock *clk,
+		    bool ideal_only,
+		    Vertex *vertex,
+		    SearchPred *srch_pred,
+		    UnorderedSet<Vertex*> &visited,
+		    PinSet *clk_pins,
+		    PinClksMap &pin_clks_map);
+  void mergePinClks(const PinClksMap &from,
+		    PinClksMap &to);
+  void updateClkPins();
+  void deleteClkPins(const Clock *clk);
+  void pinInvalid(const Pin *pin);
 
   bool clk_pins_valid_;
+  // Clocks whose cones need reclassification while the rest of the
+  // clock network remains valid.
+  ClockSet invalid_clks_;
   // pin -> clks
   PinClksMap pin_clks_map_;
   // pin -> ideal clks
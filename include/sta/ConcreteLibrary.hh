@@ -28,6 +28,7 @@
 
 #include "Vector.hh"
 #include "Map.hh"
+#include "UnorderedMap.hh"
 #include "StringUtil.hh"
 #include "NetworkClass.hh"
 
@@ -46,8 +47,13 @@ class LibertyCell;
 class LibertyPort;
 
 typedef Map<std::string, ConcreteCell*> ConcreteCellMap;
+// Hashed by the cell name c-string so link time cell lookups do not
+// allocate a temporary std::string or walk the sorted map per lookup.
+typedef UnorderedMap<const char*, ConcreteCell*, CharPtrHash, CharPtrEqual> ConcreteCellFindMap;
 typedef Vector<ConcretePort*> ConcretePortSeq;
-typedef Map<std::string, ConcretePort*> ConcretePortMap;
+// Hashed by the port name c-string so bus bit port lookups do not
+// allocate a temporary std::string per lookup.
+typedef UnorderedMap<const char*, ConcretePort*, CharPtrHash, CharPtrEqual> ConcretePortMap;
 typedef ConcreteCellMap::ConstIterator ConcreteLibraryCellIterator;
 typedef ConcretePortSeq::ConstIterator ConcreteCellPortIterator;
 typedef ConcretePortSeq::ConstIterator ConcretePortMemberIterator;
@@ -87,7 +93,9 @@ protected:
   bool is_liberty_;
   char bus_brkt_left_;
   char bus_brkt_right_;
+  // Sorted by cell name for iteration; lookups use cell_find_map_.
   ConcreteCellMap cell_map_;
+  ConcreteCellFindMap cell_find_map_;
 
 private:
   friend class ConcreteCell;
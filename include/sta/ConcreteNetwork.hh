@@ -24,9 +24,12 @@
 
 #pragma once
 
+#include <atomic>
 #include <functional>
+#include <mutex>
 
 #include "Map.hh"
+#include "ObjectPool.hh"
 #include "Set.hh"
 #include "StringUtil.hh"
 #include "Network.hh"
@@ -64,6 +67,9 @@ public:
   ConcreteNetwork();
   ~ConcreteNetwork();
   void clear() override;
+  void memoryUsage(// Return values.
+		   size_t &object_count,
+		   size_t &bytes) const override;
   bool linkNetwork(const char *top_cell_name,
                    bool make_black_boxes,
                    Report *report) override;
@@ -280,11 +286,19 @@ protected:
   // Cell lookup search order sequence.
   ConcreteLibrarySeq library_seq_;
   ConcreteLibraryMap library_map_;
+  // Guards the library containers when libraries are read concurrently.
+  mutable std::mutex library_lock_;
   Instance *top_instance_;
   NetSet constant_nets_[2];  // LogicValue::zero/one
   LinkNetworkFunc link_func_;
   CellNetworkViewMap cell_network_view_map_;
-  static ObjectId object_id_;
+  // Slab pools for the netlist objects; see ObjectPool.hh.
+  ObjectPool<ConcreteInstance> instance_pool_;
+  ObjectPool<ConcretePin> pin_pool_;
+  ObjectPool<ConcreteTerm> term_pool_;
+  ObjectPool<ConcreteNet> net_pool_;
+  // Object ids are handed out during parallel link, so the counter is atomic.
+  static std::atomic<ObjectId> object_id_;
 
 private:
   friend class ConcreteLibertyLibraryIterator;
@@ -308,7 +322,7 @@ public:
   void setAttribute(const std::string &key,
                     const std::string &value);
   std::string getAttribute(const std::string &key) const;
-  const AttributeMap &attributeMap() const { return attribute_map_; }
+  const AttributeMap &attributeMap() const;
   void addChild(ConcreteInstance *child);
   void deleteChild(ConcreteInstance *child);
   void addPin(ConcretePin *pin);
@@ -334,11 +348,14 @@ protected:
   ConcretePinSeq pins_;
   ConcreteInstanceChildMap *children_;
   ConcreteInstanceNetMap *nets_;
-  AttributeMap attribute_map_;
+  // Attributes are rare, so they live in a sparse side table
+  // (see instance_attribute_maps in ConcreteNetwork.cc) instead of
+  // an embedded map in every instance.
 
 private:
   friend class ConcreteNetwork;
   friend class ConcreteInstancePinIterator;
+  friend class ObjectPool<ConcreteInstance>;
 };
 
 class ConcretePin
@@ -373,6 +390,7 @@ private:
   friend class ConcreteNetwork;
   friend class ConcreteNet;
   friend class ConcreteNetPinIterator;
+  friend class ObjectPool<ConcretePin>;
 };
 
 class ConcreteTerm
@@ -398,6 +416,7 @@ private:
   friend class ConcreteNetwork;
   friend class ConcreteNet;
   friend class ConcreteNetTermIterator;
+  friend class ObjectPool<ConcreteTerm>;
 };
 
 class ConcreteNet
@@ -431,6 +450,7 @@ protected:
   friend class ConcreteNetwork;
   friend class ConcreteNetTermIterator;
   friend class ConcreteNetPinIterator;
+  friend class ObjectPool<ConcreteNet>;
 };
 
 } // namespace
@@ -24,6 +24,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include "UnorderedSet.hh"
 #include "MinMax.hh"
 #include "TimingRole.hh"
@@ -60,6 +62,13 @@ public:
   CycleAcctings(Sdc *sdc);
   ~CycleAcctings();
   void clear();
+  // Precompute the accounting for all clock edge pairs in parallel
+  // and index it by src/tgt edge index for lock-free lookup.
+  void findAcctings();
+  // Lock-free lookup in the precomputed table.
+  // Returns nullptr when the pair is not in the table.
+  CycleAccting *findAccting(const ClockEdge *src,
+			    const ClockEdge *tgt) const;
   // Find the cycle accounting info for paths that start at src clock
   // edge and end at target clock edge.
   CycleAccting *cycleAccting(const ClockEdge *src,
@@ -67,8 +76,13 @@ public:
   void reportClkToClkMaxCycleWarnings(Report *report);
 
 private:
+  void findDelays(CycleAccting *acct);
+
   Sdc *sdc_;
   CycleAcctingSet cycle_acctings_;
+  // Flat src/tgt edge index table filled by findAcctings.
+  std::vector<CycleAccting*> acct_table_;
+  int acct_edge_count_;
 };
 
 class CycleAccting
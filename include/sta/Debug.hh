@@ -71,4 +71,19 @@ protected:
     debug->reportLine(what, ##__VA_ARGS__); \
   }
 
+// Build-time gate for debug sites in the hottest loops.
+// debugPrintHot sites compile away entirely unless the build defines
+// STA_ENABLE_DEBUG_HOT (cmake -DENABLE_DEBUG_HOT=ON), removing the
+// Debug::check call from the per-vertex search and delay calc loops.
+#ifdef STA_ENABLE_DEBUG_HOT
+inline constexpr bool debug_hot_enabled = true;
+#else
+inline constexpr bool debug_hot_enabled = false;
+#endif
+
+#define debugPrintHot(debug, what, level, ...) \
+  if constexpr (debug_hot_enabled) { \
+    debugPrint(debug, what, level, ##__VA_ARGS__) \
+  }
+
 } // namespace
@@ -24,6 +24,9 @@
 
 #pragma once
 
+#include <cstdint>
+#include <cstring>
+
 #include "StaConfig.hh"
 
 // IWYU pragma: begin_exports
@@ -39,6 +42,10 @@
 #endif
 // IWYU pragma: end_exports
 
+#if GRAPH_DELAY_COMPRESSED && (SSTA != 0)
+  #error GRAPH_DELAY_COMPRESSED requires SSTA=0
+#endif
+
 namespace sta {
 
 typedef Delay ArcDelay;
@@ -47,4 +54,40 @@ typedef Delay Arrival;
 typedef Delay Required;
 typedef Delay Slack;
 
+#if GRAPH_DELAY_COMPRESSED
+
+// Storage type for graph arc delays and slews, compressed to
+// bfloat16 (the high half of an IEEE float) to halve graph memory
+// for multi-corner runs that only need limit-checking precision.
+// Values convert to float for compute.
+class DelayStorage
+{
+public:
+  DelayStorage() = default;
+  DelayStorage(float delay)
+  {
+    uint32_t float_bits;
+    memcpy(&float_bits, &delay, sizeof(float_bits));
+    // Round to nearest even.
+    float_bits += 0x7fff + ((float_bits >> 16) & 1);
+    bits_ = float_bits >> 16;
+  }
+  operator float() const
+  {
+    uint32_t float_bits = static_cast<uint32_t>(bits_) << 16;
+    float delay;
+    memcpy(&delay, &float_bits, sizeof(delay));
+    return delay;
+  }
+
+private:
+  uint16_t bits_;
+};
+
+#else
+
+typedef Delay DelayStorage;
+
+#endif
+
 } // namespace
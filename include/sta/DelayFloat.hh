@@ -24,6 +24,7 @@
 
 #pragma once
 
+#include "Fuzzy.hh"
 #include "MinMax.hh"
 
 // Delay values defined as floats.
@@ -94,59 +95,129 @@ delaySigma2(const Delay &,
 
 const Delay &
 delayInitValue(const MinMax *min_max);
-bool
+
+// The comparisons and arithmetic are inline so the float build has
+// raw float math in the arrival merge and delay calculation loops.
+
+inline bool
 delayIsInitValue(const Delay &delay,
-		 const MinMax *min_max);
-bool
-delayZero(const Delay &delay);
-bool
-delayInf(const Delay &delay);
-bool
+		 const MinMax *min_max)
+{
+  return fuzzyEqual(delay, min_max->initValue());
+}
+
+inline bool
+delayZero(const Delay &delay)
+{
+  return fuzzyZero(delay);
+}
+
+inline bool
+delayInf(const Delay &delay)
+{
+  return fuzzyInf(delay);
+}
+
+inline bool
 delayEqual(const Delay &delay1,
-	   const Delay &delay2);
-bool
+	   const Delay &delay2)
+{
+  return fuzzyEqual(delay1, delay2);
+}
+
+inline bool
 delayLess(const Delay &delay1,
 	  const Delay &delay2,
-	  const StaState *sta);
-bool
+	  const StaState *)
+{
+  return fuzzyLess(delay1, delay2);
+}
+
+inline bool
 delayLess(const Delay &delay1,
 	  const Delay &delay2,
 	  const MinMax *min_max,
-	  const StaState *sta);
-bool
+	  const StaState *)
+{
+  if (min_max == MinMax::max())
+    return fuzzyLess(delay1, delay2);
+  else
+    return fuzzyGreater(delay1, delay2);
+}
+
+inline bool
 delayLessEqual(const Delay &delay1,
 	       const Delay &delay2,
-	       const StaState *sta);
-bool
+	       const StaState *)
+{
+  return fuzzyLessEqual(delay1, delay2);
+}
+
+inline bool
 delayLessEqual(const Delay &delay1,
 	       const Delay &delay2,
 	       const MinMax *min_max,
-	       const StaState *sta);
-bool
+	       const StaState *)
+{
+  if (min_max == MinMax::max())
+    return fuzzyLessEqual(delay1, delay2);
+  else
+    return fuzzyGreaterEqual(delay1, delay2);
+}
+
+inline bool
 delayGreater(const Delay &delay1,
 	     const Delay &delay2,
-	     const StaState *sta);
-bool
+	     const StaState *)
+{
+  return fuzzyGreater(delay1, delay2);
+}
+
+inline bool
+delayGreater(const Delay &delay1,
+	     const Delay &delay2,
+	     const MinMax *min_max,
+	     const StaState *)
+{
+  if (min_max == MinMax::max())
+    return fuzzyGreater(delay1, delay2);
+  else
+    return fuzzyLess(delay1, delay2);
+}
+
+inline bool
 delayGreaterEqual(const Delay &delay1,
 		  const Delay &delay2,
-		  const StaState *sta);
-bool
+		  const StaState *)
+{
+  return fuzzyGreaterEqual(delay1, delay2);
+}
+
+inline bool
 delayGreaterEqual(const Delay &delay1,
 		  const Delay &delay2,
 		  const MinMax *min_max,
-		  const StaState *sta);
-bool
-delayGreater(const Delay &delay1,
-	     const Delay &delay2,
-	     const MinMax *min_max,
-	     const StaState *sta);
+		  const StaState *)
+{
+  if (min_max == MinMax::max())
+    return fuzzyGreaterEqual(delay1, delay2);
+  else
+    return fuzzyLessEqual(delay1, delay2);
+}
 
 // delay1-delay2 subtracting sigma instead of addiing.
-Delay
+inline Delay
 delayRemove(const Delay &delay1,
-	    const Delay &delay2);
-float
+	    const Delay &delay2)
+{
+  return delay1 - delay2;
+}
+
+inline float
 delayRatio(const Delay &delay1,
-	   const Delay &delay2);
+	   const Delay &delay2)
+{
+  return delay1 / delay2;
+}
 
 } // namespace
@@ -78,6 +78,7 @@ public:
   float sigma2() const;
   void operator=(float delay);
   void operator+=(const Delay &delay);
+  void operator+=(const DelayDbl &delay);
   void operator-=(const Delay &delay);
 
 private:
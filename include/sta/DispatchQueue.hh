@@ -9,7 +9,8 @@
 #include <functional>
 #include <vector>
 #include <cstdint>
-#include <queue>
+#include <deque>
+#include <memory>
 #include <mutex>
 #include <condition_variable>
 #include <atomic>
@@ -25,6 +26,12 @@ public:
   ~DispatchQueue();
   void setThreadCount(size_t thread_count);
   size_t getThreadCount() const;
+  // Discard the thread handles inherited by a forked child process
+  // and spawn a fresh crew.  The queue must be quiescent at the fork.
+  void restartAfterFork();
+  // Pin each worker to a processor so its memory references stay
+  // node-local on NUMA hosts.
+  void setThreadAffinityEnabled(bool enabled);
   // Dispatch and copy.
   void dispatch(const fp_t& op);
   // Dispatch and move.
@@ -38,15 +45,34 @@ public:
   DispatchQueue& operator=(DispatchQueue&& rhs) = delete;
 
 private:
+  // Per-thread task queue so dispatch and the workers do not all
+  // contend on one lock.  A worker pops its own queue from the front
+  // and steals from the back of another queue when its own runs dry.
+  struct ThreadQueue
+  {
+    std::mutex lock;
+    std::deque<fp_t> tasks;
+  };
+
+  void makeThreads(size_t thread_count);
+  void pinThreads();
   void dispatch_thread_handler(size_t i);
   void terminateThreads();
+  bool popTask(size_t i, fp_t &op);
+  bool haveTask();
 
   std::mutex lock_;
   std::vector<std::thread> threads_;
-  std::queue<fp_t> q_;
+  std::vector<std::unique_ptr<ThreadQueue>> queues_;
   std::condition_variable cv_;
+  // Completion barrier for finishTasks.
+  std::mutex done_lock_;
+  std::condition_variable done_cv_;
+  // Round-robin task placement cursor.
+  std::atomic<size_t> next_queue_;
   std::atomic<size_t> pending_task_count_;
   bool quit_ = false;
+  bool pin_threads_ = false;
 };
 
 } // namespace
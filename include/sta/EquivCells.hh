@@ -31,6 +31,8 @@
 
 namespace sta {
 
+class DispatchQueue;
+
 typedef Map<LibertyCell*, LibertyCellSeq*> EquivCellMap;
 typedef UnorderedMap<unsigned, LibertyCellSeq*> LibertyCellHashMap;
 
@@ -39,13 +41,17 @@ class EquivCells
 public:
   // Find equivalent cells in equiv_libs.
   // Optionally add mappings for cells in map_libs.
+  // Cell hashing is partitioned across dispatch_queue when it is non-null.
   EquivCells(LibertyLibrarySeq *equiv_libs,
-	     LibertyLibrarySeq *map_libs);
+	     LibertyLibrarySeq *map_libs,
+	     DispatchQueue *dispatch_queue = nullptr);
   ~EquivCells();
   // Find equivalents for cell (member of from_libs) in to_libs.
   LibertyCellSeq *equivs(LibertyCell *cell);
-  
+
 protected:
+  void findCellHashes(LibertyLibrarySeq *libs,
+		      DispatchQueue *dispatch_queue);
   void findEquivCells(const LibertyLibrary *library,
 		      LibertyCellHashMap &hash_matches);
   void mapEquivCells(const LibertyLibrary *library,
@@ -54,6 +60,8 @@ protected:
   EquivCellMap equiv_cells_;
   // Unique cell for each equiv cell group.
   LibertyCellSeq unique_equiv_cells_;
+  // Precomputed cell hashes.
+  UnorderedMap<const LibertyCell*, unsigned> cell_hashes_;
 };
 
 // Predicate that is true when the ports, functions, sequentials and
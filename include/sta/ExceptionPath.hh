@@ -558,6 +558,7 @@ protected:
   void deleteEdge(const EdgePins &edge);
   void deleteNet(const Net *net,
                  const Network *network);
+  void makeMatchPins(const Network *network);
   void makeAllEdges(const Network *network);
   void makePinEdges(const Network *network);
   void makeNetEdges(const Network *network);
@@ -583,6 +584,9 @@ protected:
   EdgePinsSet *edges_;
   NetSet *nets_;
   InstanceSet *insts_;
+  // Compiled union of the pin, net, and instance matches so the
+  // search does one set lookup per edge visit.
+  PinSet *match_pins_;
 };
 
 ExceptionThruSeq *
@@ -24,6 +24,8 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <string>
 
 #include "Set.hh"
@@ -32,6 +34,8 @@
 
 namespace sta {
 
+class FuncExprTable;
+
 class FuncExpr
 {
 public:
@@ -48,6 +52,7 @@ public:
 	   FuncExpr *left,
 	   FuncExpr *right,
 	   LibertyPort *port);
+  ~FuncExpr();
   static FuncExpr *makePort(LibertyPort *port);
   static FuncExpr *makeNot(FuncExpr *expr);
   static FuncExpr *makeAnd(FuncExpr *left,
@@ -77,6 +82,11 @@ public:
   TimingSense portTimingSense(const LibertyPort *port) const;
   // Return true if expression has port as an input.
   bool hasPort(const LibertyPort *port) const;
+  // Approximate port support bitmap: bit port->id()%64 is set for
+  // every port in the expression's support.  A clear bit proves the
+  // port is not an input; a set bit may alias another port.
+  uint64_t portSupport() const { return port_support_; }
+  static uint64_t portSupportBit(const LibertyPort *port);
   std::string to_string() const;
   // Sub expression for a bus function (bit_offset is 0 to bus->size()-1).
   FuncExpr *bitSubExpr(int bit_offset);
@@ -88,12 +98,46 @@ public:
   std::string to_string(bool with_parens) const;
   std::string to_string(bool with_parens,
                         char op) const;
+  // Flattened truth table for repeated evaluations; built on first
+  // use and safe to call from parallel evaluation.  Returns nullptr
+  // for functions with too many inputs or with missing
+  // sub-expressions from unknown port refs.
+  FuncExprTable *table();
 
 private:
   Operator op_;
   FuncExpr *left_;
   FuncExpr *right_;
   LibertyPort *port_;
+  uint64_t port_support_;
+  // Instances of a cell share its function expressions, so parallel
+  // evaluators can race to build the table on first use.
+  std::atomic<FuncExprTable*> table_;
+};
+
+// Truth table of a function with at most max_inputs inputs, so
+// evaluating it is an indexed load instead of a recursive tree walk.
+class FuncExprTable
+{
+public:
+  explicit FuncExprTable(const FuncExpr *expr);
+  bool exists() const { return exists_; }
+  const LibertyPortSeq &ports() const { return ports_; }
+  // Function value with each input i set to bit i of index.
+  bool value(size_t index) const
+  { return (bits_[index / 64] >> (index % 64)) & 1; }
+
+  static constexpr size_t max_inputs = 8;
+
+private:
+  static bool isComplete(const FuncExpr *expr);
+  static bool eval(const FuncExpr *expr,
+		   const LibertyPortSeq &ports,
+		   size_t index);
+
+  LibertyPortSeq ports_;
+  uint64_t bits_[(1 << max_inputs) / 64];
+  bool exists_;
 };
 
 // Negate an expression.
@@ -1,51 +1,98 @@
 // OpenSTA, Static Timing Analyzer
 // Copyright (c) 2025, Parallax Software, Inc.
-// 
+//
 // This program is free software: you can redistribute it and/or modify
 // it under the terms of the GNU General Public License as published by
 // the Free Software Foundation, either version 3 of the License, or
 // (at your option) any later version.
-// 
+//
 // This program is distributed in the hope that it will be useful,
 // but WITHOUT ANY WARRANTY; without even the implied warranty of
 // MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
 // GNU General Public License for more details.
-// 
+//
 // You should have received a copy of the GNU General Public License
 // along with this program. If not, see <https://www.gnu.org/licenses/>.
-// 
+//
 // The origin of this software must not be misrepresented; you must not
 // claim that you wrote the original software.
-// 
+//
 // Altered source versions must be plainly marked as such, and must not be
 // misrepresented as being the original software.
-// 
+//
 // This notice may not be removed or altered from any source distribution.
 
 #pragma once
 
+#include <algorithm> // max
+#include <cmath>     // abs
+
+#include "MinMax.hh" // INF
+
 namespace sta {
 
 // "Fuzzy" floating point comparisons that allow some tolerance.
+// Inline because they sit in the innermost arrival merge and delay
+// calculation loops.  Written with non-short-circuit operators and
+// value selects so the compiler emits compare/select instead of
+// branches; arrival merges compare values that straddle the
+// tolerance unpredictably, so avoiding the branch mispredict beats
+// skipping an operand, and branchless bodies let the compiler
+// vectorize comparison loops.
+
+constexpr static float float_equal_tolerance = 1E-15F;
 
-bool
+inline bool
 fuzzyEqual(float v1,
-	   float v2);
-bool
-fuzzyZero(float v);
-bool
+	   float v2)
+{
+  // Absolute tolerance when either value is zero, relative otherwise.
+  float tol = ((v1 == 0.0F) | (v2 == 0.0F))
+    ? float_equal_tolerance
+    : 1E-6F * std::max(std::abs(v1), std::abs(v2));
+  return (v1 == v2) | (std::abs(v1 - v2) < tol);
+}
+
+inline bool
+fuzzyZero(float v)
+{
+  return (v == 0.0F)
+    | (std::abs(v) < float_equal_tolerance);
+}
+
+inline bool
 fuzzyLess(float v1,
-	  float v2);
-bool
+	  float v2)
+{
+  return (v1 < v2) & !fuzzyEqual(v1, v2);
+}
+
+inline bool
 fuzzyLessEqual(float v1,
-	       float v2);
-bool
+	       float v2)
+{
+  return (v1 < v2) | fuzzyEqual(v1, v2);
+}
+
+inline bool
 fuzzyGreater(float v1,
-	     float v2);
-bool
+	     float v2)
+{
+  return (v1 > v2) & !fuzzyEqual(v1, v2);
+}
+
+inline bool
 fuzzyGreaterEqual(float v1,
-		  float v2);
-bool
-fuzzyInf(float value);
+		  float v2)
+{
+  return (v1 > v2) | fuzzyEqual(v1, v2);
+}
+
+inline bool
+fuzzyInf(float value)
+{
+  return fuzzyEqual(value, INF)
+    || fuzzyEqual(value, -INF);
+}
 
 } // namespace
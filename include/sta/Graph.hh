@@ -26,7 +26,10 @@
 
 #include <mutex>
 #include <atomic>
+#include <utility>
+#include <vector>
 
+#include "Arena.hh"
 #include "Iterator.hh"
 #include "Map.hh"
 #include "Vector.hh"
@@ -43,6 +46,7 @@ namespace sta {
 
 class MinMax;
 class Sdc;
+class VertexVisitor;
 
 typedef ObjectTable<Vertex> VertexTable;
 typedef ObjectTable<Edge> EdgeTable;
@@ -94,17 +98,25 @@ public:
   void deleteVertex(Vertex *vertex);
   bool hasFaninOne(Vertex *vertex) const;
   VertexId vertexCount() { return vertices_->size(); }
+  // Upper bound on vertex ids for indexing by vertex id.
+  VertexId vertexIdLimit() const { return vertices_->idLimit(); }
   Path *makePaths(Vertex *vertex,
                   uint32_t count);
   Path *paths(const Vertex *vertex) const;
   void deletePaths(Vertex *vertex);
+  void clearPaths();
+  // Back path array storage with an unlinked scratch file mapping so
+  // cold arrival/required pages spill to disk under memory pressure.
+  // Takes effect for arena chunks made after the call; existing
+  // storage migrates on the next clearPaths.
+  void setPathSpillEnabled(bool enabled);
 
   // Reported slew are the same as those in the liberty tables.
   //  reported_slews = measured_slews / slew_derate_from_library
   // Measured slews are between slew_lower_threshold and slew_upper_threshold.
-  const Slew &slew(const Vertex *vertex,
-                   const RiseFall *rf,
-                   DcalcAPIndex ap_index);
+  Slew slew(const Vertex *vertex,
+            const RiseFall *rf,
+            DcalcAPIndex ap_index);
   void setSlew(Vertex *vertex,
                const RiseFall *rf,
                DcalcAPIndex ap_index,
@@ -141,9 +153,9 @@ public:
                    DcalcAPIndex ap_index,
                    ArcDelay delay);
   // Alias for arcDelays using library wire arcs.
-  const ArcDelay &wireArcDelay(const Edge *edge,
-                               const RiseFall *rf,
-                               DcalcAPIndex ap_index);
+  ArcDelay wireArcDelay(const Edge *edge,
+                        const RiseFall *rf,
+                        DcalcAPIndex ap_index);
   void setWireArcDelay(Edge *edge,
                        const RiseFall *rf,
                        DcalcAPIndex ap_index,
@@ -186,10 +198,51 @@ public:
 				DcalcAPIndex ap_index,
 				float period);
 
+  // Journal delay and slew overwrites between beginDelayJournal and
+  // rollbackDelayJournal so a what-if probe can restore them without
+  // invalidating and recomputing the affected cone.  Probes do not
+  // nest, and no vertices or edges may be made or deleted while the
+  // journal is active.
+  void beginDelayJournal();
+  void rollbackDelayJournal();
+
   // Remove all delay and slew annotations.
   void removeDelaySlewAnnotations();
   VertexSet *regClkVertices() { return reg_clk_vertices_; }
 
+  // Visit every vertex, spreading copies of visitor across the
+  // thread pool.  visitor must be thread safe; visit order is
+  // unspecified.  Gives extension passes the same chunking as the
+  // built-in sweeps without their own thread plumbing.
+  void visitVerticesParallel(VertexVisitor *visitor) const;
+  // As above, visiting vertices in increasing level order: a level
+  // finishes (and visitor->levelFinished() is called) before the
+  // next level starts, so a pass can rely on vertex fanin being
+  // done.  Requires up to date levels (Sta::ensureLevelized).
+  void visitVerticesParallelLevelized(VertexVisitor *visitor) const;
+
+  // Graph object count and approximate bytes of storage they own
+  // (vertex/edge tables, slew and arc delay arrays, edge ranges and
+  // path arenas), for report_memory.
+  void memoryUsage(// Return values.
+		   size_t &object_count,
+		   size_t &bytes) const;
+
+  // Contiguous per-vertex edge arrays so edge iteration is a linear
+  // scan instead of chasing the edge list links through the edge
+  // table.  Topology changes invalidate the ranges and the edge
+  // iterators fall back to the lists until they are rebuilt.
+  void ensureEdgeRanges();
+  bool edgeRangesValid() const { return edge_ranges_valid_; }
+  void inEdgeRange(const Vertex *vertex,
+		   // Return values.
+		   Edge *const *&begin,
+		   Edge *const *&end) const;
+  void outEdgeRange(const Vertex *vertex,
+		    // Return values.
+		    Edge *const *&begin,
+		    Edge *const *&end) const;
+
   static constexpr int vertex_level_bits = 24;
   static constexpr int vertex_level_max = (1<<vertex_level_bits)-1;
 
@@ -219,7 +272,16 @@ protected:
   void initSlews();
   void initSlews(Vertex *vertex);
   void initArcDelays(Edge *edge);
+  void initVertexDelays(Vertex *vertex);
   void removeDelayAnnotated(Edge *edge);
+  bool edgeBlockAnnotated(const Edge *edge) const;
+  void setEdgeBlockAnnotated(const Edge *edge);
+  void makeEdgeRanges();
+  struct PathAlloc;
+  Path *allocPaths(uint32_t count);
+  void freePaths(Path *paths);
+  PathAlloc &pathAlloc();
+  void journalDelay(DelayStorage *slot);
 
   VertexTable *vertices_;
   EdgeTable *edges_;
@@ -232,8 +294,55 @@ protected:
   DcalcAPIndex ap_count_;
   // Sdf period check annotations.
   PeriodCheckAnnotations *period_check_annotations_;
+  // Hierarchical summary of the per-edge annotation bits: one bit per
+  // edge table block that holds an annotated edge, under a single
+  // "any annotations" flag.  Lets arcDelayAnnotated answer no with
+  // one test when no SDF has been read and skip whole blocks when
+  // only part of the design is annotated.  Removing one annotation
+  // leaves the summary conservative; removeDelaySlewAnnotations
+  // resets it.
+  std::vector<uint64_t> annotated_edge_blocks_;
+  bool have_delay_annotations_;
   // Register/latch clock vertices to search from.
   VertexSet *reg_clk_vertices_;
+  // True while makeGraph defers slew/arc delay allocation to the
+  // parallel initSlews pass.
+  bool defer_delay_init_;
+  // Per-vertex contiguous edge arrays with [begin, end) offsets
+  // indexed by vertex id.
+  bool edge_ranges_valid_;
+  std::vector<Edge*> in_edge_ranges_;
+  std::vector<Edge*> out_edge_ranges_;
+  std::vector<uint32_t> in_edge_begin_;
+  std::vector<uint32_t> in_edge_end_;
+  std::vector<uint32_t> out_edge_begin_;
+  std::vector<uint32_t> out_edge_end_;
+  // Path arrays are carved from arena chunks and recycled through
+  // per-count free lists so the arrival/required storage of
+  // neighboring vertices packs contiguously instead of scattering
+  // across the heap with one allocation per vertex.  The allocator is
+  // sharded by thread so concurrent arrival updates replace and reuse
+  // arrays without contending on a single lock; a replaced array goes
+  // back to the replacing thread's shard for immediate reuse.  The
+  // shard arenas are released together by clearPaths, so arrays may
+  // migrate between shard free lists safely.
+  struct PathAlloc
+  {
+    Arena arena;
+    // Free path arrays indexed by path count, linked through their
+    // first entry.
+    std::vector<Path*> free_lists;
+    std::mutex lock;
+  };
+  static constexpr int path_alloc_shard_count = 16;
+  PathAlloc path_allocs_[path_alloc_shard_count];
+  // What-if probe journal of overwritten delay/slew storage slots.
+  // An entry is appended for every overwrite and the entries are
+  // replayed in reverse, so a slot written repeatedly settles back to
+  // its pre-probe value.
+  bool delay_journal_active_;
+  std::vector<std::pair<DelayStorage*, DelayStorage>> delay_journal_;
+  std::mutex delay_journal_lock_;
 
   friend class Vertex;
   friend class VertexIterator;
@@ -264,8 +373,8 @@ public:
   bool isRoot() const{ return level_ == 0; }
   bool hasFanin() const;
   bool hasFanout() const;
-  Slew *slews() { return slews_; }
-  const Slew *slews() const { return slews_; }
+  DelayStorage *slews() { return slews_; }
+  const DelayStorage *slews() const { return slews_; }
   Path *paths() const { return paths_; }
   void setPaths(Path *paths);
   TagGroupIndex tagGroupIndex() const;
@@ -316,14 +425,14 @@ protected:
 	    bool is_bidirect_drvr,
 	    bool is_reg_clk);
   void clear();
-  void setSlews(Slew *slews);
+  void setSlews(DelayStorage *slews);
 
   Pin *pin_;
   EdgeId in_edges_;		// Edges to this vertex.
   EdgeId out_edges_;		// Edges from this vertex.
 
   // Delay calc
-  Slew *slews_;
+  DelayStorage *slews_;
   // Search
   Path *paths_;
 
@@ -378,8 +487,8 @@ public:
   TimingSense sense() const;
   TimingArcSet *timingArcSet() const { return arc_set_; }
   void setTimingArcSet(TimingArcSet *set);
-  ArcDelay *arcDelays() const { return arc_delays_; }
-  void setArcDelays(ArcDelay *arc_delays);
+  DelayStorage *arcDelays() const { return arc_delays_; }
+  void setArcDelays(DelayStorage *arc_delays);
   bool delay_Annotation_Is_Incremental() const {return delay_annotation_is_incremental_;};
   void setDelayAnnotationIsIncremental(bool is_incr);
   // Edge is disabled by set_disable_timing constraint.
@@ -426,7 +535,7 @@ protected:
   EdgeId vertex_in_link_;		// Vertex in edges list.
   EdgeId vertex_out_next_;		// Vertex out edges doubly linked list.
   EdgeId vertex_out_prev_;
-  ArcDelay *arc_delays_;
+  DelayStorage *arc_delays_;
   union {
     uintptr_t bits_;
     std::vector<bool> *seq_;
@@ -480,11 +589,18 @@ public:
 		       const Graph *graph);
   VertexInEdgeIterator(VertexId vertex_id,
 		       const Graph *graph);
-  bool hasNext() { return (next_ != nullptr); }
+  bool hasNext() { return range_ != range_end_ || next_ != nullptr; }
   Edge *next();
 
 private:
+  void init(const Vertex *vertex,
+	    const Graph *graph);
+
+  // Edge list chase when the graph edge ranges are invalid.
   Edge *next_;
+  // Contiguous edge range scan when they are valid.
+  Edge *const *range_;
+  Edge *const *range_end_;
   const Graph *graph_;
 };
 
@@ -493,11 +609,13 @@ class VertexOutEdgeIterator : public VertexEdgeIterator
 public:
   VertexOutEdgeIterator(Vertex *vertex,
 			const Graph *graph);
-  bool hasNext() { return (next_ != nullptr); }
+  bool hasNext() { return range_ != range_end_ || next_ != nullptr; }
   Edge *next();
 
 private:
   Edge *next_;
+  Edge *const *range_;
+  Edge *const *range_end_;
   const Graph *graph_;
 };
 
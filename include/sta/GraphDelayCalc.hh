@@ -27,8 +27,10 @@
 #include <vector>
 #include <mutex>
 #include <array>
+#include <cstdint>
 
 #include "Map.hh"
+#include "UnorderedMap.hh"
 #include "NetworkClass.hh"
 #include "GraphClass.hh"
 #include "SearchClass.hh"
@@ -46,6 +48,44 @@ class NetCaps;
 typedef Map<const Vertex*, MultiDrvrNet*> MultiDrvrNetMap;
 typedef std::vector<SlewSeq> DrvrLoadSlews;
 
+// Key for memoized gate delay results: the timing arc, analysis point
+// and quantized input slew, load cap and parasitic fingerprint.
+class ArcDcalcCacheKey
+{
+public:
+  ArcDcalcCacheKey();
+  ArcDcalcCacheKey(const TimingArc *arc,
+                   int ap_index,
+                   int64_t slew_bucket,
+                   int64_t cap_bucket,
+                   size_t parasitic_hash,
+                   size_t load_count);
+  bool operator==(const ArcDcalcCacheKey &key) const;
+  size_t hash() const;
+
+private:
+  const TimingArc *arc_;
+  int ap_index_;
+  int64_t slew_bucket_;
+  int64_t cap_bucket_;
+  size_t parasitic_hash_;
+  size_t load_count_;
+};
+
+class ArcDcalcCacheKeyHash
+{
+public:
+  size_t operator()(const ArcDcalcCacheKey &key) const { return key.hash(); }
+};
+
+// Quantize a positive value to relative buckets of width tolerance.
+int64_t
+dcalcCacheBucket(float value,
+                 float tolerance);
+
+typedef UnorderedMap<ArcDcalcCacheKey, ArcDcalcResult,
+                     ArcDcalcCacheKeyHash> ArcDcalcCacheMap;
+
 // This class traverses the graph calling the arc delay calculator and
 // annotating delays on graph edges.
 class GraphDelayCalc : public StaState
@@ -58,6 +98,13 @@ public:
   virtual void setObserver(DelayCalcObserver *observer);
   // Invalidate all delays/slews.
   virtual void delaysInvalid();
+  // Corner scoped invalidation: recompute only the corner's analysis
+  // points, leaving the other corners' delays/slews live.  A null
+  // corner invalidates all corners.
+  void delaysInvalid(const Corner *corner);
+  // Graph delays/slews were restored from a checkpoint; mark them
+  // valid so the next update does not repeat the delay calculation.
+  virtual void delaysRestored();
   virtual void levelsChangedBefore();
   // Invalidate vertex and downstream delays/slews.
   virtual void delayInvalid(Vertex *vertex);
@@ -80,9 +127,17 @@ public:
   // delays to be recomputed during incremental delay calculation.
   virtual float incrementalDelayTolerance();
   virtual void setIncrementalDelayTolerance(float tol);
+  // Quantization tolerance (0.0:1.0) for memoizing gate delay results
+  // across identically loaded drivers of the same arc.
+  // 0.0 disables memoization.
+  virtual float delayCalcCacheTolerance();
+  virtual void setDelayCalcCacheTolerance(float tol);
 
   float loadCap(const Pin *drvr_pin,
                 const DcalcAnalysisPt *dcalc_ap) const;
+  float loadCap(const Pin *drvr_pin,
+                const DcalcAnalysisPt *dcalc_ap,
+                ArcDelayCalc *arc_delay_calc) const;
   float loadCap(const Pin *drvr_pin,
                 const RiseFall *rf,
                 const DcalcAnalysisPt *dcalc_ap) const;
@@ -136,6 +191,7 @@ public:
 
 protected:
   void seedInvalidDelays();
+  bool findDelaysFor(const DcalcAnalysisPt *dcalc_ap) const;
   void initSlew(Vertex *vertex);
   void seedRootSlew(Vertex *vertex,
 		    ArcDelayCalc *arc_delay_calc);
@@ -192,6 +248,12 @@ protected:
                             LoadPinIndexMap &load_pin_index_map,
                             // Return value.
                             std::array<bool, RiseFall::index_count> &delay_exists);
+  bool findDriverArcDelays(Vertex *drvr_vertex,
+                           const MultiDrvrNet *multi_drvr,
+                           Edge *edge,
+                           const TimingArc *arc,
+                           ArcDelayCalc *arc_delay_calc,
+                           LoadPinIndexMap &load_pin_index_map);
   bool findDriverArcDelays(Vertex *drvr_vertex,
                            const MultiDrvrNet *multi_drvr,
                            Edge *edge,
@@ -199,6 +261,15 @@ protected:
                            const DcalcAnalysisPt *dcalc_ap,
                            ArcDelayCalc *arc_delay_calc,
                            LoadPinIndexMap &load_pin_index_map);
+  bool findDriverArcDelays1(Vertex *drvr_vertex,
+                            const MultiDrvrNet *multi_drvr,
+                            Edge *edge,
+                            const TimingArc *arc,
+                            const RiseFall *from_rf,
+                            const RiseFall *drvr_rf,
+                            const DcalcAnalysisPt *dcalc_ap,
+                            ArcDelayCalc *arc_delay_calc,
+                            LoadPinIndexMap &load_pin_index_map);
   ArcDcalcArgSeq makeArcDcalcArgs(Vertex *drvr_vertex,
                                   const MultiDrvrNet *multi_drvr,
                                   Edge *edge,
@@ -217,15 +288,44 @@ protected:
   void findVertexDelay(Vertex *vertex,
 		       ArcDelayCalc *arc_delay_calc,
 		       bool propagate);
+  void findVertexDelay(Vertex *vertex,
+		       ArcDelayCalc *arc_delay_calc,
+		       bool propagate,
+		       EdgeSeq *staged_check_edges,
+		       EdgeSeq *staged_latch_edges);
   DrvrLoadSlews loadSlews(LoadPinIndexMap &load_pin_index_map);
   bool loadSlewsChanged(DrvrLoadSlews &prev_load_slews,
                         LoadPinIndexMap &load_pin_index_map);
-  void enqueueTimingChecksEdges(Vertex *vertex);
+  void enqueueTimingChecksEdges(Vertex *vertex,
+                                EdgeSeq *staged_check_edges,
+                                EdgeSeq *staged_latch_edges);
+  void enqueueTimingChecksEdges(Vertex *vertex,
+                                EdgeSeq &check_edges,
+                                EdgeSeq &latch_edges);
+  void mergeInvalidEdges(const EdgeSeq &check_edges,
+                         const EdgeSeq &latch_edges);
   bool annotateDelaysSlews(Edge *edge,
                            const TimingArc *arc,
                            ArcDcalcResult &dcalc_result,
                            LoadPinIndexMap &load_pin_index_map,
                            const DcalcAnalysisPt *dcalc_ap);
+  bool makeDcalcCacheKey(const Pin *drvr_pin,
+                         const TimingArc *arc,
+                         const Slew &in_slew,
+                         float load_cap,
+                         const Parasitic *parasitic,
+                         LoadPinIndexMap &load_pin_index_map,
+                         const DcalcAnalysisPt *dcalc_ap,
+                         // Return value.
+                         ArcDcalcCacheKey &key);
+  ArcDcalcResult gateDelayCached(const Pin *drvr_pin,
+                                 const TimingArc *arc,
+                                 const Slew &in_slew,
+                                 float load_cap,
+                                 const Parasitic *parasitic,
+                                 LoadPinIndexMap &load_pin_index_map,
+                                 const DcalcAnalysisPt *dcalc_ap,
+                                 ArcDelayCalc *arc_delay_calc);
 
   bool annotateDelaySlew(Edge *edge,
                          const TimingArc *arc,
@@ -239,7 +339,10 @@ protected:
                           const ArcDelay &extra_delay,
                           bool merge,
                           const DcalcAnalysisPt *dcalc_ap);
-  void findLatchEdgeDelays(Edge *edge);
+  void findInvalidCheckDelays();
+  void findInvalidLatchDelays();
+  void findLatchEdgeDelays(Edge *edge,
+                           ArcDelayCalc *arc_delay_calc);
   void findCheckEdgeDelays(Edge *edge,
 			   ArcDelayCalc *arc_delay_calc);
   void deleteMultiDrvrNets();
@@ -268,6 +371,9 @@ protected:
                float &wire_cap,
                float &fanout,
                bool &has_net_load) const;
+  void findNetCaps(const Pin *drvr_pin,
+                   const Vertex *drvr_vertex) const;
+  void netCapsInvalid(Vertex *vertex);
 
   // Observer for edge delay changes.
   DelayCalcObserver *observer_;
@@ -276,6 +382,9 @@ protected:
   bool delays_exist_;
   // Vertices with invalid -to delays.
   VertexSet *invalid_delays_;
+  // Corners whose analysis points are recomputed by the pending sweep
+  // after a corner scoped delaysInvalid; empty means every corner.
+  Set<const Corner*> invalid_delay_corners_;
   // Timing check edges with invalid delays.
   EdgeSet invalid_check_edges_;
   // Latch D->Q edges with invalid delays.
@@ -291,6 +400,17 @@ protected:
   // Percentage (0.0:1.0) change in delay that causes downstream
   // delays to be recomputed during incremental delay calculation.
   float incremental_delay_tolerance_;
+  // Memoized gate delay results (setDelayCalcCacheTolerance).
+  float dcalc_cache_tolerance_;
+  ArcDcalcCacheMap dcalc_cache_;
+  std::mutex dcalc_cache_lock_;
+  // Net capacitances for single driver nets, cached to prevent N^2
+  // net pin walks as for multi-driver nets.  Stored corner-major as
+  //   dcalc_ap->index() * RiseFall::index_count + drvr_rf->index()
+  // within a block per driver vertex ID.
+  mutable std::vector<NetCaps> net_caps_cache_;
+  mutable std::vector<bool> net_caps_valid_;
+  mutable std::mutex net_caps_lock_;
 
   friend class FindVertexDelays;
   friend class MultiDrvrNet;
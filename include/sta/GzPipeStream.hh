@@ -0,0 +1,95 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2025, Parallax Software, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+//
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// This notice may not be removed or altered from any source distribution.
+
+#pragma once
+
+#include <condition_variable>
+#include <istream>
+#include <mutex>
+#include <streambuf>
+#include <thread>
+
+#include "Zlib.hh"
+#include "ZstdStream.hh"
+
+namespace sta {
+
+// Streambuf that decompresses a gzip or zstd file on a background
+// thread into a ring of buffers while the parser consumes them,
+// overlapping decompression with parsing instead of inflating inline
+// with reads.  Files with a zstd frame magic decode through zstd;
+// everything else goes through zlib, which passes uncompressed files
+// through.
+class GzPipeStreambuf : public std::streambuf
+{
+public:
+  GzPipeStreambuf();
+  ~GzPipeStreambuf();
+  bool open(const char *filename);
+  void close();
+  bool is_open() const { return gz_ != nullptr || zstd_.isOpen(); }
+
+protected:
+  int_type underflow() override;
+
+private:
+  void inflateLoop();
+
+  // Reserved for putback, matching gzstream.
+  static constexpr size_t putback_size = 4;
+  static constexpr size_t buffer_count = 4;
+  static constexpr size_t buffer_size = 256 * 1024;
+
+  struct Buffer
+  {
+    char data[putback_size + buffer_size];
+    size_t size;
+  };
+
+  gzFile gz_;
+  ZstdDecompress zstd_;
+  std::thread inflate_thread_;
+  Buffer *buffers_[buffer_count];
+  // Ring indices; producer fills filled_, consumer drains drained_.
+  size_t filled_;
+  size_t drained_;
+  bool eof_;
+  bool quit_;
+  std::mutex lock_;
+  std::condition_variable filled_cond_;
+  std::condition_variable drained_cond_;
+};
+
+class GzPipeStream : public std::istream
+{
+public:
+  GzPipeStream(const char *filename);
+  ~GzPipeStream();
+  bool is_open() const { return buf_.is_open(); }
+
+private:
+  GzPipeStreambuf buf_;
+};
+
+} // namespace
@@ -36,6 +36,7 @@
 #include "Transition.hh"
 #include "Delay.hh"
 #include "LibertyClass.hh"
+#include "Arena.hh"
 
 namespace sta {
 
@@ -70,11 +71,14 @@ typedef Map<const char*, Wireload*, CharPtrLess> WireloadMap;
 typedef Map<const char*, WireloadSelection*, CharPtrLess> WireloadSelectionMap;
 typedef Map<const char*, OperatingConditions*,
 	    CharPtrLess> OperatingConditionsMap;
+typedef Vector<OperatingConditions*> OperatingConditionsSeq;
 typedef Map<LibertyPort*, Sequential*> PortToSequentialMap;
 typedef Vector<TimingArcSet*> TimingArcSetSeq;
 typedef Set<TimingArcSet*, TimingArcSetLess> TimingArcSetMap;
 typedef Map<LibertyPortPair, TimingArcSetSeq*,
 	    LibertyPortPairLess> LibertyPortPairTimingArcMap;
+typedef Map<LibertyPortPairRole, TimingArcSetSeq*,
+	    LibertyPortPairRoleLess> LibertyPortPairRoleTimingArcMap;
 typedef Vector<InternalPower*> InternalPowerSeq;
 typedef Map<const LibertyPort *, InternalPowerSeq> PortInternalPowerSeq;
 typedef Vector<LeakagePower*> LeakagePowerSeq;
@@ -147,6 +151,17 @@ timingSenseOpposite(TimingSense sense);
 
 ////////////////////////////////////////////////////////////////
 
+// Interface for deferred cell construction when libraries are read
+// with sta_liberty_lazy_enabled (implemented by LibertyReader).
+class LibertyCellElaborator
+{
+public:
+  virtual ~LibertyCellElaborator() {}
+  // Build the cell from its saved parse tree.
+  // Returns nullptr if cell_name is not a lazy cell.
+  virtual LibertyCell *elaborateCell(const char *cell_name) = 0;
+};
+
 class LibertyLibrary : public ConcreteLibrary
 {
 public:
@@ -158,6 +173,11 @@ public:
   // Liberty cells that are buffers.
   LibertyCellSeq *buffers();
   LibertyCellSeq *inverters();
+  // Cell/port/arc count and approximate bytes of storage they own,
+  // for report_memory. Table model values are not counted.
+  void memoryUsage(// Return values.
+		   size_t &object_count,
+		   size_t &bytes) const;
 
   DelayModelType delayModelType() const { return delay_model_type_; }
   void setDelayModelType(DelayModelType type);
@@ -291,6 +311,7 @@ public:
   void setDefaultWireloadSelection(WireloadSelection *selection);
 
   OperatingConditions *findOperatingConditions(const char *name);
+  OperatingConditionsSeq operatingConditions() const;
   OperatingConditions *defaultOperatingConditions() const;
   void addOperatingConditions(OperatingConditions *op_cond);
   void setDefaultOperatingConditions(OperatingConditions *op_cond);
@@ -305,6 +326,7 @@ public:
   void addOcvDerate(OcvDerate *derate);
   void addSupplyVoltage(const char *suppy_name,
 			float voltage);
+  const SupplyVoltageMap &supplyVoltageMap() const { return supply_voltage_map_; }
   bool supplyExists(const char *suppy_name) const;
   void supplyVoltage(const char *supply_name,
 		     // Return value.
@@ -340,6 +362,17 @@ public:
   DriverWaveform *driverWaveformDefault() { return driver_waveform_default_; }
   void addDriverWaveform(DriverWaveform *driver_waveform);
 
+  // Lazy cell elaboration (sta_liberty_lazy_enabled).
+  LibertyCellElaborator *cellElaborator() const { return cell_elaborator_; }
+  // Takes ownership of the elaborator.
+  void setCellElaborator(LibertyCellElaborator *elaborator);
+  // Corner indices to map lazy cells to when they are elaborated.
+  void recordCornerMap(int ap_index);
+  const Vector<int> &cornerMapIndices() const { return corner_map_indices_; }
+
+  // Allocator for the timing arcs owned by the library's cells.
+  Arena &arena() { return arena_; }
+
 protected:
   float degradeWireSlew(const TableModel *model,
 			float in_slew,
@@ -390,6 +423,9 @@ protected:
   DriverWaveformMap driver_waveform_map_;
   // Unnamed driver waveform.
   DriverWaveform *driver_waveform_default_;
+  LibertyCellElaborator *cell_elaborator_;
+  Vector<int> corner_map_indices_;
+  Arena arena_;
 
   static constexpr float input_threshold_default_ = .5;
   static constexpr float output_threshold_default_ = .5;
@@ -464,6 +500,10 @@ public:
   // from or to may be nullptr to wildcard.
   const TimingArcSetSeq &timingArcSets(const LibertyPort *from,
                                        const LibertyPort *to) const;
+  // As above, restricted to arc sets with role.
+  const TimingArcSetSeq &timingArcSets(const LibertyPort *from,
+                                       const LibertyPort *to,
+                                       const TimingRole *role) const;
   size_t timingArcSetCount() const;
   // Find a timing arc set equivalent to key.
   TimingArcSet *findTimingArcSet(TimingArcSet *key) const;
@@ -614,6 +654,7 @@ protected:
   TimingArcSetSeq timing_arc_sets_;
   TimingArcSetMap timing_arc_set_map_;
   LibertyPortPairTimingArcMap port_timing_arc_set_map_;
+  LibertyPortPairRoleTimingArcMap port_role_timing_arc_set_map_;
   LibertyPortTimingArcMap timing_arc_set_from_map_;
   LibertyPortTimingArcMap timing_arc_set_to_map_;
   bool has_infered_reg_timing_arcs_;
@@ -25,6 +25,7 @@
 #pragma once
 
 #include <memory>
+#include <tuple>
 
 #include "Vector.hh"
 #include "Map.hh"
@@ -74,6 +75,8 @@ typedef Map<LibertyCell*, LibertyCellSeq*> LibertyCellEquivMap;
 typedef Vector<LibertyPort*> LibertyPortSeq;
 typedef Set<LibertyPort*> LibertyPortSet;
 typedef std::pair<const LibertyPort*,const LibertyPort*> LibertyPortPair;
+typedef std::tuple<const LibertyPort*,const LibertyPort*,
+                   const TimingRole*> LibertyPortPairRole;
 typedef Set<LibertyCell*> LibertyCellSet;
 typedef std::shared_ptr<Table> TablePtr;
 typedef std::shared_ptr<TimingArcAttrs> TimingArcAttrsPtr;
@@ -164,6 +167,13 @@ public:
 		  const LibertyPortPair &pair2) const;
 };
 
+class LibertyPortPairRoleLess
+{
+public:
+  bool operator()(const LibertyPortPairRole &key1,
+		  const LibertyPortPairRole &key2) const;
+};
+
 bool
 timingArcSetLess(const TimingArcSet *set1,
 		 const TimingArcSet *set2);
@@ -73,12 +73,19 @@
 #endif
 
 #include <cstddef>		// size_t
+#include <thread>
 
 namespace sta {
 
 int
 processorCount();
 
+// Pin a thread to a processor so its memory references stay local
+// on NUMA hosts.  No-op on platforms without affinity support.
+void
+pinThreadToProcessor(std::thread &thread,
+		     int processor);
+
 // Init elapsed (wall) time.
 void
 initElapsedTime();
@@ -0,0 +1,81 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2025, Parallax Software, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+//
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// This notice may not be removed or altered from any source distribution.
+
+#pragma once
+
+#include <fstream>
+#include <istream>
+#include <streambuf>
+
+namespace sta {
+
+// Streambuf whose get area is a memory mapped file, so istream reads
+// copy directly out of the page cache instead of going through
+// read/filebuf layers.  The mapping is read only; put back is limited
+// to characters already in the stream.
+class MappedFileStreambuf : public std::streambuf
+{
+public:
+  MappedFileStreambuf();
+  virtual ~MappedFileStreambuf();
+  bool open(const char *filename);
+  void close();
+  bool is_open() const { return data_ != nullptr; }
+
+protected:
+  virtual pos_type seekoff(off_type off,
+                           std::ios_base::seekdir dir,
+                           std::ios_base::openmode mode) override;
+  virtual pos_type seekpos(pos_type pos,
+                           std::ios_base::openmode mode) override;
+
+private:
+  const char *data_;
+  size_t size_;
+#ifndef _WIN32
+  int fd_;
+#endif
+};
+
+// Input stream over a memory mapped file.
+// Used by parsers for uncompressed files in place of gzstream.
+// Files that cannot be mapped (WIN32, fifos, mmap failure) are read
+// through a buffered filebuf instead.
+class MappedFileStream : public std::istream
+{
+public:
+  MappedFileStream(const char *filename);
+  virtual ~MappedFileStream() {}
+  bool is_open() const;
+
+private:
+  MappedFileStreambuf streambuf_;
+  std::filebuf filebuf_;
+};
+
+// True if filename begins with the gzip magic number.
+bool
+isCompressed(const char *filename);
+
+} // namespace
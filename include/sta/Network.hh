@@ -45,6 +45,9 @@ typedef Map<const char*, LibertyLibrary*, CharPtrLess> LibertyLibraryMap;
 typedef std::function<Instance* (const char *top_cell_name,
                                  bool make_black_boxes)> LinkNetworkFunc;
 typedef Map<const Net*, PinSet*> NetDrvrPinsMap;
+typedef std::pair<const Pin*, const Pin*> DrvrLoadPair;
+typedef Vector<DrvrLoadPair> DrvrLoadPairSeq;
+typedef Map<const Pin*, DrvrLoadPairSeq*> HpinDrvrLoadsMap;
 
 // The Network class defines the network API used by sta.
 // The interface to a network implementation is constructed by
@@ -105,6 +108,12 @@ public:
 			   Report *report) = 0;
   virtual bool isLinked() const;
   virtual bool isEditable() const { return false; }
+  // Netlist object count and approximate bytes of storage they own,
+  // for report_memory.  Zero when the network implementation does not
+  // track its allocations.
+  virtual void memoryUsage(// Return values.
+			   size_t &object_count,
+			   size_t &bytes) const;
 
   ////////////////////////////////////////////////////////////////
   // Library functions.
@@ -415,6 +424,9 @@ public:
   // Find driver pins for net.
   // Return value is owned by the network.
   virtual PinSet *drivers(const Net *net);
+  // Driver/load pin pairs connected thru hierarchical pin hpin.
+  // Return value is owned by the network.
+  const DrvrLoadPairSeq *drvrLoadsThruHierPin(const Pin *hpin) const;
   int netCount();
   int netCount(Instance *inst);
 
@@ -488,8 +500,9 @@ protected:
   // findNetsMatching using linear search.
   NetSeq findNetsMatchingLinear(const Instance *instance,
                                 const PatternMatch *pattern) const;
-  // Connect/disconnect net/pins should clear the net->drvrs map.
-  // Incrementally maintaining the map is expensive because 
+  // Connect/disconnect net/pins should clear the net->drvrs map
+  // and the hpin drvr/load map.
+  // Incrementally maintaining the maps is expensive because
   // nets may be connected across hierarchy levels.
   void clearNetDrvrPinMap();
 
@@ -497,6 +510,8 @@ protected:
   char divider_;
   char escape_;
   NetDrvrPinsMap net_drvr_pin_map_;
+  // visitDrvrLoadsThruHierPin traversal cache.
+  mutable HpinDrvrLoadsMap hpin_drvr_loads_map_;
 };
 
 // Network API to support network edits.
@@ -670,6 +685,7 @@ protected:
 };
 
 // Visit driver/loads pins through a hierarcial pin.
+// The traversal is cached by hpin; network edits invalidate the cache.
 void
 visitDrvrLoadsThruHierPin(const Pin *hpin,
 			  const Network *network,
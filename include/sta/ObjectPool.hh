@@ -0,0 +1,132 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2025, Parallax Software, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+//
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// This notice may not be removed or altered from any source distribution.
+
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <utility>
+
+#include "Vector.hh"
+#include "Mutex.hh"
+
+namespace sta {
+
+// Typed slab allocator in the style of ObjectTable, but handing out
+// stable pointers rather than object IDs so existing pointer based
+// APIs do not change.  Objects are allocated in blocks to speed up
+// creation and give iteration locality, and destroyed objects are
+// recycled through a free list threaded thru the object storage.
+// make/destroy are serialized internally so owners can allocate from
+// parallel tasks.
+//
+// TYPE is only required to be complete where make/destroy are called,
+// so pools can be members of classes declared before TYPE.
+
+template <class TYPE>
+class ObjectPool
+{
+public:
+  ObjectPool();
+  ~ObjectPool();
+  template <class... ARGS>
+  TYPE *make(ARGS&&... args);
+  void destroy(TYPE *object);
+  size_t size() const { return size_; }
+  // Bytes of block storage.
+  size_t memoryUsage() const
+  { return blocks_.size() * block_object_count * sizeof(TYPE); }
+
+  // Objects are allocated in blocks of 128, as in ObjectTable.
+  static constexpr size_t block_object_count = 128;
+
+private:
+  void makeBlock();
+
+  size_t size_;
+  // Head of the free list, linked in place thru the object storage.
+  TYPE *free_;
+  Vector<char*> blocks_;
+  std::mutex lock_;
+};
+
+template <class TYPE>
+ObjectPool<TYPE>::ObjectPool() :
+  size_(0),
+  free_(nullptr)
+{
+}
+
+template <class TYPE>
+ObjectPool<TYPE>::~ObjectPool()
+{
+  // Objects must be destroyed before the pool; only the block storage
+  // is released here.
+  for (char *block : blocks_)
+    delete [] block;
+}
+
+template <class TYPE>
+template <class... ARGS>
+TYPE *
+ObjectPool<TYPE>::make(ARGS&&... args)
+{
+  lock_.lock();
+  if (free_ == nullptr)
+    makeBlock();
+  TYPE *object = free_;
+  free_ = *reinterpret_cast<TYPE**>(object);
+  size_++;
+  lock_.unlock();
+  // Construct outside the lock.
+  return new (object) TYPE(std::forward<ARGS>(args)...);
+}
+
+template <class TYPE>
+void
+ObjectPool<TYPE>::destroy(TYPE *object)
+{
+  object->~TYPE();
+  LockGuard lock(lock_);
+  *reinterpret_cast<TYPE**>(object) = free_;
+  free_ = object;
+  size_--;
+}
+
+template <class TYPE>
+void
+ObjectPool<TYPE>::makeBlock()
+{
+  char *block = new char[block_object_count * sizeof(TYPE)];
+  blocks_.push_back(block);
+  // Thread the block objects onto the free list in address order.
+  for (size_t i = block_object_count; i > 0; i--) {
+    TYPE *object = reinterpret_cast<TYPE*>(block + (i - 1) * sizeof(TYPE));
+    *reinterpret_cast<TYPE**>(object) = free_;
+    free_ = object;
+  }
+}
+
+} // namespace
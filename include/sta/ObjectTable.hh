@@ -24,6 +24,13 @@
 
 #pragma once
 
+#include <cstdlib>
+#include <new>
+
+#ifndef _WIN32
+  #include <sys/mman.h>
+#endif
+
 #include "Vector.hh"
 #include "Error.hh"
 #include "ObjectId.hh"
@@ -56,6 +63,14 @@ public:
   TYPE &ref(ObjectId id) const;
   ObjectId objectId(const TYPE *object);
   size_t size() const { return size_; }
+  // One past the largest object ID that can have been allocated.
+  ObjectId idLimit() const { return blocks_.size() * block_object_count; }
+  // Bytes of slab storage, including unused block space.
+  size_t memoryUsage() const
+  { return (blocks_.size() + slab_blocks_left_) * sizeof(TableBlock<TYPE>); }
+  // Preallocate one contiguous slab with room for object_count
+  // objects.  Used by the bulk graph builder when counts are known.
+  void reserve(size_t object_count);
   void clear();
 
   // Objects are allocated in blocks of 128.
@@ -63,8 +78,15 @@ public:
   static constexpr int block_object_count = (1 << idx_bits);
   static constexpr int block_id_max = 1 << (object_id_bits - idx_bits);
 
+  // Blocks are carved from 2MB aligned slabs advised to the kernel as
+  // transparent hugepage candidates, which cuts dTLB misses when the
+  // search loops chase vertices and edges.
+  static constexpr size_t slab_align = 2 * 1024 * 1024;
+
 private:
   void makeBlock();
+  void makeSlab(size_t block_count);
+  void deleteBlocks();
   void freePush(TYPE *object,
 		ObjectId id);
 
@@ -72,20 +94,26 @@ private:
   // Object ID of next free object.
   ObjectId free_;
   Vector<TableBlock<TYPE>*> blocks_;
+  Vector<char*> slabs_;
+  // Unused block space at the end of the last slab.
+  char *slab_next_;
+  size_t slab_blocks_left_;
   static constexpr ObjectId idx_mask_ = block_object_count - 1;
 };
 
 template <class TYPE>
 ObjectTable<TYPE>::ObjectTable() :
   size_(0),
-  free_(object_id_null)
+  free_(object_id_null),
+  slab_next_(nullptr),
+  slab_blocks_left_(0)
 {
 }
 
 template <class TYPE>
 ObjectTable<TYPE>::~ObjectTable()
 {
-  blocks_.deleteContents();
+  deleteBlocks();
 }
 
 template <class TYPE>
@@ -114,12 +142,50 @@ ObjectTable<TYPE>::freePush(TYPE *object,
   free_ = id;
 }
 
+template <class TYPE>
+void
+ObjectTable<TYPE>::makeSlab(size_t block_count)
+{
+  size_t bytes = block_count * sizeof(TableBlock<TYPE>);
+  // Round up to whole hugepages.
+  bytes = (bytes + slab_align - 1) / slab_align * slab_align;
+#ifdef _WIN32
+  char *slab = static_cast<char*>(_aligned_malloc(bytes, slab_align));
+#else
+  char *slab = static_cast<char*>(std::aligned_alloc(slab_align, bytes));
+#endif
+  if (slab == nullptr)
+    criticalError(2350, "object table slab allocation failed.");
+#if defined(MADV_HUGEPAGE)
+  madvise(slab, bytes, MADV_HUGEPAGE);
+#endif
+  slabs_.push_back(slab);
+  slab_next_ = slab;
+  slab_blocks_left_ = bytes / sizeof(TableBlock<TYPE>);
+}
+
+template <class TYPE>
+void
+ObjectTable<TYPE>::reserve(size_t object_count)
+{
+  size_t block_count = (object_count + block_object_count - 1)
+    / block_object_count;
+  size_t have = blocks_.size() + slab_blocks_left_;
+  if (block_count > have)
+    makeSlab(block_count - have);
+}
+
 template <class TYPE>
 void
 ObjectTable<TYPE>::makeBlock()
 {
   BlockIdx block_index = blocks_.size();
-  TableBlock<TYPE> *block = new TableBlock<TYPE>(block_index, this);
+  if (slab_blocks_left_ == 0)
+    makeSlab(slab_align / sizeof(TableBlock<TYPE>) + 1);
+  TableBlock<TYPE> *block = new (slab_next_) TableBlock<TYPE>(block_index,
+							      this);
+  slab_next_ += sizeof(TableBlock<TYPE>);
+  slab_blocks_left_--;
   blocks_.push_back(block);
   if (blocks_.size() >= block_id_max)
     criticalError(224, "max object table block count exceeded.");
@@ -177,11 +243,31 @@ ObjectTable<TYPE>::destroy(TYPE *object)
   freePush(object, object_id);
 }
 
+template <class TYPE>
+void
+ObjectTable<TYPE>::deleteBlocks()
+{
+  for (TableBlock<TYPE> *block : blocks_)
+    block->~TableBlock();
+  blocks_.clear();
+  for (char *slab : slabs_) {
+#ifdef _WIN32
+    _aligned_free(slab);
+#else
+    std::free(slab);
+#endif
+  }
+  slabs_.clear();
+  slab_next_ = nullptr;
+  slab_blocks_left_ = 0;
+}
+
 template <class TYPE>
 void
 ObjectTable<TYPE>::clear()
 {
-  blocks_.deleteContentsClear();
+  deleteBlocks();
+  free_ = object_id_null;
   size_ = 0;
 }
 
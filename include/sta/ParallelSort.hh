@@ -0,0 +1,93 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2025, Parallax Software, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+//
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// This notice may not be removed or altered from any source distribution.
+
+#pragma once
+
+#include <algorithm>
+
+#include "Vector.hh"
+#include "DispatchQueue.hh"
+
+namespace sta {
+
+// Parallel stable merge sort.  One chunk per thread is sorted by the
+// dispatch queue workers and adjacent chunks are merged pairwise in
+// parallel rounds, so the result matches sta::sort (std::stable_sort)
+// exactly.  Falls back to the serial sort for small sequences or when
+// no dispatch queue is available.  Must be called from the main
+// thread; a dispatched task calling finishTasks deadlocks.
+template <class OBJ, class SortCmp>
+void
+sort(Vector<OBJ> &seq,
+     SortCmp cmp,
+     DispatchQueue *dispatch_queue,
+     size_t thread_count)
+{
+  // Below this size the fork/join overhead swamps the win.
+  constexpr size_t parallel_min = 100000;
+  size_t count = seq.size();
+  if (dispatch_queue == nullptr
+      || thread_count < 2
+      || count < parallel_min) {
+    sort(seq, cmp);
+    return;
+  }
+  size_t chunk_count = thread_count;
+  Vector<size_t> bounds(chunk_count + 1);
+  for (size_t i = 0; i <= chunk_count; i++)
+    bounds[i] = count * i / chunk_count;
+  auto begin = seq.begin();
+  for (size_t i = 0; i < chunk_count; i++) {
+    size_t lo = bounds[i];
+    size_t hi = bounds[i + 1];
+    dispatch_queue->dispatch([begin, lo, hi, cmp](int) {
+      std::stable_sort(begin + lo, begin + hi, cmp);
+    });
+  }
+  dispatch_queue->finishTasks();
+  // Merge adjacent sorted chunk pairs until one chunk remains.
+  for (size_t width = 1; width < chunk_count; width *= 2) {
+    for (size_t i = 0; i + width < chunk_count; i += width * 2) {
+      size_t lo = bounds[i];
+      size_t mid = bounds[i + width];
+      size_t hi = bounds[std::min(i + width * 2, chunk_count)];
+      dispatch_queue->dispatch([begin, lo, mid, hi, cmp](int) {
+	std::inplace_merge(begin + lo, begin + mid, begin + hi, cmp);
+      });
+    }
+    dispatch_queue->finishTasks();
+  }
+}
+
+template <class OBJ, class SortCmp>
+void
+sort(Vector<OBJ> *seq,
+     SortCmp cmp,
+     DispatchQueue *dispatch_queue,
+     size_t thread_count)
+{
+  sort(*seq, cmp, dispatch_queue, thread_count);
+}
+
+} // namespace
@@ -47,6 +47,22 @@ typedef std::vector<ParasiticCapacitor*> ParasiticCapacitorSeq;
 typedef std::map<ParasiticNode *, ParasiticResistorSeq> ParasiticNodeResistorMap;
 typedef std::map<ParasiticNode *, ParasiticCapacitorSeq> ParasiticNodeCapacitorMap;
 
+// Demand loader for parasitic networks, installed by the lazy spef
+// cache (see SpefCache.hh).  findParasiticNetwork faults missing nets
+// in through the loader and reports hits so the loader can keep
+// resident nets ordered by recency.
+class ParasiticNetworkLoader
+{
+public:
+  virtual ~ParasiticNetworkLoader() {}
+  // Build the parasitic network for net, or return nullptr if the
+  // loader does not know the net or the analysis point.
+  virtual Parasitic *loadParasiticNetwork(const Net *net,
+                                          const ParasiticAnalysisPt *ap) = 0;
+  // Note a find hit on a resident net.
+  virtual void used(const Net *net) = 0;
+};
+
 // Parasitics API.
 // All parasitic parameters can have multiple values, each corresponding
 // to an analysis point.
@@ -60,6 +76,12 @@ public:
   virtual bool haveParasitics() = 0;
   // Clear all state.
   virtual void clear() = 0;
+  // Parasitic object count and approximate bytes of storage they own,
+  // for report_memory.  Zero when the implementation does not track
+  // its allocations.
+  virtual void memoryUsage(// Return values.
+			   size_t &object_count,
+			   size_t &bytes) const;
 
   // Delete all parasitics.
   virtual void deleteParasitics() = 0;
@@ -161,6 +183,12 @@ public:
   virtual Parasitic *makeParasiticNetwork(const Net *net,
 					  bool includes_pin_caps,
 					  const ParasiticAnalysisPt *ap) = 0;
+  // Install a loader that faults parasitic networks in on demand.
+  // The parasitics take ownership of the loader.
+  virtual void setNetworkLoader(ParasiticNetworkLoader *loader) = 0;
+  // Reduce all annotated parasitic networks for delay calculation,
+  // in parallel on the dispatch queue threads.
+  virtual void reduceParasitics() = 0;
   virtual ParasiticNodeSeq nodes(const Parasitic *parasitic) const = 0;
   virtual void report(const Parasitic *parasitic) const;
   virtual const Net *net(const Parasitic *parasitic) const = 0;
@@ -64,6 +64,8 @@ public:
 		  Edge *&d_q_edge) const;
 
 protected:
+  void expand1(const Path *path,
+	       bool expand_genclks);
   void expandGenclk(const Path *clk_path);
   // Convert external index that starts at the path root
   // and increases to an index for paths_ (reversed).
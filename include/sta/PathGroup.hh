@@ -24,6 +24,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <mutex>
 
 #include "Map.hh"
@@ -69,8 +70,13 @@ public:
   const MinMax *minMax() const { return min_max_;}
   const PathEndSeq &pathEnds() const { return path_ends_; }
   void insert(PathEnd *path_end);
+  // Merge a thread-private collection of ends with one lock
+  // acquisition and clear it.
+  void insertEnds(PathEndSeq &path_ends);
   // Push group_path_count into path_ends.
   void pushEnds(PathEndSeq &path_ends);
+  // Group path ends pruned and sorted for reporting.
+  const PathEndSeq &sortedPathEnds();
   // Predicate to determine if a PathEnd is worth saving.
   bool saveable(PathEnd *path_end);
   bool enumMinSlackUnderMin(PathEnd *path_end);
@@ -92,8 +98,11 @@ protected:
 	    const MinMax *min_max,
 	    const StaState *sta);
   void ensureSortedMaxPaths();
-  void prune();
-  void sort();
+  // Sorting in parallel uses the dispatch queue workers, so it is
+  // only safe from the main thread; inserts prune on worker threads
+  // and must stay serial.
+  void prune(bool parallel = false);
+  void sort(bool parallel = false);
 
   const char *name_;
   size_t group_path_count_;
@@ -105,7 +114,9 @@ protected:
   PathEndSeq path_ends_;
   const MinMax *min_max_;
   bool compare_slack_;
-  float threshold_;
+  // Read without the lock by saveable; a stale threshold only lets
+  // extra ends through to the final prune.
+  std::atomic<float> threshold_;
   std::mutex lock_;
   const StaState *sta_;
 };
@@ -136,6 +147,16 @@ public:
                           const Corner *corner,
                           const MinMaxAll *min_max,
                           bool sort_by_slack);
+  // Streaming variant of makePathEnds: hand the path ends to consumer
+  // incrementally (globally ordered when sort_by_slack) instead of
+  // gathering them into one sequence.  The path ends are owned by the
+  // PathGroups and only valid during the visit.
+  void visitPathEnds(ExceptionTo *to,
+                     bool unconstrained_paths,
+                     const Corner *corner,
+                     const MinMaxAll *min_max,
+                     bool sort_by_slack,
+                     PathEndConsumer *consumer);
   PathGroup *findPathGroup(const char *name,
 			   const MinMax *min_max) const;
   PathGroup *findPathGroup(const Clock *clock,
@@ -169,11 +190,15 @@ protected:
 		    int endpoint_path_count,
 		    bool unique_pins,
 		    bool unique_edges,
-		    bool cmp_slack);
+		    bool cmp_slack,
+		    bool parallel_enum);
 
   void pushGroupPathEnds(PathEndSeq &path_ends);
   void pushUnconstrainedPathEnds(PathEndSeq &path_ends,
 				 const MinMaxAll *min_max);
+  // Groups in report order.
+  PathGroupSeq reportOrderGroups() const;
+  PathGroupSeq unconstrainedGroups(const MinMaxAll *min_max) const;
 
   void makeGroups(int group_path_count,
 		  int endpoint_path_count,
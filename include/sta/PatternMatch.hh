@@ -24,7 +24,9 @@
 
 #pragma once
 
+#include <cstdint>
 #include <string>
+#include <vector>
 
 #include "Error.hh"
 
@@ -57,7 +59,15 @@ public:
 	       const PatternMatch *inherit_from);
   bool match(const char *str) const;
   bool match(const std::string &str) const;
+  // Batch match over an array of interned names; matching names are
+  // appended to matches.
+  void match(const std::vector<const char*> &strs,
+	     std::vector<const char*> &matches) const;
   bool matchNoCase(const char *str) const;
+  // True if a hierarchical name that begins with prefix followed by
+  // the divider can match the pattern.  Always true for regexps.
+  bool matchHierPrefix(const char *prefix,
+		       char divider) const;
   const char *pattern() const { return pattern_; }
   bool isRegexp() const { return is_regexp_; }
   bool nocase() const { return nocase_; }
@@ -66,12 +76,27 @@ public:
 
 private:
   void compileRegexp();
+  void compileGlob();
+  bool matchCompiled(const char *str,
+		     bool nocase) const;
+  bool prefixMatch(const char *str) const;
 
   const char *pattern_;
   bool is_regexp_;
   bool nocase_;
   Tcl_Interp *interp_;
   Tcl_RegExp regexp_;
+  // Glob pattern compiled to the literal segments ('?' allowed)
+  // separated by '*' runs, so matching scans the string left to
+  // right instead of backtracking recursively.
+  std::vector<std::string> segs_;
+  bool anchor_begin_;
+  bool anchor_end_;
+  // Leading literal pattern bytes packed into a word so collection
+  // scans reject most candidates with one compare before running the
+  // segment matcher.  Zero length when the pattern has no usable prefix.
+  uint64_t prefix_value_;
+  size_t prefix_length_;
 };
 
 // Error thrown by Pattern constructor.
@@ -0,0 +1,62 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2025, Parallax Software, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+//
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// This notice may not be removed or altered from any source distribution.
+
+#pragma once
+
+#include <cstddef>  // size_t
+
+namespace sta {
+
+class Report;
+class ProfileNode;
+
+// Always-on hierarchical phase profiler.
+// ProfilePhase scopes nest on the command thread around the major
+// analysis phases and accumulate elapsed/cpu time and memory growth
+// into a tree keyed by phase name; report_profile prints the tree.
+// Each scope costs a few timing system calls, so phases wrap work
+// measured in milliseconds, not inner loops.
+class ProfilePhase
+{
+public:
+  explicit ProfilePhase(const char *name);
+  ~ProfilePhase();
+
+private:
+  ProfileNode *node_;
+  double elapsed_begin_;
+  double user_begin_;
+  size_t memory_begin_;
+};
+
+// Report the profile tree with a line per phase showing call count,
+// elapsed/cpu time and memory growth.
+void
+reportProfile(Report *report);
+
+// Discard the accumulated profile.
+void
+clearProfile();
+
+} // namespace
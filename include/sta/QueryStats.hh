@@ -0,0 +1,56 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2025, Parallax Software, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+//
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// This notice may not be removed or altered from any source distribution.
+
+#pragma once
+
+namespace sta {
+
+class Report;
+
+// Counters on the hot search/dcalc entry points, attributed to the
+// command that triggered the work so per-query cost questions can be
+// answered without a profiler run.
+
+enum class QueryCounter { delay_calc, arrival_visit, required_visit };
+
+// Called from worker threads; one relaxed atomic increment.
+void
+incrQueryCounter(QueryCounter counter);
+
+// Attribute counter deltas to cmd until endQueryStats.  An open
+// query is closed first, so an error that skips endQueryStats does
+// not poison later attributions.
+void
+beginQueryStats(const char *cmd);
+void
+endQueryStats();
+
+// Report a line per command with its call count and counter totals.
+void
+reportQueryStats(Report *report);
+
+void
+clearQueryStats();
+
+} // namespace
@@ -36,6 +36,8 @@ struct Tcl_Interp;
 
 namespace sta {
 
+class ZstdCompress;
+
 // Output streams used for printing.
 // This is a wrapper for all printing.  It supports logging output to
 // a file and redirection of command output to a file.
@@ -110,6 +112,7 @@ public:
   virtual void logEnd();
 
   // Redirect output to filename until redirectFileEnd is called.
+  // A .gz filename writes a gzip compressed file.
   virtual void redirectFileBegin(const char *filename);
   // Redirect append output to filename until redirectFileEnd is called.
   virtual void redirectFileAppendBegin(const char *filename);
@@ -152,9 +155,16 @@ protected:
   void printBufferLine();
   void redirectStringPrint(const char *buffer,
                            size_t length);
+  void setRedirectBuffer();
 
   FILE *log_stream_;
   FILE *redirect_stream_;
+  // gzFile, opaque to keep Zlib.hh out of the public headers.
+  void *redirect_gz_stream_;
+  ZstdCompress *redirect_zstd_stream_;
+  // Large stdio buffer for the redirect stream so bulk reports spend
+  // their time formatting instead of in per-line write calls.
+  char *redirect_buffer_;
   bool redirect_to_string_;
   std::string redirect_string_;
   // Buffer to support printf style arguments.
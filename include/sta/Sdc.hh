@@ -24,7 +24,9 @@
 
 #pragma once
 
+#include <cstdint>
 #include <mutex>
+#include <vector>
 
 #include "StringUtil.hh"
 #include "StringSet.hh"
@@ -876,6 +878,8 @@ public:
   // Gated clock active (non-controlling) logic value.
   LogicValue clockGatingActiveValue(const Pin *clk_pin,
 				    const Pin *enable_pin);
+  // Precompute the cycle accounting for all clock edge pairs.
+  void ensureCycleAcctings();
   // Find the cycle accounting info for paths that start at src clock
   // edge and end at target clock edge.
   CycleAccting *cycleAccting(const ClockEdge *src,
@@ -1025,6 +1029,10 @@ public:
   void unrecordException(ExceptionPath *exception);
   void annotateGraph();
   void removeGraphAnnotations();
+  // Incrementally annotate a new disable without re-running the full
+  // annotation sweep when the graph annotations are up to date.
+  void annotateGraphDisabled(const Pin *pin);
+  void annotateGraphDisabled(const Instance *inst);
 
   // Network edit before/after methods.
   void deletePinBefore(const Pin *pin);
@@ -1203,6 +1211,8 @@ protected:
   void deleteOutputDelay(OutputDelay *output_delay);
   void deleteClockInsertion(ClockInsertion *insertion);
   void deleteClockInsertionsReferencing(Clock *clk);
+  void makeClkInsertionIndex();
+  void clearClkInsertionIndex();
   void deleteInterClockUncertainty(InterClockUncertainty *uncertainties);
   void deleteInterClockUncertaintiesReferencing(Clock *clk);
   void deleteLatchBorrowLimitsReferencing(Clock *clk);
@@ -1212,7 +1222,8 @@ protected:
   LibertyLibrary *defaultLibertyLibrary();
   void annotateGraphConstrainOutputs();
   void annotateDisables();
-  void annotateGraphDisabled(const Pin *pin);
+  void annotateDisabledLibPort(Vertex *vertex);
+  void removeVertexAnnotations(Vertex *vertex);
   void setEdgeDisabledInstPorts(DisabledInstancePorts *disabled_inst);
   void setEdgeDisabledInstFrom(Pin *from_pin,
 			       bool disable_checks);
@@ -1220,7 +1231,10 @@ protected:
 				Instance *inst);
   void deleteClockLatenciesReferencing(Clock *clk);
   void deleteClockLatency(ClockLatency *latency);
+  void makeClkLatencyIndex();
+  void clearClkLatencyIndex();
   void deleteDeratingFactors();
+  void makeDerateFlatTable();
   void annotateGraphOutputDelays();
   void annotateGraphDataChecks();
   void annotateGraphConstrained(const PinSet *pins);
@@ -1255,6 +1269,11 @@ protected:
   void makeClkGroupExclusions1(ClockGroupSet *groups);
   void makeClkGroupExclusions(ClockGroupSet *groups);
   void makeClkGroupSame(ClockGroup *group);
+  void makeClkGroupMatrices();
+  static bool clkPairBit(const std::vector<uint64_t> &bits,
+			 size_t stride,
+			 const Clock *clk1,
+			 const Clock *clk2);
   void clearClkGroupExclusions();
   char *makeClockGroupsName();
   void setClockSense(const Pin *pin,
@@ -1275,6 +1294,12 @@ protected:
   MinMaxFloatValues voltages_;
   NetVoltageMap net_voltage_map_;
   DeratingFactorsGlobal *derating_factors_;
+  // Global derates resolved against the 1.0 default, refreshed when
+  // set_timing_derate changes; per arc lookups that find no net,
+  // instance or cell specific derate read one table entry instead of
+  // probing exists flags.
+  float derate_flat_[timing_derate_type_count][path_clk_or_data_count]
+    [RiseFall::index_count][EarlyLate::index_count];
   NetDeratingFactorsMap net_derating_factors_;
   InstDeratingFactorsMap inst_derating_factors_;
   CellDeratingFactorsMap cell_derating_factors_;
@@ -1294,7 +1319,21 @@ protected:
   bool clk_hpin_disables_valid_;
   PinSet propagated_clk_pins_;
   ClockLatencies clk_latencies_;
+  // clk_latencies_ flattened into dense arrays indexed by clock index,
+  // rebuilt when a latency changes; clockLatency is called for every
+  // clock vertex while seeding arrivals, so the lookup is one pin map
+  // find and an array index instead of two set searches.
+  Map<const Pin*, ClockLatency**> clk_latency_pin_index_;
+  std::vector<ClockLatency*> clk_latency_clk_index_;
+  // Pin index array length; slot 0 is the wildcard (null clock) entry.
+  size_t clk_latency_index_stride_;
   ClockInsertions clk_insertions_;
+  // clk_insertions_ flattened the same way as clk_latencies_ above;
+  // clockInsertion is in the slack arithmetic of every path end with a
+  // propagated source clock.
+  Map<const Pin*, ClockInsertion**> clk_insertion_pin_index_;
+  std::vector<ClockInsertion*> clk_insertion_clk_index_;
+  size_t clk_insertion_index_stride_;
   PinClockUncertaintyMap pin_clk_uncertainty_map_;
   InterClockUncertaintySet inter_clk_uncertainties_;
   // clk_groups name -> clk_groups
@@ -1303,6 +1342,13 @@ protected:
   ClockPairSet clk_group_exclusions_;
   // clks in the same set_clock_group set.
   ClockPairSet clk_group_same_;
+  // The pair sets flattened into bit matrices indexed by clock index,
+  // rebuilt by ensureClkGroupExclusions; sameClockGroup is called in
+  // the search inner loops so the pair test is two loads and a mask.
+  std::vector<uint64_t> clk_group_exclusion_bits_;
+  std::vector<uint64_t> clk_group_same_bits_;
+  // 64 bit words per bit matrix row.
+  size_t clk_group_matrix_stride_;
   ClockSenseMap clk_sense_map_;
   ClockGatingCheck *clk_gating_check_;
   ClockGatingCheckMap clk_gating_check_map_;
@@ -1312,6 +1358,11 @@ protected:
   std::mutex cycle_acctings_lock_;
   DataChecksMap data_checks_from_map_;
   DataChecksMap data_checks_to_map_;
+  // Pins with data checks, one bit per pin id; dataChecksFrom/To skip
+  // the map lookup for the usual pin with none.  Bits left stale by
+  // removals are harmless; they just cost the lookup.
+  std::vector<uint64_t> data_check_from_pin_bits_;
+  std::vector<uint64_t> data_check_to_pin_bits_;
 
   InputDelaySet input_delays_;
   InputDelaysPinMap input_delay_pin_map_;
@@ -1410,6 +1461,7 @@ protected:
 
 private:
   friend class WriteSdc;
+  friend class SdcSnapshotWriter;
   friend class FindNetCaps;
   friend class GroupPathIterator;
 };
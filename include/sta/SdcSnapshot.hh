@@ -0,0 +1,57 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2025, Parallax Software, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+//
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// This notice may not be removed or altered from any source distribution.
+
+#pragma once
+
+namespace sta {
+
+class StaState;
+
+// Versioned binary image of the resolved sdc constraints.
+//
+// The snapshot records clocks (including generated clock definitions,
+// propagation, slews and uncertainties), input/output delays, timing
+// exceptions (false paths, multicycle paths, path delays and group
+// paths) and global timing derates after all Tcl evaluation and object
+// lookup has been done, so restoring skips re-sourcing the sdc file.
+// Design objects are referenced by hierarchical name and resolved
+// against the linked network as they are read.  Loop and filter
+// exceptions are session artifacts and are not written.
+
+// Write a snapshot of the current sdc constraints.
+// Returns false if no network is linked or the file cannot be written.
+bool
+writeSdcSnapshot(const char *filename,
+                 StaState *sta);
+
+// Restore constraints from a snapshot file into the current sdc.
+// Returns false if the file is missing, corrupt, written by a
+// different format version, or references design objects that do not
+// exist in the linked network.  Constraints read before a failure
+// remain in effect.
+bool
+readSdcSnapshot(const char *filename,
+                StaState *sta);
+
+} // namespace
@@ -25,7 +25,9 @@
 #pragma once
 
 #include <mutex>
+#include <shared_mutex>
 #include <atomic>
+#include <vector>
 
 #include "MinMax.hh"
 #include "UnorderedSet.hh"
@@ -40,6 +42,7 @@
 #include "SearchPred.hh"
 #include "VertexVisitor.hh"
 #include "Path.hh"
+#include "TnsTree.hh"
 
 namespace sta {
 
@@ -49,6 +52,7 @@ class SearchPred;
 class SearchThru;
 class ClkInfoLess;
 class PathEndVisitor;
+class PathEndConsumer;
 class ArrivalVisitor;
 class RequiredVisitor;
 class ClkPathIterator;
@@ -67,10 +71,25 @@ class Corner;
 typedef Set<const ClkInfo*, ClkInfoLess> ClkInfoSet;
 typedef UnorderedSet<Tag*, TagHash, TagEqual> TagSet;
 typedef UnorderedSet<TagGroup*, TagGroupHash, TagGroupEqual> TagGroupSet;
-typedef Map<Vertex*, Slack> VertexSlackMap;
-typedef Vector<VertexSlackMap> VertexSlackMapSeq;
+
+// Hash-consed exception state sets.  Equal sets share one canonical
+// set so tag state comparison is usually a pointer compare.
+class ExceptionStateSetHash
+{
+public:
+  size_t operator()(const ExceptionStateSet *states) const;
+};
+
+class ExceptionStateSetEqual
+{
+public:
+  bool operator()(const ExceptionStateSet *states1,
+                  const ExceptionStateSet *states2) const;
+};
+
+typedef UnorderedSet<ExceptionStateSet*, ExceptionStateSetHash,
+                     ExceptionStateSetEqual> ExceptionStateSetSet;
 typedef Vector<WorstSlacks> WorstSlacksSeq;
-typedef std::vector<DelayDbl> DelayDblSeq;
 typedef Vector<ExceptionPath*> ExceptionPathSeq;
 typedef std::vector<PathGroup*> PathGroupSeq;
 
@@ -116,9 +135,41 @@ public:
                           bool removal,
                           bool clk_gating_setup,
                           bool clk_gating_hold);
+  // Streaming variant of findPathEnds: the path ends are handed to
+  // consumer in report order instead of being gathered into one
+  // sequence, bounding reporting memory.  The ends are owned by the
+  // Search PathGroups and only valid during the visit.
+  void visitPathEnds(ExceptionFrom *from,
+                     ExceptionThruSeq *thrus,
+                     ExceptionTo *to,
+                     bool unconstrained,
+                     const Corner *corner,
+                     const MinMaxAll *min_max,
+                     size_t group_path_count,
+                     size_t endpoint_path_count,
+                     bool unique_pins,
+                     bool unique_edges,
+                     float slack_min,
+                     float slack_max,
+                     bool sort_by_slack,
+                     PathGroupNameSet *group_names,
+                     bool setup,
+                     bool hold,
+                     bool recovery,
+                     bool removal,
+                     bool clk_gating_setup,
+                     bool clk_gating_hold,
+                     PathEndConsumer *consumer);
   bool arrivalsValid();
   // Invalidate all arrival and required times.
   void arrivalsInvalid();
+  // Invalidate the data path arrivals while keeping the solved clock
+  // tree paths as read-only seeds for the next search.  The clock
+  // tree is a large fraction of the graph and its arrivals are
+  // untouched by data path edits, so a full update can skip
+  // re-propagating it.  Falls back to arrivalsInvalid when the clock
+  // arrivals are not valid or a filter is active.
+  void dataArrivalsInvalid();
   // Invalidate vertex arrival time.
   void arrivalInvalid(Vertex *vertex);
   void arrivalInvalid(const Pin *pin);
@@ -128,6 +179,24 @@ public:
   void requiredInvalid(Vertex *vertex);
   void requiredInvalid(const Instance *inst);
   void requiredInvalid(const Pin *pin);
+  // Journal vertex path mutations between beginPathJournal and
+  // rollbackPathJournal so a what-if probe can restore the pre-probe
+  // arrivals and requireds without re-solving the affected cone.
+  // Probes do not nest.
+  void beginPathJournal();
+  void rollbackPathJournal();
+  bool pathJournalActive() const { return path_journal_active_; }
+  // Monotonic counter advanced whenever vertex paths are deleted or
+  // overwritten in place.  Tags cached path expansions so a recycled
+  // Path address cannot hit a stale PathExpanded memo entry.
+  size_t pathGeneration() const { return path_generation_; }
+  void incrPathGeneration() { path_generation_++; }
+  // Called by required propagation before overwriting vertex
+  // required times in place.
+  void journalPathsCopy(Vertex *vertex);
+  // Pending invalidation from the probe edits is moot after the
+  // journals are rolled back.
+  void arrivalsRestored();
   // Vertex will be deleted.
   void deleteVertexBefore(Vertex *vertex);
   void deleteEdgeBefore(Edge *edge);
@@ -137,6 +206,13 @@ public:
   void findArrivals();
   // Find arrival times up thru level.
   void findArrivals(Level level);
+  // Progress and cancellation for an arrival search running on a
+  // background thread (see Sta::updateTimingBackground).  The
+  // counters are updated and the cancel flag is checked at BFS
+  // level boundaries.
+  Level arrivalLevel() const;
+  int arrivalVisitCount() const;
+  void cancelArrivals();
   void findRequireds();
   // Find required times down thru level.
   void findRequireds(Level level);
@@ -158,6 +234,25 @@ public:
 		  // Return values.
 		  Slack &worst_slack,
 		  Vertex *&worst_vertex);
+  // The count endpoints with the worst slacks, worst first.
+  // Incrementally updated.
+  VertexSeq worstSlacks(const Corner *corner,
+			const MinMax *min_max,
+			size_t count);
+  // Endpoint slack counts in bin_count equal width bins between the
+  // worst and best constrained endpoint slack.  Corner nullptr bins
+  // the worst slack across all corners.  Empty when there are no
+  // constrained endpoints.
+  std::vector<size_t> endpointSlackHistogram(const Corner *corner,
+					     const MinMax *min_max,
+					     size_t bin_count,
+					     // Return values.
+					     Slack &slack_min,
+					     Slack &slack_max);
+  // Endpoint slack index used to pre-filter slack-limited reports,
+  // brought up to date (making it if necessary).  Null when filtered
+  // or cone-limited arrivals make the index unusable.
+  WorstSlacks *endpointSlackIndex();
   // Clock arrival respecting ideal clock insertion delay and latency.
   Arrival clkPathArrival(const Path *clk_path) const;
   Arrival clkPathArrival(const Path *clk_path,
@@ -228,12 +323,17 @@ public:
   void findClkArrivals();
   void seedArrival(Vertex *vertex);
   EvalPred *evalPred() const { return eval_pred_; }
-  SearchPred *searchAdj() const { return search_adj_; }
+  SearchPred *searchAdj() const;
   Tag *tag(TagIndex index) const;
   TagIndex tagCount() const;
   TagGroupIndex tagGroupCount() const;
   void reportTagGroups() const;
   void reportPathCountHistogram() const;
+  // Tag/tag group count and approximate bytes of storage they own,
+  // for report_memory.  Path storage is owned by the graph.
+  void memoryUsage(// Return values.
+		   size_t &object_count,
+		   size_t &bytes) const;
   virtual int clkInfoCount() const;
   virtual bool isEndpoint(Vertex *vertex) const;
   virtual bool isEndpoint(Vertex *vertex,
@@ -388,6 +488,9 @@ public:
                             bool unconstrained,
                             bool thru_latches);
   VertexSeq filteredEndpoints();
+  // True if arrival propagation may enter vertex; always true unless
+  // a targeted query restricted the search to an endpoint fan-in cone.
+  bool inArrivalCone(const Vertex *vertex) const;
 
   Arrival *arrivals(const Vertex *vertex) const;
   Arrival *makeArrivals(const Vertex *vertex,
@@ -548,6 +651,11 @@ protected:
   void clearPendingLatchOutputs();
   void enqueuePendingLatchOutputs();
   void findFilteredArrivals(bool thru_latches);
+  void findArrivalCone(ExceptionTo *to);
+  bool coneEndpoints(ExceptionTo *to,
+                     VertexSeq &endpoints);
+  void markArrivalCone(const VertexSeq &endpoints);
+  void clearArrivalCone();
   void findArrivalsSeed();
   void seedFilterStarts();
   bool hasEnabledChecks(Vertex *vertex) const;
@@ -559,10 +667,14 @@ protected:
   void deletePaths();
   // Delete with incremental tns/wns update.
   void deletePathsIncr(Vertex *vertex);
+  void journalPathsReplace(Vertex *vertex);
   TagGroup *findTagGroup(TagGroupBldr *group_bldr);
+  ExceptionStateSet *internStates(ExceptionStateSet *states,
+                                  bool own_states);
   void deleteFilterTags();
   void deleteFilterTagGroups();
   void deleteFilterClkInfos();
+  void deleteFilterStateSets();
 
   void tnsPreamble();
   void findTotalNegativeSlacks();
@@ -571,6 +683,9 @@ protected:
   void wnsSlacks(Vertex *vertex,
 		 // Return values.
 		 SlackSeq &slacks);
+  void wnsSlacks(const VertexSeq &vertices,
+		 // Return values.
+		 std::vector<SlackSeq> &slacks);
   void wnsTnsPreamble();
   void worstSlackPreamble();
   void deleteWorstSlacks();
@@ -602,7 +717,7 @@ protected:
   bool crpr_path_pruning_enabled_;
   bool crpr_approx_missing_requireds_;
   // Search predicates.
-  SearchPred *search_adj_;
+  SearchThru *search_adj_;
   SearchPred *search_clk_;
   EvalPred *eval_pred_;
   ArrivalVisitor *arrival_visitor_;
@@ -628,10 +743,9 @@ protected:
   bool tns_exists_;
   // Endpoint vertices with slacks that have changed since tns was found.
   VertexSet *invalid_tns_;
-  // Indexed by path_ap->index().
-  DelayDblSeq tns_;
-  // Indexed by path_ap->index().
-  VertexSlackMapSeq tns_slacks_;
+  // Incremental tns accumulators, one sum tree per path analysis pt,
+  // indexed by path_ap->index().
+  std::vector<TnsTree> tns_;
   std::mutex tns_lock_;
   // Indexed by path_ap->index().
   WorstSlacks *worst_slacks_;
@@ -640,6 +754,8 @@ protected:
   std::mutex clk_info_lock_;
   // Use pointer to tag set so Tag.hh does not need to be included.
   TagSet *tag_set_;
+  // Canonical exception state sets shared by tags; guarded by tag_lock_.
+  ExceptionStateSetSet *state_set_set_;
   // Entries in tags_ may be missing where previous filter tags were deleted.
   TagIndex tag_capacity_;
   std::atomic<Tag **> tags_;
@@ -647,7 +763,9 @@ protected:
   TagIndex tag_next_;
   // Holes in tags_ left by deleting filter tags.
   std::vector<TagIndex> tag_free_indices_;
-  std::mutex tag_lock_;
+  // Read/write interning lock; arrival threads probe under shared
+  // locks and only serialize to intern a new tag.
+  std::shared_mutex tag_lock_;
   TagGroupSet *tag_group_set_;
   std::atomic<TagGroup **> tag_groups_;
   std::vector<TagGroup **> tag_groups_prev_;
@@ -656,7 +774,7 @@ protected:
   std::vector<TagIndex> tag_group_free_indices_;
   // Capacity of tag_groups_.
   TagGroupIndex tag_group_capacity_;
-  std::mutex tag_group_lock_;
+  std::shared_mutex tag_group_lock_;
   // Latches data outputs to queue on the next search pass.
   VertexSet *pending_latch_outputs_;
   std::mutex pending_latch_outputs_lock_;
@@ -671,8 +789,31 @@ protected:
   ExceptionTo *filter_to_;
   VertexSet *filtered_arrivals_;
   std::mutex filtered_arrivals_lock_;
+  // Fan-in cone of a targeted -to query indexed by vertex id; while
+  // active, arrival propagation is restricted to the cone.
+  bool arrival_cone_active_;
+  std::vector<bool> arrival_cone_;
   bool found_downstream_clk_pins_;
   bool postpone_latch_outputs_;
+  // True while an arrival search that propagates thru latches is
+  // running; allows latch outputs above the data input level to be
+  // enqueued into the current pass instead of the next one.
+  bool enqueue_latch_outputs_inline_;
+  // What-if probe journal of vertex path array mutations.  An in
+  // place overwrite records a copy of the array contents
+  // (path_count non-zero); a replacement records the displaced array
+  // and tag group, which are kept alive until rollback.
+  struct PathJournalEntry
+  {
+    Vertex *vertex;
+    Path *paths;
+    TagGroupIndex tag_group_index;
+    uint32_t path_count;
+  };
+  bool path_journal_active_;
+  std::atomic<size_t> path_generation_;
+  std::vector<PathJournalEntry> path_journal_;
+  std::mutex path_journal_lock_;
   PathGroups *path_groups_;
   VisitPathEnds *visit_path_ends_;
   std::vector<Path*> enum_paths_;
@@ -699,7 +840,7 @@ protected:
   bool search_thru_latches_;
 };
 
-class ClkArrivalSearchPred : public EvalPred
+class ClkArrivalSearchPred final : public EvalPred
 {
 public:
   ClkArrivalSearchPred(const StaState *sta);
@@ -817,7 +958,7 @@ protected:
   bool always_save_prev_paths_;
   TagGroupBldr *tag_bldr_;
   TagGroupBldr *tag_bldr_no_crpr_;
-  SearchPred *adj_pred_;
+  SearchThru *adj_pred_;
   bool crpr_active_;
   bool has_fanin_one_;
 };
@@ -66,6 +66,17 @@ class SearchPred;
 class BfsFwdIterator;
 class ClkDelays;
 
+// Consumer for streamed path ends.  Search::visitPathEnds hands path
+// ends to the consumer in report order as each group is sorted, so
+// reporting overlaps enumeration without gathering the ends into one
+// sequence.
+class PathEndConsumer
+{
+public:
+  virtual ~PathEndConsumer() {}
+  virtual void visit(PathEnd *path_end) = 0;
+};
+
 // Tag compare using tag matching (tagMatch) critera.
 class TagMatchLess
 {
@@ -128,7 +139,8 @@ enum class ReportPathFormat { full,
 			      endpoint,
 			      summary,
 			      slack_only,
-			      json
+			      json,
+			      json_stream
 };
 
 static const TagIndex tag_index_bit_count = 28;
@@ -113,7 +113,7 @@ public:
 
 // SearchPred2 unless
 //  register/latch CLK->Q edges.
-class SearchPredNonReg2 : public SearchPred2
+class SearchPredNonReg2 final : public SearchPred2
 {
 public:
   explicit SearchPredNonReg2(const StaState *sta);
@@ -0,0 +1,154 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2025, Parallax Software, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+//
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// This notice may not be removed or altered from any source distribution.
+
+#pragma once
+
+#include "Mutex.hh"
+#include "UnorderedMap.hh"
+
+namespace sta {
+
+// Hash map sharded across independently locked sub-maps so threads
+// working on different keys rarely contend for the same lock.
+// Each operation locks only the shard its key hashes to.
+//
+// Values returned by findKey/findOrInsert are accessed outside the
+// shard lock, so callers must ensure a value is not mutated by one
+// thread while another uses it.  Passes that partition work by key
+// (delay calculation visits each driver pin from one thread) satisfy
+// this naturally.
+template <class KEY, class VALUE, class HASH = std::hash<KEY>>
+class ShardedMap
+{
+public:
+  ShardedMap() {}
+
+  bool
+  empty() const
+  {
+    for (const Shard &shard : shards_) {
+      LockGuard lock(shard.lock_);
+      if (!shard.map_.empty())
+	return false;
+    }
+    return true;
+  }
+
+  bool
+  hasKey(const KEY key) const
+  {
+    const Shard &shard = findShard(key);
+    LockGuard lock(shard.lock_);
+    return shard.map_.hasKey(key);
+  }
+
+  VALUE
+  findKey(const KEY key) const
+  {
+    const Shard &shard = findShard(key);
+    LockGuard lock(shard.lock_);
+    return shard.map_.findKey(key);
+  }
+
+  void
+  insert(const KEY &key,
+	 VALUE value)
+  {
+    Shard &shard = findShard(key);
+    LockGuard lock(shard.lock_);
+    shard.map_[key] = value;
+  }
+
+  // Return the value for key, calling make_value() to make one if it
+  // is missing.  The shard lock is held across the find and insert so
+  // concurrent callers cannot both make a value for the same key.
+  template <class MAKE>
+  VALUE
+  findOrInsert(const KEY &key,
+	       MAKE make_value)
+  {
+    Shard &shard = findShard(key);
+    LockGuard lock(shard.lock_);
+    VALUE value = shard.map_.findKey(key);
+    if (value == nullptr) {
+      value = make_value();
+      shard.map_[key] = value;
+    }
+    return value;
+  }
+
+  void
+  erase(const KEY &key)
+  {
+    Shard &shard = findShard(key);
+    LockGuard lock(shard.lock_);
+    shard.map_.erase(key);
+  }
+
+  void
+  clear()
+  {
+    for (Shard &shard : shards_) {
+      LockGuard lock(shard.lock_);
+      shard.map_.clear();
+    }
+  }
+
+  // Visit func(key, value) for every entry.  The shard lock is held
+  // during the visit, so func must not call back into the map.
+  template <class FUNC>
+  void
+  forEach(FUNC func) const
+  {
+    for (const Shard &shard : shards_) {
+      LockGuard lock(shard.lock_);
+      for (const auto &[key, value] : shard.map_)
+	func(key, value);
+    }
+  }
+
+private:
+  static constexpr size_t shard_count_ = 64;
+
+  struct Shard
+  {
+    mutable std::mutex lock_;
+    UnorderedMap<KEY, VALUE, HASH> map_;
+  };
+
+  Shard &
+  findShard(const KEY &key)
+  {
+    return shards_[HASH()(key) % shard_count_];
+  }
+  const Shard &
+  findShard(const KEY &key) const
+  {
+    return shards_[HASH()(key) % shard_count_];
+  }
+
+  Shard shards_[shard_count_];
+};
+
+} // namespace
@@ -24,7 +24,9 @@
 
 #pragma once
 
+#include <atomic>
 #include <string>
+#include <thread>
 
 #include "StringSeq.hh"
 #include "LibertyClass.hh"
@@ -119,6 +121,14 @@ public:
 				      Corner *corner,
 				      const MinMaxAll *min_max,
 				      bool infer_latches);
+  // Read a group of liberty files, parsing them concurrently on the
+  // thread pool when more than one thread is enabled.
+  // The returned libraries are in filename order, with nullptr entries
+  // for files that failed to parse.
+  virtual LibertyLibrarySeq readLiberty(const StdStringSeq &filenames,
+                                        Corner *corner,
+                                        const MinMaxAll *min_max,
+                                        bool infer_latches);
   bool readVerilog(const char *filename);
   // Network readers call this to notify the Sta to delete any previously
   // linked network.
@@ -126,6 +136,15 @@ public:
   // Return true if successful.
   bool linkDesign(const char *top_cell_name,
                   bool make_black_boxes);
+  // Save/restore the linked network as a binary snapshot.
+  bool writeNetworkSnapshot(const char *filename);
+  bool readNetworkSnapshot(const char *filename);
+  // Save/restore the calculated delays/slews as a binary checkpoint.
+  bool writeTimingCheckpoint(const char *filename);
+  bool readTimingCheckpoint(const char *filename);
+  // Save/restore the resolved sdc constraints as a binary snapshot.
+  bool writeSdcSnapshot(const char *filename);
+  bool readSdcSnapshot(const char *filename);
 
   // SDC Swig API.
   Instance *currentInstance() const;
@@ -758,6 +777,8 @@ public:
   void setVoltage(const Net *net,
                   const MinMax *min_max,
                   float voltage);
+  // Report per-subsystem object counts and approximate memory usage.
+  void reportMemory();
   // Clear all state except network.
   virtual void clear();
   // Remove all constraints.
@@ -844,6 +865,54 @@ public:
                                   bool removal,
                                   bool clk_gating_setup,
                                   bool clk_gating_hold);
+  // Streaming cursor variant of findPathEnds: path ends are handed to
+  // consumer in report order as they are produced instead of being
+  // gathered into one sequence, bounding in-flight memory.  The ends
+  // are owned by Search PathGroups and only valid during the visit.
+  // Arguments match findPathEnds.
+  virtual void visitPathEnds(ExceptionFrom *from,
+                             ExceptionThruSeq *thrus,
+                             ExceptionTo *to,
+                             bool unconstrained,
+                             const Corner *corner,
+                             const MinMaxAll *min_max,
+                             int group_path_count,
+                             int endpoint_path_count,
+                             bool unique_pins,
+                             bool unique_edges,
+                             float slack_min,
+                             float slack_max,
+                             bool sort_by_slack,
+                             PathGroupNameSet *group_names,
+                             bool setup,
+                             bool hold,
+                             bool recovery,
+                             bool removal,
+                             bool clk_gating_setup,
+                             bool clk_gating_hold,
+                             PathEndConsumer *consumer);
+  // Find and report path ends in one pass, streaming each end to the
+  // report formatter as it is produced.
+  virtual void reportPathEndsStreamed(ExceptionFrom *from,
+                                      ExceptionThruSeq *thrus,
+                                      ExceptionTo *to,
+                                      bool unconstrained,
+                                      const Corner *corner,
+                                      const MinMaxAll *min_max,
+                                      int group_path_count,
+                                      int endpoint_path_count,
+                                      bool unique_pins,
+                                      bool unique_edges,
+                                      float slack_min,
+                                      float slack_max,
+                                      bool sort_by_slack,
+                                      PathGroupNameSet *group_names,
+                                      bool setup,
+                                      bool hold,
+                                      bool recovery,
+                                      bool removal,
+                                      bool clk_gating_setup,
+                                      bool clk_gating_hold);
   void setReportPathFormat(ReportPathFormat format);
   void setReportPathFieldOrder(StringSeq *field_names);
   void setReportPathFields(bool report_input_pin,
@@ -898,9 +967,31 @@ public:
   // arrival/required/slack functions implicitly update timing incrementally.
   // If you are calling this function you are either very confused or there is
   // bug that should be reported.
-  void updateTiming(bool full);
+  // corner restricts a full update to one corner's analysis points;
+  // other corners' delays and arrivals stay live.
+  void updateTiming(bool full,
+		    const Corner *corner = nullptr);
+  // Update arrivals on a background thread so the command shell
+  // stays responsive during a long update.  Timing commands issued
+  // while the update runs wait for it to finish.
+  void updateTimingBackground(bool full);
+  bool updateTimingRunning() const;
+  // Progress of a background update, updated at BFS level boundaries.
+  Level updateTimingLevel() const;
+  Level updateTimingMaxLevel() const;
+  int updateTimingVisitCount() const;
+  // Stop a background update at the next level boundary and wait for
+  // the worker thread to exit.  The unvisited vertices stay queued,
+  // so the next timing command resumes the update where it stopped.
+  void cancelUpdateTiming();
+  // Wait for a background update to finish.
+  void waitUpdateTiming();
   // Invalidate all delay calculations. Arrivals also invalidated.
   void delaysInvalid() const;
+  // Invalidate one corner's delay calculations (all corners when
+  // corner is null).  Arrivals are invalidated by the delay observer
+  // only where the recomputed delays change.
+  void delaysInvalid(const Corner *corner) const;
   // Invalidate all arrival and required times.
   void arrivalsInvalid();
   PinSet startpointPins();
@@ -909,6 +1000,15 @@ public:
   int endpointViolationCount(const MinMax *min_max);
   // Find all required times after updateTiming().
   void findRequireds();
+  // Bracket a what-if probe: change, query, undo.  beginProbe brings
+  // the timing up to date and journals subsequent delay, slew and
+  // path changes; endProbe rolls the journals back instead of
+  // invalidating and re-solving the probed cone.  The caller must
+  // undo its netlist edits (eg swap the cell back) before endProbe,
+  // and only the probe edits may occur inside the window.  Probes do
+  // not nest.
+  void beginProbe();
+  void endProbe();
   std::string reportDelayCalc(Edge *edge,
                               TimingArc *arc,
                               const Corner *corner,
@@ -939,6 +1039,14 @@ public:
 		  // Return values.
 		  Slack &worst_slack,
 		  Vertex *&worst_vertex);
+  // Report a histogram of endpoint slacks in bin_count equal width
+  // bins; one line per bin with the bin's slack range and endpoint
+  // count.  Corner nullptr reports the worst slack across all
+  // corners.
+  void reportSlackHistogram(const Corner *corner,
+			    const MinMax *min_max,
+			    int bin_count,
+			    int digits);
   VertexPathIterator *vertexPathIterator(Vertex *vertex,
 					 const RiseFall *rf,
 					 const PathAnalysisPt *path_ap);
@@ -1094,8 +1202,13 @@ public:
 		bool pin_cap_included,
 		bool keep_coupling_caps,
 		float coupling_cap_factor,
+		float coupling_cap_threshold,
 		bool reduce);
+  // Reduce annotated parasitic networks for delay calculation on the
+  // dispatch queue threads ahead of the first timing update.
+  void reduceParasitics();
   void reportParasiticAnnotation(bool report_unannotated,
+                                 int hierarchy_depth,
                                  const Corner *corner);
   // Parasitics.
   void findPiElmore(Pin *drvr_pin,
@@ -1139,6 +1252,14 @@ public:
 			   Cell *to_cell);
   virtual void replaceCell(Instance *inst,
 			   LibertyCell *to_lib_cell);
+  // replace_block_with_model
+  // Replace hierarchical instance inst with a leaf instance of
+  // model_cell (typically a timing model extracted from the block by
+  // write_timing_model), reconnecting the boundary nets by port name.
+  // The timing graph is repaired incrementally by the edit hooks
+  // instead of relinking the design.
+  virtual Instance *replaceBlockWithModel(Instance *inst,
+					  LibertyCell *model_cell);
   virtual Net *makeNet(const char *name,
 		       Instance *parent);
   virtual void deleteNet(Net *net);
@@ -1153,6 +1274,11 @@ public:
   virtual void disconnectPin(Pin *pin);
   virtual void makePortPin(const char *port_name,
                            PortDirection *dir);
+  // Batch a sequence of network edits, deferring graph repair and
+  // search invalidation to endEdits so an ECO loop pays for one
+  // consolidated graph build and levelize instead of one per edit.
+  void beginEdits();
+  void endEdits();
   // Notify STA of network change.
   void networkChanged();
   void deleteLeafInstanceBefore(const Instance *inst);
@@ -1215,11 +1341,21 @@ public:
   // delays to be recomputed during incremental delay calculation.
   // Defaults to 0.0 for maximum accuracy and slowest incremental speed.
   void setIncrementalDelayTolerance(float tol);
+  // Quantization tolerance (0.0:1.0) for memoizing gate delay results
+  // across identically loaded drivers of the same timing arc.
+  // Defaults to 0.0, which disables memoization.
+  void setDelayCalcCacheTolerance(float tol);
   // Make graph and find delays.
   void searchPreamble();
 
   // Define the delay calculator implementation.
   void setArcDelayCalc(const char *delay_calc_name);
+  // Progressive-accuracy delay calculation: time the whole design with
+  // the current (cheap) delay calculator, then switch to
+  // delay_calc_name and re-time only the fanin cones of endpoints with
+  // slack below slack_margin.
+  void refineDelays(const char *delay_calc_name,
+		    float slack_margin);
 
   void setDebugLevel(const char *what,
 		     int level);
@@ -1272,6 +1408,15 @@ public:
                       const char *power_name,
                       const char *gnd_name,
                       CircuitSim ckt_sim);
+  // Batch variant; parses the subckt library once and writes one
+  // deck per path end into spice_dir with parallel workers.
+  void writePathsSpice(PathEndSeq *path_ends,
+                       const char *spice_dir,
+                       const char *lib_subckt_filename,
+                       const char *model_filename,
+                       const char *power_name,
+                       const char *gnd_name,
+                       CircuitSim ckt_sim);
 
   ////////////////////////////////////////////////////////////////
   // TCL Variables
@@ -1291,6 +1436,32 @@ public:
   void setPocvEnabled(bool enabled);
   // Number of std deviations from mean to use for normal distributions.
   void setSigmaFactor(float factor);
+  // TCL variable sta_liberty_cache_enabled.
+  // Read/write compiled binary caches next to liberty files.
+  bool libertyCacheEnabled() const;
+  void setLibertyCacheEnabled(bool enabled);
+  // TCL variable sta_liberty_lazy_enabled.
+  // Defer liberty cell construction until first reference.
+  bool libertyLazyEnabled() const;
+  void setLibertyLazyEnabled(bool enabled);
+  // TCL variable sta_spef_cache_enabled.
+  // Read/write compiled binary caches next to spef files.
+  bool spefCacheEnabled() const;
+  void setSpefCacheEnabled(bool enabled);
+  // TCL variable sta_spef_lazy_enabled.
+  // Page parasitic networks in from the spef cache on demand.
+  bool spefLazyEnabled() const;
+  void setSpefLazyEnabled(bool enabled);
+  // TCL variable sta_path_spill_enabled.
+  // Back path array storage with an unlinked scratch file so cold
+  // arrival/required pages spill to disk under memory pressure.
+  bool pathSpillEnabled() const;
+  void setPathSpillEnabled(bool enabled);
+  // TCL variable sta_thread_affinity_enabled.
+  // Pin worker threads to processors so their memory references stay
+  // node-local on NUMA hosts.
+  bool threadAffinityEnabled() const;
+  void setThreadAffinityEnabled(bool enabled);
   // TCL variable sta_propagate_gated_clock_enable.
   // Propagate gated clock enable arrivals.
   bool propagateGatedClockEnable() const;
@@ -1376,6 +1547,8 @@ protected:
   // Allow external Liberty reader to parse forms not used by Sta.
   virtual LibertyLibrary *readLibertyFile(const char *filename,
 					  bool infer_latches);
+  LibertyLibrary *readLibertyCached(const char *filename,
+                                    bool infer_latches);
   void delayCalcPreamble();
   void delaysInvalidFrom(const Port *port);
   void delaysInvalidFromFanin(const Port *port);
@@ -1405,6 +1578,9 @@ protected:
 			Edge *d_q_edge,
 			const ClockEdge *en_clk_edge);
   void clockSlewChanged(Clock *clk);
+  void clockDefInvalid(const char *name,
+		       PinSet *pins,
+		       bool add_to_pins);
   void minPulseWidthPreamble();
   void minPeriodPreamble();
   void maxSkewPreamble();
@@ -1441,6 +1617,7 @@ protected:
 		      int inst_level,
 		      int pin_level);
   void findRegisterPreamble();
+  void foundRegistersInvalid();
   bool crossesHierarchy(Edge *edge) const;
   void readLibertyAfter(LibertyLibrary *liberty,
 			Corner *corner,
@@ -1475,8 +1652,18 @@ protected:
   bool update_genclks_;
   EquivCells *equiv_cells_;
   bool graph_sdc_annotated_;
+  // Cached parameter-free findRegisterInstances result, invalidated
+  // by network edits.
+  InstanceSet *found_registers_;
+  // beginEdits/endEdits batch in progress.
+  bool edit_batch_;
+  // The batch dropped the graph, so endEdits must rebuild it.
+  bool edit_batch_graph_;
   bool parasitics_per_corner_;
   bool parasitics_per_min_max_;
+  // Background update_timing thread (see updateTimingBackground).
+  std::thread update_timing_thread_;
+  std::atomic<bool> update_timing_running_;
   Properties properties_;
 
   // Singleton sta used by tcl command interpreter.
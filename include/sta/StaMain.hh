@@ -24,6 +24,8 @@
 
 #pragma once
 
+#include <cstddef>
+
 struct Tcl_Interp;
 
 namespace sta {
@@ -54,6 +56,9 @@ evalTclInit(Tcl_Interp *interp,
 	    const char *inits[]);
 char *
 unencode(const char *inits[]);
+char *
+unencode(const char *inits[],
+	 size_t &length);
 
 bool
 findCmdLineFlag(int &argc,
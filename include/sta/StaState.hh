@@ -104,6 +104,7 @@ public:
   ClkNetwork *clkNetwork() { return clk_network_; }
   ClkNetwork *clkNetwork() const { return clk_network_; }
   unsigned threadCount() const { return thread_count_; }
+  DispatchQueue *dispatchQueue() const { return dispatch_queue_; }
   float sigmaFactor() const { return sigma_factor_; }
   bool crprActive() const;
   Variables *variables() { return variables_; }
@@ -28,6 +28,7 @@
 #include <cstring>
 #include <string>
 
+#include "Hash.hh"
 #include "Machine.hh" // __attribute__
 #include "Vector.hh"
 
@@ -114,6 +115,26 @@ public:
   }
 };
 
+// Functors for unordered containers keyed by c-strings.
+class CharPtrHash
+{
+public:
+  size_t operator()(const char *str) const
+  {
+    return hashString(str);
+  }
+};
+
+class CharPtrEqual
+{
+public:
+  bool operator()(const char *string1,
+		  const char *string2) const
+  {
+    return stringEq(string1, string2);
+  }
+};
+
 // Case insensitive comparision.
 class CharPtrCaseLess
 {
@@ -185,6 +206,12 @@ stringAppend(std::string &str,
 char *
 stringPrintTmp(const char *fmt,
 	       ...)  __attribute__((format (printf, 1, 2)));
+// Print value to a temporary string with "%.*f" semantics.
+// Integer-arithmetic fast path for the magnitudes reports emit;
+// output is identical to stringPrintTmp("%.*f", digits, value).
+char *
+stringPrintTmpFixed(double value,
+		    int digits);
 
 char *
 makeTmpString(size_t length);
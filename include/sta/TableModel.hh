@@ -39,6 +39,7 @@ class Unit;
 class Units;
 class Report;
 class Table;
+class AxisLookupCache;
 class OutputWaveforms;
 class Table1;
 
@@ -91,6 +92,8 @@ public:
 
   const TableModel *delayModel() const { return delay_model_; }
   const TableModel *slewModel() const { return slew_model_;  }
+  const TableModel *delaySigmaModel(const EarlyLate *early_late) const;
+  const TableModel *slewSigmaModel(const EarlyLate *early_late) const;
   const ReceiverModel *receiverModel() const { return receiver_model_.get(); }
   OutputWaveforms *outputWaveforms() const { return output_waveforms_; }
   // Check the axes before making the model.
@@ -112,6 +115,12 @@ protected:
 		  float in_slew,
 		  float load_cap,
 		  float related_out_cap) const;
+  float findValue(const Pvt *pvt,
+		  const TableModel *model,
+		  float in_slew,
+		  float load_cap,
+		  float related_out_cap,
+		  AxisLookupCache &cache) const;
   std::string reportTableLookup(const char *result_name,
                                 const Pvt *pvt,
                                 const TableModel *model,
@@ -157,6 +166,7 @@ public:
                                bool pocv_enabled,
                                int digits) const override;
   const TableModel *model() const { return model_; }
+  const TableModel *sigmaModel(const EarlyLate *early_late) const;
 
   // Check the axes before making the model.
   // Return true if the model axes are supported.
@@ -203,8 +213,11 @@ public:
 	     ScaleFactorType scale_factor_type,
 	     const RiseFall *rf);
   void setScaleFactorType(ScaleFactorType type);
+  ScaleFactorType scaleFactorType() const;
   int order() const;
+  const Table *table() const { return table_.get(); }
   TableTemplate *tblTemplate() const { return tbl_template_; }
+  const RiseFall *rf() const;
   const TableAxis *axis1() const;
   const TableAxis *axis2() const;
   const TableAxis *axis3() const;
@@ -222,6 +235,13 @@ public:
 		  float value1,
 		  float value2,
 		  float value3) const;
+  // Lookup sharing axis searches with other tables via the cache.
+  float findValue(const LibertyCell *cell,
+		  const Pvt *pvt,
+		  float value1,
+		  float value2,
+		  float value3,
+		  AxisLookupCache &cache) const;
   std::string reportValue(const char *result_name,
                           const LibertyCell *cell,
                           const Pvt *pvt,
@@ -268,6 +288,14 @@ public:
   virtual float findValue(float axis_value1,
 			  float axis_value2,
 			  float axis_value3) const = 0;
+  // Lookup that reuses axis binary searches cached by previous
+  // lookups on the same axes (delay/slew/sigma tables evaluated for
+  // one query usually share them).
+  virtual float findValue(float axis_value1,
+			  float axis_value2,
+			  float axis_value3,
+			  AxisLookupCache &) const
+  { return findValue(axis_value1, axis_value2, axis_value3); }
   // Table interpolated lookup with scale factor.
   float findValue(const LibertyLibrary *library,
 		  const LibertyCell *cell,
@@ -337,6 +365,10 @@ public:
   float findValue(float value1,
                   float value2,
                   float value3) const override;
+  float findValue(float value1,
+                  float value2,
+                  float value3,
+                  AxisLookupCache &cache) const override;
   std::string reportValue(const char *result_name,
                           const LibertyCell *cell,
                           const Pvt *pvt,
@@ -382,6 +414,10 @@ public:
   float findValue(float value1,
                   float value2,
                   float value3) const override;
+  float findValue(float value1,
+                  float value2,
+                  float value3,
+                  AxisLookupCache &cache) const override;
   std::string reportValue(const char *result_name,
                           const LibertyCell *cell,
                           const Pvt *pvt,
@@ -428,6 +464,10 @@ public:
   float findValue(float value1,
                   float value2,
                   float value3) const override;
+  float findValue(float value1,
+                  float value2,
+                  float value3,
+                  AxisLookupCache &cache) const override;
   std::string reportValue(const char *result_name,
                           const LibertyCell *cell,
                           const Pvt *pvt,
@@ -473,6 +513,41 @@ private:
   FloatSeq *values_;
 };
 
+// Memo for axis binary searches shared by the tables evaluated for
+// one query; the delay, slew, and sigma tables usually index the same
+// axes, so only the first lookup on each axis pays for the search.
+class AxisLookupCache
+{
+public:
+  AxisLookupCache();
+  // Find the interpolation index and fraction for value on axis.
+  void findWeight(const TableAxis *axis,
+		  float value,
+		  // Return values.
+		  size_t &index,
+		  double &dx);
+
+private:
+  static constexpr int cache_size_ = 4;
+  const TableAxis *axes_[cache_size_];
+  float values_[cache_size_];
+  size_t indices_[cache_size_];
+  double dxs_[cache_size_];
+  int next_;
+};
+
+////////////////////////////////////////////////////////////////
+
+// Axis and table interning for the liberty reader.  Axes and tables
+// are immutable once built and are frequently byte-identical between
+// cells and between corner libraries, so identical ones can share
+// storage.  Returns a previously interned equivalent if one exists;
+// otherwise records and returns the argument.  Interned entries are
+// weak references, so they disappear when the last library using them
+// is deleted.
+TableAxisPtr internTableAxis(TableAxisPtr axis);
+TablePtr internTable(TablePtr table);
+
 ////////////////////////////////////////////////////////////////
 
 class ReceiverModel
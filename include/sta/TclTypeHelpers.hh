@@ -59,6 +59,23 @@ objectListNext(const char *list,
 	       bool &type_match,
 	       const char *&next);
 
+// Native tcl handle for a network/graph object.  The object pointer
+// and swig type name live in the Tcl_Obj internal rep, so making a
+// handle does not format a pointer string and reading one back does
+// not parse one.  The string rep is materialized lazily in the swig
+// _hexaddress_p_type format, so handles used as strings (dict keys,
+// saved variables) still parse with SWIG_ConvertPtr.
+// type_name must outlive the handle (swig_type_info::name is static).
+Tcl_Obj *
+tclObjectHandle(void *object,
+		const char *type_name);
+
+// Object pointer of a tclObjectHandle with a matching type name,
+// or nullptr if obj is not one.
+void *
+tclObjectHandlePtr(Tcl_Obj *obj,
+		   const char *type_name);
+
 Tcl_Obj *
 tclArcDcalcArg(ArcDcalcArg &gate,
                Tcl_Interp *interp);
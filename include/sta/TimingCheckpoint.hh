@@ -0,0 +1,55 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2025, Parallax Software, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+//
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// This notice may not be removed or altered from any source distribution.
+
+#pragma once
+
+namespace sta {
+
+class StaState;
+
+// Versioned binary image of the calculated timing state.
+//
+// The checkpoint records the graph slews and arc delays for every
+// delay calc analysis point, validated against hashes of the graph
+// topology and the sdc clocks so it can only be restored into a
+// session with the same linked network and clocks.  Arrival/required
+// times and tags reference clocks, exceptions and clock info by
+// pointer and are rebuilt from the restored delays by the next
+// update instead of being serialized.
+
+// Write a checkpoint of the current delays and slews.
+// Returns false if no graph exists or the file cannot be written.
+bool
+writeTimingCheckpoint(const char *filename,
+                      StaState *sta);
+
+// Restore delays and slews from a checkpoint file.
+// Returns false if the file is missing, corrupt, written by a
+// different format version, or does not match the current
+// network/SDC.
+bool
+readTimingCheckpoint(const char *filename,
+                     StaState *sta);
+
+} // namespace
@@ -0,0 +1,72 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2025, Parallax Software, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+//
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// This notice may not be removed or altered from any source distribution.
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "Map.hh"
+#include "Delay.hh"
+#include "GraphClass.hh"
+
+namespace sta {
+
+// Incremental total negative slack accumulator for one path analysis
+// point.  Endpoint contributions live in a flat leaf array indexed by
+// a dense id handed out as endpoints first contribute, with a binary
+// sum tree above the leaves.  Committing a changed endpoint re-sums
+// the O(log n) tree path to the root instead of adjusting a running
+// accumulator, so repeated incremental updates cannot drift away from
+// the sum of the leaves, and the tns query just reads the root.
+class TnsTree
+{
+public:
+  TnsTree();
+  void clear();
+  bool hasVertex(const Vertex *vertex) const;
+  bool findSlack(const Vertex *vertex,
+		 // Return value.
+		 Slack &slack) const;
+  // Add or replace the vertex's contribution.
+  void setSlack(const Vertex *vertex,
+		Slack slack);
+  // Remove the vertex's contribution if it has one.
+  void eraseSlack(const Vertex *vertex);
+  Slack tns() const;
+
+private:
+  void resum(size_t leaf);
+  void grow();
+
+  // Heap layout; internal nodes are tree_[1 .. leaf_capacity_-1] and
+  // leaves are tree_[leaf_capacity_ .. leaf_capacity_*2-1].
+  std::vector<DelayDbl> tree_;
+  size_t leaf_capacity_;
+  size_t leaf_next_;
+  Map<const Vertex*, size_t> leaf_map_;
+  std::vector<size_t> free_leaves_;
+};
+
+} // namespace
@@ -78,6 +78,30 @@ public:
   void setUseDefaultArrivalClock(bool enable);
   bool pocvEnabled() const { return pocv_enabled_; }
   void setPocvEnabled(bool enabled);
+  // TCL variable sta_liberty_cache_enabled.
+  // Read/write compiled binary caches next to liberty files.
+  bool libertyCacheEnabled() const { return liberty_cache_enabled_; }
+  void setLibertyCacheEnabled(bool enabled);
+  // TCL variable sta_liberty_lazy_enabled.
+  // Defer liberty cell construction until first reference.
+  bool libertyLazyEnabled() const { return liberty_lazy_enabled_; }
+  void setLibertyLazyEnabled(bool enabled);
+  // TCL variable sta_spef_cache_enabled.
+  // Read/write compiled binary caches next to spef files.
+  bool spefCacheEnabled() const { return spef_cache_enabled_; }
+  void setSpefCacheEnabled(bool enabled);
+  // TCL variable sta_spef_lazy_enabled.
+  // Page parasitic networks in from the spef cache on demand.
+  bool spefLazyEnabled() const { return spef_lazy_enabled_; }
+  void setSpefLazyEnabled(bool enabled);
+  // TCL variable sta_path_spill_enabled.
+  // Back path arrays with a scratch file so cold arrival/required
+  // storage spills to disk under memory pressure.
+  bool pathSpillEnabled() const { return path_spill_enabled_; }
+  void setPathSpillEnabled(bool enabled);
+
+  bool threadAffinityEnabled() const { return thread_affinity_enabled_; }
+  void setThreadAffinityEnabled(bool enabled);
 
 private:
   bool crpr_enabled_;
@@ -94,6 +118,12 @@ private:
   bool propagate_all_clks_;
   bool use_default_arrival_clock_;
   bool pocv_enabled_;
+  bool liberty_cache_enabled_;
+  bool liberty_lazy_enabled_;
+  bool spef_cache_enabled_;
+  bool spef_lazy_enabled_;
+  bool path_spill_enabled_;
+  bool thread_affinity_enabled_;
 };
 
 } // namespace
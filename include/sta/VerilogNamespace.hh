@@ -25,6 +25,7 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 
 namespace sta {
 
@@ -38,12 +39,12 @@ std::string
 portVerilogName(const char *sta_name);
 
 std::string
-moduleVerilogToSta(const std::string *sta_name);
+moduleVerilogToSta(std::string_view sta_name);
 std::string
-instanceVerilogToSta(const std::string *sta_name);
+instanceVerilogToSta(std::string_view sta_name);
 std::string
-netVerilogToSta(const std::string *sta_name);
+netVerilogToSta(std::string_view sta_name);
 std::string
-portVerilogToSta(const std::string *sta_name);
+portVerilogToSta(std::string_view sta_name);
 
 } // namespace
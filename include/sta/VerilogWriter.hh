@@ -28,10 +28,16 @@
 
 namespace sta {
 
+class StaState;
+
+// sta supplies the thread pool used to format module bodies in
+// parallel; the network argument is passed separately because the
+// writer wants the sta internal network, not the sdc network.
 void
 writeVerilog(const char *filename,
 	     bool include_pwr_gnd,
 	     CellSeq *remove_cells,
-	     Network *network);
+	     Network *network,
+	     StaState *sta);
 
 } // namespace
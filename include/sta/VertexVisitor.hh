@@ -24,6 +24,8 @@
 
 #pragma once
 
+#include <cstddef>
+
 #include "NetworkClass.hh"
 #include "GraphClass.hh"
 
@@ -37,6 +39,12 @@ public:
   virtual ~VertexVisitor() {}
   virtual VertexVisitor *copy() const = 0;
   virtual void visit(Vertex *vertex) = 0;
+  // Visit a batch of vertices with one virtual call.  The default
+  // implementation calls visit for each vertex; visitors with
+  // per-visit setup can override it to amortize the setup across
+  // the batch.
+  virtual void visitVertices(Vertex *const *vertices,
+			     size_t count);
   void operator()(Vertex *vertex) { visit(vertex); }
   virtual void levelFinished() {}
 };
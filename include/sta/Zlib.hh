@@ -43,6 +43,8 @@
 #define gzopen fopen
 #define gzclose fclose
 #define gzgets(stream,s,size) fgets(s,size,stream)
+#define gzread(stream,buf,size) fread(buf,1,size,stream)
+#define gzwrite(stream,buf,size) fwrite(buf,1,size,stream)
 #define gzprintf fprintf
 #define Z_NULL nullptr
 
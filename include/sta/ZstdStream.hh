@@ -0,0 +1,82 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2025, Parallax Software, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+//
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// This notice may not be removed or altered from any source distribution.
+
+#pragma once
+
+#include <cstddef>
+
+namespace sta {
+
+// Streaming zstd compression support for .zst files.
+// The zstd package is optional; when it is missing open() fails and
+// the implementations are stubs.  The implementation is opaque so
+// zstd.h stays out of the public headers.
+
+// True if filename ends in .zst.
+bool
+isZstdFilename(const char *filename);
+
+// True if the file starts with the zstd frame magic.
+bool
+isZstdFile(const char *filename);
+
+// Streaming decompressor used by the file readers.
+class ZstdDecompress
+{
+public:
+  ZstdDecompress();
+  ~ZstdDecompress();
+  bool open(const char *filename);
+  void close();
+  bool isOpen() const { return impl_ != nullptr; }
+  // Returns the byte count decompressed into buffer,
+  // zero at the end of the stream, or -1 on error.
+  int read(char *buffer,
+           size_t size);
+
+private:
+  struct Impl;
+  Impl *impl_;
+};
+
+// Streaming compressor for redirected report output, using worker
+// threads and long range matching when libzstd supports them.
+class ZstdCompress
+{
+public:
+  ZstdCompress();
+  ~ZstdCompress();
+  bool open(const char *filename,
+            bool append);
+  void close();
+  bool isOpen() const { return impl_ != nullptr; }
+  bool write(const char *buffer,
+             size_t length);
+
+private:
+  struct Impl;
+  Impl *impl_;
+};
+
+} // namespace
@@ -24,6 +24,9 @@
 
 #include "EquivCells.hh"
 
+#include <algorithm>
+
+#include "DispatchQueue.hh"
 #include "Hash.hh"
 #include "MinMax.hh"
 #include "PortDirection.hh"
@@ -93,8 +96,12 @@ public:
 };
 
 EquivCells::EquivCells(LibertyLibrarySeq *equiv_libs,
-		       LibertyLibrarySeq *map_libs)
+		       LibertyLibrarySeq *map_libs,
+		       DispatchQueue *dispatch_queue)
 {
+  findCellHashes(equiv_libs, dispatch_queue);
+  if (map_libs)
+    findCellHashes(map_libs, dispatch_queue);
   LibertyCellHashMap hash_matches;
   for (auto lib : *equiv_libs)
     findEquivCells(lib, hash_matches);
@@ -108,6 +115,47 @@ EquivCells::EquivCells(LibertyLibrarySeq *equiv_libs,
       mapEquivCells(lib, hash_matches);
   }
   hash_matches.deleteContents();
+  cell_hashes_.clear();
+}
+
+// Hash the cells up front, partitioned across the dispatch queue
+// workers; hashing walks every port, function and sequential of every
+// cell and dominates classification time.
+void
+EquivCells::findCellHashes(LibertyLibrarySeq *libs,
+			   DispatchQueue *dispatch_queue)
+{
+  LibertyCellSeq cells;
+  for (auto lib : *libs) {
+    LibertyCellIterator cell_iter(lib);
+    while (cell_iter.hasNext()) {
+      LibertyCell *cell = cell_iter.next();
+      if (!cell->dontUse())
+	cells.push_back(cell);
+    }
+  }
+  size_t cell_count = cells.size();
+  std::vector<unsigned> hashes(cell_count);
+  size_t thread_count = dispatch_queue ? dispatch_queue->getThreadCount() : 1;
+  if (dispatch_queue
+      && thread_count > 1
+      && cell_count > thread_count) {
+    size_t chunk_size = (cell_count + thread_count - 1) / thread_count;
+    for (size_t begin = 0; begin < cell_count; begin += chunk_size) {
+      size_t end = std::min(begin + chunk_size, cell_count);
+      dispatch_queue->dispatch([&cells, &hashes, begin, end](int) {
+	for (size_t i = begin; i < end; i++)
+	  hashes[i] = hashCell(cells[i]);
+      });
+    }
+    dispatch_queue->finishTasks();
+  }
+  else {
+    for (size_t i = 0; i < cell_count; i++)
+      hashes[i] = hashCell(cells[i]);
+  }
+  for (size_t i = 0; i < cell_count; i++)
+    cell_hashes_[cells[i]] = hashes[i];
 }
 
 EquivCells::~EquivCells()
@@ -132,7 +180,7 @@ EquivCells::findEquivCells(const LibertyLibrary *library,
   while (cell_iter.hasNext()) {
     LibertyCell *cell = cell_iter.next();
     if (!cell->dontUse()) {
-      unsigned hash = hashCell(cell);
+      unsigned hash = cell_hashes_[cell];
       LibertyCellSeq *matches = hash_matches.findKey(hash);
       if (matches) {
 	LibertyCellSeq::Iterator match_iter(matches);
@@ -172,7 +220,7 @@ EquivCells::mapEquivCells(const LibertyLibrary *library,
   while (cell_iter.hasNext()) {
     LibertyCell *cell = cell_iter.next();
     if (!cell->dontUse()) {
-      unsigned hash = hashCell(cell);
+      unsigned hash = cell_hashes_[cell];
       LibertyCellSeq *matches = hash_matches.findKey(hash);
       if (matches) {
 	LibertyCellSeq::Iterator match_iter(matches);
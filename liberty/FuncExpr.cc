@@ -85,8 +85,46 @@ FuncExpr::FuncExpr(Operator op,
   op_(op),
   left_(left),
   right_(right),
-  port_(port)
+  port_(port),
+  table_(nullptr)
 {
+  port_support_ = 0;
+  if (port_)
+    port_support_ |= portSupportBit(port_);
+  if (left_)
+    port_support_ |= left_->port_support_;
+  if (right_)
+    port_support_ |= right_->port_support_;
+}
+
+uint64_t
+FuncExpr::portSupportBit(const LibertyPort *port)
+{
+  return uint64_t(1) << (port->id() % 64);
+}
+
+FuncExpr::~FuncExpr()
+{
+  delete table_.load(std::memory_order_relaxed);
+}
+
+FuncExprTable *
+FuncExpr::table()
+{
+  FuncExprTable *table = table_.load(std::memory_order_acquire);
+  if (table == nullptr) {
+    // Parallel evaluators can race to build the table; the first
+    // store wins and the loser's table is discarded.
+    table = new FuncExprTable(this);
+    FuncExprTable *expected = nullptr;
+    if (!table_.compare_exchange_strong(expected, table,
+					std::memory_order_acq_rel,
+					std::memory_order_acquire)) {
+      delete table;
+      table = expected;
+    }
+  }
+  return table->exists() ? table : nullptr;
 }
 
 void
@@ -418,4 +456,74 @@ FuncExpr::less(const FuncExpr *expr1,
     return (expr1 == nullptr && expr2 != nullptr);
 }
 
+////////////////////////////////////////////////////////////////
+
+FuncExprTable::FuncExprTable(const FuncExpr *expr) :
+  bits_{},
+  exists_(false)
+{
+  if (!isComplete(expr))
+    return;
+  FuncExprPortIterator port_iter(expr);
+  while (port_iter.hasNext()) {
+    if (ports_.size() == max_inputs)
+      return;
+    ports_.push_back(port_iter.next());
+  }
+  size_t combo_count = static_cast<size_t>(1) << ports_.size();
+  for (size_t index = 0; index < combo_count; index++) {
+    if (eval(expr, ports_, index))
+      bits_[index / 64] |= static_cast<uint64_t>(1) << (index % 64);
+  }
+  exists_ = true;
+}
+
+// Unknown port refs leave null sub-expressions in the tree.
+bool
+FuncExprTable::isComplete(const FuncExpr *expr)
+{
+  switch (expr->op()) {
+  case FuncExpr::op_port:
+  case FuncExpr::op_one:
+  case FuncExpr::op_zero:
+    return true;
+  case FuncExpr::op_not:
+    return expr->left() && isComplete(expr->left());
+  default:
+    return expr->left() && isComplete(expr->left())
+      && expr->right() && isComplete(expr->right());
+  }
+}
+
+bool
+FuncExprTable::eval(const FuncExpr *expr,
+		    const LibertyPortSeq &ports,
+		    size_t index)
+{
+  switch (expr->op()) {
+  case FuncExpr::op_port:
+    for (size_t i = 0; i < ports.size(); i++) {
+      if (ports[i] == expr->port())
+	return (index >> i) & 1;
+    }
+    return false;
+  case FuncExpr::op_not:
+    return !eval(expr->left(), ports, index);
+  case FuncExpr::op_or:
+    return eval(expr->left(), ports, index)
+      || eval(expr->right(), ports, index);
+  case FuncExpr::op_and:
+    return eval(expr->left(), ports, index)
+      && eval(expr->right(), ports, index);
+  case FuncExpr::op_xor:
+    return eval(expr->left(), ports, index)
+      != eval(expr->right(), ports, index);
+  case FuncExpr::op_one:
+    return true;
+  case FuncExpr::op_zero:
+    return false;
+  }
+  return false;
+}
+
 } // namespace
@@ -106,6 +106,12 @@ InternalPower::~InternalPower()
   // models_, when_ and related_pg_pin_ are owned by InternalPowerAttrs.
 }
 
+InternalPowerModel *
+InternalPower::model(const RiseFall *rf) const
+{
+  return models_[rf->index()];
+}
+
 LibertyCell *
 InternalPower::libertyCell() const
 {
@@ -95,7 +95,8 @@ LibertyLibrary::LibertyLibrary(const char *name,
   default_ocv_derate_(nullptr),
   buffers_(nullptr),
   inverters_(nullptr),
-  driver_waveform_default_(nullptr)
+  driver_waveform_default_(nullptr),
+  cell_elaborator_(nullptr)
 {
   // Scalar templates are builtin.
   for (int i = 0; i != table_template_type_count; i++) {
@@ -137,12 +138,29 @@ LibertyLibrary::~LibertyLibrary()
   delete inverters_;
   driver_waveform_map_.deleteContents();
   delete driver_waveform_default_;
+  delete cell_elaborator_;
 }
 
 LibertyCell *
 LibertyLibrary::findLibertyCell(const char *name) const
 {
-  return static_cast<LibertyCell*>(findCell(name));
+  LibertyCell *cell = static_cast<LibertyCell*>(findCell(name));
+  if (cell == nullptr && cell_elaborator_)
+    cell = cell_elaborator_->elaborateCell(name);
+  return cell;
+}
+
+void
+LibertyLibrary::setCellElaborator(LibertyCellElaborator *elaborator)
+{
+  delete cell_elaborator_;
+  cell_elaborator_ = elaborator;
+}
+
+void
+LibertyLibrary::recordCornerMap(int ap_index)
+{
+  corner_map_indices_.push_back(ap_index);
 }
 
 LibertyCellSeq
@@ -190,6 +208,33 @@ LibertyLibrary::buffers()
   return buffers_;
 }
 
+// Table model values, templates and strings are not counted, so this
+// understates the library somewhat.
+void
+LibertyLibrary::memoryUsage(size_t &object_count,
+			    size_t &bytes) const
+{
+  object_count = 0;
+  bytes = sizeof(LibertyLibrary);
+  LibertyCellIterator cell_iter(this);
+  while (cell_iter.hasNext()) {
+    LibertyCell *cell = cell_iter.next();
+    object_count++;
+    bytes += sizeof(LibertyCell);
+    LibertyCellPortIterator port_iter(cell);
+    while (port_iter.hasNext()) {
+      port_iter.next();
+      object_count++;
+      bytes += sizeof(LibertyPort);
+    }
+    for (TimingArcSet *arc_set : cell->timingArcSets()) {
+      size_t arc_count = arc_set->arcCount();
+      object_count += arc_count + 1;
+      bytes += sizeof(TimingArcSet) + arc_count * sizeof(TimingArc);
+    }
+  }
+}
+
 void
 LibertyLibrary::setDelayModelType(DelayModelType type)
 {
@@ -636,6 +681,15 @@ LibertyLibrary::findOperatingConditions(const char *name)
   return operating_conditions_.findKey(name);
 }
 
+OperatingConditionsSeq
+LibertyLibrary::operatingConditions() const
+{
+  OperatingConditionsSeq op_conds;
+  for (const auto [name, op_cond] : operating_conditions_)
+    op_conds.push_back(op_cond);
+  return op_conds;
+}
+
 OperatingConditions *
 LibertyLibrary::defaultOperatingConditions() const
 {
@@ -728,6 +782,9 @@ LibertyLibrary::makeCornerMap(LibertyLibrary *lib,
 			      Network *network,
 			      Report *report)
 {
+  // Lazy cells are corner mapped when they are elaborated.
+  if (lib->cellElaborator())
+    lib->recordCornerMap(ap_index);
   LibertyCellIterator cell_iter(lib);
   while (cell_iter.hasNext()) {
     LibertyCell *cell = cell_iter.next();
@@ -959,8 +1016,11 @@ LibertyCell::~LibertyCell()
   mode_defs_.deleteContents();
   latch_enables_.deleteContents();
 
-  timing_arc_sets_.deleteContents();
+  // Arc set memory is owned by the library arena.
+  for (TimingArcSet *arc_set : timing_arc_sets_)
+    arc_set->~TimingArcSet();
   port_timing_arc_set_map_.deleteContents();
+  port_role_timing_arc_set_map_.deleteContents();
   timing_arc_set_from_map_.deleteContents();
   timing_arc_set_to_map_.deleteContents();
 
@@ -1384,7 +1444,7 @@ LibertyCell::makeTimingArcMap(Report *)
       // 		   match->from()->name(),
       // 		   match->to()->name(),
       // 		   match->role()->asString());
-      delete arc_set;
+      arc_set->~TimingArcSet();
     }
     else
       // Shift arc sets down to fill holes left by removed duplicates.
@@ -1424,6 +1484,21 @@ LibertyCell::makeTimingArcPortMaps()
       timing_arc_set_to_map_[to] = sets;
     }
     sets->push_back(arc_set);
+
+    // Role qualified lookups, with nullptr from/to wildcard entries.
+    const TimingRole *role = arc_set->role();
+    const LibertyPortPairRole role_keys[] = {{from, to, role},
+					     {from, nullptr, role},
+					     {nullptr, to, role},
+					     {nullptr, nullptr, role}};
+    for (const LibertyPortPairRole &role_key : role_keys) {
+      sets = port_role_timing_arc_set_map_.findKey(role_key);
+      if (sets == nullptr) {
+	sets = new TimingArcSetSeq;
+	port_role_timing_arc_set_map_[role_key] = sets;
+      }
+      sets->push_back(arc_set);
+    }
   }
 }
 
@@ -1449,6 +1524,23 @@ LibertyCell::timingArcSets(const LibertyPort *from,
   }
 }
 
+const TimingArcSetSeq &
+LibertyCell::timingArcSets(const LibertyPort *from,
+			   const LibertyPort *to,
+			   const TimingRole *role) const
+{
+  if (role == nullptr)
+    return timingArcSets(from, to);
+  LibertyPortPairRole key(from, to, role);
+  TimingArcSetSeq *arc_sets = port_role_timing_arc_set_map_.findKey(key);
+  if (arc_sets)
+    return *arc_sets;
+  else {
+    static TimingArcSetSeq null_set;
+    return null_set;
+  }
+}
+
 TimingArcSet *
 LibertyCell::findTimingArcSet(TimingArcSet *key) const
 {
@@ -1808,35 +1900,31 @@ LibertyCell::findLatchSetup(const LibertyPort *d,
                             const TimingArcSet *en_to_q,
                             Report *report)
 {
-  TimingArcSetSeq en_d_arcs = timingArcSets(en, d);
+  const TimingArcSetSeq &en_d_setups = timingArcSets(en, d, TimingRole::setup());
   // First search for setup checks with the correct clock edge.
-  for (TimingArcSet *arc_set : en_d_arcs) {
-    if (arc_set->role() == TimingRole::setup()) {
-      for (TimingArc *arc : arc_set->arcs()) {
-        const RiseFall *from_rf = arc->fromEdge()->asRiseFall();
-        if (from_rf == en_rf->opposite()
-            && condMatch(arc_set, en_to_q))
-          return arc_set;
-      }
+  for (TimingArcSet *arc_set : en_d_setups) {
+    for (TimingArc *arc : arc_set->arcs()) {
+      const RiseFall *from_rf = arc->fromEdge()->asRiseFall();
+      if (from_rf == en_rf->opposite()
+          && condMatch(arc_set, en_to_q))
+        return arc_set;
     }
   }
   // Then search for setup checks with the opposite clock edge.
-  for (TimingArcSet *arc_set : en_d_arcs) {
-    if (arc_set->role() == TimingRole::setup()) {
-      for (TimingArc *arc : arc_set->arcs()) {
-        const RiseFall *from_rf = arc->fromEdge()->asRiseFall();
-        if (from_rf == en_rf) {
-          report->warn(1113, "cell %s/%s %s -> %s latch enable %s_edge is inconsistent with %s -> %s setup_%s check.",
-                       library_->name(),
-                       name(),
-                       en->name(),
-                       q->name(),
-                       en_rf == RiseFall::rise() ? "rising" : "falling",
-                       en->name(),
-                       d->name(),
-                       from_rf == RiseFall::rise() ? "rising" : "falling");
-          return arc_set;
-        }
+  for (TimingArcSet *arc_set : en_d_setups) {
+    for (TimingArc *arc : arc_set->arcs()) {
+      const RiseFall *from_rf = arc->fromEdge()->asRiseFall();
+      if (from_rf == en_rf) {
+        report->warn(1113, "cell %s/%s %s -> %s latch enable %s_edge is inconsistent with %s -> %s setup_%s check.",
+                     library_->name(),
+                     name(),
+                     en->name(),
+                     q->name(),
+                     en_rf == RiseFall::rise() ? "rising" : "falling",
+                     en->name(),
+                     d->name(),
+                     from_rf == RiseFall::rise() ? "rising" : "falling");
+        return arc_set;
       }
     }
   }
@@ -2971,6 +3059,23 @@ LibertyPortPairLess::operator()(const LibertyPortPair &pair1,
 	&& pair1.second->id() < pair2.second->id());
 }
 
+bool
+LibertyPortPairRoleLess::operator()(const LibertyPortPairRole &key1,
+				    const LibertyPortPairRole &key2) const
+{
+  const auto &[from1, to1, role1] = key1;
+  const auto &[from2, to2, role2] = key2;
+  ObjectId from_id1 = from1 ? from1->id() : 0;
+  ObjectId from_id2 = from2 ? from2->id() : 0;
+  ObjectId to_id1 = to1 ? to1->id() : 0;
+  ObjectId to_id2 = to2 ? to2->id() : 0;
+  return from_id1 < from_id2
+    || (from_id1 == from_id2
+	&& (to_id1 < to_id2
+	    || (to_id1 == to_id2
+		&& role1->index() < role2->index())));
+}
+
 ////////////////////////////////////////////////////////////////
 
 LibertyPortMemberIterator::LibertyPortMemberIterator(const LibertyPort *port) :
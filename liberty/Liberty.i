@@ -125,6 +125,26 @@ read_liberty_cmd(char *filename,
   return (lib != nullptr);
 }
 
+bool
+read_liberty_files_cmd(StringSeq *filenames,
+                       Corner *corner,
+                       const MinMaxAll *min_max,
+                       bool infer_latches)
+{
+  Sta *sta = Sta::sta();
+  StdStringSeq files;
+  for (const char *filename : *filenames)
+    files.emplace_back(filename);
+  delete filenames;
+  LibertyLibrarySeq libs = sta->readLiberty(files, corner, min_max,
+                                            infer_latches);
+  for (LibertyLibrary *lib : libs) {
+    if (lib == nullptr)
+      return false;
+  }
+  return true;
+}
+
 void
 write_liberty_cmd(LibertyLibrary *library,
                   char *filename)
@@ -132,6 +152,30 @@ write_liberty_cmd(LibertyLibrary *library,
   writeLiberty(library, filename, Sta::sta());
 }
 
+bool
+liberty_cache_enabled()
+{
+  return Sta::sta()->libertyCacheEnabled();
+}
+
+void
+set_liberty_cache_enabled(bool enabled)
+{
+  Sta::sta()->setLibertyCacheEnabled(enabled);
+}
+
+bool
+liberty_lazy_enabled()
+{
+  return Sta::sta()->libertyLazyEnabled();
+}
+
+void
+set_liberty_lazy_enabled(bool enabled)
+{
+  Sta::sta()->setLibertyLazyEnabled(enabled);
+}
+
 void
 make_equiv_cells(LibertyLibrary *lib)
 {
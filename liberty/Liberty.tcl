@@ -27,18 +27,29 @@
 namespace eval sta {
 
 define_cmd_args "read_liberty" \
-  {[-corner corner] [-min] [-max] [-infer_latches] filename}
+  {[-corner corner] [-min] [-max] [-infer_latches] filenames}
 
 proc_redirect read_liberty {
   parse_key_args "read_liberty" args keys {-corner} \
     flags {-min -max -infer_latches}
-  check_argc_eq1 "read_liberty" $args
+  if { [llength $args] < 1 } {
+    sta_error 2207 "read_liberty requires one or more filenames."
+  }
 
-  set filename [file nativename [lindex $args 0]]
   set corner [parse_corner keys]
   set min_max [parse_min_max_all_flags flags]
   set infer_latches [info exists flags(-infer_latches)]
-  read_liberty_cmd $filename $corner $min_max $infer_latches
+  if { [llength $args] == 1 } {
+    set filename [file nativename [lindex $args 0]]
+    read_liberty_cmd $filename $corner $min_max $infer_latches
+  } else {
+    # Multiple filenames are parsed concurrently on the thread pool.
+    set filenames {}
+    foreach filename $args {
+      lappend filenames [file nativename $filename]
+    }
+    read_liberty_files_cmd $filenames $corner $min_max $infer_latches
+  }
 }
 
 # for regression testing
@@ -713,7 +713,8 @@ LibertyBuilder::makeTimingArcSet(LibertyCell *cell,
 				 const TimingRole *role,
 				 TimingArcAttrsPtr attrs)
 {
-  return new TimingArcSet(cell, from, to, nullptr, role, attrs);
+  return new (cell->libertyLibrary()->arena())
+    TimingArcSet(cell, from, to, nullptr, role, attrs);
 }
 
 TimingArcSet *
@@ -724,7 +725,8 @@ LibertyBuilder::makeTimingArcSet(LibertyCell *cell,
 				 const TimingRole *role,
 				 TimingArcAttrsPtr attrs)
 {
-  return new TimingArcSet(cell, from, to, related_out, role, attrs);
+  return new (cell->libertyLibrary()->arena())
+    TimingArcSet(cell, from, to, related_out, role, attrs);
 }
 
 TimingArc *
@@ -733,8 +735,8 @@ LibertyBuilder::makeTimingArc(TimingArcSet *set,
 			      const RiseFall *to_rf,
 			      TimingModel *model)
 {
-  return new TimingArc(set, from_rf->asTransition(),
-		       to_rf->asTransition(), model);
+  return new (set->libertyCell()->libertyLibrary()->arena())
+    TimingArc(set, from_rf->asTransition(), to_rf->asTransition(), model);
 }
 
 TimingArc *
@@ -743,7 +745,8 @@ LibertyBuilder::makeTimingArc(TimingArcSet *set,
 			      const Transition *to_rf,
 			      TimingModel *model)
 {
-  return new TimingArc(set, from_rf, to_rf, model);
+  return new (set->libertyCell()->libertyLibrary()->arena())
+    TimingArc(set, from_rf, to_rf, model);
 }
 
 ////////////////////////////////////////////////////////////////
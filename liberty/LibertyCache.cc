@@ -0,0 +1,1461 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2025, Parallax Software, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+//
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// This notice may not be removed or altered from any source distribution.
+
+#include "LibertyCache.hh"
+
+#include <cstring>
+#include <fstream>
+#include <sys/stat.h>
+
+#ifndef _WIN32
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <unistd.h>
+#endif
+
+#include "Report.hh"
+#include "Error.hh"
+#include "Units.hh"
+#include "FuncExpr.hh"
+#include "TableModel.hh"
+#include "TimingArc.hh"
+#include "TimingRole.hh"
+#include "InternalPower.hh"
+#include "LeakagePower.hh"
+#include "Liberty.hh"
+#include "Network.hh"
+#include "PortDirection.hh"
+#include "LibExprReader.hh"
+#include "LibertyBuilder.hh"
+
+namespace sta {
+
+using std::string;
+
+static constexpr uint32_t cache_magic = 0x4c415453;  // "STAL"
+static constexpr uint32_t cache_format_version = 1;
+
+std::string
+libertyCacheFilename(const char *filename)
+{
+  return string(filename) + ".stacache";
+}
+
+static bool
+sourceFileStats(const char *filename,
+                // Return values.
+                uint64_t &size,
+                uint64_t &mtime)
+{
+  struct stat sbuf;
+  if (stat(filename, &sbuf) == 0) {
+    size = sbuf.st_size;
+    mtime = sbuf.st_mtime;
+    return true;
+  }
+  return false;
+}
+
+////////////////////////////////////////////////////////////////
+//
+// Writer
+//
+////////////////////////////////////////////////////////////////
+
+class LibertyCacheWriter
+{
+public:
+  LibertyCacheWriter(const LibertyLibrary *library,
+                     const char *filename,
+                     Report *report);
+  bool write();
+
+private:
+  bool librarySupported() const;
+  bool cellSupported(const LibertyCell *cell) const;
+  bool portSupported(const LibertyPort *port) const;
+  bool arcSetSupported(const TimingArcSet *arc_set) const;
+
+  void writeLibrary();
+  void writeUnit(const Unit *unit);
+  void writeCell(const LibertyCell *cell);
+  void writePortAttrs(const LibertyPort *port);
+  void writeArcSet(const TimingArcSet *arc_set);
+  void writeTimingModel(const TimingModel *model);
+  void writeTableModel(const TableModel *model);
+  void writeOptTableModel(const TableModel *model);
+  void writeTable(const Table *table);
+  void writeAxis(const TableAxis *axis);
+  void writeInternalPower(const InternalPower *power);
+  void writeFuncExpr(const FuncExpr *expr);
+
+  void writeBool(bool value);
+  void writeU8(uint8_t value);
+  void writeU32(uint32_t value);
+  void writeU64(uint64_t value);
+  void writeI32(int32_t value);
+  void writeFloat(float value);
+  void writeFloatBool(float value,
+                      bool exists);
+  void writeString(const char *str);
+
+  const LibertyLibrary *library_;
+  const char *filename_;
+  Report *report_;
+  std::ofstream out_;
+};
+
+LibertyCacheWriter::LibertyCacheWriter(const LibertyLibrary *library,
+                                       const char *filename,
+                                       Report *report) :
+  library_(library),
+  filename_(filename),
+  report_(report)
+{
+}
+
+bool
+LibertyCacheWriter::write()
+{
+  if (!librarySupported())
+    return false;
+
+  LibertyCellIterator cell_iter(library_);
+  while (cell_iter.hasNext()) {
+    if (!cellSupported(cell_iter.next()))
+      return false;
+  }
+
+  string cache_filename = libertyCacheFilename(filename_);
+  out_.open(cache_filename, std::ios::binary | std::ios::trunc);
+  if (!out_.is_open()) {
+    report_->warn(2310, "cannot open liberty cache file %s.",
+                  cache_filename.c_str());
+    return false;
+  }
+  writeLibrary();
+  out_.close();
+  if (out_.fail()) {
+    report_->warn(2311, "error writing liberty cache file %s.",
+                  cache_filename.c_str());
+    return false;
+  }
+  return true;
+}
+
+bool
+LibertyCacheWriter::librarySupported() const
+{
+  float value;
+  bool exists;
+  library_->supplyVoltage("", value, exists);
+  return library_->delayModelType() == DelayModelType::table
+    && library_->cellElaborator() == nullptr
+    && library_->scaleFactors() == nullptr
+    && library_->wireSlewDegradationTable(RiseFall::rise()) == nullptr
+    && library_->wireSlewDegradationTable(RiseFall::fall()) == nullptr
+    && library_->defaultWireload() == nullptr
+    && library_->defaultWireloadSelection() == nullptr
+    && library_->defaultOcvDerate() == nullptr
+    && const_cast<LibertyLibrary*>(library_)->driverWaveformDefault() == nullptr;
+}
+
+bool
+LibertyCacheWriter::cellSupported(const LibertyCell *cell) const
+{
+  if (cell->hasSequentials()
+      || cell->statetable() != nullptr
+      || cell->testCell() != nullptr
+      || cell->hasInferedRegTimingArcs()
+      || cell->hasInternalPorts()
+      || cell->scaleFactors() != nullptr
+      || cell->ocvDerate() != nullptr)
+    return false;
+  LibertyCellPortIterator port_iter(cell);
+  while (port_iter.hasNext()) {
+    const LibertyPort *port = port_iter.next();
+    if (!portSupported(port))
+      return false;
+    if (port->isBus()) {
+      LibertyPortMemberIterator member_iter(port);
+      while (member_iter.hasNext()) {
+        if (!portSupported(member_iter.next()))
+          return false;
+      }
+    }
+  }
+  for (const TimingArcSet *arc_set : cell->timingArcSets()) {
+    if (!arcSetSupported(arc_set))
+      return false;
+  }
+  return true;
+}
+
+bool
+LibertyCacheWriter::portSupported(const LibertyPort *port) const
+{
+  return !port->isBundle()
+    && port->receiverModel() == nullptr
+    && port->driverWaveform(RiseFall::rise()) == nullptr
+    && port->driverWaveform(RiseFall::fall()) == nullptr;
+}
+
+bool
+LibertyCacheWriter::arcSetSupported(const TimingArcSet *arc_set) const
+{
+  const TimingArcAttrs *attrs = arc_set->attrs().get();
+  TimingType timing_type = attrs->timingType();
+  if (attrs->modeName() != nullptr
+      || timing_type == TimingType::min_clock_tree_path
+      || timing_type == TimingType::max_clock_tree_path)
+    return false;
+  for (const RiseFall *rf : RiseFall::range()) {
+    const TimingModel *model = attrs->model(rf);
+    if (model) {
+      const GateTableModel *gate_model =
+        dynamic_cast<const GateTableModel*>(model);
+      const CheckTableModel *check_model =
+        dynamic_cast<const CheckTableModel*>(model);
+      if (gate_model) {
+        if (gate_model->receiverModel() != nullptr
+            || gate_model->outputWaveforms() != nullptr)
+          return false;
+      }
+      else if (check_model == nullptr)
+        return false;
+    }
+  }
+  return true;
+}
+
+void
+LibertyCacheWriter::writeLibrary()
+{
+  uint64_t src_size, src_mtime;
+  if (!sourceFileStats(filename_, src_size, src_mtime))
+    src_size = src_mtime = 0;
+
+  writeU32(cache_magic);
+  writeU32(cache_format_version);
+  writeU64(src_size);
+  writeU64(src_mtime);
+
+  writeString(library_->name());
+  writeU8(static_cast<uint8_t>(library_->delayModelType()));
+
+  const Units *units = library_->units();
+  writeUnit(units->timeUnit());
+  writeUnit(units->resistanceUnit());
+  writeUnit(units->capacitanceUnit());
+  writeUnit(units->voltageUnit());
+  writeUnit(units->currentUnit());
+  writeUnit(units->powerUnit());
+  writeUnit(units->distanceUnit());
+  writeUnit(units->scalarUnit());
+
+  writeFloat(library_->nominalProcess());
+  writeFloat(library_->nominalVoltage());
+  writeFloat(library_->nominalTemperature());
+
+  for (const RiseFall *rf : RiseFall::range()) {
+    writeFloat(library_->inputThreshold(rf));
+    writeFloat(library_->outputThreshold(rf));
+    writeFloat(library_->slewLowerThreshold(rf));
+    writeFloat(library_->slewUpperThreshold(rf));
+  }
+  writeFloat(library_->slewDerateFromLibrary());
+
+  writeFloat(library_->defaultInputPinCap());
+  writeFloat(library_->defaultOutputPinCap());
+  writeFloat(library_->defaultBidirectPinCap());
+
+  float value;
+  bool exists;
+  for (const RiseFall *rf : RiseFall::range()) {
+    library_->defaultIntrinsic(rf, value, exists);
+    writeFloatBool(value, exists);
+  }
+  for (const RiseFall *rf : RiseFall::range()) {
+    library_->defaultBidirectPinRes(rf, value, exists);
+    writeFloatBool(value, exists);
+  }
+  for (const RiseFall *rf : RiseFall::range()) {
+    library_->defaultOutputPinRes(rf, value, exists);
+    writeFloatBool(value, exists);
+  }
+  library_->defaultFanoutLoad(value, exists);
+  writeFloatBool(value, exists);
+  library_->defaultMaxSlew(value, exists);
+  writeFloatBool(value, exists);
+  library_->defaultMaxCapacitance(value, exists);
+  writeFloatBool(value, exists);
+  library_->defaultMaxFanout(value, exists);
+  writeFloatBool(value, exists);
+  writeFloat(library_->ocvArcDepth());
+
+  const SupplyVoltageMap &supplies = library_->supplyVoltageMap();
+  writeU32(supplies.size());
+  for (const auto& [supply_name, voltage] : supplies) {
+    writeString(supply_name.c_str());
+    writeFloat(voltage);
+  }
+
+  BusDclSeq bus_dcls = library_->busDcls();
+  writeU32(bus_dcls.size());
+  for (const BusDcl *bus_dcl : bus_dcls) {
+    writeString(bus_dcl->name());
+    writeI32(bus_dcl->from());
+    writeI32(bus_dcl->to());
+  }
+
+  OperatingConditionsSeq op_conds = library_->operatingConditions();
+  writeU32(op_conds.size());
+  for (const OperatingConditions *op_cond : op_conds) {
+    writeString(op_cond->name());
+    writeFloat(op_cond->process());
+    writeFloat(op_cond->voltage());
+    writeFloat(op_cond->temperature());
+    writeU8(static_cast<uint8_t>(op_cond->wireloadTree()));
+  }
+  const OperatingConditions *default_op_cond =
+    library_->defaultOperatingConditions();
+  writeBool(default_op_cond != nullptr);
+  if (default_op_cond)
+    writeString(default_op_cond->name());
+
+  uint32_t cell_count = 0;
+  LibertyCellIterator count_iter(library_);
+  while (count_iter.hasNext()) {
+    count_iter.next();
+    cell_count++;
+  }
+  writeU32(cell_count);
+  LibertyCellIterator cell_iter(library_);
+  while (cell_iter.hasNext())
+    writeCell(cell_iter.next());
+}
+
+void
+LibertyCacheWriter::writeUnit(const Unit *unit)
+{
+  writeFloat(unit->scale());
+  writeString(unit->suffix().c_str());
+  writeU32(unit->digits());
+}
+
+void
+LibertyCacheWriter::writeCell(const LibertyCell *cell)
+{
+  writeString(cell->name());
+  writeFloat(cell->area());
+  float leakage;
+  bool leakage_exists;
+  cell->leakagePower(leakage, leakage_exists);
+  writeFloatBool(leakage, leakage_exists);
+  writeString(cell->footprint());
+  writeString(cell->userFunctionClass());
+
+  uint32_t flags =
+    (cell->dontUse() << 0)
+    | (cell->isMacro() << 1)
+    | (cell->isMemory() << 2)
+    | (cell->isPad() << 3)
+    | (cell->isClockCell() << 4)
+    | (cell->isLevelShifter() << 5)
+    | (cell->isIsolationCell() << 6)
+    | (cell->alwaysOn() << 7)
+    | (cell->interfaceTiming() << 8)
+    | (cell->isDisabledConstraint() << 9);
+  writeU32(flags);
+  writeU8(static_cast<uint8_t>(cell->levelShifterType()));
+  writeU8(static_cast<uint8_t>(cell->switchCellType()));
+  uint8_t clock_gate_type = 0;
+  if (cell->isClockGateLatchPosedge())
+    clock_gate_type = 1;
+  else if (cell->isClockGateLatchNegedge())
+    clock_gate_type = 2;
+  else if (cell->isClockGateOther())
+    clock_gate_type = 3;
+  writeU8(clock_gate_type);
+  writeFloat(cell->ocvArcDepth());
+
+  // Port structure records.
+  uint32_t port_count = 0;
+  uint32_t attrs_count = 0;
+  LibertyCellPortIterator count_iter(cell);
+  while (count_iter.hasNext()) {
+    const LibertyPort *port = count_iter.next();
+    port_count++;
+    attrs_count += port->isBus() ? port->size() + 1 : 1;
+  }
+  writeU32(port_count);
+  LibertyCellPortIterator port_iter(cell);
+  while (port_iter.hasNext()) {
+    const LibertyPort *port = port_iter.next();
+    writeString(port->name());
+    writeBool(port->isBus());
+    writeI32(port->fromIndex());
+    writeI32(port->toIndex());
+    const BusDcl *bus_dcl = port->busDcl();
+    writeString(bus_dcl ? bus_dcl->name() : "");
+  }
+
+  // Port attribute records, covering bus bits.
+  writeU32(attrs_count);
+  LibertyCellPortIterator attrs_iter(cell);
+  while (attrs_iter.hasNext()) {
+    const LibertyPort *port = attrs_iter.next();
+    writePortAttrs(port);
+    if (port->isBus()) {
+      LibertyPortMemberIterator member_iter(port);
+      while (member_iter.hasNext())
+        writePortAttrs(member_iter.next());
+    }
+  }
+
+  const TimingArcSetSeq &arc_sets = cell->timingArcSets();
+  writeU32(arc_sets.size());
+  for (const TimingArcSet *arc_set : arc_sets)
+    writeArcSet(arc_set);
+
+  const InternalPowerSeq &internal_powers = cell->internalPowers();
+  writeU32(internal_powers.size());
+  for (const InternalPower *power : internal_powers)
+    writeInternalPower(power);
+
+  LeakagePowerSeq *leakage_powers =
+    const_cast<LibertyCell*>(cell)->leakagePowers();
+  writeU32(leakage_powers->size());
+  for (LeakagePower *power : *leakage_powers) {
+    writeFuncExpr(power->when());
+    writeFloat(power->power());
+  }
+}
+
+void
+LibertyCacheWriter::writePortAttrs(const LibertyPort *port)
+{
+  writeString(port->direction()->name());
+  writeFuncExpr(port->function());
+  writeFuncExpr(port->tristateEnable());
+
+  float value;
+  bool exists;
+  for (const RiseFall *rf : RiseFall::range()) {
+    for (const MinMax *min_max : MinMax::range()) {
+      port->capacitance(rf, min_max, value, exists);
+      writeFloatBool(value, exists);
+    }
+  }
+  for (const MinMax *min_max : MinMax::range()) {
+    port->slewLimit(min_max, value, exists);
+    writeFloatBool(value, exists);
+  }
+  for (const MinMax *min_max : MinMax::range()) {
+    port->capacitanceLimit(min_max, value, exists);
+    writeFloatBool(value, exists);
+  }
+  for (const MinMax *min_max : MinMax::range()) {
+    port->fanoutLimit(min_max, value, exists);
+    writeFloatBool(value, exists);
+  }
+  port->fanoutLoad(value, exists);
+  writeFloatBool(value, exists);
+  port->minPeriod(value, exists);
+  writeFloatBool(value, exists);
+  for (const RiseFall *rf : RiseFall::range()) {
+    port->minPulseWidth(rf, value, exists);
+    writeFloatBool(value, exists);
+  }
+
+  uint32_t flags =
+    (port->isClock() << 0)
+    | (port->isClockGateClock() << 1)
+    | (port->isClockGateEnable() << 2)
+    | (port->isClockGateOut() << 3)
+    | (port->isPllFeedback() << 4)
+    | (port->isolationCellData() << 5)
+    | (port->isolationCellEnable() << 6)
+    | (port->levelShifterData() << 7)
+    | (port->isSwitch() << 8)
+    | (port->isDisabledConstraint() << 9)
+    | (port->isPad() << 10);
+  writeU32(flags);
+  const RiseFall *pulse_trigger = port->pulseClkTrigger();
+  const RiseFall *pulse_sense = port->pulseClkSense();
+  writeI32(pulse_trigger ? pulse_trigger->index() : -1);
+  writeI32(pulse_sense ? pulse_sense->index() : -1);
+  writeU8(static_cast<uint8_t>(port->scanSignalType()));
+  writeU8(static_cast<uint8_t>(port->pwrGndType()));
+  writeString(port->voltageName());
+  writeString(port->relatedGroundPin());
+  writeString(port->relatedPowerPin());
+}
+
+void
+LibertyCacheWriter::writeArcSet(const TimingArcSet *arc_set)
+{
+  const TimingArcAttrs *attrs = arc_set->attrs().get();
+  writeString(arc_set->from()->name());
+  writeString(arc_set->to()->name());
+  const LibertyPort *related_out = arc_set->relatedOut();
+  writeString(related_out ? related_out->name() : "");
+
+  writeU8(static_cast<uint8_t>(attrs->timingType()));
+  writeU8(static_cast<uint8_t>(attrs->timingSense()));
+  writeFuncExpr(attrs->cond());
+  writeString(attrs->sdfCond());
+  writeString(attrs->sdfCondStart());
+  writeString(attrs->sdfCondEnd());
+  writeFloat(attrs->ocvArcDepth());
+
+  for (const RiseFall *rf : RiseFall::range()) {
+    const TimingModel *model = attrs->model(rf);
+    if (model)
+      writeTimingModel(model);
+    else
+      writeU8(0);
+  }
+}
+
+void
+LibertyCacheWriter::writeTimingModel(const TimingModel *model)
+{
+  const GateTableModel *gate_model =
+    dynamic_cast<const GateTableModel*>(model);
+  if (gate_model) {
+    writeU8(1);
+    writeTableModel(gate_model->delayModel());
+    for (const EarlyLate *early_late : EarlyLate::range())
+      writeOptTableModel(gate_model->delaySigmaModel(early_late));
+    writeTableModel(gate_model->slewModel());
+    for (const EarlyLate *early_late : EarlyLate::range())
+      writeOptTableModel(gate_model->slewSigmaModel(early_late));
+  }
+  else {
+    const CheckTableModel *check_model =
+      dynamic_cast<const CheckTableModel*>(model);
+    writeU8(2);
+    writeTableModel(check_model->model());
+    for (const EarlyLate *early_late : EarlyLate::range())
+      writeOptTableModel(check_model->sigmaModel(early_late));
+  }
+}
+
+void
+LibertyCacheWriter::writeOptTableModel(const TableModel *model)
+{
+  writeBool(model != nullptr);
+  if (model)
+    writeTableModel(model);
+}
+
+void
+LibertyCacheWriter::writeTableModel(const TableModel *model)
+{
+  const TableTemplate *tbl_template = model->tblTemplate();
+  writeBool(tbl_template != nullptr);
+  if (tbl_template)
+    writeString(tbl_template->name());
+  writeU8(static_cast<uint8_t>(model->scaleFactorType()));
+  writeU8(model->rf()->index());
+  writeTable(model->table());
+}
+
+void
+LibertyCacheWriter::writeTable(const Table *table)
+{
+  int order = table->order();
+  writeU8(order);
+  switch (order) {
+  case 0:
+    writeFloat(table->value(0, 0, 0));
+    break;
+  case 1: {
+    const Table1 *table1 = static_cast<const Table1*>(table);
+    writeAxis(table1->axis1());
+    const FloatSeq *values = table1->values();
+    writeU32(values->size());
+    for (float value : *values)
+      writeFloat(value);
+    break;
+  }
+  case 2:
+  case 3: {
+    const Table2 *table2 = static_cast<const Table2*>(table);
+    writeAxis(table2->axis1());
+    writeAxis(table2->axis2());
+    if (order == 3)
+      writeAxis(table2->axis3());
+    const FloatTable *values = const_cast<Table2*>(table2)->values3();
+    writeU32(values->size());
+    for (const FloatSeq *row : *values) {
+      writeU32(row->size());
+      for (float value : *row)
+        writeFloat(value);
+    }
+    break;
+  }
+  }
+}
+
+void
+LibertyCacheWriter::writeAxis(const TableAxis *axis)
+{
+  writeU8(static_cast<uint8_t>(axis->variable()));
+  const FloatSeq *values = axis->values();
+  writeU32(values->size());
+  for (float value : *values)
+    writeFloat(value);
+}
+
+void
+LibertyCacheWriter::writeInternalPower(const InternalPower *power)
+{
+  writeString(power->port()->name());
+  const LibertyPort *related_port = power->relatedPort();
+  writeString(related_port ? related_port->name() : "");
+  writeFuncExpr(power->when());
+  writeString(power->relatedPgPin());
+  for (const RiseFall *rf : RiseFall::range()) {
+    const InternalPowerModel *model = power->model(rf);
+    writeBool(model != nullptr && model->model() != nullptr);
+    if (model && model->model())
+      writeTableModel(model->model());
+  }
+}
+
+void
+LibertyCacheWriter::writeFuncExpr(const FuncExpr *expr)
+{
+  if (expr)
+    writeString(expr->to_string().c_str());
+  else
+    writeString("");
+}
+
+void
+LibertyCacheWriter::writeBool(bool value)
+{
+  writeU8(value ? 1 : 0);
+}
+
+void
+LibertyCacheWriter::writeU8(uint8_t value)
+{
+  out_.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void
+LibertyCacheWriter::writeU32(uint32_t value)
+{
+  out_.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void
+LibertyCacheWriter::writeU64(uint64_t value)
+{
+  out_.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void
+LibertyCacheWriter::writeI32(int32_t value)
+{
+  out_.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void
+LibertyCacheWriter::writeFloat(float value)
+{
+  out_.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void
+LibertyCacheWriter::writeFloatBool(float value,
+                                   bool exists)
+{
+  writeBool(exists);
+  writeFloat(exists ? value : 0.0);
+}
+
+void
+LibertyCacheWriter::writeString(const char *str)
+{
+  uint32_t length = str ? strlen(str) : 0;
+  writeU32(length);
+  if (length)
+    out_.write(str, length);
+}
+
+bool
+writeLibertyCache(const LibertyLibrary *library,
+                  const char *filename,
+                  Report *report)
+{
+  LibertyCacheWriter writer(library, filename, report);
+  return writer.write();
+}
+
+////////////////////////////////////////////////////////////////
+//
+// Reader
+//
+////////////////////////////////////////////////////////////////
+
+// Thrown on malformed or truncated cache files.
+struct LibertyCacheError {};
+
+class LibertyCacheReader
+{
+public:
+  LibertyCacheReader(const char *filename,
+                     Network *network);
+  ~LibertyCacheReader();
+  LibertyLibrary *read();
+
+private:
+  bool mapFile(const char *cache_filename);
+  void unmapFile();
+  bool checkHeader();
+  void readLibrary();
+  void readUnit(Unit *unit);
+  void readCell();
+  void readPortAttrs(LibertyPort *port);
+  void readArcSet(LibertyCell *cell);
+  TimingModel *readTimingModel(LibertyCell *cell);
+  TableModel *readTableModel();
+  TableModel *readOptTableModel();
+  TablePtr readTable();
+  TableAxisPtr readAxis();
+  void readInternalPower(LibertyCell *cell);
+  FuncExpr *readFuncExpr(LibertyCell *cell);
+
+  bool readBool();
+  uint8_t readU8();
+  uint32_t readU32();
+  uint64_t readU64();
+  int32_t readI32();
+  float readFloat();
+  void readFloatBool(float &value,
+                     bool &exists);
+  string readString();
+  FloatSeq *readFloatSeq();
+
+  const char *filename_;
+  Network *network_;
+  Report *report_;
+  LibertyBuilder builder_;
+  LibertyLibrary *library_;
+  Map<string, TableTemplate*> template_map_;
+
+  const char *data_;
+  const char *cursor_;
+  const char *end_;
+  size_t map_length_;
+#ifndef _WIN32
+  int fd_;
+#endif
+};
+
+LibertyCacheReader::LibertyCacheReader(const char *filename,
+                                       Network *network) :
+  filename_(filename),
+  network_(network),
+  report_(network->report()),
+  library_(nullptr),
+  data_(nullptr),
+  cursor_(nullptr),
+  end_(nullptr),
+  map_length_(0)
+#ifndef _WIN32
+  , fd_(-1)
+#endif
+{
+  builder_.init(network->debug(), report_);
+}
+
+LibertyCacheReader::~LibertyCacheReader()
+{
+  unmapFile();
+}
+
+LibertyLibrary *
+LibertyCacheReader::read()
+{
+  string cache_filename = libertyCacheFilename(filename_);
+  if (!mapFile(cache_filename.c_str()))
+    return nullptr;
+  try {
+    if (!checkHeader())
+      return nullptr;
+    readLibrary();
+    return library_;
+  }
+  catch (LibertyCacheError &) {
+    report_->warn(2312, "liberty cache file %s is corrupt; ignored.",
+                  cache_filename.c_str());
+    NetworkReader *network_reader = dynamic_cast<NetworkReader*>(network_);
+    if (library_ && network_reader) {
+      network_reader->deleteLibrary(reinterpret_cast<Library*>(library_));
+      library_ = nullptr;
+    }
+    return nullptr;
+  }
+}
+
+bool
+LibertyCacheReader::mapFile(const char *cache_filename)
+{
+#ifndef _WIN32
+  fd_ = open(cache_filename, O_RDONLY);
+  if (fd_ < 0)
+    return false;
+  struct stat sbuf;
+  if (fstat(fd_, &sbuf) != 0
+      || sbuf.st_size == 0) {
+    close(fd_);
+    fd_ = -1;
+    return false;
+  }
+  map_length_ = sbuf.st_size;
+  void *map = mmap(nullptr, map_length_, PROT_READ, MAP_PRIVATE, fd_, 0);
+  if (map == MAP_FAILED) {
+    close(fd_);
+    fd_ = -1;
+    return false;
+  }
+  data_ = static_cast<const char*>(map);
+#else
+  std::ifstream in(cache_filename, std::ios::binary | std::ios::ate);
+  if (!in.is_open())
+    return false;
+  map_length_ = in.tellg();
+  in.seekg(0);
+  char *buffer = new char[map_length_];
+  in.read(buffer, map_length_);
+  if (in.fail()) {
+    delete [] buffer;
+    return false;
+  }
+  data_ = buffer;
+#endif
+  cursor_ = data_;
+  end_ = data_ + map_length_;
+  return true;
+}
+
+void
+LibertyCacheReader::unmapFile()
+{
+#ifndef _WIN32
+  if (data_) {
+    munmap(const_cast<char*>(data_), map_length_);
+    close(fd_);
+    fd_ = -1;
+  }
+#else
+  delete [] data_;
+#endif
+  data_ = cursor_ = end_ = nullptr;
+}
+
+bool
+LibertyCacheReader::checkHeader()
+{
+  if (readU32() != cache_magic
+      || readU32() != cache_format_version)
+    return false;
+  uint64_t cached_size = readU64();
+  uint64_t cached_mtime = readU64();
+  uint64_t src_size, src_mtime;
+  return sourceFileStats(filename_, src_size, src_mtime)
+    && src_size == cached_size
+    && src_mtime == cached_mtime;
+}
+
+void
+LibertyCacheReader::readLibrary()
+{
+  string name = readString();
+  library_ = network_->makeLibertyLibrary(name.c_str(), filename_);
+  library_->setDelayModelType(static_cast<DelayModelType>(readU8()));
+
+  Units *units = library_->units();
+  readUnit(units->timeUnit());
+  readUnit(units->resistanceUnit());
+  readUnit(units->capacitanceUnit());
+  readUnit(units->voltageUnit());
+  readUnit(units->currentUnit());
+  readUnit(units->powerUnit());
+  readUnit(units->distanceUnit());
+  readUnit(units->scalarUnit());
+
+  library_->setNominalProcess(readFloat());
+  library_->setNominalVoltage(readFloat());
+  library_->setNominalTemperature(readFloat());
+
+  for (const RiseFall *rf : RiseFall::range()) {
+    library_->setInputThreshold(rf, readFloat());
+    library_->setOutputThreshold(rf, readFloat());
+    library_->setSlewLowerThreshold(rf, readFloat());
+    library_->setSlewUpperThreshold(rf, readFloat());
+  }
+  library_->setSlewDerateFromLibrary(readFloat());
+
+  library_->setDefaultInputPinCap(readFloat());
+  library_->setDefaultOutputPinCap(readFloat());
+  library_->setDefaultBidirectPinCap(readFloat());
+
+  float value;
+  bool exists;
+  for (const RiseFall *rf : RiseFall::range()) {
+    readFloatBool(value, exists);
+    if (exists)
+      library_->setDefaultIntrinsic(rf, value);
+  }
+  for (const RiseFall *rf : RiseFall::range()) {
+    readFloatBool(value, exists);
+    if (exists)
+      library_->setDefaultBidirectPinRes(rf, value);
+  }
+  for (const RiseFall *rf : RiseFall::range()) {
+    readFloatBool(value, exists);
+    if (exists)
+      library_->setDefaultOutputPinRes(rf, value);
+  }
+  readFloatBool(value, exists);
+  if (exists)
+    library_->setDefaultFanoutLoad(value);
+  readFloatBool(value, exists);
+  if (exists)
+    library_->setDefaultMaxSlew(value);
+  readFloatBool(value, exists);
+  if (exists)
+    library_->setDefaultMaxCapacitance(value);
+  readFloatBool(value, exists);
+  if (exists)
+    library_->setDefaultMaxFanout(value);
+  library_->setOcvArcDepth(readFloat());
+
+  uint32_t supply_count = readU32();
+  for (uint32_t i = 0; i < supply_count; i++) {
+    string supply_name = readString();
+    float voltage = readFloat();
+    library_->addSupplyVoltage(supply_name.c_str(), voltage);
+  }
+
+  uint32_t bus_dcl_count = readU32();
+  for (uint32_t i = 0; i < bus_dcl_count; i++) {
+    string bus_name = readString();
+    int from = readI32();
+    int to = readI32();
+    library_->addBusDcl(new BusDcl(bus_name.c_str(), from, to));
+  }
+
+  uint32_t op_cond_count = readU32();
+  for (uint32_t i = 0; i < op_cond_count; i++) {
+    string op_cond_name = readString();
+    float process = readFloat();
+    float voltage = readFloat();
+    float temperature = readFloat();
+    WireloadTree tree = static_cast<WireloadTree>(readU8());
+    library_->addOperatingConditions(new OperatingConditions(op_cond_name.c_str(),
+                                                             process, voltage,
+                                                             temperature, tree));
+  }
+  if (readBool()) {
+    string default_op_cond_name = readString();
+    OperatingConditions *op_cond =
+      library_->findOperatingConditions(default_op_cond_name.c_str());
+    if (op_cond)
+      library_->setDefaultOperatingConditions(op_cond);
+  }
+
+  uint32_t cell_count = readU32();
+  for (uint32_t i = 0; i < cell_count; i++)
+    readCell();
+}
+
+void
+LibertyCacheReader::readUnit(Unit *unit)
+{
+  unit->setScale(readFloat());
+  unit->setSuffix(readString().c_str());
+  unit->setDigits(readU32());
+}
+
+void
+LibertyCacheReader::readCell()
+{
+  string name = readString();
+  LibertyCell *cell = builder_.makeCell(library_, name.c_str(), filename_);
+  cell->setArea(readFloat());
+  float leakage;
+  bool leakage_exists;
+  readFloatBool(leakage, leakage_exists);
+  if (leakage_exists)
+    cell->setLeakagePower(leakage);
+  string footprint = readString();
+  if (!footprint.empty())
+    cell->setFootprint(footprint.c_str());
+  string user_function_class = readString();
+  if (!user_function_class.empty())
+    cell->setUserFunctionClass(user_function_class.c_str());
+
+  uint32_t flags = readU32();
+  cell->setDontUse(flags & (1 << 0));
+  cell->setIsMacro(flags & (1 << 1));
+  cell->setIsMemory(flags & (1 << 2));
+  cell->setIsPad(flags & (1 << 3));
+  cell->setIsClockCell(flags & (1 << 4));
+  cell->setIsLevelShifter(flags & (1 << 5));
+  cell->setIsIsolationCell(flags & (1 << 6));
+  cell->setAlwaysOn(flags & (1 << 7));
+  cell->setInterfaceTiming(flags & (1 << 8));
+  cell->setIsDisabledConstraint(flags & (1 << 9));
+  cell->setLevelShifterType(static_cast<LevelShifterType>(readU8()));
+  cell->setSwitchCellType(static_cast<SwitchCellType>(readU8()));
+  switch (readU8()) {
+  case 1:
+    cell->setClockGateType(ClockGateType::latch_posedge);
+    break;
+  case 2:
+    cell->setClockGateType(ClockGateType::latch_negedge);
+    break;
+  case 3:
+    cell->setClockGateType(ClockGateType::other);
+    break;
+  }
+  cell->setOcvArcDepth(readFloat());
+
+  uint32_t port_count = readU32();
+  LibertyPortSeq top_ports;
+  for (uint32_t i = 0; i < port_count; i++) {
+    string port_name = readString();
+    bool is_bus = readBool();
+    int from_index = readI32();
+    int to_index = readI32();
+    string bus_dcl_name = readString();
+    LibertyPort *port;
+    if (is_bus) {
+      BusDcl *bus_dcl = bus_dcl_name.empty()
+        ? nullptr
+        : library_->findBusDcl(bus_dcl_name.c_str());
+      port = builder_.makeBusPort(cell, port_name.c_str(),
+                                  from_index, to_index, bus_dcl);
+    }
+    else
+      port = builder_.makePort(cell, port_name.c_str());
+    top_ports.push_back(port);
+  }
+
+  uint32_t attrs_count = readU32();
+  uint32_t attrs_read = 0;
+  for (LibertyPort *port : top_ports) {
+    readPortAttrs(port);
+    attrs_read++;
+    if (port->isBus()) {
+      LibertyPortMemberIterator member_iter(port);
+      while (member_iter.hasNext()) {
+        readPortAttrs(member_iter.next());
+        attrs_read++;
+      }
+    }
+  }
+  if (attrs_read != attrs_count)
+    throw LibertyCacheError();
+
+  uint32_t arc_set_count = readU32();
+  for (uint32_t i = 0; i < arc_set_count; i++)
+    readArcSet(cell);
+
+  uint32_t internal_power_count = readU32();
+  for (uint32_t i = 0; i < internal_power_count; i++)
+    readInternalPower(cell);
+
+  uint32_t leakage_count = readU32();
+  for (uint32_t i = 0; i < leakage_count; i++) {
+    LeakagePowerAttrs attrs;
+    attrs.setWhen(readFuncExpr(cell));
+    attrs.setPower(readFloat());
+    builder_.makeLeakagePower(cell, &attrs);
+  }
+
+  cell->finish(false, report_, network_->debug());
+}
+
+void
+LibertyCacheReader::readPortAttrs(LibertyPort *port)
+{
+  string direction = readString();
+  port->setDirection(PortDirection::find(direction.c_str()));
+  FuncExpr *function = readFuncExpr(port->libertyCell());
+  if (function)
+    port->setFunction(function);
+  FuncExpr *tristate_enable = readFuncExpr(port->libertyCell());
+  if (tristate_enable)
+    port->setTristateEnable(tristate_enable);
+
+  float value;
+  bool exists;
+  for (const RiseFall *rf : RiseFall::range()) {
+    for (const MinMax *min_max : MinMax::range()) {
+      readFloatBool(value, exists);
+      if (exists)
+        port->setCapacitance(rf, min_max, value);
+    }
+  }
+  for (const MinMax *min_max : MinMax::range()) {
+    readFloatBool(value, exists);
+    if (exists)
+      port->setSlewLimit(value, min_max);
+  }
+  for (const MinMax *min_max : MinMax::range()) {
+    readFloatBool(value, exists);
+    if (exists)
+      port->setCapacitanceLimit(value, min_max);
+  }
+  for (const MinMax *min_max : MinMax::range()) {
+    readFloatBool(value, exists);
+    if (exists)
+      port->setFanoutLimit(value, min_max);
+  }
+  readFloatBool(value, exists);
+  if (exists)
+    port->setFanoutLoad(value);
+  readFloatBool(value, exists);
+  if (exists)
+    port->setMinPeriod(value);
+  for (const RiseFall *rf : RiseFall::range()) {
+    readFloatBool(value, exists);
+    if (exists)
+      port->setMinPulseWidth(rf, value);
+  }
+
+  uint32_t flags = readU32();
+  port->setIsClock(flags & (1 << 0));
+  port->setIsClockGateClock(flags & (1 << 1));
+  port->setIsClockGateEnable(flags & (1 << 2));
+  port->setIsClockGateOut(flags & (1 << 3));
+  port->setIsPllFeedback(flags & (1 << 4));
+  port->setIsolationCellData(flags & (1 << 5));
+  port->setIsolationCellEnable(flags & (1 << 6));
+  port->setLevelShifterData(flags & (1 << 7));
+  port->setIsSwitch(flags & (1 << 8));
+  port->setIsDisabledConstraint(flags & (1 << 9));
+  port->setIsPad(flags & (1 << 10));
+
+  int pulse_trigger_index = readI32();
+  int pulse_sense_index = readI32();
+  if (pulse_trigger_index >= 0 && pulse_sense_index >= 0)
+    port->setPulseClk(RiseFall::find(pulse_trigger_index),
+                      RiseFall::find(pulse_sense_index));
+  port->setScanSignalType(static_cast<ScanSignalType>(readU8()));
+  port->setPwrGndType(static_cast<PwrGndType>(readU8()));
+  string voltage_name = readString();
+  if (!voltage_name.empty())
+    port->setVoltageName(voltage_name.c_str());
+  string related_ground_pin = readString();
+  if (!related_ground_pin.empty())
+    port->setRelatedGroundPin(related_ground_pin.c_str());
+  string related_power_pin = readString();
+  if (!related_power_pin.empty())
+    port->setRelatedPowerPin(related_power_pin.c_str());
+}
+
+void
+LibertyCacheReader::readArcSet(LibertyCell *cell)
+{
+  string from_name = readString();
+  string to_name = readString();
+  string related_out_name = readString();
+  LibertyPort *from = cell->findLibertyPort(from_name.c_str());
+  LibertyPort *to = cell->findLibertyPort(to_name.c_str());
+  LibertyPort *related_out = related_out_name.empty()
+    ? nullptr
+    : cell->findLibertyPort(related_out_name.c_str());
+  if (from == nullptr || to == nullptr)
+    throw LibertyCacheError();
+
+  TimingArcAttrsPtr attrs = std::make_shared<TimingArcAttrs>();
+  attrs->setTimingType(static_cast<TimingType>(readU8()));
+  attrs->setTimingSense(static_cast<TimingSense>(readU8()));
+  FuncExpr *cond = readFuncExpr(cell);
+  if (cond)
+    attrs->setCond(cond);
+  string sdf_cond = readString();
+  if (!sdf_cond.empty())
+    attrs->setSdfCond(sdf_cond.c_str());
+  string sdf_cond_start = readString();
+  if (!sdf_cond_start.empty())
+    attrs->setSdfCondStart(sdf_cond_start.c_str());
+  string sdf_cond_end = readString();
+  if (!sdf_cond_end.empty())
+    attrs->setSdfCondEnd(sdf_cond_end.c_str());
+  attrs->setOcvArcDepth(readFloat());
+
+  for (const RiseFall *rf : RiseFall::range()) {
+    TimingModel *model = readTimingModel(cell);
+    if (model)
+      attrs->setModel(rf, model);
+  }
+  builder_.makeTimingArcs(cell, from, to, related_out, attrs, 0);
+}
+
+TimingModel *
+LibertyCacheReader::readTimingModel(LibertyCell *cell)
+{
+  uint8_t kind = readU8();
+  switch (kind) {
+  case 0:
+    return nullptr;
+  case 1: {
+    TableModel *delay_model = readTableModel();
+    TableModel *delay_sigma_models[EarlyLate::index_count];
+    for (int el_index : EarlyLate::rangeIndex())
+      delay_sigma_models[el_index] = readOptTableModel();
+    TableModel *slew_model = readTableModel();
+    TableModel *slew_sigma_models[EarlyLate::index_count];
+    for (int el_index : EarlyLate::rangeIndex())
+      slew_sigma_models[el_index] = readOptTableModel();
+    return new GateTableModel(cell, delay_model, delay_sigma_models,
+                              slew_model, slew_sigma_models,
+                              nullptr, nullptr);
+  }
+  case 2: {
+    TableModel *model = readTableModel();
+    TableModel *sigma_models[EarlyLate::index_count];
+    for (int el_index : EarlyLate::rangeIndex())
+      sigma_models[el_index] = readOptTableModel();
+    return new CheckTableModel(cell, model, sigma_models);
+  }
+  default:
+    throw LibertyCacheError();
+  }
+}
+
+TableModel *
+LibertyCacheReader::readOptTableModel()
+{
+  if (readBool())
+    return readTableModel();
+  return nullptr;
+}
+
+TableModel *
+LibertyCacheReader::readTableModel()
+{
+  TableTemplate *tbl_template = nullptr;
+  if (readBool()) {
+    string template_name = readString();
+    if (!template_map_.findKey(template_name)) {
+      tbl_template = new TableTemplate(template_name.c_str());
+      library_->addTableTemplate(tbl_template, TableTemplateType::delay);
+      template_map_[template_name] = tbl_template;
+    }
+    else
+      tbl_template = template_map_[template_name];
+  }
+  ScaleFactorType scale_factor_type = static_cast<ScaleFactorType>(readU8());
+  const RiseFall *rf = RiseFall::find(readU8());
+  TablePtr table = readTable();
+  return new TableModel(table, tbl_template, scale_factor_type, rf);
+}
+
+TablePtr
+LibertyCacheReader::readTable()
+{
+  uint8_t order = readU8();
+  switch (order) {
+  case 0:
+    return std::make_shared<Table0>(readFloat());
+  case 1: {
+    TableAxisPtr axis1 = readAxis();
+    FloatSeq *values = readFloatSeq();
+    return std::make_shared<Table1>(values, axis1);
+  }
+  case 2:
+  case 3: {
+    TableAxisPtr axis1 = readAxis();
+    TableAxisPtr axis2 = readAxis();
+    TableAxisPtr axis3 = (order == 3) ? readAxis() : nullptr;
+    uint32_t row_count = readU32();
+    FloatTable *values = new FloatTable;
+    values->reserve(row_count);
+    for (uint32_t i = 0; i < row_count; i++)
+      values->push_back(readFloatSeq());
+    if (order == 3)
+      return std::make_shared<Table3>(values, axis1, axis2, axis3);
+    return std::make_shared<Table2>(values, axis1, axis2);
+  }
+  default:
+    throw LibertyCacheError();
+  }
+}
+
+TableAxisPtr
+LibertyCacheReader::readAxis()
+{
+  TableAxisVariable variable = static_cast<TableAxisVariable>(readU8());
+  FloatSeq *values = readFloatSeq();
+  return std::make_shared<TableAxis>(variable, values);
+}
+
+void
+LibertyCacheReader::readInternalPower(LibertyCell *cell)
+{
+  string port_name = readString();
+  string related_port_name = readString();
+  LibertyPort *port = cell->findLibertyPort(port_name.c_str());
+  LibertyPort *related_port = related_port_name.empty()
+    ? nullptr
+    : cell->findLibertyPort(related_port_name.c_str());
+  if (port == nullptr)
+    throw LibertyCacheError();
+
+  InternalPowerAttrs *attrs = new InternalPowerAttrs;
+  FuncExpr *when = readFuncExpr(cell);
+  if (when)
+    attrs->setWhen(when);
+  string related_pg_pin = readString();
+  if (!related_pg_pin.empty())
+    attrs->setRelatedPgPin(related_pg_pin.c_str());
+  for (const RiseFall *rf : RiseFall::range()) {
+    if (readBool())
+      attrs->setModel(rf, new InternalPowerModel(readTableModel()));
+  }
+  builder_.makeInternalPower(cell, port, related_port, attrs);
+  cell->addInternalPowerAttrs(attrs);
+}
+
+FuncExpr *
+LibertyCacheReader::readFuncExpr(LibertyCell *cell)
+{
+  string expr = readString();
+  if (expr.empty())
+    return nullptr;
+  return parseFuncExpr(expr.c_str(), cell, "liberty cache function", report_);
+}
+
+bool
+LibertyCacheReader::readBool()
+{
+  return readU8() != 0;
+}
+
+uint8_t
+LibertyCacheReader::readU8()
+{
+  if (cursor_ + sizeof(uint8_t) > end_)
+    throw LibertyCacheError();
+  uint8_t value;
+  memcpy(&value, cursor_, sizeof(value));
+  cursor_ += sizeof(value);
+  return value;
+}
+
+uint32_t
+LibertyCacheReader::readU32()
+{
+  if (cursor_ + sizeof(uint32_t) > end_)
+    throw LibertyCacheError();
+  uint32_t value;
+  memcpy(&value, cursor_, sizeof(value));
+  cursor_ += sizeof(value);
+  return value;
+}
+
+uint64_t
+LibertyCacheReader::readU64()
+{
+  if (cursor_ + sizeof(uint64_t) > end_)
+    throw LibertyCacheError();
+  uint64_t value;
+  memcpy(&value, cursor_, sizeof(value));
+  cursor_ += sizeof(value);
+  return value;
+}
+
+int32_t
+LibertyCacheReader::readI32()
+{
+  if (cursor_ + sizeof(int32_t) > end_)
+    throw LibertyCacheError();
+  int32_t value;
+  memcpy(&value, cursor_, sizeof(value));
+  cursor_ += sizeof(value);
+  return value;
+}
+
+float
+LibertyCacheReader::readFloat()
+{
+  if (cursor_ + sizeof(float) > end_)
+    throw LibertyCacheError();
+  float value;
+  memcpy(&value, cursor_, sizeof(value));
+  cursor_ += sizeof(value);
+  return value;
+}
+
+void
+LibertyCacheReader::readFloatBool(float &value,
+                                  bool &exists)
+{
+  exists = readBool();
+  value = readFloat();
+}
+
+string
+LibertyCacheReader::readString()
+{
+  uint32_t length = readU32();
+  if (cursor_ + length > end_)
+    throw LibertyCacheError();
+  string str(cursor_, length);
+  cursor_ += length;
+  return str;
+}
+
+FloatSeq *
+LibertyCacheReader::readFloatSeq()
+{
+  uint32_t count = readU32();
+  if (cursor_ + count * sizeof(float) > end_)
+    throw LibertyCacheError();
+  FloatSeq *values = new FloatSeq(count);
+  memcpy(values->data(), cursor_, count * sizeof(float));
+  cursor_ += count * sizeof(float);
+  return values;
+}
+
+LibertyLibrary *
+readLibertyCache(const char *filename,
+                 Network *network)
+{
+  LibertyCacheReader reader(filename, network);
+  return reader.read();
+}
+
+} // namespace
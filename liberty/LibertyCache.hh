@@ -0,0 +1,67 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2025, Parallax Software, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+//
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// This notice may not be removed or altered from any source distribution.
+
+#pragma once
+
+#include <string>
+
+namespace sta {
+
+class LibertyLibrary;
+class Network;
+class Report;
+
+// Compiled binary cache for liberty libraries.
+//
+// After a library is parsed the object graph can be saved to a
+// versioned binary cache file next to the source file.  Subsequent
+// reads memory map the cache and reconstruct the library without
+// running the liberty parser.  The cache is invalidated by the source
+// file size/modification time and by the cache format version.
+//
+// The cache covers the library/cell/port/timing arc/table model and
+// power subset used by timing and power analysis.  Libraries that use
+// constructs outside that subset (sequential cells, statetables,
+// ccs/ecsm waveforms, wireload models, scaled cells or ocv derating)
+// are not cached and fall back to the liberty parser.
+
+// Cache file path for a liberty file.
+std::string
+libertyCacheFilename(const char *filename);
+
+// Write a cache file for library, read from filename.
+// Returns false if the library is not representable in the cache format.
+bool
+writeLibertyCache(const LibertyLibrary *library,
+                  const char *filename,
+                  Report *report);
+
+// Reconstruct a library from the cache file for filename.
+// Returns nullptr if the cache file is missing, stale, corrupt or
+// written by a different cache format version.
+LibertyLibrary *
+readLibertyCache(const char *filename,
+                 Network *network);
+
+} // namespace
@@ -29,6 +29,8 @@
 #include <regex>
 
 #include "Zlib.hh"
+#include "GzPipeStream.hh"
+#include "MappedFile.hh"
 #include "Report.hh"
 #include "Error.hh"
 #include "StringUtil.hh"
@@ -38,20 +40,37 @@ namespace sta {
 
 using std::string;
 
+static void
+parseLibertyStream(std::istream &stream,
+                   const char *filename,
+                   LibertyGroupVisitor *library_visitor,
+                   Report *report)
+{
+  LibertyParser reader(filename, library_visitor, report);
+  LibertyScanner scanner(&stream, filename, &reader, report);
+  LibertyParse parser(&scanner, &reader);
+  parser.parse();
+}
+
 void
 parseLibertyFile(const char *filename,
 		 LibertyGroupVisitor *library_visitor,
 		 Report *report)
 {
-  gzstream::igzstream stream(filename);
-  if (stream.is_open()) {
-    LibertyParser reader(filename, library_visitor, report);
-    LibertyScanner scanner(&stream, filename, &reader, report);
-    LibertyParse parser(&scanner, &reader);
-    parser.parse();
+  if (isCompressed(filename)) {
+    // Decompress on a background thread while the parser consumes.
+    GzPipeStream stream(filename);
+    if (!stream.is_open())
+      throw FileNotReadable(filename);
+    parseLibertyStream(stream, filename, library_visitor, report);
+  }
+  else {
+    // Lex uncompressed files directly over a memory mapping.
+    MappedFileStream stream(filename);
+    if (!stream.is_open())
+      throw FileNotReadable(filename);
+    parseLibertyStream(stream, filename, library_visitor, report);
   }
-  else
-    throw FileNotReadable(filename);
 }
 
 LibertyParser::LibertyParser(const char *filename,
@@ -264,6 +283,14 @@ LibertyGroup::LibertyGroup(const char *type,
 {
 }
 
+LibertyGroupSeq *
+LibertyGroup::takeSubgroups()
+{
+  LibertyGroupSeq *subgroups = subgroups_;
+  subgroups_ = nullptr;
+  return subgroups;
+}
+
 void
 LibertyGroup::addSubgroup(LibertyGroup *subgroup)
 {
@@ -509,8 +536,12 @@ LibertyScanner::includeBegin()
     std::cmatch matches;
     if (std::regex_match(yytext, matches, include_regexp)) {
       string filename = matches[1].str();
-      gzstream::igzstream *stream = new gzstream::igzstream(filename.c_str());
-      if (stream->is_open()) {
+      std::istream *stream;
+      if (isCompressed(filename.c_str()))
+        stream = new GzPipeStream(filename.c_str());
+      else
+        stream = new MappedFileStream(filename.c_str());
+      if (stream->good()) {
         yypush_buffer_state(yy_create_buffer(stream, 256));
 
         filename_prev_ = filename_;
@@ -137,6 +137,9 @@ public:
   void addAttribute(LibertyAttr *attr);
   void addVariable(LibertyVariable *var);
   LibertyGroupSeq *subgroups() const { return subgroups_; }
+  // Transfer ownership of the subgroups to the caller
+  // (lazy cell elaboration).
+  LibertyGroupSeq *takeSubgroups();
   LibertyAttrSeq *attrs() const { return attrs_; }
   LibertyAttrValueSeq *params() const { return params_; }
 
@@ -66,8 +66,31 @@ readLibertyFile(const char *filename,
 		bool infer_latches,
 		Network *network)
 {
-  LibertyReader reader(filename, infer_latches, network);
-  return reader.readLibertyFile(filename);
+  return readLibertyFile(filename, infer_latches, false, network);
+}
+
+LibertyLibrary *
+readLibertyFile(const char *filename,
+		bool infer_latches,
+		bool lazy_cells,
+		Network *network)
+{
+  if (lazy_cells) {
+    // The reader stays alive as the library cell elaborator.
+    LibertyReader *reader = new LibertyReader(filename, infer_latches,
+                                              network);
+    reader->setLazyCells(true);
+    LibertyLibrary *library = reader->readLibertyFile(filename);
+    if (library)
+      library->setCellElaborator(reader);
+    else
+      delete reader;
+    return library;
+  }
+  else {
+    LibertyReader reader(filename, infer_latches, network);
+    return reader.readLibertyFile(filename);
+  }
 }
 
 LibertyReader::LibertyReader(const char *filename,
@@ -84,8 +107,13 @@ LibertyReader::init(const char *filename,
                     bool infer_latches,
                     Network *network)
 {
-  filename_ = filename;
+  // Copy the filename; lazy cell elaboration outlives the caller's string.
+  filename_ = stringCopy(filename);
   infer_latches_ = infer_latches;
+  lazy_cells_ = false;
+  elaborating_ = false;
+  lazy_depth_ = 0;
+  lazy_cell_save_ = false;
   report_ = network->report();
   debug_ = network->debug();
   network_ = network;
@@ -141,6 +169,14 @@ LibertyReader::init(const char *filename,
 LibertyReader::~LibertyReader()
 {
   delete var_map_;
+  lazy_cell_groups_.deleteContents();
+  stringDelete(filename_);
+}
+
+void
+LibertyReader::setLazyCells(bool lazy)
+{
+  lazy_cells_ = lazy;
 }
 
 LibertyLibrary *
@@ -619,6 +655,9 @@ LibertyReader::defineScalingFactorVisitors()
 void
 LibertyReader::visitAttr(LibertyAttr *attr)
 {
+  // Deferred cell attributes are saved and visited at elaboration.
+  if (lazy_depth_ > 0)
+    return;
   LibraryAttrVisitor visitor = attr_visitor_map_.findKey(attr->name());
   if (visitor)
     (this->*visitor)(attr);
@@ -627,6 +666,19 @@ LibertyReader::visitAttr(LibertyAttr *attr)
 void
 LibertyReader::begin(LibertyGroup *group)
 {
+  if (lazy_depth_ > 0) {
+    lazy_depth_++;
+    return;
+  }
+  if (lazy_cells_
+      && !elaborating_
+      && library_
+      && stringEq(group->type(), "cell")) {
+    // Defer the cell; the parse tree is saved and replayed on first
+    // reference by elaborateCell.
+    lazy_depth_ = 1;
+    return;
+  }
   LibraryGroupVisitor visitor = group_begin_map_.findKey(group->type());
   if (visitor)
     (this->*visitor)(group);
@@ -635,11 +687,114 @@ LibertyReader::begin(LibertyGroup *group)
 void
 LibertyReader::end(LibertyGroup *group)
 {
+  if (lazy_depth_ > 1) {
+    lazy_depth_--;
+    return;
+  }
+  if (lazy_depth_ == 1) {
+    endLazyCell(group);
+    lazy_depth_ = 0;
+    return;
+  }
   LibraryGroupVisitor visitor = group_end_map_.findKey(group->type());
   if (visitor)
     (this->*visitor)(group);
 }
 
+void
+LibertyReader::endLazyCell(LibertyGroup *group)
+{
+  const char *name = group->firstName();
+  if (name) {
+    debugPrint(debug_, "liberty", 1, "defer cell %s", name);
+    LibertyGroup *prev = lazy_cell_groups_.findKey(name);
+    if (prev)
+      // Redefined cell; the stale pointer in the parse tree is
+      // discarded with the container by endLibrary.
+      delete prev;
+    lazy_cell_groups_[name] = group;
+    // Tell save(LibertyGroup*) to keep the parse tree.
+    lazy_cell_save_ = true;
+  }
+  else
+    libWarn(2313, group, "cell missing name.");
+}
+
+bool
+LibertyReader::save(LibertyGroup *)
+{
+  if (lazy_cell_save_) {
+    lazy_cell_save_ = false;
+    return true;
+  }
+  return lazy_depth_ > 0;
+}
+
+bool
+LibertyReader::save(LibertyAttr *)
+{
+  return lazy_depth_ > 0;
+}
+
+LibertyCell *
+LibertyReader::elaborateCell(const char *cell_name)
+{
+  LibertyGroup *group = lazy_cell_groups_.findKey(cell_name);
+  if (group == nullptr)
+    return nullptr;
+  lazy_cell_groups_.erase(cell_name);
+  debugPrint(debug_, "liberty", 1, "elaborate cell %s", cell_name);
+  bool elaborating_prev = elaborating_;
+  elaborating_ = true;
+  visitLazyGroup(group);
+  elaborating_ = elaborating_prev;
+  delete group;
+  LibertyCell *cell = library_->findLibertyCell(cell_name);
+  if (cell)
+    cornerMapLazyCell(cell);
+  return cell;
+}
+
+// Replay a saved parse tree through the visitors.
+// Attributes are visited before subgroups, which matches the
+// conventional liberty ordering within a group.
+void
+LibertyReader::visitLazyGroup(LibertyGroup *group)
+{
+  begin(group);
+  if (group->attrs()) {
+    for (LibertyAttr *attr : *group->attrs())
+      visitAttr(attr);
+  }
+  if (group->subgroups()) {
+    for (LibertyGroup *subgroup : *group->subgroups())
+      visitLazyGroup(subgroup);
+  }
+  end(group);
+}
+
+// Corner mapping normally happens as each library is read
+// (Sta::readLibertyAfter); map lazy cells when they are elaborated.
+void
+LibertyReader::cornerMapLazyCell(LibertyCell *cell)
+{
+  const char *name = cell->name();
+  LibertyCell *link_cell = network_->findLibertyCell(name);
+  if (link_cell) {
+    for (int ap_index : library_->cornerMapIndices())
+      LibertyLibrary::makeCornerMap(link_cell, cell, ap_index, report_);
+    // Elaborate matching cells in other lazy libraries so their
+    // corner maps are made.
+    LibertyLibraryIterator *lib_iter = network_->libertyLibraryIterator();
+    while (lib_iter->hasNext()) {
+      LibertyLibrary *lib = lib_iter->next();
+      if (lib != library_ && lib->cellElaborator())
+        lib->findLibertyCell(name);
+    }
+    delete lib_iter;
+  }
+}
+
 void
 LibertyReader::beginLibrary(LibertyGroup *group)
 {
@@ -694,6 +849,11 @@ void
 LibertyReader::endLibrary(LibertyGroup *group)
 {
   endLibraryAttrs(group);
+  if (lazy_cells_)
+    // The saved cell groups are owned by lazy_cell_groups_;
+    // discard the parse tree's container before the parser deletes
+    // the library group.
+    delete group->takeSubgroups();
 }
 
 void
@@ -1465,7 +1625,7 @@ LibertyReader::makeAxis(int index,
       float scale = tableVariableUnit(axis_var, units)->scale();
       scaleFloats(axis_values, scale);
     }
-    return make_shared<TableAxis>(axis_var, axis_values);
+    return internTableAxis(make_shared<TableAxis>(axis_var, axis_values));
   }
   else if (axis_values) {
     libWarn(1176, group, "missing variable_%d attribute.", index + 1);
@@ -4722,7 +4882,8 @@ LibertyReader::makeTable(LibertyAttr *attr,
       FloatTable *table = makeFloatTable(attr,
 					 axis_[0]->size()*axis_[1]->size(),
 					 axis_[2]->size(), scale);
-      table_ = make_shared<Table3>(table, axis_[0], axis_[1], axis_[2]);
+      table_ = internTable(make_shared<Table3>(table, axis_[0], axis_[1],
+					       axis_[2]));
     }
     else if (axis_[0] && axis_[1]) {
       // 2D table
@@ -4730,14 +4891,14 @@ LibertyReader::makeTable(LibertyAttr *attr,
       // Column variable2/axis[1]
       FloatTable *table = makeFloatTable(attr, axis_[0]->size(),
 					 axis_[1]->size(), scale);
-      table_ = make_shared<Table2>(table, axis_[0], axis_[1]);
+      table_ = internTable(make_shared<Table2>(table, axis_[0], axis_[1]));
     }
     else if (axis_[0]) {
       // 1D table
       FloatTable *table = makeFloatTable(attr, 1, axis_[0]->size(), scale);
       FloatSeq *values = (*table)[0];
       delete table;
-      table_ = make_shared<Table1>(values, axis_[0]);
+      table_ = internTable(make_shared<Table1>(values, axis_[0]));
     }
     else if (axis_[0] == nullptr && axis_[1] == nullptr && axis_[2] == nullptr) {
       // scalar
@@ -4808,7 +4969,7 @@ LibertyReader::makeTableAxis(int index,
     const Units *units = library_->units();
     float scale = tableVariableUnit(var, units)->scale();
     scaleFloats(values, scale);
-    axis_[index] = make_shared<TableAxis>(var, values);
+    axis_[index] = internTableAxis(make_shared<TableAxis>(var, values));
   }
   else if (axis_[index] && axis_[index]->values() == nullptr) {
     libWarn(1344, attr, "Table axis and template missing values.");
@@ -34,4 +34,12 @@ readLibertyFile(const char *filename,
 		bool infer_latches,
 		Network *network);
 
+// Lazy mode defers cell construction until first reference
+// (sta_liberty_lazy_enabled).
+LibertyLibrary *
+readLibertyFile(const char *filename,
+		bool infer_latches,
+		bool lazy_cells,
+		Network *network);
+
 } // namespace
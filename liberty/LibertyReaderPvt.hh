@@ -75,7 +75,7 @@ typedef Vector<OutputWaveform*> OutputWaveformSeq;
 typedef std::vector<std::string> StdStringSeq;
 typedef std::function<void (FuncExpr *expr)> LibertySetFunc;
 
-class LibertyReader : public LibertyGroupVisitor
+class LibertyReader : public LibertyGroupVisitor, public LibertyCellElaborator
 {
 public:
   LibertyReader(const char *filename,
@@ -87,8 +87,13 @@ public:
                     bool infer_latches,
                     Network *network);
   LibertyLibrary *library() const { return library_; }
-  virtual bool save(LibertyGroup *) { return false; }
-  virtual bool save(LibertyAttr *) { return false; }
+  // Defer cell construction; cell groups are saved at read time and
+  // elaborated on first reference (sta_liberty_lazy_enabled).
+  void setLazyCells(bool lazy);
+  // LibertyCellElaborator API.
+  virtual LibertyCell *elaborateCell(const char *cell_name);
+  virtual bool save(LibertyGroup *group);
+  virtual bool save(LibertyAttr *attr);
   virtual bool save(LibertyVariable *) { return false; }
 
   virtual void beginLibrary(LibertyGroup *group);
@@ -516,6 +521,9 @@ protected:
   void defineVisitors();
   virtual void begin(LibertyGroup *group);
   virtual void end(LibertyGroup *group);
+  void endLazyCell(LibertyGroup *group);
+  void visitLazyGroup(LibertyGroup *group);
+  void cornerMapLazyCell(LibertyCell *cell);
   void defineGroupVisitor(const char *type,
 			  LibraryGroupVisitor begin_visitor,
 			  LibraryGroupVisitor end_visitor);
@@ -597,6 +605,16 @@ protected:
 
   const char *filename_;
   bool infer_latches_;
+  // Defer cell construction until first reference.
+  bool lazy_cells_;
+  // Replaying a saved cell group through the visitors.
+  bool elaborating_;
+  // Group nesting depth inside a deferred cell group.
+  int lazy_depth_;
+  // Tells save(LibertyGroup*) to keep the cell group just ended.
+  bool lazy_cell_save_;
+  // Cell name -> saved cell group, owned by the reader.
+  Map<std::string, LibertyGroup*> lazy_cell_groups_;
   Report *report_;
   Debug *debug_;
   Network *network_;
@@ -25,10 +25,14 @@
 #include "TableModel.hh"
 
 #include <cmath>
+#include <cstring>
 #include <string>
+#include <unordered_map>
 
 #include "Error.hh"
 #include "EnumNameMap.hh"
+#include "Hash.hh"
+#include "Mutex.hh"
 #include "Units.hh"
 #include "Liberty.hh"
 
@@ -103,6 +107,18 @@ deleteSigmaModels(TableModel *models[EarlyLate::index_count])
   }
 }
 
+const TableModel *
+GateTableModel::delaySigmaModel(const EarlyLate *early_late) const
+{
+  return delay_sigma_models_[early_late->index()];
+}
+
+const TableModel *
+GateTableModel::slewSigmaModel(const EarlyLate *early_late) const
+{
+  return slew_sigma_models_[early_late->index()];
+}
+
 void
 GateTableModel::setIsScaled(bool is_scaled)
 {
@@ -121,24 +137,26 @@ GateTableModel::gateDelay(const Pvt *pvt,
 			  ArcDelay &gate_delay,
 			  Slew &drvr_slew) const
 {
-  float delay = findValue(pvt, delay_model_, in_slew, load_cap, 0.0);
+  // The models usually share axes, so axis searches are done once.
+  AxisLookupCache cache;
+  float delay = findValue(pvt, delay_model_, in_slew, load_cap, 0.0, cache);
   float sigma_early = 0.0;
   float sigma_late = 0.0;
   if (pocv_enabled && delay_sigma_models_[EarlyLate::earlyIndex()])
     sigma_early = findValue(pvt, delay_sigma_models_[EarlyLate::earlyIndex()],
-			    in_slew, load_cap, 0.0);
+			    in_slew, load_cap, 0.0, cache);
   if (pocv_enabled && delay_sigma_models_[EarlyLate::lateIndex()])
     sigma_late = findValue(pvt, delay_sigma_models_[EarlyLate::lateIndex()],
-			   in_slew, load_cap, 0.0);
+			   in_slew, load_cap, 0.0, cache);
   gate_delay = makeDelay(delay, sigma_early, sigma_late);
 
-  float slew = findValue(pvt, slew_model_, in_slew, load_cap, 0.0);
+  float slew = findValue(pvt, slew_model_, in_slew, load_cap, 0.0, cache);
   if (pocv_enabled && slew_sigma_models_[EarlyLate::earlyIndex()])
     sigma_early = findValue(pvt, slew_sigma_models_[EarlyLate::earlyIndex()],
-			    in_slew, load_cap, 0.0);
+			    in_slew, load_cap, 0.0, cache);
   if (pocv_enabled && slew_sigma_models_[EarlyLate::lateIndex()])
     sigma_late = findValue(pvt, slew_sigma_models_[EarlyLate::lateIndex()],
-			   in_slew, load_cap, 0.0);
+			   in_slew, load_cap, 0.0, cache);
   // Clip negative slews to zero.
   if (slew < 0.0)
     slew = 0.0;
@@ -230,6 +248,25 @@ GateTableModel::findValue(const Pvt *pvt,
     return 0.0;
 }
 
+float
+GateTableModel::findValue(const Pvt *pvt,
+			  const TableModel *model,
+			  float in_slew,
+			  float load_cap,
+			  float related_out_cap,
+			  AxisLookupCache &cache) const
+{
+  if (model) {
+    float axis_value1, axis_value2, axis_value3;
+    findAxisValues(model, in_slew, load_cap, related_out_cap,
+		   axis_value1, axis_value2, axis_value3);
+    return model->findValue(cell_, pvt, axis_value1, axis_value2, axis_value3,
+			    cache);
+  }
+  else
+    return 0.0;
+}
+
 void
 GateTableModel::findAxisValues(const TableModel *model,
 			       float in_slew,
@@ -419,6 +456,12 @@ CheckTableModel::~CheckTableModel()
   deleteSigmaModels(sigma_models_);
 }
 
+const TableModel *
+CheckTableModel::sigmaModel(const EarlyLate *early_late) const
+{
+  return sigma_models_[early_late->index()];
+}
+
 void
 CheckTableModel::setIsScaled(bool is_scaled)
 {
@@ -625,6 +668,18 @@ TableModel::setScaleFactorType(ScaleFactorType type)
   scale_factor_type_ = int(type);
 }
 
+ScaleFactorType
+TableModel::scaleFactorType() const
+{
+  return static_cast<ScaleFactorType>(scale_factor_type_);
+}
+
+const RiseFall *
+TableModel::rf() const
+{
+  return RiseFall::find(rf_index_);
+}
+
 void
 TableModel::setIsScaled(bool is_scaled)
 {
@@ -676,6 +731,18 @@ TableModel::findValue(const LibertyCell *cell,
     * scaleFactor(cell, pvt);
 }
 
+float
+TableModel::findValue(const LibertyCell *cell,
+		      const Pvt *pvt,
+		      float axis_value1,
+		      float axis_value2,
+		      float axis_value3,
+		      AxisLookupCache &cache) const
+{
+  return table_->findValue(axis_value1, axis_value2, axis_value3, cache)
+    * scaleFactor(cell, pvt);
+}
+
 float
 TableModel::scaleFactor(const LibertyCell *cell,
 			const Pvt *pvt) const
@@ -888,6 +955,22 @@ Table1::findValue(float axis_value1) const
   }
 }
 
+float
+Table1::findValue(float axis_value1,
+		  float,
+		  float,
+		  AxisLookupCache &cache) const
+{
+  if (axis1_->size() == 1)
+    return findValue(axis_value1);
+  size_t axis_index1;
+  double dx1;
+  cache.findWeight(axis1_.get(), axis_value1, axis_index1, dx1);
+  double y1 = this->value(axis_index1);
+  double y2 = this->value(axis_index1 + 1);
+  return (1 - dx1) * y1 + dx1 * y2;
+}
+
 float
 Table1::findValueClip(float axis_value1) const
 {
@@ -1077,6 +1160,29 @@ Table2::findValue(float axis_value1,
   }
 }
 
+float
+Table2::findValue(float axis_value1,
+		  float axis_value2,
+		  float axis_value3,
+		  AxisLookupCache &cache) const
+{
+  if (axis1_->size() == 1
+      || axis2_->size() == 1)
+    return findValue(axis_value1, axis_value2, axis_value3);
+  size_t axis_index1, axis_index2;
+  double dx1, dx2;
+  cache.findWeight(axis1_.get(), axis_value1, axis_index1, dx1);
+  cache.findWeight(axis2_.get(), axis_value2, axis_index2, dx2);
+  double y00 = value(axis_index1, axis_index2);
+  double y01 = value(axis_index1, axis_index2 + 1);
+  double y10 = value(axis_index1 + 1, axis_index2);
+  double y11 = value(axis_index1 + 1, axis_index2 + 1);
+  return (1 - dx1) * (1 - dx2) * y00
+    +    (1 - dx1) *      dx2  * y01
+    +         dx1  * (1 - dx2) * y10
+    +         dx1  *      dx2  * y11;
+}
+
 string
 Table2::reportValue(const char *result_name,
 		    const LibertyCell *cell,
@@ -1256,6 +1362,39 @@ Table3::findValue(float axis_value1,
   return tbl_value;
 }
 
+float
+Table3::findValue(float axis_value1,
+		  float axis_value2,
+		  float axis_value3,
+		  AxisLookupCache &cache) const
+{
+  if (axis1()->size() == 1
+      || axis2()->size() == 1
+      || axis3_->size() == 1)
+    return findValue(axis_value1, axis_value2, axis_value3);
+  size_t axis_index1, axis_index2, axis_index3;
+  double dx1, dx2, dx3;
+  cache.findWeight(axis1(), axis_value1, axis_index1, dx1);
+  cache.findWeight(axis2(), axis_value2, axis_index2, dx2);
+  cache.findWeight(axis3_.get(), axis_value3, axis_index3, dx3);
+  double y000 = value(axis_index1, axis_index2, axis_index3);
+  double y001 = value(axis_index1, axis_index2, axis_index3 + 1);
+  double y010 = value(axis_index1, axis_index2 + 1, axis_index3);
+  double y011 = value(axis_index1, axis_index2 + 1, axis_index3 + 1);
+  double y100 = value(axis_index1 + 1, axis_index2, axis_index3);
+  double y101 = value(axis_index1 + 1, axis_index2, axis_index3 + 1);
+  double y110 = value(axis_index1 + 1, axis_index2 + 1, axis_index3);
+  double y111 = value(axis_index1 + 1, axis_index2 + 1, axis_index3 + 1);
+  return (1 - dx1) * (1 - dx2) * (1 - dx3) * y000
+    +    (1 - dx1) * (1 - dx2) *      dx3  * y001
+    +    (1 - dx1) *      dx2  * (1 - dx3) * y010
+    +    (1 - dx1) *      dx2  *      dx3  * y011
+    +         dx1  * (1 - dx2) * (1 - dx3) * y100
+    +         dx1  * (1 - dx2) *      dx3  * y101
+    +         dx1  *      dx2  * (1 - dx3) * y110
+    +         dx1  *      dx2  *      dx3  * y111;
+}
+
 // Sample output.
 //
 //    --------- input_net_transition = 0.00
@@ -1564,6 +1703,158 @@ TableAxis::unit(const Units *units)
 
 ////////////////////////////////////////////////////////////////
 
+AxisLookupCache::AxisLookupCache() :
+  axes_{},
+  values_{},
+  indices_{},
+  dxs_{},
+  next_(0)
+{
+}
+
+void
+AxisLookupCache::findWeight(const TableAxis *axis,
+			    float value,
+			    // Return values.
+			    size_t &index,
+			    double &dx)
+{
+  for (int i = 0; i < cache_size_; i++) {
+    if (axes_[i] == axis
+	&& values_[i] == value) {
+      index = indices_[i];
+      dx = dxs_[i];
+      return;
+    }
+  }
+  index = axis->findAxisIndex(value);
+  double xl = axis->axisValue(index);
+  double xu = axis->axisValue(index + 1);
+  dx = (value - xl) / (xu - xl);
+  axes_[next_] = axis;
+  values_[next_] = value;
+  indices_[next_] = index;
+  dxs_[next_] = dx;
+  next_ = (next_ + 1) % cache_size_;
+}
+
+////////////////////////////////////////////////////////////////
+
+// Intern pools keyed by content hash, shared by all libraries so
+// identical tables in different corners share storage.  The pools hold
+// weak references; expired entries are pruned as buckets are scanned.
+static std::mutex intern_lock;
+static std::unordered_map<size_t, Vector<std::weak_ptr<TableAxis>>> axis_intern_map;
+static std::unordered_map<size_t, Vector<std::weak_ptr<Table>>> table_intern_map;
+
+static void
+hashFloats(size_t &hash,
+	   const FloatSeq *values)
+{
+  for (float value : *values) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    hashIncr(hash, bits);
+  }
+}
+
+static bool
+floatSeqEqual(const FloatSeq *values1,
+	      const FloatSeq *values2)
+{
+  return values1->size() == values2->size()
+    && memcmp(values1->data(), values2->data(),
+	      values1->size() * sizeof(float)) == 0;
+}
+
+static bool
+floatTableEqual(FloatTable *values1,
+		FloatTable *values2)
+{
+  if (values1->size() != values2->size())
+    return false;
+  for (size_t i = 0; i < values1->size(); i++) {
+    if (!floatSeqEqual((*values1)[i], (*values2)[i]))
+      return false;
+  }
+  return true;
+}
+
+TableAxisPtr
+internTableAxis(TableAxisPtr axis)
+{
+  size_t hash = hash_init_value;
+  hashIncr(hash, static_cast<size_t>(axis->variable()));
+  hashFloats(hash, axis->values());
+
+  LockGuard lock(intern_lock);
+  Vector<std::weak_ptr<TableAxis>> &bucket = axis_intern_map[hash];
+  for (auto iter = bucket.begin(); iter != bucket.end();) {
+    TableAxisPtr match = iter->lock();
+    if (match == nullptr)
+      iter = bucket.erase(iter);
+    else if (match->variable() == axis->variable()
+	     && floatSeqEqual(match->values(), axis->values()))
+      return match;
+    else
+      iter++;
+  }
+  bucket.push_back(axis);
+  return axis;
+}
+
+static bool
+tableEqual(Table *table1,
+	   Table *table2)
+{
+  if (table1->order() != table2->order()
+      // Interned axes are shared, so identical axes are pointer equal.
+      || table1->axis1() != table2->axis1()
+      || table1->axis2() != table2->axis2()
+      || table1->axis3() != table2->axis3())
+    return false;
+  if (table1->order() == 1)
+    return floatSeqEqual(static_cast<Table1*>(table1)->values(),
+			 static_cast<Table1*>(table2)->values());
+  return floatTableEqual(static_cast<Table2*>(table1)->values3(),
+			 static_cast<Table2*>(table2)->values3());
+}
+
+TablePtr
+internTable(TablePtr table)
+{
+  // Scalar tables are not worth interning.
+  if (table->order() == 0)
+    return table;
+  size_t hash = hash_init_value;
+  hashIncr(hash, table->order());
+  hashIncr(hash, reinterpret_cast<size_t>(table->axis1()));
+  hashIncr(hash, reinterpret_cast<size_t>(table->axis2()));
+  hashIncr(hash, reinterpret_cast<size_t>(table->axis3()));
+  if (table->order() == 1)
+    hashFloats(hash, static_cast<Table1*>(table.get())->values());
+  else {
+    for (FloatSeq *row : *static_cast<Table2*>(table.get())->values3())
+      hashFloats(hash, row);
+  }
+
+  LockGuard lock(intern_lock);
+  Vector<std::weak_ptr<Table>> &bucket = table_intern_map[hash];
+  for (auto iter = bucket.begin(); iter != bucket.end();) {
+    TablePtr match = iter->lock();
+    if (match == nullptr)
+      iter = bucket.erase(iter);
+    else if (tableEqual(match.get(), table.get()))
+      return match;
+    else
+      iter++;
+  }
+  bucket.push_back(table);
+  return table;
+}
+
+////////////////////////////////////////////////////////////////
+
 static EnumNameMap<TableAxisVariable> table_axis_variable_map =
   {{TableAxisVariable::total_output_net_capacitance, "total_output_net_capacitance"},
    {TableAxisVariable::equal_or_opposite_output_net_capacitance, "equal_or_opposite_output_net_capacitance"},
@@ -27,6 +27,7 @@
 #include "EnumNameMap.hh"
 #include "FuncExpr.hh"
 #include "TimingRole.hh"
+#include "Arena.hh"
 #include "Liberty.hh"
 #include "TimingArc.hh"
 #include "DcalcAnalysisPt.hh"
@@ -229,7 +230,9 @@ TimingArcSet::TimingArcSet(const TimingRole *role,
 
 TimingArcSet::~TimingArcSet()
 {
-  arcs_.deleteContents();
+  // Arc memory is owned by the library arena.
+  for (TimingArc *arc : arcs_)
+    arc->~TimingArc();
 }
 
 bool
@@ -289,7 +292,7 @@ TimingArcSet::deleteTimingArc(TimingArc *arc)
   }
   else if (from_arc2_[from_rf_index] == arc)
     from_arc2_[from_rf_index] = nullptr;
-  delete arc;
+  arc->~TimingArc();
 }
 
 TimingArc *
@@ -521,21 +524,26 @@ TimingArcSet::wireArcIndex(const RiseFall *rf)
   return rf->index();
 }
 
+// The wire timing arc set has no library, so it gets its own arena.
+static Arena wire_timing_arc_arena;
+
 void
 TimingArcSet::init()
 {
   wire_timing_arc_attrs_ = make_shared<TimingArcAttrs>(TimingSense::positive_unate);
-  wire_timing_arc_set_ = new TimingArcSet(TimingRole::wire(), wire_timing_arc_attrs_);
-  new TimingArc(wire_timing_arc_set_, Transition::rise(),
-		Transition::rise(), nullptr);
-  new TimingArc(wire_timing_arc_set_, Transition::fall(),
-		Transition::fall(), nullptr);
+  wire_timing_arc_set_ = new (wire_timing_arc_arena)
+    TimingArcSet(TimingRole::wire(), wire_timing_arc_attrs_);
+  new (wire_timing_arc_arena) TimingArc(wire_timing_arc_set_, Transition::rise(),
+					Transition::rise(), nullptr);
+  new (wire_timing_arc_arena) TimingArc(wire_timing_arc_set_, Transition::fall(),
+					Transition::fall(), nullptr);
 }
 
 void
 TimingArcSet::destroy()
 {
-  delete wire_timing_arc_set_;
+  if (wire_timing_arc_set_)
+    wire_timing_arc_set_->~TimingArcSet();
   wire_timing_arc_set_ = nullptr;
   wire_timing_arc_attrs_ = nullptr;
 }
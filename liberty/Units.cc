@@ -182,7 +182,7 @@ Unit::asString(float value,
     // prevent "-0.00" on slowaris
     if (abs(scaled_value) < 1E-6)
       scaled_value = 0.0;
-    return stringPrintTmp("%.*f", digits, scaled_value);
+    return stringPrintTmpFixed(scaled_value, digits);
   }
 }
 
@@ -74,6 +74,7 @@ void
 ConcreteLibrary::addCell(ConcreteCell *cell)
 {
   cell_map_[cell->name()] = cell;
+  cell_find_map_[cell->name()] = cell;
 }
 
 void
@@ -81,13 +82,19 @@ ConcreteLibrary::renameCell(ConcreteCell *cell,
 			    const char *cell_name)
 {
   cell_map_.erase(cell->name());
-  cell_map_[cell_name] = cell;
+  cell_find_map_.erase(cell->name());
+  // Rename before inserting so the find map key points at the
+  // cell's name storage.
+  cell->name_ = cell_name;
+  cell_map_[cell->name()] = cell;
+  cell_find_map_[cell->name()] = cell;
 }
 
 void
 ConcreteLibrary::deleteCell(ConcreteCell *cell)
 {
   cell_map_.erase(cell->name());
+  cell_find_map_.erase(cell->name());
   delete cell;
 }
 
@@ -100,7 +107,7 @@ ConcreteLibrary::cellIterator() const
 ConcreteCell *
 ConcreteLibrary::findCell(const char *name) const
 {
-  return cell_map_.findKey(name);
+  return cell_find_map_.findKey(name);
 }
 
 CellSeq
@@ -150,7 +157,6 @@ void
 ConcreteCell::setName(const char *name)
 {
   library_->renameCell(this, name);
-  name_ = name;
 }
 
 void
@@ -24,6 +24,8 @@
 
 #include "ConcreteNetwork.hh"
 
+#include "Mutex.hh"
+#include "StringRegistry.hh"
 #include "PatternMatch.hh"
 #include "Report.hh"
 #include "Liberty.hh"
@@ -256,7 +258,7 @@ ConcreteNetTermIterator::next()
 
 ////////////////////////////////////////////////////////////////
 
-ObjectId ConcreteNetwork::object_id_ = 0;
+std::atomic<ObjectId> ConcreteNetwork::object_id_{0};
 
 ConcreteNetwork::ConcreteNetwork() :
   NetworkReader(),
@@ -281,6 +283,18 @@ ConcreteNetwork::clear()
   Network::clear();
 }
 
+// Name strings and the child/net maps are not counted, so this
+// understates the netlist somewhat.
+void
+ConcreteNetwork::memoryUsage(size_t &object_count,
+			     size_t &bytes) const
+{
+  object_count = instance_pool_.size() + pin_pool_.size()
+    + term_pool_.size() + net_pool_.size();
+  bytes = instance_pool_.memoryUsage() + pin_pool_.memoryUsage()
+    + term_pool_.memoryUsage() + net_pool_.memoryUsage();
+}
+
 void
 ConcreteNetwork::deleteTopInstance()
 {
@@ -432,6 +446,7 @@ ConcreteNetwork::makeLibertyLibrary(const char *name,
 void
 ConcreteNetwork::addLibrary(ConcreteLibrary *library)
 {
+  LockGuard lock(library_lock_);
   library_seq_.push_back(library);
   library_map_[library->name()] = library;
 }
@@ -439,6 +454,7 @@ ConcreteNetwork::addLibrary(ConcreteLibrary *library)
 Library *
 ConcreteNetwork::findLibrary(const char *name)
 {
+  LockGuard lock(library_lock_);
   return reinterpret_cast<Library*>(library_map_.findKey(name));
 }
 
@@ -446,6 +462,7 @@ void
 ConcreteNetwork::deleteLibrary(Library *library)
 {
   ConcreteLibrary *clib = reinterpret_cast<ConcreteLibrary*>(library);
+  LockGuard lock(library_lock_);
   library_map_.erase(clib->name());
   library_seq_.eraseObject(clib);
   delete clib;
@@ -470,6 +487,7 @@ ConcreteNetwork::id(const Library *library) const
 LibertyLibrary *
 ConcreteNetwork::findLiberty(const char *name)
 {
+  LockGuard lock(library_lock_);
   ConcreteLibrary *lib =  library_map_.findKey(name);
   if (lib) {
     if (lib->isLiberty())
@@ -512,6 +530,9 @@ ConcreteNetwork::findAnyCell(const char *name)
   while (lib_iter.hasNext()) {
     ConcreteLibrary *lib = lib_iter.next();
     ConcreteCell *cell = lib->findCell(name);
+    if (cell == nullptr && lib->isLiberty())
+      // findLibertyCell elaborates lazy liberty cells.
+      cell = static_cast<LibertyLibrary*>(lib)->findLibertyCell(name);
     if (cell)
       return reinterpret_cast<Cell*>(cell);
   }
@@ -1250,7 +1271,7 @@ ConcreteNetwork::makeConcreteInstance(ConcreteCell *cell,
 {
   ConcreteInstance *cparent =
     reinterpret_cast<ConcreteInstance*>(parent);
-  ConcreteInstance *inst = new ConcreteInstance(name, cell, cparent);
+  ConcreteInstance *inst = instance_pool_.make(name, cell, cparent);
   if (parent)
     cparent->addChild(inst);
   return reinterpret_cast<Instance*>(inst);
@@ -1307,7 +1328,7 @@ ConcreteNetwork::deleteInstance(Instance *inst)
     NetTermIterator *term_iter = termIterator(net);
     while (term_iter->hasNext()) {
       ConcreteTerm *term = reinterpret_cast<ConcreteTerm*>(term_iter->next());
-      delete term;
+      term_pool_.destroy(term);
     }
     delete term_iter;
     deleteNet(net);
@@ -1334,7 +1355,7 @@ ConcreteNetwork::deleteInstance(Instance *inst)
       reinterpret_cast<ConcreteInstance*>(parent_inst);
     cparent->deleteChild(cinst);
   }
-  delete cinst;
+  instance_pool_.destroy(cinst);
 }
 
 Pin *
@@ -1345,7 +1366,7 @@ ConcreteNetwork::makePin(Instance *inst,
   ConcreteInstance *cinst = reinterpret_cast<ConcreteInstance*>(inst);
   ConcretePort *cport = reinterpret_cast<ConcretePort*>(port);
   ConcreteNet *cnet = reinterpret_cast<ConcreteNet*>(net);
-  ConcretePin *cpin = new ConcretePin(cinst, cport, cnet);
+  ConcretePin *cpin = pin_pool_.make(cinst, cport, cnet);
   cinst->addPin(cpin);
   if (cnet)
     connectNetPin(cnet, cpin);
@@ -1358,7 +1379,7 @@ ConcreteNetwork::makeTerm(Pin *pin,
 {
   ConcretePin *cpin = reinterpret_cast<ConcretePin*>(pin);
   ConcreteNet *cnet = reinterpret_cast<ConcreteNet*>(net);
-  ConcreteTerm *cterm = new ConcreteTerm(cpin, cnet);
+  ConcreteTerm *cterm = term_pool_.make(cpin, cnet);
   if (cnet)
     cnet->addTerm(cterm);
   cpin->term_ = cterm;
@@ -1397,12 +1418,12 @@ ConcreteNetwork::connect(Instance *inst,
       disconnectNetPin(prev_net, cpin);
   }
   else {
-    cpin = new ConcretePin(cinst, cport, cnet);
+    cpin = pin_pool_.make(cinst, cport, cnet);
     cinst->addPin(cpin);
   }
   if (inst == top_instance_) {
     // makeTerm
-    ConcreteTerm *cterm = new ConcreteTerm(cpin, cnet);
+    ConcreteTerm *cterm = term_pool_.make(cpin, cnet);
     if (cnet)
       cnet->addTerm(cterm);
     cpin->term_ = cterm;
@@ -1449,7 +1470,7 @@ ConcreteNetwork::disconnectPin(Pin *pin)
 	clearNetDrvrPinMap();
       }
       cpin->term_ = nullptr;
-      delete cterm;
+      term_pool_.destroy(cterm);
     }
   }
   else {
@@ -1493,7 +1514,7 @@ ConcreteNetwork::deletePin(Pin *pin)
     reinterpret_cast<ConcreteInstance*>(cpin->instance());
   if (cinst)
     cinst->deletePin(cpin);
-  delete cpin;
+  pin_pool_.destroy(cpin);
 }
 
 Net *
@@ -1501,7 +1522,7 @@ ConcreteNetwork::makeNet(const char *name,
 			 Instance *parent)
 {
   ConcreteInstance *cparent = reinterpret_cast<ConcreteInstance*>(parent);
-  ConcreteNet *net = new ConcreteNet(name, cparent);
+  ConcreteNet *net = net_pool_.make(name, cparent);
   cparent->addNet(net);
   return reinterpret_cast<Net*>(net);
 }
@@ -1529,7 +1550,7 @@ ConcreteNetwork::deleteNet(Net *net)
   ConcreteInstance *cinst =
     reinterpret_cast<ConcreteInstance*>(cnet->instance());
   cinst->deleteNet(cnet);
-  delete cnet;
+  net_pool_.destroy(cnet);
 }
 
 void
@@ -1596,10 +1617,17 @@ ConcreteNetwork::visitConnectedPins(const Net *net,
 
 ////////////////////////////////////////////////////////////////
 
+// Instance attributes are rare, so they live in a sparse side table
+// keyed by instance rather than an embedded map in every instance.
+// The lock guards the table when instances are linked concurrently.
+static Map<const ConcreteInstance*, AttributeMap> instance_attribute_maps;
+static std::mutex instance_attribute_lock;
+static const AttributeMap empty_attribute_map;
+
 ConcreteInstance::ConcreteInstance(const char *name,
 				   ConcreteCell *cell,
                                    ConcreteInstance *parent) :
-  name_(stringCopy(name)),
+  name_(StringRegistry::intern(name)),
   id_(ConcreteNetwork::nextObjectId()),
   cell_(cell),
   parent_(parent),
@@ -1618,9 +1646,13 @@ ConcreteInstance::initPins()
 
 ConcreteInstance::~ConcreteInstance()
 {
-  stringDelete(name_);
+  // name_ is interned and shared.
   delete children_;
   delete nets_;
+  if (!instance_attribute_maps.empty()) {
+    LockGuard lock(instance_attribute_lock);
+    instance_attribute_maps.erase(this);
+  }
 }
 
 Instance *
@@ -1709,18 +1741,32 @@ void
 ConcreteInstance::setAttribute(const string &key,
                                const string &value)
 {
-  attribute_map_[key] = value;
+  LockGuard lock(instance_attribute_lock);
+  instance_attribute_maps[this][key] = value;
 }
 
 string
 ConcreteInstance::getAttribute(const string &key) const
 {
-  const auto &itr = attribute_map_.find(key);
-  if (itr != attribute_map_.end())
+  const AttributeMap &attribute_map = attributeMap();
+  const auto &itr = attribute_map.find(key);
+  if (itr != attribute_map.end())
     return itr->second;
   return "";
 }
 
+const AttributeMap &
+ConcreteInstance::attributeMap() const
+{
+  if (!instance_attribute_maps.empty()) {
+    LockGuard lock(instance_attribute_lock);
+    auto itr = instance_attribute_maps.find(this);
+    if (itr != instance_attribute_maps.end())
+      return itr->second;
+  }
+  return empty_attribute_map;
+}
+
 void
 ConcreteInstance::addChild(ConcreteInstance *child)
 {
@@ -1833,7 +1879,7 @@ ConcreteTerm::ConcreteTerm(ConcretePin *pin,
 
 ConcreteNet::ConcreteNet(const char *name,
 			 ConcreteInstance *instance) :
-  name_(stringCopy(name)),
+  name_(StringRegistry::intern(name)),
   id_(ConcreteNetwork::nextObjectId()),
   instance_(instance),
   pins_(nullptr),
@@ -1844,7 +1890,7 @@ ConcreteNet::ConcreteNet(const char *name,
 
 ConcreteNet::~ConcreteNet()
 {
-  stringDelete(name_);
+  // name_ is interned and shared.
 }
 
 // Merged nets are kept around to serve as name aliases.
@@ -61,6 +61,14 @@ Network::isLinked() const
   return topInstance() != nullptr;
 }
 
+void
+Network::memoryUsage(size_t &object_count,
+		     size_t &bytes) const
+{
+  object_count = 0;
+  bytes = 0;
+}
+
 LibertyLibrary *
 Network::libertyLibrary(const Cell *cell) const
 {
@@ -756,7 +764,9 @@ Network::findInstancesMatching1(const Instance *context,
     const char *child_context_name = &child_name[context_name_length];
     if (pattern->match(child_context_name))
       matches.push_back(child);
-    if (!isLeaf(child))
+    // Skip subtrees whose path prefix cannot match the pattern.
+    if (!isLeaf(child)
+	&& pattern->matchHierPrefix(child_context_name, pathDivider()))
       findInstancesMatching1(child, context_name_length, pattern, matches);
   }
   delete child_iter;
@@ -1617,6 +1627,7 @@ void
 Network::clearNetDrvrPinMap()
 {
   net_drvr_pin_map_.deleteContentsClear();
+  hpin_drvr_loads_map_.deleteContentsClear();
 }
 
 PinSet *
@@ -1897,10 +1908,10 @@ visitDrvrLoads(PinSet drvrs,
   }
 }
 
-void
-visitDrvrLoadsThruHierPin(const Pin *hpin,
-			  const Network *network,
-			  HierPinThruVisitor *visitor)
+static void
+findDrvrLoadsThruHierPin(const Pin *hpin,
+			 const Network *network,
+			 HierPinThruVisitor *visitor)
 {
   Net *above_net = network->net(hpin);
   if (above_net) {
@@ -1925,6 +1936,52 @@ visitDrvrLoadsThruHierPin(const Pin *hpin,
   }
 }
 
+class RecordDrvrLoads : public HierPinThruVisitor
+{
+public:
+  RecordDrvrLoads(DrvrLoadPairSeq *drvr_loads);
+  virtual void visit(const Pin *drvr,
+		     const Pin *load);
+
+protected:
+  DrvrLoadPairSeq *drvr_loads_;
+};
+
+RecordDrvrLoads::RecordDrvrLoads(DrvrLoadPairSeq *drvr_loads) :
+  drvr_loads_(drvr_loads)
+{
+}
+
+void
+RecordDrvrLoads::visit(const Pin *drvr,
+		       const Pin *load)
+{
+  drvr_loads_->push_back(DrvrLoadPair(drvr, load));
+}
+
+const DrvrLoadPairSeq *
+Network::drvrLoadsThruHierPin(const Pin *hpin) const
+{
+  DrvrLoadPairSeq *drvr_loads = hpin_drvr_loads_map_.findKey(hpin);
+  if (drvr_loads == nullptr) {
+    drvr_loads = new DrvrLoadPairSeq;
+    RecordDrvrLoads record(drvr_loads);
+    findDrvrLoadsThruHierPin(hpin, this, &record);
+    hpin_drvr_loads_map_[hpin] = drvr_loads;
+  }
+  return drvr_loads;
+}
+
+void
+visitDrvrLoadsThruHierPin(const Pin *hpin,
+			  const Network *network,
+			  HierPinThruVisitor *visitor)
+{
+  const DrvrLoadPairSeq *drvr_loads = network->drvrLoadsThruHierPin(hpin);
+  for (const DrvrLoadPair &drvr_load : *drvr_loads)
+    visitor->visit(drvr_load.first, drvr_load.second);
+}
+
 void
 visitDrvrLoadsThruNet(const Net *net,
 		      const Network *network,
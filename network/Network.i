@@ -169,6 +169,18 @@ network_is_linked()
   return Sta::sta()->network()->isLinked();
 }
 
+bool
+write_network_snapshot_cmd(const char *filename)
+{
+  return Sta::sta()->writeNetworkSnapshot(filename);
+}
+
+bool
+read_network_snapshot_cmd(const char *filename)
+{
+  return Sta::sta()->readNetworkSnapshot(filename);
+}
+
 void
 set_path_divider(char divider)
 {
@@ -26,6 +26,19 @@
 
 namespace eval sta {
 
+# Defined by SWIG interface Network.i.
+define_cmd_args "write_network_snapshot" {filename}
+
+proc_redirect write_network_snapshot {
+  write_network_snapshot_cmd [file nativename [lindex $args 0]]
+}
+
+define_cmd_args "read_network_snapshot" {filename}
+
+proc_redirect read_network_snapshot {
+  read_network_snapshot_cmd [file nativename [lindex $args 0]]
+}
+
 define_cmd_args "report_instance" \
   {[-connections] [-verbose] instance_path [> filename] [>> filename]}
 
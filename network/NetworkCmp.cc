@@ -27,6 +27,7 @@
 #include <algorithm>
 
 #include "StringUtil.hh"
+#include "ParallelSort.hh"
 #include "Liberty.hh"
 #include "Network.hh"
 
@@ -89,7 +90,8 @@ sortByPathName(const PinSet *set,
   PinSeq pins;
   for (const Pin *pin : *set)
     pins.push_back(pin);
-  sort(pins, PinPathNameLess(network));
+  sort(pins, PinPathNameLess(network),
+       network->dispatchQueue(), network->threadCount());
   return pins;
 }
 
@@ -100,7 +102,8 @@ sortByName(const PortSet *set,
   PortSeq ports;
   for (const Port *port : *set)
     ports.push_back(port);
-  sort(ports, PortNameLess(network));
+  sort(ports, PortNameLess(network),
+       network->dispatchQueue(), network->threadCount());
   return ports;
 }
 
@@ -111,7 +114,8 @@ sortByPathName(InstanceSet *set,
   InstanceSeq insts;
   for (const Instance *inst : *set)
     insts.push_back(inst);
-  sort(insts, InstancePathNameLess(network));
+  sort(insts, InstancePathNameLess(network),
+       network->dispatchQueue(), network->threadCount());
   return insts;
 }
 
@@ -122,7 +126,8 @@ sortByPathName(NetSet *set,
   NetSeq nets;
   for (const Net *net : *set)
     nets.push_back(net);
-  sort(nets, NetPathNameLess(network));
+  sort(nets, NetPathNameLess(network),
+       network->dispatchQueue(), network->threadCount());
   return nets;
 }
 
@@ -63,6 +63,13 @@ replace_cell_cmd(Instance *inst,
   Sta::sta()->replaceCell(inst, to_cell);
 }
 
+Instance *
+replace_block_with_model_cmd(Instance *inst,
+			     LibertyCell *model_cell)
+{
+  return Sta::sta()->replaceBlockWithModel(inst, model_cell);
+}
+
 Net *
 make_net_cmd(const char *name,
 	     Instance *parent)
@@ -97,6 +104,18 @@ disconnect_pin_cmd(Pin *pin)
   Sta::sta()->disconnectPin(pin);
 }
 
+void
+begin_edits_cmd()
+{
+  Sta::sta()->beginEdits();
+}
+
+void
+end_edits_cmd()
+{
+  Sta::sta()->endEdits();
+}
+
 // Notify STA of network change.
 void
 network_changed()
@@ -26,6 +26,21 @@
 
 namespace eval sta {
 
+define_cmd_args "begin_edits" {}
+
+# Defer timing graph repair until end_edits.
+proc begin_edits { } {
+  begin_edits_cmd
+}
+
+define_cmd_args "end_edits" {}
+
+proc end_edits { } {
+  end_edits_cmd
+}
+
+################################################################
+
 define_cmd_args "make_instance" {inst_path lib_cell}
 
 proc make_instance { inst_path lib_cell } {
@@ -229,6 +244,27 @@ proc replace_cell { instance lib_cell } {
 
 ################################################################
 
+define_cmd_args "replace_block_with_model" {instance lib_cell}
+
+# Replace a hierarchical block instance with a leaf instance of its
+# extracted timing model (see write_timing_model), reconnecting the
+# boundary nets by port name. The timing graph is repaired
+# incrementally rather than relinking the design.
+proc replace_block_with_model { instance lib_cell } {
+  set cell [get_lib_cell_warn "lib_cell" $lib_cell]
+  if { $cell != "NULL" } {
+    set inst [get_instance_error "instance" $instance]
+    if { [$inst is_leaf] } {
+      sta_error 2214 "replace_block_with_model requires a hierarchical instance."
+    }
+    return [replace_block_with_model_cmd $inst $cell]
+  } else {
+    return 0
+  }
+}
+
+################################################################
+
 proc path_regexp {} {
   global hierarchy_separator
   set id_regexp "\[^${hierarchy_separator}\]+"
@@ -0,0 +1,746 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2025, Parallax Software, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+//
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// This notice may not be removed or altered from any source distribution.
+
+#include "NetworkSnapshot.hh"
+
+#include <cstring>
+#include <fstream>
+#include <sys/stat.h>
+
+#ifndef _WIN32
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <unistd.h>
+#endif
+
+#include "Map.hh"
+#include "Vector.hh"
+#include "Report.hh"
+#include "Liberty.hh"
+#include "PortDirection.hh"
+#include "Network.hh"
+#include "ConcreteNetwork.hh"
+
+namespace sta {
+
+using std::string;
+
+static constexpr uint32_t snapshot_magic = 0x4e415453;  // "STAN"
+static constexpr uint32_t snapshot_format_version = 1;
+static constexpr uint32_t snapshot_null_id = 0xffffffff;
+
+////////////////////////////////////////////////////////////////
+//
+// Writer
+//
+////////////////////////////////////////////////////////////////
+
+class NetworkSnapshotWriter
+{
+public:
+  NetworkSnapshotWriter(const char *filename,
+                        Network *network);
+  bool write();
+
+private:
+  bool cellSupported(const Cell *cell) const;
+  void collectCells(const Instance *inst);
+  void writeCells();
+  void writeCell(const Cell *cell);
+  void writeAttributes(const AttributeMap &attrs);
+  void writeInstance(const Instance *inst);
+  void writePins();
+  void writeInstancePins(const Instance *inst);
+  void writeConstantNets();
+
+  void writeBool(bool value);
+  void writeU8(uint8_t value);
+  void writeU32(uint32_t value);
+  void writeI32(int32_t value);
+  void writeString(const char *str);
+
+  const char *filename_;
+  Network *network_;
+  Report *report_;
+  std::ofstream out_;
+  Vector<const Cell*> cells_;
+  Map<const Cell*, uint32_t> cell_ids_;
+  Map<const Instance*, uint32_t> inst_ids_;
+  Map<const Net*, uint32_t> net_ids_;
+  uint32_t pin_count_;
+};
+
+NetworkSnapshotWriter::NetworkSnapshotWriter(const char *filename,
+                                             Network *network) :
+  filename_(filename),
+  network_(network),
+  report_(network->report()),
+  pin_count_(0)
+{
+}
+
+bool
+NetworkSnapshotWriter::write()
+{
+  Instance *top = network_->topInstance();
+  if (top == nullptr) {
+    report_->warn(2314, "no network has been linked.");
+    return false;
+  }
+  collectCells(top);
+  for (const Cell *cell : cells_) {
+    if (!cellSupported(cell)) {
+      report_->warn(2315, "cell %s is not representable in a network snapshot.",
+                    network_->name(cell));
+      return false;
+    }
+  }
+
+  out_.open(filename_, std::ios::binary | std::ios::trunc);
+  if (!out_.is_open()) {
+    report_->warn(2316, "cannot open network snapshot file %s.", filename_);
+    return false;
+  }
+  writeU32(snapshot_magic);
+  writeU32(snapshot_format_version);
+  writeCells();
+  writeInstance(top);
+  writePins();
+  writeConstantNets();
+  out_.close();
+  if (out_.fail()) {
+    report_->warn(2317, "error writing network snapshot file %s.", filename_);
+    return false;
+  }
+  return true;
+}
+
+bool
+NetworkSnapshotWriter::cellSupported(const Cell *cell) const
+{
+  if (network_->libertyCell(const_cast<Cell*>(cell)))
+    return true;
+  // Bundle ports cannot be rebuilt without their member lists.
+  CellPortIterator *port_iter = network_->portIterator(cell);
+  bool supported = true;
+  while (port_iter->hasNext()) {
+    if (network_->isBundle(port_iter->next())) {
+      supported = false;
+      break;
+    }
+  }
+  delete port_iter;
+  return supported;
+}
+
+void
+NetworkSnapshotWriter::collectCells(const Instance *inst)
+{
+  const Cell *cell = network_->cell(inst);
+  if (!cell_ids_.hasKey(cell)) {
+    cell_ids_[cell] = static_cast<uint32_t>(cells_.size());
+    cells_.push_back(cell);
+  }
+  InstanceChildIterator *child_iter = network_->childIterator(inst);
+  while (child_iter->hasNext())
+    collectCells(child_iter->next());
+  delete child_iter;
+}
+
+void
+NetworkSnapshotWriter::writeCells()
+{
+  writeU32(static_cast<uint32_t>(cells_.size()));
+  for (const Cell *cell : cells_)
+    writeCell(cell);
+}
+
+void
+NetworkSnapshotWriter::writeCell(const Cell *cell)
+{
+  LibertyCell *liberty_cell = network_->libertyCell(const_cast<Cell*>(cell));
+  writeBool(liberty_cell != nullptr);
+  writeString(network_->name(network_->library(cell)));
+  writeString(network_->name(cell));
+  if (liberty_cell == nullptr) {
+    writeBool(network_->isLeaf(cell));
+    writeAttributes(network_->attributeMap(cell));
+    uint32_t port_count = 0;
+    CellPortIterator *count_iter = network_->portIterator(cell);
+    while (count_iter->hasNext()) {
+      count_iter->next();
+      port_count++;
+    }
+    delete count_iter;
+    writeU32(port_count);
+    CellPortIterator *port_iter = network_->portIterator(cell);
+    while (port_iter->hasNext()) {
+      Port *port = port_iter->next();
+      bool is_bus = network_->isBus(port);
+      writeBool(is_bus);
+      writeString(network_->name(port));
+      writeString(network_->direction(port)->name());
+      if (is_bus) {
+        writeI32(network_->fromIndex(port));
+        writeI32(network_->toIndex(port));
+      }
+    }
+    delete port_iter;
+  }
+}
+
+void
+NetworkSnapshotWriter::writeAttributes(const AttributeMap &attrs)
+{
+  writeU32(static_cast<uint32_t>(attrs.size()));
+  for (const auto& [key, value] : attrs) {
+    writeString(key.c_str());
+    writeString(value.c_str());
+  }
+}
+
+void
+NetworkSnapshotWriter::writeInstance(const Instance *inst)
+{
+  inst_ids_[inst] = static_cast<uint32_t>(inst_ids_.size());
+  writeString(network_->name(inst));
+  writeU32(cell_ids_[network_->cell(inst)]);
+  writeAttributes(network_->attributeMap(inst));
+
+  uint32_t net_count = 0;
+  NetIterator *count_iter = network_->netIterator(inst);
+  while (count_iter->hasNext()) {
+    count_iter->next();
+    net_count++;
+  }
+  delete count_iter;
+  writeU32(net_count);
+  NetIterator *net_iter = network_->netIterator(inst);
+  while (net_iter->hasNext()) {
+    Net *net = net_iter->next();
+    net_ids_[net] = static_cast<uint32_t>(net_ids_.size());
+    writeString(network_->name(net));
+  }
+  delete net_iter;
+
+  uint32_t child_count = 0;
+  InstanceChildIterator *count_child_iter = network_->childIterator(inst);
+  while (count_child_iter->hasNext()) {
+    count_child_iter->next();
+    child_count++;
+  }
+  delete count_child_iter;
+  writeU32(child_count);
+  InstanceChildIterator *child_iter = network_->childIterator(inst);
+  while (child_iter->hasNext())
+    writeInstance(child_iter->next());
+  delete child_iter;
+
+  InstancePinIterator *pin_iter = network_->pinIterator(inst);
+  while (pin_iter->hasNext()) {
+    pin_iter->next();
+    pin_count_++;
+  }
+  delete pin_iter;
+}
+
+void
+NetworkSnapshotWriter::writePins()
+{
+  writeU32(pin_count_);
+  writeInstancePins(network_->topInstance());
+}
+
+void
+NetworkSnapshotWriter::writeInstancePins(const Instance *inst)
+{
+  InstancePinIterator *pin_iter = network_->pinIterator(inst);
+  while (pin_iter->hasNext()) {
+    const Pin *pin = pin_iter->next();
+    writeU32(inst_ids_[inst]);
+    writeString(network_->name(network_->port(pin)));
+    Net *net = network_->net(pin);
+    writeU32(net ? net_ids_[net] : snapshot_null_id);
+    Term *term = network_->term(pin);
+    writeBool(term != nullptr);
+    if (term)
+      writeU32(net_ids_[network_->net(term)]);
+  }
+  delete pin_iter;
+  InstanceChildIterator *child_iter = network_->childIterator(inst);
+  while (child_iter->hasNext())
+    writeInstancePins(child_iter->next());
+  delete child_iter;
+}
+
+void
+NetworkSnapshotWriter::writeConstantNets()
+{
+  Vector<std::pair<uint32_t, uint8_t>> constants;
+  Map<const Net*, bool> visited;
+  ConstantPinIterator *const_iter = network_->constantPinIterator();
+  while (const_iter->hasNext()) {
+    const Pin *pin;
+    LogicValue value;
+    const_iter->next(pin, value);
+    const Net *net = network_->net(pin);
+    if (net && !visited.hasKey(net)) {
+      visited[net] = true;
+      constants.push_back({net_ids_[net], static_cast<uint8_t>(value)});
+    }
+  }
+  delete const_iter;
+  writeU32(static_cast<uint32_t>(constants.size()));
+  for (const auto& [net_id, value] : constants) {
+    writeU32(net_id);
+    writeU8(value);
+  }
+}
+
+void
+NetworkSnapshotWriter::writeBool(bool value)
+{
+  writeU8(value ? 1 : 0);
+}
+
+void
+NetworkSnapshotWriter::writeU8(uint8_t value)
+{
+  out_.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void
+NetworkSnapshotWriter::writeU32(uint32_t value)
+{
+  out_.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void
+NetworkSnapshotWriter::writeI32(int32_t value)
+{
+  out_.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void
+NetworkSnapshotWriter::writeString(const char *str)
+{
+  uint32_t length = str ? strlen(str) : 0;
+  writeU32(length);
+  if (length)
+    out_.write(str, length);
+}
+
+bool
+writeNetworkSnapshot(const char *filename,
+                     Network *network)
+{
+  NetworkSnapshotWriter writer(filename, network);
+  return writer.write();
+}
+
+////////////////////////////////////////////////////////////////
+//
+// Reader
+//
+////////////////////////////////////////////////////////////////
+
+struct NetworkSnapshotError {};
+
+class NetworkSnapshotReader
+{
+public:
+  NetworkSnapshotReader(const char *filename,
+                        NetworkReader *network);
+  ~NetworkSnapshotReader();
+  bool read();
+
+private:
+  bool mapFile(const char *filename);
+  void unmapFile();
+  void readCells();
+  Cell *readCell();
+  void readAttributes(const Cell *cell);
+  void readAttributes(const Instance *inst);
+  Instance *readInstance(Instance *parent);
+  void readPins();
+  void readConstantNets();
+  void cleanup();
+
+  bool readBool();
+  uint8_t readU8();
+  uint32_t readU32();
+  int32_t readI32();
+  string readString();
+
+  const char *filename_;
+  NetworkReader *network_;
+  Report *report_;
+  Vector<Cell*> cells_;
+  Vector<Instance*> insts_;
+  Vector<Net*> nets_;
+  Map<string, Library*> library_map_;
+  Instance *top_instance_;
+
+  const char *data_;
+  const char *cursor_;
+  const char *end_;
+  size_t map_length_;
+#ifndef _WIN32
+  int fd_;
+#endif
+};
+
+NetworkSnapshotReader::NetworkSnapshotReader(const char *filename,
+                                             NetworkReader *network) :
+  filename_(filename),
+  network_(network),
+  report_(network->report()),
+  top_instance_(nullptr),
+  data_(nullptr),
+  cursor_(nullptr),
+  end_(nullptr),
+  map_length_(0)
+#ifndef _WIN32
+  , fd_(-1)
+#endif
+{
+}
+
+NetworkSnapshotReader::~NetworkSnapshotReader()
+{
+  unmapFile();
+}
+
+bool
+NetworkSnapshotReader::read()
+{
+  ConcreteNetwork *cnetwork = dynamic_cast<ConcreteNetwork*>(network_);
+  if (cnetwork == nullptr) {
+    report_->warn(2318, "network snapshots require the concrete network.");
+    return false;
+  }
+  if (!mapFile(filename_)) {
+    report_->warn(2319, "cannot read network snapshot file %s.", filename_);
+    return false;
+  }
+  try {
+    if (readU32() != snapshot_magic
+        || readU32() != snapshot_format_version) {
+      report_->warn(2320, "network snapshot file %s has an unsupported format.",
+                    filename_);
+      return false;
+    }
+    network_->readNetlistBefore();
+    readCells();
+    readInstance(nullptr);
+    readPins();
+    cnetwork->setTopInstance(top_instance_);
+    readConstantNets();
+    network_->checkNetworkLibertyCorners();
+    return true;
+  }
+  catch (NetworkSnapshotError &) {
+    report_->warn(2321, "network snapshot file %s is corrupt; ignored.",
+                  filename_);
+    cleanup();
+    return false;
+  }
+}
+
+void
+NetworkSnapshotReader::cleanup()
+{
+  if (top_instance_)
+    network_->deleteInstance(top_instance_);
+  top_instance_ = nullptr;
+  for (const auto& [name, library] : library_map_)
+    network_->deleteLibrary(library);
+  library_map_.clear();
+}
+
+void
+NetworkSnapshotReader::readCells()
+{
+  uint32_t cell_count = readU32();
+  cells_.reserve(cell_count);
+  for (uint32_t i = 0; i < cell_count; i++)
+    cells_.push_back(readCell());
+}
+
+Cell *
+NetworkSnapshotReader::readCell()
+{
+  bool is_liberty = readBool();
+  string library_name = readString();
+  string cell_name = readString();
+  if (is_liberty) {
+    Cell *cell = nullptr;
+    LibertyLibrary *library = network_->findLiberty(library_name.c_str());
+    if (library) {
+      LibertyCell *liberty_cell = library->findLibertyCell(cell_name.c_str());
+      cell = reinterpret_cast<Cell*>(liberty_cell);
+    }
+    if (cell == nullptr)
+      cell = network_->findAnyCell(cell_name.c_str());
+    if (cell == nullptr) {
+      report_->warn(2322,
+                    "network snapshot cell %s not found; read the liberty files before read_network_snapshot.",
+                    cell_name.c_str());
+      throw NetworkSnapshotError();
+    }
+    return cell;
+  }
+  else {
+    bool is_leaf = readBool();
+    Library *library = library_map_.findKey(library_name);
+    if (library == nullptr) {
+      library = network_->makeLibrary(library_name.c_str(), filename_);
+      library_map_[library_name] = library;
+    }
+    Cell *cell = network_->makeCell(library, cell_name.c_str(), is_leaf,
+                                    filename_);
+    readAttributes(cell);
+    uint32_t port_count = readU32();
+    for (uint32_t i = 0; i < port_count; i++) {
+      bool is_bus = readBool();
+      string port_name = readString();
+      string dir_name = readString();
+      Port *port;
+      if (is_bus) {
+        int32_t from_index = readI32();
+        int32_t to_index = readI32();
+        port = network_->makeBusPort(cell, port_name.c_str(),
+                                     from_index, to_index);
+      }
+      else
+        port = network_->makePort(cell, port_name.c_str());
+      PortDirection *dir = PortDirection::find(dir_name.c_str());
+      if (dir == nullptr)
+        throw NetworkSnapshotError();
+      network_->setDirection(port, dir);
+    }
+    return cell;
+  }
+}
+
+void
+NetworkSnapshotReader::readAttributes(const Cell *cell)
+{
+  uint32_t attr_count = readU32();
+  for (uint32_t i = 0; i < attr_count; i++) {
+    string key = readString();
+    string value = readString();
+    network_->setAttribute(const_cast<Cell*>(cell), key, value);
+  }
+}
+
+void
+NetworkSnapshotReader::readAttributes(const Instance *inst)
+{
+  uint32_t attr_count = readU32();
+  for (uint32_t i = 0; i < attr_count; i++) {
+    string key = readString();
+    string value = readString();
+    network_->setAttribute(const_cast<Instance*>(inst), key, value);
+  }
+}
+
+Instance *
+NetworkSnapshotReader::readInstance(Instance *parent)
+{
+  string name = readString();
+  uint32_t cell_id = readU32();
+  if (cell_id >= cells_.size())
+    throw NetworkSnapshotError();
+  Cell *cell = cells_[cell_id];
+  Instance *inst = network_->makeInstance(cell, name.c_str(), parent);
+  if (parent == nullptr)
+    top_instance_ = inst;
+  insts_.push_back(inst);
+  readAttributes(inst);
+
+  uint32_t net_count = readU32();
+  for (uint32_t i = 0; i < net_count; i++) {
+    string net_name = readString();
+    nets_.push_back(network_->makeNet(net_name.c_str(), inst));
+  }
+  uint32_t child_count = readU32();
+  for (uint32_t i = 0; i < child_count; i++)
+    readInstance(inst);
+  return inst;
+}
+
+void
+NetworkSnapshotReader::readPins()
+{
+  uint32_t pin_count = readU32();
+  for (uint32_t i = 0; i < pin_count; i++) {
+    uint32_t inst_id = readU32();
+    string port_name = readString();
+    uint32_t net_id = readU32();
+    bool has_term = readBool();
+    uint32_t term_net_id = has_term ? readU32() : snapshot_null_id;
+    if (inst_id >= insts_.size()
+        || (net_id != snapshot_null_id && net_id >= nets_.size())
+        || (has_term && term_net_id >= nets_.size()))
+      throw NetworkSnapshotError();
+    Instance *inst = insts_[inst_id];
+    Port *port = network_->findPort(network_->cell(inst), port_name.c_str());
+    if (port == nullptr)
+      throw NetworkSnapshotError();
+    Net *net = (net_id == snapshot_null_id) ? nullptr : nets_[net_id];
+    Pin *pin = network_->makePin(inst, port, net);
+    if (has_term)
+      network_->makeTerm(pin, nets_[term_net_id]);
+  }
+}
+
+void
+NetworkSnapshotReader::readConstantNets()
+{
+  uint32_t constant_count = readU32();
+  for (uint32_t i = 0; i < constant_count; i++) {
+    uint32_t net_id = readU32();
+    LogicValue value = static_cast<LogicValue>(readU8());
+    if (net_id >= nets_.size())
+      throw NetworkSnapshotError();
+    network_->addConstantNet(nets_[net_id], value);
+  }
+}
+
+bool
+NetworkSnapshotReader::mapFile(const char *filename)
+{
+#ifndef _WIN32
+  fd_ = open(filename, O_RDONLY);
+  if (fd_ < 0)
+    return false;
+  struct stat sbuf;
+  if (fstat(fd_, &sbuf) != 0
+      || sbuf.st_size == 0) {
+    close(fd_);
+    fd_ = -1;
+    return false;
+  }
+  map_length_ = sbuf.st_size;
+  void *map = mmap(nullptr, map_length_, PROT_READ, MAP_PRIVATE, fd_, 0);
+  if (map == MAP_FAILED) {
+    close(fd_);
+    fd_ = -1;
+    return false;
+  }
+  data_ = static_cast<const char*>(map);
+#else
+  std::ifstream in(filename, std::ios::binary | std::ios::ate);
+  if (!in.is_open())
+    return false;
+  map_length_ = in.tellg();
+  in.seekg(0);
+  char *buffer = new char[map_length_];
+  in.read(buffer, map_length_);
+  if (in.fail()) {
+    delete [] buffer;
+    return false;
+  }
+  data_ = buffer;
+#endif
+  cursor_ = data_;
+  end_ = data_ + map_length_;
+  return true;
+}
+
+void
+NetworkSnapshotReader::unmapFile()
+{
+#ifndef _WIN32
+  if (data_) {
+    munmap(const_cast<char*>(data_), map_length_);
+    close(fd_);
+    fd_ = -1;
+  }
+#else
+  delete [] data_;
+#endif
+  data_ = cursor_ = end_ = nullptr;
+}
+
+bool
+NetworkSnapshotReader::readBool()
+{
+  return readU8() != 0;
+}
+
+uint8_t
+NetworkSnapshotReader::readU8()
+{
+  if (cursor_ + sizeof(uint8_t) > end_)
+    throw NetworkSnapshotError();
+  uint8_t value;
+  memcpy(&value, cursor_, sizeof(value));
+  cursor_ += sizeof(value);
+  return value;
+}
+
+uint32_t
+NetworkSnapshotReader::readU32()
+{
+  if (cursor_ + sizeof(uint32_t) > end_)
+    throw NetworkSnapshotError();
+  uint32_t value;
+  memcpy(&value, cursor_, sizeof(value));
+  cursor_ += sizeof(value);
+  return value;
+}
+
+int32_t
+NetworkSnapshotReader::readI32()
+{
+  if (cursor_ + sizeof(int32_t) > end_)
+    throw NetworkSnapshotError();
+  int32_t value;
+  memcpy(&value, cursor_, sizeof(value));
+  cursor_ += sizeof(value);
+  return value;
+}
+
+string
+NetworkSnapshotReader::readString()
+{
+  uint32_t length = readU32();
+  if (cursor_ + length > end_)
+    throw NetworkSnapshotError();
+  string str(cursor_, length);
+  cursor_ += length;
+  return str;
+}
+
+bool
+readNetworkSnapshot(const char *filename,
+                    NetworkReader *network)
+{
+  NetworkSnapshotReader reader(filename, network);
+  return reader.read();
+}
+
+} // namespace
@@ -25,6 +25,7 @@
 #include "VerilogNamespace.hh"
 
 #include <cctype>
+#include <string_view>
 
 #include "StringUtil.hh"
 #include "ParseBus.hh"
@@ -32,6 +33,7 @@
 namespace sta {
 
 using std::string;
+using std::string_view;
 
 constexpr char verilog_escape = '\\';
 
@@ -40,7 +42,7 @@ staToVerilog(const char *sta_name);
 static string
 staToVerilog2(const char *sta_name);
 static string
-verilogToSta(const string *verilog_name);
+verilogToSta(string_view verilog_name);
 
 string
 cellVerilogName(const char *sta_name)
@@ -156,44 +158,44 @@ staToVerilog2(const char *sta_name)
 ////////////////////////////////////////////////////////////////
 
 string
-moduleVerilogToSta(const string *module_name)
+moduleVerilogToSta(string_view module_name)
 {
   return verilogToSta(module_name);
 }
 
 string
-instanceVerilogToSta(const string *inst_name)
+instanceVerilogToSta(string_view inst_name)
 {
   return verilogToSta(inst_name);
 }
 
 string
-netVerilogToSta(const string *net_name)
+netVerilogToSta(string_view net_name)
 {
   return verilogToSta(net_name);
 }
 
 string
-portVerilogToSta(const string *port_name)
+portVerilogToSta(string_view port_name)
 {
   return verilogToSta(port_name);
 }
 
 static string
-verilogToSta(const string *verilog_name)
+verilogToSta(string_view verilog_name)
 {
-  if (verilog_name->front() == '\\') {
+  if (verilog_name.front() == '\\') {
     constexpr char divider = '/';
     constexpr char bus_brkt_left = '[';
     constexpr char bus_brkt_right = ']';
 
-    size_t verilog_name_length = verilog_name->size();
-    if (isspace(verilog_name->back()))
+    size_t verilog_name_length = verilog_name.size();
+    if (isspace(verilog_name.back()))
       verilog_name_length--;
     string sta_name;
     // Ignore leading '\'.
     for (size_t i = 1; i < verilog_name_length; i++) {
-      char ch = verilog_name->at(i);
+      char ch = verilog_name[i];
       if (ch == bus_brkt_left
           || ch == bus_brkt_right
           || ch == divider
@@ -205,7 +207,7 @@ verilogToSta(const string *verilog_name)
     return sta_name;
   }
   else
-    return string(*verilog_name);
+    return string(verilog_name);
 }
 
 } // namespace
@@ -28,8 +28,8 @@
 
 #include "Report.hh"
 #include "Debug.hh"
+#include "DispatchQueue.hh"
 #include "Error.hh"
-#include "Mutex.hh"
 #include "Set.hh"
 #include "MinMax.hh"
 #include "Network.hh"
@@ -39,6 +39,7 @@
 #include "Parasitics.hh"
 #include "MakeConcreteParasitics.hh"
 #include "ConcreteParasiticsPvt.hh"
+#include "ArcDelayCalc.hh"
 #include "Corner.hh"
 
 // Multiple inheritance is used to share elmore and pi model base
@@ -108,6 +109,12 @@ ConcreteParasitic::setIsReduced(bool)
 {
 }
 
+size_t
+ConcreteParasitic::memoryUsage() const
+{
+  return 0;
+}
+
 void
 ConcreteParasitic::findElmore(const Pin *,
 			      float &,
@@ -259,6 +266,15 @@ ConcretePiElmore::unannotatedLoads(const Pin *drvr_pin,
   return loads;
 }
 
+size_t
+ConcretePiElmore::memoryUsage() const
+{
+  // Four pointers of tree node overhead per map entry.
+  return sizeof(*this)
+    + loads_.size() * (sizeof(ConcreteElmoreLoadMap::value_type)
+		       + sizeof(void*) * 4);
+}
+
 ////////////////////////////////////////////////////////////////
 
 ConcretePoleResidue::
@@ -382,6 +398,18 @@ ConcretePiPoleResidue::unannotatedLoads(const Pin *drvr_pin,
   return loads;
 }
 
+size_t
+ConcretePiPoleResidue::memoryUsage() const
+{
+  // Four pointers of tree node overhead per map entry.
+  size_t bytes = sizeof(*this)
+    + load_pole_residue_.size() * (sizeof(ConcretePoleResidueMap::value_type)
+				   + sizeof(void*) * 4);
+  for (const auto& [load, pole_residue] : load_pole_residue_)
+    bytes += pole_residue.poleResidueCount() * sizeof(ComplexFloat) * 2;
+  return bytes;
+}
+
 ////////////////////////////////////////////////////////////////
 
 ConcreteParasiticNode::ConcreteParasiticNode(const Net *net,
@@ -504,44 +532,32 @@ ConcreteParasiticNetwork::ConcreteParasiticNetwork(const Net *net,
 
 ConcreteParasiticNetwork::~ConcreteParasiticNetwork()
 {
-  deleteDevices();
-  deleteNodes();
-}
-
-void
-ConcreteParasiticNetwork::deleteNodes()
-{
-  for (const auto& [id, node] : sub_nodes_)
-    delete node;
-  for (const auto& [pin, node] : pin_nodes_)
-    delete node;
-}
-
-void
-ConcreteParasiticNetwork::deleteDevices()
-{
-  for (ParasiticResistor *resistor : resistors_) {
-    ConcreteParasiticResistor *cresistor =
-      reinterpret_cast<ConcreteParasiticResistor*>(resistor);
-    delete cresistor;
-  }
-  for (ParasiticCapacitor *capacitor : capacitors_) {
-    ConcreteParasiticCapacitor *ccapacitor =
-      reinterpret_cast<ConcreteParasiticCapacitor*>(capacitor);
-    delete ccapacitor;
-  }
+  // Nodes and devices are trivially destructible; the arena releases
+  // their storage.
 }
 
-void
-ConcreteParasiticNetwork::addResistor(ParasiticResistor *resistor)
+ParasiticResistor *
+ConcreteParasiticNetwork::makeResistor(size_t id,
+                                       float res,
+                                       ConcreteParasiticNode *node1,
+                                       ConcreteParasiticNode *node2)
 {
+  ParasiticResistor *resistor =
+    new (arena_) ConcreteParasiticResistor(id, res, node1, node2);
   resistors_.push_back(resistor);
+  return resistor;
 }
 
-void
-ConcreteParasiticNetwork::addCapacitor(ParasiticCapacitor *capacitor)
+ParasiticCapacitor *
+ConcreteParasiticNetwork::makeCapacitor(size_t id,
+                                        float cap,
+                                        ConcreteParasiticNode *node1,
+                                        ConcreteParasiticNode *node2)
 {
+  ParasiticCapacitor *capacitor =
+    new (arena_) ConcreteParasiticCapacitor(id, cap, node1, node2);
   capacitors_.push_back(capacitor);
+  return capacitor;
 }
 
 ParasiticNodeSeq
@@ -578,6 +594,28 @@ ConcreteParasiticNetwork::capacitance() const
   return cap;
 }
 
+size_t
+ConcreteParasiticNetwork::objectCount() const
+{
+  return sub_nodes_.size() + pin_nodes_.size()
+    + resistors_.size() + capacitors_.size();
+}
+
+size_t
+ConcreteParasiticNetwork::memoryUsage() const
+{
+  // Node and device storage is carved from the arena; the maps add
+  // four pointers of tree node overhead per entry.
+  return sizeof(*this)
+    + arena_.memoryUsage()
+    + resistors_.capacity() * sizeof(ParasiticResistor*)
+    + capacitors_.capacity() * sizeof(ParasiticCapacitor*)
+    + sub_nodes_.size() * (sizeof(ConcreteParasiticSubNodeMap::value_type)
+			   + sizeof(void*) * 4)
+    + pin_nodes_.size() * (sizeof(ConcreteParasiticPinNodeMap::value_type)
+			   + sizeof(void*) * 4);
+}
+
 ConcreteParasiticNode *
 ConcreteParasiticNetwork::findParasiticNode(const Net *net,
                                             int id,
@@ -611,7 +649,8 @@ ConcreteParasiticNetwork::ensureParasiticNode(const Net *net,
   auto id_node = sub_nodes_.find(net_id);
   if (id_node == sub_nodes_.end()) {
     Net *net1 = network->highestNetAbove(const_cast<Net*>(net));
-    node = new ConcreteParasiticNode(net, id, network->highestNetAbove(net1) != net_);
+    node = new (arena_) ConcreteParasiticNode(net, id,
+                                              network->highestNetAbove(net1) != net_);
     sub_nodes_[net_id] = node;
     if (net == net_)
       max_node_id_ = max((int) max_node_id_, id);
@@ -638,7 +677,7 @@ ConcreteParasiticNetwork::ensureParasiticNode(const Pin *pin,
     }
     else if (net)
       net = network->highestNetAbove(net);
-    node = new ConcreteParasiticNode(pin, net != net_);
+    node = new (arena_) ConcreteParasiticNode(pin, net != net_);
     pin_nodes_[pin] = node;
   }
   else
@@ -722,7 +761,7 @@ ConcreteParasiticNetwork::disconnectPin(const Pin *pin,
     }
 
     pin_nodes_.erase(pin_node);
-    delete node;
+    // The node storage stays in the arena.
   }
 }
 
@@ -755,7 +794,8 @@ makeConcreteParasitics(StaState *sta)
 }
 
 ConcreteParasitics::ConcreteParasitics(StaState *sta) :
-  Parasitics(sta)
+  Parasitics(sta),
+  network_loader_(nullptr)
 {
 }
 
@@ -768,7 +808,15 @@ bool
 ConcreteParasitics::haveParasitics()
 {
   return !drvr_parasitic_map_.empty()
-    || !parasitic_network_map_.empty();
+    || !parasitic_network_map_.empty()
+    || network_loader_ != nullptr;
+}
+
+void
+ConcreteParasitics::setNetworkLoader(ParasiticNetworkLoader *loader)
+{
+  delete network_loader_;
+  network_loader_ = loader;
 }
 
 void
@@ -787,32 +835,73 @@ ConcreteParasitics::parasiticAnalysisPtIndex(const ParasiticAnalysisPt *ap,
 void
 ConcreteParasitics::deleteParasitics()
 {
+  delete network_loader_;
+  network_loader_ = nullptr;
+
   int ap_count = corners_->parasiticAnalysisPtCount();
   int ap_rf_count = ap_count * RiseFall::index_count;
-  for (const auto [drvr, parasitics] : drvr_parasitic_map_) {
+  drvr_parasitic_map_.forEach([&](const Pin *,
+				  ConcreteParasitic **parasitics) {
     if (parasitics) {
       for (int i = 0; i < ap_rf_count; i++)
 	delete parasitics[i];
       delete [] parasitics;
     }
-  }
+  });
   drvr_parasitic_map_.clear();
 
-  for (const auto [net, parasitics] : parasitic_network_map_) {
+  parasitic_network_map_.forEach([&](const Net *,
+				     ConcreteParasiticNetwork **parasitics) {
     if (parasitics) {
       for (int i = 0; i < ap_count; i++)
 	delete parasitics[i];
       delete [] parasitics;
     }
-  }
+  });
   parasitic_network_map_.clear();
 }
 
+void
+ConcreteParasitics::memoryUsage(size_t &object_count,
+				size_t &bytes) const
+{
+  object_count = 0;
+  bytes = 0;
+  int ap_count = corners_->parasiticAnalysisPtCount();
+  int ap_rf_count = ap_count * RiseFall::index_count;
+  drvr_parasitic_map_.forEach([&](const Pin *,
+				  ConcreteParasitic **parasitics) {
+    if (parasitics) {
+      bytes += ap_rf_count * sizeof(ConcreteParasitic*);
+      for (int i = 0; i < ap_rf_count; i++) {
+	ConcreteParasitic *parasitic = parasitics[i];
+	if (parasitic) {
+	  object_count++;
+	  bytes += parasitic->memoryUsage();
+	}
+      }
+    }
+  });
+  parasitic_network_map_.forEach([&](const Net *,
+				     ConcreteParasiticNetwork **parasitics) {
+    if (parasitics) {
+      bytes += ap_count * sizeof(ConcreteParasiticNetwork*);
+      for (int i = 0; i < ap_count; i++) {
+	ConcreteParasiticNetwork *parasitic = parasitics[i];
+	if (parasitic) {
+	  object_count += parasitic->objectCount() + 1;
+	  bytes += parasitic->memoryUsage();
+	}
+      }
+    }
+  });
+}
+
 void
 ConcreteParasitics::deleteParasitics(const Pin *drvr_pin,
 				     const ParasiticAnalysisPt *ap)
 {
-  ConcreteParasitic **parasitics = drvr_parasitic_map_[drvr_pin];
+  ConcreteParasitic **parasitics = drvr_parasitic_map_.findKey(drvr_pin);
   if (parasitics) {
     for (auto rf : RiseFall::range()) {
       int ap_rf_index = parasiticAnalysisPtIndex(ap, rf);
@@ -825,7 +914,7 @@ ConcreteParasitics::deleteParasitics(const Pin *drvr_pin,
 void
 ConcreteParasitics::deleteParasitics(const Pin *drvr_pin)
 {
-  ConcreteParasitic **parasitics = drvr_parasitic_map_[drvr_pin];
+  ConcreteParasitic **parasitics = drvr_parasitic_map_.findKey(drvr_pin);
   if (parasitics) {
     int ap_count = corners_->parasiticAnalysisPtCount();
     int ap_rf_count = ap_count * RiseFall::index_count;
@@ -844,7 +933,7 @@ ConcreteParasitics::deleteParasitics(const Net *net,
   for (auto drvr_pin : *drivers)
     deleteParasitics(drvr_pin, ap);
 
-  ConcreteParasiticNetwork **parasitics = parasitic_network_map_[net];
+  ConcreteParasiticNetwork **parasitics = parasitic_network_map_.findKey(net);
   if (parasitics) {
     delete parasitics[ap->index()];
     parasitics[ap->index()] = nullptr;
@@ -882,7 +971,7 @@ ConcreteParasitics::disconnectPinBefore(const Pin *pin,
 
     const Net *net = findParasiticNet(pin);
     if (net) {
-      ConcreteParasiticNetwork **parasitics = parasitic_network_map_[net];
+      ConcreteParasiticNetwork **parasitics = parasitic_network_map_.findKey(net);
       if (parasitics) {
         int ap_count = corners_->parasiticAnalysisPtCount();
 	for (int i = 0; i < ap_count; i++) {
@@ -938,8 +1027,7 @@ ConcreteParasitics::deleteReducedParasitics(const Pin *pin)
 void
 ConcreteParasitics::deleteDrvrReducedParasitics(const Pin *drvr_pin)
 {
-  LockGuard lock(lock_);
-  ConcreteParasitic **parasitics = drvr_parasitic_map_[drvr_pin];
+  ConcreteParasitic **parasitics = drvr_parasitic_map_.findKey(drvr_pin);
   if (parasitics) {
     int ap_count = corners_->parasiticAnalysisPtCount();
     int ap_rf_count = ap_count * RiseFall::index_count;
@@ -947,15 +1035,14 @@ ConcreteParasitics::deleteDrvrReducedParasitics(const Pin *drvr_pin)
       delete parasitics[i];
     delete [] parasitics;
   }
-  drvr_parasitic_map_[drvr_pin] = nullptr;
+  drvr_parasitic_map_.insert(drvr_pin, nullptr);
 }
 
 void
 ConcreteParasitics::deleteDrvrReducedParasitics(const Pin *drvr_pin,
                                                 const ParasiticAnalysisPt *ap)
 {
-  LockGuard lock(lock_);
-  ConcreteParasitic **parasitics = drvr_parasitic_map_[drvr_pin];
+  ConcreteParasitic **parasitics = drvr_parasitic_map_.findKey(drvr_pin);
   if (parasitics) {
     int ap_index = ap->index();
     delete parasitics[ap_index];
@@ -977,7 +1064,6 @@ ConcreteParasitics::findPiElmore(const Pin *drvr_pin,
 				 const RiseFall *rf,
 				 const ParasiticAnalysisPt *ap) const
 {
-  LockGuard lock(lock_);
   if (!drvr_parasitic_map_.empty()) {
     int ap_rf_index = parasiticAnalysisPtIndex(ap, rf);
     ConcreteParasitic **parasitics = drvr_parasitic_map_.findKey(drvr_pin);
@@ -998,16 +1084,15 @@ ConcreteParasitics::makePiElmore(const Pin *drvr_pin,
 				 float rpi,
 				 float c1)
 {
-  LockGuard lock(lock_);
-  ConcreteParasitic **parasitics = drvr_parasitic_map_.findKey(drvr_pin);
-  if (parasitics == nullptr) {
-    int ap_count = corners_->parasiticAnalysisPtCount();
-    int ap_rf_count = ap_count * RiseFall::index_count;
-    parasitics = new ConcreteParasitic*[ap_rf_count];
-    for (int i = 0; i < ap_rf_count; i++)
-      parasitics[i] = nullptr;
-    drvr_parasitic_map_[drvr_pin] = parasitics;
-  }
+  ConcreteParasitic **parasitics =
+    drvr_parasitic_map_.findOrInsert(drvr_pin, [this]() {
+      int ap_count = corners_->parasiticAnalysisPtCount();
+      int ap_rf_count = ap_count * RiseFall::index_count;
+      ConcreteParasitic **parasitics = new ConcreteParasitic*[ap_rf_count];
+      for (int i = 0; i < ap_rf_count; i++)
+	parasitics[i] = nullptr;
+      return parasitics;
+    });
   int ap_rf_index = parasiticAnalysisPtIndex(ap, rf);
   ConcreteParasitic *parasitic = parasitics[ap_rf_index];
   ConcretePiElmore *pi_elmore = nullptr;
@@ -1095,7 +1180,6 @@ ConcreteParasitics::findPiPoleResidue(const Pin *drvr_pin,
 {
   if (!drvr_parasitic_map_.empty()) {
     int ap_rf_index = parasiticAnalysisPtIndex(ap, rf);
-    LockGuard lock(lock_);
     ConcreteParasitic **parasitics = drvr_parasitic_map_.findKey(drvr_pin);
     if (parasitics) {
       ConcreteParasitic *parasitic = parasitics[ap_rf_index];
@@ -1118,16 +1202,15 @@ ConcreteParasitics::makePiPoleResidue(const Pin *drvr_pin,
 				      float rpi,
 				      float c1)
 {
-  LockGuard lock(lock_);
-  ConcreteParasitic **parasitics = drvr_parasitic_map_.findKey(drvr_pin);
-  if (parasitics == nullptr) {
-    int ap_count = corners_->parasiticAnalysisPtCount();
-    int ap_rf_count = ap_count * RiseFall::index_count;
-    parasitics = new ConcreteParasitic*[ap_rf_count];
-    for (int i = 0; i < ap_rf_count; i++)
-      parasitics[i] = nullptr;
-    drvr_parasitic_map_[drvr_pin] = parasitics;
-  }
+  ConcreteParasitic **parasitics =
+    drvr_parasitic_map_.findOrInsert(drvr_pin, [this]() {
+      int ap_count = corners_->parasiticAnalysisPtCount();
+      int ap_rf_count = ap_count * RiseFall::index_count;
+      ConcreteParasitic **parasitics = new ConcreteParasitic*[ap_rf_count];
+      for (int i = 0; i < ap_rf_count; i++)
+	parasitics[i] = nullptr;
+      return parasitics;
+    });
   int ap_rf_index = parasiticAnalysisPtIndex(ap, rf);
   ConcreteParasitic *parasitic = parasitics[ap_rf_index];
   ConcretePiPoleResidue *pi_pole_residue = nullptr;
@@ -1212,17 +1295,21 @@ ConcreteParasitics::findParasiticNetwork(const Net *net,
 					 const ParasiticAnalysisPt *ap) const
 {
   if (!parasitic_network_map_.empty()) {
-    LockGuard lock(lock_);
-    if (!parasitic_network_map_.empty()) {
-      ConcreteParasiticNetwork **parasitics=parasitic_network_map_.findKey(net);
-      if (parasitics) {
-        ConcreteParasiticNetwork *parasitic = parasitics[ap->index()];
-        if (parasitic == nullptr)
-          parasitic = parasitics[ap->indexMax()];
-	return parasitic;
-      }
+    ConcreteParasiticNetwork *parasitic = nullptr;
+    ConcreteParasiticNetwork **parasitics = parasitic_network_map_.findKey(net);
+    if (parasitics) {
+      parasitic = parasitics[ap->index()];
+      if (parasitic == nullptr)
+        parasitic = parasitics[ap->indexMax()];
+    }
+    if (parasitic) {
+      if (network_loader_)
+	network_loader_->used(net);
+      return parasitic;
     }
   }
+  if (network_loader_)
+    return network_loader_->loadParasiticNetwork(net, ap);
   return nullptr;
 }
 
@@ -1230,19 +1317,23 @@ Parasitic *
 ConcreteParasitics::findParasiticNetwork(const Pin *pin,
 					 const ParasiticAnalysisPt *ap) const
 {
-  if (!parasitic_network_map_.empty()) {
-    LockGuard lock(lock_);
-    if (!parasitic_network_map_.empty()) {
-      // Only call findParasiticNet if parasitics exist.
-      const Net *net = findParasiticNet(pin);
-      ConcreteParasiticNetwork **parasitics=parasitic_network_map_.findKey(net);
-      if (parasitics) {
-        ConcreteParasiticNetwork *parasitic = parasitics[ap->index()];
-        if (parasitic == nullptr)
-          parasitic = parasitics[ap->indexMax()];
-	return parasitic;
-      }
+  if (!parasitic_network_map_.empty()
+      || network_loader_) {
+    const Net *net = findParasiticNet(pin);
+    ConcreteParasiticNetwork *parasitic = nullptr;
+    ConcreteParasiticNetwork **parasitics = parasitic_network_map_.findKey(net);
+    if (parasitics) {
+      parasitic = parasitics[ap->index()];
+      if (parasitic == nullptr)
+        parasitic = parasitics[ap->indexMax()];
     }
+    if (parasitic) {
+      if (network_loader_)
+	network_loader_->used(net);
+      return parasitic;
+    }
+    if (network_loader_ && net)
+      return network_loader_->loadParasiticNetwork(net, ap);
   }
   return nullptr;
 }
@@ -1252,15 +1343,15 @@ ConcreteParasitics::makeParasiticNetwork(const Net *net,
 					 bool includes_pin_caps,
 					 const ParasiticAnalysisPt *ap)
 {
-  LockGuard lock(lock_);
-  ConcreteParasiticNetwork **parasitics = parasitic_network_map_.findKey(net);
-  if (parasitics == nullptr) {
-    int ap_count = corners_->parasiticAnalysisPtCount();
-    parasitics = new ConcreteParasiticNetwork*[ap_count];
-    for (int i = 0; i < ap_count; i++)
-      parasitics[i] = nullptr;
-    parasitic_network_map_[net] = parasitics;
-  }
+  ConcreteParasiticNetwork **parasitics =
+    parasitic_network_map_.findOrInsert(net, [this]() {
+      int ap_count = corners_->parasiticAnalysisPtCount();
+      ConcreteParasiticNetwork **parasitics =
+	new ConcreteParasiticNetwork*[ap_count];
+      for (int i = 0; i < ap_count; i++)
+	parasitics[i] = nullptr;
+      return parasitics;
+    });
   int ap_index = ap->index();
   ConcreteParasiticNetwork *parasitic = parasitics[ap_index];
   if (parasitic) {
@@ -1275,12 +1366,62 @@ ConcreteParasitics::makeParasiticNetwork(const Net *net,
   return parasitic;
 }
 
+// Reduce all annotated parasitic networks on the dispatch queue
+// threads before delay calculation instead of reducing nets one at a
+// time inside it.  The reduced models are stored thru makePiElmore
+// and friends, which lock the shared maps.
+void
+ConcreteParasitics::reduceParasitics()
+{
+  int ap_count = corners_->parasiticAnalysisPtCount();
+  // Analysis points are shared across corners unless parasitics are
+  // annotated per corner.
+  bool per_corner = ap_count > MinMax::index_count;
+  Vector<bool> reduced_aps(ap_count, false);
+  for (Corner *corner : *corners_) {
+    for (const MinMax *min_max : MinMax::range()) {
+      ParasiticAnalysisPt *ap = corner->findParasiticAnalysisPt(min_max);
+      if (ap && !reduced_aps[ap->index()]) {
+        reduced_aps[ap->index()] = true;
+        const Corner *reduce_corner = per_corner ? corner : nullptr;
+        const MinMaxAll *reduce_min_max = min_max->asMinMaxAll();
+        for (ConcreteParasiticNetwork *cnetwork : parasiticNetworks(ap)) {
+          if (dispatch_queue_ && dispatch_queue_->getThreadCount() > 1)
+            dispatch_queue_->dispatch([this, cnetwork, reduce_corner,
+                                       reduce_min_max](int) {
+              arc_delay_calc_->reduceParasitic(cnetwork, cnetwork->net(),
+                                               reduce_corner, reduce_min_max);
+            });
+          else
+            arc_delay_calc_->reduceParasitic(cnetwork, cnetwork->net(),
+                                             reduce_corner, reduce_min_max);
+        }
+      }
+    }
+  }
+  if (dispatch_queue_)
+    dispatch_queue_->finishTasks();
+}
+
+ConcreteParasiticNetworkSeq
+ConcreteParasitics::parasiticNetworks(const ParasiticAnalysisPt *ap) const
+{
+  ConcreteParasiticNetworkSeq networks;
+  int ap_index = ap->index();
+  parasitic_network_map_.forEach([&](const Net *,
+				     ConcreteParasiticNetwork **parasitics) {
+    ConcreteParasiticNetwork *parasitic = parasitics[ap_index];
+    if (parasitic)
+      networks.push_back(parasitic);
+  });
+  return networks;
+}
+
 void
 ConcreteParasitics::deleteParasiticNetwork(const Net *net,
 					   const ParasiticAnalysisPt *ap)
 {
   if (!parasitic_network_map_.empty()) {
-    LockGuard lock(lock_);
     ConcreteParasiticNetwork **parasitics = parasitic_network_map_.findKey(net);
     if (parasitics) {
       int ap_index = ap->index();
@@ -1307,7 +1448,6 @@ void
 ConcreteParasitics::deleteParasiticNetworks(const Net *net)
 {
   if (!parasitic_network_map_.empty()) {
-    LockGuard lock(lock_);
     ConcreteParasiticNetwork **parasitics = parasitic_network_map_.findKey(net);
     if (parasitics) {
       int ap_count = corners_->parasiticAnalysisPtCount();
@@ -1396,11 +1536,9 @@ ConcreteParasitics::makeCapacitor(Parasitic *parasitic,
 {
   ConcreteParasiticNode *cnode1 = static_cast<ConcreteParasiticNode*>(node1);
   ConcreteParasiticNode *cnode2 = static_cast<ConcreteParasiticNode*>(node2);
-  ConcreteParasiticCapacitor *capacitor =
-    new ConcreteParasiticCapacitor(index, cap, cnode1, cnode2);
   ConcreteParasiticNetwork *cparasitic =
     static_cast<ConcreteParasiticNetwork*>(parasitic);
-  cparasitic->addCapacitor(capacitor);
+  cparasitic->makeCapacitor(index, cap, cnode1, cnode2);
 }
 
 void
@@ -1412,11 +1550,9 @@ ConcreteParasitics::makeResistor(Parasitic *parasitic,
 {
   ConcreteParasiticNode *cnode1 = static_cast<ConcreteParasiticNode*>(node1);
   ConcreteParasiticNode *cnode2 = static_cast<ConcreteParasiticNode*>(node2);
-  ParasiticResistor *resistor = new ConcreteParasiticResistor(index, res,
-                                                              cnode1, cnode2);
   ConcreteParasiticNetwork *cparasitic =
     static_cast<ConcreteParasiticNetwork*>(parasitic);
-  cparasitic->addResistor(resistor);
+  cparasitic->makeResistor(index, res, cnode1, cnode2);
 }
 
 ParasiticNodeSeq
@@ -24,10 +24,9 @@
 
 #pragma once
 
-#include <mutex>
-
-#include "Map.hh"
 #include "Set.hh"
+#include "ShardedMap.hh"
+#include "Vector.hh"
 #include "MinMax.hh"
 #include "Parasitics.hh"
 
@@ -36,8 +35,11 @@ namespace sta {
 class ConcreteParasitic;
 class ConcreteParasiticNetwork;
 
-typedef Map<const Pin*, ConcreteParasitic**> ConcreteParasiticMap;
-typedef Map<const Net*, ConcreteParasiticNetwork**> ConcreteParasiticNetworkMap;
+// Sharded so multi-threaded delay calculation threads looking up
+// parasitics for different pins/nets do not contend for one lock.
+typedef ShardedMap<const Pin*, ConcreteParasitic**> ConcreteParasiticMap;
+typedef ShardedMap<const Net*, ConcreteParasiticNetwork**> ConcreteParasiticNetworkMap;
+typedef Vector<ConcreteParasiticNetwork*> ConcreteParasiticNetworkSeq;
 
 // This class acts as a BUILDER for parasitics.
 class ConcreteParasitics : public Parasitics
@@ -47,6 +49,9 @@ public:
   virtual ~ConcreteParasitics();
   bool haveParasitics() override;
   void clear() override;
+  void memoryUsage(// Return values.
+                   size_t &object_count,
+                   size_t &bytes) const override;
 
   void deleteParasitics() override;
   void deleteParasitics(const Net *net,
@@ -118,9 +123,13 @@ public:
   Parasitic *makeParasiticNetwork(const Net *net,
                                   bool includes_pin_caps,
                                   const ParasiticAnalysisPt *ap) override;
+  void setNetworkLoader(ParasiticNetworkLoader *loader) override;
   void deleteParasiticNetwork(const Net *net,
                               const ParasiticAnalysisPt *ap) override;
   void deleteParasiticNetworks(const Net *net) override;
+  // All parasitic networks annotated for ap, for the spef cache writer.
+  ConcreteParasiticNetworkSeq parasiticNetworks(const ParasiticAnalysisPt *ap) const;
+  void reduceParasitics() override;
   const Net *net(const Parasitic *parasitic) const override;
   bool includesPinCaps(const Parasitic *parasitic) const override;
   ParasiticNode *findParasiticNode(Parasitic *parasitic,
@@ -193,7 +202,8 @@ protected:
   // and transition.
   ConcreteParasiticMap drvr_parasitic_map_;
   ConcreteParasiticNetworkMap parasitic_network_map_;
-  mutable std::mutex lock_;
+  // Faults networks into parasitic_network_map_ on demand (lazy spef).
+  ParasiticNetworkLoader *network_loader_;
 
   friend class ConcretePiElmore;
   friend class ConcreteParasiticNode;
@@ -27,6 +27,7 @@
 #include <map>
 #include <set>
 
+#include "Arena.hh"
 #include "Parasitics.hh"
 
 namespace sta {
@@ -94,6 +95,9 @@ public:
 			      ComplexFloatSeq *residues);
   virtual PinSet unannotatedLoads(const Pin *drvr_pin,
                                   const Parasitics *parasitics) const = 0;
+  // Approximate bytes of storage owned by the parasitic, for
+  // report_memory.
+  virtual size_t memoryUsage() const;
 };
 
 // Pi model for a driver pin.
@@ -147,6 +151,7 @@ public:
   PinSet unannotatedLoads(const Pin *drvr_pin,
                           const Parasitics *parasitics) const override;
   void deleteLoad(const Pin *load_pin);
+  size_t memoryUsage() const override;
 
 private:
   ConcreteElmoreLoadMap loads_;
@@ -201,6 +206,7 @@ public:
   virtual PinSet unannotatedLoads(const Pin *drvr_pin,
                                   const Parasitics *parasitics) const override;
   void deleteLoad(const Pin *load_pin);
+  size_t memoryUsage() const override;
 
 private:
   ConcretePoleResidueMap load_pole_residue_;
@@ -232,11 +238,20 @@ public:
 		     const Net *net,
                      const Network *network);
   ParasiticResistorSeq resistors() const { return resistors_; }
-  void addResistor(ParasiticResistor *resistor);
+  ParasiticResistor *makeResistor(size_t id,
+                                  float res,
+                                  ConcreteParasiticNode *node1,
+                                  ConcreteParasiticNode *node2);
   ParasiticCapacitorSeq capacitors() const { return capacitors_; }
-  void addCapacitor(ParasiticCapacitor *capacitor);
+  ParasiticCapacitor *makeCapacitor(size_t id,
+                                    float cap,
+                                    ConcreteParasiticNode *node1,
+                                    ConcreteParasiticNode *node2);
   virtual PinSet unannotatedLoads(const Pin *drvr_pin,
                                   const Parasitics *parasitics) const;
+  // Nodes and devices in the network.
+  size_t objectCount() const;
+  size_t memoryUsage() const override;
 
 private:
   void unannotatedLoads(ParasiticNode *node,
@@ -247,14 +262,15 @@ private:
                         ParasiticNodeResistorMap &resistor_map,
                         const Parasitics *parasitics) const;
 
-  void deleteNodes();
-  void deleteDevices();
-
   const Net *net_;
   ConcreteParasiticSubNodeMap sub_nodes_;
   ConcreteParasiticPinNodeMap pin_nodes_;
   ParasiticResistorSeq resistors_;
   ParasiticCapacitorSeq capacitors_;
+  // Nodes and devices are carved from the network's arena so each
+  // net's rc tree is contiguous in memory for the reduction loops,
+  // and are released wholesale with the network.
+  Arena arena_;
   unsigned max_node_id_:31;
   bool includes_pin_caps_:1;
 };
@@ -305,7 +321,9 @@ public:
                    ConcreteParasiticNode *to_node);
 
 protected:
-  size_t id_;
+  // 32 bits is plenty for spef device indices and packs with value_,
+  // saving a word of padding per device.
+  unsigned id_;
   float value_;
   ConcreteParasiticNode *node1_;
   ConcreteParasiticNode *node2_;
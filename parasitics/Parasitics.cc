@@ -43,6 +43,14 @@ Parasitics::Parasitics(StaState *sta) :
 {
 }
 
+void
+Parasitics::memoryUsage(size_t &object_count,
+			size_t &bytes) const
+{
+  object_count = 0;
+  bytes = 0;
+}
+
 void
 Parasitics::report(const Parasitic *parasitic) const
 {
@@ -45,18 +45,52 @@ read_spef_cmd(const char *filename,
 	      bool pin_cap_included,
 	      bool keep_coupling_caps,
 	      float coupling_cap_factor,
+	      float coupling_cap_threshold,
 	      bool reduce)
 {
   return Sta::sta()->readSpef(filename, instance, corner, min_max,
 			      pin_cap_included, keep_coupling_caps,
-                              coupling_cap_factor, reduce);
+                              coupling_cap_factor, coupling_cap_threshold,
+                              reduce);
 }
 
 void
 report_parasitic_annotation_cmd(bool report_unannotated,
+                                int hierarchy_depth,
                                 const Corner *corner)
 {
-  Sta::sta()->reportParasiticAnnotation(report_unannotated, corner);
+  Sta::sta()->reportParasiticAnnotation(report_unannotated, hierarchy_depth,
+                                        corner);
+}
+
+void
+reduce_parasitics_cmd()
+{
+  Sta::sta()->reduceParasitics();
+}
+
+bool
+spef_cache_enabled()
+{
+  return Sta::sta()->spefCacheEnabled();
+}
+
+void
+set_spef_cache_enabled(bool enabled)
+{
+  Sta::sta()->setSpefCacheEnabled(enabled);
+}
+
+bool
+spef_lazy_enabled()
+{
+  return Sta::sta()->spefLazyEnabled();
+}
+
+void
+set_spef_lazy_enabled(bool enabled)
+{
+  Sta::sta()->setSpefLazyEnabled(enabled);
 }
 
 FloatSeq
@@ -32,13 +32,14 @@ define_cmd_args "read_spef" \
      [-pin_cap_included]\
      [-keep_capacitive_coupling]\
      [-coupling_reduction_factor factor]\
+     [-coupling_cap_threshold cap]\
      [-reduce]\
      [-delete_after_reduce]\
      filename}
 
 proc_redirect read_spef {
   parse_key_args "read_spef" args \
-    keys {-path -coupling_reduction_factor -corner -name} \
+    keys {-path -coupling_reduction_factor -coupling_cap_threshold -corner -name} \
     flags {-min -max -increment -pin_cap_included -keep_capacitive_coupling -reduce}
   check_argc_eq1 "read_spef" $args
 
@@ -58,24 +59,45 @@ proc_redirect read_spef {
     set coupling_reduction_factor $keys(-coupling_reduction_factor)
     check_positive_float "-coupling_reduction_factor" $coupling_reduction_factor
   }
+  set coupling_cap_threshold 0.0
+  if [info exists keys(-coupling_cap_threshold)] {
+    set coupling_cap_threshold $keys(-coupling_cap_threshold)
+    check_positive_float "-coupling_cap_threshold" $coupling_cap_threshold
+  }
   set keep_coupling_caps [info exists flags(-keep_capacitive_coupling)]
   set pin_cap_included [info exists flags(-pin_cap_included)]
 
   set filename [file nativename [lindex $args 0]]
   return [read_spef_cmd $filename $instance $corner $min_max \
 	    $pin_cap_included $keep_coupling_caps \
-            $coupling_reduction_factor $reduce]
+            $coupling_reduction_factor $coupling_cap_threshold $reduce]
 }
 
-define_cmd_args "report_parasitic_annotation" {[-report_unannotated]}
+define_cmd_args "reduce_parasitics" {}
+
+# Reduce annotated parasitic networks in parallel ahead of the first
+# timing update instead of net by net inside delay calculation.
+proc reduce_parasitics { args } {
+  check_argc_eq0 "reduce_parasitics" $args
+  reduce_parasitics_cmd
+}
+
+define_cmd_args "report_parasitic_annotation" \
+  {[-report_unannotated] [-hierarchy_depth depth]}
 
 proc_redirect report_parasitic_annotation {
   parse_key_args "report_parasitic_annotation" args \
-    keys {} flags {-report_unannotated}
+    keys {-hierarchy_depth} flags {-report_unannotated}
   check_argc_eq0 "report_parasitic_annotation" $args
 
   set report_unannotated [info exists flags(-report_unannotated)]
-  report_parasitic_annotation_cmd $report_unannotated [sta::cmd_corner]
+  set hierarchy_depth 0
+  if { [info exists keys(-hierarchy_depth)] } {
+    set hierarchy_depth $keys(-hierarchy_depth)
+    check_positive_integer "-hierarchy_depth" $hierarchy_depth
+  }
+  report_parasitic_annotation_cmd $report_unannotated $hierarchy_depth \
+    [sta::cmd_corner]
 }
 
 # set_pi_model [-min] [-max] drvr_pin c2 rpi c1
@@ -24,6 +24,8 @@
 
 #include "ReportParasiticAnnotation.hh"
 
+#include <algorithm>
+
 #include "Report.hh"
 #include "Network.hh"
 #include "NetworkCmp.hh"
@@ -33,6 +35,7 @@
 #include "Parasitics.hh"
 #include "DcalcAnalysisPt.hh"
 #include "ArcDelayCalc.hh"
+#include "DispatchQueue.hh"
 
 namespace sta {
 
@@ -40,17 +43,24 @@ class ReportParasiticAnnotation : public StaState
 {
 public:
   ReportParasiticAnnotation(bool report_unannotated,
+                            int hierarchy_depth,
                             const Corner *corner,
                             StaState *sta);
   void report();
 
 private:
   void reportAnnotationCounts();
+  void reportHierCounts();
   void findCounts();
-  void findCounts(Instance *inst);
-  void findCounts(Net *net);
+  void findCounts(Vertex *vertex,
+                  ArcDelayCalc *arc_delay_calc,
+                  DcalcAnalysisPt *dcalc_ap,
+                  PinSeq &unannotated,
+                  PinSeq &partially_annotated);
+  const Instance *hierAncestor(const Pin *pin);
 
   bool report_unannotated_;
+  int hierarchy_depth_;
   const Corner *corner_;
   const MinMax *min_max_;
   const ParasiticAnalysisPt *parasitic_ap_;
@@ -60,18 +70,22 @@ private:
 
 void
 reportParasiticAnnotation(bool report_unannotated,
+                          int hierarchy_depth,
                           const Corner *corner,
                           StaState *sta)
 {
-  ReportParasiticAnnotation report_annotation(report_unannotated, corner, sta);
+  ReportParasiticAnnotation report_annotation(report_unannotated,
+                                              hierarchy_depth, corner, sta);
   report_annotation.report();
 }
 
 ReportParasiticAnnotation::ReportParasiticAnnotation(bool report_unannotated,
+                                                     int hierarchy_depth,
                                                      const Corner *corner,
                                                      StaState *sta) :
   StaState(sta),
   report_unannotated_(report_unannotated),
+  hierarchy_depth_(hierarchy_depth),
   corner_(corner),
   min_max_(MinMax::max()),
   parasitic_ap_(corner_->findParasiticAnalysisPt(min_max_))
@@ -83,6 +97,8 @@ ReportParasiticAnnotation::report()
 {
   findCounts();
   reportAnnotationCounts();
+  if (hierarchy_depth_ > 0)
+    reportHierCounts();
 }
 
 void
@@ -112,29 +128,130 @@ ReportParasiticAnnotation::reportAnnotationCounts()
   }
 }
 
+// Sweep the driver vertices across the thread pool.  Each worker uses
+// its own ArcDelayCalc copy (as delay calculation does) and appends to
+// its own pin lists, merged on the main thread after the workers finish.
 void
 ReportParasiticAnnotation::findCounts()
 {
   DcalcAnalysisPt *dcalc_ap = corner_->findDcalcAnalysisPt(min_max_);
+  VertexSeq drvrs;
   VertexIterator vertex_iter(graph_);
   while (vertex_iter.hasNext()) {
     Vertex *vertex = vertex_iter.next();
-    Pin *pin = vertex->pin();
-    PortDirection *dir = network_->direction(pin);
+    PortDirection *dir = network_->direction(vertex->pin());
     if (vertex->isDriver(network_)
-        && !dir->isInternal()) {
-      Parasitic *parasitic = parasitics_->findParasiticNetwork(pin, parasitic_ap_);
-      if (parasitic == nullptr)
-        parasitic = arc_delay_calc_->findParasitic(pin, RiseFall::rise(), dcalc_ap);
-      if (parasitic) {
-        PinSet unannotated_loads = parasitics_->unannotatedLoads(parasitic, pin);
-        if (unannotated_loads.size() > 0)
-          partially_annotated_.push_back(pin);
-      }
-      else 
-        unannotated_.push_back(pin);
+        && !dir->isInternal())
+      drvrs.push_back(vertex);
+  }
+  size_t drvr_count = drvrs.size();
+  size_t thread_count = thread_count_;
+  if (dispatch_queue_
+      && thread_count > 1
+      && drvr_count >= thread_count) {
+    std::vector<PinSeq> unannotated(thread_count);
+    std::vector<PinSeq> partially_annotated(thread_count);
+    std::vector<ArcDelayCalc*> dcalcs(thread_count);
+    size_t chunk_size = drvr_count / thread_count + 1;
+    size_t from = 0;
+    for (size_t k = 0; k < thread_count; k++) {
+      dcalcs[k] = arc_delay_calc_->copy();
+      size_t to = std::min(from + chunk_size, drvr_count);
+      dispatch_queue_->dispatch([&, k, from, to](int) {
+        for (size_t i = from; i < to; i++)
+          findCounts(drvrs[i], dcalcs[k], dcalc_ap,
+                     unannotated[k], partially_annotated[k]);
+      });
+      from = to;
+    }
+    dispatch_queue_->finishTasks();
+    for (size_t k = 0; k < thread_count; k++) {
+      unannotated_.insert(unannotated_.end(),
+                          unannotated[k].begin(), unannotated[k].end());
+      partially_annotated_.insert(partially_annotated_.end(),
+                                  partially_annotated[k].begin(),
+                                  partially_annotated[k].end());
+      delete dcalcs[k];
     }
   }
+  else {
+    for (Vertex *vertex : drvrs)
+      findCounts(vertex, arc_delay_calc_, dcalc_ap,
+                 unannotated_, partially_annotated_);
+  }
+}
+
+void
+ReportParasiticAnnotation::findCounts(Vertex *vertex,
+                                      ArcDelayCalc *arc_delay_calc,
+                                      DcalcAnalysisPt *dcalc_ap,
+                                      PinSeq &unannotated,
+                                      PinSeq &partially_annotated)
+{
+  Pin *pin = vertex->pin();
+  Parasitic *parasitic = parasitics_->findParasiticNetwork(pin, parasitic_ap_);
+  if (parasitic == nullptr)
+    parasitic = arc_delay_calc->findParasitic(pin, RiseFall::rise(), dcalc_ap);
+  if (parasitic) {
+    PinSet unannotated_loads = parasitics_->unannotatedLoads(parasitic, pin);
+    if (unannotated_loads.size() > 0)
+      partially_annotated.push_back(pin);
+  }
+  else 
+    unannotated.push_back(pin);
+}
+
+// Summarize unannotated driver counts by hierarchy subtree so the
+// unannotated region of a large design can be found without reading
+// the per-pin listing.
+void
+ReportParasiticAnnotation::reportHierCounts()
+{
+  Map<const Instance*, std::pair<size_t, size_t>> subtree_counts;
+  for (const Pin *pin : unannotated_)
+    subtree_counts[hierAncestor(pin)].first++;
+  for (const Pin *pin : partially_annotated_)
+    subtree_counts[hierAncestor(pin)].second++;
+
+  std::vector<std::pair<const Instance*, std::pair<size_t, size_t>>>
+    sorted_counts(subtree_counts.begin(), subtree_counts.end());
+  std::sort(sorted_counts.begin(), sorted_counts.end(),
+            [this](const auto &count1, const auto &count2) {
+              size_t total1 = count1.second.first + count1.second.second;
+              size_t total2 = count2.second.first + count2.second.second;
+              if (total1 != total2)
+                return total1 > total2;
+              return stringLess(network_->pathName(count1.first),
+                                network_->pathName(count2.first));
+            });
+  report_->reportLine("Unannotated drivers by hierarchy subtree (depth %d):",
+                      hierarchy_depth_);
+  report_->reportLine(" unannotated partial instance");
+  const Instance *top = network_->topInstance();
+  for (const auto &[inst, counts] : sorted_counts)
+    report_->reportLine(" %11zu %7zu %s",
+                        counts.first,
+                        counts.second,
+                        inst == top ? network_->name(top)
+                                    : network_->pathName(inst));
+}
+
+// Ancestor of the pin's instance hierarchy_depth_ levels below the
+// top instance (or the instance itself if it is shallower).
+const Instance *
+ReportParasiticAnnotation::hierAncestor(const Pin *pin)
+{
+  const Instance *top = network_->topInstance();
+  std::vector<const Instance*> ancestors;
+  for (const Instance *inst = network_->instance(pin);
+       inst && inst != top;
+       inst = network_->parent(inst))
+    ancestors.push_back(inst);
+  if (ancestors.empty())
+    return top;
+  size_t depth = std::min(ancestors.size(),
+                          static_cast<size_t>(hierarchy_depth_));
+  return ancestors[ancestors.size() - depth];
 }
 
 } // namespace
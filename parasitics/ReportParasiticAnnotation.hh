@@ -29,8 +29,11 @@ namespace sta {
 class StaState;
 class Corner;
 
+// hierarchy_depth > 0 also reports unannotated driver counts grouped
+// by hierarchy subtree, hierarchy_depth levels below the top instance.
 void
 reportParasiticAnnotation(bool report_unannotated,
+                          int hierarchy_depth,
                           const Corner *corner,
                           StaState *sta);
 
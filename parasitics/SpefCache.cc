@@ -0,0 +1,897 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2025, Parallax Software, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+//
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// This notice may not be removed or altered from any source distribution.
+
+#include "SpefCache.hh"
+
+#include <cstring>
+#include <fstream>
+#include <list>
+#include <sys/stat.h>
+
+#ifndef _WIN32
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <unistd.h>
+#endif
+
+#include "Report.hh"
+#include "StaState.hh"
+#include "Network.hh"
+#include "Mutex.hh"
+#include "UnorderedMap.hh"
+#include "ConcreteParasitics.hh"
+#include "ConcreteParasiticsPvt.hh"
+
+namespace sta {
+
+using std::string;
+
+static constexpr uint32_t cache_magic = 0x50415453;  // "STAP"
+static constexpr uint32_t cache_format_version = 1;
+// Device terminal for an unconnected node.
+static constexpr uint32_t null_node_index = 0xffffffff;
+
+std::string
+spefCacheFilename(const char *filename)
+{
+  return string(filename) + ".stacache";
+}
+
+static bool
+sourceFileStats(const char *filename,
+                // Return values.
+                uint64_t &size,
+                uint64_t &mtime)
+{
+  struct stat sbuf;
+  if (stat(filename, &sbuf) == 0) {
+    size = sbuf.st_size;
+    mtime = sbuf.st_mtime;
+    return true;
+  }
+  return false;
+}
+
+////////////////////////////////////////////////////////////////
+//
+// Writer
+//
+////////////////////////////////////////////////////////////////
+
+typedef UnorderedMap<ParasiticNode*, uint32_t> ParasiticNodeIndexMap;
+
+class SpefCacheWriter
+{
+public:
+  SpefCacheWriter(const char *filename,
+                  const Instance *instance,
+                  bool pin_cap_included,
+                  bool keep_coupling_caps,
+                  float coupling_cap_factor,
+                  float coupling_cap_threshold,
+                  const ParasiticAnalysisPt *ap,
+                  StaState *sta);
+  bool write();
+
+private:
+  void writeHeader();
+  void writeNet(ConcreteParasiticNetwork *cnetwork);
+  void writeNodeIndex(const ParasiticNodeIndexMap &node_index_map,
+                      ParasiticNode *node);
+
+  void writeBool(bool value);
+  void writeU8(uint8_t value);
+  void writeU32(uint32_t value);
+  void writeU64(uint64_t value);
+  void writeFloat(float value);
+  void writeString(const char *str);
+
+  const char *filename_;
+  const Instance *instance_;
+  bool pin_cap_included_;
+  bool keep_coupling_caps_;
+  float coupling_cap_factor_;
+  float coupling_cap_threshold_;
+  const ParasiticAnalysisPt *ap_;
+  Network *network_;
+  Parasitics *parasitics_;
+  Report *report_;
+  std::ofstream out_;
+};
+
+SpefCacheWriter::SpefCacheWriter(const char *filename,
+                                 const Instance *instance,
+                                 bool pin_cap_included,
+                                 bool keep_coupling_caps,
+                                 float coupling_cap_factor,
+                                 float coupling_cap_threshold,
+                                 const ParasiticAnalysisPt *ap,
+                                 StaState *sta) :
+  filename_(filename),
+  instance_(instance),
+  pin_cap_included_(pin_cap_included),
+  keep_coupling_caps_(keep_coupling_caps),
+  coupling_cap_factor_(coupling_cap_factor),
+  coupling_cap_threshold_(coupling_cap_threshold),
+  ap_(ap),
+  network_(sta->network()),
+  parasitics_(sta->parasitics()),
+  report_(sta->report())
+{
+}
+
+bool
+SpefCacheWriter::write()
+{
+  ConcreteParasitics *cparasitics =
+    dynamic_cast<ConcreteParasitics*>(parasitics_);
+  if (cparasitics == nullptr)
+    return false;
+  ConcreteParasiticNetworkSeq networks = cparasitics->parasiticNetworks(ap_);
+
+  string cache_filename = spefCacheFilename(filename_);
+  out_.open(cache_filename, std::ios::binary | std::ios::trunc);
+  if (!out_.is_open()) {
+    report_->warn(2323, "cannot open spef cache file %s.",
+                  cache_filename.c_str());
+    return false;
+  }
+  writeHeader();
+  writeU32(networks.size());
+  for (ConcreteParasiticNetwork *cnetwork : networks)
+    writeNet(cnetwork);
+  out_.close();
+  if (out_.fail()) {
+    report_->warn(2324, "error writing spef cache file %s.",
+                  cache_filename.c_str());
+    return false;
+  }
+  return true;
+}
+
+void
+SpefCacheWriter::writeHeader()
+{
+  uint64_t src_size, src_mtime;
+  if (!sourceFileStats(filename_, src_size, src_mtime))
+    src_size = src_mtime = 0;
+
+  writeU32(cache_magic);
+  writeU32(cache_format_version);
+  writeU64(src_size);
+  writeU64(src_mtime);
+
+  // Options that shape the stored networks.
+  writeString((instance_ && instance_ != network_->topInstance())
+              ? network_->pathName(instance_)
+              : "");
+  writeBool(pin_cap_included_);
+  writeBool(keep_coupling_caps_);
+  writeFloat(coupling_cap_factor_);
+  writeFloat(coupling_cap_threshold_);
+}
+
+void
+SpefCacheWriter::writeNet(ConcreteParasiticNetwork *cnetwork)
+{
+  Parasitic *parasitic = cnetwork;
+  const Net *net = cnetwork->net();
+  writeString(network_->pathName(net));
+  writeBool(cnetwork->includesPinCaps());
+
+  ParasiticNodeSeq nodes = parasitics_->nodes(parasitic);
+  writeU32(nodes.size());
+  ParasiticNodeIndexMap node_index_map;
+  uint32_t index = 0;
+  for (ParasiticNode *node : nodes) {
+    node_index_map[node] = index++;
+    const Pin *pin = parasitics_->pin(node);
+    writeBool(pin != nullptr);
+    if (pin)
+      writeString(network_->pathName(pin));
+    else {
+      // An empty net name stands for the network's own net, which
+      // covers nearly every subnode.
+      const Net *node_net = parasitics_->net(node, network_);
+      writeString(node_net == net ? "" : network_->pathName(node_net));
+      writeU32(parasitics_->netId(node));
+    }
+    writeFloat(parasitics_->nodeGndCap(node));
+  }
+
+  ParasiticResistorSeq resistors = parasitics_->resistors(parasitic);
+  writeU32(resistors.size());
+  for (ParasiticResistor *resistor : resistors) {
+    writeU32(parasitics_->id(resistor));
+    writeFloat(parasitics_->value(resistor));
+    writeNodeIndex(node_index_map, parasitics_->node1(resistor));
+    writeNodeIndex(node_index_map, parasitics_->node2(resistor));
+  }
+
+  ParasiticCapacitorSeq capacitors = parasitics_->capacitors(parasitic);
+  writeU32(capacitors.size());
+  for (ParasiticCapacitor *capacitor : capacitors) {
+    writeU32(parasitics_->id(capacitor));
+    writeFloat(parasitics_->value(capacitor));
+    writeNodeIndex(node_index_map, parasitics_->node1(capacitor));
+    writeNodeIndex(node_index_map, parasitics_->node2(capacitor));
+  }
+}
+
+void
+SpefCacheWriter::writeNodeIndex(const ParasiticNodeIndexMap &node_index_map,
+                                ParasiticNode *node)
+{
+  uint32_t index = null_node_index;
+  if (node) {
+    bool exists;
+    node_index_map.findKey(node, index, exists);
+    if (!exists)
+      index = null_node_index;
+  }
+  writeU32(index);
+}
+
+void
+SpefCacheWriter::writeBool(bool value)
+{
+  writeU8(value ? 1 : 0);
+}
+
+void
+SpefCacheWriter::writeU8(uint8_t value)
+{
+  out_.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void
+SpefCacheWriter::writeU32(uint32_t value)
+{
+  out_.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void
+SpefCacheWriter::writeU64(uint64_t value)
+{
+  out_.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void
+SpefCacheWriter::writeFloat(float value)
+{
+  out_.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void
+SpefCacheWriter::writeString(const char *str)
+{
+  uint32_t length = str ? strlen(str) : 0;
+  writeU32(length);
+  if (length)
+    out_.write(str, length);
+}
+
+bool
+writeSpefCache(const char *filename,
+               const Instance *instance,
+               bool pin_cap_included,
+               bool keep_coupling_caps,
+               float coupling_cap_factor,
+               float coupling_cap_threshold,
+               const ParasiticAnalysisPt *ap,
+               StaState *sta)
+{
+  SpefCacheWriter writer(filename, instance, pin_cap_included,
+                         keep_coupling_caps, coupling_cap_factor,
+                         coupling_cap_threshold, ap, sta);
+  return writer.write();
+}
+
+////////////////////////////////////////////////////////////////
+//
+// Reader
+//
+////////////////////////////////////////////////////////////////
+
+// Thrown on malformed or truncated cache files.
+struct SpefCacheError {};
+
+class SpefCacheReader
+{
+public:
+  SpefCacheReader(const char *filename,
+                  const Instance *instance,
+                  bool pin_cap_included,
+                  bool keep_coupling_caps,
+                  float coupling_cap_factor,
+                  float coupling_cap_threshold,
+                  ParasiticAnalysisPt *ap,
+                  StaState *sta);
+  ~SpefCacheReader();
+  bool read();
+
+private:
+  bool open();
+  bool mapFile(const char *cache_filename);
+  void unmapFile();
+  bool checkHeader();
+  void readNet(const Net *&net,
+               Parasitic *&parasitic);
+  void seek(const char *record) { cursor_ = record; }
+  void skipNetBody();
+  void skipString();
+  void skipBytes(size_t count);
+  ParasiticNode *readNodeIndex(ParasiticNodeSeq &node_table);
+  void deleteNetworks();
+
+  bool readBool();
+  uint8_t readU8();
+  uint32_t readU32();
+  uint64_t readU64();
+  float readFloat();
+  string readString();
+
+  const char *filename_;
+  const Instance *instance_;
+  bool pin_cap_included_;
+  bool keep_coupling_caps_;
+  float coupling_cap_factor_;
+  float coupling_cap_threshold_;
+  ParasiticAnalysisPt *ap_;
+  Network *network_;
+  Parasitics *parasitics_;
+  Report *report_;
+  // Nets annotated so far, deleted if the cache turns out to be corrupt.
+  NetSeq annotated_nets_;
+
+  const char *data_;
+  const char *cursor_;
+  const char *end_;
+  size_t map_length_;
+#ifndef _WIN32
+  int fd_;
+#endif
+
+  friend class SpefCacheLoader;
+};
+
+SpefCacheReader::SpefCacheReader(const char *filename,
+                                 const Instance *instance,
+                                 bool pin_cap_included,
+                                 bool keep_coupling_caps,
+                                 float coupling_cap_factor,
+                                 float coupling_cap_threshold,
+                                 ParasiticAnalysisPt *ap,
+                                 StaState *sta) :
+  filename_(filename),
+  instance_(instance),
+  pin_cap_included_(pin_cap_included),
+  keep_coupling_caps_(keep_coupling_caps),
+  coupling_cap_factor_(coupling_cap_factor),
+  coupling_cap_threshold_(coupling_cap_threshold),
+  ap_(ap),
+  network_(sta->network()),
+  parasitics_(sta->parasitics()),
+  report_(sta->report()),
+  data_(nullptr),
+  cursor_(nullptr),
+  end_(nullptr),
+  map_length_(0)
+#ifndef _WIN32
+  , fd_(-1)
+#endif
+{
+}
+
+SpefCacheReader::~SpefCacheReader()
+{
+  unmapFile();
+}
+
+bool
+SpefCacheReader::read()
+{
+  if (!open())
+    return false;
+  try {
+    uint32_t net_count = readU32();
+    for (uint32_t i = 0; i < net_count; i++) {
+      const Net *net;
+      Parasitic *parasitic;
+      readNet(net, parasitic);
+    }
+    return true;
+  }
+  catch (SpefCacheError &) {
+    report_->warn(2325, "spef cache file %s is corrupt; ignored.",
+                  spefCacheFilename(filename_).c_str());
+    deleteNetworks();
+    return false;
+  }
+}
+
+// Map the cache file and check that it matches the spef file and the
+// read options.
+bool
+SpefCacheReader::open()
+{
+  string cache_filename = spefCacheFilename(filename_);
+  if (!mapFile(cache_filename.c_str()))
+    return false;
+  try {
+    if (!checkHeader())
+      return false;
+  }
+  catch (SpefCacheError &) {
+    return false;
+  }
+  ap_->setCouplingCapFactor(coupling_cap_factor_);
+  return true;
+}
+
+// The cache refers to nets and pins by path name, so it is also stale
+// when the netlist no longer matches.
+void
+SpefCacheReader::readNet(const Net *&net,
+                         Parasitic *&parasitic)
+{
+  string net_name = readString();
+  bool includes_pin_caps = readBool();
+  net = network_->findNet(net_name.c_str());
+  if (net == nullptr)
+    throw SpefCacheError();
+  parasitic = parasitics_->makeParasiticNetwork(net, includes_pin_caps, ap_);
+  annotated_nets_.push_back(net);
+
+  uint32_t node_count = readU32();
+  ParasiticNodeSeq node_table;
+  node_table.reserve(node_count);
+  for (uint32_t i = 0; i < node_count; i++) {
+    ParasiticNode *node;
+    if (readBool()) {
+      string pin_name = readString();
+      const Pin *pin = network_->findPin(pin_name.c_str());
+      if (pin == nullptr)
+        throw SpefCacheError();
+      node = parasitics_->ensureParasiticNode(parasitic, pin, network_);
+    }
+    else {
+      string node_net_name = readString();
+      uint32_t id = readU32();
+      const Net *node_net = node_net_name.empty()
+        ? net
+        : network_->findNet(node_net_name.c_str());
+      if (node_net == nullptr)
+        throw SpefCacheError();
+      node = parasitics_->ensureParasiticNode(parasitic, node_net, id,
+                                              network_);
+    }
+    node_table.push_back(node);
+    float cap = readFloat();
+    if (cap != 0.0)
+      parasitics_->incrCap(node, cap);
+  }
+
+  uint32_t resistor_count = readU32();
+  for (uint32_t i = 0; i < resistor_count; i++) {
+    uint32_t id = readU32();
+    float value = readFloat();
+    ParasiticNode *node1 = readNodeIndex(node_table);
+    ParasiticNode *node2 = readNodeIndex(node_table);
+    parasitics_->makeResistor(parasitic, id, value, node1, node2);
+  }
+
+  uint32_t capacitor_count = readU32();
+  for (uint32_t i = 0; i < capacitor_count; i++) {
+    uint32_t id = readU32();
+    float value = readFloat();
+    ParasiticNode *node1 = readNodeIndex(node_table);
+    ParasiticNode *node2 = readNodeIndex(node_table);
+    parasitics_->makeCapacitor(parasitic, id, value, node1, node2);
+  }
+}
+
+ParasiticNode *
+SpefCacheReader::readNodeIndex(ParasiticNodeSeq &node_table)
+{
+  uint32_t index = readU32();
+  if (index == null_node_index)
+    return nullptr;
+  if (index >= node_table.size())
+    throw SpefCacheError();
+  return node_table[index];
+}
+
+// Advance past the remainder of a net record, after its name.
+void
+SpefCacheReader::skipNetBody()
+{
+  readBool();  // includes_pin_caps
+  uint32_t node_count = readU32();
+  for (uint32_t i = 0; i < node_count; i++) {
+    if (readBool())
+      skipString();
+    else {
+      skipString();
+      skipBytes(sizeof(uint32_t));
+    }
+    skipBytes(sizeof(float));
+  }
+  // Id, value and two node indexes per device.
+  constexpr size_t device_size = sizeof(uint32_t) * 3 + sizeof(float);
+  uint32_t resistor_count = readU32();
+  skipBytes(resistor_count * device_size);
+  uint32_t capacitor_count = readU32();
+  skipBytes(capacitor_count * device_size);
+}
+
+void
+SpefCacheReader::skipString()
+{
+  skipBytes(readU32());
+}
+
+void
+SpefCacheReader::skipBytes(size_t count)
+{
+  if (cursor_ + count > end_)
+    throw SpefCacheError();
+  cursor_ += count;
+}
+
+void
+SpefCacheReader::deleteNetworks()
+{
+  for (const Net *net : annotated_nets_)
+    parasitics_->deleteParasiticNetwork(net, ap_);
+  annotated_nets_.clear();
+}
+
+bool
+SpefCacheReader::mapFile(const char *cache_filename)
+{
+#ifndef _WIN32
+  fd_ = ::open(cache_filename, O_RDONLY);
+  if (fd_ < 0)
+    return false;
+  struct stat sbuf;
+  if (fstat(fd_, &sbuf) != 0
+      || sbuf.st_size == 0) {
+    close(fd_);
+    fd_ = -1;
+    return false;
+  }
+  map_length_ = sbuf.st_size;
+  void *map = mmap(nullptr, map_length_, PROT_READ, MAP_PRIVATE, fd_, 0);
+  if (map == MAP_FAILED) {
+    close(fd_);
+    fd_ = -1;
+    return false;
+  }
+  data_ = static_cast<const char*>(map);
+#else
+  std::ifstream in(cache_filename, std::ios::binary | std::ios::ate);
+  if (!in.is_open())
+    return false;
+  map_length_ = in.tellg();
+  in.seekg(0);
+  char *buffer = new char[map_length_];
+  in.read(buffer, map_length_);
+  if (in.fail()) {
+    delete [] buffer;
+    return false;
+  }
+  data_ = buffer;
+#endif
+  cursor_ = data_;
+  end_ = data_ + map_length_;
+  return true;
+}
+
+void
+SpefCacheReader::unmapFile()
+{
+#ifndef _WIN32
+  if (data_) {
+    munmap(const_cast<char*>(data_), map_length_);
+    close(fd_);
+    fd_ = -1;
+  }
+#else
+  delete [] data_;
+#endif
+  data_ = cursor_ = end_ = nullptr;
+}
+
+bool
+SpefCacheReader::checkHeader()
+{
+  if (readU32() != cache_magic
+      || readU32() != cache_format_version)
+    return false;
+  uint64_t cached_size = readU64();
+  uint64_t cached_mtime = readU64();
+  uint64_t src_size, src_mtime;
+  if (!sourceFileStats(filename_, src_size, src_mtime)
+      || src_size != cached_size
+      || src_mtime != cached_mtime)
+    return false;
+
+  string instance_name = readString();
+  string instance_name1 = (instance_ && instance_ != network_->topInstance())
+    ? network_->pathName(instance_)
+    : "";
+  return instance_name == instance_name1
+    && readBool() == pin_cap_included_
+    && readBool() == keep_coupling_caps_
+    && readFloat() == coupling_cap_factor_
+    && readFloat() == coupling_cap_threshold_;
+}
+
+bool
+SpefCacheReader::readBool()
+{
+  return readU8() != 0;
+}
+
+uint8_t
+SpefCacheReader::readU8()
+{
+  if (cursor_ + sizeof(uint8_t) > end_)
+    throw SpefCacheError();
+  uint8_t value;
+  memcpy(&value, cursor_, sizeof(value));
+  cursor_ += sizeof(value);
+  return value;
+}
+
+uint32_t
+SpefCacheReader::readU32()
+{
+  if (cursor_ + sizeof(uint32_t) > end_)
+    throw SpefCacheError();
+  uint32_t value;
+  memcpy(&value, cursor_, sizeof(value));
+  cursor_ += sizeof(value);
+  return value;
+}
+
+uint64_t
+SpefCacheReader::readU64()
+{
+  if (cursor_ + sizeof(uint64_t) > end_)
+    throw SpefCacheError();
+  uint64_t value;
+  memcpy(&value, cursor_, sizeof(value));
+  cursor_ += sizeof(value);
+  return value;
+}
+
+float
+SpefCacheReader::readFloat()
+{
+  if (cursor_ + sizeof(float) > end_)
+    throw SpefCacheError();
+  float value;
+  memcpy(&value, cursor_, sizeof(value));
+  cursor_ += sizeof(value);
+  return value;
+}
+
+string
+SpefCacheReader::readString()
+{
+  uint32_t length = readU32();
+  if (cursor_ + length > end_)
+    throw SpefCacheError();
+  string str(cursor_, length);
+  cursor_ += length;
+  return str;
+}
+
+bool
+readSpefCache(const char *filename,
+              const Instance *instance,
+              bool pin_cap_included,
+              bool keep_coupling_caps,
+              float coupling_cap_factor,
+              float coupling_cap_threshold,
+              ParasiticAnalysisPt *ap,
+              StaState *sta)
+{
+  SpefCacheReader reader(filename, instance, pin_cap_included,
+                         keep_coupling_caps, coupling_cap_factor,
+                         coupling_cap_threshold, ap, sta);
+  return reader.read();
+}
+
+////////////////////////////////////////////////////////////////
+//
+// Demand loader
+//
+////////////////////////////////////////////////////////////////
+
+// Demand pager over the cache file.  An index pass records the record
+// offset of each net, and nets are rebuilt when
+// Parasitics::findParasiticNetwork asks for them.  Resident nets
+// beyond max_resident_nets are evicted in least recently used order,
+// so memory stays bounded by the working set instead of the design.
+class SpefCacheLoader : public ParasiticNetworkLoader
+{
+public:
+  SpefCacheLoader(SpefCacheReader *reader,
+                  ParasiticAnalysisPt *ap,
+                  StaState *sta);
+  ~SpefCacheLoader() override;
+  bool init();
+  Parasitic *loadParasiticNetwork(const Net *net,
+                                  const ParasiticAnalysisPt *ap) override;
+  void used(const Net *net) override;
+
+private:
+  typedef std::list<const Net*> NetLruList;
+  struct ResidentNet
+  {
+    NetLruList::iterator lru_entry;
+    Parasitic *parasitic;
+  };
+
+  void evictExcess();
+
+  SpefCacheReader *reader_;
+  ParasiticAnalysisPt *ap_;
+  Parasitics *parasitics_;
+  Report *report_;
+  // Net to cache record offset, from the index pass.
+  UnorderedMap<const Net*, const char*> net_records_;
+  // Resident nets, most recently used first.
+  NetLruList lru_;
+  UnorderedMap<const Net*, ResidentNet> resident_;
+  std::mutex lock_;
+
+  // Enough headroom that a net evicted while another thread still
+  // reads it would have to fall this many requests behind.
+  static constexpr size_t max_resident_nets = 100000;
+};
+
+SpefCacheLoader::SpefCacheLoader(SpefCacheReader *reader,
+                                 ParasiticAnalysisPt *ap,
+                                 StaState *sta) :
+  reader_(reader),
+  ap_(ap),
+  parasitics_(sta->parasitics()),
+  report_(sta->report())
+{
+}
+
+SpefCacheLoader::~SpefCacheLoader()
+{
+  delete reader_;
+}
+
+bool
+SpefCacheLoader::init()
+{
+  if (!reader_->open())
+    return false;
+  try {
+    uint32_t net_count = reader_->readU32();
+    for (uint32_t i = 0; i < net_count; i++) {
+      const char *record = reader_->cursor_;
+      string net_name = reader_->readString();
+      Net *net = reader_->network_->findNet(net_name.c_str());
+      reader_->skipNetBody();
+      if (net)
+        net_records_[net] = record;
+    }
+    return !net_records_.empty();
+  }
+  catch (SpefCacheError &) {
+    report_->warn(2326, "spef cache file %s is corrupt; ignored.",
+                  spefCacheFilename(reader_->filename_).c_str());
+    return false;
+  }
+}
+
+Parasitic *
+SpefCacheLoader::loadParasiticNetwork(const Net *net,
+                                      const ParasiticAnalysisPt *ap)
+{
+  if (ap != ap_)
+    return nullptr;
+  LockGuard lock(lock_);
+  auto resident = resident_.find(net);
+  if (resident != resident_.end()) {
+    ResidentNet &res = resident->second;
+    lru_.splice(lru_.begin(), lru_, res.lru_entry);
+    return res.parasitic;
+  }
+  const char *record;
+  bool exists;
+  net_records_.findKey(net, record, exists);
+  if (!exists)
+    return nullptr;
+  Parasitic *parasitic;
+  try {
+    const Net *read_net;
+    reader_->seek(record);
+    reader_->readNet(read_net, parasitic);
+    reader_->annotated_nets_.clear();
+  }
+  catch (SpefCacheError &) {
+    report_->warn(2327, "spef cache file %s is corrupt; ignored.",
+                  spefCacheFilename(reader_->filename_).c_str());
+    reader_->deleteNetworks();
+    // Disable further loads.
+    net_records_.clear();
+    return nullptr;
+  }
+  lru_.push_front(net);
+  resident_[net] = ResidentNet{lru_.begin(), parasitic};
+  evictExcess();
+  return parasitic;
+}
+
+void
+SpefCacheLoader::used(const Net *net)
+{
+  LockGuard lock(lock_);
+  auto resident = resident_.find(net);
+  if (resident != resident_.end())
+    lru_.splice(lru_.begin(), lru_, resident->second.lru_entry);
+}
+
+void
+SpefCacheLoader::evictExcess()
+{
+  while (lru_.size() > max_resident_nets) {
+    const Net *evict = lru_.back();
+    lru_.pop_back();
+    resident_.erase(evict);
+    parasitics_->deleteParasiticNetwork(evict, ap_);
+  }
+}
+
+ParasiticNetworkLoader *
+makeSpefCacheLoader(const char *filename,
+                    const Instance *instance,
+                    bool pin_cap_included,
+                    bool keep_coupling_caps,
+                    float coupling_cap_factor,
+                    float coupling_cap_threshold,
+                    ParasiticAnalysisPt *ap,
+                    StaState *sta)
+{
+  SpefCacheReader *reader =
+    new SpefCacheReader(filename, instance, pin_cap_included,
+                        keep_coupling_caps, coupling_cap_factor,
+                        coupling_cap_threshold, ap, sta);
+  SpefCacheLoader *loader = new SpefCacheLoader(reader, ap, sta);
+  if (loader->init())
+    return loader;
+  delete loader;
+  return nullptr;
+}
+
+} // namespace
@@ -0,0 +1,96 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2025, Parallax Software, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+//
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// This notice may not be removed or altered from any source distribution.
+
+#pragma once
+
+#include <string>
+
+namespace sta {
+
+class Instance;
+class ParasiticAnalysisPt;
+class ParasiticNetworkLoader;
+class StaState;
+
+// Compiled binary cache for spef files.
+//
+// After a spef file is parsed the annotated parasitic networks can be
+// saved to a versioned binary cache file next to the source file.
+// Subsequent reads memory map the cache and rebuild the networks
+// without running the spef parser or resolving names through the spef
+// name map.  The cache is invalidated by the source file
+// size/modification time, by the cache format version and by the
+// read_spef options that shape the stored networks.
+//
+// Only detailed parasitic networks are cached.  Reduced models are
+// recomputed lazily by the delay calculators, so caches are not
+// written when networks are reduced and deleted while reading
+// (read_spef -reduce).
+
+// Cache file path for a spef file.
+std::string
+spefCacheFilename(const char *filename);
+
+// Write a cache file for the parasitic networks annotated to ap by
+// reading filename.
+bool
+writeSpefCache(const char *filename,
+               const Instance *instance,
+               bool pin_cap_included,
+               bool keep_coupling_caps,
+               float coupling_cap_factor,
+               float coupling_cap_threshold,
+               const ParasiticAnalysisPt *ap,
+               StaState *sta);
+
+// Rebuild the parasitic networks for ap from the cache file for
+// filename.  Returns false if the cache file is missing, stale,
+// corrupt or written with different read_spef options.
+bool
+readSpefCache(const char *filename,
+              const Instance *instance,
+              bool pin_cap_included,
+              bool keep_coupling_caps,
+              float coupling_cap_factor,
+              float coupling_cap_threshold,
+              ParasiticAnalysisPt *ap,
+              StaState *sta);
+
+// Demand pager over the cache file for targeted re-analysis
+// (sta_spef_lazy_enabled).  Builds a net to record offset index and
+// rebuilds nets when findParasiticNetwork asks for them, keeping a
+// bounded lru working set resident instead of every net.  Returns
+// nullptr if the cache file is missing or stale; install the result
+// with Parasitics::setNetworkLoader.
+ParasiticNetworkLoader *
+makeSpefCacheLoader(const char *filename,
+                    const Instance *instance,
+                    bool pin_cap_included,
+                    bool keep_coupling_caps,
+                    float coupling_cap_factor,
+                    float coupling_cap_threshold,
+                    ParasiticAnalysisPt *ap,
+                    StaState *sta);
+
+} // namespace
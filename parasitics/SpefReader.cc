@@ -25,6 +25,8 @@
 #include "SpefReader.hh"
 
 #include "Zlib.hh"
+#include "DispatchQueue.hh"
+#include "GzPipeStream.hh"
 #include "Stats.hh"
 #include "Report.hh"
 #include "Debug.hh"
@@ -53,6 +55,7 @@ readSpefFile(const char *filename,
 	     bool pin_cap_included,
 	     bool keep_coupling_caps,
 	     float coupling_cap_factor,
+	     float coupling_cap_threshold,
 	     bool reduce,
 	     const Corner *corner,
 	     const MinMaxAll *min_max,
@@ -60,7 +63,7 @@ readSpefFile(const char *filename,
 {
   SpefReader reader(filename, instance, ap,
                     pin_cap_included, keep_coupling_caps, coupling_cap_factor,
-                    reduce, corner, min_max, sta);
+                    coupling_cap_threshold, reduce, corner, min_max, sta);
   bool success = reader.read();
   return success;
 }
@@ -71,6 +74,7 @@ SpefReader::SpefReader(const char *filename,
 		       bool pin_cap_included,
 		       bool keep_coupling_caps,
 		       float coupling_cap_factor,
+		       float coupling_cap_threshold,
 		       bool reduce,
 		       const Corner *corner,
 		       const MinMaxAll *min_max,
@@ -81,6 +85,7 @@ SpefReader::SpefReader(const char *filename,
   ap_(ap),
   pin_cap_included_(pin_cap_included),
   keep_coupling_caps_(keep_coupling_caps),
+  coupling_cap_threshold_(coupling_cap_threshold),
   reduce_(reduce),
   corner_(corner),
   min_max_(min_max),
@@ -114,7 +119,7 @@ bool
 SpefReader::read()
 {
   bool success;
-  gzstream::igzstream stream(filename_);
+  GzPipeStream stream(filename_);
   if (stream.is_open()) {
     Stats stats(debug_, report_);
     SpefScanner scanner(&stream, filename_, this, report_);
@@ -123,6 +128,9 @@ SpefReader::read()
     //parser.set_debug_level(1);
     // yyparse returns 0 on success.
     success = (parser.parse() == 0);
+    if (dispatch_queue_)
+      // Wait for parasitic network reductions dispatched by dspfFinish.
+      dispatch_queue_->finishTasks();
     stats.report("Read spef");
   }
   else
@@ -433,8 +441,21 @@ void
 SpefReader::dspfFinish()
 {
   if (parasitic_ && reduce_) {
-    arc_delay_calc_->reduceParasitic(parasitic_, net_, corner_, min_max_);
-    parasitics_->deleteParasiticNetwork(net_, ap_);
+    // The net section is complete, so the parasitic network can be
+    // reduced on another thread while the parser moves on to the next
+    // *D_NET.  The ConcreteParasitics containers lock internally.
+    if (dispatch_queue_) {
+      Parasitic *parasitic = parasitic_;
+      const Net *net = net_;
+      dispatch_queue_->dispatch([this, parasitic, net](int) {
+        arc_delay_calc_->reduceParasitic(parasitic, net, corner_, min_max_);
+        parasitics_->deleteParasiticNetwork(net, ap_);
+      });
+    }
+    else {
+      arc_delay_calc_->reduceParasitic(parasitic_, net_, corner_, min_max_);
+      parasitics_->deleteParasiticNetwork(net_, ap_);
+    }
   }
   parasitic_ = nullptr;
   net_ = nullptr;
@@ -534,7 +555,10 @@ SpefReader::makeCapacitor(int id,
   ParasiticNode *node2 = findParasiticNode(node_name2, false);
   float cap1 = cap->value(triple_index_) * cap_scale_;
   if (cap1 > 0.0) {
-    if (keep_coupling_caps_)
+    // Couplings below the threshold are folded to grounded capacitance
+    // instead of stored as coupling capacitor objects.
+    if (keep_coupling_caps_
+        && cap1 >= coupling_cap_threshold_)
       parasitics_->makeCapacitor(parasitic_, id, cap1, node1, node2);
     else {
       float scaled_cap = cap1 * ap_->couplingCapFactor();
@@ -40,6 +40,8 @@ class StaState;
 // In a Spef file with triplet values the first value is used.
 // Constraint min/max cnst_min_max and operating condition op_cond
 // are used for parasitic network reduction.
+// Coupling capacitors below coupling_cap_threshold are folded to
+// grounded capacitance even when coupling caps are kept.
 // Return true if successful.
 bool
 readSpefFile(const char *filename,
@@ -48,6 +50,7 @@ readSpefFile(const char *filename,
 	     bool pin_cap_included,
 	     bool keep_coupling_caps,
 	     float coupling_cap_factor,
+	     float coupling_cap_threshold,
 	     bool reduce,
 	     const Corner *corner,
 	     const MinMaxAll *min_max,
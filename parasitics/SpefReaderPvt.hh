@@ -52,6 +52,7 @@ public:
 	     bool pin_cap_included,
 	     bool keep_coupling_caps,
 	     float coupling_cap_factor,
+	     float coupling_cap_threshold,
 	     bool reduce,
 	     const Corner *corner,
 	     const MinMaxAll *min_max,
@@ -123,6 +124,7 @@ private:
   const ParasiticAnalysisPt *ap_;
   bool pin_cap_included_;
   bool keep_coupling_caps_;
+  float coupling_cap_threshold_;
   bool reduce_;
   const Corner *corner_;
   const MinMaxAll *min_max_;
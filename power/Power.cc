@@ -26,6 +26,7 @@
 
 #include <algorithm> // max
 #include <cmath>     // abs
+#include <cstring>   // memcpy
 
 #include "cudd.h"
 #include "Stats.hh"
@@ -49,6 +50,8 @@
 #include "Graph.hh"
 #include "DcalcAnalysisPt.hh"
 #include "GraphDelayCalc.hh"
+#include "ArcDelayCalc.hh"
+#include "DispatchQueue.hh"
 #include "Corner.hh"
 #include "Path.hh"
 #include "search/Levelize.hh"
@@ -99,9 +102,11 @@ Power::Power(StaState *sta) :
   global_activity_(),
   input_activity_(),            // default set in ensureActivities()
   seq_activity_map_(100, SeqPinHash(network_), SeqPinEqual()),
+  activity_invalid_pins_(network_),
   activities_valid_(false),
   bdd_(sta),
   instance_powers_(InstanceIdLess(network_)),
+  power_invalid_insts_(network_),
   instance_powers_valid_(false),
   corner_(nullptr)
 {
@@ -114,17 +119,33 @@ Power::clear()
   input_activity_.init();
   user_activity_map_.clear();
   seq_activity_map_.clear();
-  activity_map_.clear();
+  activities_.clear();
+  activity_invalid_pins_.clear();
   activities_valid_ = false;
   instance_powers_.clear();
+  power_invalid_insts_.clear();
+  internal_power_cache_.clear();
   corner_ = nullptr;
+  bdd_.clearVarMap();
 }
 
 void
 Power::activitiesInvalid()
 {
   activities_valid_ = false;
+  activity_invalid_pins_.clear();
   instance_powers_valid_ = false;
+  power_invalid_insts_.clear();
+}
+
+// Localized activity edit.  Propagation reseeded from the pin updates
+// its transitive fanout and records the instances whose cached powers
+// are stale, so incremental power queries only recompute those.
+void
+Power::activityInvalid(const Pin *pin)
+{
+  if (activities_valid_)
+    activity_invalid_pins_.insert(pin);
 }
 
 void
@@ -166,7 +187,7 @@ Power::setInputPortActivity(const Port *input_port,
   const Pin *pin = network_->findPin(top_inst, input_port);
   if (pin) {
     user_activity_map_[pin] = {density, duty, PwrActivityOrigin::user};
-    activitiesInvalid();
+    activityInvalid(pin);
   }
 }
 
@@ -177,7 +198,7 @@ Power::unsetInputPortActivity(const Port *input_port)
   const Pin *pin = network_->findPin(top_inst, input_port);
   if (pin) {
     user_activity_map_.erase(pin);
-    activitiesInvalid();
+    activityInvalid(pin);
   }
 }
 
@@ -188,14 +209,14 @@ Power::setUserActivity(const Pin *pin,
                        PwrActivityOrigin origin)
 {
   user_activity_map_[pin] = {density, duty, origin};
-  activitiesInvalid();
+  activityInvalid(pin);
 }
 
 void
 Power::unsetUserActivity(const Pin *pin)
 {
   user_activity_map_.erase(pin);
-  activitiesInvalid();
+  activityInvalid(pin);
 }
 
 PwrActivity &
@@ -219,19 +240,35 @@ Power::setActivity(const Pin *pin,
              activity.density(),
              activity.duty(),
              pwr_activity_origin_map.find(activity.origin()));
-  activity_map_[pin] = activity;
+  Vertex *vertex = graph_->pinLoadVertex(pin);
+  VertexId id = graph_->id(vertex);
+  if (id >= activities_.size())
+    activities_.resize(id + 1);
+  activities_[id] = activity;
 }
 
+// Activities are only set on pins in the graph, so the slot for a pin
+// is the one for its load vertex.
 PwrActivity &
 Power::activity(const Pin *pin)
 {
-  return activity_map_[pin];
+  Vertex *vertex = graph_->pinLoadVertex(pin);
+  VertexId id = graph_->id(vertex);
+  if (id >= activities_.size())
+    activities_.resize(id + 1);
+  return activities_[id];
 }
 
 bool
 Power::hasActivity(const Pin *pin)
 {
-  return activity_map_.hasKey(pin);
+  Vertex *vertex = graph_->pinLoadVertex(pin);
+  if (vertex) {
+    VertexId id = graph_->id(vertex);
+    return id < activities_.size()
+      && activities_[id].origin() != PwrActivityOrigin::unknown;
+  }
+  return false;
 }
 
 // Sequential internal pins may not be in the netlist so their
@@ -241,8 +278,10 @@ Power::setSeqActivity(const Instance *reg,
 		      LibertyPort *output,
 		      PwrActivity &activity)
 {
+  // Only called while activities are being propagated, so no
+  // invalidation here; the register data pin edit that got here marks
+  // the instance power stale.
   seq_activity_map_[SeqPin(reg, output)] = activity;
-  activitiesInvalid();
 }
 
 bool
@@ -394,7 +433,7 @@ Power::highestPowerInstances(size_t count,
 
 ////////////////////////////////////////////////////////////////
 
-class ActivitySrchPred : public SearchPredNonLatch2
+class ActivitySrchPred final : public SearchPredNonLatch2
 {
 public:
   explicit ActivitySrchPred(const StaState *sta);
@@ -421,37 +460,73 @@ class PropActivityVisitor : public VertexVisitor, StaState
 public:
   PropActivityVisitor(Power *power,
 		      BfsFwdIterator *bfs);
+  virtual ~PropActivityVisitor();
   virtual VertexVisitor *copy() const;
   virtual void visit(Vertex *vertex);
   InstanceSet &visitedRegs() { return visited_regs_; }
+  InstanceSet &changedInsts() { return changed_insts_; }
   void init();
   float maxChange() const { return max_change_; }
 
 private:
+  PropActivityVisitor(Power *power,
+		      BfsFwdIterator *bfs,
+		      PropActivityVisitor *parent);
   bool setActivityCheck(const Pin *pin,
                         PwrActivity &activity);
 
   static constexpr float change_tolerance_ = .001;
   InstanceSet visited_regs_;
+  // Instances with changed pin activities, for power cache invalidation.
+  InstanceSet changed_insts_;
   float max_change_;
   Power *power_;
   BfsFwdIterator *bfs_;
+  // Parallel visits run on visitor copies; the parent collects their
+  // visited registers and max change when they are deleted.
+  PropActivityVisitor *parent_;
+  // Each copy evaluates functions with its own cudd manager.
+  Bdd bdd_;
 };
 
 PropActivityVisitor::PropActivityVisitor(Power *power,
 					 BfsFwdIterator *bfs) :
+  PropActivityVisitor(power, bfs, nullptr)
+{
+}
+
+PropActivityVisitor::PropActivityVisitor(Power *power,
+					 BfsFwdIterator *bfs,
+					 PropActivityVisitor *parent) :
   StaState(power),
   visited_regs_(network_),
+  changed_insts_(network_),
   max_change_(0.0),
   power_(power),
-  bfs_(bfs)
+  bfs_(bfs),
+  parent_(parent),
+  bdd_(power)
+{
+}
+
+PropActivityVisitor::~PropActivityVisitor()
 {
+  // The parallel visit deletes the copies serially after the last
+  // level, before the parent's results are read.
+  if (parent_) {
+    parent_->visited_regs_.insert(visited_regs_.begin(),
+                                  visited_regs_.end());
+    parent_->changed_insts_.insert(changed_insts_.begin(),
+                                   changed_insts_.end());
+    parent_->max_change_ = max(parent_->max_change_, max_change_);
+  }
 }
 
 VertexVisitor *
 PropActivityVisitor::copy() const
 {
-  return new PropActivityVisitor(power_, bfs_);
+  return new PropActivityVisitor(power_, bfs_,
+                                 const_cast<PropActivityVisitor*>(this));
 }
 
 void
@@ -501,7 +576,7 @@ PropActivityVisitor::visit(Vertex *vertex)
           }
         }
 	if (func) {
-          PwrActivity activity = power_->evalActivity(func, inst);
+          PwrActivity activity = power_->evalActivity(func, inst, bdd_);
 	  changed = setActivityCheck(pin, activity);
 	}
         if (port->isClockGateOut()) {
@@ -526,6 +601,7 @@ PropActivityVisitor::visit(Vertex *vertex)
     }
   }
   if (changed) {
+    changed_insts_.insert(inst);
     LibertyCell *cell = network_->libertyCell(inst);
     if (cell) {
       LibertyCell *test_cell = cell->libertyCell()->testCell();
@@ -605,37 +681,119 @@ Power::clockGatePins(const Instance *inst,
 PwrActivity
 Power::evalActivity(FuncExpr *expr,
 		    const Instance *inst)
+{
+  return evalActivity(expr, inst, bdd_);
+}
+
+PwrActivity
+Power::evalActivity(FuncExpr *expr,
+		    const Instance *inst,
+		    Bdd &bdd_mgr)
 {
   LibertyPort *func_port = expr->port();
   if (func_port &&  func_port->direction()->isInternal())
     return findSeqActivity(inst, func_port);
   else {
-    DdNode *bdd = bdd_.funcBdd(expr);
-    float duty = evalBddDuty(bdd, inst);
-    float density = evalBddActivity(bdd, inst);
+    FuncExprTable *table = expr->table();
+    if (table) {
+      PwrActivity activity;
+      if (evalTableActivity(table, inst, activity))
+	return activity;
+    }
+    DdNode *bdd = bdd_mgr.funcBdd(expr);
+    float duty = evalBddDuty(bdd, inst, bdd_mgr);
+    float density = evalBddActivity(bdd, expr, inst, bdd_mgr);
 
-    Cudd_RecursiveDeref(bdd_.cuddMgr(), bdd);
-    bdd_.clearVarMap();
+    Cudd_RecursiveDeref(bdd_mgr.cuddMgr(), bdd);
     return PwrActivity(density, duty, PwrActivityOrigin::propagated);
   }
 }
 
+// Truth table version of the bdd duty/density evaluation.
+bool
+Power::evalTableActivity(FuncExprTable *table,
+			 const Instance *inst,
+			 // Return value.
+			 PwrActivity &activity)
+{
+  const LibertyPortSeq &ports = table->ports();
+  size_t input_count = ports.size();
+  float duties[FuncExprTable::max_inputs];
+  float densities[FuncExprTable::max_inputs];
+  bool internal[FuncExprTable::max_inputs];
+  for (size_t i = 0; i < input_count; i++) {
+    LibertyPort *port = ports[i];
+    if (port->direction()->isInternal()) {
+      duties[i] = findSeqActivity(inst, port).duty();
+      densities[i] = 0.0;
+      internal[i] = true;
+    }
+    else {
+      const Pin *pin = findLinkPin(inst, port);
+      if (pin == nullptr)
+	// Fall back to the bdd evaluation.
+	return false;
+      PwrActivity port_activity = findActivity(pin);
+      duties[i] = port_activity.duty();
+      densities[i] = port_activity.density();
+      internal[i] = false;
+    }
+  }
+  size_t combo_count = static_cast<size_t>(1) << input_count;
+  // Probability of each input combination.
+  float probs[static_cast<size_t>(1) << FuncExprTable::max_inputs];
+  for (size_t combo = 0; combo < combo_count; combo++) {
+    float prob = 1.0;
+    for (size_t i = 0; i < input_count; i++)
+      prob *= ((combo >> i) & 1) ? duties[i] : 1.0 - duties[i];
+    probs[combo] = prob;
+  }
+  float duty = 0.0;
+  for (size_t combo = 0; combo < combo_count; combo++) {
+    if (table->value(combo))
+      duty += probs[combo];
+  }
+  // Sum of input density times the probability the function is
+  // sensitized to the input, as in evalBddActivity.
+  float density = 0.0;
+  for (size_t i = 0; i < input_count; i++) {
+    if (!internal[i]) {
+      size_t bit = static_cast<size_t>(1) << i;
+      float diff_duty = 0.0;
+      for (size_t combo = 0; combo < combo_count; combo++) {
+	if ((combo & bit) == 0
+	    && table->value(combo) != table->value(combo | bit)) {
+	  float prob = 1.0;
+	  for (size_t j = 0; j < input_count; j++) {
+	    if (j != i)
+	      prob *= ((combo >> j) & 1) ? duties[j] : 1.0 - duties[j];
+	  }
+	  diff_duty += prob;
+	}
+      }
+      density += densities[i] * diff_duty;
+    }
+  }
+  activity = PwrActivity(density, duty, PwrActivityOrigin::propagated);
+  return true;
+}
+
 // Find duty when from_port is sensitized.
 float
 Power::evalDiffDuty(FuncExpr *expr,
                     LibertyPort *from_port,
-                    const Instance *inst)
+                    const Instance *inst,
+                    Bdd &bdd_mgr)
 {
-  DdNode *bdd = bdd_.funcBdd(expr);
-  DdNode *var_node = bdd_.findNode(from_port);
+  DdNode *bdd = bdd_mgr.funcBdd(expr);
+  DdNode *var_node = bdd_mgr.findNode(from_port);
   unsigned var_index = Cudd_NodeReadIndex(var_node);
-  DdNode *diff = Cudd_bddBooleanDiff(bdd_.cuddMgr(), bdd, var_index);
+  DdNode *diff = Cudd_bddBooleanDiff(bdd_mgr.cuddMgr(), bdd, var_index);
   Cudd_Ref(diff);
-  float duty = evalBddDuty(diff, inst);
+  float duty = evalBddDuty(diff, inst, bdd_mgr);
 
-  Cudd_RecursiveDeref(bdd_.cuddMgr(), diff);
-  Cudd_RecursiveDeref(bdd_.cuddMgr(), bdd);
-  bdd_.clearVarMap();
+  Cudd_RecursiveDeref(bdd_mgr.cuddMgr(), diff);
+  Cudd_RecursiveDeref(bdd_mgr.cuddMgr(), bdd);
   return duty;
 }
 
@@ -643,22 +801,23 @@ Power::evalDiffDuty(FuncExpr *expr,
 // https://stackoverflow.com/questions/63326728/cudd-printminterm-accessing-the-individual-minterms-in-the-sum-of-products
 float
 Power::evalBddDuty(DdNode *bdd,
-                   const Instance *inst)
+                   const Instance *inst,
+                   Bdd &bdd_mgr)
 {
   if (Cudd_IsConstant(bdd)) {
-    if (bdd == Cudd_ReadOne(bdd_.cuddMgr()))
+    if (bdd == Cudd_ReadOne(bdd_mgr.cuddMgr()))
       return 1.0;
-    else if (bdd == Cudd_ReadLogicZero(bdd_.cuddMgr()))
+    else if (bdd == Cudd_ReadLogicZero(bdd_mgr.cuddMgr()))
       return 0.0;
     else
       criticalError(1100, "unknown cudd constant");
   }
   else {
-    float duty0 = evalBddDuty(Cudd_E(bdd), inst);
-    float duty1 = evalBddDuty(Cudd_T(bdd), inst);
+    float duty0 = evalBddDuty(Cudd_E(bdd), inst, bdd_mgr);
+    float duty1 = evalBddDuty(Cudd_T(bdd), inst, bdd_mgr);
     unsigned int index = Cudd_NodeReadIndex(bdd);
-    int var_index = Cudd_ReadPerm(bdd_.cuddMgr(), index);
-    const LibertyPort *port = bdd_.varIndexPort(var_index);
+    int var_index = Cudd_ReadPerm(bdd_mgr.cuddMgr(), index);
+    const LibertyPort *port = bdd_mgr.varIndexPort(var_index);
     if (port->direction()->isInternal())
       return findSeqActivity(inst, const_cast<LibertyPort*>(port)).duty();
     else {
@@ -681,18 +840,28 @@ Power::evalBddDuty(DdNode *bdd,
 // F(Xi=1), F(Xi=0) are the cofactors of F wrt Xi.
 float
 Power::evalBddActivity(DdNode *bdd,
-                       const Instance *inst)
+                       const FuncExpr *expr,
+                       const Instance *inst,
+                       Bdd &bdd_mgr)
 {
   float density = 0.0;
-  for (const auto [port, var_node] : bdd_.portVarMap()) {
+  // The variable bindings persist across evaluations, so walk the
+  // expression's ports rather than every binding; ports can appear
+  // more than once in the expression, so visit each once.
+  LibertyPortSet ports;
+  FuncExprPortIterator expr_port_iter(expr);
+  while (expr_port_iter.hasNext())
+    ports.insert(expr_port_iter.next());
+  for (LibertyPort *port : ports) {
+    DdNode *var_node = bdd_mgr.findNode(port);
     const Pin *pin = findLinkPin(inst, port);
-    if (pin) {
+    if (var_node && pin) {
       PwrActivity var_activity = findActivity(pin);
       unsigned int var_index = Cudd_NodeReadIndex(var_node);
-      DdNode *diff = Cudd_bddBooleanDiff(bdd_.cuddMgr(), bdd, var_index);
+      DdNode *diff = Cudd_bddBooleanDiff(bdd_mgr.cuddMgr(), bdd, var_index);
       Cudd_Ref(diff);
-      float diff_duty = evalBddDuty(diff, inst);
-      Cudd_RecursiveDeref(bdd_.cuddMgr(), diff);
+      float diff_duty = evalBddDuty(diff, inst, bdd_mgr);
+      Cudd_RecursiveDeref(bdd_mgr.cuddMgr(), diff);
       float var_density = var_activity.density() * diff_duty;
       density += var_density;
       debugPrint(debug_, "power_activity", 3, "%s %.3e * %.3f = %.3e",
@@ -714,9 +883,15 @@ Power::ensureActivities()
   if (!activities_valid_) {
     // No need to propagate activites if global activity is set.
     if (!global_activity_.isSet()) {
-      // Clear existing activities.
-      activity_map_.clear();
+      // Clear existing activities and size the array to cover the
+      // graph vertex ids so the parallel visits never grow it.
+      VertexId max_id = 0;
+      VertexIterator vertex_iter(graph_);
+      while (vertex_iter.hasNext())
+        max_id = max(max_id, graph_->id(vertex_iter.next()));
+      activities_.assign(max_id + 1, PwrActivity());
       seq_activity_map_.clear();
+      bdd_.clearVarMap();
 
       // Initialize default input activity (after sdc is defined)
       // unless it has been set by command.
@@ -730,31 +905,75 @@ Power::ensureActivities()
       ActivitySrchPred activity_srch_pred(this);
       BfsFwdIterator bfs(BfsIndex::other, &activity_srch_pred, this);
       seedActivities(bfs);
-      PropActivityVisitor visitor(this, &bfs);
-      // Propagate activities through combinational logic.
-      bfs.visit(levelize_->maxLevel(), &visitor);
-      // Propagate activiities through registers.
-      InstanceSet regs = std::move(visitor.visitedRegs());
-      int pass = 1;
-      while (!regs.empty() && pass < max_activity_passes_) {
-        visitor.init();
-	for (const Instance *reg : regs)
-	  // Propagate activiities across register D->Q.
-	  seedRegOutputActivities(reg, bfs);
-	// Propagate register output activities through
-	// combinational logic.
-	bfs.visit(levelize_->maxLevel(), &visitor);
-        regs = std::move(visitor.visitedRegs());
-        debugPrint(debug_, "power_activity", 1, "Pass %d change %.2f",
-                   pass, visitor.maxChange());
-        pass++;
-      }
+      propagateActivities(bfs);
     }
     activities_valid_ = true;
+    activity_invalid_pins_.clear();
+  }
+  else if (!activity_invalid_pins_.empty()
+           && !global_activity_.isSet()) {
+    // Localized activity edits; reseed propagation from the edited
+    // pins.  The change tolerance stops it where the fanout is
+    // unaffected.
+    ActivitySrchPred activity_srch_pred(this);
+    BfsFwdIterator bfs(BfsIndex::other, &activity_srch_pred, this);
+    for (const Pin *pin : activity_invalid_pins_) {
+      if (network_->isTopLevelPort(pin)) {
+        if (!sdc_->isLeafPinClock(pin)
+            && !network_->direction(pin)->isInternal()) {
+          // Reseed the port like seedActivities().
+          if (hasUserActivity(pin))
+            setActivity(pin, userActivity(pin));
+          else
+            setActivity(pin, input_activity_);
+          Vertex *vertex = graph_->pinDrvrVertex(pin);
+          if (vertex)
+            bfs.enqueueAdjacentVertices(vertex);
+        }
+      }
+      else {
+        // The visit picks up the user activity, or recomputes the
+        // pin from its driver/function when it has been unset.
+        Vertex *vertex = graph_->pinLoadVertex(pin);
+        if (vertex)
+          bfs.enqueue(vertex);
+      }
+    }
+    propagateActivities(bfs);
+    activity_invalid_pins_.clear();
   }
   stats.report("Power activities");
 }
 
+void
+Power::propagateActivities(BfsFwdIterator &bfs)
+{
+  PropActivityVisitor visitor(this, &bfs);
+  // Propagate activities through combinational logic.  The visits
+  // write disjoint activity slots, so each level is split across
+  // the dispatch queue threads.
+  bfs.visitParallel(levelize_->maxLevel(), &visitor);
+  // Propagate activiities through registers.
+  InstanceSet regs = std::move(visitor.visitedRegs());
+  int pass = 1;
+  while (!regs.empty() && pass < max_activity_passes_) {
+    visitor.init();
+    for (const Instance *reg : regs)
+      // Propagate activiities across register D->Q.
+      seedRegOutputActivities(reg, bfs);
+    // Propagate register output activities through
+    // combinational logic.
+    bfs.visitParallel(levelize_->maxLevel(), &visitor);
+    regs = std::move(visitor.visitedRegs());
+    debugPrint(debug_, "power_activity", 1, "Pass %d change %.2f",
+               pass, visitor.maxChange());
+    pass++;
+  }
+  // Cached powers for instances with changed activities are stale.
+  InstanceSet &changed_insts = visitor.changedInsts();
+  power_invalid_insts_.insert(changed_insts.begin(), changed_insts.end());
+}
+
 void
 Power::seedActivities(BfsFwdIterator &bfs)
 {
@@ -874,24 +1093,154 @@ Power::ensureInstPowers(const Corner *corner)
   if (!instance_powers_valid_
       || corner != corner_) {
     findInstPowers(corner);
+    power_invalid_insts_.clear();
     instance_powers_valid_ = true;
   }
+  else if (!power_invalid_insts_.empty()) {
+    // Incremental update; recompute just the instances downstream of
+    // the activity edits.
+    Stats stats(debug_, report_);
+    for (const Instance *inst : power_invalid_insts_) {
+      LibertyCell *cell = network_->libertyCell(inst);
+      if (cell)
+        instance_powers_[inst] = power(inst, cell, corner,
+                                       arc_delay_calc_, bdd_);
+    }
+    power_invalid_insts_.clear();
+    stats.report("Find power incremental");
+  }
 }
 
+class ClkInstConfigHash
+{
+public:
+  size_t operator()(const ClkInstConfig &config) const
+  {
+    size_t hash = hash_init_value;
+    for (uint64_t value : config)
+      hashIncr(hash, value);
+    return hash;
+  }
+};
+
+// Pack the values an instance's power depends on: its cell and, in
+// pin order, the slews, output loads and activities of its pins.
+// Instances with equal configurations have equal power.  Returns
+// false for instances outside the clock network.
+bool
+Power::findClkInstConfig(const Instance *inst,
+                         const Corner *corner,
+                         // Return value.
+                         ClkInstConfig &config)
+{
+  if (!inClockNetwork(inst))
+    return false;
+  const DcalcAnalysisPt *dcalc_ap = corner->findDcalcAnalysisPt(MinMax::max());
+  config.push_back(reinterpret_cast<uint64_t>(network_->libertyCell(inst)));
+  auto pack_float = [&config](float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    config.push_back(bits);
+  };
+  InstancePinIterator *pin_iter = network_->pinIterator(inst);
+  while (pin_iter->hasNext()) {
+    const Pin *pin = pin_iter->next();
+    LibertyPort *port = network_->libertyPort(pin);
+    if (port) {
+      bool is_output = port->direction()->isAnyOutput();
+      if (is_output)
+        pack_float(graph_delay_calc_->loadCap(pin, dcalc_ap, arc_delay_calc_));
+      Vertex *vertex = is_output
+        ? graph_->pinDrvrVertex(pin)
+        : graph_->pinLoadVertex(pin);
+      if (vertex) {
+        for (const RiseFall *rf : RiseFall::range())
+          pack_float(getSlew(vertex, rf, corner));
+      }
+      PwrActivity activity = findActivity(pin);
+      pack_float(activity.density());
+      pack_float(activity.duty());
+    }
+  }
+  delete pin_iter;
+  return true;
+}
+
+// Instance powers are independent once the activities exist, so they
+// are split across the dispatch queue threads.  Each thread gets its
+// own arc delay calc and bdd copies so delay calculator state and the
+// cudd manager are not shared.
 void
 Power::findInstPowers(const Corner *corner)
 {
   Stats stats(debug_, report_);
+  InstanceSeq insts;
+  // Clock tree instances have deterministic activity and repeat a few
+  // distinct (cell, slew, load) configurations, so one representative
+  // of each configuration is evaluated and the result is shared
+  // across the group.
+  UnorderedMap<ClkInstConfig, InstanceSeq, ClkInstConfigHash> clk_groups;
   LeafInstanceIterator *inst_iter = network_->leafInstanceIterator();
   while (inst_iter->hasNext()) {
-    Instance *inst = inst_iter->next();
-    LibertyCell *cell = network_->libertyCell(inst);
-    if (cell) {
-      PowerResult inst_power = power(inst, cell, corner);
-      instance_powers_[inst] = inst_power;
+    const Instance *inst = inst_iter->next();
+    if (network_->libertyCell(inst)) {
+      ClkInstConfig config;
+      if (findClkInstConfig(inst, corner, config)) {
+        InstanceSeq &group = clk_groups[std::move(config)];
+        group.push_back(inst);
+        if (group.size() == 1)
+          insts.push_back(inst);
+      }
+      else
+        insts.push_back(inst);
     }
   }
   delete inst_iter;
+
+  size_t inst_count = insts.size();
+  size_t thread_count = threadCount();
+  if (thread_count <= 1
+      || dispatchQueue() == nullptr
+      || inst_count < thread_count) {
+    for (const Instance *inst : insts)
+      instance_powers_[inst] = power(inst, network_->libertyCell(inst), corner,
+                                     arc_delay_calc_, bdd_);
+  }
+  else {
+    std::vector<PowerResult> inst_powers(inst_count);
+    std::vector<ArcDelayCalc*> dcalcs(thread_count);
+    std::vector<Bdd*> bdds(thread_count);
+    for (size_t k = 0; k < thread_count; k++) {
+      dcalcs[k] = arc_delay_calc_->copy();
+      bdds[k] = new Bdd(this);
+    }
+    size_t chunk_size = inst_count / thread_count + 1;
+    size_t from = 0;
+    for (size_t k = 0; k < thread_count && from < inst_count; k++) {
+      size_t to = std::min(from + chunk_size, inst_count);
+      dispatch_queue_->dispatch([this, &insts, &inst_powers, &dcalcs, &bdds,
+                                 corner, k, from, to](int) {
+        for (size_t i = from; i < to; i++) {
+          const Instance *inst = insts[i];
+          inst_powers[i] = power(inst, network_->libertyCell(inst), corner,
+                                 dcalcs[k], *bdds[k]);
+        }
+      });
+      from = to;
+    }
+    dispatch_queue_->finishTasks();
+    for (size_t k = 0; k < thread_count; k++) {
+      delete dcalcs[k];
+      delete bdds[k];
+    }
+    for (size_t i = 0; i < inst_count; i++)
+      instance_powers_[insts[i]] = inst_powers[i];
+  }
+  for (const auto &[config, group] : clk_groups) {
+    const PowerResult &group_power = instance_powers_[group[0]];
+    for (size_t i = 1; i < group.size(); i++)
+      instance_powers_[group[i]] = group_power;
+  }
   corner_ = corner;
   stats.report("Find power");
 }
@@ -899,12 +1248,14 @@ Power::findInstPowers(const Corner *corner)
 PowerResult
 Power::power(const Instance *inst,
 	     LibertyCell *cell,
-	     const Corner *corner)
+	     const Corner *corner,
+	     ArcDelayCalc *arc_delay_calc,
+	     Bdd &bdd_mgr)
 {
   PowerResult result;
-  findInternalPower(inst, cell, corner, result);
-  findSwitchingPower(inst, cell, corner, result);
-  findLeakagePower(inst, cell, corner, result);
+  findInternalPower(inst, cell, corner, arc_delay_calc, bdd_mgr, result);
+  findSwitchingPower(inst, cell, corner, arc_delay_calc, result);
+  findLeakagePower(inst, cell, corner, bdd_mgr, result);
   return result;
 }
 
@@ -929,6 +1280,8 @@ void
 Power::findInternalPower(const Instance *inst,
                          LibertyCell *cell,
                          const Corner *corner,
+                         ArcDelayCalc *arc_delay_calc,
+                         Bdd &bdd_mgr,
                          // Return values.
                          PowerResult &result)
 {
@@ -939,15 +1292,15 @@ Power::findInternalPower(const Instance *inst,
     LibertyPort *to_port = network_->libertyPort(to_pin);
     if (to_port) {
       float load_cap = to_port->direction()->isAnyOutput()
-        ? graph_delay_calc_->loadCap(to_pin, dcalc_ap)
+        ? graph_delay_calc_->loadCap(to_pin, dcalc_ap, arc_delay_calc)
         : 0.0;
       PwrActivity activity = findActivity(to_pin);
       if (to_port->direction()->isAnyOutput())
         findOutputInternalPower(to_port, inst, cell, activity,
-                                load_cap, corner, result);
+                                load_cap, corner, bdd_mgr, result);
       if (to_port->direction()->isAnyInput())
         findInputInternalPower(to_pin, to_port, inst, cell, activity,
-                               load_cap, corner, result);
+                               load_cap, corner, bdd_mgr, result);
     }
   }
   delete pin_iter;
@@ -961,6 +1314,7 @@ Power::findInputInternalPower(const Pin *pin,
 			      PwrActivity &activity,
 			      float load_cap,
 			      const Corner *corner,
+			      Bdd &bdd_mgr,
 			      // Return values.
 			      PowerResult &result)
 {
@@ -986,7 +1340,8 @@ Power::findInputInternalPower(const Pin *pin,
         for (const RiseFall *rf : RiseFall::range()) {
           float slew = getSlew(vertex, rf, corner);
           if (!delayInf(slew)) {
-            float table_energy = pwr->power(rf, pvt, slew, load_cap);
+            float table_energy = internalPowerCached(pwr, rf, pvt,
+                                                     slew, load_cap);
             energy += table_energy;
             rf_count++;
           }
@@ -1002,13 +1357,13 @@ Power::findInputInternalPower(const Pin *pin,
             if (out_port) {
               FuncExpr *func = out_port->function();
               if (func && func->hasPort(port))
-                duty = evalDiffDuty(func, port, inst);
+                duty = evalDiffDuty(func, port, inst, bdd_mgr);
               else
-                duty = evalActivity(when, inst).duty();
+                duty = evalActivity(when, inst, bdd_mgr).duty();
             }
           }
           else
-            duty = evalActivity(when, inst).duty();
+            duty = evalActivity(when, inst, bdd_mgr).duty();
         }
         float port_internal = energy * duty * activity.density();
         debugPrint(debug_, "power", 2,  " %3s %6s  %.2f  %.2f %9.2e %9.2e %s",
@@ -1026,6 +1381,79 @@ Power::findInputInternalPower(const Pin *pin,
   }
 }
 
+InternalPowerKey::InternalPowerKey() :
+  pwr_(nullptr),
+  rf_(nullptr),
+  pvt_(nullptr),
+  slew_bucket_(0),
+  cap_bucket_(0)
+{
+}
+
+InternalPowerKey::InternalPowerKey(const InternalPower *pwr,
+                                   const RiseFall *rf,
+                                   const Pvt *pvt,
+                                   int64_t slew_bucket,
+                                   int64_t cap_bucket) :
+  pwr_(pwr),
+  rf_(rf),
+  pvt_(pvt),
+  slew_bucket_(slew_bucket),
+  cap_bucket_(cap_bucket)
+{
+}
+
+bool
+InternalPowerKey::operator==(const InternalPowerKey &key) const
+{
+  return pwr_ == key.pwr_
+    && rf_ == key.rf_
+    && pvt_ == key.pvt_
+    && slew_bucket_ == key.slew_bucket_
+    && cap_bucket_ == key.cap_bucket_;
+}
+
+size_t
+InternalPowerKey::hash() const
+{
+  size_t hash = hash_init_value;
+  hashIncr(hash, reinterpret_cast<size_t>(pwr_));
+  hashIncr(hash, reinterpret_cast<size_t>(rf_));
+  hashIncr(hash, reinterpret_cast<size_t>(pvt_));
+  hashIncr(hash, static_cast<size_t>(slew_bucket_));
+  hashIncr(hash, static_cast<size_t>(cap_bucket_));
+  return hash;
+}
+
+// Internal power table evaluations repeat across replicated instances
+// with near identical slews and loads, so the interpolated energies
+// are memoized over quantized operating points using the same
+// tolerance buckets as the gate delay memo in GraphDelayCalc.
+float
+Power::internalPowerCached(InternalPower *pwr,
+                           const RiseFall *rf,
+                           const Pvt *pvt,
+                           float in_slew,
+                           float load_cap)
+{
+  float tol = graph_delay_calc_->delayCalcCacheTolerance();
+  if (tol <= 0.0)
+    return pwr->power(rf, pvt, in_slew, load_cap);
+  InternalPowerKey key(pwr, rf, pvt,
+                       dcalcCacheBucket(in_slew, tol),
+                       dcalcCacheBucket(load_cap, tol));
+  {
+    LockGuard lock(internal_power_cache_lock_);
+    const auto cached = internal_power_cache_.find(key);
+    if (cached != internal_power_cache_.end())
+      return cached->second;
+  }
+  float energy = pwr->power(rf, pvt, in_slew, load_cap);
+  LockGuard lock(internal_power_cache_lock_);
+  internal_power_cache_[key] = energy;
+  return energy;
+}
+
 float
 Power::getSlew(Vertex *vertex,
                const RiseFall *rf,
@@ -1099,6 +1527,7 @@ Power::findOutputInternalPower(const LibertyPort *to_port,
 			       PwrActivity &to_activity,
 			       float load_cap,
 			       const Corner *corner,
+			       Bdd &bdd_mgr,
 			       // Return values.
 			       PowerResult &result)
 {
@@ -1118,7 +1547,7 @@ Power::findOutputInternalPower(const LibertyPort *to_port,
     if (from_corner_port) {
       const Pin *from_pin = findLinkPin(inst, from_corner_port);
       float from_density = findActivity(from_pin).density();
-      float duty = findInputDuty(inst, func, pwr);
+      float duty = findInputDuty(inst, func, pwr, bdd_mgr);
       const char *related_pg_pin = pwr->relatedPgPin();
       // Note related_pg_pin may be null.
       pg_duty_sum[related_pg_pin] += from_density * duty;
@@ -1131,7 +1560,7 @@ Power::findOutputInternalPower(const LibertyPort *to_port,
   for (InternalPower *pwr : corner_cell->internalPowers(to_corner_port)) {
     FuncExpr *when = pwr->when();
     const char *related_pg_pin = pwr->relatedPgPin();
-    float duty = findInputDuty(inst, func, pwr);
+    float duty = findInputDuty(inst, func, pwr, bdd_mgr);
     Vertex *from_vertex = nullptr;
     bool positive_unate = true;
     const LibertyPort *from_corner_port = pwr->relatedPort();
@@ -1151,7 +1580,8 @@ Power::findOutputInternalPower(const LibertyPort *to_port,
 	? getSlew(from_vertex, from_rf, corner)
 	: 0.0;
       if (!delayInf(slew)) {
-	float table_energy = pwr->power(to_rf, pvt, slew, load_cap);
+	float table_energy = internalPowerCached(pwr, to_rf, pvt,
+						 slew, load_cap);
 	energy += table_energy;
 	rf_count++;
       }
@@ -1186,7 +1616,8 @@ Power::findOutputInternalPower(const LibertyPort *to_port,
 float
 Power::findInputDuty(const Instance *inst,
                      FuncExpr *func,
-                     InternalPower *pwr)
+                     InternalPower *pwr,
+                     Bdd &bdd_mgr)
 
 {
   const LibertyPort *from_corner_port = pwr->relatedPort();
@@ -1198,11 +1629,11 @@ Power::findInputDuty(const Instance *inst,
       FuncExpr *when = pwr->when();
       Vertex *from_vertex = graph_->pinLoadVertex(from_pin);
       if (func && func->hasPort(from_port)) {
-	float duty = evalDiffDuty(func, from_port, inst);
+	float duty = evalDiffDuty(func, from_port, inst, bdd_mgr);
 	return duty;
       }
       else if (when)
-	return evalActivity(when, inst).duty();
+	return evalActivity(when, inst, bdd_mgr).duty();
       else if (search_->isClock(from_vertex))
 	return 0.5;
       return 0.5;
@@ -1249,6 +1680,7 @@ void
 Power::findSwitchingPower(const Instance *inst,
                           LibertyCell *cell,
                           const Corner *corner,
+                          ArcDelayCalc *arc_delay_calc,
                           // Return values.
                           PowerResult &result)
 {
@@ -1260,7 +1692,7 @@ Power::findSwitchingPower(const Instance *inst,
     const LibertyPort *to_port = network_->libertyPort(to_pin);
     if (to_port) {
       float load_cap = to_port->direction()->isAnyOutput()
-        ? graph_delay_calc_->loadCap(to_pin, dcalc_ap)
+        ? graph_delay_calc_->loadCap(to_pin, dcalc_ap, arc_delay_calc)
         : 0.0;
       PwrActivity activity = findActivity(to_pin);
       if (to_port->direction()->isAnyOutput()) {
@@ -1286,6 +1718,7 @@ void
 Power::findLeakagePower(const Instance *inst,
 			LibertyCell *cell,
 			const Corner *corner,
+			Bdd &bdd_mgr,
 			// Return values.
 			PowerResult &result)
 {
@@ -1298,7 +1731,7 @@ Power::findLeakagePower(const Instance *inst,
   for (LeakagePower *leak : *corner_cell->leakagePowers()) {
     FuncExpr *when = leak->when();
     if (when) {
-      PwrActivity cond_activity = evalActivity(when, inst);
+      PwrActivity cond_activity = evalActivity(when, inst, bdd_mgr);
       float cond_duty = cond_activity.duty();
       debugPrint(debug_, "power", 2, "leakage %s %s %.3e * %.2f",
                  cell->name(),
@@ -1358,8 +1791,9 @@ Power::findActivity(const Pin *pin)
   if (vertex && vertex->isConstant())
     return PwrActivity(0.0, 0.0, PwrActivityOrigin::constant);
   else if (vertex && search_->isClock(vertex)) {
-    if (activity_map_.hasKey(pin)) {
-      PwrActivity &activity = activity_map_[pin];
+    VertexId id = graph_->id(vertex);
+    if (id < activities_.size()) {
+      PwrActivity &activity = activities_[id];
       if (activity.origin() != PwrActivityOrigin::unknown)
         return activity;
     }
@@ -1369,10 +1803,13 @@ Power::findActivity(const Pin *pin)
   }
   else if (global_activity_.isSet())
     return global_activity_;
-  else if (activity_map_.hasKey(pin)) {
-    PwrActivity &activity = activity_map_[pin];
-    if (activity.origin() != PwrActivityOrigin::unknown)
-      return activity;
+  else if (vertex) {
+    VertexId id = graph_->id(vertex);
+    if (id < activities_.size()) {
+      PwrActivity &activity = activities_[id];
+      if (activity.origin() != PwrActivityOrigin::unknown)
+        return activity;
+    }
   }
   return PwrActivity(0.0, 0.0, PwrActivityOrigin::unknown);
 }
@@ -1597,7 +2034,7 @@ Power::clockMinPeriod()
 void
 Power::deleteInstanceBefore(const Instance *)
 {
-  activities_valid_ = false;
+  activitiesInvalid();
   instance_powers_.clear();
   corner_ = nullptr;
 }
@@ -1605,7 +2042,7 @@ Power::deleteInstanceBefore(const Instance *)
 void
 Power::deletePinBefore(const Pin *)
 {
-  activities_valid_ = false;
+  activitiesInvalid();
   instance_powers_.clear();
   corner_ = nullptr;
 }
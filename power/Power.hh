@@ -24,9 +24,12 @@
 
 #pragma once
 
+#include <cstdint>
 #include <utility>
+#include <vector>
 
 #include "StaConfig.hh"  // CUDD
+#include "Mutex.hh"
 #include "UnorderedMap.hh"
 #include "Network.hh"
 #include "SdcClass.hh"
@@ -42,9 +45,13 @@ namespace sta {
 class Sta;
 class Corner;
 class DcalcAnalysisPt;
+class ArcDelayCalc;
+class InternalPower;
+class Pvt;
 class PropActivityVisitor;
 class BfsFwdIterator;
 class Vertex;
+class FuncExprTable;
 
 typedef std::pair<const Instance*, LibertyPort*> SeqPin;
 
@@ -69,6 +76,43 @@ typedef UnorderedMap<const Pin*, PwrActivity> PwrActivityMap;
 typedef UnorderedMap<SeqPin, PwrActivity,
 		     SeqPinHash, SeqPinEqual> PwrSeqActivityMap;
 
+// Packed (cell, slews, loads, activities) configuration of a clock
+// network instance; see Power::findClkInstConfig.
+typedef std::vector<uint64_t> ClkInstConfig;
+
+// Memo key for an internal power table evaluation: the power record,
+// transition, operating condition and quantized input slew and load
+// cap, bucketed by the delay calc cache tolerance shared with the
+// gate delay memo in GraphDelayCalc.
+class InternalPowerKey
+{
+public:
+  InternalPowerKey();
+  InternalPowerKey(const InternalPower *pwr,
+                   const RiseFall *rf,
+                   const Pvt *pvt,
+                   int64_t slew_bucket,
+                   int64_t cap_bucket);
+  bool operator==(const InternalPowerKey &key) const;
+  size_t hash() const;
+
+private:
+  const InternalPower *pwr_;
+  const RiseFall *rf_;
+  const Pvt *pvt_;
+  int64_t slew_bucket_;
+  int64_t cap_bucket_;
+};
+
+class InternalPowerKeyHash
+{
+public:
+  size_t operator()(const InternalPowerKey &key) const { return key.hash(); }
+};
+
+typedef UnorderedMap<InternalPowerKey, float,
+                     InternalPowerKeyHash> InternalPowerCacheMap;
+
 // The Power class has access to Sta components directly for
 // convenience but also requires access to the Sta class member functions.
 class Power : public StaState
@@ -113,6 +157,7 @@ public:
 
 protected:
   PwrActivity &activity(const Pin *pin);
+  void activityInvalid(const Pin *pin);
   bool inClockNetwork(const Instance *inst);
   void powerInside(const Instance *hinst,
                    const Corner *corner,
@@ -134,12 +179,20 @@ protected:
 
   void ensureInstPowers(const Corner *corner);
   void findInstPowers(const Corner *corner);
+  bool findClkInstConfig(const Instance *inst,
+                         const Corner *corner,
+                         // Return value.
+                         ClkInstConfig &config);
   PowerResult power(const Instance *inst,
                     LibertyCell *cell,
-                    const Corner *corner);
+                    const Corner *corner,
+                    ArcDelayCalc *arc_delay_calc,
+                    Bdd &bdd_mgr);
   void findInternalPower(const Instance *inst,
                          LibertyCell *cell,
                          const Corner *corner,
+                         ArcDelayCalc *arc_delay_calc,
+                         Bdd &bdd_mgr,
                          // Return values.
                          PowerResult &result);
   void findInputInternalPower(const Pin *to_pin,
@@ -149,6 +202,7 @@ protected:
 			      PwrActivity &to_activity,
 			      float load_cap,
 			      const Corner *corner,
+			      Bdd &bdd_mgr,
 			      // Return values.
 			      PowerResult &result);
   void findOutputInternalPower(const LibertyPort *to_port,
@@ -157,16 +211,24 @@ protected:
 			       PwrActivity &to_activity,
 			       float load_cap,
 			       const Corner *corner,
+			       Bdd &bdd_mgr,
 			       // Return values.
 			       PowerResult &result);
+  float internalPowerCached(InternalPower *pwr,
+                            const RiseFall *rf,
+                            const Pvt *pvt,
+                            float in_slew,
+                            float load_cap);
   void findLeakagePower(const Instance *inst,
 			LibertyCell *cell,
 			const Corner *corner,
+			Bdd &bdd_mgr,
 			// Return values.
 			PowerResult &result);
   void findSwitchingPower(const Instance *inst,
                           LibertyCell *cell,
                           const Corner *corner,
+                          ArcDelayCalc *arc_delay_calc,
                           // Return values.
                           PowerResult &result);
   float getSlew(Vertex *vertex,
@@ -185,6 +247,7 @@ protected:
 		      const char *pg_port_name,
 		      const DcalcAnalysisPt *dcalc_ap);
   void seedActivities(BfsFwdIterator &bfs);
+  void propagateActivities(BfsFwdIterator &bfs);
   void seedRegOutputActivities(const Instance *reg,
 			       Sequential *seq,
 			       LibertyPort *output,
@@ -199,15 +262,20 @@ protected:
 			   const Instance *inst);
   PwrActivity evalActivity(FuncExpr *expr,
 			   const Instance *inst,
-			   const LibertyPort *cofactor_port,
-			   bool cofactor_positive);
+			   Bdd &bdd_mgr);
+  bool evalTableActivity(FuncExprTable *table,
+			 const Instance *inst,
+			 // Return value.
+			 PwrActivity &activity);
   LibertyPort *findExprOutPort(FuncExpr *expr);
   float findInputDuty(const Instance *inst,
 		      FuncExpr *func,
-		      InternalPower *pwr);
+		      InternalPower *pwr,
+		      Bdd &bdd_mgr);
   float evalDiffDuty(FuncExpr *expr,
                      LibertyPort *from_port,
-                     const Instance *inst);
+                     const Instance *inst,
+                     Bdd &bdd_mgr);
   LibertyPort *findLinkPort(const LibertyCell *cell,
 			    const LibertyPort *corner_port);
   Pin *findLinkPin(const Instance *inst,
@@ -218,9 +286,12 @@ protected:
                      const Pin *&clk,
                      const Pin *&gclk) const;
   float evalBddActivity(DdNode *bdd,
-                        const Instance *inst);
+                        const FuncExpr *expr,
+                        const Instance *inst,
+                        Bdd &bdd_mgr);
   float evalBddDuty(DdNode *bdd,
-                    const Instance *inst);
+                    const Instance *inst,
+                    Bdd &bdd_mgr);
   void findUnannotatedPins(const Instance *inst,
                            PinSeq &unannotated_pins);
   size_t pinCount();
@@ -233,13 +304,25 @@ private:
   PwrActivity input_activity_;
   // set_pin_activity -input_ports -pins
   PwrActivityMap user_activity_map_;
-  // Propagated activities.
-  PwrActivityMap activity_map_;
+  // Propagated activities, indexed by vertex id.  The flat array
+  // keeps hashing out of the propagation passes and gives parallel
+  // level visits a private slot per pin to write.
+  std::vector<PwrActivity> activities_;
   PwrSeqActivityMap seq_activity_map_;
+  // Pins with activities edited since the last propagation, used to
+  // reseed an incremental update when the existing activities are
+  // otherwise valid.
+  PinSet activity_invalid_pins_;
   bool activities_valid_;
   Bdd bdd_;
   std::map<const Instance*, PowerResult, InstanceIdLess> instance_powers_;
+  // Instances whose cached power is stale after an incremental
+  // activity update.
+  InstanceSet power_invalid_insts_;
   bool instance_powers_valid_;
+  // Memoized internal power table evaluations (internalPowerCached).
+  InternalPowerCacheMap internal_power_cache_;
+  std::mutex internal_power_cache_lock_;
   const Corner *corner_;
 
   static constexpr int max_activity_passes_ = 100;
@@ -29,6 +29,8 @@
 
 #include "Error.hh"
 #include "Debug.hh"
+#include "GzPipeStream.hh"
+#include "MappedFile.hh"
 #include "Stats.hh"
 #include "Report.hh"
 #include "Network.hh"
@@ -73,18 +75,32 @@ SaifReader::SaifReader(const char *filename,
 bool
 SaifReader::read()
 {
-  gzstream::igzstream stream(filename_);
-  if (stream.is_open()) {
-    Stats stats(debug_, report_);
-    SaifScanner scanner(&stream, filename_, this, report_);
-    SaifParse parser(&scanner, this);
-    // yyparse returns 0 on success.
-    bool success = (parser.parse() == 0);
-    report_->reportLine("Annotated %zu pin activities.", annotated_pins_.size());
-    return success;
+  if (isCompressed(filename_)) {
+    // Decompress on a background thread while the parser consumes.
+    GzPipeStream stream(filename_);
+    if (!stream.is_open())
+      throw FileNotReadable(filename_);
+    return read(stream);
   }
-  else
-    throw FileNotReadable(filename_);
+  else {
+    // Lex uncompressed files directly over a memory mapping.
+    MappedFileStream stream(filename_);
+    if (!stream.is_open())
+      throw FileNotReadable(filename_);
+    return read(stream);
+  }
+}
+
+bool
+SaifReader::read(std::istream &stream)
+{
+  Stats stats(debug_, report_);
+  SaifScanner scanner(&stream, filename_, this, report_);
+  SaifParse parser(&scanner, this);
+  // yyparse returns 0 on success.
+  bool success = (parser.parse() == 0);
+  report_->reportLine("Annotated %zu pin activities.", annotated_pins_.size());
+  return success;
 }
 
 void
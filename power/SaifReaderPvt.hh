@@ -25,6 +25,7 @@
 #pragma once
 
 #include <cstdint>
+#include <istream>
 #include <vector>
 #include <string>
 #include <set>
@@ -67,6 +68,7 @@ public:
   const char *filename() { return filename_; }
 
 private:
+  bool read(std::istream &stream);
   std::string unescaped(const char *token);
 
   const char *filename_;
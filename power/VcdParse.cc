@@ -55,6 +55,9 @@ VcdParse::read(const char *filename,
     reader_ = reader;
     file_line_ = 0;
     stmt_line_ = 0;
+    buffer_.resize(buffer_size);
+    buffer_length_ = 0;
+    buffer_next_ = 0;
     std::string token = getToken();
     while (!token.empty()) {
       if (token == "$date")
@@ -245,8 +248,6 @@ VcdParse::parseVarValues()
       reader_->varAppendValue(id, time_, char0);
     }
     else if (char0 == 'B') {
-      if (file_line_ == 148904)
-        printf("luse\n");
       string bus_value = token.substr(1);
       string id = getToken();
       if (!reader_->varIdValid(id))
@@ -291,20 +292,33 @@ VcdParse::readStmtTokens()
   return tokens;
 }
 
+int
+VcdParse::getChar()
+{
+  if (buffer_next_ >= buffer_length_) {
+    int length = gzread(stream_, buffer_.data(), buffer_.size());
+    if (length <= 0)
+      return EOF;
+    buffer_length_ = length;
+    buffer_next_ = 0;
+  }
+  return static_cast<unsigned char>(buffer_[buffer_next_++]);
+}
+
 string
 VcdParse::getToken()
 {
   string token;
-  int ch = gzgetc(stream_);
+  int ch = getChar();
   // skip whitespace
   while (ch != EOF && isspace(ch)) {
     if (ch == '\n')
       file_line_++;
-    ch = gzgetc(stream_);
+    ch = getChar();
   }
   while (ch != EOF && !isspace(ch)) {
     token.push_back(ch);
-    ch = gzgetc(stream_);
+    ch = getChar();
   }
   if (ch == '\n')
     file_line_++;
@@ -74,6 +74,7 @@ private:
   void parseScope();
   void parseUpscope();
   void parseVarValues();
+  int getChar();
   std::string getToken();
   std::string readStmtString();
   std::vector<std::string> readStmtTokens();
@@ -81,6 +82,11 @@ private:
   VcdReader *reader_;
   gzFile stream_;
   std::string token_;
+  // Block buffer between the stream and the tokenizer; reading large
+  // dumps a character at a time with gzgetc is too slow.
+  std::vector<char> buffer_;
+  size_t buffer_length_;
+  size_t buffer_next_;
   const char *filename_;
   int file_line_;
   int stmt_line_;
@@ -91,6 +97,8 @@ private:
 
   Report *report_;
   Debug *debug_;
+
+  static constexpr size_t buffer_size = 128 * 1024;
 };
 
 // Abstract class for VcdParse callbacks.
@@ -33,11 +33,13 @@
 #include "TimingRole.hh"
 #include "Clock.hh"
 #include "Sdc.hh"
+#include "DispatchQueue.hh"
 
 namespace sta {
 
 CycleAcctings::CycleAcctings(Sdc *sdc) :
-  sdc_(sdc)
+  sdc_(sdc),
+  acct_edge_count_(0)
 {
 }
 
@@ -50,6 +52,91 @@ void
 CycleAcctings::clear()
 {
   cycle_acctings_.deleteContentsClear();
+  acct_table_.clear();
+  acct_edge_count_ = 0;
+}
+
+// Precompute the accounting for all clock edge pairs so searches
+// read them from the table without locking.  Cleared along with the
+// lazy set whenever the clocks change.
+void
+CycleAcctings::findAcctings()
+{
+  std::vector<const ClockEdge*> tgts;
+  for (Clock *clk : *sdc_->clocks()) {
+    for (const RiseFall *rf : RiseFall::range())
+      tgts.push_back(clk->edge(rf));
+  }
+  std::vector<const ClockEdge*> srcs = tgts;
+  srcs.push_back(sdc_->defaultArrivalClockEdge());
+
+  int max_index = 0;
+  for (const ClockEdge *src : srcs)
+    max_index = std::max(max_index, src->index());
+  acct_edge_count_ = max_index + 1;
+  acct_table_.assign(static_cast<size_t>(acct_edge_count_) * acct_edge_count_,
+		     nullptr);
+  for (CycleAccting *acct : cycle_acctings_)
+    acct_table_[acct->src()->index() * acct_edge_count_
+		+ acct->target()->index()] = acct;
+
+  std::vector<CycleAccting*> accts;
+  for (const ClockEdge *src : srcs) {
+    for (const ClockEdge *tgt : tgts) {
+      if (findAccting(src, tgt) == nullptr)
+	accts.push_back(new CycleAccting(src, tgt));
+    }
+  }
+  size_t acct_count = accts.size();
+  unsigned thread_count = sdc_->threadCount();
+  DispatchQueue *dispatch_queue = sdc_->dispatchQueue();
+  if (thread_count <= 1
+      || dispatch_queue == nullptr
+      || acct_count < thread_count) {
+    for (CycleAccting *acct : accts)
+      findDelays(acct);
+  }
+  else {
+    size_t chunk_size = acct_count / thread_count + 1;
+    size_t from = 0;
+    for (unsigned k = 0; k < thread_count && from < acct_count; k++) {
+      size_t to = std::min(from + chunk_size, acct_count);
+      dispatch_queue->dispatch([this, &accts, from, to](int) {
+	for (size_t i = from; i < to; i++)
+	  findDelays(accts[i]);
+      });
+      from = to;
+    }
+    dispatch_queue->finishTasks();
+  }
+  for (CycleAccting *acct : accts) {
+    cycle_acctings_.insert(acct);
+    acct_table_[acct->src()->index() * acct_edge_count_
+		+ acct->target()->index()] = acct;
+  }
+}
+
+void
+CycleAcctings::findDelays(CycleAccting *acct)
+{
+  if (acct->src() == sdc_->defaultArrivalClockEdge())
+    acct->findDefaultArrivalSrcDelays();
+  else
+    acct->findDelays(sdc_);
+}
+
+CycleAccting *
+CycleAcctings::findAccting(const ClockEdge *src,
+			   const ClockEdge *tgt) const
+{
+  if (src == nullptr)
+    src = tgt;
+  int src_index = src->index();
+  int tgt_index = tgt->index();
+  if (src_index < acct_edge_count_
+      && tgt_index < acct_edge_count_)
+    return acct_table_[src_index * acct_edge_count_ + tgt_index];
+  return nullptr;
 }
 
 // Determine cycle accounting "on demand".
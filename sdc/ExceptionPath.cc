@@ -1475,7 +1475,8 @@ ExceptionThru::ExceptionThru(PinSet *pins,
   pins_(pins),
   edges_(nullptr),
   nets_(nets),
-  insts_(insts)
+  insts_(insts),
+  match_pins_(nullptr)
 {
   // Delete empty sets.
   if (pins_ && pins_->empty()) {
@@ -1494,9 +1495,48 @@ ExceptionThru::ExceptionThru(PinSet *pins,
     insts_ = nullptr;
   }
   makeAllEdges(network);
+  makeMatchPins(network);
   findHash(network);
 }
 
+// Compile the pin, net, and instance matches into one pin set so
+// matches() is a single lookup instead of net and instance queries
+// for every edge the search visits.
+void
+ExceptionThru::makeMatchPins(const Network *network)
+{
+  delete match_pins_;
+  match_pins_ = nullptr;
+  if (pins_ || nets_ || insts_) {
+    match_pins_ = new PinSet(network);
+    if (pins_) {
+      for (const Pin *pin : *pins_)
+	match_pins_->insert(pin);
+    }
+    if (nets_) {
+      for (const Net *net : *nets_) {
+	NetConnectedPinIterator *pin_iter = network->connectedPinIterator(net);
+	while (pin_iter->hasNext()) {
+	  const Pin *pin = pin_iter->next();
+	  if (nets_->hasKey(network->net(pin)))
+	    match_pins_->insert(pin);
+	}
+	delete pin_iter;
+      }
+    }
+    if (insts_) {
+      for (const Instance *inst : *insts_) {
+	InstancePinIterator *pin_iter = network->pinIterator(inst);
+	while (pin_iter->hasNext()) {
+	  const Pin *pin = pin_iter->next();
+	  match_pins_->insert(pin);
+	}
+	delete pin_iter;
+      }
+    }
+  }
+}
+
 void
 ExceptionThru::makeAllEdges(const Network *network)
 {
@@ -1642,6 +1682,7 @@ ExceptionThru::~ExceptionThru()
     delete insts_;
     delete edges_;
   }
+  delete match_pins_;
 }
 
 const char *
@@ -1746,6 +1787,9 @@ ExceptionThru::addPin(const Pin *pin,
     pins_ = new PinSet(network);
   if (!pins_->hasKey(pin)) {
     pins_->insert(pin);
+    if (match_pins_ == nullptr)
+      match_pins_ = new PinSet(network);
+    match_pins_->insert(pin);
     // Incrementally update hash.
     hash_ += network->id(pin) * hash_pin;
   }
@@ -1759,6 +1803,15 @@ ExceptionThru::addNet(const Net *net,
     nets_ = new NetSet(network);
   if (!nets_->hasKey(net)) {
     nets_->insert(net);
+    if (match_pins_ == nullptr)
+      match_pins_ = new PinSet(network);
+    NetConnectedPinIterator *pin_iter = network->connectedPinIterator(net);
+    while (pin_iter->hasNext()) {
+      const Pin *pin = pin_iter->next();
+      if (network->net(pin) == net)
+	match_pins_->insert(pin);
+    }
+    delete pin_iter;
     // Incrementally update hash.
     hash_ += network->id(net) * hash_net;
   }
@@ -1772,6 +1825,12 @@ ExceptionThru::addInstance(const Instance *inst,
     insts_ = new InstanceSet(network);
   if (!insts_->hasKey(inst)) {
     insts_->insert(inst);
+    if (match_pins_ == nullptr)
+      match_pins_ = new PinSet(network);
+    InstancePinIterator *pin_iter = network->pinIterator(inst);
+    while (pin_iter->hasNext())
+      match_pins_->insert(pin_iter->next());
+    delete pin_iter;
     // Incrementally update hash.
     hash_ += network->id(inst) * hash_inst;
   }
@@ -1795,6 +1854,11 @@ ExceptionThru::deletePin(const Pin *pin,
     auto itr = pins_->find(pin);
     if (itr != pins_->end()) {
       pins_->erase(itr);
+      // The pin may still match through a net or instance.
+      if (match_pins_
+          && !(nets_ && network->net(pin) && nets_->hasKey(network->net(pin)))
+          && !(insts_ && insts_->hasKey(network->instance(pin))))
+        match_pins_->erase(pin);
       // Incrementally update hash.
       hash_ -= network->id(pin) * hash_pin;
     }
@@ -1809,6 +1873,7 @@ ExceptionThru::deleteNet(const Net *net,
     auto itr = nets_->find(net);
     if (itr != nets_->end()) {
       nets_->erase(itr);
+      makeMatchPins(network);
       // Incrementally update hash.
       hash_ -= network->id(net) * hash_net;
     }
@@ -1823,6 +1888,7 @@ ExceptionThru::deleteInstance(const Instance *inst,
     auto itr = insts_->find(inst);
     if (itr != insts_->end()) {
       insts_->erase(itr);
+      makeMatchPins(network);
       // Incrementally update hash.
       hash_ -= network->id(inst) * hash_inst;
     }
@@ -1872,13 +1938,11 @@ bool
 ExceptionThru::matches(const Pin *from_pin,
 		       const Pin *to_pin,
 		       const RiseFall *to_rf,
-		       const Network *network)
+		       const Network *)
 {
   EdgePins edge_pins(from_pin, to_pin);
-  return ((pins_ && to_pin && pins_->hasKey(to_pin))
-	  || (edges_ && from_pin && to_pin && edges_->hasKey(edge_pins))
-	  || (nets_ && to_pin && nets_->hasKey(network->net(to_pin)))
-	  || (insts_ && to_pin && insts_->hasKey(network->instance(to_pin))))
+  return ((match_pins_ && to_pin && match_pins_->hasKey(to_pin))
+	  || (edges_ && from_pin && to_pin && edges_->hasKey(edge_pins)))
     && rf_->matches(to_rf);
 }
 
@@ -2069,6 +2133,9 @@ ExceptionThru::connectPinAfter(PinSet *drvrs,
       }
     }
   }
+  // The connected pin may now match through a net or instance.
+  if (nets_ || insts_)
+    makeMatchPins(network);
 }
 
 void
@@ -2084,6 +2151,10 @@ ExceptionThru::deletePinBefore(const Pin *pin,
                                Network *network)
 {
   deletePin(pin, network);
+  // The pin is leaving the network, so remove it even if it still
+  // matches through a net or instance.
+  if (match_pins_)
+    match_pins_->erase(pin);
   // Remove edges from/to leaf pin and through hier pin.
   deletePinEdges(pin, network);
 }
@@ -179,6 +179,8 @@ Sdc::clear()
   pin_clk_gating_check_map_.clear();
   data_checks_from_map_.clear();
   data_checks_to_map_.clear();
+  data_check_from_pin_bits_.clear();
+  data_check_to_pin_bits_.clear();
 
   input_delays_.clear();
   input_delay_pin_map_.clear();
@@ -241,6 +243,10 @@ Sdc::initVariables()
   path_delays_without_to_ = false;
   clk_hpin_disables_valid_ = false;
   have_clk_slew_limits_ = false;
+  clk_group_matrix_stride_ = 0;
+  clk_latency_index_stride_ = 0;
+  clk_insertion_index_stride_ = 0;
+  makeDerateFlatTable();
 }
 
 void
@@ -251,7 +257,9 @@ Sdc::deleteConstraints()
   clock_pin_map_.deleteContents();
   clock_leaf_pin_map_.deleteContents();
   clk_latencies_.deleteContents();
+  clearClkLatencyIndex();
   clk_insertions_.deleteContents();
+  clearClkInsertionIndex();
 
   clk_groups_name_map_.deleteContents();
   clearClkGroupExclusions();
@@ -604,6 +612,7 @@ Sdc::setTimingDerate(TimingDerateType type,
   if (derating_factors_ == nullptr)
     derating_factors_ = new DeratingFactorsGlobal;
   derating_factors_->setFactor(type, clk_data, rf, early_late, derate);
+  makeDerateFlatTable();
 }
 
 void
@@ -653,6 +662,35 @@ Sdc::setTimingDerate(const LibertyCell *cell,
   factors->setFactor(type, clk_data, rf, early_late, derate);
 }
 
+// Resolve the global derates against the 1.0 default into a flat
+// table so arc evaluations that find no net, instance or cell
+// specific derate read one indexed entry instead of probing exists
+// flags scope by scope.
+void
+Sdc::makeDerateFlatTable()
+{
+  for (int type = 0; type < timing_derate_type_count; type++) {
+    for (int clk_data = 0; clk_data < path_clk_or_data_count; clk_data++) {
+      for (auto rf : RiseFall::range()) {
+	for (auto early_late : EarlyLate::range()) {
+	  float factor = 1.0;
+	  if (derating_factors_) {
+	    float value;
+	    bool exists;
+	    derating_factors_->factor(static_cast<TimingDerateType>(type),
+				      static_cast<PathClkOrData>(clk_data),
+				      rf, early_late, value, exists);
+	    if (exists)
+	      factor = value;
+	  }
+	  derate_flat_[type][clk_data][rf->index()][early_late->index()] =
+	    factor;
+	}
+      }
+    }
+  }
+}
+
 float
 Sdc::timingDerateInstance(const Pin *pin,
 			  TimingDerateCellType type,
@@ -661,35 +699,33 @@ Sdc::timingDerateInstance(const Pin *pin,
 			  const EarlyLate *early_late) const
 {
   const Instance *inst = network_->instance(pin);
-  DeratingFactorsCell *factors = inst_derating_factors_.findKey(inst);
-  if (factors) {
-    float factor;
-    bool exists;
-    factors->factor(type, clk_data, rf, early_late, factor, exists);
-    if (exists)
-      return factor;
-  }
-
-  const LibertyCell *cell = network_->libertyCell(inst);
-  if (cell) {
-    DeratingFactorsCell *factors = cell_derating_factors_.findKey(cell);
-    float factor;
-    bool exists;
+  if (!inst_derating_factors_.empty()) {
+    DeratingFactorsCell *factors = inst_derating_factors_.findKey(inst);
     if (factors) {
+      float factor;
+      bool exists;
       factors->factor(type, clk_data, rf, early_late, factor, exists);
       if (exists)
-        return factor;
+	return factor;
     }
   }
 
-  if (derating_factors_) {
-    float factor;
-    bool exists;
-    derating_factors_->factor(type, clk_data, rf, early_late, factor, exists);
-    if (exists)
-      return factor;
+  if (!cell_derating_factors_.empty()) {
+    const LibertyCell *cell = network_->libertyCell(inst);
+    if (cell) {
+      DeratingFactorsCell *factors = cell_derating_factors_.findKey(cell);
+      float factor;
+      bool exists;
+      if (factors) {
+	factors->factor(type, clk_data, rf, early_late, factor, exists);
+	if (exists)
+	  return factor;
+      }
+    }
   }
-  return 1.0;
+
+  return derate_flat_[int(type)][int(clk_data)]
+    [rf->index()][early_late->index()];
 }
 
 float
@@ -698,25 +734,20 @@ Sdc::timingDerateNet(const Pin *pin,
 		     const RiseFall *rf,
 		     const EarlyLate *early_late) const
 {
-  const Net *net = network_->net(pin);
-  DeratingFactorsNet *factors = net_derating_factors_.findKey(net);
-  if (factors) {
-    float factor;
-    bool exists;
-    factors->factor(clk_data, rf, early_late, factor, exists);
-    if (exists)
-      return factor;
+  if (!net_derating_factors_.empty()) {
+    const Net *net = network_->net(pin);
+    DeratingFactorsNet *factors = net_derating_factors_.findKey(net);
+    if (factors) {
+      float factor;
+      bool exists;
+      factors->factor(clk_data, rf, early_late, factor, exists);
+      if (exists)
+	return factor;
+    }
   }
 
-  if (derating_factors_) {
-    float factor;
-    bool exists;
-    derating_factors_->factor(TimingDerateType::net_delay, clk_data, rf,
-			      early_late, factor, exists);
-    if (exists)
-      return factor;
-  }
-  return 1.0;
+  return derate_flat_[int(TimingDerateType::net_delay)][int(clk_data)]
+    [rf->index()][early_late->index()];
 }
 
 void
@@ -733,6 +764,8 @@ Sdc::swapDeratingFactors(Sdc *sdc1,
   swap(sdc1->net_derating_factors_, sdc2->net_derating_factors_);
   swap(sdc1->inst_derating_factors_, sdc2->inst_derating_factors_);
   swap(sdc1->cell_derating_factors_, sdc2->cell_derating_factors_);
+  sdc1->makeDerateFlatTable();
+  sdc2->makeDerateFlatTable();
 }
 
 void
@@ -744,6 +777,7 @@ Sdc::deleteDeratingFactors()
 
   delete derating_factors_;
   derating_factors_ = nullptr;
+  makeDerateFlatTable();
 }
 
 ////////////////////////////////////////////////////////////////
@@ -1513,6 +1547,7 @@ Sdc::setClockLatency(Clock *clk,
     clk_latencies_.insert(latency);
   }
   latency->setDelay(rf, min_max, delay);
+  makeClkLatencyIndex();
 
   // set_clock_latency removes set_propagated_clock on the same object.
   if (clk && pin == nullptr)
@@ -1536,6 +1571,7 @@ Sdc::deleteClockLatency(ClockLatency *latency)
 {
   clk_latencies_.erase(latency);
   delete latency;
+  makeClkLatencyIndex();
 }
 
 void
@@ -1551,13 +1587,51 @@ Sdc::deleteClockLatenciesReferencing(Clock *clk)
     else
       iter++;
   }
+  makeClkLatencyIndex();
+}
+
+// Flatten clk_latencies_ into dense arrays indexed by clock index so
+// the search lookups below are an array index instead of a set search.
+// Clocks defined after the rebuild have indices past the array ends;
+// the bounds checks in the lookups treat them as missing entries.
+void
+Sdc::makeClkLatencyIndex()
+{
+  clearClkLatencyIndex();
+  clk_latency_index_stride_ = clk_index_ + 1;
+  clk_latency_clk_index_.assign(clk_index_, nullptr);
+  for (ClockLatency *latency : clk_latencies_) {
+    const Clock *clk = latency->clock();
+    const Pin *pin = latency->pin();
+    if (pin) {
+      ClockLatency **&latencies = clk_latency_pin_index_[pin];
+      if (latencies == nullptr) {
+	latencies = new ClockLatency*[clk_latency_index_stride_];
+	for (size_t i = 0; i < clk_latency_index_stride_; i++)
+	  latencies[i] = nullptr;
+      }
+      latencies[clk ? clk->index() + 1 : 0] = latency;
+    }
+    else if (clk)
+      clk_latency_clk_index_[clk->index()] = latency;
+  }
+}
+
+void
+Sdc::clearClkLatencyIndex()
+{
+  for (const auto [pin, latencies] : clk_latency_pin_index_)
+    delete [] latencies;
+  clk_latency_pin_index_.clear();
+  clk_latency_clk_index_.clear();
+  clk_latency_index_stride_ = 0;
 }
 
 bool
 Sdc::hasClockLatency(const Pin *pin) const
 {
-  ClockLatency probe(nullptr, pin);
-  return clk_latencies_.hasKey(&probe);
+  ClockLatency **latencies = clk_latency_pin_index_.findKey(pin);
+  return latencies && latencies[0];
 }
 
 void
@@ -1571,17 +1645,16 @@ Sdc::clockLatency(const Clock *clk,
 {
   latency = 0.0;
   exists = false;
-  if (pin && clk) {
-    ClockLatency probe(clk, pin);
-    ClockLatency *latencies = clk_latencies_.findKey(&probe);
-    if (latencies)
-      latencies->delay(rf, min_max, latency, exists);
-  }
-  if (!exists) {
-    ClockLatency probe(nullptr, pin);
-    ClockLatency *latencies = clk_latencies_.findKey(&probe);
-    if (latencies)
-      latencies->delay(rf, min_max, latency, exists);
+  ClockLatency **latencies = clk_latency_pin_index_.findKey(pin);
+  if (latencies) {
+    if (clk) {
+      size_t index = clk->index() + 1;
+      if (index < clk_latency_index_stride_
+	  && latencies[index])
+	latencies[index]->delay(rf, min_max, latency, exists);
+    }
+    if (!exists && latencies[0])
+      latencies[0]->delay(rf, min_max, latency, exists);
   }
 }
 
@@ -1595,10 +1668,14 @@ Sdc::clockLatency(const Clock *clk,
 {
   latency = 0.0;
   exists = false;
-  ClockLatency probe(clk, nullptr);
-  ClockLatency *latencies = clk_latencies_.findKey(&probe);
-  if (latencies)
-    latencies->delay(rf, min_max, latency, exists);
+  if (clk) {
+    size_t index = clk->index();
+    if (index < clk_latency_clk_index_.size()) {
+      ClockLatency *latencies = clk_latency_clk_index_[index];
+      if (latencies)
+	latencies->delay(rf, min_max, latency, exists);
+    }
+  }
 }
 
 float
@@ -1759,6 +1836,7 @@ Sdc::setClockInsertion(const Clock *clk,
     clk_insertions_.insert(insertion);
   }
   insertion->setDelay(rf, min_max, early_late, delay);
+  makeClkInsertionIndex();
 }
 
 void
@@ -1776,6 +1854,7 @@ Sdc::setClockInsertion(const Clock *clk,
     clk_insertions_.insert(insertion);
   }
   insertion->setDelay(rf, min_max, early_late, delay);
+  makeClkInsertionIndex();
 }
 
 void
@@ -1793,6 +1872,8 @@ Sdc::swapClockInsertions(Sdc *sdc1,
                          Sdc *sdc2)
 {
   swap(sdc1->clk_insertions_, sdc2->clk_insertions_);
+  sdc1->makeClkInsertionIndex();
+  sdc2->makeClkInsertionIndex();
 }
 
 void
@@ -1800,6 +1881,7 @@ Sdc::deleteClockInsertion(ClockInsertion *insertion)
 {
   clk_insertions_.erase(insertion);
   delete insertion;
+  makeClkInsertionIndex();
 }
 
 void
@@ -1815,6 +1897,43 @@ Sdc::deleteClockInsertionsReferencing(Clock *clk)
     else
       iter++;
   }
+  makeClkInsertionIndex();
+}
+
+// Flatten clk_insertions_ into dense arrays indexed by clock index,
+// mirroring makeClkLatencyIndex above; clockInsertion is called in the
+// slack arithmetic of every path end with a propagated source clock.
+void
+Sdc::makeClkInsertionIndex()
+{
+  clearClkInsertionIndex();
+  clk_insertion_index_stride_ = clk_index_ + 1;
+  clk_insertion_clk_index_.assign(clk_index_, nullptr);
+  for (ClockInsertion *insertion : clk_insertions_) {
+    const Clock *clk = insertion->clock();
+    const Pin *pin = insertion->pin();
+    if (pin) {
+      ClockInsertion **&insertions = clk_insertion_pin_index_[pin];
+      if (insertions == nullptr) {
+	insertions = new ClockInsertion*[clk_insertion_index_stride_];
+	for (size_t i = 0; i < clk_insertion_index_stride_; i++)
+	  insertions[i] = nullptr;
+      }
+      insertions[clk ? clk->index() + 1 : 0] = insertion;
+    }
+    else if (clk)
+      clk_insertion_clk_index_[clk->index()] = insertion;
+  }
+}
+
+void
+Sdc::clearClkInsertionIndex()
+{
+  for (const auto [pin, insertions] : clk_insertion_pin_index_)
+    delete [] insertions;
+  clk_insertion_pin_index_.clear();
+  clk_insertion_clk_index_.clear();
+  clk_insertion_index_stride_ = 0;
 }
 
 float
@@ -1832,8 +1951,8 @@ Sdc::clockInsertion(const Clock *clk,
 bool
 Sdc::hasClockInsertion(const Pin *pin) const
 {
-  ClockInsertion probe(nullptr, pin);
-  return clk_insertions_.hasKey(&probe);
+  ClockInsertion **insertions = clk_insertion_pin_index_.findKey(pin);
+  return insertions && insertions[0];
 }
 
 void
@@ -1847,17 +1966,22 @@ Sdc::clockInsertion(const Clock *clk,
 		    bool &exists) const
 {
   ClockInsertion *insert = nullptr;
-  if (clk && pin) {
-    ClockInsertion probe(clk, pin);
-    insert = clk_insertions_.findKey(&probe);
-  }
-  if (insert == nullptr && pin) {
-    ClockInsertion probe(nullptr, pin);
-    insert = clk_insertions_.findKey(&probe);
+  if (pin) {
+    ClockInsertion **insertions = clk_insertion_pin_index_.findKey(pin);
+    if (insertions) {
+      if (clk) {
+	size_t index = clk->index() + 1;
+	if (index < clk_insertion_index_stride_)
+	  insert = insertions[index];
+      }
+      if (insert == nullptr)
+	insert = insertions[0];
+    }
   }
   if (insert == nullptr && clk) {
-    ClockInsertion probe(clk, nullptr);
-    insert = clk_insertions_.findKey(&probe);
+    size_t index = clk->index();
+    if (index < clk_insertion_clk_index_.size())
+      insert = clk_insertion_clk_index_[index];
   }
 
   if (insert)
@@ -1966,6 +2090,7 @@ Sdc::ensureClkGroupExclusions()
   if (clk_group_exclusions_.empty()) {
     for (const auto [name, clk_groups] : clk_groups_name_map_)
       makeClkGroupExclusions(clk_groups);
+    makeClkGroupMatrices();
   }
 }
    
@@ -2033,11 +2158,55 @@ Sdc::makeClkGroupSame(ClockGroup *group)
   }
 }
 
+// Flatten the exclusion/same pair sets into bit matrices indexed by
+// clock index.  sameClockGroup runs in the path enumeration inner
+// loops, so the pair test is two loads and a mask instead of a set
+// lookup.
+void
+Sdc::makeClkGroupMatrices()
+{
+  size_t clk_count = clk_index_;
+  clk_group_matrix_stride_ = (clk_count + 63) / 64;
+  clk_group_exclusion_bits_.assign(clk_count * clk_group_matrix_stride_, 0);
+  clk_group_same_bits_.assign(clk_count * clk_group_matrix_stride_, 0);
+  for (const ClockPair &pair : clk_group_exclusions_) {
+    size_t index1 = pair.first->index();
+    size_t index2 = pair.second->index();
+    clk_group_exclusion_bits_[index1 * clk_group_matrix_stride_ + index2 / 64]
+      |= uint64_t(1) << (index2 % 64);
+    clk_group_exclusion_bits_[index2 * clk_group_matrix_stride_ + index1 / 64]
+      |= uint64_t(1) << (index1 % 64);
+  }
+  for (const ClockPair &pair : clk_group_same_) {
+    size_t index1 = pair.first->index();
+    size_t index2 = pair.second->index();
+    clk_group_same_bits_[index1 * clk_group_matrix_stride_ + index2 / 64]
+      |= uint64_t(1) << (index2 % 64);
+    clk_group_same_bits_[index2 * clk_group_matrix_stride_ + index1 / 64]
+      |= uint64_t(1) << (index1 % 64);
+  }
+}
+
+bool
+Sdc::clkPairBit(const std::vector<uint64_t> &bits,
+		size_t stride,
+		const Clock *clk1,
+		const Clock *clk2)
+{
+  size_t index1 = clk1->index();
+  size_t index2 = clk2->index();
+  return (bits[index1 * stride + index2 / 64]
+	  >> (index2 % 64)) & 1;
+}
+
 void
 Sdc::clearClkGroupExclusions()
 {
   clk_group_exclusions_.clear();
   clk_group_same_.clear();
+  clk_group_exclusion_bits_.clear();
+  clk_group_same_bits_.clear();
+  clk_group_matrix_stride_ = 0;
 }
 
 bool
@@ -2045,6 +2214,13 @@ Sdc::sameClockGroup(const Clock *clk1,
 		    const Clock *clk2)
 {
   if (clk1 && clk2) {
+    // Clocks made after the matrices were built fall back to the pair set.
+    if (static_cast<size_t>(clk1->index()) * clk_group_matrix_stride_
+	< clk_group_exclusion_bits_.size()
+	&& static_cast<size_t>(clk2->index()) * clk_group_matrix_stride_
+	< clk_group_exclusion_bits_.size())
+      return !clkPairBit(clk_group_exclusion_bits_, clk_group_matrix_stride_,
+			 clk1, clk2);
     ClockPair clk_pair(clk1, clk2);
     bool excluded = clk_group_exclusions_.hasKey(clk_pair);
     return !excluded;
@@ -2057,6 +2233,12 @@ bool
 Sdc::sameClockGroupExplicit(const Clock *clk1,
 			    const Clock *clk2)
 {
+  if (static_cast<size_t>(clk1->index()) * clk_group_matrix_stride_
+      < clk_group_same_bits_.size()
+      && static_cast<size_t>(clk2->index()) * clk_group_matrix_stride_
+      < clk_group_same_bits_.size())
+    return clkPairBit(clk_group_same_bits_, clk_group_matrix_stride_,
+		      clk1, clk2);
   ClockPair clk_pair(clk1, clk2);
   return clk_group_same_.hasKey(clk_pair);
 }
@@ -2386,13 +2568,26 @@ Sdc::clockGatingActiveValue(const Pin *clk_pin,
 
 ////////////////////////////////////////////////////////////////
 
-// Determine cycle accounting "on demand".
+// Precompute the accounting for all clock edge pairs so searches
+// hit the lock-free table below.
+void
+Sdc::ensureCycleAcctings()
+{
+  cycle_acctings_.findAcctings();
+}
+
 CycleAccting *
 Sdc::cycleAccting(const ClockEdge *src,
 		  const ClockEdge *tgt)
 {
-  LockGuard lock(cycle_acctings_lock_);
-  return cycle_acctings_.cycleAccting(src, tgt);
+  CycleAccting *acct = cycle_acctings_.findAccting(src, tgt);
+  if (acct == nullptr) {
+    // Clock edge pair missing from the table (clocks changed since
+    // ensureCycleAcctings); determine cycle accounting "on demand".
+    LockGuard lock(cycle_acctings_lock_);
+    acct = cycle_acctings_.cycleAccting(src, tgt);
+  }
+  return acct;
 }
 
 void
@@ -2409,6 +2604,25 @@ Sdc::clearCycleAcctings()
 
 ////////////////////////////////////////////////////////////////
 
+static void
+setPinIdBit(std::vector<uint64_t> &bits,
+	    ObjectId id)
+{
+  size_t word = id / 64;
+  if (word >= bits.size())
+    bits.resize(word + 1, 0);
+  bits[word] |= uint64_t(1) << (id % 64);
+}
+
+static bool
+pinIdBit(const std::vector<uint64_t> &bits,
+	 ObjectId id)
+{
+  size_t word = id / 64;
+  return word < bits.size()
+    && ((bits[word] >> (id % 64)) & 1);
+}
+
 void
 Sdc::setDataCheck(Pin *from,
 		  const RiseFallBoth *from_rf,
@@ -2439,6 +2653,9 @@ Sdc::setDataCheck(Pin *from,
     data_checks_to_map_[to] = checks;
   }
   checks->insert(check);
+
+  setPinIdBit(data_check_from_pin_bits_, network_->id(from));
+  setPinIdBit(data_check_to_pin_bits_, network_->id(to));
 }
 
 void
@@ -2469,12 +2686,16 @@ Sdc::removeDataCheck(Pin *from,
 DataCheckSet *
 Sdc::dataChecksFrom(const Pin *from) const
 {
+  if (!pinIdBit(data_check_from_pin_bits_, network_->id(from)))
+    return nullptr;
   return data_checks_from_map_.findKey(from);
 }
 
 DataCheckSet *
 Sdc::dataChecksTo(const Pin *to) const
 {
+  if (!pinIdBit(data_check_to_pin_bits_, network_->id(to)))
+    return nullptr;
   return data_checks_to_map_.findKey(to);
 }
 
@@ -98,6 +98,18 @@ write_sdc_cmd(const char *filename,
   Sta::sta()->writeSdc(filename, leaf, compatible, digits, gzip, no_timestamp);
 }
 
+bool
+write_sdc_binary_cmd(const char *filename)
+{
+  return Sta::sta()->writeSdcSnapshot(filename);
+}
+
+bool
+read_sdc_binary_cmd(const char *filename)
+{
+  return Sta::sta()->readSdcSnapshot(filename);
+}
+
 void
 set_analysis_type_cmd(const char *analysis_type)
 {
@@ -34,28 +34,37 @@
 
 namespace eval sta {
 
-define_cmd_args "read_sdc" {[-echo] filename}
+define_cmd_args "read_sdc" {[-echo] [-binary] filename}
 
 proc_redirect read_sdc {
-  parse_key_args "read_sdc" args keys {} flags {-echo}
+  parse_key_args "read_sdc" args keys {} flags {-echo -binary}
 
   check_argc_eq1 "read_sdc" $args
-  set echo [info exists flags(-echo)]
   set filename [file nativename [lindex $args 0]]
-  set prev_filename [info script]
-  include_file $filename $echo 0
+  if { [info exists flags(-binary)] } {
+    read_sdc_binary_cmd $filename
+  } else {
+    set echo [info exists flags(-echo)]
+    set prev_filename [info script]
+    include_file $filename $echo 0
+  }
 }
 
 ################################################################
 
 define_cmd_args "write_sdc" \
-  {[-map_hpins] [-digits digits] [-gzip] [-no_timestamp] filename}
+  {[-map_hpins] [-digits digits] [-gzip] [-no_timestamp] [-binary] filename}
 
 proc write_sdc { args } {
   parse_key_args "write_sdc" args keys {-digits -significant_digits} \
-    flags {-map_hpins -compatible -gzip -no_timestamp}
+    flags {-map_hpins -compatible -gzip -no_timestamp -binary}
   check_argc_eq1 "write_sdc" $args
 
+  if { [info exists flags(-binary)] } {
+    write_sdc_binary_cmd [file nativename [lindex $args 0]]
+    return
+  }
+
   set digits 4
   if { [info exists keys(-digits)] } {
     set digits $keys(-digits)
@@ -2325,12 +2334,18 @@ proc set_port_delay { cmd sta_cmd cmd_args port_dirs } {
   set add [info exists flags(-add_delay)]
   set source_latency_included [info exists flags(-source_latency_included)]
   set network_latency_included [info exists flags(-network_latency_included)]
-  
+
+  # Hoisted out of the pin loop; constraint files apply this command
+  # to thousands of pins.
+  set clk_sources {}
+  if { $clk != "NULL" } {
+    set clk_sources [$clk sources]
+  }
   foreach pin $pins {
     if { [$pin is_top_level_port] \
            && [lsearch $port_dirs [pin_direction $pin]] == -1 } {
       sta_warn 440 "$cmd not allowed on [pin_direction $pin] port '[get_full_name $pin]'."
-    } elseif { $clk != "NULL" && [lsearch [$clk sources] $pin] != -1 } {
+    } elseif { [lsearch $clk_sources $pin] != -1 } {
       sta_warn 441 "$cmd relative to a clock defined on the same port/pin not allowed."
     } else {
       $sta_cmd $pin $rf $clk $clk_rf $ref_pin\
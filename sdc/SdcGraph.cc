@@ -22,6 +22,9 @@
 // 
 // This notice may not be removed or altered from any source distribution.
 
+#include <algorithm>
+#include <vector>
+
 #include "Stats.hh"
 #include "PortDirection.hh"
 #include "Network.hh"
@@ -29,6 +32,7 @@
 #include "DisabledPorts.hh"
 #include "PortDelay.hh"
 #include "ClockLatency.hh"
+#include "DispatchQueue.hh"
 #include "Sdc.hh"
 
 namespace sta {
@@ -77,13 +81,32 @@ Sdc::annotateDisables()
   }
 
   if (!disabled_lib_ports_.empty()) {
+    // Chunk the vertex sweep across the thread pool.  Each vertex's
+    // flag is written only by the thread that owns its chunk, so the
+    // updates are disjoint.
+    VertexSeq vertices;
     VertexIterator vertex_iter(graph_);
-    while (vertex_iter.hasNext()) {
-      Vertex *vertex = vertex_iter.next();
-      Pin *pin = vertex->pin();
-      LibertyPort *port = network_->libertyPort(pin);
-      if (disabled_lib_ports_.hasKey(port))
-	annotateGraphDisabled(pin);
+    while (vertex_iter.hasNext())
+      vertices.push_back(vertex_iter.next());
+    size_t vertex_count = vertices.size();
+    size_t thread_count = threadCount();
+    if (thread_count <= 1
+	|| vertex_count < thread_count) {
+      for (Vertex *vertex : vertices)
+	annotateDisabledLibPort(vertex);
+    }
+    else {
+      size_t chunk_size = vertex_count / thread_count + 1;
+      size_t from = 0;
+      for (size_t k = 0; k < thread_count && from < vertex_count; k++) {
+	size_t to = std::min(from + chunk_size, vertex_count);
+	dispatch_queue_->dispatch([this, &vertices, from, to](int) {
+	  for (size_t i = from; i < to; i++)
+	    annotateDisabledLibPort(vertices[i]);
+	});
+	from = to;
+      }
+      dispatch_queue_->finishTasks();
     }
   }
 
@@ -101,13 +124,48 @@ Sdc::annotateDisables()
   for (Edge *edge : disabled_edges_)
     edge->setIsDisabledConstraint(true);
 
+  // Partition the disabled instances across the thread pool.  The
+  // disables only touch edges internal to each instance, so the
+  // instances are independent.
+  std::vector<DisabledInstancePorts*> disabled_insts;
   DisabledInstancePortsMap::Iterator disable_inst_iter(disabled_inst_ports_);
-  while (disable_inst_iter.hasNext()) {
-    DisabledInstancePorts *disabled_inst = disable_inst_iter.next();
-    setEdgeDisabledInstPorts(disabled_inst);
+  while (disable_inst_iter.hasNext())
+    disabled_insts.push_back(disable_inst_iter.next());
+  size_t inst_count = disabled_insts.size();
+  size_t thread_count = threadCount();
+  if (thread_count <= 1
+      || inst_count < thread_count) {
+    for (DisabledInstancePorts *disabled_inst : disabled_insts)
+      setEdgeDisabledInstPorts(disabled_inst);
+  }
+  else {
+    size_t chunk_size = inst_count / thread_count + 1;
+    size_t from = 0;
+    for (size_t k = 0; k < thread_count && from < inst_count; k++) {
+      size_t to = std::min(from + chunk_size, inst_count);
+      dispatch_queue_->dispatch([this, &disabled_insts, from, to](int) {
+	for (size_t i = from; i < to; i++)
+	  setEdgeDisabledInstPorts(disabled_insts[i]);
+      });
+      from = to;
+    }
+    dispatch_queue_->finishTasks();
   }
 }
 
+// Set the vertex disabled flag rather than calling
+// annotateGraphDisabled on the pin so each vertex is written only by
+// the thread that visits it; a bidirect pin's two vertices may land
+// in different chunks.
+void
+Sdc::annotateDisabledLibPort(Vertex *vertex)
+{
+  Pin *pin = vertex->pin();
+  LibertyPort *port = network_->libertyPort(pin);
+  if (disabled_lib_ports_.hasKey(port))
+    vertex->setIsDisabledConstraint(true);
+}
+
 class DisableHpinEdgeVisitor : public HierPinThruVisitor
 {
 public:
@@ -161,6 +219,14 @@ Sdc::annotateGraphDisabled(const Pin *pin)
     bidirect_drvr_vertex->setIsDisabledConstraint(true);
 }
 
+void
+Sdc::annotateGraphDisabled(const Instance *inst)
+{
+  DisabledInstancePorts *disabled_inst = disabled_inst_ports_.findKey(inst);
+  if (disabled_inst)
+    setEdgeDisabledInstPorts(disabled_inst);
+}
+
 void
 Sdc::setEdgeDisabledInstPorts(DisabledInstancePorts *disabled_inst)
 {
@@ -371,26 +437,55 @@ Sdc::clockLatency(Edge *edge,
 void
 Sdc::removeGraphAnnotations()
 {
+  // Chunk the vertex sweep across the thread pool.  Each vertex and
+  // its out edges are cleared only by the thread that owns its chunk,
+  // so the updates are disjoint.
+  VertexSeq vertices;
   VertexIterator vertex_iter(graph_);
-  while (vertex_iter.hasNext()) {
-    Vertex *vertex = vertex_iter.next();
-    vertex->setIsDisabledConstraint(false);
-    vertex->setIsConstrained(false);
-
-    VertexOutEdgeIterator edge_iter(vertex, graph_);
-    while (edge_iter.hasNext()) {
-      Edge *edge = edge_iter.next();
-      edge->setIsDisabledConstraint(false);
+  while (vertex_iter.hasNext())
+    vertices.push_back(vertex_iter.next());
+  size_t vertex_count = vertices.size();
+  size_t thread_count = threadCount();
+  if (thread_count <= 1
+      || vertex_count < thread_count) {
+    for (Vertex *vertex : vertices)
+      removeVertexAnnotations(vertex);
+  }
+  else {
+    size_t chunk_size = vertex_count / thread_count + 1;
+    size_t from = 0;
+    for (size_t k = 0; k < thread_count && from < vertex_count; k++) {
+      size_t to = std::min(from + chunk_size, vertex_count);
+      dispatch_queue_->dispatch([this, &vertices, from, to](int) {
+	for (size_t i = from; i < to; i++)
+	  removeVertexAnnotations(vertices[i]);
+      });
+      from = to;
     }
+    dispatch_queue_->finishTasks();
   }
   edge_clk_latency_.clear();
 }
 
+void
+Sdc::removeVertexAnnotations(Vertex *vertex)
+{
+  vertex->setIsDisabledConstraint(false);
+  vertex->setIsConstrained(false);
+
+  VertexOutEdgeIterator edge_iter(vertex, graph_);
+  while (edge_iter.hasNext()) {
+    Edge *edge = edge_iter.next();
+    edge->setIsDisabledConstraint(false);
+  }
+}
+
 void
 Sdc::searchPreamble()
 {
   ensureClkHpinDisables();
   ensureClkGroupExclusions();
+  ensureCycleAcctings();
 }
 
 } // namespace
@@ -0,0 +1,1104 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2025, Parallax Software, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+//
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// This notice may not be removed or altered from any source distribution.
+
+#include "SdcSnapshot.hh"
+
+#include <cstring>
+#include <fstream>
+#include <sys/stat.h>
+
+#ifndef _WIN32
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <unistd.h>
+#endif
+
+#include "Hash.hh"
+#include "Report.hh"
+#include "MinMax.hh"
+#include "Transition.hh"
+#include "Network.hh"
+#include "Clock.hh"
+#include "PortDelay.hh"
+#include "ExceptionPath.hh"
+#include "DeratingFactors.hh"
+#include "Sdc.hh"
+#include "StaState.hh"
+
+namespace sta {
+
+using std::string;
+
+static constexpr uint32_t sdc_snapshot_magic = 0x43415453;  // "STAC"
+static constexpr uint32_t sdc_snapshot_format_version = 1;
+
+// Exception type codes.
+static constexpr uint8_t snapshot_false_path = 0;
+static constexpr uint8_t snapshot_multicycle_path = 1;
+static constexpr uint8_t snapshot_path_delay = 2;
+static constexpr uint8_t snapshot_group_path = 3;
+
+// Constraints reference design objects by hierarchical name, so each
+// reference is validated as it resolves.  The header hash is a cheap
+// guard that the snapshot was written for the same top level design.
+static size_t
+designHash(const Network *network)
+{
+  const Instance *top = network->topInstance();
+  size_t hash = hashString(network->cellName(top));
+  InstancePinIterator *pin_iter = network->pinIterator(top);
+  while (pin_iter->hasNext()) {
+    const Pin *pin = pin_iter->next();
+    hashIncr(hash, hashString(network->pathName(pin)));
+  }
+  delete pin_iter;
+  return hash;
+}
+
+static uint8_t
+riseFallBothCode(const RiseFallBoth *rf)
+{
+  if (rf == RiseFallBoth::rise())
+    return 0;
+  else if (rf == RiseFallBoth::fall())
+    return 1;
+  else
+    return 2;
+}
+
+static const RiseFallBoth *
+riseFallBothDecode(uint8_t code)
+{
+  switch (code) {
+  case 0:
+    return RiseFallBoth::rise();
+  case 1:
+    return RiseFallBoth::fall();
+  default:
+    return RiseFallBoth::riseFall();
+  }
+}
+
+static uint8_t
+minMaxAllCode(const MinMaxAll *min_max)
+{
+  if (min_max == MinMaxAll::min())
+    return 0;
+  else if (min_max == MinMaxAll::max())
+    return 1;
+  else
+    return 2;
+}
+
+static const MinMaxAll *
+minMaxAllDecode(uint8_t code)
+{
+  switch (code) {
+  case 0:
+    return MinMaxAll::min();
+  case 1:
+    return MinMaxAll::max();
+  default:
+    return MinMaxAll::all();
+  }
+}
+
+static const MinMaxAll *
+asMinMaxAll(const MinMax *min_max)
+{
+  return (min_max == MinMax::min()) ? MinMaxAll::min() : MinMaxAll::max();
+}
+
+////////////////////////////////////////////////////////////////
+//
+// Writer
+//
+////////////////////////////////////////////////////////////////
+
+class SdcSnapshotWriter
+{
+public:
+  SdcSnapshotWriter(const char *filename,
+                    StaState *sta);
+  bool write();
+
+private:
+  void writeClocks();
+  void writeClock(Clock *clk);
+  void writePortDelays(const PortDelaySeq &delays);
+  void writePortDelay(PortDelay *delay);
+  void writeExceptions();
+  void writeException(ExceptionPath *exception);
+  void writeFromTo(ExceptionFromTo *from_to);
+  void writeThru(ExceptionThru *thru);
+  void writePins(const PinSet *pins);
+  void writeClks(const ClockSet *clks);
+  void writeInsts(const InstanceSet *insts);
+  void writeNets(const NetSet *nets);
+  void writeDerates();
+
+  void writeBool(bool value);
+  void writeU8(uint8_t value);
+  void writeU32(uint32_t value);
+  void writeI32(int32_t value);
+  void writeU64(uint64_t value);
+  void writeFloat(float value);
+  void writeString(const char *str);
+
+  const char *filename_;
+  Report *report_;
+  Network *network_;
+  Sdc *sdc_;
+  std::ofstream out_;
+};
+
+SdcSnapshotWriter::SdcSnapshotWriter(const char *filename,
+                                     StaState *sta) :
+  filename_(filename),
+  report_(sta->report()),
+  network_(sta->network()),
+  sdc_(sta->sdc())
+{
+}
+
+bool
+SdcSnapshotWriter::write()
+{
+  if (network_->topInstance() == nullptr) {
+    report_->warn(2337, "no network has been linked.");
+    return false;
+  }
+  out_.open(filename_, std::ios::binary | std::ios::trunc);
+  if (!out_.is_open()) {
+    report_->warn(2338, "cannot open sdc snapshot file %s.", filename_);
+    return false;
+  }
+  writeU32(sdc_snapshot_magic);
+  writeU32(sdc_snapshot_format_version);
+  writeU64(designHash(network_));
+  writeClocks();
+
+  PortDelaySeq input_delays;
+  for (InputDelay *input_delay : sdc_->inputDelays())
+    input_delays.push_back(input_delay);
+  writePortDelays(input_delays);
+  PortDelaySeq output_delays;
+  for (OutputDelay *output_delay : sdc_->outputDelays())
+    output_delays.push_back(output_delay);
+  writePortDelays(output_delays);
+
+  writeExceptions();
+  writeDerates();
+  out_.close();
+  if (out_.fail()) {
+    report_->warn(2339, "error writing sdc snapshot file %s.", filename_);
+    return false;
+  }
+  return true;
+}
+
+void
+SdcSnapshotWriter::writeClocks()
+{
+  ClockSeq *clks = sdc_->clocks();
+  writeU32(clks ? clks->size() : 0);
+  if (clks) {
+    // Definition order so generated clock masters restore first.
+    for (Clock *clk : *clks)
+      writeClock(clk);
+  }
+}
+
+void
+SdcSnapshotWriter::writeClock(Clock *clk)
+{
+  writeString(clk->name());
+  writeBool(clk->isGenerated());
+  writeBool(clk->addToPins());
+  const PinSet &pins = clk->pins();
+  writeU32(pins.size());
+  for (const Pin *pin : pins)
+    writeString(network_->pathName(pin));
+  if (clk->isGenerated()) {
+    writeString(network_->pathName(clk->srcPin()));
+    // An infered master is re-infered from the source pin on restore.
+    Clock *master = clk->masterClkInfered() ? nullptr : clk->masterClk();
+    writeString(master ? master->name() : nullptr);
+    writeI32(clk->divideBy());
+    writeI32(clk->multiplyBy());
+    writeFloat(clk->dutyCycle());
+    writeBool(clk->invert());
+    writeBool(clk->combinational());
+    const IntSeq *edges = clk->edges();
+    writeU32(edges ? edges->size() : 0);
+    if (edges) {
+      for (int edge : *edges)
+        writeI32(edge);
+    }
+    const FloatSeq *edge_shifts = clk->edgeShifts();
+    writeU32(edge_shifts ? edge_shifts->size() : 0);
+    if (edge_shifts) {
+      for (float shift : *edge_shifts)
+        writeFloat(shift);
+    }
+  }
+  else {
+    writeFloat(clk->period());
+    const FloatSeq *waveform = clk->waveform();
+    writeU32(waveform ? waveform->size() : 0);
+    if (waveform) {
+      for (float edge : *waveform)
+        writeFloat(edge);
+    }
+  }
+  writeString(clk->comment());
+  writeBool(clk->isPropagated());
+
+  const RiseFallMinMax &slews = clk->slews();
+  for (const RiseFall *rf : RiseFall::range()) {
+    for (const MinMax *min_max : MinMax::range()) {
+      float slew;
+      bool exists;
+      slews.value(rf, min_max, slew, exists);
+      writeBool(exists);
+      if (exists)
+        writeFloat(slew);
+    }
+  }
+  for (const MinMax *setup_hold : MinMax::range()) {
+    float uncertainty;
+    bool exists;
+    clk->uncertainty(setup_hold, uncertainty, exists);
+    writeBool(exists);
+    if (exists)
+      writeFloat(uncertainty);
+  }
+}
+
+void
+SdcSnapshotWriter::writePortDelays(const PortDelaySeq &delays)
+{
+  writeU32(delays.size());
+  for (PortDelay *delay : delays)
+    writePortDelay(delay);
+}
+
+void
+SdcSnapshotWriter::writePortDelay(PortDelay *delay)
+{
+  writeString(network_->pathName(delay->pin()));
+  const ClockEdge *clk_edge = delay->clkEdge();
+  writeString(clk_edge ? clk_edge->clock()->name() : nullptr);
+  writeU32(clk_edge ? clk_edge->transition()->index() : 0);
+  const Pin *ref_pin = delay->refPin();
+  writeString(ref_pin ? network_->pathName(ref_pin) : nullptr);
+  writeBool(delay->sourceLatencyIncluded());
+  writeBool(delay->networkLatencyIncluded());
+  RiseFallMinMax *values = delay->delays();
+  for (const RiseFall *rf : RiseFall::range()) {
+    for (const MinMax *min_max : MinMax::range()) {
+      float value;
+      bool exists;
+      values->value(rf, min_max, value, exists);
+      writeBool(exists);
+      if (exists)
+        writeFloat(value);
+    }
+  }
+}
+
+void
+SdcSnapshotWriter::writeExceptions()
+{
+  uint32_t count = 0;
+  for (ExceptionPath *exception : sdc_->exceptions()) {
+    // Loop and filter exceptions are session artifacts.
+    if (!exception->isLoop()
+        && !exception->isFilter())
+      count++;
+  }
+  writeU32(count);
+  for (ExceptionPath *exception : sdc_->exceptions()) {
+    if (!exception->isLoop()
+        && !exception->isFilter())
+      writeException(exception);
+  }
+}
+
+void
+SdcSnapshotWriter::writeException(ExceptionPath *exception)
+{
+  uint8_t type;
+  if (exception->isFalse())
+    type = snapshot_false_path;
+  else if (exception->isMultiCycle())
+    type = snapshot_multicycle_path;
+  else if (exception->isPathDelay())
+    type = snapshot_path_delay;
+  else
+    type = snapshot_group_path;
+  writeU8(type);
+  writeU8(minMaxAllCode(exception->minMax()));
+
+  ExceptionFrom *from = exception->from();
+  writeBool(from != nullptr);
+  if (from)
+    writeFromTo(from);
+  ExceptionThruSeq *thrus = exception->thrus();
+  writeU32(thrus ? thrus->size() : 0);
+  if (thrus) {
+    for (ExceptionThru *thru : *thrus)
+      writeThru(thru);
+  }
+  ExceptionTo *to = exception->to();
+  writeBool(to != nullptr);
+  if (to) {
+    writeFromTo(to);
+    writeU8(riseFallBothCode(to->endTransition()));
+  }
+
+  switch (type) {
+  case snapshot_multicycle_path:
+    writeBool(exception->useEndClk());
+    writeI32(exception->pathMultiplier());
+    break;
+  case snapshot_path_delay:
+    writeBool(exception->ignoreClkLatency());
+    writeBool(exception->breakPath());
+    writeFloat(exception->delay());
+    break;
+  case snapshot_group_path:
+    writeString(exception->name());
+    writeBool(exception->isDefault());
+    break;
+  }
+  writeString(exception->comment());
+}
+
+void
+SdcSnapshotWriter::writeFromTo(ExceptionFromTo *from_to)
+{
+  writeU8(riseFallBothCode(from_to->transition()));
+  writePins(from_to->pins());
+  writeClks(from_to->clks());
+  writeInsts(from_to->instances());
+}
+
+void
+SdcSnapshotWriter::writeThru(ExceptionThru *thru)
+{
+  writeU8(riseFallBothCode(thru->transition()));
+  writePins(thru->pins());
+  writeNets(thru->nets());
+  writeInsts(thru->instances());
+}
+
+void
+SdcSnapshotWriter::writePins(const PinSet *pins)
+{
+  writeU32(pins ? pins->size() : 0);
+  if (pins) {
+    for (const Pin *pin : *pins)
+      writeString(network_->pathName(pin));
+  }
+}
+
+void
+SdcSnapshotWriter::writeClks(const ClockSet *clks)
+{
+  writeU32(clks ? clks->size() : 0);
+  if (clks) {
+    for (const Clock *clk : *clks)
+      writeString(clk->name());
+  }
+}
+
+void
+SdcSnapshotWriter::writeInsts(const InstanceSet *insts)
+{
+  writeU32(insts ? insts->size() : 0);
+  if (insts) {
+    for (const Instance *inst : *insts)
+      writeString(network_->pathName(inst));
+  }
+}
+
+void
+SdcSnapshotWriter::writeNets(const NetSet *nets)
+{
+  writeU32(nets ? nets->size() : 0);
+  if (nets) {
+    for (const Net *net : *nets)
+      writeString(network_->pathName(net));
+  }
+}
+
+void
+SdcSnapshotWriter::writeDerates()
+{
+  DeratingFactorsGlobal *derates = sdc_->derating_factors_;
+  for (int type_index = 0; type_index < timing_derate_type_count; type_index++) {
+    for (int clk_data_index = 0;
+         clk_data_index < path_clk_or_data_count;
+         clk_data_index++) {
+      for (const RiseFall *rf : RiseFall::range()) {
+        for (const MinMax *early_late : MinMax::range()) {
+          float factor;
+          bool exists = false;
+          if (derates)
+            derates->factor(static_cast<TimingDerateType>(type_index),
+                            static_cast<PathClkOrData>(clk_data_index),
+                            rf, early_late, factor, exists);
+          writeBool(exists);
+          if (exists)
+            writeFloat(factor);
+        }
+      }
+    }
+  }
+}
+
+void
+SdcSnapshotWriter::writeBool(bool value)
+{
+  writeU8(value ? 1 : 0);
+}
+
+void
+SdcSnapshotWriter::writeU8(uint8_t value)
+{
+  out_.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void
+SdcSnapshotWriter::writeU32(uint32_t value)
+{
+  out_.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void
+SdcSnapshotWriter::writeI32(int32_t value)
+{
+  out_.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void
+SdcSnapshotWriter::writeU64(uint64_t value)
+{
+  out_.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void
+SdcSnapshotWriter::writeFloat(float value)
+{
+  out_.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void
+SdcSnapshotWriter::writeString(const char *str)
+{
+  uint32_t length = str ? strlen(str) : 0;
+  writeU32(length);
+  if (length)
+    out_.write(str, length);
+}
+
+bool
+writeSdcSnapshot(const char *filename,
+                 StaState *sta)
+{
+  SdcSnapshotWriter writer(filename, sta);
+  return writer.write();
+}
+
+////////////////////////////////////////////////////////////////
+//
+// Reader
+//
+////////////////////////////////////////////////////////////////
+
+struct SdcSnapshotError {};
+
+class SdcSnapshotReader
+{
+public:
+  SdcSnapshotReader(const char *filename,
+                    StaState *sta);
+  ~SdcSnapshotReader();
+  bool read();
+
+private:
+  bool mapFile(const char *filename);
+  void unmapFile();
+  void readClocks();
+  void readClock();
+  void readPortDelays(bool is_input);
+  void readPortDelay(bool is_input);
+  void readExceptions();
+  void readException();
+  ExceptionFrom *readFrom();
+  ExceptionThru *readThru();
+  ExceptionTo *readTo();
+  PinSet *readPins();
+  ClockSet *readClks();
+  InstanceSet *readInsts();
+  NetSet *readNets();
+  void readDerates();
+  Pin *findPin(const string &name);
+  Clock *findClock(const string &name);
+  Instance *findInstance(const string &name);
+  Net *findNet(const string &name);
+
+  bool readBool();
+  uint8_t readU8();
+  uint32_t readU32();
+  int32_t readI32();
+  uint64_t readU64();
+  float readFloat();
+  string readString();
+
+  const char *filename_;
+  Report *report_;
+  Network *network_;
+  Sdc *sdc_;
+
+  const char *data_;
+  const char *cursor_;
+  const char *end_;
+  size_t map_length_;
+#ifndef _WIN32
+  int fd_;
+#endif
+};
+
+SdcSnapshotReader::SdcSnapshotReader(const char *filename,
+                                     StaState *sta) :
+  filename_(filename),
+  report_(sta->report()),
+  network_(sta->network()),
+  sdc_(sta->sdc()),
+  data_(nullptr),
+  cursor_(nullptr),
+  end_(nullptr),
+  map_length_(0)
+#ifndef _WIN32
+  , fd_(-1)
+#endif
+{
+}
+
+SdcSnapshotReader::~SdcSnapshotReader()
+{
+  unmapFile();
+}
+
+bool
+SdcSnapshotReader::read()
+{
+  if (network_->topInstance() == nullptr) {
+    report_->warn(2340, "no network to restore an sdc snapshot into.");
+    return false;
+  }
+  if (!mapFile(filename_)) {
+    report_->warn(2341, "cannot read sdc snapshot file %s.", filename_);
+    return false;
+  }
+  try {
+    if (readU32() != sdc_snapshot_magic
+        || readU32() != sdc_snapshot_format_version) {
+      report_->warn(2342, "sdc snapshot file %s has an unsupported format.",
+                    filename_);
+      return false;
+    }
+    if (readU64() != designHash(network_)) {
+      report_->warn(2343,
+                    "sdc snapshot file %s does not match the current design.",
+                    filename_);
+      return false;
+    }
+    readClocks();
+    readPortDelays(true);
+    readPortDelays(false);
+    readExceptions();
+    readDerates();
+    return true;
+  }
+  catch (SdcSnapshotError &) {
+    report_->warn(2344, "error restoring sdc snapshot file %s.", filename_);
+    return false;
+  }
+}
+
+void
+SdcSnapshotReader::readClocks()
+{
+  uint32_t clk_count = readU32();
+  for (uint32_t i = 0; i < clk_count; i++)
+    readClock();
+}
+
+void
+SdcSnapshotReader::readClock()
+{
+  string name = readString();
+  bool is_generated = readBool();
+  bool add_to_pins = readBool();
+  uint32_t pin_count = readU32();
+  PinSet *pins = new PinSet(network_);
+  for (uint32_t i = 0; i < pin_count; i++)
+    pins->insert(findPin(readString()));
+
+  Clock *clk;
+  if (is_generated) {
+    Pin *src_pin = findPin(readString());
+    string master_name = readString();
+    Clock *master_clk = master_name.empty()
+      ? nullptr
+      : findClock(master_name);
+    int divide_by = readI32();
+    int multiply_by = readI32();
+    float duty_cycle = readFloat();
+    bool invert = readBool();
+    bool combinational = readBool();
+    uint32_t edge_count = readU32();
+    IntSeq *edges = edge_count ? new IntSeq : nullptr;
+    for (uint32_t i = 0; i < edge_count; i++)
+      edges->push_back(readI32());
+    uint32_t shift_count = readU32();
+    FloatSeq *edge_shifts = shift_count ? new FloatSeq : nullptr;
+    for (uint32_t i = 0; i < shift_count; i++)
+      edge_shifts->push_back(readFloat());
+    string comment = readString();
+    clk = sdc_->makeGeneratedClock(name.c_str(), pins, add_to_pins,
+                                   src_pin, master_clk,
+                                   divide_by, multiply_by, duty_cycle,
+                                   invert, combinational,
+                                   edges, edge_shifts,
+                                   comment.empty() ? nullptr : comment.c_str());
+  }
+  else {
+    float period = readFloat();
+    uint32_t edge_count = readU32();
+    FloatSeq *waveform = edge_count ? new FloatSeq : nullptr;
+    for (uint32_t i = 0; i < edge_count; i++)
+      waveform->push_back(readFloat());
+    string comment = readString();
+    clk = sdc_->makeClock(name.c_str(), pins, add_to_pins, period, waveform,
+                          comment.empty() ? nullptr : comment.c_str());
+  }
+
+  if (readBool())
+    sdc_->setPropagatedClock(clk);
+  for (const RiseFall *rf : RiseFall::range()) {
+    for (const MinMax *min_max : MinMax::range()) {
+      if (readBool())
+        sdc_->setClockSlew(clk, rf->asRiseFallBoth(), asMinMaxAll(min_max),
+                           readFloat());
+    }
+  }
+  for (const MinMax *setup_hold : MinMax::range()) {
+    if (readBool())
+      clk->setUncertainty(setup_hold, readFloat());
+  }
+}
+
+void
+SdcSnapshotReader::readPortDelays(bool is_input)
+{
+  uint32_t delay_count = readU32();
+  for (uint32_t i = 0; i < delay_count; i++)
+    readPortDelay(is_input);
+}
+
+void
+SdcSnapshotReader::readPortDelay(bool is_input)
+{
+  Pin *pin = findPin(readString());
+  string clk_name = readString();
+  uint32_t clk_rf_index = readU32();
+  Clock *clk = clk_name.empty() ? nullptr : findClock(clk_name);
+  const RiseFall *clk_rf = RiseFall::find(clk_rf_index);
+  string ref_name = readString();
+  Pin *ref_pin = ref_name.empty() ? nullptr : findPin(ref_name);
+  bool source_latency_included = readBool();
+  bool network_latency_included = readBool();
+  for (const RiseFall *rf : RiseFall::range()) {
+    for (const MinMax *min_max : MinMax::range()) {
+      if (readBool()) {
+        float delay = readFloat();
+        // -add_delay so restored clock edges accumulate.
+        if (is_input)
+          sdc_->setInputDelay(pin, rf->asRiseFallBoth(), clk, clk_rf, ref_pin,
+                              source_latency_included,
+                              network_latency_included,
+                              asMinMaxAll(min_max), true, delay);
+        else
+          sdc_->setOutputDelay(pin, rf->asRiseFallBoth(), clk, clk_rf, ref_pin,
+                               source_latency_included,
+                               network_latency_included,
+                               asMinMaxAll(min_max), true, delay);
+      }
+    }
+  }
+}
+
+void
+SdcSnapshotReader::readExceptions()
+{
+  uint32_t exception_count = readU32();
+  for (uint32_t i = 0; i < exception_count; i++)
+    readException();
+}
+
+void
+SdcSnapshotReader::readException()
+{
+  uint8_t type = readU8();
+  const MinMaxAll *min_max = minMaxAllDecode(readU8());
+  ExceptionFrom *from = nullptr;
+  if (readBool())
+    from = readFrom();
+  uint32_t thru_count = readU32();
+  ExceptionThruSeq *thrus = thru_count ? new ExceptionThruSeq : nullptr;
+  for (uint32_t i = 0; i < thru_count; i++)
+    thrus->push_back(readThru());
+  ExceptionTo *to = nullptr;
+  if (readBool())
+    to = readTo();
+
+  switch (type) {
+  case snapshot_false_path: {
+    string comment = readString();
+    sdc_->makeFalsePath(from, thrus, to, min_max,
+                        comment.empty() ? nullptr : comment.c_str());
+    break;
+  }
+  case snapshot_multicycle_path: {
+    bool use_end_clk = readBool();
+    int path_multiplier = readI32();
+    string comment = readString();
+    sdc_->makeMulticyclePath(from, thrus, to, min_max,
+                             use_end_clk, path_multiplier,
+                             comment.empty() ? nullptr : comment.c_str());
+    break;
+  }
+  case snapshot_path_delay: {
+    bool ignore_clk_latency = readBool();
+    bool break_path = readBool();
+    float delay = readFloat();
+    string comment = readString();
+    const MinMax *delay_min_max = (min_max == MinMaxAll::min())
+      ? MinMax::min()
+      : MinMax::max();
+    sdc_->makePathDelay(from, thrus, to, delay_min_max,
+                        ignore_clk_latency, break_path, delay,
+                        comment.empty() ? nullptr : comment.c_str());
+    break;
+  }
+  case snapshot_group_path: {
+    string name = readString();
+    bool is_default = readBool();
+    string comment = readString();
+    sdc_->makeGroupPath(name.empty() ? nullptr : name.c_str(), is_default,
+                        from, thrus, to,
+                        comment.empty() ? nullptr : comment.c_str());
+    break;
+  }
+  default:
+    throw SdcSnapshotError();
+  }
+}
+
+ExceptionFrom *
+SdcSnapshotReader::readFrom()
+{
+  const RiseFallBoth *rf = riseFallBothDecode(readU8());
+  PinSet *pins = readPins();
+  ClockSet *clks = readClks();
+  InstanceSet *insts = readInsts();
+  return sdc_->makeExceptionFrom(pins, clks, insts, rf);
+}
+
+ExceptionTo *
+SdcSnapshotReader::readTo()
+{
+  const RiseFallBoth *rf = riseFallBothDecode(readU8());
+  PinSet *pins = readPins();
+  ClockSet *clks = readClks();
+  InstanceSet *insts = readInsts();
+  const RiseFallBoth *end_rf = riseFallBothDecode(readU8());
+  return sdc_->makeExceptionTo(pins, clks, insts, rf, end_rf);
+}
+
+ExceptionThru *
+SdcSnapshotReader::readThru()
+{
+  const RiseFallBoth *rf = riseFallBothDecode(readU8());
+  PinSet *pins = readPins();
+  NetSet *nets = readNets();
+  InstanceSet *insts = readInsts();
+  return sdc_->makeExceptionThru(pins, nets, insts, rf);
+}
+
+PinSet *
+SdcSnapshotReader::readPins()
+{
+  uint32_t count = readU32();
+  PinSet *pins = count ? new PinSet(network_) : nullptr;
+  for (uint32_t i = 0; i < count; i++)
+    pins->insert(findPin(readString()));
+  return pins;
+}
+
+ClockSet *
+SdcSnapshotReader::readClks()
+{
+  uint32_t count = readU32();
+  ClockSet *clks = count ? new ClockSet : nullptr;
+  for (uint32_t i = 0; i < count; i++)
+    clks->insert(findClock(readString()));
+  return clks;
+}
+
+InstanceSet *
+SdcSnapshotReader::readInsts()
+{
+  uint32_t count = readU32();
+  InstanceSet *insts = count ? new InstanceSet(network_) : nullptr;
+  for (uint32_t i = 0; i < count; i++)
+    insts->insert(findInstance(readString()));
+  return insts;
+}
+
+NetSet *
+SdcSnapshotReader::readNets()
+{
+  uint32_t count = readU32();
+  NetSet *nets = count ? new NetSet(network_) : nullptr;
+  for (uint32_t i = 0; i < count; i++)
+    nets->insert(findNet(readString()));
+  return nets;
+}
+
+void
+SdcSnapshotReader::readDerates()
+{
+  for (int type_index = 0; type_index < timing_derate_type_count; type_index++) {
+    for (int clk_data_index = 0;
+         clk_data_index < path_clk_or_data_count;
+         clk_data_index++) {
+      for (const RiseFall *rf : RiseFall::range()) {
+        for (const MinMax *early_late : MinMax::range()) {
+          if (readBool())
+            sdc_->setTimingDerate(static_cast<TimingDerateType>(type_index),
+                                  static_cast<PathClkOrData>(clk_data_index),
+                                  rf->asRiseFallBoth(), early_late,
+                                  readFloat());
+        }
+      }
+    }
+  }
+}
+
+Pin *
+SdcSnapshotReader::findPin(const string &name)
+{
+  Pin *pin = network_->findPin(name.c_str());
+  if (pin == nullptr) {
+    report_->warn(2345, "pin %s not found.", name.c_str());
+    throw SdcSnapshotError();
+  }
+  return pin;
+}
+
+Clock *
+SdcSnapshotReader::findClock(const string &name)
+{
+  Clock *clk = sdc_->findClock(name.c_str());
+  if (clk == nullptr) {
+    report_->warn(2346, "clock %s not found.", name.c_str());
+    throw SdcSnapshotError();
+  }
+  return clk;
+}
+
+Instance *
+SdcSnapshotReader::findInstance(const string &name)
+{
+  Instance *inst = network_->findInstance(name.c_str());
+  if (inst == nullptr) {
+    report_->warn(2347, "instance %s not found.", name.c_str());
+    throw SdcSnapshotError();
+  }
+  return inst;
+}
+
+Net *
+SdcSnapshotReader::findNet(const string &name)
+{
+  Net *net = network_->findNet(name.c_str());
+  if (net == nullptr) {
+    report_->warn(2348, "net %s not found.", name.c_str());
+    throw SdcSnapshotError();
+  }
+  return net;
+}
+
+bool
+SdcSnapshotReader::mapFile(const char *filename)
+{
+#ifndef _WIN32
+  fd_ = open(filename, O_RDONLY);
+  if (fd_ < 0)
+    return false;
+  struct stat sbuf;
+  if (fstat(fd_, &sbuf) != 0
+      || sbuf.st_size == 0) {
+    close(fd_);
+    fd_ = -1;
+    return false;
+  }
+  map_length_ = sbuf.st_size;
+  void *map = mmap(nullptr, map_length_, PROT_READ, MAP_PRIVATE, fd_, 0);
+  if (map == MAP_FAILED) {
+    close(fd_);
+    fd_ = -1;
+    return false;
+  }
+  data_ = static_cast<const char*>(map);
+#else
+  std::ifstream in(filename, std::ios::binary | std::ios::ate);
+  if (!in.is_open())
+    return false;
+  map_length_ = in.tellg();
+  in.seekg(0);
+  char *buffer = new char[map_length_];
+  in.read(buffer, map_length_);
+  if (in.fail()) {
+    delete [] buffer;
+    return false;
+  }
+  data_ = buffer;
+#endif
+  cursor_ = data_;
+  end_ = data_ + map_length_;
+  return true;
+}
+
+void
+SdcSnapshotReader::unmapFile()
+{
+#ifndef _WIN32
+  if (data_) {
+    munmap(const_cast<char*>(data_), map_length_);
+    close(fd_);
+    fd_ = -1;
+  }
+#else
+  delete [] data_;
+#endif
+  data_ = cursor_ = end_ = nullptr;
+}
+
+bool
+SdcSnapshotReader::readBool()
+{
+  return readU8() != 0;
+}
+
+uint8_t
+SdcSnapshotReader::readU8()
+{
+  if (cursor_ + sizeof(uint8_t) > end_)
+    throw SdcSnapshotError();
+  uint8_t value;
+  memcpy(&value, cursor_, sizeof(value));
+  cursor_ += sizeof(value);
+  return value;
+}
+
+uint32_t
+SdcSnapshotReader::readU32()
+{
+  if (cursor_ + sizeof(uint32_t) > end_)
+    throw SdcSnapshotError();
+  uint32_t value;
+  memcpy(&value, cursor_, sizeof(value));
+  cursor_ += sizeof(value);
+  return value;
+}
+
+int32_t
+SdcSnapshotReader::readI32()
+{
+  if (cursor_ + sizeof(int32_t) > end_)
+    throw SdcSnapshotError();
+  int32_t value;
+  memcpy(&value, cursor_, sizeof(value));
+  cursor_ += sizeof(value);
+  return value;
+}
+
+uint64_t
+SdcSnapshotReader::readU64()
+{
+  if (cursor_ + sizeof(uint64_t) > end_)
+    throw SdcSnapshotError();
+  uint64_t value;
+  memcpy(&value, cursor_, sizeof(value));
+  cursor_ += sizeof(value);
+  return value;
+}
+
+float
+SdcSnapshotReader::readFloat()
+{
+  if (cursor_ + sizeof(float) > end_)
+    throw SdcSnapshotError();
+  float value;
+  memcpy(&value, cursor_, sizeof(value));
+  cursor_ += sizeof(value);
+  return value;
+}
+
+string
+SdcSnapshotReader::readString()
+{
+  uint32_t length = readU32();
+  if (cursor_ + length > end_)
+    throw SdcSnapshotError();
+  string str(cursor_, length);
+  cursor_ += length;
+  return str;
+}
+
+bool
+readSdcSnapshot(const char *filename,
+                StaState *sta)
+{
+  SdcSnapshotReader reader(filename, sta);
+  return reader.read();
+}
+
+} // namespace
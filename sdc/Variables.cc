@@ -40,7 +40,13 @@ Variables::Variables() :
   dynamic_loop_breaking_(false),
   propagate_all_clks_(false),
   use_default_arrival_clock_(false),
-  pocv_enabled_(false)
+  pocv_enabled_(false),
+  liberty_cache_enabled_(false),
+  liberty_lazy_enabled_(false),
+  spef_cache_enabled_(false),
+  spef_lazy_enabled_(false),
+  path_spill_enabled_(false),
+  thread_affinity_enabled_(false)
 {
 }
 
@@ -127,5 +133,41 @@ Variables::setPocvEnabled(bool enabled)
 {
   pocv_enabled_ = enabled;
 }
+
+void
+Variables::setLibertyCacheEnabled(bool enabled)
+{
+  liberty_cache_enabled_ = enabled;
+}
+
+void
+Variables::setLibertyLazyEnabled(bool enabled)
+{
+  liberty_lazy_enabled_ = enabled;
+}
+
+void
+Variables::setSpefCacheEnabled(bool enabled)
+{
+  spef_cache_enabled_ = enabled;
+}
+
+void
+Variables::setSpefLazyEnabled(bool enabled)
+{
+  spef_lazy_enabled_ = enabled;
+}
+
+void
+Variables::setPathSpillEnabled(bool enabled)
+{
+  path_spill_enabled_ = enabled;
+}
+
+void
+Variables::setThreadAffinityEnabled(bool enabled)
+{
+  thread_affinity_enabled_ = enabled;
+}
   
 } // namespace
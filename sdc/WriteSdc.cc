@@ -27,6 +27,9 @@
 #include <cstdio>
 #include <algorithm>
 #include <ctime>
+#include <fstream>
+#include <string>
+#include <vector>
 
 #include "Zlib.hh"
 #include "Report.hh"
@@ -53,6 +56,7 @@
 #include "DeratingFactors.hh"
 #include "Sdc.hh"
 #include "Fuzzy.hh"
+#include "DispatchQueue.hh"
 #include "StaState.hh"
 #include "Corner.hh"
 #include "Variables.hh"
@@ -325,13 +329,80 @@ void
 WriteSdc::write(const char *filename,
                 bool gzip)
 {
-  openFile(filename, gzip);
-  writeHeader();
-  writeTiming();
-  writeEnvironment();
-  writeDesignRules();
-  writeVariables();
-  closeFile();
+  if (thread_count_ > 1 && dispatch_queue_)
+    writeParallel(filename, gzip);
+  else {
+    openFile(filename, gzip);
+    writeHeader();
+    writeTiming();
+    writeEnvironment();
+    writeDesignRules();
+    writeVariables();
+    closeFile();
+  }
+}
+
+// Format each section concurrently into its own part file and
+// concatenate the parts in section order.  Concatenated gzip members
+// form a valid gzip stream, so this works compressed or transparent.
+void
+WriteSdc::writeParallel(const char *filename,
+                        bool gzip)
+{
+  typedef void (WriteSdc::*SectionWriter)() const;
+  static const SectionWriter section_writers[] =
+    {&WriteSdc::writeHeader,
+     &WriteSdc::writeTiming,
+     &WriteSdc::writeEnvironment,
+     &WriteSdc::writeDesignRules,
+     &WriteSdc::writeVariables};
+  constexpr size_t section_count = sizeof(section_writers)
+    / sizeof(section_writers[0]);
+
+  std::vector<std::string> part_filenames(section_count);
+  // Not vector<bool>; the workers write their flags concurrently.
+  std::vector<uint8_t> part_fails(section_count, 0);
+  for (size_t i = 0; i < section_count; i++) {
+    part_filenames[i] = std::string(filename) + ".part" + std::to_string(i + 1);
+    dispatch_queue_->dispatch([&, i](int) {
+      // Each section formats through its own writer and stream.
+      WriteSdc writer(instance_, creator_, map_hpins_, native_,
+                      digits_, no_timestamp_, sdc_);
+      writer.stream_ = gzopen(part_filenames[i].c_str(), gzip ? "wb" : "wT");
+      if (writer.stream_ == nullptr)
+        part_fails[i] = 1;
+      else {
+        (writer.*section_writers[i])();
+        writer.closeFile();
+      }
+    });
+  }
+  dispatch_queue_->finishTasks();
+
+  bool failed = false;
+  for (uint8_t part_fail : part_fails)
+    failed |= part_fail;
+  std::ofstream out;
+  if (!failed) {
+    out.open(filename, std::ios::binary | std::ios::trunc);
+    failed = !out.is_open();
+  }
+  for (size_t i = 0; i < section_count; i++) {
+    if (!failed) {
+      std::ifstream in(part_filenames[i], std::ios::binary);
+      // Streaming an empty part would set failbit on out.
+      if (in.is_open()
+          && in.peek() != std::ifstream::traits_type::eof())
+        out << in.rdbuf();
+    }
+    std::remove(part_filenames[i].c_str());
+  }
+  if (!failed) {
+    out.close();
+    failed = out.fail();
+  }
+  if (failed)
+    throw FileNotWritable(filename);
 }
 
 void
@@ -46,6 +46,8 @@ public:
   virtual ~WriteSdc();
   void write(const char *filename,
              bool gzip);
+  void writeParallel(const char *filename,
+                     bool gzip);
 
   void openFile(const char *filename,
                 bool gzip);
@@ -63,9 +63,11 @@ read_sdf_file(const char *filename,
   sta->ensureGraph();
   if (stringEq(path, ""))
     path = NULL;
+  // The reader invalidates the search state for changed annotations,
+  // so re-annotating with mostly unchanged delays does not force a
+  // full update.
   bool success = readSdf(filename, path, corner, unescaped_dividers, incremental_only,
                          cond_use, sta);
-  sta->search()->arrivalsInvalid();
   return success;
 }
 
@@ -27,10 +27,12 @@
 #include <cstdarg>
 #include <cctype>
 
-#include "Zlib.hh"
+#include "GzPipeStream.hh"
 #include "Error.hh"
 #include "Debug.hh"
 #include "Stats.hh"
+#include "StringUtil.hh"
+#include "Fuzzy.hh"
 #include "Report.hh"
 #include "MinMax.hh"
 #include "TimingArc.hh"
@@ -40,6 +42,7 @@
 #include "Corner.hh"
 #include "DcalcAnalysisPt.hh"
 #include "Sdc.hh"
+#include "Search.hh"
 #include "sdf/SdfReaderPvt.hh"
 #include "sdf/SdfScanner.hh"
 
@@ -140,7 +143,7 @@ SdfReader::~SdfReader()
 bool
 SdfReader::read()
 {
-  gzstream::igzstream stream(filename_.c_str());
+  GzPipeStream stream(filename_.c_str());
   if (stream.is_open()) {
     Stats stats(debug_, report_);
     SdfScanner scanner(&stream, filename_, this, report_);
@@ -735,14 +738,19 @@ SdfReader::setEdgeArcDelays(Edge *edge,
     float **values = triple->values();
     float *value_ptr = values[triple_index];
     if (value_ptr) {
+      ArcDelay prev_delay = graph_->arcDelay(edge, arc, arc_delay_index);
       ArcDelay delay;
       if (in_incremental_)
-	delay = *value_ptr + graph_->arcDelay(edge, arc, arc_delay_index);
+	delay = *value_ptr + prev_delay;
       else
 	delay = *value_ptr;
+      bool changed = !graph_->arcDelayAnnotated(edge, arc, arc_delay_index)
+	|| !fuzzyEqual(delayAsFloat(delay), delayAsFloat(prev_delay));
       graph_->setArcDelay(edge, arc, arc_delay_index, delay);
       graph_->setArcDelayAnnotated(edge, arc, arc_delay_index, true);
       edge->setDelayAnnotationIsIncremental(is_incremental_only_);
+      if (changed)
+	annotationChanged(edge);
     }
   }
 }
@@ -784,17 +792,36 @@ SdfReader::setEdgeArcDelaysCondUse(Edge *edge,
 {
   if (value
       && triple_index != null_index_) {
+    ArcDelay prev_delay = graph_->arcDelay(edge, arc, arc_delay_index);
+    bool annotated = graph_->arcDelayAnnotated(edge, arc, arc_delay_index);
     ArcDelay delay(*value);
     if (!is_incremental_only_ && in_incremental_)
-      delay = graph_->arcDelay(edge, arc, arc_delay_index) + *value;
-    else if (graph_->arcDelayAnnotated(edge, arc, arc_delay_index)) {
-      ArcDelay prev_value = graph_->arcDelay(edge, arc, arc_delay_index);
-      if (delayGreater(prev_value, delay, min_max, this))
-	delay = prev_value;
+      delay = prev_delay + *value;
+    else if (annotated) {
+      if (delayGreater(prev_delay, delay, min_max, this))
+	delay = prev_delay;
     }
+    bool changed = !annotated
+      || !fuzzyEqual(delayAsFloat(delay), delayAsFloat(prev_delay));
     graph_->setArcDelay(edge, arc, arc_delay_index, delay);
     graph_->setArcDelayAnnotated(edge, arc, arc_delay_index, true);
     edge->setDelayAnnotationIsIncremental(is_incremental_only_);
+    if (changed)
+      annotationChanged(edge);
+  }
+}
+
+// Invalidate only the search state affected by a changed annotation
+// so re-annotating a design with mostly unchanged delays preserves
+// the arrivals and requireds elsewhere.
+void
+SdfReader::annotationChanged(Edge *edge)
+{
+  if (edge->role()->isTimingCheck())
+    search_->requiredInvalid(edge->to(graph_));
+  else {
+    search_->arrivalInvalid(edge->to(graph_));
+    search_->requiredInvalid(edge->from(graph_));
   }
 }
 
@@ -1012,15 +1039,31 @@ SdfReader::sdfError(int id,
 Pin *
 SdfReader::findPin(const string *name)
 {
+  string path_name;
   if (path_) {
-    string path_name(path_);
+    path_name = path_;
     path_name += divider_;
     path_name += *name;
-    Pin *pin = network_->findPin(path_name.c_str());
+  }
+  else
+    path_name = *name;
+  char *inst_path, *port_name;
+  network_->pathNameLast(path_name.c_str(), inst_path, port_name);
+  if (inst_path) {
+    Pin *pin = nullptr;
+    Instance *inst = findInstanceCached(inst_path);
+    if (inst)
+      pin = network_->findPin(inst, port_name);
+    stringDelete(inst_path);
+    stringDelete(port_name);
+    if (pin == nullptr)
+      // Unescaped dividers make the name split ambiguous, so retry
+      // with the network's full name resolution.
+      pin = network_->findPin(path_name.c_str());
     return pin;
   }
   else
-    return network_->findPin(name->c_str());
+    return network_->findPin(path_name.c_str());
 }
 
 Instance *
@@ -1034,12 +1077,43 @@ SdfReader::findInstance(const string *name)
   }
   else
     inst_name = *name;
-  Instance *inst = network_->findInstance(inst_name.c_str());
+  Instance *inst = findInstanceCached(inst_name.c_str());
+  if (inst == nullptr)
+    // Unescaped dividers make the name split ambiguous, so retry
+    // with the network's full name resolution.
+    inst = network_->findInstance(inst_name.c_str());
   if (inst == nullptr)
     sdfWarn(195, "instance %s not found.", inst_name.c_str());
   return inst;
 }
 
+// Resolve a hierarchical instance path with a cache of previously
+// resolved paths.  Each path prefix is resolved with one map probe
+// and one child lookup instead of walking the hierarchy from the top
+// component by component for every name.
+Instance *
+SdfReader::findInstanceCached(const char *path_name)
+{
+  string path(path_name);
+  Instance *inst = inst_path_map_.findKey(path);
+  if (inst == nullptr) {
+    char *parent_path, *leaf;
+    network_->pathNameLast(path_name, parent_path, leaf);
+    if (parent_path) {
+      Instance *parent = findInstanceCached(parent_path);
+      if (parent)
+	inst = network_->findChild(parent, leaf);
+      stringDelete(parent_path);
+      stringDelete(leaf);
+    }
+    else
+      inst = network_->findChild(network_->topInstance(), path_name);
+    if (inst)
+      inst_path_map_[path] = inst;
+  }
+  return inst;
+}
+
 ////////////////////////////////////////////////////////////////
 
 SdfPortSpec::SdfPortSpec(const Transition *tr,
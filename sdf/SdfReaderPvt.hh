@@ -24,6 +24,7 @@
 
 #pragma once
 
+#include "Map.hh"
 #include "Vector.hh"
 #include "TimingRole.hh"
 #include "Transition.hh"
@@ -182,9 +183,11 @@ private:
 			  bool match_generic);
   Pin *findPin(const std::string *name);
   Instance *findInstance(const std::string *name);
+  Instance *findInstanceCached(const char *path_name);
   void setEdgeDelays(Edge *edge,
 		     SdfTripleSeq *triples,
 		     const char *sdf_cmd);
+  void annotationChanged(Edge *edge);
   void setDevicePinDelays(Pin *to_pin,
 			  SdfTripleSeq *triples);
   Port *findPort(const Cell *cell,
@@ -211,6 +214,11 @@ private:
   bool in_timing_check_;
   bool in_incremental_;
   float timescale_;
+  // Hierarchical instance paths resolved so far.  Pin and instance
+  // names in large sdf files share hierarchical prefixes, so each
+  // prefix is resolved once instead of walking the hierarchy from the
+  // top for every name.
+  Map<std::string, Instance*> inst_path_map_;
 
   static const int null_index_ = -1;
 };
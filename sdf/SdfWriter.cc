@@ -1,31 +1,33 @@
 // OpenSTA, Static Timing Analyzer
 // Copyright (c) 2025, Parallax Software, Inc.
-// 
+//
 // This program is free software: you can redistribute it and/or modify
 // it under the terms of the GNU General Public License as published by
 // the Free Software Foundation, either version 3 of the License, or
 // (at your option) any later version.
-// 
+//
 // This program is distributed in the hope that it will be useful,
 // but WITHOUT ANY WARRANTY; without even the implied warranty of
 // MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
 // GNU General Public License for more details.
-// 
+//
 // You should have received a copy of the GNU General Public License
 // along with this program. If not, see <https://www.gnu.org/licenses/>.
-// 
+//
 // The origin of this software must not be misrepresented; you must not
 // claim that you wrote the original software.
-// 
+//
 // Altered source versions must be plainly marked as such, and must not be
 // misrepresented as being the original software.
-// 
+//
 // This notice may not be removed or altered from any source distribution.
 
 #include "sdf/SdfWriter.hh"
 
 #include <cstdio>
 #include <ctime>
+#include <algorithm>
+#include <vector>
 
 #include "Zlib.hh"
 #include "StaConfig.hh"  // STA_VERSION
@@ -40,6 +42,7 @@
 #include "Network.hh"
 #include "Graph.hh"
 #include "DcalcAnalysisPt.hh"
+#include "DispatchQueue.hh"
 #include "GraphDelayCalc.hh"
 #include "StaState.hh"
 #include "Corner.hh"
@@ -53,7 +56,6 @@ class SdfWriter : public StaState
 {
 public:
   SdfWriter(StaState *sta);
-  ~SdfWriter();
   void write(const char *filename,
 	     const Corner *corner,
 	     char sdf_divider,
@@ -64,15 +66,20 @@ public:
 	     bool no_version);
 
 protected:
+  typedef void (SdfWriter::*InstWriter)(const Instance *inst);
+
   void writeHeader(LibertyLibrary *default_lib,
 		   bool no_timestamp,
 		   bool no_version);
   void writeTrailer();
   void writeInterconnects();
-  void writeInstInterconnects(Instance *inst);
+  void writeInstInterconnects(const Instance *inst);
   void writeInterconnectFromPin(Pin *drvr_pin);
 
   void writeInstances();
+  void writeInstance(const Instance *inst);
+  void writeInstChunks(const InstanceSeq &insts,
+		       InstWriter inst_writer);
   void writeInstHeader(const Instance *inst);
   void writeInstTrailer();
   void writeIopaths(const Instance *inst,
@@ -110,6 +117,8 @@ protected:
   void writeSdfTriple(float min,
                       float max);
   void writeSdfDelay(double delay);
+  void flush();
+  void writeString(const string &text);
   string sdfPortName(const Pin *pin);
   string sdfPathName(const Pin *pin);
   string sdfPathName(const Instance *inst);
@@ -122,8 +131,12 @@ private:
 
   char sdf_escape_;
   char network_escape_;
-  char *delay_format_;
+  string delay_format_;
 
+  // Formatted sdf text pending a flush to the stream.  Worker thread
+  // writers format into their own buffers which are stitched to the
+  // stream in instance order.
+  string out_;
   gzFile stream_;
   const Corner *corner_;
   int arc_delay_min_index_;
@@ -149,14 +162,8 @@ writeSdf(const char *filename,
 SdfWriter::SdfWriter(StaState *sta) :
   StaState(sta),
   sdf_escape_('\\'),
-  network_escape_(network_->pathEscape()),
-  delay_format_(nullptr)
-{
-}
-
-SdfWriter::~SdfWriter()
+  network_escape_(network_->pathEscape())
 {
-  stringDelete(delay_format_);
 }
 
 void
@@ -171,8 +178,7 @@ SdfWriter::write(const char *filename,
 {
   sdf_divider_ = sdf_divider;
   include_typ_ = include_typ;
-  if (delay_format_ == nullptr)
-    delay_format_ = stringPrint("%%.%df", digits);
+  delay_format_ = stdstrPrint("%%.%df", digits);
 
   LibertyLibrary *default_lib = network_->defaultLibertyLibrary();
   timescale_ = default_lib->units()->timeUnit()->scale();
@@ -193,39 +199,62 @@ SdfWriter::write(const char *filename,
   if (stream_ == nullptr)
     throw FileNotWritable(filename);
 
+  out_.clear();
   writeHeader(default_lib, no_timestamp, no_version);
   writeInterconnects();
   writeInstances();
   writeTrailer();
+  flush();
 
   gzclose(stream_);
   stream_ = nullptr;
 }
 
+void
+SdfWriter::flush()
+{
+  writeString(out_);
+  out_.clear();
+}
+
+void
+SdfWriter::writeString(const string &text)
+{
+  const char *data = text.data();
+  size_t length = text.size();
+  while (length > 0) {
+    // gzwrite length is unsigned.
+    size_t count = std::min(length, static_cast<size_t>(1) << 30);
+    gzwrite(stream_, data, static_cast<unsigned>(count));
+    data += count;
+    length -= count;
+  }
+}
+
 void
 SdfWriter::writeHeader(LibertyLibrary *default_lib,
 		       bool no_timestamp,
 		       bool no_version)
 {
-  gzprintf(stream_, "(DELAYFILE\n");
-  gzprintf(stream_, " (SDFVERSION \"3.0\")\n");
-  gzprintf(stream_, " (DESIGN \"%s\")\n", 
-	   network_->cellName(network_->topInstance()));
-  
+  stringAppend(out_, "(DELAYFILE\n");
+  stringAppend(out_, " (SDFVERSION \"3.0\")\n");
+  stringAppend(out_, " (DESIGN \"%s\")\n",
+	       network_->cellName(network_->topInstance()));
+
   if (!no_timestamp) {
     time_t now;
     time(&now);
     char *time_str = ctime(&now);
     // Remove trailing \n.
     time_str[strlen(time_str) - 1] = '\0';
-    gzprintf(stream_, " (DATE \"%s\")\n", time_str);
+    stringAppend(out_, " (DATE \"%s\")\n", time_str);
   }
 
-  gzprintf(stream_, " (VENDOR \"Parallax\")\n");
-  gzprintf(stream_, " (PROGRAM \"STA\")\n");
+  stringAppend(out_, " (VENDOR \"Parallax\")\n");
+  stringAppend(out_, " (PROGRAM \"STA\")\n");
   if (!no_version)
-    gzprintf(stream_, " (VERSION \"%s\")\n", STA_VERSION);
-  gzprintf(stream_, " (DIVIDER %c)\n", sdf_divider_);
+    stringAppend(out_, " (VERSION \"%s\")\n", STA_VERSION);
+  stringAppend(out_, " (DIVIDER %c)\n", sdf_divider_);
 
   LibertyLibrary *lib_min = default_lib;
   const LibertySeq &libs_min = corner_->libertyLibraries(MinMax::min());
@@ -239,15 +268,15 @@ SdfWriter::writeHeader(LibertyLibrary *default_lib,
   OperatingConditions *cond_min = lib_min->defaultOperatingConditions();
   OperatingConditions *cond_max = lib_max->defaultOperatingConditions();
   if (cond_min && cond_max) {
-    gzprintf(stream_, " (VOLTAGE %.3f::%.3f)\n",
-             cond_min->voltage(),
-             cond_max->voltage());
-    gzprintf(stream_, " (PROCESS \"%.3f::%.3f\")\n",
-             cond_min->process(),
-             cond_max->process());
-    gzprintf(stream_, " (TEMPERATURE %.3f::%.3f)\n",
-             cond_min->temperature(),
-             cond_max->temperature());
+    stringAppend(out_, " (VOLTAGE %.3f::%.3f)\n",
+                 cond_min->voltage(),
+                 cond_max->voltage());
+    stringAppend(out_, " (PROCESS \"%.3f::%.3f\")\n",
+                 cond_min->process(),
+                 cond_max->process());
+    stringAppend(out_, " (TEMPERATURE %.3f::%.3f)\n",
+                 cond_min->temperature(),
+                 cond_max->temperature());
   }
 
   const char *sdf_timescale = nullptr;
@@ -270,41 +299,40 @@ SdfWriter::writeHeader(LibertyLibrary *default_lib,
   else if (fuzzyEqual(timescale_, 100e-12))
     sdf_timescale = "100ps";
   if (sdf_timescale)
-    gzprintf(stream_, " (TIMESCALE %s)\n", sdf_timescale);
+    stringAppend(out_, " (TIMESCALE %s)\n", sdf_timescale);
 }
 
 void
 SdfWriter::writeTrailer()
 {
-  gzprintf(stream_, ")\n");
+  stringAppend(out_, ")\n");
 }
 
 void
 SdfWriter::writeInterconnects()
 {
-  gzprintf(stream_, " (CELL\n");
-  gzprintf(stream_, "  (CELLTYPE \"%s\")\n",
-	   network_->cellName(network_->topInstance()));
-  gzprintf(stream_, "  (INSTANCE)\n");
-  gzprintf(stream_, "  (DELAY\n");
-  gzprintf(stream_, "   (ABSOLUTE\n");
-
-  writeInstInterconnects(network_->topInstance());
+  stringAppend(out_, " (CELL\n");
+  stringAppend(out_, "  (CELLTYPE \"%s\")\n",
+	       network_->cellName(network_->topInstance()));
+  stringAppend(out_, "  (INSTANCE)\n");
+  stringAppend(out_, "  (DELAY\n");
+  stringAppend(out_, "   (ABSOLUTE\n");
 
+  InstanceSeq insts;
+  insts.push_back(network_->topInstance());
   LeafInstanceIterator *inst_iter = network_->leafInstanceIterator();
-  while (inst_iter->hasNext()) {
-    Instance *inst = inst_iter->next();
-    writeInstInterconnects(inst);
-  }
+  while (inst_iter->hasNext())
+    insts.push_back(inst_iter->next());
   delete inst_iter;
+  writeInstChunks(insts, &SdfWriter::writeInstInterconnects);
 
-  gzprintf(stream_, "   )\n");
-  gzprintf(stream_, "  )\n");
-  gzprintf(stream_, " )\n");
+  stringAppend(out_, "   )\n");
+  stringAppend(out_, "  )\n");
+  stringAppend(out_, " )\n");
 }
 
 void
-SdfWriter::writeInstInterconnects(Instance *inst)
+SdfWriter::writeInstInterconnects(const Instance *inst)
 {
   InstancePinIterator *pin_iter = network_->pinIterator(inst);
   while (pin_iter->hasNext()) {
@@ -327,11 +355,11 @@ SdfWriter::writeInterconnectFromPin(Pin *drvr_pin)
         Pin *load_pin = edge->to(graph_)->pin();
         string drvr_pin_name = sdfPathName(drvr_pin);
         string load_pin_name = sdfPathName(load_pin);
-        gzprintf(stream_, "    (INTERCONNECT %s %s ",
-                 drvr_pin_name.c_str(),
-                 load_pin_name.c_str());
+        stringAppend(out_, "    (INTERCONNECT %s %s ",
+                     drvr_pin_name.c_str(),
+                     load_pin_name.c_str());
         writeArcDelays(edge);
-        gzprintf(stream_, ")\n");
+        stringAppend(out_, ")\n");
       }
     }
   }
@@ -340,31 +368,77 @@ SdfWriter::writeInterconnectFromPin(Pin *drvr_pin)
 void
 SdfWriter::writeInstances()
 {
+  InstanceSeq insts;
   LeafInstanceIterator *leaf_iter = network_->leafInstanceIterator();
-  while (leaf_iter->hasNext()) {
-    const Instance *inst = leaf_iter->next();
-    bool inst_header = false;
-    writeIopaths(inst, inst_header);
-    writeTimingChecks(inst, inst_header);
-    if (inst_header)
-      writeInstTrailer();
-  }
+  while (leaf_iter->hasNext())
+    insts.push_back(leaf_iter->next());
   delete leaf_iter;
+  writeInstChunks(insts, &SdfWriter::writeInstance);
+}
+
+void
+SdfWriter::writeInstance(const Instance *inst)
+{
+  bool inst_header = false;
+  writeIopaths(inst, inst_header);
+  writeTimingChecks(inst, inst_header);
+  if (inst_header)
+    writeInstTrailer();
+}
+
+// Format the sdf for the instances into per-thread buffers on the
+// thread pool and stitch the chunks to the stream in instance order.
+void
+SdfWriter::writeInstChunks(const InstanceSeq &insts,
+			   InstWriter inst_writer)
+{
+  size_t inst_count = insts.size();
+  size_t thread_count = threadCount();
+  if (thread_count <= 1
+      || dispatchQueue() == nullptr
+      || inst_count < thread_count) {
+    for (const Instance *inst : insts)
+      (this->*inst_writer)(inst);
+  }
+  else {
+    // Write the pending text so the chunks follow it on the stream.
+    flush();
+    std::vector<SdfWriter*> writers(thread_count);
+    for (size_t k = 0; k < thread_count; k++)
+      writers[k] = new SdfWriter(*this);
+    size_t chunk_size = inst_count / thread_count + 1;
+    size_t from = 0;
+    for (size_t k = 0; k < thread_count && from < inst_count; k++) {
+      size_t to = std::min(from + chunk_size, inst_count);
+      dispatch_queue_->dispatch([&insts, &writers, inst_writer, k, from, to](int) {
+	for (size_t i = from; i < to; i++)
+	  (writers[k]->*inst_writer)(insts[i]);
+      });
+      from = to;
+    }
+    dispatch_queue_->finishTasks();
+    // The chunks are contiguous, so writing the buffers in thread
+    // order preserves the instance order.
+    for (size_t k = 0; k < thread_count; k++) {
+      writeString(writers[k]->out_);
+      delete writers[k];
+    }
+  }
 }
 
 void
 SdfWriter::writeInstHeader(const Instance *inst)
 {
-  gzprintf(stream_, " (CELL\n");
-  gzprintf(stream_, "  (CELLTYPE \"%s\")\n", network_->cellName(inst));
+  stringAppend(out_, " (CELL\n");
+  stringAppend(out_, "  (CELLTYPE \"%s\")\n", network_->cellName(inst));
   string inst_name = sdfPathName(inst);
-  gzprintf(stream_, "  (INSTANCE %s)\n", inst_name.c_str());
+  stringAppend(out_, "  (INSTANCE %s)\n", inst_name.c_str());
 }
 
 void
 SdfWriter::writeInstTrailer()
 {
-  gzprintf(stream_, " )\n");
+  stringAppend(out_, " )\n");
 }
 
 void
@@ -376,7 +450,7 @@ SdfWriter::writeIopaths(const Instance *inst,
   while (pin_iter->hasNext()) {
     Pin *from_pin = pin_iter->next();
     if (network_->isLoad(from_pin)) {
-      Vertex *from_vertex = graph_->pinLoadVertex(from_pin);      
+      Vertex *from_vertex = graph_->pinLoadVertex(from_pin);
       VertexOutEdgeIterator edge_iter(from_vertex, graph_);
       while (edge_iter.hasNext()) {
 	Edge *edge = edge_iter.next();
@@ -399,18 +473,18 @@ SdfWriter::writeIopaths(const Instance *inst,
 	  }
 	  const char *sdf_cond = edge->timingArcSet()->sdfCond();
 	  if (sdf_cond) {
-	    gzprintf(stream_, "    (COND %s\n", sdf_cond);
-	    gzprintf(stream_, " ");
+	    stringAppend(out_, "    (COND %s\n", sdf_cond);
+	    stringAppend(out_, " ");
 	  }
 	  string from_pin_name = sdfPortName(from_pin);
 	  string to_pin_name = sdfPortName(to_pin);
-          gzprintf(stream_, "    (IOPATH %s %s ",
-		   from_pin_name.c_str(),
-		   to_pin_name.c_str());
+          stringAppend(out_, "    (IOPATH %s %s ",
+		       from_pin_name.c_str(),
+		       to_pin_name.c_str());
 	  writeArcDelays(edge);
 	  if (sdf_cond)
-	    gzprintf(stream_, ")");
-	  gzprintf(stream_, ")\n");
+	    stringAppend(out_, ")");
+	  stringAppend(out_, ")\n");
 	}
       }
     }
@@ -424,15 +498,15 @@ SdfWriter::writeIopaths(const Instance *inst,
 void
 SdfWriter::writeIopathHeader()
 {
-  gzprintf(stream_, "  (DELAY\n");
-  gzprintf(stream_, "   (ABSOLUTE\n");
+  stringAppend(out_, "  (DELAY\n");
+  stringAppend(out_, "   (ABSOLUTE\n");
 }
 
 void
 SdfWriter::writeIopathTrailer()
 {
-  gzprintf(stream_, "   )\n");
-  gzprintf(stream_, "  )\n");
+  stringAppend(out_, "   )\n");
+  stringAppend(out_, "  )\n");
 }
 
 void
@@ -458,7 +532,7 @@ SdfWriter::writeArcDelays(Edge *edge)
 		     delays.value(RiseFall::fall(), MinMax::min()))
 	  && fuzzyEqual(delays.value(RiseFall::rise(), MinMax::max()),
 			delays.value(RiseFall::fall(),MinMax::max())))) {
-      gzprintf(stream_, " ");
+      stringAppend(out_, " ");
       writeSdfTriple(delays, RiseFall::fall());
     }
   }
@@ -467,7 +541,7 @@ SdfWriter::writeArcDelays(Edge *edge)
     writeSdfTriple(delays, RiseFall::rise());
   else if (delays.hasValue(RiseFall::fall(), MinMax::min())) {
     // Fall only.
-    gzprintf(stream_, "() ");
+    stringAppend(out_, "() ");
     writeSdfTriple(delays, RiseFall::fall());
   }
 }
@@ -485,23 +559,23 @@ void
 SdfWriter::writeSdfTriple(float min,
                           float max)
 {
-  gzprintf(stream_, "(");
+  stringAppend(out_, "(");
   writeSdfDelay(min);
   if (include_typ_) {
-    gzprintf(stream_, ":");
+    stringAppend(out_, ":");
     writeSdfDelay((min + max) / 2.0);
-    gzprintf(stream_, ":");
+    stringAppend(out_, ":");
   }
   else
-    gzprintf(stream_, "::");
+    stringAppend(out_, "::");
   writeSdfDelay(max);
-  gzprintf(stream_, ")");
+  stringAppend(out_, ")");
 }
 
 void
 SdfWriter::writeSdfDelay(double delay)
 {
-  gzprintf(stream_, delay_format_, delay / timescale_);
+  stringAppend(out_, delay_format_.c_str(), delay / timescale_);
 }
 
 void
@@ -578,13 +652,13 @@ SdfWriter::ensureTimingCheckheaders(bool &check_header,
 void
 SdfWriter::writeTimingCheckHeader()
 {
-  gzprintf(stream_, "  (TIMINGCHECK\n");
+  stringAppend(out_, "  (TIMINGCHECK\n");
 }
 
 void
 SdfWriter::writeTimingCheckTrailer()
 {
-  gzprintf(stream_, "  )\n");
+  stringAppend(out_, "  )\n");
 }
 
 void
@@ -593,7 +667,7 @@ SdfWriter::writeCheck(Edge *edge,
 {
   TimingArcSet *arc_set = edge->timingArcSet();
   // Examine the arcs to see if the check requires clk or data edge specifiers.
-  TimingArc *arcs[RiseFall::index_count][RiseFall::index_count] = 
+  TimingArc *arcs[RiseFall::index_count][RiseFall::index_count] =
     {{nullptr, nullptr}, {nullptr, nullptr}};
   for (TimingArc *arc : arc_set->arcs()) {
     const RiseFall *clk_rf = arc->fromEdge()->asRiseFall();
@@ -628,7 +702,7 @@ SdfWriter::writeEdgeCheck(Edge *edge,
       && arcs[clk_rf_index][RiseFall::fallIndex()]
       && arcs[clk_rf_index][RiseFall::riseIndex()]
       && arcs[clk_rf_index][RiseFall::fallIndex()]
-      && delayEqual(graph_->arcDelay(edge, 
+      && delayEqual(graph_->arcDelay(edge,
 				     arcs[clk_rf_index][RiseFall::riseIndex()],
 				     arc_delay_min_index_),
 		    graph_->arcDelay(edge,
@@ -645,7 +719,7 @@ SdfWriter::writeEdgeCheck(Edge *edge,
 	       sdf_check, false, true);
   else {
     if (arcs[clk_rf_index][RiseFall::riseIndex()])
-      writeCheck(edge, arcs[clk_rf_index][RiseFall::riseIndex()], 
+      writeCheck(edge, arcs[clk_rf_index][RiseFall::riseIndex()],
 		 sdf_check, true, true);
     if (arcs[clk_rf_index][RiseFall::fallIndex()])
       writeCheck(edge, arcs[clk_rf_index][RiseFall::fallIndex()],
@@ -666,46 +740,46 @@ SdfWriter::writeCheck(Edge *edge,
   const char *sdf_cond_start = arc_set->sdfCondStart();
   const char *sdf_cond_end = arc_set->sdfCondEnd();
 
-  gzprintf(stream_, "    (%s ", sdf_check);
+  stringAppend(out_, "    (%s ", sdf_check);
 
   if (sdf_cond_start)
-    gzprintf(stream_, "(COND %s ", sdf_cond_start);
+    stringAppend(out_, "(COND %s ", sdf_cond_start);
 
   string to_pin_name = sdfPortName(to_pin);
   if (use_data_edge) {
-    gzprintf(stream_, "(%s %s)",
-	     sdfEdge(arc->toEdge()),
-	     to_pin_name.c_str());
+    stringAppend(out_, "(%s %s)",
+		 sdfEdge(arc->toEdge()),
+		 to_pin_name.c_str());
   }
   else
-    gzprintf(stream_, "%s", to_pin_name.c_str());
+    stringAppend(out_, "%s", to_pin_name.c_str());
 
   if (sdf_cond_start)
-    gzprintf(stream_, ")");
+    stringAppend(out_, ")");
 
-  gzprintf(stream_, " ");
+  stringAppend(out_, " ");
 
   if (sdf_cond_end)
-    gzprintf(stream_, "(COND %s ", sdf_cond_end);
+    stringAppend(out_, "(COND %s ", sdf_cond_end);
 
   string from_pin_name = sdfPortName(from_pin);
   if (use_clk_edge)
-    gzprintf(stream_, "(%s %s)",
-	     sdfEdge(arc->fromEdge()),
-	     from_pin_name.c_str());
+    stringAppend(out_, "(%s %s)",
+		 sdfEdge(arc->fromEdge()),
+		 from_pin_name.c_str());
   else
-    gzprintf(stream_, "%s", from_pin_name.c_str());
+    stringAppend(out_, "%s", from_pin_name.c_str());
 
   if (sdf_cond_end)
-    gzprintf(stream_, ")");
+    stringAppend(out_, ")");
 
-  gzprintf(stream_, " ");
+  stringAppend(out_, " ");
 
   ArcDelay min_delay = graph_->arcDelay(edge, arc, arc_delay_min_index_);
   ArcDelay max_delay = graph_->arcDelay(edge, arc, arc_delay_max_index_);
   writeSdfTriple(delayAsFloat(min_delay), delayAsFloat(max_delay));
 
-  gzprintf(stream_, ")\n");
+  stringAppend(out_, ")\n");
 }
 
 void
@@ -715,11 +789,11 @@ SdfWriter::writeWidthCheck(const Pin *pin,
 			   float max_width)
 {
   string pin_name = sdfPortName(pin);
-  gzprintf(stream_, "    (WIDTH (%s %s) ",
-	   sdfEdge(hi_low->asTransition()),
-	   pin_name.c_str());
+  stringAppend(out_, "    (WIDTH (%s %s) ",
+	       sdfEdge(hi_low->asTransition()),
+	       pin_name.c_str());
   writeSdfTriple(min_width, max_width);
-  gzprintf(stream_, ")\n");
+  stringAppend(out_, ")\n");
 }
 
 void
@@ -727,9 +801,9 @@ SdfWriter::writePeriodCheck(const Pin *pin,
 			    float min_period)
 {
   string pin_name = sdfPortName(pin);
-  gzprintf(stream_, "    (PERIOD %s ", pin_name.c_str());
+  stringAppend(out_, "    (PERIOD %s ", pin_name.c_str());
   writeSdfTriple(min_period, min_period);
-  gzprintf(stream_, ")\n");
+  stringAppend(out_, ")\n");
 }
 
 const char *
@@ -42,8 +42,30 @@ Bdd::~Bdd()
   Cudd_Quit(cudd_mgr_);
 }
 
+// Memoized by expression; liberty functions are evaluated once per
+// instance of their cell, so repeats hit the memo instead of
+// rebuilding through the cudd unique table.  Callers own the returned
+// reference.
 DdNode *
 Bdd::funcBdd(const FuncExpr *expr)
+{
+  auto cached = bdd_func_map_.find(expr);
+  if (cached != bdd_func_map_.end()) {
+    DdNode *result = cached->second;
+    Cudd_Ref(result);
+    return result;
+  }
+  DdNode *result = funcBdd1(expr);
+  if (result) {
+    // The memo holds its own reference.
+    Cudd_Ref(result);
+    bdd_func_map_[expr] = result;
+  }
+  return result;
+}
+
+DdNode *
+Bdd::funcBdd1(const FuncExpr *expr)
 {
   DdNode *left = nullptr;
   DdNode *right = nullptr;
@@ -157,6 +179,9 @@ Bdd::varIndexPort(int var_index)
 void
 Bdd::clearVarMap()
 {
+  for (const auto [expr, node] : bdd_func_map_)
+    Cudd_RecursiveDeref(cudd_mgr_, node);
+  bdd_func_map_.clear();
   bdd_port_var_map_.clear();
   bdd_var_idx_port_map_.clear();
 }
@@ -24,6 +24,11 @@
 
 #include "Bfs.hh"
 
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <thread>
+
 #include "Report.hh"
 #include "Debug.hh"
 #include "Mutex.hh"
@@ -36,6 +41,13 @@
 
 namespace sta {
 
+// Target work block count per thread and level for visitParallel.
+static constexpr size_t block_per_thread_count = 16;
+// Vertices handed to VertexVisitor::visitVertices in one call.
+static constexpr size_t visit_batch_size = 64;
+// Most levels visitLevelsParallel batches into one dispatch.
+static constexpr size_t batch_level_count_max = 64;
+
 BfsIterator::BfsIterator(BfsIndex bfs_index,
 			 Level level_min,
 			 Level level_max,
@@ -45,7 +57,10 @@ BfsIterator::BfsIterator(BfsIndex bfs_index,
   bfs_index_(bfs_index),
   level_min_(level_min),
   level_max_(level_max),
-  search_pred_(search_pred)
+  search_pred_(search_pred),
+  visit_level_(0),
+  visit_count_(0),
+  visit_cancel_(false)
 {
   init();
 }
@@ -139,30 +154,62 @@ BfsIterator::enqueueAdjacentVertices(Vertex *vertex,
   enqueueAdjacentVertices(vertex, search_pred_, to_level);
 }
 
+// Sort a level's pending vertices into vertex table order so the
+// visit sweeps the vertex table pages sequentially instead of in
+// enqueue order.  Arrival propagation is memory latency bound, so the
+// sort pays for itself in cache hits.  back_first visits pop from the
+// back of the queue, so sort those descending.
+void
+BfsIterator::sortLevelQueue(VertexSeq &level_vertices,
+			    bool back_first) const
+{
+  std::sort(level_vertices.begin(), level_vertices.end(),
+	    [this, back_first](const Vertex *vertex1, const Vertex *vertex2) {
+	      // Null entries from deleted vertices sort as max id.
+	      VertexId id1 = vertex1 ? graph_->id(vertex1)
+		: std::numeric_limits<VertexId>::max();
+	      VertexId id2 = vertex2 ? graph_->id(vertex2)
+		: std::numeric_limits<VertexId>::max();
+	      return back_first ? id1 > id2 : id1 < id2;
+	    });
+}
+
 int
 BfsIterator::visit(Level to_level,
 		   VertexVisitor *visitor)
 {
   int visit_count = 0;
-  while (levelLessOrEqual(first_level_, last_level_)
+  visit_count_ = 0;
+  VertexSeq batch;
+  batch.reserve(visit_batch_size);
+  while (!visit_cancel_
+	 && levelLessOrEqual(first_level_, last_level_)
 	 && levelLessOrEqual(first_level_, to_level)) {
     Level level = first_level_;
+    visit_level_ = level;
     VertexSeq &level_vertices = queue_[level];
     incrLevel(first_level_);
+    sortLevelQueue(level_vertices, true);
     // Note that ArrivalVisitor::enqueueRefPinInputDelays may enqueue
     // vertices at this level so range iteration fails if the vector grows.
     while (!level_vertices.empty()) {
-      Vertex *vertex = level_vertices.back();
-      level_vertices.pop_back();
-      if (vertex) {
-        checkLevel(vertex, level);
-        vertex->setBfsInQueue(bfs_index_, false);
-        visitor->visit(vertex);
-        visit_count++;
+      batch.clear();
+      while (!level_vertices.empty()
+             && batch.size() < visit_batch_size) {
+        Vertex *vertex = level_vertices.back();
+        level_vertices.pop_back();
+        if (vertex) {
+          checkLevel(vertex, level);
+          vertex->setBfsInQueue(bfs_index_, false);
+          batch.push_back(vertex);
+        }
       }
+      visitor->visitVertices(batch.data(), batch.size());
+      visit_count += batch.size();
     }
     level_vertices.clear();
     visitor->levelFinished();
+    visit_count_ = visit_count;
   }
   return visit_count;
 }
@@ -180,46 +227,82 @@ BfsIterator::visitParallel(Level to_level,
       std::vector<VertexVisitor*> visitors;
       for (int k = 0; k < thread_count_; k++)
 	visitors.push_back(visitor->copy());
-      while (levelLessOrEqual(first_level_, last_level_)
+      visit_count_ = 0;
+      while (!visit_cancel_
+	     && levelLessOrEqual(first_level_, last_level_)
 	     && levelLessOrEqual(first_level_, to_level)) {
 	VertexSeq &level_vertices = queue_[first_level_];
         Level level = first_level_;
+        visit_level_ = level;
 	incrLevel(first_level_);
 	if (!level_vertices.empty()) {
           size_t vertex_count = level_vertices.size();
+          size_t small_level_max = thread_count * block_per_thread_count;
           if (vertex_count < thread_count) {
+            VertexSeq batch;
+            batch.reserve(vertex_count);
             for (Vertex *vertex : level_vertices) {
               if (vertex) {
                 checkLevel(vertex, level);
                 vertex->setBfsInQueue(bfs_index_, false);
-                visitor->visit(vertex);
+                batch.push_back(vertex);
               }
             }
+            visitor->visitVertices(batch.data(), batch.size());
+            visitor->levelFinished();
+            level_vertices.clear();
+            visit_count += vertex_count;
+            visit_count_ = visit_count;
+          }
+          else if (vertex_count < small_level_max
+                   && levelLessOrEqual(first_level_, last_level_)
+                   && levelLessOrEqual(first_level_, to_level)
+                   && queue_[first_level_].size() < small_level_max) {
+            // A run of small levels is batched into one dispatch;
+            // joining the thread pool once per level costs more than
+            // visiting a sparse level.
+            visit_count += visitLevelsParallel(level, to_level, visitors,
+                                               visitor);
+            visit_count_ = visit_count;
           }
           else {
-            size_t from = 0;
-            size_t chunk_size = vertex_count / thread_count;
+            sortLevelQueue(level_vertices, false);
+            // Threads grab small blocks from a shared index rather
+            // than fixed chunks so a few high fanout vertices do not
+            // leave the other threads idle for the rest of the level.
+            size_t block_size =
+              std::max(vertex_count / (thread_count * block_per_thread_count),
+                       static_cast<size_t>(1));
+            std::atomic<size_t> next_index{0};
             BfsIndex bfs_index = bfs_index_;
             for (size_t k = 0; k < thread_count; k++) {
-              // Last thread gets the left overs.
-              size_t to = (k == thread_count - 1) ? vertex_count : from + chunk_size;
-              dispatch_queue_->dispatch( [=](int) {
-                for (size_t i = from; i < to; i++) {
-                  Vertex *vertex = level_vertices[i];
-                  if (vertex) {
-                    checkLevel(vertex, level);
-                    vertex->setBfsInQueue(bfs_index, false);
-                    visitors[k]->visit(vertex);
+              dispatch_queue_->dispatch( [&, k, level, bfs_index](int) {
+                VertexSeq batch;
+                batch.reserve(block_size);
+                size_t from;
+                while ((from = next_index.fetch_add(block_size,
+                                                    std::memory_order_relaxed))
+                       < vertex_count) {
+                  size_t to = std::min(from + block_size, vertex_count);
+                  batch.clear();
+                  for (size_t i = from; i < to; i++) {
+                    Vertex *vertex = level_vertices[i];
+                    if (vertex) {
+                      checkLevel(vertex, level);
+                      vertex->setBfsInQueue(bfs_index, false);
+                      batch.push_back(vertex);
+                    }
                   }
+                  visitors[k]->visitVertices(batch.data(), batch.size());
                 }
               });
-              from = to;
             }
             dispatch_queue_->finishTasks();
+            visitor->levelFinished();
+            level_vertices.clear();
+            visit_count += vertex_count;
+            visit_count_ = visit_count;
           }
-	  visitor->levelFinished();
-	  level_vertices.clear();
-          visit_count += vertex_count;
 	}
       }
       for (VertexVisitor *visitor : visitors)
@@ -229,6 +312,95 @@ BfsIterator::visitParallel(Level to_level,
   return visit_count;
 }
 
+// Visit a run of consecutive small levels with one dispatch, using a
+// spin barrier between levels instead of joining the thread pool.
+// Level order (and hence edge dependencies) is preserved: no thread
+// starts a level until every thread has finished the previous one.
+// Vertices enqueued by the visits always land in levels the run has
+// not reached yet, so the level vertex vectors are never mutated
+// while they are being read.
+int
+BfsIterator::visitLevelsParallel(Level level,
+                                 Level to_level,
+                                 std::vector<VertexVisitor*> &visitors,
+                                 VertexVisitor *visitor)
+{
+  size_t thread_count = thread_count_;
+  size_t small_level_max = thread_count * block_per_thread_count;
+  std::vector<Level> levels;
+  levels.push_back(level);
+  while (levels.size() < batch_level_count_max
+         && levelLessOrEqual(first_level_, last_level_)
+         && levelLessOrEqual(first_level_, to_level)
+         && queue_[first_level_].size() < small_level_max) {
+    levels.push_back(first_level_);
+    incrLevel(first_level_);
+  }
+
+  // Per level work state, reset by the barrier winner.
+  std::atomic<size_t> next_index{0};
+  std::atomic<size_t> done_count{0};
+  // Index of the levels entry threads may work on.
+  std::atomic<size_t> ready_level{0};
+  std::atomic<size_t> end_level{levels.size()};
+  // Written only by barrier winners, which are serialized.
+  size_t batch_visit_count = 0;
+  BfsIndex bfs_index = bfs_index_;
+  for (size_t k = 0; k < thread_count; k++) {
+    dispatch_queue_->dispatch([&, k, bfs_index, thread_count](int) {
+      VertexSeq batch;
+      size_t level_idx = 0;
+      while (level_idx < end_level.load(std::memory_order_acquire)) {
+        Level level = levels[level_idx];
+        VertexSeq &level_vertices = queue_[level];
+        size_t vertex_count = level_vertices.size();
+        size_t block_size =
+          std::max(vertex_count / (thread_count * block_per_thread_count),
+                   static_cast<size_t>(1));
+        size_t from;
+        while ((from = next_index.fetch_add(block_size,
+                                            std::memory_order_relaxed))
+               < vertex_count) {
+          size_t to = std::min(from + block_size, vertex_count);
+          batch.clear();
+          for (size_t i = from; i < to; i++) {
+            Vertex *vertex = level_vertices[i];
+            if (vertex) {
+              checkLevel(vertex, level);
+              vertex->setBfsInQueue(bfs_index, false);
+              batch.push_back(vertex);
+            }
+          }
+          visitors[k]->visitVertices(batch.data(), batch.size());
+        }
+        // The last thread to finish the level retires it and opens
+        // the next one; the others spin on ready_level.
+        if (done_count.fetch_add(1, std::memory_order_acq_rel) + 1
+            == thread_count) {
+          if (vertex_count > 0)
+            visitor->levelFinished();
+          batch_visit_count += vertex_count;
+          level_vertices.clear();
+          if (visit_cancel_)
+            end_level.store(level_idx + 1, std::memory_order_relaxed);
+          else if (level_idx + 1 < levels.size())
+            visit_level_ = levels[level_idx + 1];
+          next_index.store(0, std::memory_order_relaxed);
+          done_count.store(0, std::memory_order_relaxed);
+          ready_level.store(level_idx + 1, std::memory_order_release);
+        }
+        else {
+          while (ready_level.load(std::memory_order_acquire) <= level_idx)
+            std::this_thread::yield();
+        }
+        level_idx++;
+      }
+    });
+  }
+  dispatch_queue_->finishTasks();
+  return batch_visit_count;
+}
+
 bool
 BfsIterator::hasNext()
 {
@@ -280,11 +452,21 @@ BfsIterator::enqueue(Vertex *vertex)
              vertex->to_string(this).c_str());
   if (!vertex->bfsInQueue(bfs_index_)) {
     Level level = vertex->level();
-    LockGuard lock(queue_lock_);
-    if (!vertex->bfsInQueue(bfs_index_)) {
-      vertex->setBfsInQueue(bfs_index_, true);
-      queue_[level].push_back(vertex);
-
+    bool enqueued = false;
+    {
+      LockGuard lock(queue_level_locks_[level % queue_lock_count]);
+      if (!vertex->bfsInQueue(bfs_index_)) {
+	vertex->setBfsInQueue(bfs_index_, true);
+	queue_[level].push_back(vertex);
+	enqueued = true;
+      }
+    }
+    // Most enqueues land inside the queued level range, so the range
+    // lock is only taken when the range has to widen.
+    if (enqueued
+	&& (levelLess(last_level_, level)
+	    || levelLess(level, first_level_))) {
+      LockGuard lock(queue_lock_);
       if (levelLess(last_level_, level))
 	last_level_ = level;
       if (levelLess(level, first_level_))
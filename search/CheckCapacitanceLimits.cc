@@ -24,6 +24,9 @@
 
 #include "CheckCapacitanceLimits.hh"
 
+#include <algorithm>
+#include <vector>
+
 #include "Fuzzy.hh"
 #include "Liberty.hh"
 #include "Network.hh"
@@ -37,6 +40,7 @@
 #include "Sim.hh"
 #include "Graph.hh"
 #include "GraphDelayCalc.hh"
+#include "DispatchQueue.hh"
 
 namespace sta {
 
@@ -138,8 +142,13 @@ CheckCapacitanceLimits::checkCapacitance1(const Pin *pin,
   bool limit_exists;
   findLimit(pin, corner, min_max, limit, limit_exists);
   if (limit_exists) {
+    // The load capacitance does not depend on the transition,
+    // so compute it once for both rise and fall.
+    const DcalcAnalysisPt *dcalc_ap = corner->findDcalcAnalysisPt(min_max);
+    GraphDelayCalc *dcalc = sta_->graphDelayCalc();
+    float cap = dcalc->loadCap(pin, dcalc_ap);
     for (auto rf : RiseFall::range()) {
-      checkCapacitance(pin, corner, min_max, rf, limit,
+      checkCapacitance(corner, min_max, rf, limit, cap,
 		       corner1, rf1, capacitance1, slack1, limit1);
     }
   }
@@ -226,11 +235,11 @@ CheckCapacitanceLimits::findLimit(const Pin *pin,
 }
 
 void
-CheckCapacitanceLimits::checkCapacitance(const Pin *pin,
-					 const Corner *corner,
+CheckCapacitanceLimits::checkCapacitance(const Corner *corner,
 					 const MinMax *min_max,
 					 const RiseFall *rf,
 					 float limit,
+					 float cap,
 					 // Return values.
 					 const Corner *&corner1,
 					 const RiseFall *&rf1,
@@ -238,10 +247,6 @@ CheckCapacitanceLimits::checkCapacitance(const Pin *pin,
 					 float &slack1,
 					 float &limit1) const
 {
-  const DcalcAnalysisPt *dcalc_ap = corner->findDcalcAnalysisPt(min_max);
-  GraphDelayCalc *dcalc = sta_->graphDelayCalc();
-  float cap = dcalc->loadCap(pin, dcalc_ap);
-
   float slack = (min_max == MinMax::max())
     ? limit - cap : cap - limit;
   if (slack < slack1
@@ -276,15 +281,40 @@ CheckCapacitanceLimits::checkCapacitanceLimits(const Net *net,
     delete pin_iter;
   }
   else {
-    LeafInstanceIterator *inst_iter = network->leafInstanceIterator();
-    while (inst_iter->hasNext()) {
-      Instance *inst = inst_iter->next();
-      checkCapLimits(inst, violators, corner, min_max, cap_pins, min_slack);
+    // Batch the pins so the checks can run on the thread pool with a
+    // per-thread pin list for each worker.
+    PinSeq pins = networkPins();
+    size_t pin_count = pins.size();
+    size_t thread_count = sta_->threadCount();
+    if (thread_count <= 1
+        || pin_count < thread_count) {
+      for (const Pin *pin : pins)
+        checkCapLimits(pin, violators, corner, min_max, cap_pins, min_slack);
+    }
+    else {
+      DispatchQueue *dispatch_queue = sta_->dispatchQueue();
+      std::vector<PinSeq> thread_pins(thread_count);
+      std::vector<float> thread_slacks(thread_count,
+                                       MinMax::min()->initValue());
+      size_t chunk_size = pin_count / thread_count + 1;
+      size_t from = 0;
+      for (size_t k = 0; k < thread_count && from < pin_count; k++) {
+        size_t to = std::min(from + chunk_size, pin_count);
+        dispatch_queue->dispatch([this, &pins, &thread_pins, &thread_slacks,
+                                  violators, corner, min_max, from, to, k](int) {
+          for (size_t i = from; i < to; i++)
+            checkCapLimits(pins[i], violators, corner, min_max,
+                           thread_pins[k], thread_slacks[k]);
+        });
+        from = to;
+      }
+      dispatch_queue->finishTasks();
+      // Merge in thread order; the sort below finds the min slack pin.
+      for (size_t k = 0; k < thread_count; k++) {
+        for (const Pin *pin : thread_pins[k])
+          cap_pins.push_back(pin);
+      }
     }
-    delete inst_iter;
-    // Check top level ports.
-    checkCapLimits(network->topInstance(), violators, corner, min_max,
-                   cap_pins, min_slack);
   }
   sort(cap_pins, PinCapacitanceLimitSlackLess(corner, min_max, this, sta_));
   // Keep the min slack pin unless all violators or net pins.
@@ -293,20 +323,30 @@ CheckCapacitanceLimits::checkCapacitanceLimits(const Net *net,
   return cap_pins;
 }
 
+PinSeq
+CheckCapacitanceLimits::networkPins() const
+{
+  const Network *network = sta_->network();
+  PinSeq pins;
+  LeafInstanceIterator *inst_iter = network->leafInstanceIterator();
+  while (inst_iter->hasNext()) {
+    const Instance *inst = inst_iter->next();
+    networkPins(inst, pins);
+  }
+  delete inst_iter;
+  // Check top level ports.
+  networkPins(network->topInstance(), pins);
+  return pins;
+}
+
 void
-CheckCapacitanceLimits::checkCapLimits(const Instance *inst,
-                                       bool violators,
-                                       const Corner *corner,
-                                       const MinMax *min_max,
-                                       PinSeq &cap_pins,
-                                       float &min_slack)
+CheckCapacitanceLimits::networkPins(const Instance *inst,
+                                    PinSeq &pins) const
 {
   const Network *network = sta_->network();
   InstancePinIterator *pin_iter = network->pinIterator(inst);
-  while (pin_iter->hasNext()) {
-    Pin *pin = pin_iter->next();
-    checkCapLimits(pin, violators, corner, min_max, cap_pins, min_slack);
-  }
+  while (pin_iter->hasNext())
+    pins.push_back(pin_iter->next());
   delete pin_iter;
 }
 
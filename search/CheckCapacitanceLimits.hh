@@ -59,11 +59,11 @@ public:
                                 const MinMax *min_max);
 
 protected:
-  void checkCapacitance(const Pin *pin,
-			const Corner *corner,
+  void checkCapacitance(const Corner *corner,
 			const MinMax *min_max,
 			const RiseFall *rf,
 			float limit,
+			float cap,
 			// Return values.
 			const Corner *&corner1,
 			const RiseFall *&rf1,
@@ -85,12 +85,9 @@ protected:
 		 // Return values.
 		 float &limit,
 		 bool &limit_exists) const;
-  void checkCapLimits(const Instance *inst,
-                      bool violators,
-                      const Corner *corner,
-                      const MinMax *min_max,
-                      PinSeq &cap_pins,
-                      float &min_slack);
+  PinSeq networkPins() const;
+  void networkPins(const Instance *inst,
+                   PinSeq &pins) const;
   void checkCapLimits(const Pin *pin,
                       bool violators,
                       const Corner *corner,
@@ -24,6 +24,9 @@
 
 #include "CheckFanoutLimits.hh"
 
+#include <algorithm>
+#include <vector>
+
 #include "Fuzzy.hh"
 #include "Liberty.hh"
 #include "Network.hh"
@@ -33,6 +36,7 @@
 #include "PortDirection.hh"
 #include "Graph.hh"
 #include "Search.hh"
+#include "DispatchQueue.hh"
 
 namespace sta {
 
@@ -255,15 +259,40 @@ CheckFanoutLimits::checkFanoutLimits(const Net *net,
     delete pin_iter;
   }
   else {
-    LeafInstanceIterator *inst_iter = network->leafInstanceIterator();
-    while (inst_iter->hasNext()) {
-      const Instance *inst = inst_iter->next();
-      checkFanoutLimits(inst, violators, min_max, fanout_pins, min_slack);
+    // Batch the pins so the checks can run on the thread pool with a
+    // per-thread pin list for each worker.
+    PinSeq pins = networkPins();
+    size_t pin_count = pins.size();
+    size_t thread_count = sta_->threadCount();
+    if (thread_count <= 1
+        || pin_count < thread_count) {
+      for (const Pin *pin : pins)
+        checkFanoutLimits(pin, violators, min_max, fanout_pins, min_slack);
+    }
+    else {
+      DispatchQueue *dispatch_queue = sta_->dispatchQueue();
+      std::vector<PinSeq> thread_pins(thread_count);
+      std::vector<float> thread_slacks(thread_count,
+                                       MinMax::min()->initValue());
+      size_t chunk_size = pin_count / thread_count + 1;
+      size_t from = 0;
+      for (size_t k = 0; k < thread_count && from < pin_count; k++) {
+        size_t to = std::min(from + chunk_size, pin_count);
+        dispatch_queue->dispatch([this, &pins, &thread_pins, &thread_slacks,
+                                  violators, min_max, from, to, k](int) {
+          for (size_t i = from; i < to; i++)
+            checkFanoutLimits(pins[i], violators, min_max,
+                              thread_pins[k], thread_slacks[k]);
+        });
+        from = to;
+      }
+      dispatch_queue->finishTasks();
+      // Merge in thread order; the sort below finds the min slack pin.
+      for (size_t k = 0; k < thread_count; k++) {
+        for (const Pin *pin : thread_pins[k])
+          fanout_pins.push_back(pin);
+      }
     }
-    delete inst_iter;
-    // Check top level ports.
-    checkFanoutLimits(network->topInstance(), violators, min_max,
-                    fanout_pins, min_slack);
   }
   sort(fanout_pins, PinFanoutLimitSlackLess(min_max, this, sta_));
   // Keep the min slack pin unless all violators or net pins.
@@ -272,19 +301,30 @@ CheckFanoutLimits::checkFanoutLimits(const Net *net,
   return fanout_pins;
 }
 
+PinSeq
+CheckFanoutLimits::networkPins() const
+{
+  const Network *network = sta_->network();
+  PinSeq pins;
+  LeafInstanceIterator *inst_iter = network->leafInstanceIterator();
+  while (inst_iter->hasNext()) {
+    const Instance *inst = inst_iter->next();
+    networkPins(inst, pins);
+  }
+  delete inst_iter;
+  // Check top level ports.
+  networkPins(network->topInstance(), pins);
+  return pins;
+}
+
 void
-CheckFanoutLimits::checkFanoutLimits(const Instance *inst,
-                                     bool violators,
-                                     const MinMax *min_max,
-                                     PinSeq &fanout_pins,
-                                     float &min_slack)
+CheckFanoutLimits::networkPins(const Instance *inst,
+                               PinSeq &pins) const
 {
   const Network *network = sta_->network();
   InstancePinIterator *pin_iter = network->pinIterator(inst);
-  while (pin_iter->hasNext()) {
-    const Pin *pin = pin_iter->next();
-    checkFanoutLimits(pin, violators, min_max, fanout_pins, min_slack);
-  }
+  while (pin_iter->hasNext())
+    pins.push_back(pin_iter->next());
   delete pin_iter;
 }
 
@@ -64,11 +64,9 @@ protected:
 		 float &limit,
 		 bool &limit_exists) const;
   float fanoutLoad(const Pin *pin) const;
-  void checkFanoutLimits(const Instance *inst,
-                         bool violators,
-                         const MinMax *min_max,
-                         PinSeq &fanout_pins,
-                         float &min_slack);
+  PinSeq networkPins() const;
+  void networkPins(const Instance *inst,
+                   PinSeq &pins) const;
   void checkFanoutLimits(const Pin *pin,
                          bool violators,
                          const MinMax *min_max,
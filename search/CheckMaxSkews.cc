@@ -24,6 +24,9 @@
 
 #include "CheckMaxSkews.hh"
 
+#include <algorithm>
+#include <vector>
+
 #include "TimingRole.hh"
 #include "TimingArc.hh"
 #include "Liberty.hh"
@@ -33,6 +36,7 @@
 #include "Path.hh"
 #include "PathAnalysisPt.hh"
 #include "Search.hh"
+#include "DispatchQueue.hh"
 
 namespace sta {
 
@@ -44,6 +48,11 @@ public:
   virtual ~MaxSkewCheckVisitor() {}
   virtual void visit(MaxSkewCheck &check,
 		     const StaState *sta) = 0;
+  // Clone the visitor for a worker thread.
+  virtual MaxSkewCheckVisitor *copy() const = 0;
+  // Fold a worker visitor's results back into this one.
+  virtual void merge(MaxSkewCheckVisitor *visitor,
+		     const StaState *sta) = 0;
 };
 
 CheckMaxSkews::CheckMaxSkews(StaState *sta) :
@@ -65,17 +74,20 @@ CheckMaxSkews::clear()
 class MaxSkewChecksVisitor : public MaxSkewCheckVisitor
 {
 public:
-  explicit MaxSkewChecksVisitor(MaxSkewCheckSeq &checks);
+  MaxSkewChecksVisitor();
   virtual void visit(MaxSkewCheck &check,
 		     const StaState *sta);
+  virtual MaxSkewCheckVisitor *copy() const;
+  virtual void merge(MaxSkewCheckVisitor *visitor,
+		     const StaState *sta);
+  MaxSkewCheckSeq &checks() { return checks_; }
 
 private:
-  MaxSkewCheckSeq &checks_;
+  MaxSkewCheckSeq checks_;
 };
 
-MaxSkewChecksVisitor::MaxSkewChecksVisitor(MaxSkewCheckSeq &checks) :
-  MaxSkewCheckVisitor(),
-  checks_(checks)
+MaxSkewChecksVisitor::MaxSkewChecksVisitor() :
+  MaxSkewCheckVisitor()
 {
 }
 
@@ -86,21 +98,40 @@ MaxSkewChecksVisitor::visit(MaxSkewCheck &check,
   checks_.push_back(new MaxSkewCheck(check));
 }
 
+MaxSkewCheckVisitor *
+MaxSkewChecksVisitor::copy() const
+{
+  return new MaxSkewChecksVisitor();
+}
+
+void
+MaxSkewChecksVisitor::merge(MaxSkewCheckVisitor *visitor,
+			    const StaState *)
+{
+  MaxSkewChecksVisitor *visitor1 =
+    static_cast<MaxSkewChecksVisitor*>(visitor);
+  for (MaxSkewCheck *check : visitor1->checks_)
+    checks_.push_back(check);
+  visitor1->checks_.clear();
+}
+
 class MaxSkewViolatorsVisititor : public MaxSkewCheckVisitor
 {
 public:
-  explicit MaxSkewViolatorsVisititor(MaxSkewCheckSeq &checks);
+  MaxSkewViolatorsVisititor();
   virtual void visit(MaxSkewCheck &check,
 		     const StaState *sta);
+  virtual MaxSkewCheckVisitor *copy() const;
+  virtual void merge(MaxSkewCheckVisitor *visitor,
+		     const StaState *sta);
+  MaxSkewCheckSeq &checks() { return checks_; }
 
 private:
-  MaxSkewCheckSeq &checks_;
+  MaxSkewCheckSeq checks_;
 };
 
-MaxSkewViolatorsVisititor::
-MaxSkewViolatorsVisititor(MaxSkewCheckSeq &checks) :
-  MaxSkewCheckVisitor(),
-  checks_(checks)
+MaxSkewViolatorsVisititor::MaxSkewViolatorsVisititor() :
+  MaxSkewCheckVisitor()
 {
 }
 
@@ -112,12 +143,30 @@ MaxSkewViolatorsVisititor::visit(MaxSkewCheck &check,
     checks_.push_back(new MaxSkewCheck(check));
 }
 
+MaxSkewCheckVisitor *
+MaxSkewViolatorsVisititor::copy() const
+{
+  return new MaxSkewViolatorsVisititor();
+}
+
+void
+MaxSkewViolatorsVisititor::merge(MaxSkewCheckVisitor *visitor,
+				 const StaState *)
+{
+  MaxSkewViolatorsVisititor *visitor1 =
+    static_cast<MaxSkewViolatorsVisititor*>(visitor);
+  for (MaxSkewCheck *check : visitor1->checks_)
+    checks_.push_back(check);
+  visitor1->checks_.clear();
+}
+
 MaxSkewCheckSeq &
 CheckMaxSkews::violations()
 {
   clear();
-  MaxSkewViolatorsVisititor visitor(checks_);
+  MaxSkewViolatorsVisititor visitor;
   visitMaxSkewChecks(&visitor);
+  checks_ = visitor.checks();
   sort(checks_, MaxSkewSlackLess(sta_));
   return checks_;
 }
@@ -128,6 +177,9 @@ public:
   MaxSkewSlackVisitor();
   virtual void visit(MaxSkewCheck &check,
 		     const StaState *sta);
+  virtual MaxSkewCheckVisitor *copy() const;
+  virtual void merge(MaxSkewCheckVisitor *visitor,
+		     const StaState *sta);
   MaxSkewCheck *minSlackCheck();
 
 private:
@@ -152,6 +204,32 @@ MaxSkewSlackVisitor::visit(MaxSkewCheck &check,
   }
 }
 
+MaxSkewCheckVisitor *
+MaxSkewSlackVisitor::copy() const
+{
+  return new MaxSkewSlackVisitor();
+}
+
+void
+MaxSkewSlackVisitor::merge(MaxSkewCheckVisitor *visitor,
+			   const StaState *sta)
+{
+  MaxSkewSlackVisitor *visitor1 =
+    static_cast<MaxSkewSlackVisitor*>(visitor);
+  MaxSkewCheck *check = visitor1->min_slack_check_;
+  if (check) {
+    MaxSkewSlackLess slack_less(sta);
+    if (min_slack_check_ == nullptr
+	|| slack_less(check, min_slack_check_)) {
+      delete min_slack_check_;
+      min_slack_check_ = check;
+    }
+    else
+      delete check;
+    visitor1->min_slack_check_ = nullptr;
+  }
+}
+
 MaxSkewCheck *
 MaxSkewSlackVisitor::minSlackCheck()
 {
@@ -174,11 +252,57 @@ void
 CheckMaxSkews::visitMaxSkewChecks(MaxSkewCheckVisitor *visitor)
 {
   Graph *graph = sta_->graph();
+  // Batch the checked vertices so the checks can run on the thread
+  // pool with a per-thread visitor for each worker.
+  VertexSeq check_vertices;
   VertexIterator vertex_iter(graph);
   while (vertex_iter.hasNext()) {
     Vertex *vertex = vertex_iter.next();
-    visitMaxSkewChecks(vertex, visitor);
+    if (hasMaxSkewChecks(vertex))
+      check_vertices.push_back(vertex);
+  }
+  size_t vertex_count = check_vertices.size();
+  size_t thread_count = sta_->threadCount();
+  if (thread_count <= 1
+      || vertex_count < thread_count) {
+    for (Vertex *vertex : check_vertices)
+      visitMaxSkewChecks(vertex, visitor);
+  }
+  else {
+    DispatchQueue *dispatch_queue = sta_->dispatchQueue();
+    std::vector<MaxSkewCheckVisitor*> visitors(thread_count);
+    for (size_t k = 0; k < thread_count; k++)
+      visitors[k] = visitor->copy();
+    size_t chunk_size = vertex_count / thread_count + 1;
+    size_t from = 0;
+    for (size_t k = 0; k < thread_count && from < vertex_count; k++) {
+      size_t to = std::min(from + chunk_size, vertex_count);
+      dispatch_queue->dispatch([this, &check_vertices, &visitors, k, from, to](int) {
+	for (size_t i = from; i < to; i++)
+	  visitMaxSkewChecks(check_vertices[i], visitors[k]);
+      });
+      from = to;
+    }
+    dispatch_queue->finishTasks();
+    // Merge in thread order so the check order is deterministic.
+    for (size_t k = 0; k < thread_count; k++) {
+      visitor->merge(visitors[k], sta_);
+      delete visitors[k];
+    }
+  }
+}
+
+bool
+CheckMaxSkews::hasMaxSkewChecks(Vertex *vertex) const
+{
+  Graph *graph = sta_->graph();
+  VertexInEdgeIterator edge_iter(vertex, graph);
+  while (edge_iter.hasNext()) {
+    Edge *edge = edge_iter.next();
+    if (edge->role() == TimingRole::skew())
+      return true;
   }
+  return false;
 }
 
 void
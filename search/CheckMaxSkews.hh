@@ -49,6 +49,7 @@ protected:
   void visitMaxSkewChecks(MaxSkewCheckVisitor *visitor);
   void visitMaxSkewChecks(Vertex *vertex,
 			  MaxSkewCheckVisitor *visitor);
+  bool hasMaxSkewChecks(Vertex *vertex) const;
 
   MaxSkewCheckSeq checks_;
   StaState *sta_;
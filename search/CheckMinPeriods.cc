@@ -24,6 +24,9 @@
 
 #include "CheckMinPeriods.hh"
 
+#include <algorithm>
+#include <vector>
+
 #include "Liberty.hh"
 #include "Network.hh"
 #include "Sdc.hh"
@@ -32,6 +35,7 @@
 #include "DcalcAnalysisPt.hh"
 #include "GraphDelayCalc.hh"
 #include "Search.hh"
+#include "DispatchQueue.hh"
 
 namespace sta {
 
@@ -43,6 +47,11 @@ public:
   virtual ~MinPeriodCheckVisitor() {}
   virtual void visit(MinPeriodCheck &check,
 		     StaState *sta) = 0;
+  // Clone the visitor for a worker thread.
+  virtual MinPeriodCheckVisitor *copy() const = 0;
+  // Fold a worker visitor's results back into this one.
+  virtual void merge(MinPeriodCheckVisitor *visitor,
+		     StaState *sta) = 0;
   const Corner *corner() { return corner_; }
 
 protected:
@@ -73,19 +82,20 @@ CheckMinPeriods::clear()
 class MinPeriodViolatorsVisitor : public MinPeriodCheckVisitor
 {
 public:
-  MinPeriodViolatorsVisitor(const Corner *corner,
-			    MinPeriodCheckSeq &checks);
+  MinPeriodViolatorsVisitor(const Corner *corner);
   virtual void visit(MinPeriodCheck &check,
 		     StaState *sta);
+  virtual MinPeriodCheckVisitor *copy() const;
+  virtual void merge(MinPeriodCheckVisitor *visitor,
+		     StaState *sta);
+  MinPeriodCheckSeq &checks() { return checks_; }
 
 private:
-  MinPeriodCheckSeq &checks_;
+  MinPeriodCheckSeq checks_;
 };
 
-MinPeriodViolatorsVisitor::MinPeriodViolatorsVisitor(const Corner *corner,
-						     MinPeriodCheckSeq &checks):
-  MinPeriodCheckVisitor(corner),
-  checks_(checks)
+MinPeriodViolatorsVisitor::MinPeriodViolatorsVisitor(const Corner *corner) :
+  MinPeriodCheckVisitor(corner)
 {
 }
 
@@ -97,12 +107,30 @@ MinPeriodViolatorsVisitor::visit(MinPeriodCheck &check,
     checks_.push_back(check.copy());
 }
 
+MinPeriodCheckVisitor *
+MinPeriodViolatorsVisitor::copy() const
+{
+  return new MinPeriodViolatorsVisitor(corner_);
+}
+
+void
+MinPeriodViolatorsVisitor::merge(MinPeriodCheckVisitor *visitor,
+				 StaState *)
+{
+  MinPeriodViolatorsVisitor *visitor1 =
+    static_cast<MinPeriodViolatorsVisitor*>(visitor);
+  for (MinPeriodCheck *check : visitor1->checks_)
+    checks_.push_back(check);
+  visitor1->checks_.clear();
+}
+
 MinPeriodCheckSeq &
 CheckMinPeriods::violations(const Corner *corner)
 {
   clear();
-  MinPeriodViolatorsVisitor visitor(corner, checks_);
+  MinPeriodViolatorsVisitor visitor(corner);
   visitMinPeriodChecks(&visitor);
+  checks_ = visitor.checks();
   sort(checks_, MinPeriodSlackLess(sta_));
   return checks_;
 }
@@ -111,12 +139,44 @@ void
 CheckMinPeriods::visitMinPeriodChecks(MinPeriodCheckVisitor *visitor)
 {
   Graph *graph = sta_->graph();
+  // Batch the clock end vertices so the checks can run on the thread
+  // pool with a per-thread visitor for each worker.
+  VertexSeq clk_ends;
   VertexIterator vertex_iter(graph);
   while (vertex_iter.hasNext()) {
     Vertex *vertex = vertex_iter.next();
     if (isClkEnd(vertex, graph))
+      clk_ends.push_back(vertex);
+  }
+  size_t vertex_count = clk_ends.size();
+  size_t thread_count = sta_->threadCount();
+  if (thread_count <= 1
+      || vertex_count < thread_count) {
+    for (Vertex *vertex : clk_ends)
       visitMinPeriodChecks(vertex, visitor);
   }
+  else {
+    DispatchQueue *dispatch_queue = sta_->dispatchQueue();
+    std::vector<MinPeriodCheckVisitor*> visitors(thread_count);
+    for (size_t k = 0; k < thread_count; k++)
+      visitors[k] = visitor->copy();
+    size_t chunk_size = vertex_count / thread_count + 1;
+    size_t from = 0;
+    for (size_t k = 0; k < thread_count && from < vertex_count; k++) {
+      size_t to = std::min(from + chunk_size, vertex_count);
+      dispatch_queue->dispatch([this, &clk_ends, &visitors, k, from, to](int) {
+	for (size_t i = from; i < to; i++)
+	  visitMinPeriodChecks(clk_ends[i], visitors[k]);
+      });
+      from = to;
+    }
+    dispatch_queue->finishTasks();
+    // Merge in thread order so the check order is deterministic.
+    for (size_t k = 0; k < thread_count; k++) {
+      visitor->merge(visitors[k], sta_);
+      delete visitors[k];
+    }
+  }
 }
 
 void
@@ -149,6 +209,9 @@ public:
   MinPeriodSlackVisitor(const Corner *corner);
   void visit(MinPeriodCheck &check,
 	     StaState *sta) override;
+  MinPeriodCheckVisitor *copy() const override;
+  void merge(MinPeriodCheckVisitor *visitor,
+	     StaState *sta) override;
   MinPeriodCheck *minSlackCheck();
 
 private:
@@ -174,6 +237,32 @@ MinPeriodSlackVisitor::visit(MinPeriodCheck &check,
   }
 }
 
+MinPeriodCheckVisitor *
+MinPeriodSlackVisitor::copy() const
+{
+  return new MinPeriodSlackVisitor(corner_);
+}
+
+void
+MinPeriodSlackVisitor::merge(MinPeriodCheckVisitor *visitor,
+			     StaState *sta)
+{
+  MinPeriodSlackVisitor *visitor1 =
+    static_cast<MinPeriodSlackVisitor*>(visitor);
+  MinPeriodCheck *check = visitor1->min_slack_check_;
+  if (check) {
+    MinPeriodSlackLess slack_less(sta);
+    if (min_slack_check_ == nullptr
+	|| slack_less(check, min_slack_check_)) {
+      delete min_slack_check_;
+      min_slack_check_ = check;
+    }
+    else
+      delete check;
+    visitor1->min_slack_check_ = nullptr;
+  }
+}
+
 MinPeriodCheck *
 MinPeriodSlackVisitor::minSlackCheck()
 {
@@ -24,6 +24,9 @@
 
 #include "CheckMinPulseWidths.hh"
 
+#include <algorithm>
+#include <vector>
+
 #include "Debug.hh"
 #include "TimingRole.hh"
 #include "Liberty.hh"
@@ -41,6 +44,7 @@
 #include "SearchPred.hh"
 #include "PathEnd.hh"
 #include "Search.hh"
+#include "DispatchQueue.hh"
 #include "search/Crpr.hh"
 
 namespace sta {
@@ -60,6 +64,11 @@ public:
   virtual ~MinPulseWidthCheckVisitor() {}
   virtual void visit(MinPulseWidthCheck &check,
 		     const StaState *sta) = 0;
+  // Clone the visitor for a worker thread.
+  virtual MinPulseWidthCheckVisitor *copy() const = 0;
+  // Fold a worker visitor's results back into this one.
+  virtual void merge(MinPulseWidthCheckVisitor *visitor,
+		     const StaState *sta) = 0;
 };
 
 CheckMinPulseWidths::CheckMinPulseWidths(StaState *sta) :
@@ -83,21 +92,22 @@ CheckMinPulseWidths::clear()
 class MinPulseWidthChecksVisitor : public MinPulseWidthCheckVisitor
 {
 public:
-  explicit MinPulseWidthChecksVisitor(const Corner *corner,
-				      MinPulseWidthCheckSeq &checks);
+  explicit MinPulseWidthChecksVisitor(const Corner *corner);
   virtual void visit(MinPulseWidthCheck &check,
 		     const StaState *sta);
+  virtual MinPulseWidthCheckVisitor *copy() const;
+  virtual void merge(MinPulseWidthCheckVisitor *visitor,
+		     const StaState *sta);
+  MinPulseWidthCheckSeq &checks() { return checks_; }
 
 private:
   const Corner *corner_;
-  MinPulseWidthCheckSeq &checks_;
+  MinPulseWidthCheckSeq checks_;
 };
 
 MinPulseWidthChecksVisitor::
-MinPulseWidthChecksVisitor(const Corner *corner,
-			   MinPulseWidthCheckSeq &checks) :
-  corner_(corner),
-  checks_(checks)
+MinPulseWidthChecksVisitor(const Corner *corner) :
+  corner_(corner)
 {
 }
 
@@ -112,12 +122,30 @@ MinPulseWidthChecksVisitor::visit(MinPulseWidthCheck &check,
   }
 }
 
+MinPulseWidthCheckVisitor *
+MinPulseWidthChecksVisitor::copy() const
+{
+  return new MinPulseWidthChecksVisitor(corner_);
+}
+
+void
+MinPulseWidthChecksVisitor::merge(MinPulseWidthCheckVisitor *visitor,
+				  const StaState *)
+{
+  MinPulseWidthChecksVisitor *visitor1 =
+    static_cast<MinPulseWidthChecksVisitor*>(visitor);
+  for (MinPulseWidthCheck *check : visitor1->checks_)
+    checks_.push_back(check);
+  visitor1->checks_.clear();
+}
+
 MinPulseWidthCheckSeq &
 CheckMinPulseWidths::check(const Corner *corner)
 {
   clear();
-  MinPulseWidthChecksVisitor visitor(corner, checks_);
+  MinPulseWidthChecksVisitor visitor(corner);
   visitMinPulseWidthChecks(&visitor);
+  checks_ = visitor.checks();
   sort(checks_, MinPulseWidthSlackLess(sta_));
   return checks_;
 }
@@ -128,13 +156,14 @@ CheckMinPulseWidths::check(PinSeq *pins,
 {
   clear();
   Graph *graph = sta_->graph();
-  MinPulseWidthChecksVisitor visitor(corner, checks_);
+  MinPulseWidthChecksVisitor visitor(corner);
   PinSeq::Iterator pin_iter(pins);
   while (pin_iter.hasNext()) {
     const Pin *pin = pin_iter.next();
     Vertex *vertex = graph->pinLoadVertex(pin);
     visitMinPulseWidthChecks(vertex, &visitor);
   }
+  checks_ = visitor.checks();
   sort(checks_, MinPulseWidthSlackLess(sta_));
   return checks_;
 }
@@ -144,21 +173,22 @@ CheckMinPulseWidths::check(PinSeq *pins,
 class MinPulseWidthViolatorsVisitor : public MinPulseWidthCheckVisitor
 {
 public:
-  explicit MinPulseWidthViolatorsVisitor(const Corner *corner,
-					 MinPulseWidthCheckSeq &checks);
+  explicit MinPulseWidthViolatorsVisitor(const Corner *corner);
   virtual void visit(MinPulseWidthCheck &check,
 		     const StaState *sta);
+  virtual MinPulseWidthCheckVisitor *copy() const;
+  virtual void merge(MinPulseWidthCheckVisitor *visitor,
+		     const StaState *sta);
+  MinPulseWidthCheckSeq &checks() { return checks_; }
 
 private:
   const Corner *corner_;
-  MinPulseWidthCheckSeq &checks_;
+  MinPulseWidthCheckSeq checks_;
 };
 
 MinPulseWidthViolatorsVisitor::
-MinPulseWidthViolatorsVisitor(const Corner *corner,
-			      MinPulseWidthCheckSeq &checks) :
-  corner_(corner),
-  checks_(checks)
+MinPulseWidthViolatorsVisitor(const Corner *corner) :
+  corner_(corner)
 {
 }
 
@@ -174,12 +204,30 @@ MinPulseWidthViolatorsVisitor::visit(MinPulseWidthCheck &check,
   }
 }
 
+MinPulseWidthCheckVisitor *
+MinPulseWidthViolatorsVisitor::copy() const
+{
+  return new MinPulseWidthViolatorsVisitor(corner_);
+}
+
+void
+MinPulseWidthViolatorsVisitor::merge(MinPulseWidthCheckVisitor *visitor,
+				     const StaState *)
+{
+  MinPulseWidthViolatorsVisitor *visitor1 =
+    static_cast<MinPulseWidthViolatorsVisitor*>(visitor);
+  for (MinPulseWidthCheck *check : visitor1->checks_)
+    checks_.push_back(check);
+  visitor1->checks_.clear();
+}
+
 MinPulseWidthCheckSeq &
 CheckMinPulseWidths::violations(const Corner *corner)
 {
   clear();
-  MinPulseWidthViolatorsVisitor visitor(corner, checks_);
+  MinPulseWidthViolatorsVisitor visitor(corner);
   visitMinPulseWidthChecks(&visitor);
+  checks_ = visitor.checks();
   sort(checks_, MinPulseWidthSlackLess(sta_));
   return checks_;
 }
@@ -192,6 +240,9 @@ public:
   MinPulseWidthSlackVisitor(const Corner *corner);
   virtual void visit(MinPulseWidthCheck &check,
 		     const StaState *sta);
+  virtual MinPulseWidthCheckVisitor *copy() const;
+  virtual void merge(MinPulseWidthCheckVisitor *visitor,
+		     const StaState *sta);
   MinPulseWidthCheck *minSlackCheck();
 
 private:
@@ -221,6 +272,32 @@ MinPulseWidthSlackVisitor::visit(MinPulseWidthCheck &check,
   }
 }
 
+MinPulseWidthCheckVisitor *
+MinPulseWidthSlackVisitor::copy() const
+{
+  return new MinPulseWidthSlackVisitor(corner_);
+}
+
+void
+MinPulseWidthSlackVisitor::merge(MinPulseWidthCheckVisitor *visitor,
+				 const StaState *sta)
+{
+  MinPulseWidthSlackVisitor *visitor1 =
+    static_cast<MinPulseWidthSlackVisitor*>(visitor);
+  MinPulseWidthCheck *check = visitor1->min_slack_check_;
+  if (check) {
+    MinPulseWidthSlackLess slack_less(sta);
+    if (min_slack_check_ == nullptr
+	|| slack_less(check, min_slack_check_)) {
+      delete min_slack_check_;
+      min_slack_check_ = check;
+    }
+    else
+      delete check;
+    visitor1->min_slack_check_ = nullptr;
+  }
+}
+
 MinPulseWidthCheck *
 MinPulseWidthSlackVisitor::minSlackCheck()
 {
@@ -245,13 +322,45 @@ visitMinPulseWidthChecks(MinPulseWidthCheckVisitor *visitor)
 {
   Graph *graph = sta_->graph();
   Debug *debug = sta_->debug();
+  // Batch the clock end vertices so the checks can run on the thread
+  // pool with a per-thread visitor for each worker.
+  VertexSeq clk_ends;
   VertexIterator vertex_iter(graph);
   while (vertex_iter.hasNext()) {
     Vertex *vertex = vertex_iter.next();
     if (isClkEnd(vertex, graph)) {
       debugPrint(debug, "mpw", 1, "check mpw %s",
                  vertex->to_string(sta_).c_str());
+      clk_ends.push_back(vertex);
+    }
+  }
+  size_t vertex_count = clk_ends.size();
+  size_t thread_count = sta_->threadCount();
+  if (thread_count <= 1
+      || vertex_count < thread_count) {
+    for (Vertex *vertex : clk_ends)
       visitMinPulseWidthChecks(vertex, visitor);
+  }
+  else {
+    DispatchQueue *dispatch_queue = sta_->dispatchQueue();
+    std::vector<MinPulseWidthCheckVisitor*> visitors(thread_count);
+    for (size_t k = 0; k < thread_count; k++)
+      visitors[k] = visitor->copy();
+    size_t chunk_size = vertex_count / thread_count + 1;
+    size_t from = 0;
+    for (size_t k = 0; k < thread_count && from < vertex_count; k++) {
+      size_t to = std::min(from + chunk_size, vertex_count);
+      dispatch_queue->dispatch([this, &clk_ends, &visitors, k, from, to](int) {
+	for (size_t i = from; i < to; i++)
+	  visitMinPulseWidthChecks(clk_ends[i], visitors[k]);
+      });
+      from = to;
+    }
+    dispatch_queue->finishTasks();
+    // Merge in thread order so the check order is deterministic.
+    for (size_t k = 0; k < thread_count; k++) {
+      visitor->merge(visitors[k], sta_);
+      delete visitors[k];
     }
   }
 }
@@ -109,12 +109,9 @@ protected:
 		 // Return values.
 		 float &limit,
 		 bool &limit_exists) const;
-  void checkSlewLimits(const Instance *inst,
-                       bool violators,
-                       const Corner *corner,
-                       const MinMax *min_max,
-                       PinSeq &slew_pins,
-                       float &min_slack);
+  PinSeq networkPins() const;
+  void networkPins(const Instance *inst,
+                   PinSeq &pins) const;
   void checkSlewLimits(const Pin *pin,
                        bool violators,
                        const Corner *corner,
@@ -24,7 +24,10 @@
 
 #include "CheckTiming.hh"
 
+#include <algorithm>
+
 #include "Error.hh"
+#include "DispatchQueue.hh"
 #include "TimingRole.hh"
 #include "Network.hh"
 #include "NetworkCmp.hh"
@@ -83,14 +86,25 @@ CheckTiming::check(bool no_input_delay,
 		   bool generated_clks)
 {
   clear();
+  // One pass over the top level pins classifies them for the
+  // input/output delay and unconstrained output checks instead of a
+  // separate full iteration per check.
+  PinSet no_arrival(network_);
+  PinSet no_departure(network_);
+  PinSet unconstrained_outputs(network_);
+  if (no_input_delay || no_output_delay || unconstrained_endpoints)
+    checkTopPins(no_input_delay, no_output_delay, unconstrained_endpoints,
+		 no_arrival, no_departure, unconstrained_outputs);
   if (no_input_delay)
-    checkNoInputDelay();
+    pushPinErrors("Warning: There %is %d input port%s missing set_input_delay.",
+		  no_arrival);
   if (no_output_delay)
-    checkNoOutputDelay();
+    pushPinErrors("Warning: There %is %d output port%s missing set_output_delay.",
+		  no_departure);
   if (reg_multiple_clks || reg_no_clks)
     checkRegClks(reg_multiple_clks, reg_no_clks);
   if (unconstrained_endpoints)
-    checkUnconstrainedEndpoints();
+    checkUnconstrainedEndpoints(unconstrained_outputs);
   if (loops)
     checkLoops();
   if (generated_clks)
@@ -98,49 +112,42 @@ CheckTiming::check(bool no_input_delay,
   return errors_;
 }
 
-// Make sure there is a set_input_delay for each input/bidirect.
+// Make sure there is a set_input_delay for each input/bidirect and a
+// set_output_delay for each output/bidirect, and find output ports
+// missing a clocked departure/arrival or max delay exception.
 void
-CheckTiming::checkNoInputDelay()
+CheckTiming::checkTopPins(bool no_input_delay,
+			  bool no_output_delay,
+			  bool unconstrained_endpoints,
+			  PinSet &no_arrival,
+			  PinSet &no_departure,
+			  PinSet &unconstrained_outputs)
 {
-  PinSet no_arrival(network_);
   Instance *top_inst = network_->topInstance();
   InstancePinIterator *pin_iter = network_->pinIterator(top_inst);
   while (pin_iter->hasNext()) {
-    const Pin *pin = pin_iter->next();
-    if (!sdc_->isClock(pin)) {
-      PortDirection *dir = network_->direction(pin);
-      if (dir->isAnyInput()
-	  && !sdc_->hasInputDelay(pin)
-          && !sim_->logicZeroOne(pin))
-	no_arrival.insert(pin);
-    }
-  }
-  delete pin_iter;
-  pushPinErrors("Warning: There %is %d input port%s missing set_input_delay.",
-		no_arrival);
-}
-
-void
-CheckTiming::checkNoOutputDelay()
-{
-  PinSet no_departure(network_);
-  checkNoOutputDelay(no_departure);
-  pushPinErrors("Warning: There %is %d output port%s missing set_output_delay.",
-		no_departure);
-}
-
-void
-CheckTiming::checkNoOutputDelay(PinSet &no_departure)
-{
-  Instance *top_inst = network_->topInstance();
-  InstancePinIterator *pin_iter = network_->pinIterator(top_inst);
-  while (pin_iter->hasNext()) {
-    const Pin *pin = pin_iter->next();
+    Pin *pin = pin_iter->next();
     PortDirection *dir = network_->direction(pin);
-    if (dir->isAnyOutput()
-	&& !sdc_->hasOutputDelay(pin)
-        && !sim_->logicZeroOne(pin))
-      no_departure.insert(pin);
+    if (no_input_delay
+	&& dir->isAnyInput()
+	&& !sdc_->isClock(pin)
+	&& !sdc_->hasInputDelay(pin)
+	&& !sim_->logicZeroOne(pin))
+      no_arrival.insert(pin);
+    if (dir->isAnyOutput()) {
+      if (no_output_delay
+	  && !sdc_->hasOutputDelay(pin)
+	  && !sim_->logicZeroOne(pin))
+	no_departure.insert(pin);
+      if (unconstrained_endpoints) {
+	Vertex *vertex = graph_->pinLoadVertex(pin);
+	if (!vertex->isConstant()
+	    && !((hasClkedDepature(pin)
+		  && hasClkedArrival(vertex))
+		 || hasMaxDelay(pin)))
+	  unconstrained_outputs.insert(pin);
+      }
+    }
   }
   delete pin_iter;
 }
@@ -226,35 +233,16 @@ CheckTiming::checkLoops()
   }
 }
 
+// unconstrained_ends arrives holding the unconstrained output ports
+// found by the top pin pass.
 void
-CheckTiming::checkUnconstrainedEndpoints()
+CheckTiming::checkUnconstrainedEndpoints(PinSet &unconstrained_ends)
 {
-  PinSet unconstrained_ends(network_);
-  checkUnconstrainedOutputs(unconstrained_ends);
   checkUnconstrainedSetups(unconstrained_ends);
   pushPinErrors("Warning: There %is %d unconstrained endpoint%s.",
 		unconstrained_ends);
 }
 
-void
-CheckTiming::checkUnconstrainedOutputs(PinSet &unconstrained_ends)
-{
-  Instance *top_inst = network_->topInstance();
-  InstancePinIterator *pin_iter = network_->pinIterator(top_inst);
-  while (pin_iter->hasNext()) {
-    Pin *pin = pin_iter->next();
-    PortDirection *dir = network_->direction(pin);
-    Vertex *vertex = graph_->pinLoadVertex(pin);
-    if (dir->isAnyOutput()
-	&& !vertex->isConstant()
-        && !((hasClkedDepature(pin)
-	      && hasClkedArrival(vertex))
-	     || hasMaxDelay(pin)))
-      unconstrained_ends.insert(pin);
-  }
-  delete pin_iter;
-}
-
 bool
 CheckTiming::hasClkedDepature(Pin *pin)
 {
@@ -285,22 +273,54 @@ CheckTiming::hasMaxDelay(Pin *pin)
   return false;
 }
 
+// This check visits every graph vertex, so sweep it with the
+// dispatch queue workers, each finding into its own set.
 void
 CheckTiming::checkUnconstrainedSetups(PinSet &unconstrained_ends)
 {
+  VertexSeq vertices;
+  vertices.reserve(graph_->vertexCount());
   VertexIterator vertex_iter(graph_);
-  while (vertex_iter.hasNext()) {
-    Vertex *vertex = vertex_iter.next();
-    if (!vertex->isConstant()) {
-      VertexInEdgeIterator edge_iter(vertex, graph_);
-      while (edge_iter.hasNext()) {
-        Edge *edge = edge_iter.next();
-        if (edge->role() == TimingRole::setup()
-            && (!search_->isClock(edge->from(graph_))
-                || !hasClkedArrival(edge->to(graph_)))) {
-          unconstrained_ends.insert(vertex->pin());
-          break;
-        }
+  while (vertex_iter.hasNext())
+    vertices.push_back(vertex_iter.next());
+  size_t vertex_count = vertices.size();
+  size_t thread_count = thread_count_;
+  if (dispatch_queue_ && thread_count > 1) {
+    std::vector<PinSet> found(thread_count, PinSet(network_));
+    size_t chunk_size = vertex_count / thread_count + 1;
+    size_t from = 0;
+    for (size_t k = 0; k < thread_count && from < vertex_count; k++) {
+      size_t to = std::min(from + chunk_size, vertex_count);
+      PinSet &ends = found[k];
+      dispatch_queue_->dispatch([this, &vertices, &ends, from, to](int) {
+	for (size_t i = from; i < to; i++)
+	  checkUnconstrainedSetups(vertices[i], ends);
+      });
+      from = to;
+    }
+    dispatch_queue_->finishTasks();
+    for (PinSet &ends : found)
+      unconstrained_ends.insertSet(&ends);
+  }
+  else {
+    for (Vertex *vertex : vertices)
+      checkUnconstrainedSetups(vertex, unconstrained_ends);
+  }
+}
+
+void
+CheckTiming::checkUnconstrainedSetups(Vertex *vertex,
+				      PinSet &unconstrained_ends)
+{
+  if (!vertex->isConstant()) {
+    VertexInEdgeIterator edge_iter(vertex, graph_);
+    while (edge_iter.hasNext()) {
+      Edge *edge = edge_iter.next();
+      if (edge->role() == TimingRole::setup()
+	  && (!search_->isClock(edge->from(graph_))
+	      || !hasClkedArrival(edge->to(graph_)))) {
+	unconstrained_ends.insert(vertex->pin());
+	break;
       }
     }
   }
@@ -52,15 +52,19 @@ public:
 protected:
   void clear();
   void deleteErrors();
-  void checkNoInputDelay();
-  void checkNoOutputDelay();
+  void checkTopPins(bool no_input_delay,
+		    bool no_output_delay,
+		    bool unconstrained_endpoints,
+		    PinSet &no_arrival,
+		    PinSet &no_departure,
+		    PinSet &unconstrained_outputs);
   void checkRegClks(bool reg_multiple_clks,
 		    bool reg_no_clks);
-  void checkUnconstrainedEndpoints();
+  void checkUnconstrainedEndpoints(PinSet &unconstrained_ends);
   bool hasClkedArrival(Vertex *vertex);
-  void checkNoOutputDelay(PinSet &ends);
-  void checkUnconstrainedOutputs(PinSet &unconstrained_ends);
   void checkUnconstrainedSetups(PinSet &unconstrained_ends);
+  void checkUnconstrainedSetups(Vertex *vertex,
+				PinSet &unconstrained_ends);
   void checkLoops();
   bool hasClkedDepature(Pin *pin);
   bool hasClkedCheck(Vertex *vertex);
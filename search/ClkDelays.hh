@@ -59,6 +59,10 @@ public:
                   Path *path,
                   bool include_internal_latency,
                   StaState *sta);
+  // Fold delays found by a worker thread into this one,
+  // keeping the worst latency for each transition pair.
+  void merge(const ClkDelays &delays,
+             const StaState *sta);
 
 private:
   static float insertionDelay(Path *clk_path,
@@ -33,6 +33,7 @@
 #include "Corner.hh"
 #include "Search.hh"
 #include "Tag.hh"
+#include "Path.hh"
 #include "PathAnalysisPt.hh"
 
 namespace sta {
@@ -52,7 +53,7 @@ ClkInfo::ClkInfo(const ClockEdge *clk_edge,
   clk_edge_(clk_edge),
   clk_src_(clk_src),
   gen_clk_src_(gen_clk_src),
-  crpr_clk_path_(is_propagated ? crpr_clk_path : nullptr),
+  crpr_clk_vertex_id_(vertex_id_null),
   uncertainties_(uncertainties),
   insertion_(insertion),
   latency_(latency),
@@ -61,8 +62,15 @@ ClkInfo::ClkInfo(const ClockEdge *clk_edge,
   crpr_path_refs_filter_(crpr_clk_path ? crpr_clk_path->tag(sta)->isFilter() : false),
   is_pulse_clk_(pulse_clk_sense != nullptr),
   pulse_clk_sense_(pulse_clk_sense ? pulse_clk_sense->index() : 0),
-  path_ap_index_(path_ap_index)
+  path_ap_index_(path_ap_index),
+  crpr_clk_tag_index_(tag_index_null)
 {
+  if (is_propagated
+      && crpr_clk_path
+      && !crpr_clk_path->isNull()) {
+    crpr_clk_vertex_id_ = crpr_clk_path->vertexId(sta);
+    crpr_clk_tag_index_ = crpr_clk_path->tagIndex(sta);
+  }
   findHash(sta);
 }
 
@@ -82,12 +90,9 @@ ClkInfo::findHash(const StaState *sta)
     hashIncr(hash_, network->vertexId(clk_src_));
   if (gen_clk_src_)
     hashIncr(hash_, network->vertexId(gen_clk_src_));
-  if (crpr_clk_path_.isNull())
-    hashIncr(hash_, vertex_id_null);
-  else {
-    hashIncr(hash_, crpr_clk_path_.vertexId(sta));
-    hashIncr(hash_, crpr_clk_path_.tag(sta)->hash(false, sta));
-  }
+  hashIncr(hash_, crpr_clk_vertex_id_);
+  if (crpr_clk_vertex_id_ != vertex_id_null)
+    hashIncr(hash_, crpr_clk_tag_index_);
 
   std::hash<float> hash_float;
   if (uncertainties_) {
@@ -109,34 +114,16 @@ ClkInfo::findHash(const StaState *sta)
   hashIncr(hash_, path_ap_index_);
 }
 
-VertexId
-ClkInfo::crprClkVertexId(const StaState *sta) const
-{
-  return crpr_clk_path_.vertexId(sta);
-}
-
 Path *
-ClkInfo::crprClkPath(const StaState *sta)
-{
-  return Path::vertexPath(crpr_clk_path_, sta);
-}
-
-const Path *
 ClkInfo::crprClkPath(const StaState *sta) const
 {
-  if (crpr_clk_path_.isNull())
+  if (crpr_clk_vertex_id_ == vertex_id_null)
     return nullptr;
-  else
-    return Path::vertexPath(crpr_clk_path_, sta);
-}
-
-const Path *
-ClkInfo::crprClkPathRaw() const
-{
-  if (crpr_clk_path_.isNull())
-    return nullptr;
-  else
-    return &crpr_clk_path_;
+  const Graph *graph = sta->graph();
+  const Search *search = sta->search();
+  const Vertex *vertex = graph->vertex(crpr_clk_vertex_id_);
+  Tag *tag = search->tag(crpr_clk_tag_index_);
+  return Path::vertexPath(vertex, tag, sta);
 }
 
 std::string
@@ -162,14 +149,17 @@ ClkInfo::to_string(const StaState *sta) const
     result += network->pathName(clk_src_);
   }
 
-  if (!crpr_clk_path_.isNull()) {
-    const Pin *crpr_clk_pin = crpr_clk_path_.vertex(sta)->pin();
+  if (crpr_clk_vertex_id_ != vertex_id_null) {
+    const Graph *graph = sta->graph();
+    const Search *search = sta->search();
+    const Pin *crpr_clk_pin = graph->vertex(crpr_clk_vertex_id_)->pin();
+    Tag *crpr_clk_tag = search->tag(crpr_clk_tag_index_);
     result += " crpr ";
     result += network->pathName(crpr_clk_pin);
     result += " ";
-    result += std::to_string(crpr_clk_path_.tag(sta)->index());
+    result += std::to_string(crpr_clk_tag_index_);
     result += "/";
-    result += crpr_clk_path_.minMax(sta)->to_string();
+    result += crpr_clk_tag->pathAnalysisPt(sta)->pathMinMax()->to_string();
   }
 
   if (is_gen_clk_src_path_)
@@ -304,11 +294,27 @@ ClkInfo::cmp(const ClkInfo *clk_info1,
 
   bool crpr_on = sta->crprActive();
   if (crpr_on) {
-    const Path *crpr_path1 = clk_info1->crprClkPathRaw();
-    const Path *crpr_path2 = clk_info2->crprClkPathRaw();
-    int path_cmp = Path::cmp(crpr_path1, crpr_path2, sta);
-    if (path_cmp != 0)
-      return path_cmp;
+    // Null crpr paths sort after non-null, matching Path::cmp.
+    bool has_crpr1 = clk_info1->hasCrprClkPin();
+    bool has_crpr2 = clk_info2->hasCrprClkPin();
+    if (!has_crpr1 && has_crpr2)
+      return 1;
+    if (has_crpr1 && !has_crpr2)
+      return -1;
+    if (has_crpr1 && has_crpr2) {
+      VertexId crpr_vertex1 = clk_info1->crprClkVertexId();
+      VertexId crpr_vertex2 = clk_info2->crprClkVertexId();
+      if (crpr_vertex1 < crpr_vertex2)
+	return -1;
+      if (crpr_vertex1 > crpr_vertex2)
+	return 1;
+      TagIndex crpr_tag_index1 = clk_info1->crprClkTagIndex();
+      TagIndex crpr_tag_index2 = clk_info2->crprClkTagIndex();
+      if (crpr_tag_index1 < crpr_tag_index2)
+	return -1;
+      if (crpr_tag_index1 > crpr_tag_index2)
+	return 1;
+    }
   }
 
   const ClockUncertainties *uncertainties1 = clk_info1->uncertainties();
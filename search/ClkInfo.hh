@@ -25,9 +25,10 @@
 #pragma once
 
 #include "Transition.hh"
+#include "GraphClass.hh"
+#include "VertexId.hh"
 #include "SearchClass.hh"
 #include "Sdc.hh"
-#include "Path.hh"
 
 namespace sta {
 
@@ -63,17 +64,17 @@ public:
   const Arrival &insertion() const { return insertion_; }
   ClockUncertainties *uncertainties() const { return uncertainties_; }
   PathAPIndex pathAPIndex() const { return path_ap_index_; }
-  // Clock path used for crpr resolution.
+  // Clock path used for crpr resolution, materialized from the paths
+  // stored on the clock vertex.
   // Null for clocks because the path cannot point to itself.
-  Path *crprClkPath(const StaState *sta);
-  const Path *crprClkPath(const StaState *sta) const;
-  VertexId crprClkVertexId(const StaState *sta) const;
-  bool hasCrprClkPin() const { return !crpr_clk_path_.isNull(); }
+  Path *crprClkPath(const StaState *sta) const;
+  VertexId crprClkVertexId() const { return crpr_clk_vertex_id_; }
+  TagIndex crprClkTagIndex() const { return crpr_clk_tag_index_; }
+  bool hasCrprClkPin() const { return crpr_clk_vertex_id_ != vertex_id_null; }
   // This clk_info/tag is used for a generated clock source path.
   bool isGenClkSrcPath() const { return is_gen_clk_src_path_; }
   size_t hash() const { return hash_; }
   bool crprPathRefsFilter() const { return crpr_path_refs_filter_; }
-  const Path *crprClkPathRaw() const;
 
   static int cmp(const ClkInfo *clk_info1,
 		 const ClkInfo *clk_info2,
@@ -88,7 +89,10 @@ private:
   const ClockEdge *clk_edge_;
   const Pin *clk_src_;
   const Pin *gen_clk_src_;
-  Path crpr_clk_path_;
+  // Crpr clock path as indices into the paths on the clock vertex.
+  // The clock tree paths are shared by construction, so there is no
+  // need to copy the path into each clk info.
+  VertexId crpr_clk_vertex_id_;
   ClockUncertainties *uncertainties_;
   Arrival insertion_;
   float latency_;
@@ -101,6 +105,7 @@ private:
   bool is_pulse_clk_:1;
   unsigned int pulse_clk_sense_:RiseFall::index_bit_count;
   unsigned int path_ap_index_:path_ap_index_bit_count;
+  TagIndex crpr_clk_tag_index_:tag_index_bit_count;
 };
 
 class ClkInfoLess
@@ -25,6 +25,7 @@
 #include "ClkLatency.hh"
 
 #include <algorithm>
+#include <vector>
 
 #include "Report.hh"
 #include "Debug.hh"
@@ -38,6 +39,7 @@
 #include "Search.hh"
 #include "PathAnalysisPt.hh"
 #include "ClkInfo.hh"
+#include "DispatchQueue.hh"
 
 namespace sta {
 
@@ -150,36 +152,76 @@ ClkLatency::findClkDelays(ConstClockSeq &clks,
   // Make entries for the relevant clocks to filter path clocks.
   for (const Clock *clk : clks)
     clk_delay_map[clk];
-  for (Vertex *clk_vertex : *graph_->regClkVertices()) {
-    VertexPathIterator path_iter(clk_vertex, this);
-    while (path_iter.hasNext()) {
-      Path *path = path_iter.next();
-      const ClockEdge *path_clk_edge = path->clkEdge(this);
-      const PathAnalysisPt *path_ap = path->pathAnalysisPt(this);
-      if (path_clk_edge
-          && (corner == nullptr
-              || path_ap->corner() == corner)) {
-        const Clock *path_clk = path_clk_edge->clock();
-        auto delays_itr = clk_delay_map.find(path_clk);
-        if (delays_itr != clk_delay_map.end()) {
-          ClkDelays &clk_delays = delays_itr->second;
-          const RiseFall *clk_rf = path_clk_edge->transition();
-          const MinMax *min_max = path->minMax(this);
-          const RiseFall *end_rf = path->transition(this);
-          Delay latency = ClkDelays::latency(path, this);
-          Delay clk_latency;
-          bool exists;
-          clk_delays.latency(clk_rf, end_rf, min_max, clk_latency, exists);
-          if (!exists || delayGreater(latency, clk_latency, min_max, this))
-            clk_delays.setLatency(clk_rf, end_rf, min_max, path,
-                                  include_internal_latency, this);
-        }
-      }
+  // Batch the clock vertices so the delay gathering can run on the
+  // thread pool with a per-thread delay map for each worker.
+  VertexSeq clk_vertices;
+  for (Vertex *clk_vertex : *graph_->regClkVertices())
+    clk_vertices.push_back(clk_vertex);
+  size_t vertex_count = clk_vertices.size();
+  size_t thread_count = threadCount();
+  if (thread_count <= 1
+      || vertex_count < thread_count) {
+    for (Vertex *clk_vertex : clk_vertices)
+      findClkDelays(clk_vertex, corner, include_internal_latency,
+                    clk_delay_map);
+  }
+  else {
+    std::vector<ClkDelayMap> maps(thread_count, clk_delay_map);
+    size_t chunk_size = vertex_count / thread_count + 1;
+    size_t from = 0;
+    for (size_t k = 0; k < thread_count && from < vertex_count; k++) {
+      size_t to = std::min(from + chunk_size, vertex_count);
+      dispatch_queue_->dispatch([this, &clk_vertices, &maps, corner,
+                                 include_internal_latency, k, from, to](int) {
+        for (size_t i = from; i < to; i++)
+          findClkDelays(clk_vertices[i], corner, include_internal_latency,
+                        maps[k]);
+      });
+      from = to;
+    }
+    dispatch_queue_->finishTasks();
+    // Merge in thread order so the reported paths are deterministic.
+    for (size_t k = 0; k < thread_count; k++) {
+      for (auto& [clk, delays] : maps[k])
+        clk_delay_map[clk].merge(delays, this);
     }
   }
   return clk_delay_map;
 }
 
+void
+ClkLatency::findClkDelays(Vertex *clk_vertex,
+                          const Corner *corner,
+                          bool include_internal_latency,
+                          ClkDelayMap &clk_delay_map)
+{
+  VertexPathIterator path_iter(clk_vertex, this);
+  while (path_iter.hasNext()) {
+    Path *path = path_iter.next();
+    const ClockEdge *path_clk_edge = path->clkEdge(this);
+    const PathAnalysisPt *path_ap = path->pathAnalysisPt(this);
+    if (path_clk_edge
+        && (corner == nullptr
+            || path_ap->corner() == corner)) {
+      const Clock *path_clk = path_clk_edge->clock();
+      auto delays_itr = clk_delay_map.find(path_clk);
+      if (delays_itr != clk_delay_map.end()) {
+        ClkDelays &clk_delays = delays_itr->second;
+        const RiseFall *clk_rf = path_clk_edge->transition();
+        const MinMax *min_max = path->minMax(this);
+        const RiseFall *end_rf = path->transition(this);
+        Delay latency = ClkDelays::latency(path, this);
+        Delay clk_latency;
+        bool exists;
+        clk_delays.latency(clk_rf, end_rf, min_max, clk_latency, exists);
+        if (!exists || delayGreater(latency, clk_latency, min_max, this))
+          clk_delays.setLatency(clk_rf, end_rf, min_max, path,
+                                include_internal_latency, this);
+      }
+    }
+  }
+}
+
 ////////////////////////////////////////////////////////////////
 
 ClkDelays::ClkDelays()
@@ -266,6 +308,36 @@ ClkDelays::setLatency(const RiseFall *src_rf,
   exists_[src_rf_index][end_rf_index][mm_index] = true;
 }
 
+void
+ClkDelays::merge(const ClkDelays &delays,
+                 const StaState *sta)
+{
+  for (auto src_rf_index : RiseFall::rangeIndex()) {
+    for (auto end_rf_index : RiseFall::rangeIndex()) {
+      for (const MinMax *min_max : MinMax::range()) {
+        int mm_index = min_max->index();
+        if (delays.exists_[src_rf_index][end_rf_index][mm_index]
+            && (!exists_[src_rf_index][end_rf_index][mm_index]
+                || delayGreater(delays.latency_[src_rf_index][end_rf_index][mm_index],
+                                latency_[src_rf_index][end_rf_index][mm_index],
+                                min_max, sta))) {
+          insertion_[src_rf_index][end_rf_index][mm_index] =
+            delays.insertion_[src_rf_index][end_rf_index][mm_index];
+          delay_[src_rf_index][end_rf_index][mm_index] =
+            delays.delay_[src_rf_index][end_rf_index][mm_index];
+          internal_latency_[src_rf_index][end_rf_index][mm_index] =
+            delays.internal_latency_[src_rf_index][end_rf_index][mm_index];
+          latency_[src_rf_index][end_rf_index][mm_index] =
+            delays.latency_[src_rf_index][end_rf_index][mm_index];
+          path_[src_rf_index][end_rf_index][mm_index] =
+            delays.path_[src_rf_index][end_rf_index][mm_index];
+          exists_[src_rf_index][end_rf_index][mm_index] = true;
+        }
+      }
+    }
+  }
+}
+
 Delay
 ClkDelays::latency(Path *clk_path,
                    StaState *sta)
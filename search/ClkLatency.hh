@@ -55,6 +55,10 @@ protected:
   ClkDelayMap findClkDelays(ConstClockSeq &clks,
                             const Corner *corner,
                             bool include_internal_latency);
+  void findClkDelays(Vertex *clk_vertex,
+                     const Corner *corner,
+                     bool include_internal_latency,
+                     ClkDelayMap &clk_delay_map);
   void reportClkLatency(const Clock *clk,
                         ClkDelays &clk_delays,
                         int digits);
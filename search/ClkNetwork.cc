@@ -24,10 +24,12 @@
 
 #include "ClkNetwork.hh"
 
+#include <algorithm>
+
 #include "Debug.hh"
+#include "DispatchQueue.hh"
 #include "Network.hh"
 #include "Graph.hh"
-#include "Bfs.hh"
 #include "Sdc.hh"
 #include "SearchPred.hh"
 #include "Search.hh"
@@ -50,12 +52,15 @@ ClkNetwork::ensureClkNetwork()
 {
   if (!clk_pins_valid_)
     findClkPins();
+  else if (!invalid_clks_.empty())
+    updateClkPins();
 }
 
 void
 ClkNetwork::clear()
 {
   clk_pins_valid_ = false;
+  invalid_clks_.clear();
   pin_clks_map_.clear();
   clk_pins_map_.deleteContentsClear();
   pin_ideal_clks_map_.clear();
@@ -66,30 +71,66 @@ ClkNetwork::clkPinsInvalid()
 {
   debugPrint(debug_, "clk_network", 1, "clk network invalid");
   clk_pins_valid_ = false;
+  invalid_clks_.clear();
+}
+
+void
+ClkNetwork::clkPinsInvalid(Clock *clk)
+{
+  if (clk_pins_valid_) {
+    debugPrint(debug_, "clk_network", 1, "clk network invalid %s",
+	       clk->name());
+    invalid_clks_.insert(clk);
+  }
+}
+
+// A pin edit invalidates the classification of the clocks that reach
+// the pin, leaving other clocks' pin sets intact.
+void
+ClkNetwork::pinInvalid(const Pin *pin)
+{
+  if (clk_pins_valid_
+      && isClock(pin)) {
+    const auto clks_itr = pin_clks_map_.find(pin);
+    if (clks_itr != pin_clks_map_.end()) {
+      for (Clock *clk : clks_itr->second)
+	clkPinsInvalid(clk);
+    }
+    else
+      // Register clock pin outside the classified cones; cannot tell
+      // which cone the edit touches.
+      clkPinsInvalid();
+  }
 }
 
 void
 ClkNetwork::deletePinBefore(const Pin *pin)
 {
-  if (isClock(pin))
-    clkPinsInvalid();
+  pinInvalid(pin);
 }
 
 void
 ClkNetwork::disconnectPinBefore(const Pin *pin)
 {
-  if (isClock(pin))
-    clkPinsInvalid();
+  pinInvalid(pin);
 }
 
 void
 ClkNetwork::connectPinAfter(const Pin *pin)
 {
-  if (isClock(pin))
-    clkPinsInvalid();
+  pinInvalid(pin);
+}
+
+void
+ClkNetwork::deleteClkBefore(Clock *clk)
+{
+  if (clk_pins_valid_) {
+    deleteClkPins(clk);
+    invalid_clks_.erase(clk);
+  }
 }
 
-class ClkSearchPred : public ClkTreeSearchPred
+class ClkSearchPred final : public ClkTreeSearchPred
 {
 public:
   ClkSearchPred(const StaState *sta);
@@ -113,50 +154,163 @@ ClkNetwork::findClkPins()
 {
   debugPrint(debug_, "clk_network", 1, "find clk network");
   clear();
-  findClkPins(false, pin_clks_map_);
-  findClkPins(true, pin_ideal_clks_map_);
+  ClockSeq &clks = sdc_->clks();
+  size_t clk_count = clks.size();
+  if (dispatch_queue_
+      && thread_count_ > 1
+      && clk_count > 1) {
+    // Each clock cone is searched independently into per-thread pin
+    // maps that are merged after the workers finish.
+    for (Clock *clk : clks)
+      clk_pins_map_[clk] = new PinSet(network_);
+    std::vector<PinClksMap> partial_clks(thread_count_);
+    std::vector<PinClksMap> partial_ideal_clks(thread_count_);
+    size_t chunk_size = clk_count / thread_count_ + 1;
+    size_t from = 0;
+    while (from < clk_count) {
+      size_t to = std::min(from + chunk_size, clk_count);
+      dispatch_queue_->dispatch([this, &clks, &partial_clks,
+				 &partial_ideal_clks, from, to](int i) {
+	for (size_t j = from; j < to; j++) {
+	  Clock *clk = clks[j];
+	  findClkPins(clk, clk_pins_map_.findKey(clk),
+		      partial_clks[i], partial_ideal_clks[i]);
+	}
+      });
+      from = to;
+    }
+    dispatch_queue_->finishTasks();
+    for (int i = 0; i < thread_count_; i++) {
+      mergePinClks(partial_clks[i], pin_clks_map_);
+      mergePinClks(partial_ideal_clks[i], pin_ideal_clks_map_);
+    }
+  }
+  else {
+    for (Clock *clk : clks) {
+      PinSet *clk_pins = new PinSet(network_);
+      clk_pins_map_[clk] = clk_pins;
+      findClkPins(clk, clk_pins, pin_clks_map_, pin_ideal_clks_map_);
+    }
+  }
   clk_pins_valid_ = true;
 }
 
+// Incremental update; reclassify only the invalid clocks' cones.
+void
+ClkNetwork::updateClkPins()
+{
+  for (Clock *clk : invalid_clks_) {
+    debugPrint(debug_, "clk_network", 1, "update clk network %s",
+	       clk->name());
+    deleteClkPins(clk);
+    PinSet *clk_pins = new PinSet(network_);
+    clk_pins_map_[clk] = clk_pins;
+    findClkPins(clk, clk_pins, pin_clks_map_, pin_ideal_clks_map_);
+  }
+  invalid_clks_.clear();
+}
+
+// Remove clk's cone from the classification maps.
 void
-ClkNetwork::findClkPins(bool ideal_only,
+ClkNetwork::deleteClkPins(const Clock *clk)
+{
+  PinSet *clk_pins = clk_pins_map_.findKey(clk);
+  if (clk_pins) {
+    for (const Pin *pin : *clk_pins) {
+      auto clks_itr = pin_clks_map_.find(pin);
+      if (clks_itr != pin_clks_map_.end()) {
+	clks_itr->second.erase(const_cast<Clock*>(clk));
+	if (clks_itr->second.empty())
+	  pin_clks_map_.erase(clks_itr);
+      }
+      clks_itr = pin_ideal_clks_map_.find(pin);
+      if (clks_itr != pin_ideal_clks_map_.end()) {
+	clks_itr->second.erase(const_cast<Clock*>(clk));
+	if (clks_itr->second.empty())
+	  pin_ideal_clks_map_.erase(clks_itr);
+      }
+    }
+    delete clk_pins;
+    clk_pins_map_.erase(clk);
+  }
+}
+
+void
+ClkNetwork::findClkPins(Clock *clk,
+			PinSet *clk_pins,
+			PinClksMap &pin_clks_map,
+			PinClksMap &pin_ideal_clks_map)
+{
+  findClkPins(clk, false, clk_pins, pin_clks_map);
+  if (!clk->isPropagated())
+    findClkPins(clk, true, clk_pins, pin_ideal_clks_map);
+}
+
+void
+ClkNetwork::findClkPins(Clock *clk,
+			bool ideal_only,
+			PinSet *clk_pins,
 			PinClksMap &pin_clks_map)
 {
   ClkSearchPred srch_pred(this);
-  BfsFwdIterator bfs(BfsIndex::other, &srch_pred, this);
-  for (Clock *clk : sdc_->clks()) {
+  UnorderedSet<Vertex*> visited;
+  for (const Pin *pin : clk->leafPins()) {
     if (!ideal_only
-	|| !clk->isPropagated()) {
-      PinSet *clk_pins = clk_pins_map_[clk];
-      if (clk_pins == nullptr) {
-        clk_pins = new PinSet(network_);
-        clk_pins_map_[clk] = clk_pins;
-      }
-      for (const Pin *pin : clk->leafPins()) {
-	if (!ideal_only
-	    || !sdc_->isPropagatedClock(pin)) {
-	  Vertex *vertex, *bidirect_drvr_vertex;
-	  graph_->pinVertices(pin, vertex, bidirect_drvr_vertex);
-	  bfs.enqueue(vertex);
-	  if (bidirect_drvr_vertex)
-	    bfs.enqueue(bidirect_drvr_vertex);
-	}
-      }
-      while (bfs.hasNext()) {
-	Vertex *vertex = bfs.next();
-	const Pin *pin = vertex->pin();
-	if (!ideal_only
-	    || !sdc_->isPropagatedClock(pin)) {
-	  clk_pins->insert(pin);
-	  ClockSet &pin_clks = pin_clks_map[pin];
-          pin_clks.insert(clk);
-	  bfs.enqueueAdjacentVertices(vertex);
-	}
+	|| !sdc_->isPropagatedClock(pin)) {
+      Vertex *vertex, *bidirect_drvr_vertex;
+      graph_->pinVertices(pin, vertex, bidirect_drvr_vertex);
+      if (visited.insert(vertex).second)
+	findClkPins1(clk, ideal_only, vertex, &srch_pred, visited,
+		     clk_pins, pin_clks_map);
+      if (bidirect_drvr_vertex
+	  && visited.insert(bidirect_drvr_vertex).second)
+	findClkPins1(clk, ideal_only, bidirect_drvr_vertex, &srch_pred,
+		     visited, clk_pins, pin_clks_map);
+    }
+  }
+}
+
+void
+ClkNetwork::findClkPins1(Clock *clk,
+			 bool ideal_only,
+			 Vertex *vertex,
+			 SearchPred *srch_pred,
+			 UnorderedSet<Vertex*> &visited,
+			 PinSet *clk_pins,
+			 PinClksMap &pin_clks_map)
+{
+  const Pin *pin = vertex->pin();
+  if (!ideal_only
+      || !sdc_->isPropagatedClock(pin)) {
+    clk_pins->insert(pin);
+    ClockSet &pin_clks = pin_clks_map[pin];
+    pin_clks.insert(clk);
+    if (srch_pred->searchFrom(vertex)) {
+      VertexOutEdgeIterator edge_iter(vertex, graph_);
+      while (edge_iter.hasNext()) {
+	Edge *edge = edge_iter.next();
+	Vertex *to = edge->to(graph_);
+	if (srch_pred->searchThru(edge)
+	    && srch_pred->searchTo(to)
+	    // Do not revisit shared fanout.
+	    && visited.insert(to).second)
+	  findClkPins1(clk, ideal_only, to, srch_pred, visited,
+		       clk_pins, pin_clks_map);
       }
     }
   }
 }
 
+void
+ClkNetwork::mergePinClks(const PinClksMap &from,
+			 PinClksMap &to)
+{
+  for (const auto& [pin, clks] : from) {
+    ClockSet &pin_clks = to[pin];
+    pin_clks.insert(clks.begin(), clks.end());
+  }
+}
+
 bool
 ClkNetwork::isClock(const Pin *pin) const
 {
@@ -293,13 +293,29 @@ ClkSkews::findClkSkew(ConstClockSeq &clks,
     clk_set_.insert(clk);
 
   if (thread_count_ > 1) {
+    // Chunk the register clock vertices so the clock path pre-filter
+    // runs on the workers instead of the dispatching thread. Several
+    // chunks per thread balance clock domains with skewed register
+    // counts; the results index by worker so any granularity works.
+    VertexSeq src_vertices;
+    src_vertices.reserve(graph_->regClkVertices()->size());
+    for (Vertex *src_vertex : *graph_->regClkVertices())
+      src_vertices.push_back(src_vertex);
+    size_t src_count = src_vertices.size();
     std::vector<ClkSkewMap> partial_skews(thread_count_);
-    for (Vertex *src_vertex : *graph_->regClkVertices()) {
-      if (hasClkPaths(src_vertex)) {
-        dispatch_queue_->dispatch([this, src_vertex, &partial_skews](int i) {
-          findClkSkewFrom(src_vertex, partial_skews[i]);
-        });
-      }
+    size_t chunk_size = src_count / (thread_count_ * 4) + 1;
+    size_t from = 0;
+    while (from < src_count) {
+      size_t to = std::min(from + chunk_size, src_count);
+      dispatch_queue_->dispatch([this, &src_vertices, &partial_skews,
+                                 from, to](int i) {
+        for (size_t j = from; j < to; j++) {
+          Vertex *src_vertex = src_vertices[j];
+          if (hasClkPaths(src_vertex))
+            findClkSkewFrom(src_vertex, partial_skews[i]);
+        }
+      });
+      from = to;
     }
     dispatch_queue_->finishTasks();
 
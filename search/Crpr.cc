@@ -24,10 +24,13 @@
 
 #include "Crpr.hh"
 
+#include <algorithm>
 #include <cmath> // abs
 #include <stdio.h>
 
 #include "Debug.hh"
+#include "Hash.hh"
+#include "Mutex.hh"
 #include "Vector.hh"
 #include "Network.hh"
 #include "Graph.hh"
@@ -48,11 +51,56 @@ namespace sta {
 using std::min;
 using std::abs;
 
+CrprPair::CrprPair(VertexId src_vertex_id,
+                   TagIndex src_tag_index,
+                   VertexId tgt_vertex_id,
+                   TagIndex tgt_tag_index,
+                   bool same_pin) :
+  src_vertex_id_(src_vertex_id),
+  src_tag_index_(src_tag_index),
+  tgt_vertex_id_(tgt_vertex_id),
+  tgt_tag_index_(tgt_tag_index),
+  same_pin_(same_pin)
+{
+}
+
+bool
+CrprPair::operator==(const CrprPair &pair2) const
+{
+  return src_vertex_id_ == pair2.src_vertex_id_
+    && src_tag_index_ == pair2.src_tag_index_
+    && tgt_vertex_id_ == pair2.tgt_vertex_id_
+    && tgt_tag_index_ == pair2.tgt_tag_index_
+    && same_pin_ == pair2.same_pin_;
+}
+
+size_t
+CrprPairHash::operator()(const CrprPair &pair) const
+{
+  size_t hash = hash_init_value;
+  hashIncr(hash, pair.src_vertex_id_);
+  hashIncr(hash, pair.src_tag_index_);
+  hashIncr(hash, pair.tgt_vertex_id_);
+  hashIncr(hash, pair.tgt_tag_index_);
+  hashIncr(hash, pair.same_pin_);
+  return hash;
+}
+
 CheckCrpr::CheckCrpr(StaState *sta) :
-  StaState(sta)
+  StaState(sta),
+  crpr_possible_valid_(false),
+  crpr_possible_stride_(0)
 {
 }
 
+void
+CheckCrpr::clear()
+{
+  LockGuard lock(crpr_map_lock_);
+  crpr_map_.clear();
+  crpr_possible_valid_.store(false, std::memory_order_release);
+}
+
 // Find the maximum possible crpr (clock min/max delta delay) for a
 // path from it's ClkInfo.
 Arrival
@@ -186,6 +234,22 @@ CheckCrpr::findCrpr(const Path *src_clk_path,
 {
   crpr = 0.0;
   crpr_pin = nullptr;
+  // Deep clock trees revisit the same clock path pairs for every
+  // path end, so memoize the resolved common point and crpr.
+  CrprPair pair(src_clk_path->vertexId(this),
+                src_clk_path->tag(this)->index(),
+                tgt_clk_path->vertexId(this),
+                tgt_clk_path->tag(this)->index(),
+                same_pin);
+  {
+    LockGuard lock(crpr_map_lock_);
+    auto itr = crpr_map_.find(pair);
+    if (itr != crpr_map_.end()) {
+      crpr = itr->second.first;
+      crpr_pin = itr->second.second;
+      return;
+    }
+  }
   const Path *src_clk_path1 = src_clk_path;
   const Path *tgt_clk_path1 = tgt_clk_path;
   if (src_clk_path1->clkInfo(this)->clkSrc()
@@ -243,6 +307,8 @@ CheckCrpr::findCrpr(const Path *src_clk_path,
     crpr = findCrpr1(src_clk_path2, tgt_clk_path2);
     crpr_pin = src_clk_path2->pin(this);
   }
+  LockGuard lock(crpr_map_lock_);
+  crpr_map_[pair] = {crpr, crpr_pin};
 }
 
 ConstPathSeq
@@ -374,8 +440,52 @@ bool
 CheckCrpr::crprPossible(const Clock *clk1,
 			const Clock *clk2)
 {
-  return clk1 && clk2
-    && !clk1->isVirtual()
+  if (clk1 == nullptr || clk2 == nullptr)
+    return false;
+  if (!crpr_possible_valid_.load(std::memory_order_acquire)) {
+    LockGuard lock(crpr_map_lock_);
+    if (!crpr_possible_valid_.load(std::memory_order_relaxed)) {
+      makeCrprPossibleMatrix();
+      crpr_possible_valid_.store(true, std::memory_order_release);
+    }
+  }
+  size_t index1 = clk1->index();
+  size_t index2 = clk2->index();
+  return (crpr_possible_bits_[index1 * crpr_possible_stride_ + index2 / 64]
+	  >> (index2 % 64)) & 1;
+}
+
+// Flatten crprPossible1 into a bit matrix indexed by clock index so
+// the per path end pair test is a load and a mask instead of a clock
+// pin set intersection.  Rebuilt by clear() when clocks change.
+void
+CheckCrpr::makeCrprPossibleMatrix()
+{
+  size_t clk_count = 0;
+  for (const Clock *clk : sdc_->clks())
+    clk_count = std::max(clk_count, static_cast<size_t>(clk->index()) + 1);
+  crpr_possible_stride_ = (clk_count + 63) / 64;
+  crpr_possible_bits_.assign(clk_count * crpr_possible_stride_, 0);
+  for (const Clock *clk1 : sdc_->clks()) {
+    for (const Clock *clk2 : sdc_->clks()) {
+      size_t index1 = clk1->index();
+      size_t index2 = clk2->index();
+      if (index1 <= index2
+	  && crprPossible1(clk1, clk2)) {
+	crpr_possible_bits_[index1 * crpr_possible_stride_ + index2 / 64]
+	  |= uint64_t(1) << (index2 % 64);
+	crpr_possible_bits_[index2 * crpr_possible_stride_ + index1 / 64]
+	  |= uint64_t(1) << (index1 % 64);
+      }
+    }
+  }
+}
+
+bool
+CheckCrpr::crprPossible1(const Clock *clk1,
+			 const Clock *clk2)
+{
+  return !clk1->isVirtual()
     && !clk2->isVirtual()
     // Generated clocks can have crpr in the source path.
     && (clk1 == clk2
@@ -24,7 +24,14 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
 #include "SdcClass.hh"
+#include "GraphClass.hh"
 #include "StaState.hh"
 #include "SearchClass.hh"
 
@@ -32,11 +39,42 @@ namespace sta {
 
 class CrprPaths;
 
+// Key identifying a (source, target) clock path pair for the crpr
+// memo.  The paths are named by vertex and tag so keys remain valid
+// when vertex path arrays are reallocated.
+class CrprPair
+{
+public:
+  CrprPair(VertexId src_vertex_id,
+           TagIndex src_tag_index,
+           VertexId tgt_vertex_id,
+           TagIndex tgt_tag_index,
+           bool same_pin);
+  bool operator==(const CrprPair &pair2) const;
+
+  VertexId src_vertex_id_;
+  TagIndex src_tag_index_;
+  VertexId tgt_vertex_id_;
+  TagIndex tgt_tag_index_;
+  bool same_pin_;
+};
+
+class CrprPairHash
+{
+public:
+  size_t operator()(const CrprPair &pair) const;
+};
+
+typedef std::unordered_map<CrprPair, std::pair<Crpr, Pin*>,
+                           CrprPairHash> CrprMap;
+
 // Clock Reconvergence Pessimism Removal.
 class CheckCrpr : public StaState
 {
 public:
   explicit CheckCrpr(StaState *sta);
+  // Invalidate memoized common points when clock arrivals change.
+  void clear();
 
   // Find the maximum possible crpr (clock min/max delta delay) for path.
   Arrival maxCrpr(const ClkInfo *clk_info);
@@ -76,6 +114,9 @@ private:
 			Pin *&crpr_pin);
   bool crprPossible(const Clock *clk1,
 		    const Clock *clk2);
+  bool crprPossible1(const Clock *clk1,
+		     const Clock *clk2);
+  void makeCrprPossibleMatrix();
   ConstPathSeq genClkSrcPaths(const Path *path);
   void findCrpr(const Path *src_clk_path,
 		const Path *tgt_clk_path,
@@ -89,6 +130,19 @@ private:
   Crpr findCrpr1(const Path *src_clk_path,
 		 const Path *tgt_clk_path);
   float crprArrivalDiff(const Path *path);
+
+  // Resolved common point and crpr for clock path pairs, memoized
+  // because deep clock trees revisit the same pairs for every path
+  // end.
+  CrprMap crpr_map_;
+  std::mutex crpr_map_lock_;
+  // crprPossible flattened into a bit matrix indexed by clock index,
+  // built lazily because it runs per path end and the clock pin
+  // intersection test walks pin sets.
+  std::atomic<bool> crpr_possible_valid_;
+  std::vector<uint64_t> crpr_possible_bits_;
+  // 64 bit words per bit matrix row.
+  size_t crpr_possible_stride_;
 };
 
 } // namespace
@@ -24,6 +24,10 @@
 
 #include "FindRegister.hh"
 
+#include <algorithm>
+
+#include "DispatchQueue.hh"
+#include "Mutex.hh"
 #include "TimingRole.hh"
 #include "FuncExpr.hh"
 #include "TimingArc.hh"
@@ -128,6 +132,9 @@ private:
 		      LibertyPort *clk,
 		      LibertyPort *d);
 
+  // Serializes the visit callbacks when the register clock vertex
+  // sweep is split across threads.
+  std::mutex visit_lock_;
 };
 
 FindRegVisitor::FindRegVisitor(StaState *sta) :
@@ -166,10 +173,37 @@ FindRegVisitor::visitRegs(ClockSet *clks,
     }
   }
   else {
-    for (Vertex *vertex : *graph_->regClkVertices()) {
-      visitRegs(vertex->pin(), TimingSense::positive_unate,
-		RiseFallBoth::riseFall(),
-		edge_triggered, latches);
+    // Sweep the register clock vertices, splitting the classification
+    // work across threads. The visit callbacks are serialized by
+    // visit_lock_ so the result sets need no other locking.
+    VertexSet *reg_clks = graph_->regClkVertices();
+    VertexSeq vertices;
+    vertices.reserve(reg_clks->size());
+    for (Vertex *vertex : *reg_clks)
+      vertices.push_back(vertex);
+    size_t vertex_count = vertices.size();
+    if (dispatch_queue_ && thread_count_ > 1 && vertex_count > 1) {
+      size_t chunk_size = vertex_count / thread_count_ + 1;
+      size_t from = 0;
+      for (int k = 0; from < vertex_count; k++) {
+	size_t to = std::min(from + chunk_size, vertex_count);
+	dispatch_queue_->dispatch([this, &vertices, from, to,
+				   edge_triggered, latches](int) {
+	  for (size_t i = from; i < to; i++)
+	    visitRegs(vertices[i]->pin(), TimingSense::positive_unate,
+		      RiseFallBoth::riseFall(),
+		      edge_triggered, latches);
+	});
+	from = to;
+      }
+      dispatch_queue_->finishTasks();
+    }
+    else {
+      for (Vertex *vertex : vertices) {
+	visitRegs(vertex->pin(), TimingSense::positive_unate,
+		  RiseFallBoth::riseFall(),
+		  edge_triggered, latches);
+      }
     }
   }
 }
@@ -221,13 +255,17 @@ FindRegVisitor::visitRegs(const Pin *clk_pin,
     if (!has_seqs)
       matches = findInferedSequential(cell, clk_sense, clk_rf,
 				      edge_triggered, latches);
-    if (matches)
+    if (matches) {
+      LockGuard lock(visit_lock_);
       visitReg(inst);
+    }
   }
-  else
+  else {
     // Do not require sequentials to match if the search is
     // not specific to edge triggered, latches, or clock edge.
+    LockGuard lock(visit_lock_);
     visitReg(inst);
+  }
 }
 
 void
@@ -248,6 +286,7 @@ FindRegVisitor::findSequential(const Pin *clk_pin,
     if ((seq->isRegister() && edge_triggered)
 	|| (seq->isLatch() && latches)) {
       if (clk_rf == RiseFallBoth::riseFall()) {
+	LockGuard lock(visit_lock_);
 	visitSequential(inst, seq);
 	matches = true;
 	break;
@@ -261,6 +300,7 @@ FindRegVisitor::findSequential(const Pin *clk_pin,
 	     && clk_rf == RiseFallBoth::rise())
 	    || (path_sense == TimingSense::negative_unate
 		&& clk_rf == RiseFallBoth::fall())) {
+	  LockGuard lock(visit_lock_);
 	  visitSequential(inst, seq);
 	  matches = true;
 	  break;
@@ -541,13 +581,8 @@ FindRegClkPins::matchPin(Pin *pin)
   // Liberty port clock attribute is not present in latches (for nlc18 anyway).
   LibertyPort *port = network_->libertyPort(pin);
   LibertyCell *cell = port->libertyCell();
-  for (TimingArcSet *arc_set : cell->timingArcSets(port, nullptr)) {
-    const TimingRole *role = arc_set->role();
-    if (role == TimingRole::regClkToQ()
-        || role == TimingRole::latchEnToQ())
-      return true;
-  }
-  return false;
+  return !cell->timingArcSets(port, nullptr, TimingRole::regClkToQ()).empty()
+    || !cell->timingArcSets(port, nullptr, TimingRole::latchEnToQ()).empty();
 }
 
 
@@ -597,12 +632,7 @@ FindRegAsyncPins::matchPin(Pin *pin)
 {
   LibertyPort *port = network_->libertyPort(pin);
   LibertyCell *cell = port->libertyCell();
-  for (TimingArcSet *arc_set : cell->timingArcSets(port, nullptr)) {
-    const TimingRole *role = arc_set->role();
-    if (role == TimingRole::regSetClr())
-      return true;
-  }
-  return false;
+  return !cell->timingArcSets(port, nullptr, TimingRole::regSetClr()).empty();
 }
 
 PinSet
@@ -644,14 +674,9 @@ FindRegOutputPins::matchPin(Pin *pin)
 {
   LibertyPort *port = network_->libertyPort(pin);
   LibertyCell *cell = port->libertyCell();
-  for (TimingArcSet *arc_set : cell->timingArcSets(nullptr, port)) {
-    const TimingRole *role = arc_set->role();
-    if (role == TimingRole::regClkToQ()
-	|| role == TimingRole::latchEnToQ()
-	|| role == TimingRole::latchDtoQ())
-      return true;
-  }
-  return false;
+  return !cell->timingArcSets(nullptr, port, TimingRole::regClkToQ()).empty()
+    || !cell->timingArcSets(nullptr, port, TimingRole::latchEnToQ()).empty()
+    || !cell->timingArcSets(nullptr, port, TimingRole::latchDtoQ()).empty();
 }
 
 void
@@ -26,6 +26,7 @@
 
 #include "FuncExpr.hh"
 #include "Liberty.hh"
+#include "Mutex.hh"
 #include "PortDirection.hh"
 #include "Network.hh"
 #include "Graph.hh"
@@ -39,6 +40,16 @@ GatedClk::GatedClk(const StaState *sta) :
 {
 }
 
+// The cached results key liberty function expressions, so drop them
+// when the search state is cleared; reread libraries can reuse the
+// addresses.
+void
+GatedClk::clear()
+{
+  LockGuard lock(clk_gate_func_lock_);
+  clk_gate_func_map_.clear();
+}
+
 bool
 GatedClk::isGatedClkEnable(Vertex *vertex) const
 {
@@ -170,6 +181,31 @@ GatedClk::isClkGatingFunc(FuncExpr *func,
 			  LibertyPort *clk_port,
 			  bool &is_clk_gate,
 			  LogicValue &logic_value) const
+{
+  // The result depends only on the cell function, so one cached
+  // entry serves every instance of the cell.
+  ClkGateFuncKey key(func, enable_port, clk_port);
+  {
+    LockGuard lock(clk_gate_func_lock_);
+    auto iter = clk_gate_func_map_.find(key);
+    if (iter != clk_gate_func_map_.end()) {
+      is_clk_gate = iter->second.first;
+      logic_value = iter->second.second;
+      return;
+    }
+  }
+  logic_value = LogicValue::unknown;
+  isClkGatingFunc1(func, enable_port, clk_port, is_clk_gate, logic_value);
+  LockGuard lock(clk_gate_func_lock_);
+  clk_gate_func_map_[key] = std::pair(is_clk_gate, logic_value);
+}
+
+void
+GatedClk::isClkGatingFunc1(FuncExpr *func,
+			   LibertyPort *enable_port,
+			   LibertyPort *clk_port,
+			   bool &is_clk_gate,
+			   LogicValue &logic_value) const
 {
   // The function should be in two-level SOP or POS form depending on "cost".
   // We need to apply literal cofactor if any input port is constant and
@@ -24,6 +24,10 @@
 
 #pragma once
 
+#include <mutex>
+#include <tuple>
+
+#include "Map.hh"
 #include "SdcClass.hh"
 #include "GraphClass.hh"
 #include "SearchClass.hh"
@@ -32,11 +36,17 @@
 namespace sta {
 
 typedef Set<FuncExpr*> FuncExprSet;
+// Clock gating is a property of the liberty cell function, so the
+// analysis result is shared by every instance of the cell.
+typedef std::tuple<const FuncExpr*, const LibertyPort*,
+		   const LibertyPort*> ClkGateFuncKey;
+typedef Map<ClkGateFuncKey, std::pair<bool, LogicValue>> ClkGateFuncMap;
 
 class GatedClk : public StaState
 {
 public:
   GatedClk(const StaState *sta);
+  void clear();
 
   bool isGatedClkEnable(Vertex *vertex) const;
   void isGatedClkEnable(Vertex *enable_vertex,
@@ -55,9 +65,17 @@ protected:
 		       LibertyPort *clk_port,
 		       bool &is_clk_gate,
 		       LogicValue &logic_value) const;
+  void isClkGatingFunc1(FuncExpr *func,
+			LibertyPort *enable_port,
+			LibertyPort *clk_port,
+			bool &is_clk_gate,
+			LogicValue &logic_value) const;
   void functionClkOperands(FuncExpr *root_expr,
 			   FuncExpr *curr_expr,
 			   FuncExprSet &funcs) const;
+
+  mutable ClkGateFuncMap clk_gate_func_map_;
+  mutable std::mutex clk_gate_func_lock_;
 };
 
 } // namespace
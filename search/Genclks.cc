@@ -43,6 +43,7 @@
 #include "Path.hh"
 #include "Search.hh"
 #include "Variables.hh"
+#include "DispatchQueue.hh"
 
 namespace sta {
 
@@ -53,13 +54,13 @@ class GenclkInfo
 public:
   GenclkInfo(Clock *gclk,
 	     Level gclk_level,
-	     VertexSet *fanins,
-	     FilterPath *src_filter);
+	     VertexSet *fanins);
   ~GenclkInfo();
   EdgeSet *fdbkEdges() const { return fdbk_edges_; }
   VertexSet *fanins() const { return fanins_; }
   Level gclkLevel() const { return gclk_level_; }
   FilterPath *srcFilter() const { return src_filter_; }
+  void setSrcFilter(FilterPath *src_filter);
   void setLatchFdbkEdges(EdgeSet *fdbk_edges);
   bool foundLatchFdbkEdges() const { return found_latch_fdbk_edges_; }
   void setFoundLatchFdbkEdges(bool found);
@@ -75,14 +76,13 @@ protected:
 
 GenclkInfo::GenclkInfo(Clock *gclk,
 		       Level gclk_level,
-		       VertexSet *fanins,
-		       FilterPath *src_filter) :
+		       VertexSet *fanins) :
   gclk_(gclk),
   gclk_level_(gclk_level),
   fanins_(fanins),
   fdbk_edges_(nullptr),
   found_latch_fdbk_edges_(false),
-  src_filter_(src_filter)
+  src_filter_(nullptr)
 {
 }
 
@@ -93,6 +93,12 @@ GenclkInfo::~GenclkInfo()
   delete src_filter_;
 }
 
+void
+GenclkInfo::setSrcFilter(FilterPath *src_filter)
+{
+  src_filter_ = src_filter;
+}
+
 void
 GenclkInfo::setLatchFdbkEdges(EdgeSet *fdbk_edges)
 {
@@ -110,6 +116,7 @@ GenclkInfo::setFoundLatchFdbkEdges(bool found)
 Genclks::Genclks(StaState *sta) :
   StaState(sta),
   found_insertion_delays_(false),
+  genclk_src_paths_(16, ClockPinPairHash(network_), ClockPinPairEqual()),
   vertex_src_paths_map_(graph_)
 {
 }
@@ -212,12 +219,7 @@ Genclks::ensureInsertionDelays()
     // insertion delay, so sort the clocks by source pin level.
     sort(gclks, ClockPinMaxLevelLess(this));
 
-    for (Clock *gclk : gclks) {
-      if (gclk->masterClk()) {
-	findInsertionDelays(gclk);
-	recordSrcPaths(gclk);
-      }
-    }
+    findInsertionDelays(gclks);
 
     stats.report("Find generated clk insertion delays");
     found_insertion_delays_ = true;
@@ -362,7 +364,7 @@ Genclks::seedSrcPins(Clock *clk,
 //  search thru constants
 //  respect generated clock combinational attribute
 //  search thru disabled loop arcs
-class GenClkFaninSrchPred : public GenClkMasterSearchPred
+class GenClkFaninSrchPred final : public GenClkMasterSearchPred
 {
 public:
   explicit GenClkFaninSrchPred(Clock *gclk,
@@ -443,7 +445,7 @@ Genclks::seedClkVertices(Clock *clk,
 
 ////////////////////////////////////////////////////////////////
 
-class GenClkInsertionSearchPred : public SearchPred0, public DynLoopSrchPred
+class GenClkInsertionSearchPred final : public SearchPred0, public DynLoopSrchPred
 {
 public:
   GenClkInsertionSearchPred(Clock *gclk,
@@ -518,33 +520,105 @@ GenClkInsertionSearchPred::isNonGeneratedClkPin(const Pin *pin) const
 
 ////////////////////////////////////////////////////////////////
 
+// The insertion delay searches write their arrivals into the graph
+// and share the bfs in-queue flags, so two searches can only run
+// concurrently when their fanin cones have no vertices in common.
+// Take the clocks in level order and greedily batch clocks with
+// disjoint cones; a clock derived from another generated clock
+// overlaps its master's cone, which defers it to a batch after the
+// master's source paths have been recorded.
+void
+Genclks::findInsertionDelays(ClockSeq &gclks)
+{
+  ClockSeq pending;
+  for (Clock *gclk : gclks) {
+    if (gclk->masterClk()) {
+      makeGenclkInfo(gclk);
+      pending.push_back(gclk);
+    }
+  }
+  while (!pending.empty()) {
+    ClockSeq batch;
+    ClockSeq deferred;
+    VertexSet batch_fanins(graph_);
+    for (Clock *gclk : pending) {
+      VertexSet *fanins = genclkInfo(gclk)->fanins();
+      bool disjoint = true;
+      for (Vertex *fanin : *fanins) {
+	if (batch_fanins.hasKey(fanin)) {
+	  disjoint = false;
+	  break;
+	}
+      }
+      if (disjoint) {
+	batch.push_back(gclk);
+	batch_fanins.insert(fanins->begin(), fanins->end());
+      }
+      else
+	deferred.push_back(gclk);
+    }
+    // Exception creation modifies sdc, so make the batch filters
+    // before the searches run on the workers.
+    for (Clock *gclk : batch)
+      genclkInfo(gclk)->setSrcFilter(makeSrcFilter(gclk));
+    if (thread_count_ <= 1
+	|| batch.size() == 1) {
+      for (Clock *gclk : batch)
+	findInsertionDelays(gclk);
+    }
+    else {
+      for (Clock *gclk : batch)
+	dispatch_queue_->dispatch([this, gclk](int) {
+	  findInsertionDelays(gclk);
+	});
+      dispatch_queue_->finishTasks();
+    }
+    for (Clock *gclk : batch) {
+      // Unregister the filter so that it is not triggered by other searches.
+      // The exception itself has to stick around because the source path
+      // tags reference it.
+      sdc_->unrecordException(genclkInfo(gclk)->srcFilter());
+    }
+    for (Clock *gclk : batch)
+      recordSrcPaths(gclk);
+    pending = std::move(deferred);
+  }
+}
+
 void
 Genclks::findInsertionDelays(Clock *gclk)
 {
   debugPrint(debug_, "genclk", 2, "find gen clk %s insertion",
              gclk->name());
-  GenclkInfo *genclk_info = makeGenclkInfo(gclk);
+  GenclkInfo *genclk_info = genclkInfo(gclk);
   FilterPath *src_filter = genclk_info->srcFilter();
   GenClkInsertionSearchPred srch_pred(gclk, nullptr, genclk_info, this);
   BfsFwdIterator insert_iter(BfsIndex::other, &srch_pred, this);
   seedSrcPins(gclk, src_filter, insert_iter);
   // Propagate arrivals to generated clk root pin level.
   findSrcArrivals(gclk, insert_iter, genclk_info);
-  // Unregister the filter so that it is not triggered by other searches.
-  // The exception itself has to stick around because the source path
-  // tags reference it.
-  sdc_->unrecordException(src_filter);
 }
 
 GenclkInfo *
 Genclks::makeGenclkInfo(Clock *gclk)
 {
-  FilterPath *src_filter = makeSrcFilter(gclk);
   Level gclk_level = clkPinMaxLevel(gclk);
-  VertexSet *fanins = new VertexSet(graph_);
-  findFanin(gclk, fanins);
-  GenclkInfo *genclk_info = new GenclkInfo(gclk, gclk_level, fanins,
-                                           src_filter);
+  // Clocks rooted on the same pins have identical fanin cones, so
+  // copy a previously searched cone instead of repeating the backward
+  // search.
+  VertexSet *fanins = nullptr;
+  for (const auto [clk, genclk_info] : genclk_info_map_) {
+    if (clk->combinational() == gclk->combinational()
+	&& clk->leafPins() == gclk->leafPins()) {
+      fanins = new VertexSet(*genclk_info->fanins());
+      break;
+    }
+  }
+  if (fanins == nullptr) {
+    fanins = new VertexSet(graph_);
+    findFanin(gclk, fanins);
+  }
+  GenclkInfo *genclk_info = new GenclkInfo(gclk, gclk_level, fanins);
   genclk_info_map_.insert(gclk, genclk_info);
   return genclk_info;
 }
@@ -719,7 +793,7 @@ Genclks::makeTag(const Clock *gclk,
 			  nullptr, false, states, true, nullptr);
 }
 
-class GenClkArrivalSearchPred : public EvalPred
+class GenClkArrivalSearchPred final : public EvalPred
 {
 public:
   GenClkArrivalSearchPred(Clock *gclk,
@@ -876,6 +950,7 @@ Genclks::copyGenClkSrcPaths(Vertex *vertex,
 void
 Genclks::clearSrcPaths()
 {
+  search_->incrPathGeneration();
   for (auto const & [clk_pin, src_paths] : genclk_src_paths_) {
     for (const Path &src_path : src_paths)
       delete src_path.prevPath();
@@ -933,6 +1008,7 @@ Genclks::recordSrcPaths(Clock *gclk)
                      rf->to_string().c_str(),
                      delayAsString(path->arrival(), this));
           // If this path is replacing another one delete the previous one.
+          search_->incrPathGeneration();
           delete src_path.prevPath();
           src_path = *path;
           Path *prev_copy = &src_path;
@@ -1082,16 +1158,6 @@ ClockPinPairLess::operator()(const ClockPinPair &pair1,
 	      && pin1 < pin2));
 }
 
-class ClockPinPairHash
-{
-public:
-  ClockPinPairHash(const Network *network);
-  size_t operator()(const ClockPinPair &pair) const;
-
-private:
-  const Network *network_;
-};
-
 ClockPinPairHash::ClockPinPairHash(const Network *network) :
   network_(network)
 {
@@ -1103,13 +1169,6 @@ ClockPinPairHash::operator()(const ClockPinPair &pair) const
   return hashSum(pair.first->index(), network_->id(pair.second));
 }
 
-class ClockPinPairEqual
-{
-public:
-  bool operator()(const ClockPinPair &pair1,
-		  const ClockPinPair &pair2) const;
-};
-
 bool
 ClockPinPairEqual::operator()(const ClockPinPair &pair1,
 			      const ClockPinPair &pair2) const
@@ -25,6 +25,7 @@
 #pragma once
 
 #include "Map.hh"
+#include "UnorderedMap.hh"
 #include "Transition.hh"
 #include "NetworkClass.hh"
 #include "Graph.hh"
@@ -49,8 +50,28 @@ public:
 		  const ClockPinPair &pair2) const;
 };
 
+class ClockPinPairHash
+{
+public:
+  ClockPinPairHash(const Network *network);
+  size_t operator()(const ClockPinPair &pair) const;
+
+private:
+  const Network *network_;
+};
+
+class ClockPinPairEqual
+{
+public:
+  bool operator()(const ClockPinPair &pair1,
+		  const ClockPinPair &pair2) const;
+};
+
 typedef Map<Clock*, GenclkInfo*> GenclkInfoMap;
-typedef Map<ClockPinPair, std::vector<Path>, ClockPinPairLess> GenclkSrcPathMap;
+// Hashed so the per-evaluation source path lookups from crpr,
+// reporting and clock latency are O(1).
+typedef UnorderedMap<ClockPinPair, std::vector<Path>,
+		     ClockPinPairHash, ClockPinPairEqual> GenclkSrcPathMap;
 typedef std::map<Vertex*, std::vector<const Path*>, VertexIdLess> VertexGenclkSrcPathsMap;
 
 class Genclks : public StaState
@@ -87,7 +108,7 @@ public:
 			  TagGroupBldr *tag_bldr);
 
 private:
-  void findInsertionDelays();
+  void findInsertionDelays(ClockSeq &gclks);
   GenclkInfo *genclkInfo(const Clock *gclk) const;
   void clearSrcPaths();
   void recordSrcPaths(Clock *gclk);
@@ -29,7 +29,9 @@
 
 #include "Report.hh"
 #include "Debug.hh"
+#include "DispatchQueue.hh"
 #include "Stats.hh"
+#include "Profile.hh"
 #include "TimingRole.hh"
 #include "PortDirection.hh"
 #include "Network.hh"
@@ -117,6 +119,7 @@ Levelize::ensureLevelized()
 void
 Levelize::levelize()
 {
+  ProfilePhase phase("Levelize");
   Stats stats(debug_, report_);
   debugPrint(debug_, "levelize", 1, "levelize");
   clear();
@@ -349,11 +352,91 @@ VertexSeq
 Levelize::findTopologicalOrder()
 {
   Stats stats(debug_, report_);
-  std::map<Vertex*, int> in_degree;
-
+  // Collect the vertices so the in-degree counts can be found in
+  // parallel chunks; the counts are indexed by vertex ID so the
+  // frontier threads can decrement them atomically.
+  VertexSeq vertices;
+  VertexId max_id = 0;
   VertexIterator vertex_iter(graph_);
   while (vertex_iter.hasNext()) {
     Vertex *vertex = vertex_iter.next();
+    vertices.push_back(vertex);
+    max_id = max(max_id, graph_->id(vertex));
+  }
+  std::vector<std::atomic<int>> in_degree(max_id + 1);
+  findInDegrees(vertices, in_degree);
+
+  // Kahn's algorithm, level synchronous so each frontier can be
+  // expanded across threads.
+  VertexSeq topo_order;
+  topo_order.reserve(vertices.size());
+  VertexSeq frontier;
+  for (Vertex *root : roots_)
+    frontier.push_back(root);
+  while (!frontier.empty()) {
+    topo_order.insert(topo_order.end(), frontier.begin(), frontier.end());
+    frontier = expandFrontier(frontier, in_degree);
+  }
+
+  if (debug_->check("levelize", 1)) {
+    for (Vertex *vertex : vertices) {
+      if (in_degree[graph_->id(vertex)].load(std::memory_order_relaxed) != 0)
+        debugPrint(debug_, "levelize", 2, "topological sort missing %s",
+                   vertex->to_string(this).c_str());
+    }
+  }
+  if (debug_->check("levelize", 3)) {
+    report_->reportLine("Topological sort");
+    for (Vertex *vertex : topo_order)
+      report_->reportLine("%s", vertex->to_string(this).c_str());
+  }
+  stats.report("Levelize topological sort");
+  return topo_order;
+}
+
+void
+Levelize::findInDegrees(const VertexSeq &vertices,
+                        std::vector<std::atomic<int>> &in_degree)
+{
+  size_t vertex_count = vertices.size();
+  size_t thread_count = thread_count_;
+  if (thread_count_ <= 1
+      || vertex_count < thread_count) {
+    EdgeSeq latch_d_to_q_edges;
+    findInDegrees(vertices, 0, vertex_count, in_degree, latch_d_to_q_edges);
+    for (Edge *edge : latch_d_to_q_edges)
+      latch_d_to_q_edges_.insert(edge);
+  }
+  else {
+    std::vector<EdgeSeq> latch_d_to_q_edges(thread_count);
+    size_t from = 0;
+    size_t chunk_size = vertex_count / thread_count;
+    for (size_t k = 0; k < thread_count; k++) {
+      // Last thread gets the left overs.
+      size_t to = (k == thread_count - 1) ? vertex_count : from + chunk_size;
+      dispatch_queue_->dispatch([=, &vertices, &in_degree,
+                                 &latch_d_to_q_edges](int) {
+        findInDegrees(vertices, from, to, in_degree, latch_d_to_q_edges[k]);
+      });
+      from = to;
+    }
+    dispatch_queue_->finishTasks();
+    for (const EdgeSeq &latch_edges : latch_d_to_q_edges) {
+      for (Edge *edge : latch_edges)
+        latch_d_to_q_edges_.insert(edge);
+    }
+  }
+}
+
+void
+Levelize::findInDegrees(const VertexSeq &vertices,
+                        size_t from,
+                        size_t to,
+                        std::vector<std::atomic<int>> &in_degree,
+                        EdgeSeq &latch_d_to_q_edges)
+{
+  for (size_t i = from; i < to; i++) {
+    Vertex *vertex = vertices[i];
     if (search_pred_.searchFrom(vertex)) {
       VertexOutEdgeIterator edge_iter(vertex, graph_);
       while (edge_iter.hasNext()) {
@@ -361,43 +444,78 @@ Levelize::findTopologicalOrder()
         Vertex *to_vertex = edge->to(graph_);
         if (search_pred_.searchThru(edge)
             && search_pred_.searchTo(to_vertex))
-          in_degree[to_vertex] += 1;
+          in_degree[graph_->id(to_vertex)].fetch_add(1,
+                                                     std::memory_order_relaxed);
         if (edge->role() == TimingRole::latchDtoQ())
-          latch_d_to_q_edges_.insert(edge);
+          latch_d_to_q_edges.push_back(edge);
       }
       // Levelize bidirect driver as if it was a fanout of the bidirect load.
       const Pin *pin = vertex->pin();
       if (graph_delay_calc_->bidirectDrvrSlewFromLoad(pin)
           && !vertex->isBidirectDriver()) {
-        Vertex *to_vertex = graph_->pinDrvrVertex(pin);;
+        Vertex *to_vertex = graph_->pinDrvrVertex(pin);
         if (search_pred_.searchTo(to_vertex))
-          in_degree[to_vertex] += 1;
+          in_degree[graph_->id(to_vertex)].fetch_add(1,
+                                                     std::memory_order_relaxed);
       }
     }
   }
+}
 
-  std::deque<Vertex*> queue;
-  for (Vertex *root : roots_)
-    queue.push_back(root);
+VertexSeq
+Levelize::expandFrontier(const VertexSeq &frontier,
+                         std::vector<std::atomic<int>> &in_degree)
+{
+  size_t vertex_count = frontier.size();
+  size_t thread_count = thread_count_;
+  if (thread_count_ <= 1
+      || vertex_count < thread_count) {
+    VertexSeq next_frontier;
+    expandFrontier(frontier, 0, vertex_count, in_degree, next_frontier);
+    return next_frontier;
+  }
+  else {
+    std::vector<VertexSeq> next_frontiers(thread_count);
+    size_t from = 0;
+    size_t chunk_size = vertex_count / thread_count;
+    for (size_t k = 0; k < thread_count; k++) {
+      // Last thread gets the left overs.
+      size_t to = (k == thread_count - 1) ? vertex_count : from + chunk_size;
+      dispatch_queue_->dispatch([=, &frontier, &in_degree,
+                                 &next_frontiers](int) {
+        expandFrontier(frontier, from, to, in_degree, next_frontiers[k]);
+      });
+      from = to;
+    }
+    dispatch_queue_->finishTasks();
+    VertexSeq next_frontier;
+    for (const VertexSeq &thread_frontier : next_frontiers)
+      next_frontier.insert(next_frontier.end(), thread_frontier.begin(),
+                           thread_frontier.end());
+    return next_frontier;
+  }
+}
 
-  VertexSeq topo_order;
-  while (!queue.empty()) {
-    Vertex *vertex = queue.front();
-    queue.pop_front();
-    topo_order.push_back(vertex);
+void
+Levelize::expandFrontier(const VertexSeq &frontier,
+                         size_t from,
+                         size_t to,
+                         std::vector<std::atomic<int>> &in_degree,
+                         VertexSeq &next_frontier)
+{
+  for (size_t i = from; i < to; i++) {
+    Vertex *vertex = frontier[i];
     if (search_pred_.searchFrom(vertex)) {
       VertexOutEdgeIterator edge_iter(vertex, graph_);
       while (edge_iter.hasNext()) {
         Edge *edge = edge_iter.next();
         Vertex *to_vertex = edge->to(graph_);
         if (search_pred_.searchThru(edge)
-            && search_pred_.searchTo(to_vertex)) {
-          const auto &to_degree_itr = in_degree.find(to_vertex);
-          int &to_in_degree = to_degree_itr->second;
-          to_in_degree -= 1;
-          if (to_in_degree == 0)
-            queue.push_back(to_vertex);
-        }
+            && search_pred_.searchTo(to_vertex)
+            // The last arriving fanin queues the vertex.
+            && in_degree[graph_->id(to_vertex)].fetch_sub(
+                 1, std::memory_order_relaxed) == 1)
+          next_frontier.push_back(to_vertex);
       }
     }
     // Levelize bidirect driver as if it was a fanout of the bidirect load.
@@ -405,32 +523,12 @@ Levelize::findTopologicalOrder()
     if (graph_delay_calc_->bidirectDrvrSlewFromLoad(pin)
         && !vertex->isBidirectDriver()) {
       Vertex *to_vertex = graph_->pinDrvrVertex(pin);
-      if (search_pred_.searchTo(to_vertex)) {
-        const auto &degree_itr = in_degree.find(to_vertex);
-        int &in_degree = degree_itr->second;
-        in_degree -= 1;
-        if (in_degree == 0)
-          queue.push_back(to_vertex);
-      }
-    }
-  }
-
-  if (debug_->check("levelize", 1)) {
-    VertexIterator vertex_iter(graph_);
-    while (vertex_iter.hasNext()) {
-      Vertex *vertex = vertex_iter.next();
-      if (in_degree[vertex] != 0)
-        debugPrint(debug_, "levelize", 2, "topological sort missing %s",
-                   vertex->to_string(this).c_str());
+      if (search_pred_.searchTo(to_vertex)
+          && in_degree[graph_->id(to_vertex)].fetch_sub(
+               1, std::memory_order_relaxed) == 1)
+        next_frontier.push_back(to_vertex);
     }
   }
-  if (debug_->check("levelize", 3)) {
-    report_->reportLine("Topological sort");
-    for (Vertex *vertex : topo_order)
-      report_->reportLine("%s", vertex->to_string(this).c_str());
-  }
-  stats.report("Levelize topological sort");
-  return topo_order;
 }
 
 void
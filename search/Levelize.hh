@@ -24,7 +24,9 @@
 
 #pragma once
 
+#include <atomic>
 #include <stack>
+#include <vector>
 
 #include "NetworkClass.hh"
 #include "SdcClass.hh"
@@ -77,6 +79,20 @@ protected:
   void findRoots();
   VertexSeq sortedRootsWithFanout();
   VertexSeq findTopologicalOrder();
+  void findInDegrees(const VertexSeq &vertices,
+                     std::vector<std::atomic<int>> &in_degree);
+  void findInDegrees(const VertexSeq &vertices,
+                     size_t from,
+                     size_t to,
+                     std::vector<std::atomic<int>> &in_degree,
+                     EdgeSeq &latch_d_to_q_edges);
+  VertexSeq expandFrontier(const VertexSeq &frontier,
+                           std::vector<std::atomic<int>> &in_degree);
+  void expandFrontier(const VertexSeq &frontier,
+                      size_t from,
+                      size_t to,
+                      std::vector<std::atomic<int>> &in_degree,
+                      VertexSeq &next_frontier);
   void assignLevels(VertexSeq &topo_sorted);
   void recordLoop(Edge *edge,
                   EdgeSeq &path);
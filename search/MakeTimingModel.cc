@@ -27,6 +27,7 @@
 
 #include <algorithm>
 #include <map>
+#include <vector>
 
 #include "Debug.hh"
 #include "Units.hh"
@@ -39,6 +40,7 @@
 #include "PortDirection.hh"
 #include "Corner.hh"
 #include "DcalcAnalysisPt.hh"
+#include "DispatchQueue.hh"
 #include "GraphDelayCalc.hh"
 #include "Sdc.hh"
 #include "StaState.hh"
@@ -245,6 +247,7 @@ public:
   virtual PathEndVisitor *copy() const;
   virtual void visit(PathEnd *path_end);
   void setInputRf(const RiseFall *input_rf);
+  void merge(const MakeEndTimingArcs *visitor);
   const ClockEdgeDelays &margins() const { return margins_; }
 
 private:
@@ -271,6 +274,29 @@ MakeEndTimingArcs::setInputRf(const RiseFall *input_rf)
   input_rf_ = input_rf;
 }
 
+// Keep the max margin for each clock edge, matching visit().
+void
+MakeEndTimingArcs::merge(const MakeEndTimingArcs *visitor)
+{
+  for (const auto& [clk_edge, margins] : visitor->margins_) {
+    RiseFallMinMax &merged = margins_[clk_edge];
+    for (const RiseFall *rf : RiseFall::range()) {
+      for (const MinMax *min_max : MinMax::range()) {
+        float value;
+        bool exists;
+        margins.value(rf, min_max, value, exists);
+        if (exists) {
+          float merged_value;
+          bool merged_exists;
+          merged.value(rf, min_max, merged_value, merged_exists);
+          merged.setValue(rf, min_max,
+                          merged_exists ? max(merged_value, value) : value);
+        }
+      }
+    }
+  }
+}
+
 void
 MakeEndTimingArcs::visit(PathEnd *path_end)
 {
@@ -351,10 +377,7 @@ MakeTimingModel::findTimingFromInput(Port *input_port)
       search_->findFilteredArrivals(from, nullptr, nullptr, false, false);
 
       end_visitor.setInputRf(input_rf);
-      VertexSeq endpoints = search_->filteredEndpoints();
-      VisitPathEnds visit_ends(sta_);
-      for (Vertex *end : endpoints)
-        visit_ends.visitPathEnds(end, corner_, MinMaxAll::all(), true, &end_visitor);
+      visitEndpoints(&end_visitor);
       findOutputDelays(input_rf, output_delays);
       search_->deleteFilteredArrivals();
 
@@ -368,31 +391,125 @@ MakeTimingModel::findTimingFromInput(Port *input_port)
   }
 }
 
+// Visit the filtered endpoints, batching them across the thread pool
+// with a per-thread visitor for each worker.
+void
+MakeTimingModel::visitEndpoints(MakeEndTimingArcs *end_visitor)
+{
+  VertexSeq endpoints = search_->filteredEndpoints();
+  size_t end_count = endpoints.size();
+  size_t thread_count = threadCount();
+  if (thread_count <= 1
+      || end_count < thread_count) {
+    VisitPathEnds visit_ends(sta_);
+    for (Vertex *end : endpoints)
+      visit_ends.visitPathEnds(end, corner_, MinMaxAll::all(), true, end_visitor);
+  }
+  else {
+    std::vector<MakeEndTimingArcs*> visitors(thread_count);
+    for (size_t k = 0; k < thread_count; k++)
+      visitors[k] = static_cast<MakeEndTimingArcs*>(end_visitor->copy());
+    size_t chunk_size = end_count / thread_count + 1;
+    size_t from = 0;
+    for (size_t k = 0; k < thread_count && from < end_count; k++) {
+      size_t to = min(from + chunk_size, end_count);
+      dispatch_queue_->dispatch([this, &endpoints, &visitors, k, from, to](int) {
+        VisitPathEnds visit_ends(sta_);
+        for (size_t i = from; i < to; i++)
+          visit_ends.visitPathEnds(endpoints[i], corner_, MinMaxAll::all(),
+                                   true, visitors[k]);
+      });
+      from = to;
+    }
+    dispatch_queue_->finishTasks();
+    for (size_t k = 0; k < thread_count; k++) {
+      end_visitor->merge(visitors[k]);
+      delete visitors[k];
+    }
+  }
+}
+
 void
 MakeTimingModel::findOutputDelays(const RiseFall *input_rf,
                                   OutputPinDelays &output_pin_delays)
 {
+  // Batch the output pins so the filtered path scans can run on the
+  // thread pool, merging the per-thread delays afterwards.
+  PinSeq output_pins;
   InstancePinIterator *output_iter = network_->pinIterator(network_->topInstance());
   while (output_iter->hasNext()) {
     Pin *output_pin = output_iter->next();
-    if (network_->direction(output_pin)->isOutput()) {
-      Vertex *output_vertex = graph_->pinLoadVertex(output_pin);
-      VertexPathIterator path_iter(output_vertex, this);
-      while (path_iter.hasNext()) {
-        Path *path = path_iter.next();
-        if (search_->matchesFilter(path, nullptr)) {
-          const RiseFall *output_rf = path->transition(sta_);
-          const MinMax *min_max = path->minMax(sta_);
-          Arrival delay = path->arrival();
-          OutputDelays &delays = output_pin_delays[output_pin];
-          delays.delays.mergeValue(output_rf, min_max,
-                                   delayAsFloat(delay, min_max, sta_));
-          delays.rf_path_exists[input_rf->index()][output_rf->index()] = true;
-        }
+    if (network_->direction(output_pin)->isOutput())
+      output_pins.push_back(output_pin);
+  }
+  delete output_iter;
+  size_t pin_count = output_pins.size();
+  size_t thread_count = threadCount();
+  if (thread_count <= 1
+      || pin_count < thread_count) {
+    for (const Pin *output_pin : output_pins)
+      findOutputDelays1(output_pin, input_rf, output_pin_delays);
+  }
+  else {
+    std::vector<OutputPinDelays> pin_delays(thread_count);
+    size_t chunk_size = pin_count / thread_count + 1;
+    size_t from = 0;
+    for (size_t k = 0; k < thread_count && from < pin_count; k++) {
+      size_t to = min(from + chunk_size, pin_count);
+      dispatch_queue_->dispatch([this, &output_pins, &pin_delays, input_rf,
+                                 k, from, to](int) {
+        for (size_t i = from; i < to; i++)
+          findOutputDelays1(output_pins[i], input_rf, pin_delays[k]);
+      });
+      from = to;
+    }
+    dispatch_queue_->finishTasks();
+    for (const OutputPinDelays &pin_delays1 : pin_delays)
+      mergeOutputDelays(pin_delays1, output_pin_delays);
+  }
+}
+
+void
+MakeTimingModel::findOutputDelays1(const Pin *output_pin,
+                                   const RiseFall *input_rf,
+                                   OutputPinDelays &output_pin_delays)
+{
+  Vertex *output_vertex = graph_->pinLoadVertex(output_pin);
+  VertexPathIterator path_iter(output_vertex, this);
+  while (path_iter.hasNext()) {
+    Path *path = path_iter.next();
+    if (search_->matchesFilter(path, nullptr)) {
+      const RiseFall *output_rf = path->transition(sta_);
+      const MinMax *min_max = path->minMax(sta_);
+      Arrival delay = path->arrival();
+      OutputDelays &delays = output_pin_delays[output_pin];
+      delays.delays.mergeValue(output_rf, min_max,
+                               delayAsFloat(delay, min_max, sta_));
+      delays.rf_path_exists[input_rf->index()][output_rf->index()] = true;
+    }
+  }
+}
+
+void
+MakeTimingModel::mergeOutputDelays(const OutputPinDelays &from,
+                                   OutputPinDelays &to)
+{
+  for (const auto& [pin, delays] : from) {
+    OutputDelays &merged = to[pin];
+    for (const RiseFall *rf : RiseFall::range()) {
+      for (const MinMax *min_max : MinMax::range()) {
+        float value;
+        bool exists;
+        delays.delays.value(rf, min_max, value, exists);
+        if (exists)
+          merged.delays.mergeValue(rf, min_max, value);
       }
     }
+    for (int i = 0; i < RiseFall::index_count; i++) {
+      for (int j = 0; j < RiseFall::index_count; j++)
+        merged.rf_path_exists[i][j] |= delays.rf_path_exists[i][j];
+    }
   }
-  delete output_iter;
 }
 
 void
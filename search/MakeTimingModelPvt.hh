@@ -36,6 +36,7 @@ namespace sta {
 
 class Sta;
 class LibertyBuilder;
+class MakeEndTimingArcs;
 
 class OutputDelays
 {
@@ -76,8 +77,14 @@ private:
                         const MinMax *min_max,
                         TimingSense sense,
                         const ClkDelays &delays);
+  void visitEndpoints(MakeEndTimingArcs *end_visitor);
   void findOutputDelays(const RiseFall *input_rf,
                         OutputPinDelays &output_pin_delays);
+  void findOutputDelays1(const Pin *output_pin,
+                         const RiseFall *input_rf,
+                         OutputPinDelays &output_pin_delays);
+  void mergeOutputDelays(const OutputPinDelays &from,
+                         OutputPinDelays &to);
   void makeSetupHoldTimingArcs(const Pin *input_pin,
                                const ClockEdgeDelays &clk_margins);
   void makeInputOutputTimingArcs(const Pin *input_pin,
@@ -24,7 +24,11 @@
 
 #include "PathEnum.hh"
 
+#include <algorithm>
+#include <vector>
+
 #include "Debug.hh"
+#include "DispatchQueue.hh"
 #include "Error.hh"
 #include "Fuzzy.hh"
 #include "TimingRole.hh"
@@ -112,6 +116,7 @@ PathEnum::PathEnum(size_t group_path_count,
 		   bool unique_pins,
 		   bool unique_edges,
 		   bool cmp_slack,
+		   bool parallel,
 		   const StaState *sta) :
   StaState(sta),
   cmp_slack_(cmp_slack),
@@ -119,6 +124,7 @@ PathEnum::PathEnum(size_t group_path_count,
   endpoint_path_count_(endpoint_path_count),
   unique_pins_(unique_pins),
   unique_edges_(unique_edges),
+  parallel_(parallel),
   div_queue_(DiversionGreater(sta)),
   div_count_(0),
   inserts_pruned_(false),
@@ -267,6 +273,9 @@ public:
 			       Arrival &to_arrival,
 			       const MinMax *min_max,
 			       const PathAnalysisPt *path_ap) override;
+  // Diversions found by this visitor, inserted into the enum queue
+  // serially so visitors can run on the thread pool.
+  DiversionSeq &diversions() { return divs_; }
 
 private:
   void makeDivertedPathEnd(Path *after_div,
@@ -302,6 +311,7 @@ private:
   bool crpr_active_;
   VisitedFanins visited_fanins_;
   std::map<VertexEdge, Diversion*> unique_edge_divs_;
+  DiversionSeq divs_;
 };
 
 PathEnumFaninVisitor::PathEnumFaninVisitor(PathEnd *path_end,
@@ -351,7 +361,7 @@ PathEnumFaninVisitor::visitFaninPathsThru(Path *before_div,
 
   if (unique_edges_) {
     for (auto [vertex_edge, div] : unique_edge_divs_)
-      path_enum_->insert(div);
+      divs_.push_back(div);
   }
 }
 
@@ -436,7 +446,7 @@ PathEnumFaninVisitor::visitFromToPath(const Pin *,
     if (unique_edges_)
       insertUniqueEdgeDiv(div);
     else
-      path_enum_->insert(div);
+      divs_.push_back(div);
     if (crpr_active_)
       visited_fanins_.emplace(from_vertex, arc);
   }
@@ -583,16 +593,16 @@ void
 PathEnum::makeDiversions(PathEnd *path_end,
 			 Path *before)
 {
+  // Collect the path vertices to expand so independent fanin
+  // expansions can run on the thread pool.
+  PathSeq div_paths;
+  TimingArcSeq div_arcs;
   Path *path = before;
   Path *prev_path = path->prevPath();
   TimingArc *prev_arc = path->prevArc(this);
-  PathEnumFaninVisitor fanin_visitor(path_end, path, unique_pins_,
-				     unique_edges_, this);
   while (prev_path) {
-    // Fanin visitor does all the work.
-    // While visiting the fanins the fanin_visitor finds the
-    // previous path and arc as well as diversions.
-    fanin_visitor.visitFaninPathsThru(path, prev_path->vertex(this), prev_arc);
+    div_paths.push_back(path);
+    div_arcs.push_back(prev_arc);
     // Do not enumerate beyond latch D to Q edges.
     // This breaks latch loop paths.
     const TimingRole *prev_role = prev_arc->role();
@@ -603,6 +613,50 @@ PathEnum::makeDiversions(PathEnd *path_end,
     prev_path = path->prevPath();
     prev_arc = path->prevArc(this);
   }
+  size_t site_count = div_paths.size();
+  if (!parallel_
+      || thread_count_ <= 1
+      || site_count < static_cast<size_t>(thread_count_)) {
+    // Fanin visitor does all the work.
+    // While visiting the fanins the fanin_visitor finds the
+    // previous path and arc as well as diversions.
+    PathEnumFaninVisitor fanin_visitor(path_end, before, unique_pins_,
+				       unique_edges_, this);
+    for (size_t i = 0; i < site_count; i++)
+      fanin_visitor.visitFaninPathsThru(div_paths[i],
+					div_paths[i]->prevPath()->vertex(this),
+					div_arcs[i]);
+    for (Diversion *div : fanin_visitor.diversions())
+      insert(div);
+  }
+  else {
+    // Expand the path vertices in parallel with per-thread visitors
+    // and merge the diversions serially.  The diversion comparison is
+    // a total order, so the queue contents do not depend on the
+    // insertion order.
+    std::vector<PathEnumFaninVisitor*> visitors(thread_count_);
+    for (int k = 0; k < thread_count_; k++)
+      visitors[k] = new PathEnumFaninVisitor(path_end, before, unique_pins_,
+					     unique_edges_, this);
+    size_t chunk_size = site_count / thread_count_ + 1;
+    size_t from = 0;
+    for (int k = 0; k < thread_count_ && from < site_count; k++) {
+      size_t to = std::min(from + chunk_size, site_count);
+      dispatch_queue_->dispatch([&, k, from, to](int) {
+	for (size_t i = from; i < to; i++)
+	  visitors[k]->visitFaninPathsThru(div_paths[i],
+					   div_paths[i]->prevPath()->vertex(this),
+					   div_arcs[i]);
+      });
+      from = to;
+    }
+    dispatch_queue_->finishTasks();
+    for (PathEnumFaninVisitor *visitor : visitors) {
+      for (Diversion *div : visitor->diversions())
+	insert(div);
+      delete visitor;
+    }
+  }
 }
 
 void
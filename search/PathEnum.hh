@@ -63,6 +63,9 @@ public:
 	   bool unique_pins,
 	   bool unique_edges,
 	   bool cmp_slack,
+	   // Expand diversions on the thread pool.  Must be false when
+	   // the enumeration itself runs on a dispatch queue thread.
+	   bool parallel,
 	   const StaState *sta);
   // Insert path ends that are enumerated in slack/arrival order.
   void insert(PathEnd *path_end);
@@ -98,6 +101,7 @@ private:
   size_t endpoint_path_count_;
   bool unique_pins_;
   bool unique_edges_;
+  bool parallel_;
   DiversionQueue div_queue_;
   int div_count_;
   // Number of paths returned for each endpoint (limit to endpoint_path_count).
@@ -24,6 +24,8 @@
 
 #include "PathExpanded.hh"
 
+#include <cstdint>
+
 #include "TimingRole.hh"
 #include "PortDirection.hh"
 #include "Network.hh"
@@ -56,9 +58,58 @@ PathExpanded::PathExpanded(const Path *path,
   expand(path, false);
 }
 
+// Reporting, property queries and path end checks re-expand the same
+// path (text plus json plus startpoint lookups for each of the
+// reported ends), so a small per-thread direct-mapped memo keyed by
+// the terminal path remembers recent expansions.  Entries are tagged
+// with the search path generation, which advances whenever vertex
+// paths are deleted or overwritten, so a recycled Path address cannot
+// hit a stale entry.  The memo slots also pool the expansion vectors;
+// hits and fills copy path pointers instead of walking the previous
+// path chain and its timing arcs.
+struct PathExpandedMemo
+{
+  const Path *path = nullptr;
+  bool expand_genclks = false;
+  size_t generation = 0;
+  const Search *search = nullptr;
+  ConstPathSeq paths;
+  size_t start_index = 0;
+};
+
+static constexpr size_t path_expanded_memo_count = 16;
+thread_local static PathExpandedMemo
+path_expanded_memos[path_expanded_memo_count];
+
 void
 PathExpanded::expand(const Path *path,
 		     bool expand_genclks)
+{
+  Search *search = sta_->search();
+  size_t generation = search->pathGeneration();
+  size_t slot = (reinterpret_cast<uintptr_t>(path) >> 4)
+    % path_expanded_memo_count;
+  PathExpandedMemo &memo = path_expanded_memos[slot];
+  if (memo.path == path
+      && memo.expand_genclks == expand_genclks
+      && memo.generation == generation
+      && memo.search == search) {
+    paths_ = memo.paths;
+    start_index_ = memo.start_index;
+    return;
+  }
+  expand1(path, expand_genclks);
+  memo.path = path;
+  memo.expand_genclks = expand_genclks;
+  memo.generation = generation;
+  memo.search = search;
+  memo.paths = paths_;
+  memo.start_index = start_index_;
+}
+
+void
+PathExpanded::expand1(const Path *path,
+		      bool expand_genclks)
 {
   const Latches *latches = sta_->latches();
   // Push the paths from the end into an array of Paths.
@@ -31,6 +31,7 @@
 #include "Debug.hh"
 #include "Mutex.hh"
 #include "Fuzzy.hh"
+#include "ParallelSort.hh"
 #include "MinMax.hh"
 #include "DispatchQueue.hh"
 #include "ExceptionPath.hh"
@@ -43,6 +44,7 @@
 #include "Search.hh"
 #include "VisitPathEnds.hh"
 #include "PathEnum.hh"
+#include "WorstSlack.hh"
 
 namespace sta {
 
@@ -109,11 +111,7 @@ PathGroup::~PathGroup()
 bool
 PathGroup::saveable(PathEnd *path_end)
 {
-  float threshold;
-  {
-    LockGuard lock(lock_);
-    threshold = threshold_;
-  }
+  float threshold = threshold_.load(std::memory_order_relaxed);
   if (compare_slack_) {
     // Crpr increases the slack, so check the slack
     // without crpr first because it is expensive to find.
@@ -181,9 +179,23 @@ PathGroup::insert(PathEnd *path_end)
 }
 
 void
-PathGroup::prune()
+PathGroup::insertEnds(PathEndSeq &path_ends)
 {
-  sort();
+  LockGuard lock(lock_);
+  for (PathEnd *path_end : path_ends) {
+    path_ends_.push_back(path_end);
+    path_end->setPathGroup(this);
+  }
+  path_ends.clear();
+  if (group_path_count_ != group_path_count_max
+      && path_ends_.size() > group_path_count_ * 2)
+    prune();
+}
+
+void
+PathGroup::prune(bool parallel)
+{
+  sort(parallel);
   VertexPathCountMap path_counts;
   size_t end_count = 0;
   for (unsigned i = 0; i < path_ends_.size(); i++) {
@@ -225,19 +237,103 @@ PathGroup::iterator()
   return new PathGroupIterator(path_ends_);
 }
 
+const PathEndSeq &
+PathGroup::sortedPathEnds()
+{
+  ensureSortedMaxPaths();
+  return path_ends_;
+}
+
 void
 PathGroup::ensureSortedMaxPaths()
 {
   if (path_ends_.size() > group_path_count_)
-    prune();
+    prune(true);
   else
-    sort();
+    sort(true);
+}
+
+// Materialized primary sort key for a path end.  PathEnd comparisons
+// recompute slack on every probe and crpr makes slack expensive, so
+// the key is evaluated once per end before sorting.  The full
+// comparator only runs to break key ties, which preserves the
+// PathEndLess ordering exactly.
+struct PathEndKey
+{
+  float key;
+  PathEnd *path_end;
+};
+
+class PathEndKeyLess
+{
+public:
+  explicit PathEndKeyLess(const StaState *sta) : sta_(sta) {}
+  bool operator()(const PathEndKey &key1,
+		  const PathEndKey &key2) const
+  {
+    if (fuzzyLess(key1.key, key2.key))
+      return true;
+    if (fuzzyLess(key2.key, key1.key))
+      return false;
+    return PathEnd::less(key1.path_end, key2.path_end, sta_);
+  }
+
+private:
+  const StaState *sta_;
+};
+
+static float
+pathEndSortKey(const PathEnd *path_end,
+	       const StaState *sta)
+{
+  if (path_end->isUnconstrained()) {
+    // Unconstrained ends order by arrival, worst first.
+    float arrival = delayAsFloat(path_end->dataArrivalTime(sta));
+    return (path_end->minMax(sta) == MinMax::max()) ? -arrival : arrival;
+  }
+  else
+    return delayAsFloat(path_end->slack(sta));
+}
+
+static void
+sortPathEnds(PathEndSeq &path_ends,
+	     const StaState *sta,
+	     DispatchQueue *dispatch_queue,
+	     size_t thread_count)
+{
+  size_t end_count = path_ends.size();
+  Vector<PathEndKey> keys(end_count);
+  if (dispatch_queue && thread_count > 1
+      && end_count >= thread_count) {
+    size_t chunk_size = end_count / thread_count + 1;
+    size_t from = 0;
+    for (size_t k = 0; k < thread_count && from < end_count; k++) {
+      size_t to = std::min(from + chunk_size, end_count);
+      dispatch_queue->dispatch([&path_ends, &keys, sta, from, to](int) {
+	for (size_t i = from; i < to; i++)
+	  keys[i] = {pathEndSortKey(path_ends[i], sta), path_ends[i]};
+      });
+      from = to;
+    }
+    dispatch_queue->finishTasks();
+  }
+  else {
+    for (size_t i = 0; i < end_count; i++)
+      keys[i] = {pathEndSortKey(path_ends[i], sta), path_ends[i]};
+  }
+  sta::sort(keys, PathEndKeyLess(sta), dispatch_queue, thread_count);
+  for (size_t i = 0; i < end_count; i++)
+    path_ends[i] = keys[i].path_end;
 }
 
 void
-PathGroup::sort()
+PathGroup::sort(bool parallel)
 {
-  sta::sort(path_ends_, PathEndLess(sta_));
+  if (parallel)
+    sortPathEnds(path_ends_, sta_,
+		 sta_->dispatchQueue(), sta_->threadCount());
+  else
+    sortPathEnds(path_ends_, sta_, nullptr, 1);
 }
 
 void
@@ -519,26 +615,27 @@ PathGroups::pathGroupNames(const PathEnd *path_end,
   return group_names;
 }
 
-void
-PathGroups::pushGroupPathEnds(PathEndSeq &path_ends)
+PathGroupSeq
+PathGroups::reportOrderGroups() const
 {
+  PathGroupSeq groups;
   for (auto min_max : MinMax::range()) {
     int mm_index =  min_max->index();
     for (auto name_group : sdc_->groupPaths()) {
       const char *name = name_group.first;
       PathGroup *path_group = findPathGroup(name, min_max);
       if (path_group)
-	path_group->pushEnds(path_ends);
+	groups.push_back(path_group);
     }
 
     if (async_[mm_index])
-      async_[mm_index]->pushEnds(path_ends);
+      groups.push_back(async_[mm_index]);
 
     if (gated_clk_[mm_index])
-      gated_clk_[mm_index]->pushEnds(path_ends);
+      groups.push_back(gated_clk_[mm_index]);
 
     if (path_delay_[mm_index])
-      path_delay_[mm_index]->pushEnds(path_ends);
+      groups.push_back(path_delay_[mm_index]);
 
     ClockSeq clks;
     sdc_->sortedClocks(clks);
@@ -547,16 +644,17 @@ PathGroups::pushGroupPathEnds(PathEndSeq &path_ends)
       Clock *clk = clk_iter.next();
       PathGroup *path_group = findPathGroup(clk, min_max);
       if (path_group)
-	path_group->pushEnds(path_ends);
+	groups.push_back(path_group);
     }
   }
+  return groups;
 }
 
-void
-PathGroups::pushUnconstrainedPathEnds(PathEndSeq &path_ends,
-				      const MinMaxAll *min_max)
+PathGroupSeq
+PathGroups::unconstrainedGroups(const MinMaxAll *min_max) const
 {
-  Set<PathGroup *> groups;
+  PathGroupSeq groups;
+  Set<PathGroup *> found_groups;
   for (auto path_ap : corners_->pathAnalysisPts()) {
     const MinMax *path_min_max = path_ap->pathMinMax();
     if (min_max->matches(path_min_max)) {
@@ -565,20 +663,41 @@ PathGroups::pushUnconstrainedPathEnds(PathEndSeq &path_ends,
       if (group
 	  // For multiple corner path APs use the same group.
 	  // Only report it once.
-	  && !groups.findKey(group)) {
-	group->pushEnds(path_ends);
-        groups.insert(group);
+	  && !found_groups.findKey(group)) {
+	groups.push_back(group);
+        found_groups.insert(group);
       }
     }
   }
+  return groups;
+}
+
+void
+PathGroups::pushGroupPathEnds(PathEndSeq &path_ends)
+{
+  for (PathGroup *path_group : reportOrderGroups())
+    path_group->pushEnds(path_ends);
+}
+
+void
+PathGroups::pushUnconstrainedPathEnds(PathEndSeq &path_ends,
+				      const MinMaxAll *min_max)
+{
+  for (PathGroup *path_group : unconstrainedGroups(min_max))
+    path_group->pushEnds(path_ends);
 }
 
 ////////////////////////////////////////////////////////////////
 
 typedef Map<PathGroup*, PathEnd*> PathGroupEndMap;
 typedef Map<PathGroup*, PathEndSeq*> PathGroupEndsMap;
+typedef Map<PathGroup*, PathEndSeq> PathGroupEndBufferMap;
 typedef Set<PathEnd*, PathEndNoCrprLess> PathEndNoCrprSet;
 
+// Thread-private ends buffered per group before merging so inserts
+// do not contend on the group lock for every path end.
+static constexpr size_t buffered_end_max = 64;
+
 static bool
 exceptionToEmpty(ExceptionTo *to);
 
@@ -596,7 +715,7 @@ PathGroups::makePathEnds(ExceptionTo *to,
   PathEndSeq path_ends;
   pushGroupPathEnds(path_ends);
   if (sort_by_slack) {
-    sort(path_ends, PathEndLess(this));
+    sortPathEnds(path_ends, this, dispatch_queue_, thread_count_);
   }
 
   if (unconstrained_paths
@@ -608,6 +727,61 @@ PathGroups::makePathEnds(ExceptionTo *to,
   return path_ends;
 }
 
+void
+PathGroups::visitPathEnds(ExceptionTo *to,
+			  bool unconstrained_paths,
+			  const Corner *corner,
+			  const MinMaxAll *min_max,
+			  bool sort_by_slack,
+			  PathEndConsumer *consumer)
+{
+  Stats stats(debug_, report_);
+  makeGroupPathEnds(to, group_path_count_, endpoint_path_count_,
+		    unique_pins_, unique_edges_, corner, min_max);
+
+  PathGroupSeq groups = reportOrderGroups();
+  size_t end_count = 0;
+  for (PathGroup *group : groups)
+    end_count += group->sortedPathEnds().size();
+  if (unconstrained_paths
+      && end_count == 0)
+    // No constrained paths, so report unconstrained paths.
+    groups = unconstrainedGroups(min_max);
+
+  if (sort_by_slack) {
+    // The group sequences are each in PathEndLess order, so merging
+    // their heads streams the ends out globally sorted with only one
+    // cursor per group in flight.
+    std::vector<size_t> cursors(groups.size(), 0);
+    while (true) {
+      PathEnd *next_end = nullptr;
+      size_t next_group = 0;
+      for (size_t g = 0; g < groups.size(); g++) {
+	const PathEndSeq &group_ends = groups[g]->sortedPathEnds();
+	if (cursors[g] < group_ends.size()) {
+	  PathEnd *group_end = group_ends[cursors[g]];
+	  if (next_end == nullptr
+	      || PathEnd::less(group_end, next_end, this)) {
+	    next_end = group_end;
+	    next_group = g;
+	  }
+	}
+      }
+      if (next_end == nullptr)
+	break;
+      cursors[next_group]++;
+      consumer->visit(next_end);
+    }
+  }
+  else {
+    for (PathGroup *group : groups) {
+      for (PathEnd *path_end : group->sortedPathEnds())
+	consumer->visit(path_end);
+    }
+  }
+  stats.report("Visit path ends");
+}
+
 ////////////////////////////////////////////////////////////////
 
 // Visit each path end for a vertex and add the worst one in each
@@ -617,6 +791,7 @@ class MakePathEnds1 : public PathEndVisitor
 public:
   MakePathEnds1(PathGroups *path_groups);
   MakePathEnds1(const MakePathEnds1&) = default;
+  virtual ~MakePathEnds1();
   virtual PathEndVisitor *copy() const;
   virtual void visit(PathEnd *path_end);
   virtual void vertexEnd(Vertex *vertex);
@@ -624,9 +799,11 @@ public:
 private:
   void visitPathEnd(PathEnd *path_end,
 		    PathGroup *group);
+  void flushEnds();
 
   PathGroups *path_groups_;
   PathGroupEndMap ends_;
+  PathGroupEndBufferMap buffered_ends_;
   PathEndLess cmp_;
 };
 
@@ -678,13 +855,32 @@ MakePathEnds1::vertexEnd(Vertex *)
     group_iter.next(group, end);
     // visitPathEnd already confirmed slack is saveable.
     if (end) {
-      group->insert(end);
+      PathEndSeq &buffered = buffered_ends_[group];
+      buffered.push_back(end);
+      if (buffered.size() >= buffered_end_max)
+	group->insertEnds(buffered);
       // Clear ends_ for next vertex.
       ends_[group] = nullptr;
     }
   }
 }
 
+MakePathEnds1::~MakePathEnds1()
+{
+  flushEnds();
+}
+
+// Merge the buffered ends into their groups.  Runs when the
+// per-thread visitors are destroyed after endpoint visiting finishes.
+void
+MakePathEnds1::flushEnds()
+{
+  for (auto& [group, buffered] : buffered_ends_) {
+    if (!buffered.empty())
+      group->insertEnds(buffered);
+  }
+}
+
 ////////////////////////////////////////////////////////////////
 
 // Visit each path end and add it to the corresponding path group.
@@ -704,11 +900,13 @@ public:
 private:
   void visitPathEnd(PathEnd *path_end,
 		    PathGroup *group);
+  void flushEnds();
 
   int endpoint_path_count_;
   PathGroups *path_groups_;
   const StaState *sta_;
   PathGroupEndsMap ends_;
+  PathGroupEndBufferMap buffered_ends_;
   PathEndSlackLess slack_cmp_;
   PathEndNoCrprLess path_no_crpr_cmp_;
 };
@@ -732,6 +930,7 @@ MakePathEndsAll::copy() const
 
 MakePathEndsAll::~MakePathEndsAll()
 {
+  flushEnds();
   PathGroupEndsMap::Iterator group_iter(ends_);
   while (group_iter.hasNext()) {
     PathGroup *group;
@@ -741,6 +940,17 @@ MakePathEndsAll::~MakePathEndsAll()
   }
 }
 
+// Merge the buffered ends into their groups.  Runs when the
+// per-thread visitors are destroyed after endpoint visiting finishes.
+void
+MakePathEndsAll::flushEnds()
+{
+  for (auto& [group, buffered] : buffered_ends_) {
+    if (!buffered.empty())
+      group->insertEnds(buffered);
+  }
+}
+
 void
 MakePathEndsAll::visit(PathEnd *path_end)
 {
@@ -789,7 +999,10 @@ MakePathEndsAll::vertexEnd(Vertex *)
 	  // it may delete it during pruning.
 	  if (group->saveable(path_end)
               || group->enumMinSlackUnderMin(path_end)) {
-	    group->insert(path_end->copy());
+	    PathEndSeq &buffered = buffered_ends_[group];
+	    buffered.push_back(path_end->copy());
+	    if (buffered.size() >= buffered_end_max)
+	      group->insertEnds(buffered);
 	    unique_ends.insert(path_end);
 	    n++;
 	  }
@@ -831,39 +1044,57 @@ PathGroups::makeGroupPathEnds(ExceptionTo *to,
     MakePathEndsAll make_path_ends(endpoint_path_count, this);
     makeGroupPathEnds(to, corner, min_max, &make_path_ends);
 
+    // Collect the groups to enumerate with their slack/arrival compare.
+    std::vector<std::pair<PathGroup*, bool>> enum_groups;
     for (auto path_min_max : MinMax::range()) {
       int mm_index =  path_min_max->index();
       for (auto name_group : sdc_->groupPaths()) {
         const char *name = name_group.first;
         PathGroup *group = findPathGroup(name, path_min_max);
         if (group)
-          enumPathEnds(group, group_path_count, endpoint_path_count,
-		       unique_pins, unique_edges, true);
+          enum_groups.push_back({group, true});
       }
 
       for (auto clk : sdc_->clks()) {
 	PathGroup *group = findPathGroup(clk, path_min_max);
 	if (group)
-	  enumPathEnds(group, group_path_count, endpoint_path_count,
-		       unique_pins, unique_edges, true);
+	  enum_groups.push_back({group, true});
       }
 
       PathGroup *group = unconstrained_[mm_index];
       if (group)
-	enumPathEnds(group, group_path_count, endpoint_path_count,
-		     unique_pins, unique_edges, false);
+	enum_groups.push_back({group, false});
       group = path_delay_[mm_index];
       if (group)
-	enumPathEnds(group, group_path_count, endpoint_path_count,
-		     unique_pins, unique_edges, true);
+	enum_groups.push_back({group, true});
       group = gated_clk_[mm_index];
       if (group)
-	enumPathEnds(group, group_path_count, endpoint_path_count,
-		     unique_pins, unique_edges, true);
+	enum_groups.push_back({group, true});
       group = async_[mm_index];
       if (group)
-	enumPathEnds(group, group_path_count, endpoint_path_count,
-		     unique_pins, unique_edges, true);
+	enum_groups.push_back({group, true});
+    }
+
+    if (thread_count_ <= 1
+	|| enum_groups.size() == 1) {
+      for (const auto &group_slack : enum_groups)
+	enumPathEnds(group_slack.first, group_path_count, endpoint_path_count,
+		     unique_pins, unique_edges, group_slack.second, true);
+    }
+    else {
+      // Enumerate the groups in parallel.  Each group enumerates
+      // serially because the dispatch queue does not nest.
+      for (const auto &group_slack : enum_groups) {
+	PathGroup *group = group_slack.first;
+	bool cmp_slack = group_slack.second;
+	dispatch_queue_->dispatch([this, group, cmp_slack, group_path_count,
+				   endpoint_path_count, unique_pins,
+				   unique_edges](int) {
+	  enumPathEnds(group, group_path_count, endpoint_path_count,
+		       unique_pins, unique_edges, cmp_slack, false);
+	});
+      }
+      dispatch_queue_->finishTasks();
     }
   }
 }
@@ -874,12 +1105,14 @@ PathGroups::enumPathEnds(PathGroup *group,
 			 int endpoint_path_count,
 			 bool unique_pins,
 			 bool unique_edges,
-			 bool cmp_slack)
+			 bool cmp_slack,
+			 bool parallel_enum)
 {
   // Insert the worst max_path path ends in the group into a path
   // enumerator.
   PathEnum path_enum(group_path_count, endpoint_path_count,
-		     unique_pins, unique_edges, cmp_slack, this);
+		     unique_pins, unique_edges, cmp_slack,
+		     parallel_enum, this);
   PathGroupIterator *end_iter = group->iterator();
   while (end_iter->hasNext()) {
     PathEnd *end = end_iter->next();
@@ -1007,18 +1240,36 @@ PathGroups::makeGroupPathEnds(VertexSet *endpoints,
 			      const MinMaxAll *min_max,
 			      PathEndVisitor *visitor)
 {
+  // Violator-only reports save a tiny fraction of the path ends, so
+  // pre-filter the endpoint visits with the incremental endpoint
+  // slack index.  An endpoint whose cached worst slack is above
+  // slack_max cannot contribute a saveable end.  Unconstrained
+  // reporting visits every endpoint because unconstrained ends have
+  // no slack.
+  WorstSlacks *slack_index = nullptr;
+  if (slack_max_ < INF
+      && unconstrained_[MinMax::minIndex()] == nullptr
+      && unconstrained_[MinMax::maxIndex()] == nullptr)
+    slack_index = search()->endpointSlackIndex();
   if (thread_count_ == 1) {
     MakeEndpointPathEnds end_visitor(visitor, corner, min_max, this);
-    for (auto endpoint : *endpoints)
-      end_visitor.visit(endpoint);
+    for (auto endpoint : *endpoints) {
+      if (slack_index == nullptr
+	  || delayLessEqual(slack_index->endpointSlack(endpoint),
+			    slack_max_, this))
+	end_visitor.visit(endpoint);
+    }
   }
   else {
     Vector<MakeEndpointPathEnds> visitors(thread_count_,
                                           MakeEndpointPathEnds(visitor, corner,
                                                                min_max, this));
     for (const auto endpoint : *endpoints) {
-      dispatch_queue_->dispatch( [endpoint, &visitors](int i)
-      { visitors[i].visit(endpoint); } );
+      if (slack_index == nullptr
+	  || delayLessEqual(slack_index->endpointSlack(endpoint),
+			    slack_max_, this))
+	dispatch_queue_->dispatch( [endpoint, &visitors](int i)
+	{ visitors[i].visit(endpoint); } );
     }
     dispatch_queue_->finishTasks();
   }
@@ -642,7 +642,7 @@ Properties::Properties(Sta *sta) :
 
 PropertyValue
 Properties::getProperty(const Library *lib,
-                        const std::string property)
+                        const std::string &property)
 {
   Network *network = sta_->cmdNetwork();
   if (property == "name"
@@ -662,7 +662,7 @@ Properties::getProperty(const Library *lib,
 
 PropertyValue
 Properties::getProperty(const LibertyLibrary *lib,
-                        const std::string property)
+                        const std::string &property)
 {
   if (property == "name"
       || property == "full_name")
@@ -684,7 +684,7 @@ Properties::getProperty(const LibertyLibrary *lib,
 
 PropertyValue
 Properties::getProperty(const Cell *cell,
-                        const std::string property)
+                        const std::string &property)
 {
   Network *network = sta_->cmdNetwork();
   if (property == "name"
@@ -715,7 +715,7 @@ Properties::getProperty(const Cell *cell,
 
 PropertyValue
 Properties::getProperty(const LibertyCell *cell,
-                        const std::string property)
+                        const std::string &property)
 {
   if (property == "name"
       || property == "base_name")
@@ -756,7 +756,7 @@ Properties::getProperty(const LibertyCell *cell,
 
 PropertyValue
 Properties::getProperty(const Port *port,
-                        const std::string property)
+                        const std::string &property)
 {
   Network *network = sta_->cmdNetwork();
   if (property == "name"
@@ -857,7 +857,7 @@ Properties::portSlack(const Port *port,
 
 PropertyValue
 Properties::getProperty(const LibertyPort *port,
-                        const std::string property)
+                        const std::string &property)
 {
   if (property == "name")
     return PropertyValue(port->name());
@@ -936,7 +936,7 @@ Properties::getProperty(const LibertyPort *port,
 
 PropertyValue
 Properties::getProperty(const Instance *inst,
-                        const string property)
+                        const string &property)
 {
   Network *network = sta_->ensureLinked();
   LibertyCell *liberty_cell = network->libertyCell(inst);
@@ -976,7 +976,7 @@ Properties::getProperty(const Instance *inst,
 
 PropertyValue
 Properties::getProperty(const Pin *pin,
-                        const std::string property)
+                        const std::string &property)
 {
   Network *network = sta_->ensureLinked();
   if (property == "name"
@@ -1129,7 +1129,7 @@ Properties::pinSlew(const Pin *pin,
 
 PropertyValue
 Properties::getProperty(const Net *net,
-                        const std::string property)
+                        const std::string &property)
 {
   Network *network = sta_->ensureLinked();
   if (property == "name")
@@ -1149,7 +1149,7 @@ Properties::getProperty(const Net *net,
 
 PropertyValue
 Properties::getProperty(Edge *edge,
-                        const std::string property)
+                        const std::string &property)
 {
   if (property == "full_name") {
     string full_name = edge->to_string(sta_);
@@ -1202,7 +1202,7 @@ Properties::edgeDelay(Edge *edge,
 
 PropertyValue
 Properties::getProperty(TimingArcSet *arc_set,
-                        const std::string property)
+                        const std::string &property)
 {
   if (property == "name"
       || property == "full_name") {
@@ -1225,7 +1225,7 @@ Properties::getProperty(TimingArcSet *arc_set,
 
 PropertyValue
 Properties::getProperty(const Clock *clk,
-                        const std::string property)
+                        const std::string &property)
 {
   if (property == "name"
       || property == "full_name")
@@ -1254,7 +1254,7 @@ Properties::getProperty(const Clock *clk,
 
 PropertyValue
 Properties::getProperty(PathEnd *end,
-                        const std::string property)
+                        const std::string &property)
 {
   if (property == "startpoint") {
     PathExpanded expanded(end->path(), sta_);
@@ -1285,7 +1285,7 @@ Properties::getProperty(PathEnd *end,
 
 PropertyValue
 Properties::getProperty(Path *path,
-                        const std::string property)
+                        const std::string &property)
 {
   if (property == "pin")
     return PropertyValue(path->pin(sta_));
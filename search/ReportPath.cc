@@ -23,6 +23,8 @@
 // This notice may not be removed or altered from any source distribution.
 
 #include <algorithm>            // reverse
+#include <string>
+#include <vector>
 
 #include "ReportPath.hh"
 
@@ -58,6 +60,7 @@
 #include "PathExpanded.hh"
 #include "Latches.hh"
 #include "Corner.hh"
+#include "DispatchQueue.hh"
 #include "Genclks.hh"
 #include "Variables.hh"
 
@@ -290,6 +293,39 @@ ReportPath::setReportSigmas(bool report)
   report_sigmas_ = report;
 }
 
+// Clone the path options for a formatting worker thread that
+// writes to report.
+ReportPath *
+ReportPath::copy(Report *report) const
+{
+  ReportPath *copy = new ReportPath(const_cast<ReportPath*>(this));
+  copy->setReport(report);
+  copy->format_ = format_;
+  copy->report_input_pin_ = report_input_pin_;
+  copy->report_hier_pins_ = report_hier_pins_;
+  copy->report_net_ = report_net_;
+  copy->no_split_ = no_split_;
+  copy->setDigits(digits_);
+  copy->report_sigmas_ = report_sigmas_;
+  copy->start_end_pt_width_ = start_end_pt_width_;
+  copy->copyFieldProperties(this);
+  return copy;
+}
+
+void
+ReportPath::copyFieldProperties(const ReportPath *from)
+{
+  ReportFieldSeq next_fields;
+  for (ReportField *from_field : from->fields_) {
+    ReportField *field = findField(from_field->name());
+    field->setProperties(from_field->title(), from_field->width(),
+			 from_field->leftJustify());
+    field->setEnabled(from_field->enabled());
+    next_fields.push_back(field);
+  }
+  fields_ = next_fields;
+}
+
 ////////////////////////////////////////////////////////////////
 
 void
@@ -329,29 +365,153 @@ ReportPath::reportPathEnd(const PathEnd *end,
   case ReportPathFormat::json:
     reportJson(end, last);
     break;
+  case ReportPathFormat::json_stream:
+    reportJsonStream(end);
+    break;
   }
 }
 
+// Report that collects the output in a string so path ends can be
+// formatted on worker threads and emitted in path order.
+class ReportString : public Report
+{
+public:
+  ReportString(Report *default_report);
+  const std::string &text() const { return text_; }
+
+protected:
+  size_t printString(const char *buffer,
+		     size_t length) override;
+
+  std::string text_;
+};
+
+ReportString::ReportString(Report *default_report)
+{
+  // The Report constructor captures the most recent instance as the
+  // default report used for error reporting; restore the real one.
+  default_ = default_report;
+}
+
+size_t
+ReportString::printString(const char *buffer,
+			  size_t length)
+{
+  text_.append(buffer, length);
+  return length;
+}
+
 void
 ReportPath::reportPathEnds(const PathEndSeq *ends) const
 {
   reportPathEndHeader();
-  if (ends && !ends->empty()) {
-    PathEnd *prev_end = nullptr;
-    PathEndSeq::ConstIterator end_iter(ends);
-    while (end_iter.hasNext()) {
-      PathEnd *end = end_iter.next();
-      reportPathEnd(end, prev_end, !end_iter.hasNext());
-      prev_end = end;
-    }
-  }
+  if (ends && !ends->empty())
+    reportPathEndsBatch(*ends, nullptr, true);
   else {
-    if (format_ != ReportPathFormat::json)
+    if (format_ != ReportPathFormat::json
+	&& format_ != ReportPathFormat::json_stream)
       report_->reportLine("No paths found.");
   }
   reportPathEndFooter();
 }
 
+void
+ReportPath::reportPathEndsBatch(const PathEndSeq &ends,
+				const PathEnd *prev_end,
+				bool last) const
+{
+  size_t end_count = ends.size();
+  size_t thread_count = threadCount();
+  // The endpoint format reports group headers between path ends and
+  // the json format brackets the last path end, so only the
+  // independently formatted path ends can run on the thread pool.
+  bool parallel = (format_ == ReportPathFormat::full
+		   || format_ == ReportPathFormat::full_clock
+		   || format_ == ReportPathFormat::full_clock_expanded
+		   || format_ == ReportPathFormat::shorter
+		   || format_ == ReportPathFormat::json_stream)
+    && thread_count > 1
+    && end_count >= thread_count;
+  if (parallel) {
+    // Format the path ends into per-thread string reports on the
+    // thread pool and emit the text in path order.
+    std::vector<ReportString*> reports(thread_count);
+    std::vector<ReportPath*> report_paths(thread_count);
+    for (size_t k = 0; k < thread_count; k++) {
+      reports[k] = new ReportString(report_);
+      report_paths[k] = copy(reports[k]);
+    }
+    size_t chunk_size = end_count / thread_count + 1;
+    size_t from = 0;
+    for (size_t k = 0; k < thread_count && from < end_count; k++) {
+      size_t to = std::min(from + chunk_size, end_count);
+      dispatch_queue_->dispatch([&ends, &report_paths, k, from, to](int) {
+	for (size_t i = from; i < to; i++)
+	  report_paths[k]->reportPathEnd(ends[i], nullptr, false);
+      });
+      from = to;
+    }
+    dispatch_queue_->finishTasks();
+    // The chunks are contiguous, so emitting the thread buffers in
+    // thread order preserves the path order.
+    for (size_t k = 0; k < thread_count; k++) {
+      const std::string &text = reports[k]->text();
+      if (!text.empty())
+	report_->printString(text.c_str(), text.size());
+      delete report_paths[k];
+      delete reports[k];
+    }
+  }
+  else {
+    for (size_t i = 0; i < end_count; i++) {
+      PathEnd *end = ends[i];
+      reportPathEnd(end, prev_end, last && i == end_count - 1);
+      prev_end = end;
+    }
+  }
+}
+
+ReportPathEndConsumer::ReportPathEndConsumer(ReportPath *report_path) :
+  report_path_(report_path),
+  prev_end_(nullptr),
+  empty_(true)
+{
+  report_path_->reportPathEndHeader();
+}
+
+void
+ReportPathEndConsumer::visit(PathEnd *path_end)
+{
+  empty_ = false;
+  batch_.push_back(path_end);
+  if (batch_.size() >= batch_end_max)
+    flush(false);
+}
+
+void
+ReportPathEndConsumer::flush(bool last)
+{
+  if (!batch_.empty()) {
+    report_path_->reportPathEndsBatch(batch_, prev_end_, last);
+    prev_end_ = batch_.back();
+    batch_.clear();
+  }
+}
+
+void
+ReportPathEndConsumer::finish()
+{
+  if (empty_) {
+    if (report_path_->format_ != ReportPathFormat::json
+	&& report_path_->format_ != ReportPathFormat::json_stream)
+      report_path_->report_->reportLine("No paths found.");
+  }
+  else
+    flush(true);
+  report_path_->reportPathEndFooter();
+  prev_end_ = nullptr;
+}
+
 void
 ReportPath::reportPathEndHeader() const
 {
@@ -361,6 +521,7 @@ ReportPath::reportPathEndHeader() const
   case ReportPathFormat::full_clock_expanded:
   case ReportPathFormat::shorter:
   case ReportPathFormat::endpoint:
+  case ReportPathFormat::json_stream:
     break;
   case ReportPathFormat::summary:
     reportSummaryHeader();
@@ -383,6 +544,7 @@ ReportPath::reportPathEndFooter() const
   case ReportPathFormat::full_clock:
   case ReportPathFormat::full_clock_expanded:
   case ReportPathFormat::shorter:
+  case ReportPathFormat::json_stream:
     break;
   case ReportPathFormat::endpoint:
   case ReportPathFormat::summary:
@@ -1256,6 +1418,160 @@ ReportPath::reportJson(const PathExpanded &expanded,
 
 ////////////////////////////////////////////////////////////////
 
+// JSON-lines variant of the json format.  Each path end is one
+// self-contained record on one line, written with a single buffered
+// print so downstream tools can parse large reports without the cost
+// of the pretty printed format.
+void
+ReportPath::reportJsonStream(const PathEnd *end) const
+{
+  string result;
+  result.reserve(1024);
+  result += "{";
+  stringAppend(result, "\"type\": \"%s\", ", end->typeName());
+  stringAppend(result, "\"path_group\": \"%s\", ",
+               end->pathGroup()->name());
+  stringAppend(result, "\"path_type\": \"%s\", ",
+               end->minMax(this)->to_string().c_str());
+
+  PathExpanded expanded(end->path(), this);
+  const Pin *startpoint = expanded.startPath()->vertex(this)->pin();
+  const Pin *endpoint = expanded.endPath()->vertex(this)->pin();
+  stringAppend(result, "\"startpoint\": \"%s\", ",
+               sdc_network_->pathName(startpoint));
+  stringAppend(result, "\"endpoint\": \"%s\", ",
+               sdc_network_->pathName(endpoint));
+
+  const ClockEdge *src_clk_edge = end->sourceClkEdge(this);
+  const Path *src_clk_path = expanded.clkPath();
+  const Path *tgt_clk_path = end->targetClkPath();
+  if (src_clk_edge) {
+    stringAppend(result, "\"source_clock\": \"%s\", ",
+                 src_clk_edge->clock()->name());
+    stringAppend(result, "\"source_clock_edge\": \"%s\", ",
+                 src_clk_edge->transition()->name());
+  }
+  if (src_clk_path)
+    reportJsonStream(src_clk_path, "source_clock_path", true, result);
+  reportJsonStream(expanded, "source_path", !end->isUnconstrained(), result);
+
+  const ClockEdge *tgt_clk_edge = end->targetClkEdge(this);
+  if (tgt_clk_edge) {
+    stringAppend(result, "\"target_clock\": \"%s\", ",
+                 tgt_clk_edge->clock()->name());
+    stringAppend(result, "\"target_clock_edge\": \"%s\", ",
+                 tgt_clk_edge->transition()->name());
+  }
+  if (tgt_clk_path)
+    reportJsonStream(end->targetClkPath(), "target_clock_path", true, result);
+
+  if (end->checkRole(this)) {
+    stringAppend(result, "\"data_arrival_time\": %.3e, ",
+                 delayAsFloat(end->dataArrivalTimeOffset(this)));
+
+    const MultiCyclePath *mcp = end->multiCyclePath();
+    if (mcp)
+      stringAppend(result, "\"multi_cycle_path\": %d, ",
+                   mcp->pathMultiplier());
+
+    PathDelay *path_delay = end->pathDelay();
+    if (path_delay)
+      stringAppend(result, "\"path_delay\": %.3e, ",
+                   path_delay->delay());
+
+    stringAppend(result, "\"crpr\": %.3e, ",
+                 delayAsFloat(end->checkCrpr(this)));
+    stringAppend(result, "\"margin\": %.3e, ",
+                 delayAsFloat(end->margin(this)));
+    stringAppend(result, "\"required_time\": %.3e, ",
+                 delayAsFloat(end->requiredTimeOffset(this)));
+    stringAppend(result, "\"slack\": %.3e",
+                 delayAsFloat(end->slack(this)));
+  }
+  result += "}\n";
+  report_->printString(result.c_str(), result.size());
+}
+
+void
+ReportPath::reportJsonStream(const Path *path) const
+{
+  string result;
+  result.reserve(1024);
+  result += "{";
+  reportJsonStream(path, "path", false, result);
+  result += "}\n";
+  report_->printString(result.c_str(), result.size());
+}
+
+void
+ReportPath::reportJsonStream(const Path *path,
+                             const char *path_name,
+                             bool trailing_comma,
+                             string &result) const
+{
+  PathExpanded expanded(path, this);
+  reportJsonStream(expanded, path_name, trailing_comma, result);
+}
+
+void
+ReportPath::reportJsonStream(const PathExpanded &expanded,
+                             const char *path_name,
+                             bool trailing_comma,
+                             string &result) const
+{
+  stringAppend(result, "\"%s\": [", path_name);
+  for (size_t i = expanded.startIndex(); i < expanded.size(); i++) {
+    const Path *path = expanded.path(i);
+    const Pin *pin = path->vertex(this)->pin();
+    const Net *net = network_->net(pin);
+    const Instance *inst = network_->instance(pin);
+    const RiseFall *rf = path->transition(this);
+    DcalcAnalysisPt *dcalc_ap = path->pathAnalysisPt(this)->dcalcAnalysisPt();
+    bool is_driver = network_->isDriver(pin);
+
+    result += "{";
+
+    if (inst) {
+      stringAppend(result, "\"instance\": \"%s\", ",
+                   sdc_network_->pathName(inst));
+      Cell *cell = network_->cell(inst);
+      if (cell)
+        stringAppend(result, "\"cell\": \"%s\", ",
+                     sdc_network_->name(cell));
+    }
+
+    stringAppend(result, "\"pin\": \"%s\", ",
+                 sdc_network_->pathName(pin));
+
+    if (net)
+      stringAppend(result, "\"net\": \"%s\", ",
+                   sdc_network_->pathName(net));
+
+    double x, y;
+    bool exists;
+    network_->location(pin, x, y, exists);
+    if (exists) {
+      stringAppend(result, "\"x\": %.9f, ", x);
+      stringAppend(result, "\"y\": %.9f, ", y);
+    }
+
+    stringAppend(result, "\"arrival\": %.3e, ",
+                 delayAsFloat(path->arrival()));
+    if (is_driver)
+      stringAppend(result, "\"capacitance\": %.3e, ",
+                   graph_delay_calc_->loadCap(pin, rf, dcalc_ap));
+    stringAppend(result, "\"slew\": %.3e}",
+                 delayAsFloat(path->slew(this)));
+    if (i < expanded.size() - 1)
+      result += ", ";
+  }
+  result += "]";
+  if (trailing_comma)
+    result += ", ";
+}
+
+////////////////////////////////////////////////////////////////
+
 void
 ReportPath::reportSlackOnlyHeader() const
 {
@@ -2580,6 +2896,9 @@ ReportPath::reportPath(const Path *path) const
   case ReportPathFormat::json:
     reportJson(path);
     break;
+  case ReportPathFormat::json_stream:
+    reportJsonStream(path);
+    break;
   case ReportPathFormat::shorter:
   case ReportPathFormat::endpoint:
   case ReportPathFormat::summary:
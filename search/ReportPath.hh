@@ -73,6 +73,13 @@ public:
 		     const PathEnd *prev_end,
                      bool last) const;
   void reportPathEnds(const PathEndSeq *ends) const;
+  // Report a contiguous run of path ends between the header and
+  // footer.  prev_end is the last end of the previous run (endpoint
+  // format group headers) and last is true for the final run (the
+  // json format brackets the last path end).
+  void reportPathEndsBatch(const PathEndSeq &ends,
+                           const PathEnd *prev_end,
+                           bool last) const;
   void reportPath(const Path *path) const;
 
   void reportShort(const PathEndUnconstrained *end) const;
@@ -107,6 +114,17 @@ public:
                   bool trailing_comma,
                   std::string &result) const;
 
+  void reportJsonStream(const PathEnd *end) const;
+  void reportJsonStream(const Path *path) const;
+  void reportJsonStream(const Path *path,
+                        const char *path_name,
+                        bool trailing_comma,
+                        std::string &result) const;
+  void reportJsonStream(const PathExpanded &expanded,
+                        const char *path_name,
+                        bool trailing_comma,
+                        std::string &result) const;
+
   void reportEndHeader() const;
   void reportEndLine(const PathEnd *end) const;
 
@@ -160,6 +178,8 @@ public:
   ReportField *fieldSrcAttr() const { return field_src_attr_; }
 
 protected:
+  ReportPath *copy(Report *report) const;
+  void copyFieldProperties(const ReportPath *from);
   void makeFields();
   ReportField *makeField(const char *name,
 			 const char *title,
@@ -493,6 +513,33 @@ protected:
 
   static const float field_blank_;
   static const float field_skip_;
+
+  friend class ReportPathEndConsumer;
+};
+
+// Streams path ends from Search::visitPathEnds to the report
+// formatter, so reporting overlaps path enumeration with bounded
+// memory.  Ends are buffered in batches so large runs still format in
+// parallel on the thread pool.
+class ReportPathEndConsumer : public PathEndConsumer
+{
+public:
+  // Reports the path end header.
+  explicit ReportPathEndConsumer(ReportPath *report_path);
+  void visit(PathEnd *path_end) override;
+  // Report the remaining buffered path ends and the footer.
+  void finish();
+
+private:
+  void flush(bool last);
+
+  // Bounds in-flight reporting memory.
+  static constexpr size_t batch_end_max = 10000;
+
+  ReportPath *report_path_;
+  PathEndSeq batch_;
+  const PathEnd *prev_end_;
+  bool empty_;
 };
 
 class ReportField
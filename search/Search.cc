@@ -28,9 +28,12 @@
 #include <cmath> // abs
 
 #include "Mutex.hh"
+#include "Hash.hh"
 #include "Report.hh"
 #include "Debug.hh"
 #include "Stats.hh"
+#include "Profile.hh"
+#include "QueryStats.hh"
 #include "Fuzzy.hh"
 #include "TimingRole.hh"
 #include "FuncExpr.hh"
@@ -52,6 +55,7 @@
 #include "SearchPred.hh"
 #include "Levelize.hh"
 #include "Bfs.hh"
+#include "DispatchQueue.hh"
 #include "Corner.hh"
 #include "Sim.hh"
 #include "Path.hh"
@@ -160,12 +164,13 @@ DynLoopSrchPred::hasPendingLoopPaths(Edge *edge,
 
 // EvalPred unless
 //  latch D->Q edge
-class SearchThru : public EvalPred, public DynLoopSrchPred
+class SearchThru final : public EvalPred, public DynLoopSrchPred
 {
 public:
   SearchThru(TagGroupBldr *tag_bldr,
 	     const StaState *sta);
   virtual bool searchThru(Edge *edge);
+  virtual bool searchTo(const Vertex *to_vertex);
 };
 
 SearchThru::SearchThru(TagGroupBldr *tag_bldr,
@@ -189,6 +194,13 @@ SearchThru::searchThru(Edge *edge)
                    graph, search);
 }
 
+bool
+SearchThru::searchTo(const Vertex *to_vertex)
+{
+  return EvalPred::searchTo(to_vertex)
+    && sta_->search()->inArrivalCone(to_vertex);
+}
+
 ClkArrivalSearchPred::ClkArrivalSearchPred(const StaState *sta) :
   EvalPred(sta)
 {
@@ -236,6 +248,7 @@ Search::init(StaState *sta)
   required_iter_ = new BfsBkwdIterator(BfsIndex::required, search_adj_, sta);
   tag_capacity_ = 128;
   tag_set_ = new TagSet(tag_capacity_, TagHash(sta), TagEqual(sta));
+  state_set_set_ = new ExceptionStateSetSet;
   clk_info_set_ = new ClkInfoSet(ClkInfoLess(sta));
   tag_next_ = 0;
   tags_ = new Tag*[tag_capacity_];
@@ -253,8 +266,12 @@ Search::init(StaState *sta)
   filter_from_ = nullptr;
   filter_to_ = nullptr;
   filtered_arrivals_ = new VertexSet(graph_);
+  arrival_cone_active_ = false;
   found_downstream_clk_pins_ = false;
   postpone_latch_outputs_ = false;
+  enqueue_latch_outputs_inline_ = false;
+  path_journal_active_ = false;
+  path_generation_ = 0;
 }
 
 // Init "options".
@@ -272,6 +289,7 @@ Search::~Search()
   deletePaths();
   deleteTags();
   delete tag_set_;
+  delete state_set_set_;
   delete clk_info_set_;
   delete [] tags_;
   delete [] tag_groups_;
@@ -320,7 +338,24 @@ Search::clear()
   clearPendingLatchOutputs();
   deleteFilter();
   genclks_->clear();
+  gated_clk_->clear();
+  arrival_cone_active_ = false;
+  arrival_cone_.clear();
   found_downstream_clk_pins_ = false;
+  // Displaced arrays in the journal were released with the path
+  // arenas by deletePaths.
+  for (PathJournalEntry &entry : path_journal_) {
+    if (entry.path_count > 0)
+      delete [] entry.paths;
+  }
+  path_journal_.clear();
+  path_journal_active_ = false;
+}
+
+SearchPred *
+Search::searchAdj() const
+{
+  return search_adj_;
 }
 
 bool
@@ -361,6 +396,7 @@ Search::deleteTags()
   tag_next_ = 0;
   tag_set_->deleteContentsClear();
   tag_free_indices_.clear();
+  state_set_set_->deleteContentsClear();
 
   clk_info_set_->deleteContentsClear();
   deleteTagsPrev();
@@ -403,12 +439,12 @@ void
 Search::deletePaths()
 {
   debugPrint(debug_, "search", 1, "delete paths");
+  incrPathGeneration();
   if (arrivals_exist_) {
-    VertexIterator vertex_iter(graph_);
-    while (vertex_iter.hasNext()) {
-      Vertex *vertex = vertex_iter.next();
-      deletePaths(vertex);
-    }
+    // Callers delete all of the tag groups next, so the path arrays
+    // can be released wholesale without maintaining the tag group
+    // reference counts vertex by vertex.
+    graph_->clearPaths();
 
     for (Path *path : enum_paths_)
       delete path;
@@ -438,17 +474,108 @@ Search::deletePathsIncr(Vertex *vertex)
 void
 Search::deletePaths(Vertex *vertex)
 {
-  debugPrint(debug_, "search", 4, "delete paths %s",
+  debugPrintHot(debug_, "search", 4, "delete paths %s",
              vertex->name(network_));
+  incrPathGeneration();
   TagGroup *tag_group = tagGroup(vertex);
   if (tag_group) {
-    graph_->deletePaths(vertex);
+    if (path_journal_active_) {
+      // Keep the displaced array alive for rollback.
+      journalPathsReplace(vertex);
+      vertex->setPaths(nullptr);
+      vertex->setTagGroupIndex(tag_group_index_max);
+    }
+    else
+      graph_->deletePaths(vertex);
     tag_group->decrRefCount();
   }
 }
 
 ////////////////////////////////////////////////////////////////
 
+void
+Search::beginPathJournal()
+{
+  path_journal_.clear();
+  path_journal_active_ = true;
+}
+
+// Replay the journal in reverse so a vertex mutated repeatedly
+// settles back to its pre-probe paths.  Tag groups interned during
+// the probe are left with a zero reference count for
+// deleteUnusedTagGroups to reclaim.
+void
+Search::rollbackPathJournal()
+{
+  path_journal_active_ = false;
+  incrPathGeneration();
+  for (auto entry = path_journal_.rbegin();
+       entry != path_journal_.rend();
+       entry++) {
+    Vertex *vertex = entry->vertex;
+    tnsInvalid(vertex);
+    if (entry->path_count > 0) {
+      // In place overwrite; copy the saved contents back.
+      Path *paths = graph_->paths(vertex);
+      for (uint32_t i = 0; i < entry->path_count; i++)
+        paths[i] = entry->paths[i];
+      delete [] entry->paths;
+    }
+    else {
+      // Replacement; free the probe's array and reinstate the
+      // displaced one.
+      TagGroup *tag_group = tagGroup(vertex);
+      if (tag_group) {
+        tag_group->decrRefCount();
+        graph_->deletePaths(vertex);
+      }
+      vertex->setPaths(entry->paths);
+      vertex->setTagGroupIndex(entry->tag_group_index);
+      if (entry->paths)
+        tagGroup(vertex)->incrRefCount();
+    }
+  }
+  path_journal_.clear();
+}
+
+void
+Search::journalPathsCopy(Vertex *vertex)
+{
+  TagGroup *tag_group = tagGroup(vertex);
+  if (tag_group
+      && tag_group->pathCount() > 0) {
+    uint32_t path_count = tag_group->pathCount();
+    Path *copy = new Path[path_count];
+    const Path *paths = graph_->paths(vertex);
+    for (uint32_t i = 0; i < path_count; i++)
+      copy[i] = paths[i];
+    // Lock for arrival/required threads.
+    LockGuard lock(path_journal_lock_);
+    path_journal_.push_back({vertex, copy, vertex->tagGroupIndex(),
+                             path_count});
+  }
+}
+
+void
+Search::journalPathsReplace(Vertex *vertex)
+{
+  // Lock for arrival/required threads.
+  LockGuard lock(path_journal_lock_);
+  path_journal_.push_back({vertex, vertex->paths(),
+                           vertex->tagGroupIndex(), 0});
+}
+
+void
+Search::arrivalsRestored()
+{
+  arrival_iter_->clear();
+  required_iter_->clear();
+  invalid_arrivals_->clear();
+  invalid_requireds_->clear();
+}
+
+////////////////////////////////////////////////////////////////
+
 // from/thrus/to are owned and deleted by Search.
 // Returned sequence is owned by the caller.
 // PathEnds are owned by Search PathGroups and deleted on next call.
@@ -474,6 +601,7 @@ Search::findPathEnds(ExceptionFrom *from,
 		     bool clk_gating_setup,
 		     bool clk_gating_hold)
 {
+  ProfilePhase phase("Find path ends");
   findFilteredArrivals(from, thrus, to, unconstrained, true);
   if (!variables_->recoveryRemovalChecksEnabled())
     recovery = removal = false;
@@ -493,6 +621,47 @@ Search::findPathEnds(ExceptionFrom *from,
   return path_ends;
 }
 
+void
+Search::visitPathEnds(ExceptionFrom *from,
+		      ExceptionThruSeq *thrus,
+		      ExceptionTo *to,
+		      bool unconstrained,
+		      const Corner *corner,
+		      const MinMaxAll *min_max,
+		      size_t group_path_count,
+		      size_t endpoint_path_count,
+		      bool unique_pins,
+		      bool unique_edges,
+		      float slack_min,
+		      float slack_max,
+		      bool sort_by_slack,
+		      PathGroupNameSet *group_names,
+		      bool setup,
+		      bool hold,
+		      bool recovery,
+		      bool removal,
+		      bool clk_gating_setup,
+		      bool clk_gating_hold,
+		      PathEndConsumer *consumer)
+{
+  ProfilePhase phase("Visit path ends");
+  findFilteredArrivals(from, thrus, to, unconstrained, true);
+  if (!variables_->recoveryRemovalChecksEnabled())
+    recovery = removal = false;
+  if (!variables_->gatedClkChecksEnabled())
+    clk_gating_setup = clk_gating_hold = false;
+  makePathGroups(group_path_count, endpoint_path_count,
+		 unique_pins, unique_edges,
+                 slack_min, slack_max,
+                 group_names, setup, hold,
+                 recovery, removal,
+                 clk_gating_setup, clk_gating_hold);
+  ensureDownstreamClkPins();
+  path_groups_->visitPathEnds(to, unconstrained_paths_, corner, min_max,
+                              sort_by_slack, consumer);
+  sdc_->reportClkToClkMaxCycleWarnings();
+}
+
 void
 Search::findFilteredArrivals(ExceptionFrom *from,
                              ExceptionThruSeq *thrus,
@@ -504,6 +673,7 @@ Search::findFilteredArrivals(ExceptionFrom *from,
   checkFromThrusTo(from, thrus, to);
   filter_from_ = from;
   filter_to_ = to;
+  findArrivalCone(to);
   if ((from
        && (from->pins()
 	   || from->instances()))
@@ -518,6 +688,105 @@ Search::findFilteredArrivals(ExceptionFrom *from,
     findAllArrivals(thru_latches);
 }
 
+// Demand-driven cone mode for targeted queries.  When arrivals do not
+// exist yet and -to names specific endpoints, restrict the arrival
+// search to the fan-in cone of those endpoints instead of computing
+// arrivals for the full graph.  The cone is found by reverse
+// reachability over all edges, so it covers the launch and capture
+// clock trees (check edges lead in from the capture clock pins).
+// Cone arrivals are partial; any query that needs arrivals elsewhere
+// tears the mode down and invalidates them.
+void
+Search::findArrivalCone(ExceptionTo *to)
+{
+  VertexSeq endpoints;
+  if (to
+      && to->clks() == nullptr
+      // A warm full-graph search answers targeted queries
+      // incrementally; only a cold or cone-limited search benefits.
+      && (!arrivals_exist_
+	  || arrival_cone_active_)
+      && coneEndpoints(to, endpoints)) {
+    clearArrivalCone();
+    arrivalsInvalid();
+    markArrivalCone(endpoints);
+    arrival_cone_active_ = true;
+  }
+  else
+    clearArrivalCone();
+}
+
+// Find the -to endpoint vertices if they are enumerable.
+bool
+Search::coneEndpoints(ExceptionTo *to,
+                      VertexSeq &endpoints)
+{
+  PinSet to_pins = to->allPins(network_);
+  if (to_pins.empty())
+    return false;
+  for (const Pin *pin : to_pins) {
+    if (network_->isHierarchical(pin))
+      return false;
+    Vertex *vertex, *bidirect_drvr_vertex;
+    graph_->pinVertices(pin, vertex, bidirect_drvr_vertex);
+    if (vertex)
+      endpoints.push_back(vertex);
+    if (bidirect_drvr_vertex)
+      endpoints.push_back(bidirect_drvr_vertex);
+  }
+  return !endpoints.empty();
+}
+
+void
+Search::markArrivalCone(const VertexSeq &endpoints)
+{
+  ProfilePhase phase("Find arrival cone");
+  arrival_cone_.assign(graph_->vertexIdLimit(), false);
+  VertexSeq cone_stack;
+  for (Vertex *vertex : endpoints) {
+    VertexId vertex_id = graph_->id(vertex);
+    if (!arrival_cone_[vertex_id]) {
+      arrival_cone_[vertex_id] = true;
+      cone_stack.push_back(vertex);
+    }
+  }
+  size_t cone_count = endpoints.size();
+  while (!cone_stack.empty()) {
+    Vertex *vertex = cone_stack.back();
+    cone_stack.pop_back();
+    VertexInEdgeIterator edge_iter(vertex, graph_);
+    while (edge_iter.hasNext()) {
+      Edge *edge = edge_iter.next();
+      Vertex *from_vertex = edge->from(graph_);
+      VertexId from_id = graph_->id(from_vertex);
+      if (!arrival_cone_[from_id]) {
+	arrival_cone_[from_id] = true;
+	cone_stack.push_back(from_vertex);
+	cone_count++;
+      }
+    }
+  }
+  debugPrint(debug_, "search", 1, "arrival cone %zu vertices", cone_count);
+}
+
+void
+Search::clearArrivalCone()
+{
+  if (arrival_cone_active_) {
+    // Arrivals were only computed inside the cone; start over.
+    arrival_cone_active_ = false;
+    arrival_cone_.clear();
+    arrivalsInvalid();
+  }
+}
+
+bool
+Search::inArrivalCone(const Vertex *vertex) const
+{
+  return !arrival_cone_active_
+    || arrival_cone_[graph_->id(vertex)];
+}
+
 void
 Search::makePathGroups(int group_path_count,
 		       int endpoint_path_count,
@@ -584,6 +853,7 @@ Search::deleteFilteredArrivals()
       filtered_arrivals_->clear();
       deleteFilterTagGroups();
       deleteFilterTags();
+      deleteFilterStateSets();
       deleteFilterClkInfos();
     }
     deleteFilter();
@@ -626,6 +896,29 @@ Search::deleteFilterTags()
   }
 }
 
+// Filter tags are deleted above, so state sets with filter states
+// have no remaining references.
+void
+Search::deleteFilterStateSets()
+{
+  for (auto itr = state_set_set_->cbegin(); itr != state_set_set_->cend(); ) {
+    ExceptionStateSet *states = *itr;
+    bool refs_filter = false;
+    for (ExceptionState *state : *states) {
+      if (state->exception() == filter_) {
+	refs_filter = true;
+	break;
+      }
+    }
+    if (refs_filter) {
+      itr = state_set_set_->erase(itr);
+      delete states;
+    }
+    else
+      itr++;
+  }
+}
+
 void
 Search::deleteFilterClkInfos()
 {
@@ -652,6 +945,7 @@ Search::findFilteredArrivals(bool thru_latches)
   arrival_visitor_->init(true);
   // Iterate until data arrivals at all latches stop changing.
   postpone_latch_outputs_ = true;
+  enqueue_latch_outputs_inline_ = thru_latches;
   for (int pass = 1; pass == 1 || (thru_latches && havePendingLatchOutputs()) ; pass++) {
     if (thru_latches)
       enqueuePendingLatchOutputs();
@@ -661,6 +955,7 @@ Search::findFilteredArrivals(bool thru_latches)
     debugPrint(debug_, "search", 1, "found %d arrivals", arrival_count);
     postpone_latch_outputs_ = false;
   }
+  enqueue_latch_outputs_inline_ = false;
   arrivals_exist_ = true;
 }
 
@@ -808,6 +1103,7 @@ Search::arrivalsInvalid()
     deletePathGroups();
     deletePaths();
     deleteTags();
+    check_crpr_->clear();
     genclks_->clear();
     deleteFilter();
     arrivals_at_endpoints_exist_ = false;
@@ -826,6 +1122,33 @@ Search::arrivalsInvalid()
   }
 }
 
+void
+Search::dataArrivalsInvalid()
+{
+  if (arrivals_exist_) {
+    if (!clk_arrivals_valid_
+	|| filter_
+	|| arrival_cone_active_)
+      arrivalsInvalid();
+    else {
+      debugPrint(debug_, "search", 1, "data arrivals invalid");
+      deletePathGroups();
+      requiredsInvalid();
+      arrivals_at_endpoints_exist_ = false;
+      // Clock tree vertices keep their paths; the invalidated data
+      // vertices are re-seeded and re-propagated from them.
+      VertexIterator vertex_iter(graph_);
+      while (vertex_iter.hasNext()) {
+	Vertex *vertex = vertex_iter.next();
+	if (!isClock(vertex)) {
+	  deletePaths(vertex);
+	  arrivalInvalid(vertex);
+	}
+      }
+    }
+  }
+}
+
 void
 Search::requiredsInvalid()
 {
@@ -842,7 +1165,7 @@ void
 Search::arrivalInvalid(Vertex *vertex)
 {
   if (arrivals_exist_) {
-    debugPrint(debug_, "search", 2, "arrival invalid %s",
+    debugPrintHot(debug_, "search", 2, "arrival invalid %s",
                vertex->to_string(this).c_str());
     if (!arrival_iter_->inQueue(vertex)) {
       // Lock for StaDelayCalcObserver called by delay calc threads.
@@ -921,7 +1244,7 @@ void
 Search::requiredInvalid(Vertex *vertex)
 {
   if (requireds_exist_) {
-    debugPrint(debug_, "search", 2, "required invalid %s",
+    debugPrintHot(debug_, "search", 2, "required invalid %s",
                vertex->to_string(this).c_str());
     if (!required_iter_->inQueue(vertex)) {
       // Lock for StaDelayCalcObserver called by delay calc threads.
@@ -1060,22 +1383,29 @@ Search::visitEndpoints(VertexVisitor *visitor)
 void
 Search::findAllArrivals()
 {
+  clearArrivalCone();
   findAllArrivals(true);
 }
 
 void
 Search::findAllArrivals(bool thru_latches)
 {
+  arrival_iter_->clearVisitCancel();
   arrival_visitor_->init(false);
   // Iterate until data arrivals at all latches stop changing.
   postpone_latch_outputs_ = true;
-  for (int pass = 1; pass == 1 || (thru_latches && havePendingLatchOutputs()); pass++) {
+  enqueue_latch_outputs_inline_ = thru_latches;
+  for (int pass = 1;
+       (pass == 1 || (thru_latches && havePendingLatchOutputs()))
+	 && !arrival_iter_->visitCanceled();
+       pass++) {
     enqueuePendingLatchOutputs();
     debugPrint(debug_, "search", 1, "find arrivals pass %d", pass);
     findArrivals1(levelize_->maxLevel());
     if (pass > 2)
       postpone_latch_outputs_ = false;
   }
+  enqueue_latch_outputs_inline_ = false;
 }
 
 bool
@@ -1094,7 +1424,7 @@ void
 Search::enqueuePendingLatchOutputs()
 {
   for (Vertex *latch_vertex : *pending_latch_outputs_) {
-    debugPrint(debug_, "search", 2, "enqueue latch output %s",
+    debugPrintHot(debug_, "search", 2, "enqueue latch output %s",
                latch_vertex->to_string(this).c_str());
     arrival_iter_->enqueue(latch_vertex);
   }
@@ -1110,14 +1440,36 @@ Search::findArrivals()
 void
 Search::findArrivals(Level level)
 {
+  clearArrivalCone();
   arrival_visitor_->init(false);
   findArrivals1(level);
 }
 
+Level
+Search::arrivalLevel() const
+{
+  return arrival_iter_->visitLevel();
+}
+
+int
+Search::arrivalVisitCount() const
+{
+  return arrival_iter_->visitCount();
+}
+
+void
+Search::cancelArrivals()
+{
+  arrival_iter_->cancelVisit();
+}
+
 void
 Search::findArrivals1(Level level)
 {
+  ProfilePhase phase("Find arrivals");
   debugPrint(debug_, "search", 1, "find arrivals to level %d", level);
+  // Arrival changes move clock common points, so drop memoized crpr.
+  check_crpr_->clear();
   findArrivalsSeed();
   Stats stats(debug_, report_);
   int arrival_count = arrival_iter_->visitParallel(level, arrival_visitor_);
@@ -1126,7 +1478,9 @@ Search::findArrivals1(Level level)
     deleteUnusedTagGroups();
   stats.report("Find arrivals");
   if (arrival_iter_->empty()
-      && invalid_arrivals_->empty()) {
+      && invalid_arrivals_->empty()
+      // Cone arrivals are partial.
+      && !arrival_cone_active_) {
     clk_arrivals_valid_ = true;
     arrivals_at_endpoints_exist_ = true;
   }
@@ -1216,7 +1570,8 @@ ArrivalVisitor::setAlwaysToEndpoints(bool to_endpoints)
 void
 ArrivalVisitor::visit(Vertex *vertex)
 {
-  debugPrint(debug_, "search", 2, "find arrivals %s",
+  incrQueryCounter(QueryCounter::arrival_visit);
+  debugPrintHot(debug_, "search", 2, "find arrivals %s",
              vertex->to_string(this).c_str());
   Pin *pin = vertex->pin();
   tag_bldr_->init(vertex);
@@ -1255,7 +1610,7 @@ ArrivalVisitor::visit(Vertex *vertex)
   // For example, "set_max_delay -to" from an unclocked source register.
   bool is_clk = tag_bldr_->hasClkTag();
   if (vertex->isRegClk() && !is_clk) {
-    debugPrint(debug_, "search", 2, "arrival seed unclked reg clk %s",
+    debugPrintHot(debug_, "search", 2, "arrival seed unclked reg clk %s",
                network_->pathName(pin));
     search_->makeUnclkedPaths(vertex, true, false, tag_bldr_);
   }
@@ -1273,7 +1628,7 @@ ArrivalVisitor::visit(Vertex *vertex)
       || arrivals_changed)
     search_->arrivalIterator()->enqueueAdjacentVertices(vertex, adj_pred_);
   if (arrivals_changed) {
-    debugPrint(debug_, "search", 4, "arrivals changed");
+    debugPrintHot(debug_, "search", 4, "arrivals changed");
     search_->setVertexArrivals(vertex, tag_bldr_);
     search_->tnsInvalid(vertex);
     constrainedRequiredsInvalid(vertex, is_clk);
@@ -1363,15 +1718,15 @@ ArrivalVisitor::visitFromToPath(const Pin * /* from_pin */,
 				const MinMax *min_max,
 				const PathAnalysisPt *)
 {
-  debugPrint(debug_, "search", 3, " %s",
+  debugPrintHot(debug_, "search", 3, " %s",
              from_vertex->to_string(this).c_str());
-  debugPrint(debug_, "search", 3, "  %s -> %s %s",
+  debugPrintHot(debug_, "search", 3, "  %s -> %s %s",
              from_rf->to_string().c_str(),
              to_rf->to_string().c_str(),
              min_max->to_string().c_str());
-  debugPrint(debug_, "search", 3, "  from tag: %s",
+  debugPrintHot(debug_, "search", 3, "  from tag: %s",
              from_tag->to_string(this).c_str());
-  debugPrint(debug_, "search", 3, "  to tag  : %s",
+  debugPrintHot(debug_, "search", 3, "  to tag  : %s",
              to_tag->to_string(this).c_str());
   const ClkInfo *to_clk_info = to_tag->clkInfo();
   bool to_is_clk = to_tag->isClock();
@@ -1380,7 +1735,7 @@ ArrivalVisitor::visitFromToPath(const Pin * /* from_pin */,
   tag_bldr_->tagMatchPath(to_tag, match, path_index);
   if (match == nullptr
       || delayGreater(to_arrival, match->arrival(), min_max, this)) {
-    debugPrint(debug_, "search", 3, "   %s + %s = %s %s %s",
+    debugPrintHot(debug_, "search", 3, "   %s + %s = %s %s %s",
                delayAsString(from_arrival, this),
                delayAsString(arc_delay, this),
                delayAsString(to_arrival, this),
@@ -1424,7 +1779,7 @@ ArrivalVisitor::pruneCrprArrivals()
 	Arrival max_arrival_max_crpr = (min_max == MinMax::max())
 	  ? max_arrival - max_crpr
 	  : max_arrival + max_crpr;
-	debugPrint(debug_, "search", 4, "  cmp %s %s - %s = %s",
+	debugPrintHot(debug_, "search", 4, "  cmp %s %s - %s = %s",
                    tag->to_string(this).c_str(),
                    delayAsString(max_arrival, this),
                    delayAsString(max_crpr, this),
@@ -1435,7 +1790,7 @@ ArrivalVisitor::pruneCrprArrivals()
 	if (delayGreater(max_arrival_max_crpr, arrival, min_max, this)
 	    && clk_info_no_crpr->crprClkPath(this)->minMax(this)
 	    == clk_info->crprClkPath(this)->minMax(this)) {
-	  debugPrint(debug_, "search", 3, "  pruned %s",
+	  debugPrintHot(debug_, "search", 3, "  pruned %s",
                      tag->to_string(this).c_str());
           path_itr = path_index_map.erase(path_itr);
           deleted_tag = true;
@@ -1489,8 +1844,19 @@ Search::enqueueLatchDataOutputs(Vertex *vertex)
     Edge *out_edge = out_edge_iter.next();
     if (latches_->isLatchDtoQ(out_edge)) {
       Vertex *out_vertex = out_edge->to(graph_);
-      LockGuard lock(pending_latch_outputs_lock_);
-      pending_latch_outputs_->insert(out_vertex);
+      // The arrival BFS is levelized, so a Q output above the data
+      // input can be resolved in the current pass; chains of
+      // transparent latches then settle in one pass instead of one
+      // global pass per latch.  Latch outputs at or below the data
+      // level, and evals postponed for incomplete crpr clk paths,
+      // still defer to the next pass.
+      if (enqueue_latch_outputs_inline_
+	  && out_vertex->level() > vertex->level())
+	arrival_iter_->enqueue(out_vertex);
+      else {
+	LockGuard lock(pending_latch_outputs_lock_);
+	pending_latch_outputs_->insert(out_vertex);
+      }
     }
   }
 }
@@ -1565,7 +1931,7 @@ Search::seedArrival(Vertex *vertex)
 	// Internal roots isolated by disabled pins are seeded with no clock.
 	|| (unconstrained_paths_
 	    && !network_->isTopLevelPort(pin))) {
-      debugPrint(debug_, "search", 2, "arrival seed unclked root %s",
+      debugPrintHot(debug_, "search", 2, "arrival seed unclked root %s",
                  network_->pathName(pin));
       TagGroupBldr tag_bldr(true, this);
       tag_bldr.init(vertex);
@@ -1582,7 +1948,7 @@ Search::seedArrival(Vertex *vertex)
     }
   }
   else {
-    debugPrint(debug_, "search", 4, "arrival enqueue %s %u",
+    debugPrintHot(debug_, "search", 4, "arrival enqueue %s %u",
                network_->pathName(pin),
                vertex->level());
     arrival_iter_->enqueue(vertex);
@@ -1606,7 +1972,7 @@ Search::seedClkArrivals(const Pin *pin,
 			TagGroupBldr *tag_bldr)
 {
   for (const Clock *clk : *sdc_->findLeafPinClocks(pin)) {
-    debugPrint(debug_, "search", 2, "arrival seed clk %s pin %s",
+    debugPrintHot(debug_, "search", 2, "arrival seed clk %s pin %s",
                clk->name(), network_->pathName(pin));
     for (PathAnalysisPt *path_ap : corners_->pathAnalysisPts()) {
       const MinMax *min_max = path_ap->pathMinMax();
@@ -1884,7 +2250,7 @@ Search::seedInputDelayArrival(const Pin *pin,
 			      bool is_segment_start,
 			      TagGroupBldr *tag_bldr)
 {
-  debugPrint(debug_, "search", 2,
+  debugPrintHot(debug_, "search", 2,
              input_delay
              ? "arrival seed input arrival %s"
              : "arrival seed input %s",
@@ -2146,7 +2512,7 @@ PathVisitor::visitFanoutPaths(Vertex *from_vertex)
       const Pin *to_pin = to_vertex->pin();
       if (pred_->searchTo(to_vertex)
 	  && pred_->searchThru(edge)) {
-	debugPrint(debug_, "search", 3, " %s",
+	debugPrintHot(debug_, "search", 3, " %s",
                    to_vertex->to_string(this).c_str());
 	if (!visitEdge(from_pin, from_vertex, edge, to_pin, to_vertex))
 	  break;
@@ -2325,7 +2691,7 @@ PathVisitor::visitFromPath(const Pin *from_pin,
             // Crpr clk path on latch data input is required to find Q
             // arrival. If the data clk path level is >= Q level the
             // crpr clk path prev_path pointers are not complete.
-            debugPrint(debug_, "search", 3, "postponed latch eval %d %s -> %s %d",
+            debugPrintHot(debug_, "search", 3, "postponed latch eval %d %s -> %s %d",
                        d_clk_level,
                        d_clk_vertex->to_string(this).c_str(),
                        edge->to_string(this).c_str(),
@@ -2829,7 +3195,16 @@ TagGroup *
 Search::findTagGroup(TagGroupBldr *tag_bldr)
 {
   TagGroup probe(tag_bldr, this);
-  LockGuard lock(tag_group_lock_);
+  {
+    // Read-mostly after the first arrival pass; probe under a shared
+    // lock so arrival threads do not serialize here.
+    std::shared_lock<std::shared_mutex> lock(tag_group_lock_);
+    TagGroup *tag_group = tag_group_set_->findKey(&probe);
+    if (tag_group)
+      return tag_group;
+  }
+  std::unique_lock<std::shared_mutex> lock(tag_group_lock_);
+  // Another thread may have interned the group between the locks.
   TagGroup *tag_group = tag_group_set_->findKey(&probe);
   if (tag_group == nullptr) {
     TagGroupIndex tag_group_index;
@@ -2865,6 +3240,7 @@ void
 Search::setVertexArrivals(Vertex *vertex,
 			  TagGroupBldr *tag_bldr)
 {
+  incrPathGeneration();
   if (tag_bldr->empty())
     deletePathsIncr(vertex);
   else {
@@ -2872,12 +3248,19 @@ Search::setVertexArrivals(Vertex *vertex,
     Path *prev_paths = graph_->paths(vertex);
     TagGroup *tag_group = findTagGroup(tag_bldr);
     if (tag_group == prev_tag_group) {
+      if (path_journal_active_)
+        journalPathsCopy(vertex);
       tag_bldr->copyPaths(tag_group, prev_paths);
       requiredInvalid(vertex);
     }
     else {
+      if (path_journal_active_)
+        journalPathsReplace(vertex);
       if (prev_tag_group) {
-        graph_->deletePaths(vertex);
+        // Keep the displaced array alive for rollback when the
+        // journal is active.
+        if (!path_journal_active_)
+          graph_->deletePaths(vertex);
 	prev_tag_group->decrRefCount();
         requiredInvalid(vertex);
       }
@@ -3051,6 +3434,26 @@ Search::reportPathCountHistogram() const
   }
 }
 
+void
+Search::memoryUsage(size_t &object_count,
+		    size_t &bytes) const
+{
+  size_t tag_count = tagCount();
+  size_t tag_group_count = tagGroupCount();
+  object_count = tag_count + tag_group_count;
+  bytes = tag_count * sizeof(Tag)
+    + tag_capacity_ * sizeof(Tag*)
+    + tag_group_count * sizeof(TagGroup)
+    + tag_group_capacity_ * sizeof(TagGroup*);
+  // Path index maps; four pointers of tree node overhead per entry.
+  for (TagGroupIndex i = 0; i < tag_group_next_; i++) {
+    TagGroup *tag_group = tag_groups_[i];
+    if (tag_group)
+      bytes += tag_group->pathCount()
+	* (sizeof(PathIndexMap::value_type) + sizeof(void*) * 4);
+  }
+}
+
 ////////////////////////////////////////////////////////////////
 
 Tag *
@@ -3065,6 +3468,54 @@ Search::tagCount() const
   return tag_set_->size();
 }
 
+size_t
+ExceptionStateSetHash::operator()(const ExceptionStateSet *states) const
+{
+  size_t hash = hash_init_value;
+  for (ExceptionState *state : *states)
+    hashIncr(hash, state->hash());
+  return hash;
+}
+
+bool
+ExceptionStateSetEqual::operator()(const ExceptionStateSet *states1,
+                                   const ExceptionStateSet *states2) const
+{
+  if (states1->size() != states2->size())
+    return false;
+  // States are unique per exception point and the sets share a sort
+  // order, so equal sets have the same states in the same order.
+  ExceptionStateSet::ConstIterator state_iter1(states1);
+  ExceptionStateSet::ConstIterator state_iter2(states2);
+  while (state_iter1.hasNext()
+	 && state_iter2.hasNext()) {
+    if (state_iter1.next() != state_iter2.next())
+      return false;
+  }
+  return true;
+}
+
+// Intern exception state sets so tags with equal states share one
+// canonical set and tag state comparisons are pointer compares.
+// The caller must hold tag_lock_.
+ExceptionStateSet *
+Search::internStates(ExceptionStateSet *states,
+                     bool own_states)
+{
+  if (states == nullptr)
+    return nullptr;
+  ExceptionStateSet *canon_states = state_set_set_->findKey(states);
+  if (canon_states) {
+    if (own_states)
+      delete states;
+    return canon_states;
+  }
+  if (!own_states)
+    states = new ExceptionStateSet(*states);
+  state_set_set_->insert(states);
+  return states;
+}
+
 Tag *
 Search::findTag(const RiseFall *rf,
                 const PathAnalysisPt *path_ap,
@@ -3083,11 +3534,25 @@ Search::findTag(const RiseFall *rf,
     if (tag)
       return tag;
   }
-  LockGuard lock(tag_lock_);
+  {
+    // Read-mostly after the first arrival pass; probe under a shared
+    // lock so arrival threads do not serialize here.
+    std::shared_lock<std::shared_mutex> lock(tag_lock_);
+    Tag *tag = tag_set_->findKey(&probe);
+    if (tag) {
+      if (own_states)
+        delete states;
+      if (tag_cache)
+        tag_cache->insert(tag);
+      return tag;
+    }
+  }
+  std::unique_lock<std::shared_mutex> lock(tag_lock_);
+  // Another thread may have interned the tag between the locks.
   Tag *tag = tag_set_->findKey(&probe);
   if (tag == nullptr) {
-    ExceptionStateSet *new_states = !own_states && states
-      ? new ExceptionStateSet(*states) : states;
+    ExceptionStateSet *new_states = internStates(states, own_states);
+    own_states = false;
     TagIndex tag_index;
     if (tag_free_indices_.empty())
       tag_index = tag_next_++;
@@ -3095,10 +3560,10 @@ Search::findTag(const RiseFall *rf,
       tag_index = tag_free_indices_.back();
       tag_free_indices_.pop_back();
     }
+    // The interned state set is shared, so the tag does not own it.
     tag = new Tag(tag_index, rf->index(), path_ap->index(),
                   clk_info, is_clk, input_delay, is_segment_start,
-                  new_states, true, this);
-    own_states = false;
+                  new_states, false, this);
     // Make sure tag can be indexed in tags_ before it is visible to
     // other threads via tag_set_.
     tags_[tag_index] = tag;
@@ -3351,6 +3816,7 @@ Search::findRequireds()
 void
 Search::findRequireds(Level level)
 {
+  ProfilePhase phase("Find requireds");
   Stats stats(debug_, report_);
   debugPrint(debug_, "search", 1, "find requireds to level %d", level);
   RequiredVisitor req_visitor(this);
@@ -3368,8 +3834,35 @@ void
 Search::seedRequireds()
 {
   ensureDownstreamClkPins();
-  for (Vertex *vertex : *endpoints())
-    seedRequired(vertex);
+  VertexSet *endpoints = this->endpoints();
+  if (thread_count_ <= 1
+      || endpoints->size() < static_cast<size_t>(thread_count_)) {
+    for (Vertex *vertex : *endpoints)
+      seedRequired(vertex);
+  }
+  else {
+    // Re-evaluating the endpoint path ends dominates the reseed, so
+    // fan the endpoints out across the thread pool.  seedRequired
+    // only enqueues fanin vertices when an endpoint required actually
+    // changes, which keeps the back-propagation scoped to the damaged
+    // cones.
+    VertexSeq endpoint_seq;
+    endpoint_seq.reserve(endpoints->size());
+    for (Vertex *vertex : *endpoints)
+      endpoint_seq.push_back(vertex);
+    size_t endpoint_count = endpoint_seq.size();
+    size_t chunk_size = endpoint_count / thread_count_ + 1;
+    size_t from = 0;
+    for (int k = 0; k < thread_count_ && from < endpoint_count; k++) {
+      size_t to = min(from + chunk_size, endpoint_count);
+      dispatch_queue_->dispatch([this, &endpoint_seq, from, to](int) {
+	for (size_t i = from; i < to; i++)
+	  seedRequired(endpoint_seq[i]);
+      });
+      from = to;
+    }
+    dispatch_queue_->finishTasks();
+  }
   requireds_seeded_ = true;
   requireds_exist_ = true;
 }
@@ -3380,20 +3873,54 @@ Search::endpoints()
   if (endpoints_ == nullptr) {
     endpoints_ = new VertexSet(graph_);
     invalid_endpoints_ = new VertexSet(graph_);
+    // Classifying endpoints visits every vertex and evaluates gated
+    // clock enables, so sweep it with the dispatch queue workers.
+    VertexSeq vertices;
+    vertices.reserve(graph_->vertexCount());
     VertexIterator vertex_iter(graph_);
-    while (vertex_iter.hasNext()) {
-      Vertex *vertex = vertex_iter.next();
-      if (isEndpoint(vertex)) {
-	debugPrint(debug_, "endpoint", 2, "insert %s",
-                   vertex->to_string(this).c_str());
-	endpoints_->insert(vertex);
+    while (vertex_iter.hasNext())
+      vertices.push_back(vertex_iter.next());
+    size_t vertex_count = vertices.size();
+    size_t thread_count = thread_count_;
+    if (dispatch_queue_ && thread_count > 1) {
+      std::vector<VertexSeq> found(thread_count);
+      size_t chunk_size = vertex_count / thread_count + 1;
+      size_t from = 0;
+      for (size_t k = 0; k < thread_count && from < vertex_count; k++) {
+	size_t to = std::min(from + chunk_size, vertex_count);
+	VertexSeq &ends = found[k];
+	dispatch_queue_->dispatch([this, &vertices, &ends, from, to](int) {
+	  for (size_t i = from; i < to; i++) {
+	    Vertex *vertex = vertices[i];
+	    if (isEndpoint(vertex))
+	      ends.push_back(vertex);
+	  }
+	});
+	from = to;
+      }
+      dispatch_queue_->finishTasks();
+      for (VertexSeq &ends : found) {
+	for (Vertex *vertex : ends) {
+	  debugPrintHot(debug_, "endpoint", 2, "insert %s",
+		     vertex->to_string(this).c_str());
+	  endpoints_->insert(vertex);
+	}
+      }
+    }
+    else {
+      for (Vertex *vertex : vertices) {
+	if (isEndpoint(vertex)) {
+	  debugPrintHot(debug_, "endpoint", 2, "insert %s",
+		     vertex->to_string(this).c_str());
+	  endpoints_->insert(vertex);
+	}
       }
     }
   }
   if (invalid_endpoints_) {
     for (Vertex *vertex : *invalid_endpoints_) {
       if (isEndpoint(vertex)) {
-	debugPrint(debug_, "endpoint", 2, "insert %s",
+	debugPrintHot(debug_, "endpoint", 2, "insert %s",
                    vertex->to_string(this).c_str());
 	endpoints_->insert(vertex);
       }
@@ -3414,7 +3941,7 @@ void
 Search::endpointInvalid(Vertex *vertex)
 {
   if (invalid_endpoints_) {
-    debugPrint(debug_, "endpoint", 2, "invalid %s",
+    debugPrintHot(debug_, "endpoint", 2, "invalid %s",
                vertex->to_string(this).c_str());
     invalid_endpoints_->insert(vertex);
   }
@@ -3534,7 +4061,7 @@ FindEndRequiredVisitor::visit(PathEnd *path_end)
 void
 Search::seedRequired(Vertex *vertex)
 {
-  debugPrint(debug_, "search", 2, "required seed %s",
+  debugPrintHot(debug_, "search", 2, "required seed %s",
              vertex->to_string(this).c_str());
   RequiredCmp required_cmp;
   FindEndRequiredVisitor seeder(&required_cmp, this);
@@ -3591,16 +4118,20 @@ RequiredCmp::requiredSet(size_t path_index,
 			 const MinMax *min_max,
 			 const StaState *sta)
 {
-  if (delayGreater(required, requireds_[path_index], min_max, sta)) {
-    requireds_[path_index] = required;
-    have_requireds_ = true;
-  }
+  // Branchless merge; the compare compiles to a select with the
+  // branchless fuzzy comparisons, sparing a mispredict per path.
+  bool greater = delayGreater(required, requireds_[path_index], min_max, sta);
+  requireds_[path_index] = greater ? required : requireds_[path_index];
+  have_requireds_ = have_requireds_ | greater;
 }
 
 bool
 RequiredCmp::requiredsSave(Vertex *vertex,
 			   const StaState *sta)
 {
+  Search *search = sta->search();
+  if (search->pathJournalActive())
+    search->journalPathsCopy(vertex);
   bool requireds_changed = false;
   Debug *debug = sta->debug();
   VertexPathIterator path_iter(vertex, sta);
@@ -3610,7 +4141,7 @@ RequiredCmp::requiredsSave(Vertex *vertex,
     Required req = requireds_[path_index];
     Required &prev_req = path->required();
     bool changed = !delayEqual(prev_req, req);
-    debugPrint(debug, "search", 3, "required %s save %s -> %s%s",
+    debugPrintHot(debug, "search", 3, "required %s save %s -> %s%s",
                path->to_string(sta).c_str(),
                delayAsString(prev_req, sta),
                delayAsString(req, sta),
@@ -3659,7 +4190,8 @@ RequiredVisitor::copy() const
 void
 RequiredVisitor::visit(Vertex *vertex)
 {
-  debugPrint(debug_, "search", 2, "find required %s",
+  incrQueryCounter(QueryCounter::required_visit);
+  debugPrintHot(debug_, "search", 2, "find required %s",
              vertex->to_string(this).c_str());
   required_cmp_->requiredsInit(vertex, this);
   // Back propagate requireds from fanout.
@@ -3695,11 +4227,11 @@ RequiredVisitor::visitFromToPath(const Pin *,
 {
   // Don't propagate required times through latch D->Q edges.
   if (edge->role() != TimingRole::latchDtoQ()) {
-    debugPrint(debug_, "search", 3, "  %s -> %s %s",
+    debugPrintHot(debug_, "search", 3, "  %s -> %s %s",
                from_rf->to_string().c_str(),
                to_rf->to_string().c_str(),
                min_max->to_string().c_str());
-    debugPrint(debug_, "search", 3, "  from tag %2u: %s",
+    debugPrintHot(debug_, "search", 3, "  from tag %2u: %s",
                from_tag->index(),
                from_tag->to_string(this).c_str());
     size_t path_index = from_path->pathIndex(this);
@@ -3711,10 +4243,10 @@ RequiredVisitor::visitFromToPath(const Pin *,
       Path &to_path = to_vertex->paths()[to_path_index];
       Required &to_required = to_path.required();
       Required from_required = to_required - arc_delay;
-      debugPrint(debug_, "search", 3, "  to tag   %2u: %s",
+      debugPrintHot(debug_, "search", 3, "  to tag   %2u: %s",
                  to_tag->index(),
                  to_tag->to_string(this).c_str());
-      debugPrint(debug_, "search", 3, "  %s - %s = %s %s %s",
+      debugPrintHot(debug_, "search", 3, "  %s - %s = %s %s %s",
                  delayAsString(to_required, this),
                  delayAsString(arc_delay, this),
                  delayAsString(from_required, this),
@@ -3734,10 +4266,10 @@ RequiredVisitor::visitFromToPath(const Pin *,
 	  if (Tag::matchNoCrpr(to_path_tag, to_tag)) {
 	    Required to_required = to_path->required();
 	    Required from_required = to_required - arc_delay;
-	    debugPrint(debug_, "search", 3, "  to tag   %2u: %s",
+	    debugPrintHot(debug_, "search", 3, "  to tag   %2u: %s",
                        to_path_tag->index(),
                        to_path_tag->to_string(this).c_str());
-	    debugPrint(debug_, "search", 3, "  %s - %s = %s %s %s",
+	    debugPrintHot(debug_, "search", 3, "  %s - %s = %s %s %s",
                        delayAsString(to_required, this),
                        delayAsString(arc_delay, this),
                        delayAsString(from_required, this),
@@ -3915,7 +4447,7 @@ Search::totalNegativeSlack(const MinMax *min_max)
   Slack tns = 0.0;
   for (Corner *corner : *corners_) {
     PathAPIndex path_ap_index = corner->findPathAnalysisPt(min_max)->index();
-    Slack tns1 = tns_[path_ap_index];
+    Slack tns1 = tns_[path_ap_index].tns();
     if (delayLess(tns1, tns, this))
       tns = tns1;
   }
@@ -3928,7 +4460,7 @@ Search::totalNegativeSlack(const Corner *corner,
 {
   tnsPreamble();
   PathAPIndex path_ap_index = corner->findPathAnalysisPt(min_max)->index();
-  return tns_[path_ap_index];
+  return tns_[path_ap_index].tns();
 }
 
 void
@@ -3937,7 +4469,6 @@ Search::tnsPreamble()
   wnsTnsPreamble();
   PathAPIndex path_ap_count = corners_->pathAnalysisPtCount();
   tns_.resize(path_ap_count);
-  tns_slacks_.resize(path_ap_count);
   if (tns_exists_)
     updateInvalidTns();
   else
@@ -3949,7 +4480,7 @@ Search::tnsInvalid(Vertex *vertex)
 {
   if ((tns_exists_ || worst_slacks_)
       && isEndpoint(vertex)) {
-    debugPrint(debug_, "tns", 2, "tns invalid %s",
+    debugPrintHot(debug_, "tns", 2, "tns invalid %s",
                vertex->to_string(this).c_str());
     LockGuard lock(tns_lock_);
     invalid_tns_->insert(vertex);
@@ -3959,20 +4490,23 @@ Search::tnsInvalid(Vertex *vertex)
 void
 Search::updateInvalidTns()
 {
-  PathAPIndex path_ap_count = corners_->pathAnalysisPtCount();
+  VertexSeq ends;
+  ends.reserve(invalid_tns_->size());
   for (Vertex *vertex : *invalid_tns_) {
     // Network edits can change endpointedness since tnsInvalid was called.
-    if (isEndpoint(vertex)) {
-      debugPrint(debug_, "tns", 2, "update tns %s",
-                 vertex->to_string(this).c_str());
-      SlackSeq slacks(path_ap_count);
-      wnsSlacks(vertex, slacks);
-
-      if (tns_exists_)
-	updateTns(vertex, slacks);
-      if (worst_slacks_)
-	worst_slacks_->updateWorstSlacks(vertex, slacks);
-    }
+    if (isEndpoint(vertex))
+      ends.push_back(vertex);
+  }
+  std::vector<SlackSeq> slacks;
+  wnsSlacks(ends, slacks);
+  for (size_t i = 0; i < ends.size(); i++) {
+    Vertex *vertex = ends[i];
+    debugPrintHot(debug_, "tns", 2, "update tns %s",
+               vertex->to_string(this).c_str());
+    if (tns_exists_)
+      updateTns(vertex, slacks[i]);
+    if (worst_slacks_)
+      worst_slacks_->updateWorstSlacks(vertex, slacks[i]);
   }
   invalid_tns_->clear();
 }
@@ -3981,16 +4515,17 @@ void
 Search::findTotalNegativeSlacks()
 {
   PathAPIndex path_ap_count = corners_->pathAnalysisPtCount();
-  for (PathAPIndex i = 0; i < path_ap_count; i++) {
-    tns_[i] = 0.0;
-    tns_slacks_[i].clear();
-  }
-  for (Vertex *vertex : *endpoints()) {
-    // No locking required.
-    SlackSeq slacks(path_ap_count);
-    wnsSlacks(vertex, slacks);
+  for (PathAPIndex i = 0; i < path_ap_count; i++)
+    tns_[i].clear();
+  VertexSeq ends;
+  ends.reserve(endpoints()->size());
+  for (Vertex *vertex : *endpoints())
+    ends.push_back(vertex);
+  std::vector<SlackSeq> end_slacks;
+  wnsSlacks(ends, end_slacks);
+  for (size_t j = 0; j < ends.size(); j++) {
     for (PathAPIndex i = 0; i < path_ap_count; i++)
-      tnsIncr(vertex, slacks[i], i);
+      tnsIncr(ends[j], end_slacks[j][i], i);
   }
   tns_exists_ = true;
 }
@@ -4012,13 +4547,12 @@ Search::tnsIncr(Vertex *vertex,
 		PathAPIndex path_ap_index)
 {
   if (delayLess(slack, 0.0, this)) {
-    debugPrint(debug_, "tns", 3, "tns+ %s %s",
+    debugPrintHot(debug_, "tns", 3, "tns+ %s %s",
                delayAsString(slack, this),
                vertex->to_string(this).c_str());
-    tns_[path_ap_index] += slack;
-    if (tns_slacks_[path_ap_index].hasKey(vertex))
+    if (tns_[path_ap_index].hasVertex(vertex))
       report_->critical(1513, "tns incr existing vertex");
-    tns_slacks_[path_ap_index][vertex] = slack;
+    tns_[path_ap_index].setSlack(vertex, slack);
   }
 }
 
@@ -4027,15 +4561,11 @@ Search::tnsDecr(Vertex *vertex,
 		PathAPIndex path_ap_index)
 {
   Slack slack;
-  bool found;
-  tns_slacks_[path_ap_index].findKey(vertex, slack, found);
-  if (found
-      && delayLess(slack, 0.0, this)) {
-    debugPrint(debug_, "tns", 3, "tns- %s %s",
+  if (tns_[path_ap_index].findSlack(vertex, slack)) {
+    debugPrintHot(debug_, "tns", 3, "tns- %s %s",
                delayAsString(slack, this),
                vertex->to_string(this).c_str());
-    tns_[path_ap_index] -= slack;
-    tns_slacks_[path_ap_index].erase(vertex);
+    tns_[path_ap_index].eraseSlack(vertex);
   }
 }
 
@@ -4075,6 +4605,99 @@ Search::worstSlack(const Corner *corner,
   worst_slacks_->worstSlack(corner, min_max, worst_slack, worst_vertex);
 }
 
+VertexSeq
+Search::worstSlacks(const Corner *corner,
+		    const MinMax *min_max,
+		    size_t count)
+{
+  worstSlackPreamble();
+  return worst_slacks_->worstSlacks(corner, min_max, count);
+}
+
+std::vector<size_t>
+Search::endpointSlackHistogram(const Corner *corner,
+			       const MinMax *min_max,
+			       size_t bin_count,
+			       // Return values.
+			       Slack &slack_min,
+			       Slack &slack_max)
+{
+  wnsTnsPreamble();
+  std::vector<PathAPIndex> path_ap_indices;
+  for (Corner *corner1 : *corners_) {
+    if (corner == nullptr
+	|| corner1 == corner)
+      path_ap_indices.push_back(corner1->findPathAnalysisPt(min_max)->index());
+  }
+  VertexSeq ends;
+  ends.reserve(endpoints()->size());
+  for (Vertex *vertex : *endpoints())
+    ends.push_back(vertex);
+  std::vector<SlackSeq> end_slacks;
+  wnsSlacks(ends, end_slacks);
+
+  // Worst slack per endpoint across the requested corners.
+  // Unconstrained endpoints have no slack and are not counted.
+  const Slack slack_init = MinMax::min()->initValue();
+  std::vector<Slack> slacks;
+  slacks.reserve(ends.size());
+  for (size_t i = 0; i < ends.size(); i++) {
+    Slack slack = slack_init;
+    for (PathAPIndex path_ap_index : path_ap_indices) {
+      Slack slack1 = end_slacks[i][path_ap_index];
+      if (delayLess(slack1, slack, this))
+	slack = slack1;
+    }
+    if (!delayEqual(slack, slack_init))
+      slacks.push_back(slack);
+  }
+
+  std::vector<size_t> bins;
+  if (!slacks.empty()) {
+    slack_min = slacks[0];
+    slack_max = slacks[0];
+    for (Slack slack : slacks) {
+      if (delayLess(slack, slack_min, this))
+	slack_min = slack;
+      if (delayGreater(slack, slack_max, this))
+	slack_max = slack;
+    }
+    bins.resize(bin_count);
+    float width = (delayAsFloat(slack_max) - delayAsFloat(slack_min))
+      / bin_count;
+    for (Slack slack : slacks) {
+      size_t bin = 0;
+      if (width > 0.0)
+	bin = std::min(static_cast<size_t>((delayAsFloat(slack)
+					    - delayAsFloat(slack_min)) / width),
+		       bin_count - 1);
+      bins[bin]++;
+    }
+  }
+  return bins;
+}
+
+// The cached slacks only describe full-graph arrivals, so the index
+// cannot be used (or updated) while filtered or cone-limited arrivals
+// are in place.  Making the index on first use costs one path end
+// sweep per analysis point; after that it is maintained
+// incrementally, so repeated slack-limited reports skip the clean
+// endpoints.
+WorstSlacks *
+Search::endpointSlackIndex()
+{
+  if (arrivals_exist_
+      && filter_ == nullptr
+      && !arrival_cone_active_) {
+    if (worst_slacks_)
+      updateInvalidTns();
+    else
+      worst_slacks_ = new WorstSlacks(this);
+    return worst_slacks_;
+  }
+  return nullptr;
+}
+
 void
 Search::worstSlackPreamble()
 {
@@ -4093,7 +4716,7 @@ Search::wnsTnsPreamble()
   if (requireds_seeded_) {
     for (auto itr = invalid_requireds_->begin(); itr != invalid_requireds_->end(); ) {
       Vertex *vertex = *itr;
-      debugPrint(debug_, "search", 2, "tns update required %s",
+      debugPrintHot(debug_, "search", 2, "tns update required %s",
                  vertex->to_string(this).c_str());
       if (isEndpoint(vertex)) {
 	seedRequired(vertex);
@@ -4192,6 +4815,43 @@ Search::wnsSlacks(Vertex *vertex,
   }
 }
 
+// Evaluate endpoint slacks across the thread pool.  wnsSlacks only
+// reads paths and constraints and each worker writes disjoint slots
+// of the result vector, so no locking is required.
+void
+Search::wnsSlacks(const VertexSeq &vertices,
+		  // Return values.
+		  std::vector<SlackSeq> &slacks)
+{
+  PathAPIndex path_ap_count = corners_->pathAnalysisPtCount();
+  size_t vertex_count = vertices.size();
+  slacks.resize(vertex_count);
+  size_t thread_count = thread_count_;
+  if (dispatch_queue_ && thread_count > 1
+      && vertex_count >= thread_count) {
+    size_t chunk_size = vertex_count / thread_count + 1;
+    size_t from = 0;
+    for (size_t k = 0; k < thread_count && from < vertex_count; k++) {
+      size_t to = std::min(from + chunk_size, vertex_count);
+      dispatch_queue_->dispatch([this, &vertices, &slacks,
+				 path_ap_count, from, to](int) {
+	for (size_t i = from; i < to; i++) {
+	  slacks[i].resize(path_ap_count);
+	  wnsSlacks(vertices[i], slacks[i]);
+	}
+      });
+      from = to;
+    }
+    dispatch_queue_->finishTasks();
+  }
+  else {
+    for (size_t i = 0; i < vertex_count; i++) {
+      slacks[i].resize(path_ap_count);
+      wnsSlacks(vertices[i], slacks[i]);
+    }
+  }
+}
+
 Slack
 Search::wnsSlack(Vertex *vertex,
 		 PathAPIndex path_ap_index)
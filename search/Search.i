@@ -33,8 +33,14 @@
 #include "search/ReportPath.hh"
 #include "PathExpanded.hh"
 #include "Bfs.hh"
+#include "DispatchQueue.hh"
 #include "Sta.hh"
 
+#ifndef _WIN32
+  #include <unistd.h>
+  #include <sys/wait.h>
+#endif
+
 using namespace sta;
 
 %}
@@ -146,9 +152,52 @@ delete_all_memory()
 ////////////////////////////////////////////////////////////////
 
 void
-find_timing_cmd(bool full)
+find_timing_cmd(bool full,
+		Corner *corner)
 {
-  Sta::sta()->updateTiming(full);
+  Sta::sta()->updateTiming(full, corner);
+}
+
+void
+find_timing_background_cmd(bool full)
+{
+  Sta::sta()->updateTimingBackground(full);
+}
+
+bool
+timing_update_running()
+{
+  return Sta::sta()->updateTimingRunning();
+}
+
+int
+timing_update_level()
+{
+  return Sta::sta()->updateTimingLevel();
+}
+
+int
+timing_update_max_level()
+{
+  return Sta::sta()->updateTimingMaxLevel();
+}
+
+int
+timing_update_visit_count()
+{
+  return Sta::sta()->updateTimingVisitCount();
+}
+
+void
+cancel_update_timing()
+{
+  Sta::sta()->cancelUpdateTiming();
+}
+
+void
+wait_update_timing()
+{
+  Sta::sta()->waitUpdateTiming();
 }
 
 void
@@ -158,6 +207,103 @@ arrivals_invalid()
   sta->arrivalsInvalid();
 }
 
+bool
+save_timing_checkpoint_cmd(const char *filename)
+{
+  return Sta::sta()->writeTimingCheckpoint(filename);
+}
+
+bool
+restore_timing_checkpoint_cmd(const char *filename)
+{
+  return Sta::sta()->readTimingCheckpoint(filename);
+}
+
+void
+begin_probe_cmd()
+{
+  Sta::sta()->beginProbe();
+}
+
+void
+end_probe_cmd()
+{
+  Sta::sta()->endProbe();
+}
+
+// Fork a worker process that shares the loaded design copy-on-write
+// and evaluates script with its output redirected to log.
+// Returns the worker process id, or -1 if forking is unsupported
+// or failed.
+int
+fork_worker_cmd(const char *script,
+                const char *log)
+{
+#ifdef _WIN32
+  return -1;
+#else
+  Sta *sta = Sta::sta();
+  fflush(stdout);
+  fflush(stderr);
+  pid_t pid = fork();
+  if (pid == 0) {
+    // Child worker.
+    if (freopen(log, "w", stdout) == nullptr)
+      _exit(1);
+    dup2(fileno(stdout), fileno(stderr));
+    // The dispatch queue threads were not forked with the process.
+    if (sta->dispatchQueue())
+      sta->dispatchQueue()->restartAfterFork();
+    int result = Tcl_EvalFile(sta->tclInterp(), script);
+    fflush(stdout);
+    fflush(stderr);
+    _exit(result == TCL_OK ? 0 : 1);
+  }
+  return pid;
+#endif
+}
+
+// Fork a server query worker that shares the loaded design
+// copy-on-write.  Unlike fork_worker_cmd the child returns to the
+// caller, which continues in the worker's copy of the interpreter.
+// Returns the worker process id, 0 in the worker itself, or -1 if
+// forking is unsupported or failed.
+int
+fork_query_worker_cmd()
+{
+#ifdef _WIN32
+  return -1;
+#else
+  Sta *sta = Sta::sta();
+  fflush(stdout);
+  fflush(stderr);
+  pid_t pid = fork();
+  if (pid == 0) {
+    // The dispatch queue threads were not forked with the process.
+    if (sta->dispatchQueue())
+      sta->dispatchQueue()->restartAfterFork();
+  }
+  return pid;
+#endif
+}
+
+// Wait for a forked worker to finish; returns its exit status,
+// or -1 if the wait failed.
+int
+wait_worker_cmd(int pid)
+{
+#ifdef _WIN32
+  return -1;
+#else
+  int status = 0;
+  if (waitpid(pid, &status, 0) != pid)
+    return -1;
+  if (WIFEXITED(status))
+    return WEXITSTATUS(status);
+  return -1;
+#endif
+}
+
 PinSet
 startpoints()
 {
@@ -195,6 +341,15 @@ total_negative_slack_corner_cmd(const Corner *corner,
   return Sta::sta()->totalNegativeSlack(corner, min_max);
 }
 
+void
+report_slack_histogram_cmd(const Corner *corner,
+			   const MinMax *min_max,
+			   int bin_count,
+			   int digits)
+{
+  Sta::sta()->reportSlackHistogram(corner, min_max, bin_count, digits);
+}
+
 Slack
 worst_slack_cmd(const MinMax *min_max)
 {
@@ -399,6 +554,45 @@ find_path_ends(ExceptionFrom *from,
   return ends;
 }
 
+// Streaming variant of find_path_ends + report_path_ends: each path
+// end is reported as it is produced instead of being gathered into
+// one sequence, bounding reporting memory.
+void
+report_path_ends_streamed(ExceptionFrom *from,
+			  ExceptionThruSeq *thrus,
+			  ExceptionTo *to,
+			  bool unconstrained,
+			  Corner *corner,
+			  const MinMaxAll *delay_min_max,
+			  int group_path_count,
+			  int endpoint_path_count,
+			  bool unique_pins,
+			  bool unique_edges,
+			  float slack_min,
+			  float slack_max,
+			  bool sort_by_slack,
+			  PathGroupNameSet *groups,
+			  bool setup,
+			  bool hold,
+			  bool recovery,
+			  bool removal,
+			  bool clk_gating_setup,
+			  bool clk_gating_hold)
+{
+  Sta *sta = Sta::sta();
+  sta->reportPathEndsStreamed(from, thrus, to, unconstrained,
+                              corner, delay_min_max,
+                              group_path_count, endpoint_path_count,
+                              unique_pins, unique_edges,
+                              slack_min, slack_max,
+                              sort_by_slack,
+                              groups->size() ? groups : nullptr,
+                              setup, hold,
+                              recovery, removal,
+                              clk_gating_setup, clk_gating_hold);
+  delete groups;
+}
+
 ////////////////////////////////////////////////////////////////
 
 void
@@ -983,6 +1177,18 @@ find_fanout_insts(PinSeq *from,
 //
 ////////////////////////////////////////////////////////////////
 
+bool
+thread_affinity_enabled()
+{
+  return Sta::sta()->threadAffinityEnabled();
+}
+
+void
+set_thread_affinity_enabled(bool enabled)
+{
+  Sta::sta()->setThreadAffinityEnabled(enabled);
+}
+
 bool
 crpr_enabled()
 {
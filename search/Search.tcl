@@ -86,8 +86,116 @@ proc check_setup_cmd { cmd cmd_args } {
 # Not a command because users have no reason to ever call this.
 # It is only useful for debugging incremental timing updates.
 proc find_timing { args } {
-  parse_key_args "find_timing" args keys {} flags {-full_update}
-  find_timing_cmd [info exists flags(-full_update)]
+  parse_key_args "find_timing" args keys {-corner} flags {-full_update -background}
+  # -corner scopes a -full_update to one corner's analysis points;
+  # the other corners' delays and arrivals stay live.
+  set corner [parse_corner_or_all keys]
+  if { [info exists flags(-background)] } {
+    find_timing_background_cmd [info exists flags(-full_update)]
+  } else {
+    find_timing_cmd [info exists flags(-full_update)] $corner
+  }
+}
+
+################################################################
+
+define_cmd_args "get_timing_progress" {}
+
+# Progress of a find_timing -background update as a
+# {running level max_level visited_vertex_count} list.
+proc get_timing_progress { } {
+  return [list [timing_update_running] [timing_update_level] \
+	    [timing_update_max_level] [timing_update_visit_count]]
+}
+
+define_cmd_args "cancel_find_timing" {}
+
+# Stop a background update at the next level boundary.  The update
+# resumes where it stopped at the next timing command.
+proc cancel_find_timing { } {
+  cancel_update_timing
+}
+
+################################################################
+
+define_cmd_args "save_timing_checkpoint" {filename}
+
+proc_redirect save_timing_checkpoint {
+  check_argc_eq1 "save_timing_checkpoint" $args
+  save_timing_checkpoint_cmd [file nativename [lindex $args 0]]
+}
+
+define_cmd_args "restore_timing_checkpoint" {filename}
+
+proc_redirect restore_timing_checkpoint {
+  check_argc_eq1 "restore_timing_checkpoint" $args
+  restore_timing_checkpoint_cmd [file nativename [lindex $args 0]]
+}
+
+################################################################
+
+# Bracket a what-if probe (change, query, undo).  Delay and arrival
+# changes made between begin_probe and end_probe are journaled and
+# rolled back by end_probe instead of being invalidated and
+# re-solved.  The probe's netlist edits must be undone (eg the cell
+# swapped back) before end_probe.  Probes do not nest.
+define_cmd_args "begin_probe" {}
+
+proc begin_probe { } {
+  begin_probe_cmd
+}
+
+define_cmd_args "end_probe" {}
+
+proc end_probe { } {
+  end_probe_cmd
+}
+
+################################################################
+
+# Scatter/gather over forked worker processes that share the loaded
+# design copy-on-write, so the netlist and libraries are read once.
+# Each worker is a {script log} pair; the script typically applies one
+# corner's constraints and reports, with output in its log file.
+# With -presolve the timing is brought up to date before forking so
+# report-only workers also share the computed delays and arrivals
+# instead of each re-solving them privately.
+define_cmd_args "fork_timing_workers" { [-presolve] {script log}... }
+
+proc fork_timing_workers { args } {
+  parse_key_args "fork_timing_workers" args keys {} flags {-presolve}
+  check_argc_eq1 "fork_timing_workers" $args
+  set workers [lindex $args 0]
+  if { [info exists flags(-presolve)] } {
+    find_timing_cmd 0 "NULL"
+    find_requireds
+  }
+  set pids {}
+  foreach worker $workers {
+    if { [llength $worker] != 2 } {
+      sta_error 2209 "worker must be a {script log} pair."
+    }
+    lassign $worker script log
+    if { ![file readable $script] } {
+      sta_error 2210 "worker script $script is not readable."
+    }
+    set pid [fork_worker_cmd [file nativename $script] [file nativename $log]]
+    if { $pid < 0 } {
+      sta_error 2211 "failed to fork timing worker for $script."
+    }
+    lappend pids $pid
+  }
+  set failures {}
+  foreach pid $pids worker $workers {
+    if { [wait_worker_cmd $pid] != 0 } {
+      lappend failures [lindex $worker 0]
+    }
+  }
+  foreach script $failures {
+    sta_warn 2212 "timing worker $script failed."
+  }
+  # return value
+  expr [llength $failures] == 0
 }
 
 ################################################################
@@ -109,11 +217,13 @@ define_cmd_args "find_timing_paths" \
      [-path_group group_name]}
 
 proc find_timing_paths { args } {
+  begin_query_stats "find_timing_paths"
   set path_ends [find_timing_paths_cmd "find_timing_paths" args]
+  end_query_stats
   return $path_ends
 }
 
-proc find_timing_paths_cmd { cmd args_var } {
+proc find_timing_paths_cmd { cmd args_var {streamed 0} } {
   global sta_report_unconstrained_paths
   upvar 1 $args_var args
 
@@ -231,14 +341,27 @@ proc find_timing_paths_cmd { cmd args_var } {
     }
   }
 
-  set path_ends [find_path_ends $from $thrus $to $unconstrained \
-		   $corner $min_max \
-		   $group_path_count $endpoint_path_count \
-		   $unique_pins $unique_edges \
-		   $slack_min $slack_max \
-		   $sort_by_slack $groups \
-		   1 1 1 1 1 1]
-  return $path_ends
+  if { $streamed } {
+    # Stream the path ends to the report as they are found instead of
+    # materializing them.
+    report_path_ends_streamed $from $thrus $to $unconstrained \
+      $corner $min_max \
+      $group_path_count $endpoint_path_count \
+      $unique_pins $unique_edges \
+      $slack_min $slack_max \
+      $sort_by_slack $groups \
+      1 1 1 1 1 1
+    return {}
+  } else {
+    set path_ends [find_path_ends $from $thrus $to $unconstrained \
+		     $corner $min_max \
+		     $group_path_count $endpoint_path_count \
+		     $unique_pins $unique_edges \
+		     $slack_min $slack_max \
+		     $sort_by_slack $groups \
+		     1 1 1 1 1 1]
+    return $path_ends
+  }
 }
 
 ################################################################
@@ -425,7 +548,7 @@ define_cmd_args "report_checks" \
      [-slack_min slack_min]\
      [-sort_by_slack]\
      [-path_group group_name]\
-     [-format full|full_clock|full_clock_expanded|short|end|slack_only|summary|json]\
+     [-format full|full_clock|full_clock_expanded|short|end|slack_only|summary|json|json_stream]\
      [-fields capacitance|slew|fanout|input_pin|net|src_attr]\
      [-digits digits]\
      [-no_line_splits]\
@@ -433,9 +556,10 @@ define_cmd_args "report_checks" \
 
 proc_redirect report_checks {
   global sta_report_unconstrained_paths
+  begin_query_stats "report_checks"
   parse_report_path_options "report_checks" args "full" 0
-  set path_ends [find_timing_paths_cmd "report_checks" args]
-  report_path_ends $path_ends
+  find_timing_paths_cmd "report_checks" args 1
+  end_query_stats
 }
 
 ################################################################
@@ -759,6 +883,42 @@ proc_redirect report_wns {
   report_line "wns $min_max [format_time $slack $digits]"
 }
 
+################################################################
+
+define_cmd_args "report_slack_histogram" \
+  {[-min] [-max] [-corner corner] [-num_bins num_bins] [-digits digits]}
+
+proc_redirect report_slack_histogram {
+  global sta_report_default_digits
+
+  parse_key_args "report_slack_histogram" args \
+    keys {-corner -num_bins -digits} \
+    flags {-min -max}
+  check_argc_eq0 "report_slack_histogram" $args
+  set min_max "max"
+  if { [info exists flags(-min)] } {
+    set min_max "min"
+  }
+  if { [info exists flags(-max)] } {
+    set min_max "max"
+  }
+  set corner [parse_corner_or_all keys]
+  if { [info exists keys(-num_bins)] } {
+    set num_bins $keys(-num_bins)
+    check_positive_integer "-num_bins" $num_bins
+  } else {
+    set num_bins 10
+  }
+  if { [info exists keys(-digits)] } {
+    set digits $keys(-digits)
+    check_positive_integer "-digits" $digits
+  } else {
+    set digits $sta_report_default_digits
+  }
+
+  report_slack_histogram_cmd $corner $min_max $num_bins $digits
+}
+
 ################################################# ###############
 
 define_cmd_args "report_worst_slack" {[-min] [-max] [-digits digits]}
@@ -893,7 +1053,7 @@ proc parse_report_path_options { cmd args_var default_format
   if [info exists path_options(-format)] {
     set format $path_options(-format)
     set formats {full full_clock full_clock_expanded short \
-		   end slack_only summary json}
+		   end slack_only summary json json_stream}
     if { [lsearch $formats $format] == -1 } {
       sta_error 524 "-format $format not recognized."
     }
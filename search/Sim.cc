@@ -24,6 +24,9 @@
 
 #include "Sim.hh"
 
+#include <algorithm>
+#include <map>
+
 // https://davidkebo.com/cudd
 #include "cudd.h"
 
@@ -41,6 +44,8 @@
 #include "Network.hh"
 #include "Sdc.hh"
 #include "Graph.hh"
+#include "Levelize.hh"
+#include "DispatchQueue.hh"
 
 namespace sta {
 
@@ -92,7 +97,6 @@ Sim::functionSense(const FuncExpr *expr,
     decreasing = (Cudd_Decreasing(cudd_mgr, bdd, input_index)
 		  == Cudd_ReadOne(cudd_mgr));
     Cudd_RecursiveDeref(cudd_mgr, bdd);
-    bdd_.clearVarMap();
   }
   TimingSense sense;
   if (increasing && decreasing)
@@ -111,6 +115,11 @@ LogicValue
 Sim::evalExpr(const FuncExpr *expr,
 	      const Instance *inst)
 {
+  // Interned truth tables read the pin values directly and do not
+  // touch the bdd manager, so they do not need its lock.
+  FuncExprTable *table = const_cast<FuncExpr*>(expr)->table();
+  if (table)
+    return evalTable(table, inst);
   LockGuard lock(bdd_lock_);
   DdNode *bdd = funcBddSim(expr, inst);
   LogicValue value = LogicValue::unknown;
@@ -120,13 +129,50 @@ Sim::evalExpr(const FuncExpr *expr,
   else if (bdd == Cudd_ReadOne(cudd_mgr))
     value = LogicValue::one;
 
-  if (bdd) {
+  if (bdd)
     Cudd_RecursiveDeref(bdd_.cuddMgr(), bdd);
-    bdd_.clearVarMap();
-  }
   return value;
 }
 
+// Truth table lookup with instance pin values substituted.
+LogicValue
+Sim::evalTable(FuncExprTable *table,
+	       const Instance *inst)
+{
+  const LibertyPortSeq &ports = table->ports();
+  // Inputs without a zero/one pin value are unknown.
+  size_t known_index = 0;
+  size_t unknown_mask = (static_cast<size_t>(1) << ports.size()) - 1;
+  InstancePinIterator *pin_iter = network_->pinIterator(inst);
+  while (pin_iter->hasNext()) {
+    const Pin *pin = pin_iter->next();
+    const LibertyPort *port = network_->libertyPort(pin);
+    for (size_t i = 0; i < ports.size(); i++) {
+      if (ports[i] == port) {
+	size_t bit = static_cast<size_t>(1) << i;
+	LogicValue value = logicValue(pin);
+	if (value == LogicValue::zero)
+	  unknown_mask &= ~bit;
+	else if (value == LogicValue::one) {
+	  unknown_mask &= ~bit;
+	  known_index |= bit;
+	}
+      }
+    }
+  }
+  delete pin_iter;
+  // Constant only if the value matches for every combination of the
+  // unknown inputs.
+  bool value = table->value(known_index);
+  for (size_t sub = unknown_mask;
+       sub != 0;
+       sub = (sub - 1) & unknown_mask) {
+    if (table->value(known_index | sub) != value)
+      return LogicValue::unknown;
+  }
+  return value ? LogicValue::one : LogicValue::zero;
+}
+
 // BDD with instance pin values substituted.
 DdNode *
 Sim::funcBddSim(const FuncExpr *expr,
@@ -181,6 +227,10 @@ Sim::clear()
   invalid_insts_.clear();
   invalid_drvr_pins_.clear();
   invalid_load_pins_.clear();
+  eval_port_supports_.clear();
+  // Bulk reset; the memoized function bdds and variable bindings
+  // persist across evaluations within a run.
+  bdd_.clearVarMap();
 }
 
 void
@@ -400,11 +450,85 @@ Sim::seedConstants()
 void
 Sim::propagateConstants(bool thru_sequentials)
 {
-  while (!eval_queue_.empty()) {
-    const Instance *inst = eval_queue_.front();
-    eval_queue_.pop();
-    evalInstance(inst, thru_sequentials);
+  if (thread_count_ <= 1) {
+    while (!eval_queue_.empty()) {
+      const Instance *inst = eval_queue_.front();
+      eval_queue_.pop();
+      evalInstance(inst, thru_sequentials);
+    }
+  }
+  else {
+    // Evaluate the queued instances level by level, lowest first, so
+    // input values have settled before an instance is evaluated.
+    // The instances at one level are evaluated concurrently into
+    // per-instance output values that are applied serially, so the
+    // workers only read the graph and sim values are not written from
+    // multiple threads.  An instance evaluated before its inputs
+    // settle is re-enqueued when the values are applied and converges
+    // in a later pass.
+    levelize_->ensureLevelized();
+    while (!eval_queue_.empty()) {
+      std::map<Level, std::vector<const Instance*>> level_insts;
+      InstanceSet queued(network_);
+      while (!eval_queue_.empty()) {
+	const Instance *inst = eval_queue_.front();
+	eval_queue_.pop();
+	if (!queued.hasKey(inst)) {
+	  queued.insert(inst);
+	  level_insts[instLevel(inst)].push_back(inst);
+	}
+      }
+      for (auto &level_entry : level_insts) {
+	std::vector<const Instance*> &insts = level_entry.second;
+	size_t inst_count = insts.size();
+	if (inst_count < static_cast<size_t>(thread_count_)) {
+	  for (const Instance *inst : insts)
+	    evalInstance(inst, thru_sequentials);
+	}
+	else {
+	  // Probe the instance outputs on the workers to find the
+	  // instances whose values change, then re-evaluate those few
+	  // serially so the writes match the serial order.
+	  std::vector<PinValueSeq> inst_values(inst_count);
+	  size_t chunk_size = inst_count / thread_count_ + 1;
+	  size_t from = 0;
+	  for (int k = 0; k < thread_count_ && from < inst_count; k++) {
+	    size_t to = std::min(from + chunk_size, inst_count);
+	    dispatch_queue_->dispatch([this, &insts, &inst_values,
+				       thru_sequentials, from, to](int) {
+	      for (size_t i = from; i < to; i++)
+		evalInstance(insts[i], thru_sequentials, &inst_values[i]);
+	    });
+	    from = to;
+	  }
+	  dispatch_queue_->finishTasks();
+	  for (size_t i = 0; i < inst_count; i++) {
+	    if (!inst_values[i].empty())
+	      evalInstance(insts[i], thru_sequentials);
+	  }
+	}
+      }
+    }
+  }
+}
+
+// Schedule an instance at the level of its highest output so its
+// fanin has been evaluated earlier in the same pass.
+Level
+Sim::instLevel(const Instance *inst) const
+{
+  Level level = 0;
+  InstancePinIterator *pin_iter = network_->pinIterator(inst);
+  while (pin_iter->hasNext()) {
+    const Pin *pin = pin_iter->next();
+    if (network_->direction(pin)->isAnyOutput()) {
+      Vertex *vertex = graph_->pinDrvrVertex(pin);
+      if (vertex)
+	level = std::max(level, vertex->level());
+    }
   }
+  delete pin_iter;
+  return level;
 }
 
 void
@@ -545,7 +669,10 @@ Sim::setPinValue(const Pin *pin,
 
       if (network_->isLeaf(inst)
           && network_->direction(pin)->isAnyInput()) {
-        if (eval_queue_.empty() 
+        LibertyPort *port = network_->libertyPort(pin);
+        eval_port_supports_[inst] |=
+          port ? FuncExpr::portSupportBit(port) : ~uint64_t(0);
+        if (eval_queue_.empty()
             || (eval_queue_.back() != inst))
           eval_queue_.push(inst);
       }
@@ -564,11 +691,25 @@ Sim::setPinValue(const Pin *pin,
   }
 }
 
+// When values is non-null the output values are returned instead of
+// written, so the evaluation only reads the graph and can run on a
+// worker thread.
 void
 Sim::evalInstance(const Instance *inst,
-                  bool thru_sequentials)
+                  bool thru_sequentials,
+                  PinValueSeq *values)
 {
   debugPrint(debug_, "sim", 2, "eval %s", network_->pathName(inst));
+  // Support bits of the inputs that changed since the last
+  // evaluation; outputs whose functions cannot depend on them are
+  // skipped.
+  uint64_t changed_support = ~uint64_t(0);
+  auto support_iter = eval_port_supports_.find(inst);
+  if (support_iter != eval_port_supports_.end()) {
+    changed_support = support_iter->second;
+    if (values == nullptr)
+      eval_port_supports_.erase(support_iter);
+  }
   InstancePinIterator *pin_iter = network_->pinIterator(inst);
   while (pin_iter->hasNext()) {
     Pin *pin = pin_iter->next();
@@ -581,6 +722,16 @@ Sim::evalInstance(const Instance *inst,
         LibertyCell *cell = port->libertyCell();
 	if (expr) {
           FuncExpr *tri_en_expr = port->tristateEnable();
+          uint64_t support = expr->portSupport();
+          if (tri_en_expr)
+            support |= tri_en_expr->portSupport();
+          else if (thru_sequentials && expr->port()) {
+            Sequential *sequential = cell->outputPortSequential(expr->port());
+            if (sequential)
+              support = sequential->data()->portSupport();
+          }
+          if ((support & changed_support) == 0)
+            continue;
           if (tri_en_expr) {
             if (evalExpr(tri_en_expr, inst) == LogicValue::one) {
               value = evalExpr(expr, inst);
@@ -619,8 +770,12 @@ Sim::evalInstance(const Instance *inst,
                      port->name(),
                      logicValueString(value));
         }
-        if (value != logicValue(pin))
-          setPinValue(pin, value);
+        if (value != logicValue(pin)) {
+          if (values)
+            values->push_back(PinValue(pin, value));
+          else
+            setPinValue(pin, value);
+        }
       }
     }
   }
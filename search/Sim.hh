@@ -24,8 +24,11 @@
 
 #pragma once
 
+#include <cstdint>
 #include <queue>
 #include <mutex>
+#include <utility>
+#include <vector>
 
 #include "StaConfig.hh"  // CUDD
 #include "Map.hh"
@@ -38,9 +41,13 @@
 namespace sta {
 
 class SimObserver;
+class FuncExprTable;
 
 typedef Map<const Pin*, LogicValue> PinValueMap;
 typedef std::queue<const Instance*> EvalQueue;
+typedef Map<const Instance*, uint64_t> InstEvalSupportMap;
+typedef std::pair<const Pin*, LogicValue> PinValue;
+typedef std::vector<PinValue> PinValueSeq;
 
 // Propagate constants from constraints and netlist tie high/low
 // connections thru gates.
@@ -75,6 +82,8 @@ public:
   void pinSetFuncAfter(const Pin *pin);
 
 protected:
+  LogicValue evalTable(FuncExprTable *table,
+		       const Instance *inst);
   void ensureConstantFuncPins();
   void recordConstPinFunc(const Pin *pin);
   virtual void seedConstants();
@@ -88,7 +97,9 @@ protected:
 			   LogicValue value);
   void enqueue(const Instance *inst);
   void evalInstance(const Instance *inst,
-                    bool thru_sequentials);
+                    bool thru_sequentials,
+                    PinValueSeq *values = nullptr);
+  Level instLevel(const Instance *inst) const;
   LogicValue clockGateOutValue(const Instance *inst);
   TimingSense functionSense(const FuncExpr *expr,
 			    const Pin *input_pin,
@@ -132,6 +143,11 @@ protected:
   // Load pins that waiting for the driver constant to propagate.
   PinSet invalid_load_pins_;
   EvalQueue eval_queue_;
+  // Accumulated support bits (FuncExpr::portSupportBit) of the input
+  // ports whose values changed for each queued instance, so
+  // evalInstance can skip outputs whose functions cannot depend on
+  // them.  A missing entry means evaluate every output.
+  InstEvalSupportMap eval_port_supports_;
   // Instances with constant pin values for annotateVertexEdges.
   InstanceSet instances_with_const_pins_;
   InstanceSet instances_to_annotate_;
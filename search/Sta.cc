@@ -29,18 +29,21 @@
 #include "ReportTcl.hh"
 #include "Debug.hh"
 #include "Stats.hh"
+#include "Profile.hh"
 #include "Fuzzy.hh"
 #include "Units.hh"
 #include "TimingArc.hh"
 #include "FuncExpr.hh"
 #include "EquivCells.hh"
 #include "Liberty.hh"
+#include "liberty/LibertyCache.hh"
 #include "liberty/LibertyReader.hh"
 #include "LibertyWriter.hh"
 #include "SdcNetwork.hh"
 #include "MakeConcreteNetwork.hh"
 #include "PortDirection.hh"
 #include "VerilogReader.hh"
+#include "NetworkSnapshot.hh"
 #include "Graph.hh"
 #include "GraphCmp.hh"
 #include "Sdc.hh"
@@ -49,6 +52,7 @@
 #include "ExceptionPath.hh"
 #include "MakeConcreteParasitics.hh"
 #include "Parasitics.hh"
+#include "parasitics/SpefCache.hh"
 #include "parasitics/SpefReader.hh"
 #include "parasitics/ReportParasiticAnnotation.hh"
 #include "DelayCalc.hh"
@@ -62,6 +66,8 @@
 #include "PathAnalysisPt.hh"
 #include "Corner.hh"
 #include "Search.hh"
+#include "TimingCheckpoint.hh"
+#include "SdcSnapshot.hh"
 #include "Latches.hh"
 #include "PathGroup.hh"
 #include "CheckTiming.hh"
@@ -288,8 +294,12 @@ Sta::Sta() :
   update_genclks_(false),
   equiv_cells_(nullptr),
   graph_sdc_annotated_(false),
+  found_registers_(nullptr),
+  edit_batch_(false),
+  edit_batch_graph_(false),
   // Default to same parasitics for all corners.
   parasitics_per_corner_(false),
+  update_timing_running_(false),
   properties_(this)
 {
 }
@@ -353,8 +363,11 @@ Sta::setThreadCount1(int thread_count)
   thread_count_ = thread_count;
   if (dispatch_queue_)
     dispatch_queue_->setThreadCount(thread_count);
-  else if (thread_count > 1)
+  else if (thread_count > 1) {
     dispatch_queue_ = new DispatchQueue(thread_count);
+    if (variables_->threadAffinityEnabled())
+      dispatch_queue_->setThreadAffinityEnabled(true);
+  }
 }
 
 void
@@ -541,6 +554,7 @@ Sta::sta()
 
 Sta::~Sta()
 {
+  waitUpdateTiming();
   delete variables_;
   // Verilog modules refer to the network in the sta so it has
   // to deleted before the network.
@@ -555,6 +569,7 @@ Sta::~Sta()
   delete clk_skews_;
   delete check_timing_;
   delete report_path_;
+  delete found_registers_;
   // Sdc references search filter, so delete search first.
   delete search_;
   delete latches_;
@@ -580,6 +595,7 @@ Sta::~Sta()
 void
 Sta::clear()
 {
+  waitUpdateTiming();
   clkPinsInvalid();
   // Constraints reference search filter, so clear search first.
   search_->clear();
@@ -597,6 +613,7 @@ Sta::clear()
   if (check_min_periods_)
     check_min_periods_->clear();
   clk_skews_->clear();
+  foundRegistersInvalid();
   delete graph_;
   graph_ = nullptr;
   current_instance_ = nullptr;
@@ -619,6 +636,7 @@ Sta::networkChanged()
   if (check_min_periods_)
     check_min_periods_->clear();
   clk_skews_->clear();
+  foundRegistersInvalid();
   delete graph_;
   graph_ = nullptr;
   graph_sdc_annotated_ = false;
@@ -704,14 +722,75 @@ Sta::readLiberty(const char *filename,
   return library;
 }
 
+LibertyLibrarySeq
+Sta::readLiberty(const StdStringSeq &filenames,
+                 Corner *corner,
+                 const MinMaxAll *min_max,
+                 bool infer_latches)
+{
+  Stats stats(debug_, report_);
+  size_t file_count = filenames.size();
+  LibertyLibrarySeq libraries(file_count);
+  std::vector<std::exception_ptr> errors(file_count);
+  if (dispatch_queue_ && file_count > 1) {
+    for (size_t i = 0; i < file_count; i++) {
+      dispatch_queue_->dispatch([&, i](int) {
+        try {
+          libraries[i] = readLibertyCached(filenames[i].c_str(),
+                                           infer_latches);
+        }
+        catch (...) {
+          errors[i] = std::current_exception();
+        }
+      });
+    }
+    dispatch_queue_->finishTasks();
+  }
+  else {
+    for (size_t i = 0; i < file_count; i++) {
+      try {
+        libraries[i] = readLibertyCached(filenames[i].c_str(),
+                                         infer_latches);
+      }
+      catch (...) {
+        errors[i] = std::current_exception();
+      }
+    }
+  }
+  // Corner mapping and the default library are file order dependent,
+  // so finish the libraries serially.
+  for (LibertyLibrary *library : libraries) {
+    if (library) {
+      if (min_max == MinMaxAll::all()) {
+        readLibertyAfter(library, corner, MinMax::min());
+        readLibertyAfter(library, corner, MinMax::max());
+      }
+      else
+        readLibertyAfter(library, corner, min_max->asMinMax());
+      network_->readLibertyAfter(library);
+      if (network_->defaultLibertyLibrary() == nullptr) {
+        network_->setDefaultLibertyLibrary(library);
+        // Set units from default (first) library.
+        *units_ = *library->units();
+      }
+    }
+  }
+  stats.report("Read liberty files");
+  for (std::exception_ptr &error : errors) {
+    if (error)
+      std::rethrow_exception(error);
+  }
+  return libraries;
+}
+
 LibertyLibrary *
 Sta::readLibertyFile(const char *filename,
 		     Corner *corner,
 		     const MinMaxAll *min_max,
 		     bool infer_latches)
 {
-  LibertyLibrary *liberty = sta::readLibertyFile(filename, infer_latches,
-						 network_);
+  ProfilePhase phase("Read liberty");
+  LibertyLibrary *liberty = readLibertyCached(filename, infer_latches);
   if (liberty) {
     // Don't map liberty cells if they are redefined by reading another
     // library with the same cell names.
@@ -730,6 +809,28 @@ LibertyLibrary *
 Sta::readLibertyFile(const char *filename,
 		     bool infer_latches)
 {
+  return readLibertyCached(filename, infer_latches);
+}
+
+// Read filename, using the compiled binary cache beside it when the
+// cache is enabled and up to date.  After a parse, (re)write the cache
+// for the next read.
+LibertyLibrary *
+Sta::readLibertyCached(const char *filename,
+                       bool infer_latches)
+{
+  if (variables_->libertyLazyEnabled())
+    // Lazy cells leave the library incomplete, which defeats the cache.
+    return sta::readLibertyFile(filename, infer_latches, true, network_);
+  if (variables_->libertyCacheEnabled()) {
+    LibertyLibrary *library = readLibertyCache(filename, network_);
+    if (library)
+      return library;
+    library = sta::readLibertyFile(filename, infer_latches, network_);
+    if (library)
+      writeLibertyCache(library, filename, report_);
+    return library;
+  }
   return sta::readLibertyFile(filename, infer_latches, network_);
 }
 
@@ -749,7 +850,7 @@ Sta::readVerilog(const char *filename)
   NetworkReader *network = networkReader();
   if (network) {
     if (verilog_reader_ == nullptr)
-      verilog_reader_ = new VerilogReader(network);
+      verilog_reader_ = new VerilogReader(network, dispatch_queue_);
     readNetlistBefore();
     return verilog_reader_->read(filename);
   }
@@ -771,6 +872,7 @@ Sta::linkDesign(const char *top_cell_name,
                 bool make_black_boxes)
 {
   clear();
+  ProfilePhase phase("Link");
   Stats stats(debug_, report_);
   bool status = network_->linkNetwork(top_cell_name,
 				      make_black_boxes,
@@ -779,6 +881,90 @@ Sta::linkDesign(const char *top_cell_name,
   return status;
 }
 
+bool
+Sta::writeNetworkSnapshot(const char *filename)
+{
+  Stats stats(debug_, report_);
+  bool status = sta::writeNetworkSnapshot(filename, network_);
+  stats.report("Write network snapshot");
+  return status;
+}
+
+bool
+Sta::readNetworkSnapshot(const char *filename)
+{
+  clear();
+  NetworkReader *network_reader = networkReader();
+  if (network_reader == nullptr)
+    return false;
+  Stats stats(debug_, report_);
+  bool status = sta::readNetworkSnapshot(filename, network_reader);
+  stats.report("Read network snapshot");
+  return status;
+}
+
+bool
+Sta::writeTimingCheckpoint(const char *filename)
+{
+  ensureLibLinked();
+  ensureGraph();
+  // Checkpoint a completed delay calculation.
+  findDelays();
+  Stats stats(debug_, report_);
+  bool status = sta::writeTimingCheckpoint(filename, this);
+  stats.report("Write timing checkpoint");
+  return status;
+}
+
+bool
+Sta::readTimingCheckpoint(const char *filename)
+{
+  ensureLibLinked();
+  ensureGraph();
+  Stats stats(debug_, report_);
+  bool status = sta::readTimingCheckpoint(filename, this);
+  if (status) {
+    // Arrivals/requireds are rebuilt from the restored delays by the
+    // next update.
+    graph_delay_calc_->delaysRestored();
+    search_->arrivalsInvalid();
+  }
+  else
+    // A partially restored checkpoint leaves the delays inconsistent.
+    delaysInvalid();
+  stats.report("Read timing checkpoint");
+  return status;
+}
+
+bool
+Sta::writeSdcSnapshot(const char *filename)
+{
+  ensureLibLinked();
+  Stats stats(debug_, report_);
+  bool status = sta::writeSdcSnapshot(filename, this);
+  stats.report("Write sdc snapshot");
+  return status;
+}
+
+bool
+Sta::readSdcSnapshot(const char *filename)
+{
+  ensureLibLinked();
+  Stats stats(debug_, report_);
+  bool status = sta::readSdcSnapshot(filename, this);
+  // The snapshot restores through the sdc, bypassing the incremental
+  // setters, so invalidate everything constraints touch.  A failed
+  // restore may have applied a prefix of the constraints.
+  sdc_->invalidateGeneratedClks();
+  update_genclks_ = true;
+  clk_network_->clkPinsInvalid();
+  delaysInvalid();
+  search_->endpointsInvalid();
+  power_->activitiesInvalid();
+  stats.report("Read sdc snapshot");
+  return status;
+}
+
 ////////////////////////////////////////////////////////////////
 
 void
@@ -860,6 +1046,48 @@ Sta::setVoltage(const Net *net,
   sdc_->setVoltage(net, min_max, voltage);
 }
 
+static void
+reportMemoryLine(const char *name,
+		 size_t object_count,
+		 size_t bytes,
+		 Report *report)
+{
+  report->reportLine("%-10s %12zu %9.1fMB", name, object_count, bytes * 1e-6);
+}
+
+// The subsystem totals understate the process total because strings,
+// hash maps and allocator overhead are not counted.
+void
+Sta::reportMemory()
+{
+  report_->reportLine("%-10s %12s %11s", "Subsystem", "objects", "memory");
+  size_t object_count, bytes;
+  network_->memoryUsage(object_count, bytes);
+  reportMemoryLine("netlist", object_count, bytes, report_);
+
+  size_t lib_object_count = 0;
+  size_t lib_bytes = 0;
+  LibertyLibraryIterator *lib_iter = network_->libertyLibraryIterator();
+  while (lib_iter->hasNext()) {
+    LibertyLibrary *lib = lib_iter->next();
+    lib->memoryUsage(object_count, bytes);
+    lib_object_count += object_count;
+    lib_bytes += bytes;
+  }
+  delete lib_iter;
+  reportMemoryLine("liberty", lib_object_count, lib_bytes, report_);
+
+  if (graph_) {
+    graph_->memoryUsage(object_count, bytes);
+    reportMemoryLine("graph", object_count, bytes, report_);
+  }
+  parasitics_->memoryUsage(object_count, bytes);
+  reportMemoryLine("parasitics", object_count, bytes, report_);
+  search_->memoryUsage(object_count, bytes);
+  reportMemoryLine("search", object_count, bytes, report_);
+  report_->reportLine("%-10s %22.1fMB", "process", memoryUsage() * 1e-6);
+}
+
 void
 Sta::setTimingDerate(TimingDerateType type,
 		     PathClkOrData clk_data,
@@ -1116,7 +1344,10 @@ Sta::makeClock(const char *name,
 	       FloatSeq *waveform,
 	       char *comment)
 {
-  sdc_->makeClock(name, pins, add_to_pins, period, waveform, comment);
+  clockDefInvalid(name, pins, add_to_pins);
+  Clock *clk = sdc_->makeClock(name, pins, add_to_pins, period, waveform,
+			       comment);
+  clk_network_->clkPinsInvalid(clk);
   update_genclks_ = true;
   search_->arrivalsInvalid();
   power_->activitiesInvalid();
@@ -1137,19 +1368,46 @@ Sta::makeGeneratedClock(const char *name,
 			FloatSeq *edge_shifts,
 			char *comment)
 {
-  sdc_->makeGeneratedClock(name, pins, add_to_pins,
-			   src_pin, master_clk,
-			   divide_by, multiply_by, duty_cycle,
-			   invert, combinational,
-			   edges, edge_shifts, comment);
+  clockDefInvalid(name, pins, add_to_pins);
+  Clock *clk = sdc_->makeGeneratedClock(name, pins, add_to_pins,
+					src_pin, master_clk,
+					divide_by, multiply_by, duty_cycle,
+					invert, combinational,
+					edges, edge_shifts, comment);
+  clk_network_->clkPinsInvalid(clk);
   update_genclks_ = true;
   search_->arrivalsInvalid();
   power_->activitiesInvalid();
 }
 
+// Defining a clock only invalidates its own cone's classification
+// unless the definition steals pins from other clocks, which can
+// reshape or delete them.
+void
+Sta::clockDefInvalid(const char *name,
+		     PinSet *pins,
+		     bool add_to_pins)
+{
+  if (!add_to_pins && pins) {
+    Clock *prev_clk = sdc_->findClock(name);
+    for (const Pin *pin : *pins) {
+      ClockSet *pin_clks = sdc_->findClocks(pin);
+      if (pin_clks) {
+	for (Clock *pin_clk : *pin_clks) {
+	  if (pin_clk != prev_clk) {
+	    clkPinsInvalid();
+	    return;
+	  }
+	}
+      }
+    }
+  }
+}
+
 void
 Sta::removeClock(Clock *clk)
 {
+  clk_network_->deleteClkBefore(clk);
   sdc_->removeClock(clk);
   search_->arrivalsInvalid();
   power_->activitiesInvalid();
@@ -1166,7 +1424,7 @@ Sta::setPropagatedClock(Clock *clk)
 {
   sdc_->setPropagatedClock(clk);
   delaysInvalid();
-  clkPinsInvalid();
+  clk_network_->clkPinsInvalid(clk);
 }
 
 void
@@ -1174,7 +1432,7 @@ Sta::removePropagatedClock(Clock *clk)
 {
   sdc_->removePropagatedClock(clk);
   delaysInvalid();
-  clkPinsInvalid();
+  clk_network_->clkPinsInvalid(clk);
 }
 
 void
@@ -1182,7 +1440,7 @@ Sta::setPropagatedClock(Pin *pin)
 {
   sdc_->setPropagatedClock(pin);
   delaysInvalid();
-  clkPinsInvalid();
+  clk_network_->pinInvalid(pin);
 }
 
 void
@@ -1190,7 +1448,7 @@ Sta::removePropagatedClock(Pin *pin)
 {
   sdc_->removePropagatedClock(pin);
   delaysInvalid();
-  clkPinsInvalid();
+  clk_network_->pinInvalid(pin);
 }
 
 void
@@ -1463,8 +1721,11 @@ Sta::removeDataCheck(Pin *from,
 void
 Sta::disable(Pin *pin)
 {
-  sdcChangedGraph();
   sdc_->disable(pin);
+  // Annotate the new disable instead of invalidating all of the
+  // graph annotations.
+  if (graph_sdc_annotated_)
+    sdc_->annotateGraphDisabled(pin);
   // Levelization respects disabled edges.
   levelize_->invalid();
   graph_delay_calc_->delayInvalid(pin);
@@ -1488,8 +1749,11 @@ Sta::disable(Instance *inst,
 	     LibertyPort *from,
 	     LibertyPort *to)
 {
-  sdcChangedGraph();
   sdc_->disable(inst, from, to);
+  // Annotate the new disable instead of invalidating all of the
+  // graph annotations.
+  if (graph_sdc_annotated_)
+    sdc_->annotateGraphDisabled(inst);
 
   if (from) {
     Pin *from_pin = network_->findPin(inst, from);
@@ -2230,6 +2494,82 @@ Sta::setPocvEnabled(bool enabled)
   variables_->setPocvEnabled(enabled);
 }
 
+bool
+Sta::libertyCacheEnabled() const
+{
+  return variables_->libertyCacheEnabled();
+}
+
+void
+Sta::setLibertyCacheEnabled(bool enabled)
+{
+  variables_->setLibertyCacheEnabled(enabled);
+}
+
+bool
+Sta::libertyLazyEnabled() const
+{
+  return variables_->libertyLazyEnabled();
+}
+
+void
+Sta::setLibertyLazyEnabled(bool enabled)
+{
+  variables_->setLibertyLazyEnabled(enabled);
+}
+
+bool
+Sta::spefCacheEnabled() const
+{
+  return variables_->spefCacheEnabled();
+}
+
+void
+Sta::setSpefCacheEnabled(bool enabled)
+{
+  variables_->setSpefCacheEnabled(enabled);
+}
+
+bool
+Sta::spefLazyEnabled() const
+{
+  return variables_->spefLazyEnabled();
+}
+
+void
+Sta::setSpefLazyEnabled(bool enabled)
+{
+  variables_->setSpefLazyEnabled(enabled);
+}
+
+bool
+Sta::pathSpillEnabled() const
+{
+  return variables_->pathSpillEnabled();
+}
+
+void
+Sta::setPathSpillEnabled(bool enabled)
+{
+  variables_->setPathSpillEnabled(enabled);
+  if (graph_)
+    graph_->setPathSpillEnabled(enabled);
+}
+
+bool
+Sta::threadAffinityEnabled() const
+{
+  return variables_->threadAffinityEnabled();
+}
+
+void
+Sta::setThreadAffinityEnabled(bool enabled)
+{
+  variables_->setThreadAffinityEnabled(enabled);
+  if (dispatch_queue_)
+    dispatch_queue_->setThreadAffinityEnabled(enabled);
+}
+
 void
 Sta::setSigmaFactor(float factor)
 {
@@ -2501,6 +2841,79 @@ Sta::findPathEnds(ExceptionFrom *from,
 			       clk_gating_setup, clk_gating_hold);
 }
 
+void
+Sta::visitPathEnds(ExceptionFrom *from,
+		   ExceptionThruSeq *thrus,
+		   ExceptionTo *to,
+		   bool unconstrained,
+		   const Corner *corner,
+		   const MinMaxAll *min_max,
+		   int group_path_count,
+		   int endpoint_path_count,
+		   bool unique_pins,
+		   bool unique_edges,
+		   float slack_min,
+		   float slack_max,
+		   bool sort_by_slack,
+		   PathGroupNameSet *group_names,
+		   bool setup,
+		   bool hold,
+		   bool recovery,
+		   bool removal,
+		   bool clk_gating_setup,
+		   bool clk_gating_hold,
+		   PathEndConsumer *consumer)
+{
+  searchPreamble();
+  clk_skews_->clear();
+  search_->visitPathEnds(from, thrus, to, unconstrained,
+			 corner, min_max, group_path_count,
+			 endpoint_path_count,
+			 unique_pins, unique_edges,
+			 slack_min, slack_max,
+			 sort_by_slack, group_names,
+			 setup, hold,
+			 recovery, removal,
+			 clk_gating_setup, clk_gating_hold,
+			 consumer);
+}
+
+void
+Sta::reportPathEndsStreamed(ExceptionFrom *from,
+			    ExceptionThruSeq *thrus,
+			    ExceptionTo *to,
+			    bool unconstrained,
+			    const Corner *corner,
+			    const MinMaxAll *min_max,
+			    int group_path_count,
+			    int endpoint_path_count,
+			    bool unique_pins,
+			    bool unique_edges,
+			    float slack_min,
+			    float slack_max,
+			    bool sort_by_slack,
+			    PathGroupNameSet *group_names,
+			    bool setup,
+			    bool hold,
+			    bool recovery,
+			    bool removal,
+			    bool clk_gating_setup,
+			    bool clk_gating_hold)
+{
+  ReportPathEndConsumer consumer(report_path_);
+  visitPathEnds(from, thrus, to, unconstrained,
+		corner, min_max, group_path_count,
+		endpoint_path_count,
+		unique_pins, unique_edges,
+		slack_min, slack_max,
+		sort_by_slack, group_names,
+		setup, hold,
+		recovery, removal,
+		clk_gating_setup, clk_gating_hold,
+		&consumer);
+  consumer.finish();
+}
+
 ////////////////////////////////////////////////////////////////
 
 // Overall flow:
@@ -2514,6 +2927,9 @@ Sta::findPathEnds(ExceptionFrom *from,
 void
 Sta::searchPreamble()
 {
+  // Timing commands wait for a background update rather than racing
+  // with it (see updateTimingBackground).
+  waitUpdateTiming();
   findDelays();
   updateGeneratedClks();
   sdc_->searchPreamble();
@@ -2611,14 +3027,77 @@ Sta::reportPath(const Path *path)
 }
 
 void
-Sta::updateTiming(bool full)
+Sta::updateTiming(bool full,
+		  const Corner *corner)
 {
+  if (full && corner)
+    // Corner scoped full update: recompute the corner's analysis
+    // points from scratch; other corners' delays and arrivals stay
+    // live and are only re-propagated where the new delays differ.
+    delaysInvalid(corner);
   searchPreamble();
-  if (full)
-    search_->arrivalsInvalid();
+  if (full && corner == nullptr)
+    // The solved clock tree survives a full update; only the data
+    // paths are re-propagated when the clock arrivals are valid.
+    search_->dataArrivalsInvalid();
   search_->findAllArrivals();
 }
 
+void
+Sta::updateTimingBackground(bool full)
+{
+  waitUpdateTiming();
+  // The preamble edits the network and graph, so run it before
+  // handing control back to the command shell.
+  searchPreamble();
+  if (full)
+    search_->dataArrivalsInvalid();
+  update_timing_running_ = true;
+  update_timing_thread_ = std::thread([this] {
+    search_->findAllArrivals();
+    update_timing_running_ = false;
+  });
+}
+
+bool
+Sta::updateTimingRunning() const
+{
+  return update_timing_running_;
+}
+
+Level
+Sta::updateTimingLevel() const
+{
+  return search_->arrivalLevel();
+}
+
+Level
+Sta::updateTimingMaxLevel() const
+{
+  return levelize_->maxLevel();
+}
+
+int
+Sta::updateTimingVisitCount() const
+{
+  return search_->arrivalVisitCount();
+}
+
+void
+Sta::cancelUpdateTiming()
+{
+  if (update_timing_running_)
+    search_->cancelArrivals();
+  waitUpdateTiming();
+}
+
+void
+Sta::waitUpdateTiming()
+{
+  if (update_timing_thread_.joinable())
+    update_timing_thread_.join();
+}
+
 ////////////////////////////////////////////////////////////////
 
 void
@@ -2686,6 +3165,17 @@ Sta::delaysInvalid() const
   search_->arrivalsInvalid();
 }
 
+void
+Sta::delaysInvalid(const Corner *corner) const
+{
+  if (corner == nullptr)
+    delaysInvalid();
+  else
+    // Arrivals stay live; the delay calc observer invalidates them
+    // where the corner's recomputed delays change.
+    graph_delay_calc_->delaysInvalid(corner);
+}
+
 void
 Sta::arrivalsInvalid()
 {
@@ -2751,6 +3241,30 @@ Sta::findRequireds()
 
 ////////////////////////////////////////////////////////////////
 
+void
+Sta::beginProbe()
+{
+  // Drain pending invalidation so the journals roll back to a
+  // consistent state and endProbe can discard the probe's
+  // invalidation wholesale.
+  findRequireds();
+  graph_->beginDelayJournal();
+  search_->beginPathJournal();
+}
+
+void
+Sta::endProbe()
+{
+  search_->rollbackPathJournal();
+  graph_->rollbackDelayJournal();
+  // The journals restored the pre-probe delays and paths, so the
+  // invalidation queued by the probe edits is moot.
+  graph_delay_calc_->delaysRestored();
+  search_->arrivalsRestored();
+}
+
+////////////////////////////////////////////////////////////////
+
 VertexPathIterator *
 Sta::vertexPathIterator(Vertex *vertex,
 			const RiseFall *rf,
@@ -3338,6 +3852,33 @@ Sta::worstSlack(const Corner *corner,
   return search_->worstSlack(corner, min_max, worst_slack, worst_vertex);
 }
 
+void
+Sta::reportSlackHistogram(const Corner *corner,
+                          const MinMax *min_max,
+                          int bin_count,
+                          int digits)
+{
+  searchPreamble();
+  Slack slack_min, slack_max;
+  std::vector<size_t> bins =
+    search_->endpointSlackHistogram(corner, min_max, bin_count,
+                                    slack_min, slack_max);
+  if (bins.empty())
+    report_->reportLine("No constrained endpoint slacks found.");
+  else {
+    const Unit *time_unit = units_->timeUnit();
+    float slack_lo = delayAsFloat(slack_min);
+    float bin_width = (delayAsFloat(slack_max) - slack_lo) / bins.size();
+    for (size_t bin = 0; bin < bins.size(); bin++)
+      report_->reportLine("%s %s %zu",
+                          time_unit->asString(slack_lo + bin_width * bin,
+                                              digits),
+                          time_unit->asString(slack_lo + bin_width * (bin + 1),
+                                              digits),
+                          bins[bin]);
+  }
+}
+
 ////////////////////////////////////////////////////////////////
 
 string
@@ -3361,6 +3902,54 @@ Sta::setArcDelayCalc(const char *delay_calc_name)
   delaysInvalid();
 }
 
+void
+Sta::refineDelays(const char *delay_calc_name,
+		  float slack_margin)
+{
+  // Phase one: time the whole design with the current (cheap) delay
+  // calculator so the slacks identify the critical cones.
+  updateTiming(false);
+
+  // Collect the fanin cones of the endpoints with slack below the
+  // margin; walking in-edges from the check pins also pulls in the
+  // clock trees their arrivals depend on.
+  VertexSet cone_vertices(graph_);
+  VertexSeq pending;
+  for (Vertex *end : *search_->endpoints()) {
+    Slack slack = vertexSlack(end, MinMax::max());
+    if (delayAsFloat(slack) < slack_margin) {
+      cone_vertices.insert(end);
+      pending.push_back(end);
+    }
+  }
+  while (!pending.empty()) {
+    Vertex *vertex = pending.back();
+    pending.pop_back();
+    VertexInEdgeIterator edge_iter(vertex, graph_);
+    while (edge_iter.hasNext()) {
+      Edge *edge = edge_iter.next();
+      Vertex *from_vertex = edge->from(graph_);
+      if (!cone_vertices.hasKey(from_vertex)) {
+	cone_vertices.insert(from_vertex);
+	pending.push_back(from_vertex);
+      }
+    }
+  }
+  debugPrint(debug_, "delay_calc", 1, "refine %zu / %u vertices",
+             cone_vertices.size(),
+             graph_->vertexCount());
+
+  // Phase two: switch to the accurate delay calculator and re-time
+  // only the critical cones; the incremental update machinery leaves
+  // the rest of the design's delays and arrivals alone.
+  delete arc_delay_calc_;
+  arc_delay_calc_ = makeDelayCalc(delay_calc_name, sta_);
+  updateComponentsState();
+  for (Vertex *vertex : cone_vertices)
+    graph_delay_calc_->delayInvalid(vertex);
+  updateTiming(false);
+}
+
 void
 Sta::findDelays(Vertex *to_vertex)
 {
@@ -3395,6 +3984,13 @@ Sta::setIncrementalDelayTolerance(float tol)
   graph_delay_calc_->setIncrementalDelayTolerance(tol);
 }
 
+void
+Sta::setDelayCalcCacheTolerance(float tol)
+{
+  graph_delay_calc_->setDelayCalcCacheTolerance(tol);
+  delaysInvalid();
+}
+
 ArcDelay
 Sta::arcDelay(Edge *edge,
 	      TimingArc *arc,
@@ -3519,6 +4115,7 @@ void
 Sta::makeGraph()
 {
   graph_ = new Graph(this, 2, corners_->dcalcAnalysisPtCount());
+  graph_->setPathSpillEnabled(variables_->pathSpillEnabled());
   graph_->makeGraph();
 }
 
@@ -3531,6 +4128,7 @@ Sta::ensureLevelized()
   // are disabled by constants.
   sim_->ensureConstantsPropagated();
   levelize_->ensureLevelized();
+  graph_->ensureEdgeRanges();
 }
 
 void
@@ -3955,6 +4553,7 @@ Sta::readSpef(const char *filename,
 	      bool pin_cap_included,
 	      bool keep_coupling_caps,
 	      float coupling_cap_factor,
+	      float coupling_cap_threshold,
 	      bool reduce)
 {
   ensureLibLinked();
@@ -3964,14 +4563,53 @@ Sta::readSpef(const char *filename,
     : min_max->asMinMax();
   const Corner *ap_corner = corner ? corner : corners_->corners()[0];
   ParasiticAnalysisPt *ap = ap_corner->findParasiticAnalysisPt(ap_min_max);
+  // Lazy mode pages parasitic networks in from the spef cache on
+  // demand instead of holding every net resident.
+  if (variables_->spefLazyEnabled()
+      && !reduce) {
+    ParasiticNetworkLoader *loader =
+      makeSpefCacheLoader(filename, instance, pin_cap_included,
+                          keep_coupling_caps, coupling_cap_factor,
+                          coupling_cap_threshold, ap, this);
+    if (loader) {
+      parasitics_->setNetworkLoader(loader);
+      delaysInvalid(corner);
+      return true;
+    }
+    // No usable cache; read the file and write a cache for the next run.
+  }
+  // The cache holds unreduced parasitic networks, so it does not apply
+  // when networks are reduced and deleted while reading.
+  if (variables_->spefCacheEnabled()
+      && !reduce
+      && readSpefCache(filename, instance, pin_cap_included,
+                       keep_coupling_caps, coupling_cap_factor,
+                       coupling_cap_threshold, ap, this)) {
+    delaysInvalid(corner);
+    return true;
+  }
   bool success = readSpefFile(filename, instance, ap,
 			      pin_cap_included, keep_coupling_caps,
-                              coupling_cap_factor, reduce,
-			      corner, min_max, this);
-  delaysInvalid();
+                              coupling_cap_factor, coupling_cap_threshold,
+                              reduce, corner, min_max, this);
+  if (success
+      && (variables_->spefCacheEnabled()
+          || variables_->spefLazyEnabled())
+      && !reduce)
+    writeSpefCache(filename, instance, pin_cap_included,
+                   keep_coupling_caps, coupling_cap_factor,
+                   coupling_cap_threshold, ap, this);
+  delaysInvalid(corner);
   return success;
 }
 
+void
+Sta::reduceParasitics()
+{
+  ensureLibLinked();
+  parasitics_->reduceParasitics();
+}
+
 void
 Sta::setParasiticAnalysisPts(bool per_corner)
 {
@@ -3990,11 +4628,13 @@ Sta::makeParasiticAnalysisPts()
 
 void
 Sta::reportParasiticAnnotation(bool report_unannotated,
+                               int hierarchy_depth,
                                const Corner *corner)
 {
   ensureLibLinked();
   ensureGraph();
-  sta::reportParasiticAnnotation(report_unannotated, corner, this);
+  sta::reportParasiticAnnotation(report_unannotated, hierarchy_depth,
+                                 corner, this);
 }
 
 void
@@ -4159,6 +4799,37 @@ Sta::replaceCell(Instance *inst,
   }
 }
 
+Instance *
+Sta::replaceBlockWithModel(Instance *inst,
+			   LibertyCell *model_cell)
+{
+  // Record the boundary connections before the subtree is deleted.
+  std::vector<std::pair<string, Net*>> connections;
+  InstancePinIterator *pin_iter = network_->pinIterator(inst);
+  while (pin_iter->hasNext()) {
+    Pin *pin = pin_iter->next();
+    Net *net = network_->net(pin);
+    if (net)
+      connections.emplace_back(network_->name(network_->port(pin)), net);
+  }
+  delete pin_iter;
+
+  string inst_name = network_->name(inst);
+  Instance *parent = network_->parent(inst);
+  deleteInstance(inst);
+  Instance *model_inst = makeInstance(inst_name.c_str(), model_cell, parent);
+  for (const auto& [port_name, net] : connections) {
+    LibertyPort *port = model_cell->findLibertyPort(port_name.c_str());
+    if (port)
+      connectPin(model_inst, port, net);
+    else
+      report_->warn(2336, "timing model cell %s has no port %s.",
+		    model_cell->name(),
+		    port_name.c_str());
+  }
+  return model_inst;
+}
+
 Net *
 Sta::makeNet(const char *name,
 	     Instance *parent)
@@ -4218,6 +4889,41 @@ Sta::makePortPin(const char *port_name,
   Pin *pin = network->makePin(top_inst, port, nullptr);
   makePortPinAfter(pin);
 }
+
+void
+Sta::beginEdits()
+{
+  if (!edit_batch_) {
+    edit_batch_ = true;
+    // Drop the graph so the edit before/after hooks skip per-edit
+    // graph repair and invalidation; endEdits rebuilds it once.
+    edit_batch_graph_ = graph_ != nullptr;
+    if (graph_) {
+      search_->clear();
+      levelize_->clear();
+      graph_delay_calc_->clear();
+      clk_skews_->clear();
+      delete graph_;
+      graph_ = nullptr;
+      graph_sdc_annotated_ = false;
+      updateComponentsState();
+    }
+  }
+}
+
+void
+Sta::endEdits()
+{
+  if (edit_batch_) {
+    edit_batch_ = false;
+    if (edit_batch_graph_) {
+      edit_batch_graph_ = false;
+      // One consolidated graph repair and levelize for the batch.
+      ensureGraph();
+      ensureLevelized();
+    }
+  }
+}
  
 ////////////////////////////////////////////////////////////////
 //
@@ -4230,6 +4936,7 @@ Sta::makeInstanceAfter(const Instance *inst)
 {
   debugPrint(debug_, "network_edit", 1, "make instance %s",
              sdc_network_->pathName(inst));
+  foundRegistersInvalid();
   if (graph_) {
     LibertyCell *lib_cell = network_->libertyCell(inst);
     if (lib_cell) {
@@ -4388,6 +5095,7 @@ Sta::replaceCellBefore(const Instance *inst,
 void
 Sta::replaceCellAfter(const Instance *inst)
 {
+  foundRegistersInvalid();
   if (graph_) {
     graph_->makeInstanceEdges(inst);
     InstancePinIterator *pin_iter = network_->pinIterator(inst);
@@ -4589,6 +5297,7 @@ Sta::deleteInstanceBefore(const Instance *inst)
 {
   debugPrint(debug_, "network_edit", 1, "delete instance %s",
              sdc_network_->pathName(inst));
+  foundRegistersInvalid();
   if (network_->isLeaf(inst)) {
     deleteInstancePinsBefore(inst);
     deleteLeafInstanceBefore(inst);
@@ -4819,6 +5528,19 @@ Sta::findRegisterInstances(ClockSet *clks,
 			   bool latches)
 {
   findRegisterPreamble();
+  // Cache the parameter-free query; sdc generators call all_registers
+  // over and over on an unchanged network.
+  bool cacheable = (clks == nullptr || clks->empty())
+    && clk_rf == RiseFallBoth::riseFall()
+    && edge_triggered
+    && latches;
+  if (cacheable) {
+    if (found_registers_ == nullptr)
+      found_registers_ =
+	new InstanceSet(findRegInstances(clks, clk_rf, edge_triggered,
+					 latches, this));
+    return *found_registers_;
+  }
   return findRegInstances(clks, clk_rf, edge_triggered, latches, this);
 }
 
@@ -4871,6 +5593,13 @@ Sta::findRegisterPreamble()
   sim_->ensureConstantsPropagated();
 }
 
+void
+Sta::foundRegistersInvalid()
+{
+  delete found_registers_;
+  found_registers_ = nullptr;
+}
+
 ////////////////////////////////////////////////////////////////
 
 class FanInOutSrchPred : public SearchPred
@@ -5701,7 +6430,7 @@ Sta::makeEquivCells(LibertyLibrarySeq *equiv_libs,
 		    LibertyLibrarySeq *map_libs)
 {
   delete equiv_cells_;
-  equiv_cells_ = new EquivCells(equiv_libs, map_libs);
+  equiv_cells_ = new EquivCells(equiv_libs, map_libs, dispatch_queue_);
 }
 
 LibertyCellSeq *
@@ -5787,6 +6516,21 @@ Sta::writePathSpice(Path *path,
                       power_name, gnd_name, ckt_sim, this);
 }
 
+void
+Sta::writePathsSpice(PathEndSeq *path_ends,
+                     const char *spice_dir,
+                     const char *lib_subckt_filename,
+                     const char *model_filename,
+                     const char *power_name,
+                     const char *gnd_name,
+                     CircuitSim ckt_sim)
+{
+  ensureLibLinked();
+  sta::writePathsSpice(path_ends, spice_dir,
+                       lib_subckt_filename, model_filename,
+                       power_name, gnd_name, ckt_sim, this);
+}
+
 ////////////////////////////////////////////////////////////////
 
 void
@@ -275,20 +275,20 @@ Tag::findHash()
 
 size_t
 Tag::hash(bool match_crpr_clk_pin,
-	  const StaState *sta) const
+	  const StaState *) const
 {
   if (match_crpr_clk_pin)
-    return hashSum(hash_, clk_info_->crprClkVertexId(sta));
+    return hashSum(hash_, clk_info_->crprClkVertexId());
   else
     return hash_;
 }
 
 size_t
 Tag::matchHash(bool match_crpr_clk_pin,
-               const StaState *sta) const
+               const StaState *) const
 {
   if (match_crpr_clk_pin)
-    return hashSum(match_hash_, clk_info_->crprClkVertexId(sta));
+    return hashSum(match_hash_, clk_info_->crprClkVertexId());
   else
     return match_hash_;
 }
@@ -470,8 +470,8 @@ Tag::matchCmp(const Tag *tag1,
 
   if (match_crpr_clk_pin
       && sta->crprActive()) {
-    VertexId crpr_vertex1 = clk_info1->crprClkVertexId(sta);
-    VertexId crpr_vertex2 = clk_info2->crprClkVertexId(sta);
+    VertexId crpr_vertex1 = clk_info1->crprClkVertexId();
+    VertexId crpr_vertex2 = clk_info2->crprClkVertexId();
     if (crpr_vertex1 < crpr_vertex2)
       return -1;
     if (crpr_vertex1 > crpr_vertex2)
@@ -534,6 +534,9 @@ Tag::stateCmp(const Tag *tag1,
 {
   ExceptionStateSet *states1 = tag1->states();
   ExceptionStateSet *states2 = tag2->states();
+  // Interned tag state sets are canonical, so equal sets are the same set.
+  if (states1 == states2)
+    return 0;
   bool states_null1 = (states1 == nullptr || states1->empty());
   bool states_null2 = (states2 == nullptr || states2->empty());
   if (states_null1
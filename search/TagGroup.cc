@@ -27,6 +27,7 @@
 #include "Report.hh"
 #include "Debug.hh"
 #include "Graph.hh"
+#include "Clock.hh"
 #include "PathAnalysisPt.hh"
 #include "ClkInfo.hh"
 #include "Tag.hh"
@@ -51,8 +52,15 @@ TagGroup::TagGroup(TagGroupIndex index,
   has_genclk_src_tag_(has_genclk_src_tag),
   has_filter_tag_(has_filter_tag),
   has_loop_tag_(has_loop_tag),
-  own_path_map_(true)
+  own_path_map_(true),
+  sta_(sta)
 {
+  match_keys_.reserve(path_index_map->size());
+  path_entries_.reserve(path_index_map->size());
+  for (auto const [tag, path_index] : *path_index_map) {
+    match_keys_.push_back(matchKey(tag));
+    path_entries_.push_back({tag, static_cast<uint32_t>(path_index)});
+  }
 }
 
 TagGroup::TagGroup(TagGroupBldr *tag_bldr,
@@ -60,7 +68,8 @@ TagGroup::TagGroup(TagGroupBldr *tag_bldr,
   path_index_map_(&tag_bldr->pathIndexMap()),
   hash_(hash(path_index_map_, sta)),
   ref_count_(0),
-  own_path_map_(false)
+  own_path_map_(false),
+  sta_(sta)
 {
 }
 
@@ -93,10 +102,30 @@ TagGroup::hash(PathIndexMap *path_index_map,
   return hash;
 }
 
+// 16 bit key over the leading components Tag::matchCmp compares.
+// Matching tags always have equal keys, so a key mismatch rules an
+// entry out without touching the tag.
+uint16_t
+TagGroup::matchKey(const Tag *tag)
+{
+  const ClockEdge *clk_edge = tag->clkInfo()->clkEdge();
+  int edge_index = clk_edge ? clk_edge->index() : -1;
+  size_t key = tag->rfIndex()
+    + tag->pathAPIndex() * 2
+    + (edge_index + 1) * 59
+    + tag->isClock() * 8209
+    + tag->clkInfo()->isGenClkSrcPath() * 12289
+    + tag->isSegmentStart() * 23197;
+  return static_cast<uint16_t>(key);
+}
+
 bool
 TagGroup::hasTag(Tag *tag) const
 {
-  return path_index_map_->hasKey(tag);
+  size_t path_index;
+  bool exists;
+  pathIndex(tag, path_index, exists);
+  return exists;
 }
 
 size_t
@@ -113,7 +142,23 @@ TagGroup::pathIndex(Tag *tag,
                     size_t &path_index,
                     bool &exists) const
 {
-  path_index_map_->findKey(tag, path_index, exists);
+  if (match_keys_.empty())
+    path_index_map_->findKey(tag, path_index, exists);
+  else {
+    uint16_t key = matchKey(tag);
+    const uint16_t *keys = match_keys_.data();
+    size_t count = match_keys_.size();
+    for (size_t i = 0; i < count; i++) {
+      if (keys[i] == key
+          && Tag::matchCmp(tag, path_entries_[i].first, true, sta_) == 0) {
+        path_index = path_entries_[i].second;
+        exists = true;
+        return;
+      }
+    }
+    path_index = 0;
+    exists = false;
+  }
 }
 
 void
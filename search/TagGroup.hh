@@ -25,6 +25,8 @@
 #pragma once
 
 #include <atomic>
+#include <cstdint>
+#include <vector>
 
 #include "Vector.hh"
 #include "Map.hh"
@@ -76,6 +78,7 @@ public:
 protected:
   static size_t hash(PathIndexMap *path_index_map,
 		     const StaState *sta);
+  static uint16_t matchKey(const Tag *tag);
 
   // tag -> path index
   PathIndexMap *path_index_map_;
@@ -87,6 +90,15 @@ protected:
   bool has_filter_tag_:1;
   bool has_loop_tag_:1;
   bool own_path_map_:1;
+  // Flat lookup arrays for interned groups.  The contiguous 16 bit
+  // match keys are scanned linearly (the compiler vectorizes the
+  // compare loop), which beats walking the map's tree nodes and
+  // calling Tag::matchCmp per probe once per-vertex tag counts reach
+  // the hundreds.  A key hit is confirmed with Tag::matchCmp; a key
+  // miss rules the entry out because matching tags have equal keys.
+  std::vector<uint16_t> match_keys_;
+  std::vector<std::pair<Tag*, uint32_t>> path_entries_;
+  const StaState *sta_;
 };
 
 class TagGroupHash
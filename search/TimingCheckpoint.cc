@@ -0,0 +1,477 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2025, Parallax Software, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+//
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// This notice may not be removed or altered from any source distribution.
+
+#include "TimingCheckpoint.hh"
+
+#include <cstring>
+#include <fstream>
+#include <sys/stat.h>
+
+#ifndef _WIN32
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <unistd.h>
+#endif
+
+#include "Hash.hh"
+#include "Report.hh"
+#include "Network.hh"
+#include "Sdc.hh"
+#include "Clock.hh"
+#include "TimingArc.hh"
+#include "Graph.hh"
+#include "Corner.hh"
+#include "StaState.hh"
+
+namespace sta {
+
+static constexpr uint32_t checkpoint_magic = 0x4b415453;  // "STAK"
+static constexpr uint32_t checkpoint_format_version = 1;
+
+// Hash of the graph topology so a checkpoint only restores into the
+// graph that wrote it.  Vertex and edge ids repeat across sessions
+// when the same netlist is linked, so pin names and edge endpoints
+// pin down the structure the ids index.
+static size_t
+graphHash(StaState *sta)
+{
+  Network *network = sta->network();
+  Graph *graph = sta->graph();
+  size_t hash = 0;
+  VertexIterator vertex_iter(graph);
+  while (vertex_iter.hasNext()) {
+    Vertex *vertex = vertex_iter.next();
+    hashIncr(hash, hashString(network->pathName(vertex->pin())));
+    VertexOutEdgeIterator edge_iter(vertex, graph);
+    while (edge_iter.hasNext()) {
+      Edge *edge = edge_iter.next();
+      hashIncr(hash, edge->to());
+      hashIncr(hash, edge->timingArcSet()->arcCount());
+    }
+  }
+  return hash;
+}
+
+// Hash of the sdc clocks; restored delays are meaningless if the
+// clock waveforms that drove the delay calculation changed.
+static size_t
+sdcHash(StaState *sta)
+{
+  size_t hash = 0;
+  ClockSeq *clks = sta->sdc()->clocks();
+  if (clks) {
+    for (const Clock *clk : *clks) {
+      hashIncr(hash, hashString(clk->name()));
+      uint32_t period_bits;
+      float period = clk->period();
+      memcpy(&period_bits, &period, sizeof(period_bits));
+      hashIncr(hash, period_bits);
+    }
+  }
+  return hash;
+}
+
+////////////////////////////////////////////////////////////////
+//
+// Writer
+//
+////////////////////////////////////////////////////////////////
+
+class TimingCheckpointWriter
+{
+public:
+  TimingCheckpointWriter(const char *filename,
+                         StaState *sta);
+  bool write();
+
+private:
+  void writeVertex(Vertex *vertex);
+  void writeEdge(Edge *edge);
+
+  void writeU32(uint32_t value);
+  void writeU64(uint64_t value);
+  void writeFloat(float value);
+
+  const char *filename_;
+  StaState *sta_;
+  Report *report_;
+  DcalcAPIndex ap_count_;
+  std::ofstream out_;
+};
+
+TimingCheckpointWriter::TimingCheckpointWriter(const char *filename,
+                                               StaState *sta) :
+  filename_(filename),
+  sta_(sta),
+  report_(sta->report()),
+  ap_count_(sta->corners()->dcalcAnalysisPtCount())
+{
+}
+
+bool
+TimingCheckpointWriter::write()
+{
+  Graph *graph = sta_->graph();
+  if (graph == nullptr) {
+    report_->warn(2328, "no graph to checkpoint.");
+    return false;
+  }
+  out_.open(filename_, std::ios::binary | std::ios::trunc);
+  if (!out_.is_open()) {
+    report_->warn(2329, "cannot open timing checkpoint file %s.", filename_);
+    return false;
+  }
+
+  uint32_t vertex_count = 0;
+  uint32_t edge_count = 0;
+  VertexIterator count_iter(graph);
+  while (count_iter.hasNext()) {
+    Vertex *vertex = count_iter.next();
+    vertex_count++;
+    VertexOutEdgeIterator edge_iter(vertex, graph);
+    while (edge_iter.hasNext()) {
+      edge_iter.next();
+      edge_count++;
+    }
+  }
+
+  writeU32(checkpoint_magic);
+  writeU32(checkpoint_format_version);
+  writeU64(graphHash(sta_));
+  writeU64(sdcHash(sta_));
+  writeU32(ap_count_);
+  writeU32(vertex_count);
+  writeU32(edge_count);
+
+  VertexIterator vertex_iter(graph);
+  while (vertex_iter.hasNext()) {
+    Vertex *vertex = vertex_iter.next();
+    writeVertex(vertex);
+    VertexOutEdgeIterator edge_iter(vertex, graph);
+    while (edge_iter.hasNext())
+      writeEdge(edge_iter.next());
+  }
+  out_.close();
+  if (out_.fail()) {
+    report_->warn(2330, "error writing timing checkpoint file %s.", filename_);
+    return false;
+  }
+  return true;
+}
+
+void
+TimingCheckpointWriter::writeVertex(Vertex *vertex)
+{
+  Graph *graph = sta_->graph();
+  writeU32(graph->id(vertex));
+  for (const RiseFall *rf : RiseFall::range()) {
+    for (DcalcAPIndex ap_index = 0; ap_index < ap_count_; ap_index++)
+      writeFloat(delayAsFloat(graph->slew(vertex, rf, ap_index)));
+  }
+}
+
+void
+TimingCheckpointWriter::writeEdge(Edge *edge)
+{
+  Graph *graph = sta_->graph();
+  writeU32(graph->id(edge));
+  TimingArcSet *arc_set = edge->timingArcSet();
+  writeU32(static_cast<uint32_t>(arc_set->arcCount()));
+  for (const TimingArc *arc : arc_set->arcs()) {
+    for (DcalcAPIndex ap_index = 0; ap_index < ap_count_; ap_index++)
+      writeFloat(delayAsFloat(graph->arcDelay(edge, arc, ap_index)));
+  }
+}
+
+void
+TimingCheckpointWriter::writeU32(uint32_t value)
+{
+  out_.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void
+TimingCheckpointWriter::writeU64(uint64_t value)
+{
+  out_.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void
+TimingCheckpointWriter::writeFloat(float value)
+{
+  out_.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+bool
+writeTimingCheckpoint(const char *filename,
+                      StaState *sta)
+{
+  TimingCheckpointWriter writer(filename, sta);
+  return writer.write();
+}
+
+////////////////////////////////////////////////////////////////
+//
+// Reader
+//
+////////////////////////////////////////////////////////////////
+
+struct TimingCheckpointError {};
+
+class TimingCheckpointReader
+{
+public:
+  TimingCheckpointReader(const char *filename,
+                         StaState *sta);
+  ~TimingCheckpointReader();
+  bool read();
+
+private:
+  bool mapFile(const char *filename);
+  void unmapFile();
+  void readVertex();
+  void readEdge();
+
+  uint32_t readU32();
+  uint64_t readU64();
+  float readFloat();
+
+  const char *filename_;
+  StaState *sta_;
+  Report *report_;
+  DcalcAPIndex ap_count_;
+
+  const char *data_;
+  const char *cursor_;
+  const char *end_;
+  size_t map_length_;
+#ifndef _WIN32
+  int fd_;
+#endif
+};
+
+TimingCheckpointReader::TimingCheckpointReader(const char *filename,
+                                               StaState *sta) :
+  filename_(filename),
+  sta_(sta),
+  report_(sta->report()),
+  ap_count_(sta->corners()->dcalcAnalysisPtCount()),
+  data_(nullptr),
+  cursor_(nullptr),
+  end_(nullptr),
+  map_length_(0)
+#ifndef _WIN32
+  , fd_(-1)
+#endif
+{
+}
+
+TimingCheckpointReader::~TimingCheckpointReader()
+{
+  unmapFile();
+}
+
+bool
+TimingCheckpointReader::read()
+{
+  Graph *graph = sta_->graph();
+  if (graph == nullptr) {
+    report_->warn(2331, "no graph to restore a timing checkpoint into.");
+    return false;
+  }
+  if (!mapFile(filename_)) {
+    report_->warn(2332, "cannot read timing checkpoint file %s.", filename_);
+    return false;
+  }
+  try {
+    if (readU32() != checkpoint_magic
+        || readU32() != checkpoint_format_version) {
+      report_->warn(2333, "timing checkpoint file %s has an unsupported format.",
+                    filename_);
+      return false;
+    }
+    if (readU64() != graphHash(sta_)
+        || readU64() != sdcHash(sta_)
+        || readU32() != static_cast<uint32_t>(ap_count_)) {
+      report_->warn(2334,
+                    "timing checkpoint file %s does not match the current network/SDC.",
+                    filename_);
+      return false;
+    }
+    uint32_t vertex_count = readU32();
+    uint32_t edge_count = readU32();
+    uint32_t vertex_index = 0;
+    uint32_t edge_index = 0;
+    VertexIterator vertex_iter(graph);
+    while (vertex_iter.hasNext()) {
+      Vertex *vertex = vertex_iter.next();
+      readVertex();
+      vertex_index++;
+      VertexOutEdgeIterator edge_iter(vertex, graph);
+      while (edge_iter.hasNext()) {
+        edge_iter.next();
+        readEdge();
+        edge_index++;
+      }
+    }
+    if (vertex_index != vertex_count
+        || edge_index != edge_count)
+      throw TimingCheckpointError();
+    return true;
+  }
+  catch (TimingCheckpointError &) {
+    report_->warn(2335, "timing checkpoint file %s is corrupt; ignored.",
+                  filename_);
+    return false;
+  }
+}
+
+void
+TimingCheckpointReader::readVertex()
+{
+  Graph *graph = sta_->graph();
+  VertexId id = readU32();
+  Vertex *vertex = graph->vertex(id);
+  if (vertex == nullptr)
+    throw TimingCheckpointError();
+  for (const RiseFall *rf : RiseFall::range()) {
+    for (DcalcAPIndex ap_index = 0; ap_index < ap_count_; ap_index++)
+      graph->setSlew(vertex, rf, ap_index, readFloat());
+  }
+}
+
+void
+TimingCheckpointReader::readEdge()
+{
+  Graph *graph = sta_->graph();
+  EdgeId id = readU32();
+  Edge *edge = graph->edge(id);
+  if (edge == nullptr)
+    throw TimingCheckpointError();
+  TimingArcSet *arc_set = edge->timingArcSet();
+  if (readU32() != arc_set->arcCount())
+    throw TimingCheckpointError();
+  for (const TimingArc *arc : arc_set->arcs()) {
+    for (DcalcAPIndex ap_index = 0; ap_index < ap_count_; ap_index++)
+      graph->setArcDelay(edge, arc, ap_index, readFloat());
+  }
+}
+
+bool
+TimingCheckpointReader::mapFile(const char *filename)
+{
+#ifndef _WIN32
+  fd_ = open(filename, O_RDONLY);
+  if (fd_ < 0)
+    return false;
+  struct stat sbuf;
+  if (fstat(fd_, &sbuf) != 0
+      || sbuf.st_size == 0) {
+    close(fd_);
+    fd_ = -1;
+    return false;
+  }
+  map_length_ = sbuf.st_size;
+  void *map = mmap(nullptr, map_length_, PROT_READ, MAP_PRIVATE, fd_, 0);
+  if (map == MAP_FAILED) {
+    close(fd_);
+    fd_ = -1;
+    return false;
+  }
+  data_ = static_cast<const char*>(map);
+#else
+  std::ifstream in(filename, std::ios::binary | std::ios::ate);
+  if (!in.is_open())
+    return false;
+  map_length_ = in.tellg();
+  in.seekg(0);
+  char *buffer = new char[map_length_];
+  in.read(buffer, map_length_);
+  if (in.fail()) {
+    delete [] buffer;
+    return false;
+  }
+  data_ = buffer;
+#endif
+  cursor_ = data_;
+  end_ = data_ + map_length_;
+  return true;
+}
+
+void
+TimingCheckpointReader::unmapFile()
+{
+#ifndef _WIN32
+  if (data_) {
+    munmap(const_cast<char*>(data_), map_length_);
+    close(fd_);
+    fd_ = -1;
+  }
+#else
+  delete [] data_;
+#endif
+  data_ = cursor_ = end_ = nullptr;
+}
+
+uint32_t
+TimingCheckpointReader::readU32()
+{
+  if (cursor_ + sizeof(uint32_t) > end_)
+    throw TimingCheckpointError();
+  uint32_t value;
+  memcpy(&value, cursor_, sizeof(value));
+  cursor_ += sizeof(value);
+  return value;
+}
+
+uint64_t
+TimingCheckpointReader::readU64()
+{
+  if (cursor_ + sizeof(uint64_t) > end_)
+    throw TimingCheckpointError();
+  uint64_t value;
+  memcpy(&value, cursor_, sizeof(value));
+  cursor_ += sizeof(value);
+  return value;
+}
+
+float
+TimingCheckpointReader::readFloat()
+{
+  if (cursor_ + sizeof(float) > end_)
+    throw TimingCheckpointError();
+  float value;
+  memcpy(&value, cursor_, sizeof(value));
+  cursor_ += sizeof(value);
+  return value;
+}
+
+bool
+readTimingCheckpoint(const char *filename,
+                     StaState *sta)
+{
+  TimingCheckpointReader reader(filename, sta);
+  return reader.read();
+}
+
+} // namespace
@@ -0,0 +1,141 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2025, Parallax Software, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+//
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// This notice may not be removed or altered from any source distribution.
+
+#include "TnsTree.hh"
+
+namespace sta {
+
+static constexpr size_t leaf_capacity_initial = 64;
+
+TnsTree::TnsTree() :
+  leaf_capacity_(0),
+  leaf_next_(0)
+{
+}
+
+void
+TnsTree::clear()
+{
+  tree_.clear();
+  leaf_capacity_ = 0;
+  leaf_next_ = 0;
+  leaf_map_.clear();
+  free_leaves_.clear();
+}
+
+bool
+TnsTree::hasVertex(const Vertex *vertex) const
+{
+  return leaf_map_.hasKey(vertex);
+}
+
+bool
+TnsTree::findSlack(const Vertex *vertex,
+		   // Return value.
+		   Slack &slack) const
+{
+  size_t leaf;
+  bool exists;
+  leaf_map_.findKey(vertex, leaf, exists);
+  if (exists)
+    slack = tree_[leaf_capacity_ + leaf];
+  return exists;
+}
+
+void
+TnsTree::setSlack(const Vertex *vertex,
+		  Slack slack)
+{
+  size_t leaf;
+  bool exists;
+  leaf_map_.findKey(vertex, leaf, exists);
+  if (!exists) {
+    if (!free_leaves_.empty()) {
+      leaf = free_leaves_.back();
+      free_leaves_.pop_back();
+    }
+    else {
+      if (leaf_next_ == leaf_capacity_)
+	grow();
+      leaf = leaf_next_++;
+    }
+    leaf_map_[vertex] = leaf;
+  }
+  DelayDbl &node = tree_[leaf_capacity_ + leaf];
+  node = 0.0;
+  node += slack;
+  resum(leaf);
+}
+
+void
+TnsTree::eraseSlack(const Vertex *vertex)
+{
+  size_t leaf;
+  bool exists;
+  leaf_map_.findKey(vertex, leaf, exists);
+  if (exists) {
+    tree_[leaf_capacity_ + leaf] = 0.0;
+    resum(leaf);
+    leaf_map_.erase(vertex);
+    free_leaves_.push_back(leaf);
+  }
+}
+
+Slack
+TnsTree::tns() const
+{
+  if (tree_.empty())
+    return 0.0;
+  return tree_[1];
+}
+
+void
+TnsTree::resum(size_t leaf)
+{
+  for (size_t i = (leaf_capacity_ + leaf) / 2; i >= 1; i /= 2) {
+    DelayDbl sum = tree_[i * 2];
+    sum += tree_[i * 2 + 1];
+    tree_[i] = sum;
+  }
+}
+
+void
+TnsTree::grow()
+{
+  size_t new_capacity = (leaf_capacity_ == 0)
+    ? leaf_capacity_initial
+    : leaf_capacity_ * 2;
+  std::vector<DelayDbl> new_tree(new_capacity * 2);
+  for (size_t i = 0; i < leaf_next_; i++)
+    new_tree[new_capacity + i] = tree_[leaf_capacity_ + i];
+  tree_.swap(new_tree);
+  leaf_capacity_ = new_capacity;
+  for (size_t i = leaf_capacity_ - 1; i >= 1; i--) {
+    DelayDbl sum = tree_[i * 2];
+    sum += tree_[i * 2 + 1];
+    tree_[i] = sum;
+  }
+}
+
+} // namespace
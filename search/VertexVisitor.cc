@@ -29,6 +29,14 @@
 
 namespace sta {
 
+void
+VertexVisitor::visitVertices(Vertex *const *vertices,
+			     size_t count)
+{
+  for (size_t i = 0; i < count; i++)
+    visit(vertices[i]);
+}
+
 VertexPinCollector::VertexPinCollector(PinSet &pins) :
   pins_(pins)
 {
@@ -28,7 +28,9 @@
 #include <fstream>
 
 #include "Debug.hh"
+#include "DispatchQueue.hh"
 #include "Error.hh"
+#include "Mutex.hh"
 #include "Report.hh"
 #include "StringUtil.hh"
 #include "FuncExpr.hh"
@@ -45,6 +47,7 @@
 #include "Parasitics.hh"
 #include "PathAnalysisPt.hh"
 #include "Path.hh"
+#include "PathEnd.hh"
 #include "PathExpanded.hh"
 #include "StaState.hh"
 #include "search/Sim.hh"
@@ -175,6 +178,66 @@ writePathSpice(Path *path,
   writer.writeSpice();
 }
 
+void
+writePathsSpice(PathEndSeq *path_ends,
+		const char *spice_dir,
+		const char *lib_subckt_filename,
+		const char *model_filename,
+		const char *power_name,
+		const char *gnd_name,
+		CircuitSim ckt_sim,
+		StaState *sta)
+{
+  // Parse the subckt library once; the index is shared read-only by
+  // the deck writers.
+  SpiceSubcktLib subckt_lib;
+  subckt_lib.parse(lib_subckt_filename);
+
+  // Worker exceptions cannot propagate across threads, so save the
+  // first error and rethrow it after the decks finish.
+  std::mutex error_lock;
+  string error_msg;
+  auto write_deck = [&](Path *path,
+			const string &spice_filename,
+			const string &subckt_filename) {
+    try {
+      WritePathSpice writer(path, spice_filename.c_str(),
+			    subckt_filename.c_str(),
+			    lib_subckt_filename, model_filename,
+			    power_name, gnd_name, ckt_sim, sta);
+      writer.setSubcktLib(&subckt_lib);
+      writer.writeSpice();
+    }
+    catch (std::exception &excp) {
+      LockGuard lock(error_lock);
+      if (error_msg.empty())
+	error_msg = excp.what();
+    }
+  };
+
+  DispatchQueue *dispatch_queue = sta->dispatchQueue();
+  bool parallel = sta->threadCount() > 1 && dispatch_queue;
+  int path_index = 1;
+  for (PathEnd *path_end : *path_ends) {
+    Path *path = path_end->path();
+    string path_name = "path_" + std::to_string(path_index);
+    string spice_filename = string(spice_dir) + "/" + path_name + ".sp";
+    string subckt_filename = string(spice_dir) + "/" + path_name + ".subckt";
+    if (parallel)
+      dispatch_queue->dispatch([write_deck, path, spice_filename,
+				subckt_filename](int) {
+	write_deck(path, spice_filename, subckt_filename);
+      });
+    else
+      write_deck(path, spice_filename, subckt_filename);
+    path_index++;
+  }
+  if (parallel)
+    dispatch_queue->finishTasks();
+  if (!error_msg.empty())
+    throw ExceptionMsg(error_msg.c_str(), false);
+}
+
 WritePathSpice::WritePathSpice(Path *path,
                                const char *spice_filename,
 			       const char *subckt_filename,
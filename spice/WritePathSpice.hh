@@ -25,6 +25,7 @@
 #pragma once
 
 #include "StringSet.hh"
+#include "SearchClass.hh"
 #include "CircuitSim.hh"
 
 namespace sta {
@@ -49,4 +50,19 @@ writePathSpice(Path *path,
                CircuitSim ckt_sim,
 	       StaState *sta);
 
+// Write a spice deck for each path end into spice_dir as
+// path_<n>.sp/path_<n>.subckt.  The subckt library is parsed once
+// into an in-memory index shared by all of the decks, which are
+// written by parallel workers.
+// Throws FileNotReadable, FileNotWritable, SubcktEndsMissing
+void
+writePathsSpice(PathEndSeq *path_ends,
+		const char *spice_dir,
+		const char *lib_subckt_filename,
+		const char *model_filename,
+		const char *power_name,
+		const char *gnd_name,
+		CircuitSim ckt_sim,
+		StaState *sta);
+
 } // namespace
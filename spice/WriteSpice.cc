@@ -85,6 +85,61 @@ SubcktEndsMissing::what() const noexcept
 
 ////////////////////////////////////////////////////////////////
 
+void
+SpiceSubcktLib::parse(const char *lib_subckt_filename)
+{
+  ifstream lib_subckts_stream(lib_subckt_filename);
+  if (!lib_subckts_stream.is_open())
+    throw FileNotReadable(lib_subckt_filename);
+  string line;
+  while (getline(lib_subckts_stream, line)) {
+    // .subckt <cell_name> [args..]
+    StringVector tokens;
+    split(line, " \t", tokens);
+    if (tokens.size() >= 2
+	&& stringEqual(tokens[0].c_str(), ".subckt")) {
+      const string cell_name = tokens[1];
+      Subckt &subckt = subckts_[cell_name];
+      subckt.header_tokens = tokens;
+      subckt.text = line + "\n";
+      bool found_ends = false;
+      string stmt;
+      while (getline(lib_subckts_stream, line)) {
+	subckt.text += line + "\n";
+	if (!line.empty() && line[0] == '+')
+	  stmt += line.substr(1);
+	else {
+	  // Process previous statement for subckt calls.
+	  if (!stmt.empty() && tolower(stmt[0]) == 'x') {
+	    StringVector stmt_tokens;
+	    split(stmt, " \t", stmt_tokens);
+	    if (!stmt_tokens.empty())
+	      subckt.call_cells.push_back(stmt_tokens[stmt_tokens.size() - 1]);
+	  }
+	  stmt = line;
+	}
+	if (stringBeginEqual(line.c_str(), ".ends")) {
+	  found_ends = true;
+	  break;
+	}
+      }
+      if (!found_ends)
+	throw SubcktEndsMissing(cell_name.c_str(), lib_subckt_filename);
+    }
+  }
+}
+
+const SpiceSubcktLib::Subckt *
+SpiceSubcktLib::findSubckt(const std::string &cell_name) const
+{
+  auto itr = subckts_.find(cell_name);
+  if (itr == subckts_.end())
+    return nullptr;
+  return &itr->second;
+}
+
+////////////////////////////////////////////////////////////////
+
 WriteSpice::WriteSpice(const char *spice_filename,
                        const char *subckt_filename,
                        const char *lib_subckt_filename,
@@ -103,6 +158,7 @@ WriteSpice::WriteSpice(const char *spice_filename,
   gnd_name_(gnd_name),
   ckt_sim_(ckt_sim),
   dcalc_ap_(dcalc_ap),
+  subckt_lib_(nullptr),
   default_library_(network_->defaultLibertyLibrary()),
   short_ckt_resistance_(.0001),
   cap_index_(1),
@@ -112,6 +168,12 @@ WriteSpice::WriteSpice(const char *spice_filename,
 {
 }
 
+void
+WriteSpice::setSubcktLib(const SpiceSubcktLib *subckt_lib)
+{
+  subckt_lib_ = subckt_lib;
+}
+
 void
 WriteSpice::initPowerGnd()
 {
@@ -197,6 +259,10 @@ WriteSpice::writeGnuplotFile(StdStringSeq &node_nanes)
 void
 WriteSpice::writeSubckts(StdStringSet &cell_names)
 {
+  if (subckt_lib_) {
+    writeSubcktsFromLib(cell_names);
+    return;
+  }
   findCellSubckts(cell_names);
   ifstream lib_subckts_stream(lib_subckt_filename_);
   if (lib_subckts_stream.is_open()) {
@@ -251,9 +317,53 @@ WriteSpice::writeSubckts(StdStringSet &cell_names)
     throw FileNotReadable(lib_subckt_filename_);
 }
 
+// Write the used subckt definitions from the pre-parsed library
+// index instead of streaming the library file.
+void
+WriteSpice::writeSubcktsFromLib(StdStringSet &cell_names)
+{
+  // Close cell_names over subckt calls (subckts can call subckts).
+  StdStringSet closure;
+  StdStringSeq worklist(cell_names.begin(), cell_names.end());
+  while (!worklist.empty()) {
+    string cell_name = worklist.back();
+    worklist.pop_back();
+    if (closure.insert(cell_name).second) {
+      const SpiceSubcktLib::Subckt *subckt = subckt_lib_->findSubckt(cell_name);
+      if (subckt) {
+	for (const string &call_cell : subckt->call_cells)
+	  worklist.push_back(call_cell);
+      }
+    }
+  }
+
+  ofstream subckts_stream(subckt_filename_);
+  if (!subckts_stream.is_open())
+    throw FileNotWritable(subckt_filename_);
+  string missing_cells;
+  for (const string &cell_name : closure) {
+    const SpiceSubcktLib::Subckt *subckt = subckt_lib_->findSubckt(cell_name);
+    if (subckt)
+      subckts_stream << subckt->text << "\n";
+    else {
+      missing_cells += "\n";
+      missing_cells += cell_name;
+    }
+  }
+  subckts_stream.close();
+  if (!missing_cells.empty())
+    report_->error(2349, "The subkct file %s is missing definitions for %s",
+		   lib_subckt_filename_,
+		   missing_cells.c_str());
+  // The streaming path records port names for every subckt header it
+  // scans, so record them all from the index.
+  for (const auto &[cell_name, subckt] : subckt_lib_->subckts())
+    recordSpicePortNames(cell_name.c_str(), subckt.header_tokens);
+}
+
 void
 WriteSpice::recordSpicePortNames(const char *cell_name,
-                                 StringVector &tokens)
+                                 const StringVector &tokens)
 {
   LibertyCell *cell = network_->findLibertyCell(cell_name);
   if (cell) {
@@ -892,7 +1002,6 @@ WriteSpice::gatePortValues(const Instance *,
   }
   Cudd_GenFree(cube_gen);
   Cudd_Ref(diff);
-  bdd_.clearVarMap();
 }
 
 #else
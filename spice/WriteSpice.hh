@@ -44,6 +44,30 @@ typedef Map<std::string, StringVector> CellSpicePortNames;
 typedef Map<const LibertyPort*, LogicValue> LibertyPortLogicValues;
 typedef std::vector<std::string> StdStringSeq;
 
+// Subckt library parsed into an in-memory index so batch deck writes
+// tokenize the library file once instead of re-reading it per deck.
+class SpiceSubcktLib
+{
+public:
+  struct Subckt
+  {
+    // .subckt <cell_name> [port...] header tokens.
+    StringVector header_tokens;
+    // Definition text, .subckt line through .ends.
+    std::string text;
+    // Subckts called by this definition (subckts can call subckts).
+    StringVector call_cells;
+  };
+
+  // Throws FileNotReadable, SubcktEndsMissing.
+  void parse(const char *lib_subckt_filename);
+  const Subckt *findSubckt(const std::string &cell_name) const;
+  const Map<std::string, Subckt> &subckts() const { return subckts_; }
+
+private:
+  Map<std::string, Subckt> subckts_;
+};
+
 // Utilities for writing a spice deck.
 class WriteSpice : public StaState
 {
@@ -57,6 +81,9 @@ public:
              CircuitSim ckt_sim,
              const DcalcAnalysisPt *dcalc_ap,
              const StaState *sta);
+  // Use a pre-parsed subckt library instead of streaming the library
+  // file.
+  void setSubcktLib(const SpiceSubcktLib *subckt_lib);
 
 protected:
   void initPowerGnd();
@@ -66,9 +93,10 @@ protected:
   void writePrintStmt(StdStringSeq &node_names);
   void writeGnuplotFile(StdStringSeq &node_nanes);
   void writeSubckts(StdStringSet &cell_names);
+  void writeSubcktsFromLib(StdStringSet &cell_names);
   void findCellSubckts(StdStringSet &cell_names);
   void recordSpicePortNames(const char *cell_name,
-			    StringVector &tokens);
+			    const StringVector &tokens);
   void writeSubcktInst(const Instance *inst);
   void writeSubcktInstVoltSrcs(const Instance *inst,
 			       LibertyPortLogicValues &port_values,
@@ -172,6 +200,9 @@ protected:
   const char *gnd_name_;
   CircuitSim ckt_sim_;
   const DcalcAnalysisPt *dcalc_ap_;
+  // Pre-parsed subckt library for batch writes, or null to stream
+  // the library file.
+  const SpiceSubcktLib *subckt_lib_;
 
   std::ofstream spice_stream_;
   LibertyLibrary *default_library_;
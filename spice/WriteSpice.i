@@ -48,4 +48,20 @@ write_path_spice_cmd(Path *path,
                       power_name, gnd_name, ckt_sim);
 }
 
+void
+write_paths_spice_cmd(PathEndSeq *path_ends,
+		      const char *spice_dir,
+		      const char *lib_subckt_filename,
+		      const char *model_filename,
+		      const char *power_name,
+		      const char *gnd_name,
+		      CircuitSim ckt_sim)
+{
+  Sta *sta = Sta::sta();
+  sta->writePathsSpice(path_ends, spice_dir,
+		       lib_subckt_filename, model_filename,
+		       power_name, gnd_name, ckt_sim);
+  delete path_ends;
+}
+
 %} // inline
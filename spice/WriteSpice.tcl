@@ -93,16 +93,10 @@ proc write_path_spice { args } {
   if { $path_ends == {} } {
     sta_error 1931 "No paths found for -path_args $path_args."
   } else {
-    set path_index 1
-    foreach path_end $path_ends {
-      set path [$path_end path]
-      set path_name "path_$path_index"
-      set spice_file [file join $spice_dir "$path_name.sp"]
-      set subckt_file [file join $spice_dir "$path_name.subckt"]
-      write_path_spice_cmd $path $spice_file $subckt_file \
-	$lib_subckt_file $model_file $power $ground $ckt_sim
-      incr path_index
-    }
+    # Batch write; the subckt library is parsed once and the decks
+    # path_<n>.sp are written by parallel workers.
+    write_paths_spice_cmd $path_ends $spice_dir \
+      $lib_subckt_file $model_file $power $ground $ckt_sim
   }
 }
 
@@ -25,17 +25,24 @@
 
 #include "Xyce.hh"
 
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
 #include <fstream>
 #include <sstream>
 #include <memory>
+#include <thread>
 
 #include "Error.hh"
+#include "Hash.hh"
+#include "Report.hh"
 
 namespace sta {
 
 using std::string;
 using std::ifstream;
 using std::getline;
+using std::min;
 using std::stringstream;
 using std::vector;
 using std::make_shared;
@@ -82,4 +89,135 @@ readXyceCsv(const char *csv_filename,
     throw FileNotReadable(csv_filename);
 }
 
+////////////////////////////////////////////////////////////////
+
+XyceSim::XyceSim(const char *xyce_command,
+                 int max_concurrent,
+                 Report *report) :
+  xyce_command_(xyce_command),
+  max_concurrent_(max_concurrent),
+  report_(report),
+  cache_hit_count_(0)
+{
+}
+
+XyceSim::~XyceSim()
+{
+  for (const auto& [hash, result] : cache_)
+    delete result;
+}
+
+void
+XyceSim::queueDeck(const char *spice_filename,
+                   const char *csv_filename)
+{
+  size_t deck_hash = hashDeck(spice_filename);
+  deck_hashes_[spice_filename] = deck_hash;
+  if (cache_.find(deck_hash) == cache_.end()) {
+    // Reserve the cache entry so later duplicates of this deck queued
+    // before simulate() runs are also cache hits.
+    cache_[deck_hash] = nullptr;
+    queue_.push_back({spice_filename, csv_filename, deck_hash,
+                      new XyceResult, string()});
+  }
+  else
+    cache_hit_count_++;
+}
+
+size_t
+XyceSim::hashDeck(const char *spice_filename)
+{
+  ifstream file(spice_filename);
+  if (file.is_open()) {
+    size_t hash = hash_init_value;
+    string line;
+    while (getline(file, line)) {
+      for (char ch : line)
+        hashIncr(hash, ch);
+      hashIncr(hash, '\n');
+    }
+    return hash;
+  }
+  else
+    throw FileNotReadable(spice_filename);
+}
+
+void
+XyceSim::simulate()
+{
+  runJobs(queue_);
+  for (Job &job : queue_) {
+    if (!job.error_msg.empty()) {
+      delete job.result;
+      report_->error(2351, "%s", job.error_msg.c_str());
+    }
+    cache_[job.deck_hash] = job.result;
+  }
+  queue_.clear();
+}
+
+void
+XyceSim::runJobs(vector<Job> &jobs)
+{
+  size_t thread_count = min(static_cast<size_t>(max_concurrent_),
+                            jobs.size());
+  if (thread_count <= 1) {
+    for (Job &job : jobs)
+      runJob(job);
+  }
+  else {
+    // Xyce processes block their worker thread, so hand out jobs one
+    // at a time instead of chunking; stage run times vary widely.
+    std::atomic<size_t> next_job(0);
+    vector<std::thread> threads;
+    threads.reserve(thread_count);
+    for (size_t k = 0; k < thread_count; k++)
+      threads.emplace_back([&jobs, &next_job, this]() {
+        while (true) {
+          size_t i = next_job.fetch_add(1);
+          if (i >= jobs.size())
+            break;
+          runJob(jobs[i]);
+        }
+      });
+    for (std::thread &thread : threads)
+      thread.join();
+  }
+}
+
+void
+XyceSim::runJob(Job &job)
+{
+  string cmd = xyce_command_;
+  cmd += ' ';
+  cmd += job.spice_filename;
+  cmd += " > /dev/null 2>&1";
+  int status = std::system(cmd.c_str());
+  if (status != 0)
+    job.error_msg = "simulation command '" + cmd + "' failed.";
+  else {
+    // Errors cannot propagate across the worker threads, so save the
+    // message for simulate() to report after the join.
+    try {
+      readXyceCsv(job.csv_filename.c_str(), job.result->titles,
+                  job.result->waveforms);
+    }
+    catch (std::exception &excp) {
+      job.error_msg = excp.what();
+    }
+  }
+}
+
+const XyceResult *
+XyceSim::result(const char *spice_filename) const
+{
+  auto hash_itr = deck_hashes_.find(spice_filename);
+  if (hash_itr != deck_hashes_.end()) {
+    auto cache_itr = cache_.find(hash_itr->second);
+    if (cache_itr != cache_.end())
+      return cache_itr->second;
+  }
+  return nullptr;
+}
+
 } // namespace
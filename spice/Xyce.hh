@@ -24,6 +24,7 @@
 
 #pragma once
 
+#include <map>
 #include <string>
 #include <vector>
 
@@ -31,6 +32,8 @@
 
 namespace sta {
 
+class Report;
+
 typedef std::vector<std::string> StdStringSeq;
 typedef std::vector<Table1> WaveformSeq;
 
@@ -40,4 +43,60 @@ readXyceCsv(const char *csv_filename,
             StdStringSeq &titles,
             WaveformSeq &waveforms);
 
+// Simulation results for one deck; one waveform per .print column.
+class XyceResult
+{
+public:
+  StdStringSeq titles;
+  WaveformSeq waveforms;
+};
+
+// Pipelined batch runner for external Xyce simulations.  Queued decks
+// are hashed by content so repeated stages (identical cell/load/slew)
+// are simulated once; the remaining decks run on up to max_concurrent
+// Xyce processes with results collected as the simulations finish.
+class XyceSim
+{
+public:
+  XyceSim(const char *xyce_command,
+          int max_concurrent,
+          Report *report);
+  ~XyceSim();
+  // Queue a deck whose .print statement writes csv_filename.
+  // Throws FileNotReadable if the deck cannot be read.
+  void queueDeck(const char *spice_filename,
+                 const char *csv_filename);
+  // Run the queued decks and collect their results.
+  // Blocks until all of the simulations finish.
+  void simulate();
+  // Result for a simulated deck, or nullptr.
+  const XyceResult *result(const char *spice_filename) const;
+  // Queued decks that hit the result cache.
+  size_t cacheHitCount() const { return cache_hit_count_; }
+
+private:
+  struct Job
+  {
+    std::string spice_filename;
+    std::string csv_filename;
+    size_t deck_hash;
+    XyceResult *result;
+    std::string error_msg;
+  };
+
+  size_t hashDeck(const char *spice_filename);
+  void runJobs(std::vector<Job> &jobs);
+  void runJob(Job &job);
+
+  std::string xyce_command_;
+  int max_concurrent_;
+  Report *report_;
+  std::vector<Job> queue_;
+  // Deck content hash to simulation result.
+  std::map<size_t, XyceResult*> cache_;
+  // Deck filename to content hash, for result().
+  std::map<std::string, size_t> deck_hashes_;
+  size_t cache_hit_count_;
+};
+
 } // namespace
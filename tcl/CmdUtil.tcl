@@ -117,6 +117,213 @@ proc with_output_to_variable { var_name args } {
 
 ################################################################
 
+define_cmd_args "report_profile" {}
+
+# Report the tree of profiled phases with call count, elapsed/cpu
+# time and memory growth per phase.
+proc_redirect report_profile {
+  check_argc_eq0 "report_profile" $args
+  report_profile_cmd
+}
+
+define_cmd_args "clear_profile" {}
+
+proc clear_profile { args } {
+  check_argc_eq0 "clear_profile" $args
+  clear_profile_cmd
+}
+
+define_cmd_args "report_query_stats" {}
+
+# Report hot path counter totals (delay calcs, arrival/required
+# visits) attributed to the commands that triggered them.
+proc_redirect report_query_stats {
+  check_argc_eq0 "report_query_stats" $args
+  report_query_stats_cmd
+}
+
+define_cmd_args "clear_query_stats" {}
+
+proc clear_query_stats { args } {
+  check_argc_eq0 "clear_query_stats" $args
+  clear_query_stats_cmd
+}
+
+define_cmd_args "report_memory" {}
+
+# Report per-subsystem memory usage and object counts.
+proc_redirect report_memory {
+  check_argc_eq0 "report_memory" $args
+  report_memory_cmd
+}
+
+################################################################
+
+define_cmd_args "start_query_capture" {filename}
+
+# Log each command completion with its arguments, result and wall
+# time to filename as a trace replay_queries can re-execute.
+# Commands sourced from a file (read_sdc) are captured line by line,
+# and object queries (get_ports etc) are captured before the commands
+# that use their results so replay can rebind the object pointers.
+proc start_query_capture { args } {
+  variable cmd_args
+  variable query_capture_stream
+  variable query_capture_begins
+
+  check_argc_eq1 "start_query_capture" $args
+  if { [info exists query_capture_stream] } {
+    sta_error 2217 "query capture is already in progress."
+  }
+  set query_capture_stream [open [lindex $args 0] "w"]
+  set query_capture_begins {}
+  foreach cmd [array names cmd_args] {
+    if { ![query_capture_excluded $cmd] \
+	   && [info commands $cmd] != {} } {
+      trace add execution $cmd enter [namespace code query_capture_enter]
+      trace add execution $cmd leave [namespace code query_capture_leave]
+    }
+  }
+}
+
+define_cmd_args "stop_query_capture" {}
+
+proc stop_query_capture { args } {
+  variable cmd_args
+  variable query_capture_stream
+
+  check_argc_eq0 "stop_query_capture" $args
+  if { ![info exists query_capture_stream] } {
+    sta_error 2218 "no query capture is in progress."
+  }
+  foreach cmd [array names cmd_args] {
+    if { ![query_capture_excluded $cmd] \
+	   && [info commands $cmd] != {} } {
+      trace remove execution $cmd enter [namespace code query_capture_enter]
+      trace remove execution $cmd leave [namespace code query_capture_leave]
+    }
+  }
+  close $query_capture_stream
+  unset query_capture_stream
+}
+
+# The capture and replay commands cannot capture themselves.
+proc query_capture_excluded { cmd } {
+  return [expr { $cmd == "start_query_capture" \
+		   || $cmd == "stop_query_capture" \
+		   || $cmd == "replay_queries" }]
+}
+
+proc query_capture_enter { cmd_str op } {
+  variable query_capture_begins
+  lappend query_capture_begins [clock microseconds]
+}
+
+proc query_capture_leave { cmd_str code result op } {
+  variable query_capture_stream
+  variable query_capture_begins
+
+  set begin [lindex $query_capture_begins end]
+  set query_capture_begins [lrange $query_capture_begins 0 end-1]
+  # Commands called inside another captured command re-run with it,
+  # so only top level commands that succeeded are traced.
+  if { $query_capture_begins == {} && $code == 0 } {
+    set elapsed [expr [clock microseconds] - $begin]
+    # Results are only recorded when they hold object pointers replay
+    # can rebind.
+    set record {}
+    if { ![catch {lindex $result 0} first] \
+	   && $first != "" && [is_object $first] } {
+      set record $result
+    }
+    puts $query_capture_stream \
+      [list sta::replay_query $cmd_str $record $elapsed]
+    flush $query_capture_stream
+  }
+}
+
+define_cmd_args "replay_queries" {filename}
+
+# Re-execute a start_query_capture trace and report the wall time of
+# each command next to the captured time, so a trace captured on one
+# build measures per command deltas on another. Object pointers in
+# the trace are rebound to the pointers the replayed object queries
+# return in this session.
+proc_redirect replay_queries {
+  variable replay_object_map
+  variable replay_time
+  variable replay_ref_time
+
+  check_argc_eq1 "replay_queries" $args
+  array unset replay_object_map
+  set replay_time 0
+  set replay_ref_time 0
+  report_line [format "%10s %10s %10s  %s" \
+		 "time" "captured" "delta" "command"]
+  uplevel #0 [list source [lindex $args 0]]
+  report_line [format "%10.3f %10.3f %+10.3f  total" \
+		 [expr $replay_time * 1e-6] \
+		 [expr $replay_ref_time * 1e-6] \
+		 [expr ($replay_time - $replay_ref_time) * 1e-6]]
+}
+
+define_hidden_cmd_args "replay_query" {cmd captured_result captured_time}
+
+# Trace entries written by start_query_capture.
+proc replay_query { cmd captured_result captured_time } {
+  variable replay_object_map
+  variable replay_time
+  variable replay_ref_time
+
+  if { [catch {llength $cmd}] } {
+    # Not a well formed list; replay it verbatim.
+    set words $cmd
+  } else {
+    set words {}
+    foreach word $cmd {
+      lappend words [replay_map_word $word]
+    }
+  }
+  set begin [clock microseconds]
+  set code [catch { uplevel #0 $words } result]
+  set elapsed [expr [clock microseconds] - $begin]
+  if { $code != 0 } {
+    sta_warn 2219 "replay of '[lindex $cmd 0]' failed: $result"
+  } elseif { [llength $captured_result] == [llength $result] } {
+    foreach old $captured_result new $result {
+      if { [is_object $old] } {
+	set replay_object_map($old) $new
+      }
+    }
+  }
+  incr replay_time $elapsed
+  incr replay_ref_time $captured_time
+  report_line [format "%10.3f %10.3f %+10.3f  %s" \
+		 [expr $elapsed * 1e-6] \
+		 [expr $captured_time * 1e-6] \
+		 [expr ($elapsed - $captured_time) * 1e-6] \
+		 [string range $cmd 0 59]]
+}
+
+# Map captured object pointers (and lists of them) to this session's.
+proc replay_map_word { word } {
+  variable replay_object_map
+
+  if { [info exists replay_object_map($word)] } {
+    return $replay_object_map($word)
+  } elseif { ![catch {llength $word} length] && $length > 1 } {
+    set mapped {}
+    foreach element $word {
+      lappend mapped [replay_map_word $element]
+    }
+    return $mapped
+  } else {
+    return $word
+  }
+}
+
+################################################################
+
 define_cmd_args "report_units" {}
 
 proc report_units { args } {
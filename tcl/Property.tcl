@@ -43,45 +43,96 @@ proc get_property { args } {
     set object [get_property_object_type $object_type $object $quiet]
   }
   set prop [lindex $args 1]
-  return [get_object_property $object $prop]
+  begin_query_stats "get_property"
+  set value [get_object_property $object $prop]
+  end_query_stats
+  return $value
 }
 
 proc get_object_property { object prop } {
   if { [is_object $object] } {
-    set object_type [object_type $object]
-    if { $object_type == "Instance" } {
-      return [instance_property $object $prop]
-    } elseif { $object_type == "Pin" } {
-      return [pin_property $object $prop]
-    } elseif { $object_type == "Net" } {
-      return [net_property $object $prop]
-    } elseif { $object_type == "Clock" } {
-      return [clock_property $object $prop]
-    } elseif { $object_type == "Port" } {
-      return [port_property $object $prop]
-    } elseif { $object_type == "LibertyPort" } {
-      return [liberty_port_property $object $prop]
-    } elseif { $object_type == "LibertyCell" } {
-      return [liberty_cell_property $object $prop]
-    } elseif { $object_type == "Cell" } {
-      return [cell_property $object $prop]
-    } elseif { $object_type == "Library" } {
-      return [library_property $object $prop]
-    } elseif { $object_type == "LibertyLibrary" } {
-      return [liberty_library_property $object $prop]
-    } elseif { $object_type == "Edge" } {
-      return [edge_property $object $prop]
-    } elseif { $object_type == "PathEnd" } {
-      return [path_end_property $object $prop]
-    } elseif { $object_type == "Path" } {
-      return [path_property $object $prop]
-    } elseif { $object_type == "TimingArcSet" } {
-      return [timing_arc_property $object $prop]
+    set prop_cmd [property_type_cmd $object]
+    return [$prop_cmd $object $prop]
+  } else {
+    sta_error 2204 "get_property $object is not an object."
+  }
+}
+
+define_cmd_args "get_property_batch" \
+  {[-object_type library|liberty_library|cell|liberty_cell|instance|pin|net|port|clock|timing_arc] objects properties}
+
+# Returns a list with one row of property values per object.
+# The object type dispatch of get_property is done once for the whole
+# list instead of once per object, which matters when dumping
+# attributes for large collections.
+proc get_property_batch { args } {
+  parse_key_args "get_property_batch" args keys {-object_type} flags {-quiet}
+  check_argc_eq2 "get_property_batch" $args
+  set quiet [info exists flags(-quiet)]
+  set objects [lindex $args 0]
+  set props [lindex $args 1]
+  if { $objects == "" } {
+    return {}
+  }
+  if { ![is_object [lindex $objects 0]] } {
+    if [info exists keys(-object_type)] {
+      set object_type $keys(-object_type)
     } else {
-      sta_error 2203 "get_property unsupported object type $object_type."
+      sta_error 2207 "get_property_batch -object_type must be specified with object name arguments."
+    }
+    set objects1 {}
+    foreach object $objects {
+      lappend objects1 [get_property_object_type $object_type $object $quiet]
     }
+    set objects $objects1
+  }
+  set prop_cmd [property_type_cmd [lindex $objects 0]]
+  set result {}
+  foreach object $objects {
+    set row {}
+    foreach prop $props {
+      lappend row [$prop_cmd $object $prop]
+    }
+    lappend result $row
+  }
+  return $result
+}
+
+proc property_type_cmd { object } {
+  if { ![is_object $object] } {
+    sta_error 2208 "get_property_batch $object is not an object."
+  }
+  set object_type [object_type $object]
+  if { $object_type == "Instance" } {
+    return "instance_property"
+  } elseif { $object_type == "Pin" } {
+    return "pin_property"
+  } elseif { $object_type == "Net" } {
+    return "net_property"
+  } elseif { $object_type == "Clock" } {
+    return "clock_property"
+  } elseif { $object_type == "Port" } {
+    return "port_property"
+  } elseif { $object_type == "LibertyPort" } {
+    return "liberty_port_property"
+  } elseif { $object_type == "LibertyCell" } {
+    return "liberty_cell_property"
+  } elseif { $object_type == "Cell" } {
+    return "cell_property"
+  } elseif { $object_type == "Library" } {
+    return "library_property"
+  } elseif { $object_type == "LibertyLibrary" } {
+    return "liberty_library_property"
+  } elseif { $object_type == "Edge" } {
+    return "edge_property"
+  } elseif { $object_type == "PathEnd" } {
+    return "path_end_property"
+  } elseif { $object_type == "Path" } {
+    return "path_property"
+  } elseif { $object_type == "TimingArcSet" } {
+    return "timing_arc_property"
   } else {
-    sta_error 2204 "get_property $object is not an object."
+    sta_error 2203 "get_property unsupported object type $object_type."
   }
 }
 
@@ -0,0 +1,145 @@
+# OpenSTA, Static Timing Analyzer
+# Copyright (c) 2025, Parallax Software, Inc.
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program. If not, see <https://www.gnu.org/licenses/>.
+#
+# The origin of this software must not be misrepresented; you must not
+# claim that you wrote the original software.
+#
+# Altered source versions must be plainly marked as such, and must not be
+# misrepresented as being the original software.
+#
+# This notice may not be removed or altered from any source distribution.
+
+namespace eval sta {
+
+################################################################
+#
+# Server mode
+#
+# Keep the loaded, constrained, timed design resident and answer
+# queries over a localhost socket, so scripts that would otherwise
+# invoke sta (and pay the design load) per query share one warm
+# instance with incremental search state.
+#
+# Each request is one line of Tcl evaluated in the server command
+# interpreter.  Each reply is a header line "ok <byte_count>" or
+# "error <byte_count>" followed by exactly byte_count bytes of result
+# or error message.  The request "server_exit" shuts the server down.
+#
+# The server evaluates arbitrary commands, so it only listens on the
+# loopback interface.
+#
+# With -workers, the timing is brought up to date and worker
+# processes are forked that share the solved design copy-on-write and
+# accept connections on the same listening socket, so read-only
+# queries execute concurrently instead of serializing on one
+# interpreter.  The kernel distributes accepted connections across
+# the processes.  A mutation in a worker only affects that worker's
+# copy of the design, so workers should be limited to read-only
+# queries.
+#
+################################################################
+
+define_cmd_args "sta_server" {[-port port] [-workers worker_count]}
+
+proc sta_server { args } {
+  variable server_done
+  parse_key_args "sta_server" args keys {-port -workers} flags {}
+  set port 0
+  if { [info exists keys(-port)] } {
+    set port $keys(-port)
+    check_cardinal "-port" $port
+  }
+  set workers 0
+  if { [info exists keys(-workers)] } {
+    set workers $keys(-workers)
+    check_cardinal "-workers" $workers
+  }
+  if { $workers > 0 } {
+    # Solve the timing before forking so the workers share the
+    # completed search state copy-on-write instead of each
+    # re-solving it on the first query.
+    find_timing_cmd 0 "NULL"
+    find_requireds
+  }
+  if { [catch { socket -server sta::server_accept -myaddr localhost $port } \
+	  server] } {
+    sta_error 2213 "cannot listen on port $port ($server)."
+  }
+  report_line "Listening on port [lindex [fconfigure $server -sockname] 2]."
+  set server_done 0
+  set worker_pids {}
+  for { set i 0 } { $i < $workers } { incr i } {
+    set pid [fork_query_worker_cmd]
+    if { $pid == 0 } {
+      # Query worker; serve requests from the inherited listening
+      # socket until the parent shuts the server down.
+      vwait sta::server_done
+      exit 0
+    } elseif { $pid > 0 } {
+      lappend worker_pids $pid
+    } else {
+      sta_warn 2215 "failed to fork query worker."
+    }
+  }
+  vwait sta::server_done
+  close $server
+  foreach pid $worker_pids {
+    catch { exec kill $pid }
+    wait_worker_cmd $pid
+  }
+}
+
+proc server_accept { socket addr port } {
+  fconfigure $socket -blocking 0 -buffering none -translation binary
+  fileevent $socket readable [list sta::server_read $socket]
+}
+
+proc server_read { socket } {
+  variable server_done
+  if { [catch { gets $socket line } count] || $count < 0 } {
+    if { [eof $socket] } {
+      close $socket
+    }
+    # Otherwise the line is incomplete; wait for the rest.
+    return
+  }
+  set line [string trim $line]
+  if { $line == "" } {
+    return
+  }
+  if { $line == "server_exit" } {
+    server_reply $socket "ok" ""
+    close $socket
+    set server_done 1
+    return
+  }
+  if { [catch { uplevel #0 $line } result] } {
+    server_reply $socket "error" $result
+  } else {
+    server_reply $socket "ok" $result
+  }
+}
+
+proc server_reply { socket status result } {
+  set payload [encoding convertto utf-8 $result]
+  if { [catch { puts -nonewline $socket \
+		  "$status [string length $payload]\n$payload" }] } {
+    close $socket
+  }
+}
+
+# sta namespace end.
+}
@@ -60,6 +60,22 @@ typedef MinMaxAll MinMaxAllNull;
     typedef int Tcl_Size;
 #endif
 
+// Object pointer for a tcl object crossing into C++.
+// tclObjectHandle handles unwrap without string parsing; anything
+// else (handles that round-tripped through files, user built strings)
+// falls back to the swig pointer string parser.
+static void *
+tclObjPtr(Tcl_Obj *obj,
+          swig_type_info *swig_type,
+          Tcl_Interp *)
+{
+  void *ptr = tclObjectHandlePtr(obj, swig_type->name);
+  if (ptr == nullptr)
+    // Ignore returned TCL_ERROR because can't get swig_type_info.
+    SWIG_ConvertPtr(obj, &ptr, swig_type, false);
+  return ptr;
+}
+
 template <class TYPE>
 Vector<TYPE> *
 tclListSeqPtr(Tcl_Obj *const source,
@@ -72,10 +88,9 @@ tclListSeqPtr(Tcl_Obj *const source,
   if (Tcl_ListObjGetElements(interp, source, &argc, &argv) == TCL_OK
       && argc > 0) {
     Vector<TYPE> *seq = new Vector<TYPE>;
+    seq->reserve(argc);
     for (int i = 0; i < argc; i++) {
-      void *obj;
-      // Ignore returned TCL_ERROR because can't get swig_type_info.
-      SWIG_ConvertPtr(argv[i], &obj, swig_type, false);
+      void *obj = tclObjPtr(argv[i], swig_type, interp);
       seq->push_back(reinterpret_cast<TYPE>(obj));
     }
     return seq;
@@ -96,10 +111,9 @@ tclListSeq(Tcl_Obj *const source,
   std::vector<TYPE> seq;
   if (Tcl_ListObjGetElements(interp, source, &argc, &argv) == TCL_OK
       && argc > 0) {
+    seq.reserve(argc);
     for (int i = 0; i < argc; i++) {
-      void *obj;
-      // Ignore returned TCL_ERROR because can't get swig_type_info.
-      SWIG_ConvertPtr(argv[i], &obj, swig_type, false);
+      void *obj = tclObjPtr(argv[i], swig_type, interp);
       seq.push_back(reinterpret_cast<TYPE>(obj));
     }
   }
@@ -118,9 +132,7 @@ tclListSetPtr(Tcl_Obj *const source,
       && argc > 0) {
     SET_TYPE *set = new SET_TYPE;
     for (int i = 0; i < argc; i++) {
-      void *obj;
-      // Ignore returned TCL_ERROR because can't get swig_type_info.
-      SWIG_ConvertPtr(argv[i], &obj, swig_type, false);
+      void *obj = tclObjPtr(argv[i], swig_type, interp);
       set->insert(reinterpret_cast<OBJECT_TYPE*>(obj));
     }
     return set;
@@ -141,9 +153,7 @@ tclListSet(Tcl_Obj *const source,
       && argc > 0) {
     SET_TYPE set;
     for (int i = 0; i < argc; i++) {
-      void *obj;
-      // Ignore returned TCL_ERROR because can't get swig_type_info.
-      SWIG_ConvertPtr(argv[i], &obj, swig_type, false);
+      void *obj = tclObjPtr(argv[i], swig_type, interp);
       set.insert(reinterpret_cast<OBJECT_TYPE>(obj));
     }
     return set;
@@ -165,9 +175,7 @@ tclListNetworkSet(Tcl_Obj *const source,
       && argc > 0) {
     SET_TYPE *set = new SET_TYPE(network);
     for (int i = 0; i < argc; i++) {
-      void *obj;
-      // Ignore returned TCL_ERROR because can't get swig_type_info.
-      SWIG_ConvertPtr(argv[i], &obj, swig_type, false);
+      void *obj = tclObjPtr(argv[i], swig_type, interp);
       set->insert(reinterpret_cast<OBJECT_TYPE*>(obj));
     }
     return set;
@@ -189,9 +197,7 @@ tclListNetworkSet1(Tcl_Obj *const source,
   if (Tcl_ListObjGetElements(interp, source, &argc, &argv) == TCL_OK
       && argc > 0) {
     for (int i = 0; i < argc; i++) {
-      void *obj;
-      // Ignore returned TCL_ERROR because can't get swig_type_info.
-      SWIG_ConvertPtr(argv[i], &obj, swig_type, false);
+      void *obj = tclObjPtr(argv[i], swig_type, interp);
       set.insert(reinterpret_cast<OBJECT_TYPE*>(obj));
     }
   }
@@ -200,20 +206,21 @@ tclListNetworkSet1(Tcl_Obj *const source,
 
 ////////////////////////////////////////////////////////////////
 
-// Sequence out to tcl list.
+// Sequence out to tcl list.  The list is built in one pass from
+// object handles instead of appending swig pointer strings one
+// element at a time.
 template <class SEQ_TYPE, class OBJECT_TYPE>
 void
 seqPtrTclList(SEQ_TYPE *seq,
               swig_type_info *swig_type,
               Tcl_Interp *interp)
 {
-  Tcl_Obj *list = Tcl_NewListObj(0, nullptr);
-  for (const OBJECT_TYPE *obj : *seq) {
-    Tcl_Obj *tcl_obj = SWIG_NewInstanceObj(const_cast<OBJECT_TYPE*>(obj),
-                                           swig_type, false);
-    Tcl_ListObjAppendElement(interp, list, tcl_obj);
-  }
-  Tcl_SetObjResult(interp, list);
+  std::vector<Tcl_Obj*> objs;
+  objs.reserve(seq->size());
+  for (const OBJECT_TYPE *obj : *seq)
+    objs.push_back(tclObjectHandle(const_cast<OBJECT_TYPE*>(obj),
+                                   swig_type->name));
+  Tcl_SetObjResult(interp, Tcl_NewListObj(objs.size(), objs.data()));
 }
 
 template <class SEQ_TYPE, class OBJECT_TYPE>
@@ -222,13 +229,12 @@ seqTclList(SEQ_TYPE &seq,
            swig_type_info *swig_type,
            Tcl_Interp *interp)
 {
-  Tcl_Obj *list = Tcl_NewListObj(0, nullptr);
-  for (const OBJECT_TYPE *obj : seq) {
-    Tcl_Obj *tcl_obj = SWIG_NewInstanceObj(const_cast<OBJECT_TYPE*>(obj),
-                                           swig_type, false);
-    Tcl_ListObjAppendElement(interp, list, tcl_obj);
-  }
-  Tcl_SetObjResult(interp, list);
+  std::vector<Tcl_Obj*> objs;
+  objs.reserve(seq.size());
+  for (const OBJECT_TYPE *obj : seq)
+    objs.push_back(tclObjectHandle(const_cast<OBJECT_TYPE*>(obj),
+                                   swig_type->name));
+  Tcl_SetObjResult(interp, Tcl_NewListObj(objs.size(), objs.data()));
 }
 
 template <class SET_TYPE, class OBJECT_TYPE>
@@ -237,13 +243,12 @@ setTclList(SET_TYPE set,
            swig_type_info *swig_type,
            Tcl_Interp *interp)
 {
-  Tcl_Obj *list = Tcl_NewListObj(0, nullptr);
-  for (const OBJECT_TYPE *obj : set) {
-    Tcl_Obj *tcl_obj = SWIG_NewInstanceObj(const_cast<OBJECT_TYPE*>(obj),
-                                           swig_type, false);
-    Tcl_ListObjAppendElement(interp, list, tcl_obj);
-  }
-  Tcl_SetObjResult(interp, list);
+  std::vector<Tcl_Obj*> objs;
+  objs.reserve(set.size());
+  for (const OBJECT_TYPE *obj : set)
+    objs.push_back(tclObjectHandle(const_cast<OBJECT_TYPE*>(obj),
+                                   swig_type->name));
+  Tcl_SetObjResult(interp, Tcl_NewListObj(objs.size(), objs.data()));
 }
 
 template <class SET_TYPE, class OBJECT_TYPE>
@@ -252,13 +257,12 @@ setPtrTclList(SET_TYPE *set,
               swig_type_info *swig_type,
               Tcl_Interp *interp)
 {
-  Tcl_Obj *list = Tcl_NewListObj(0, nullptr);
-  for (const OBJECT_TYPE *obj : *set) {
-    Tcl_Obj *tcl_obj = SWIG_NewInstanceObj(const_cast<OBJECT_TYPE*>(obj),
-                                           swig_type, false);
-    Tcl_ListObjAppendElement(interp, list, tcl_obj);
-  }
-  Tcl_SetObjResult(interp, list);
+  std::vector<Tcl_Obj*> objs;
+  objs.reserve(set->size());
+  for (const OBJECT_TYPE *obj : *set)
+    objs.push_back(tclObjectHandle(const_cast<OBJECT_TYPE*>(obj),
+                                   swig_type->name));
+  Tcl_SetObjResult(interp, Tcl_NewListObj(objs.size(), objs.data()));
 }
 
 ////////////////////////////////////////////////////////////////
@@ -1051,6 +1055,8 @@ using namespace sta;
     $1 = ReportPathFormat::slack_only;
   else if (stringEq(arg, "json"))
     $1 = ReportPathFormat::json;
+  else if (stringEq(arg, "json_stream"))
+    $1 = ReportPathFormat::json_stream;
   else {
     tclArgError(interp, 2170, "unknown path type %s.", arg);
     return TCL_ERROR;
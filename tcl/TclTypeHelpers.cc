@@ -24,6 +24,7 @@
 
 #include "TclTypeHelpers.hh"
 
+#include "StringUtil.hh"
 #include "Liberty.hh"
 #include "Network.hh"
 #include "Sta.hh"
@@ -141,6 +142,86 @@ objectListNext(const char *list,
   }
 }
 
+////////////////////////////////////////////////////////////////
+
+static void
+tclObjectHandleDup(Tcl_Obj *src,
+		   Tcl_Obj *copy);
+static void
+tclObjectHandleUpdateString(Tcl_Obj *obj);
+
+static const Tcl_ObjType tcl_object_handle_type = {
+  "sta_object",
+  nullptr,			// freeIntRepProc
+  tclObjectHandleDup,
+  tclObjectHandleUpdateString,
+  nullptr			// setFromAnyProc
+#if TCL_MAJOR_VERSION >= 9
+  , TCL_OBJTYPE_V0
+#endif
+};
+
+Tcl_Obj *
+tclObjectHandle(void *object,
+		const char *type_name)
+{
+  Tcl_Obj *obj = Tcl_NewObj();
+  obj->internalRep.twoPtrValue.ptr1 = object;
+  obj->internalRep.twoPtrValue.ptr2 = const_cast<char*>(type_name);
+  obj->typePtr = &tcl_object_handle_type;
+  Tcl_InvalidateStringRep(obj);
+  return obj;
+}
+
+void *
+tclObjectHandlePtr(Tcl_Obj *obj,
+		   const char *type_name)
+{
+  if (obj->typePtr == &tcl_object_handle_type) {
+    const char *handle_type =
+      static_cast<const char*>(obj->internalRep.twoPtrValue.ptr2);
+    if (handle_type == type_name
+	|| stringEq(handle_type, type_name))
+      return obj->internalRep.twoPtrValue.ptr1;
+  }
+  return nullptr;
+}
+
+static void
+tclObjectHandleDup(Tcl_Obj *src,
+		   Tcl_Obj *copy)
+{
+  copy->internalRep.twoPtrValue = src->internalRep.twoPtrValue;
+  copy->typePtr = src->typePtr;
+}
+
+// _hexaddress_p_type, pointer bytes in memory order to match
+// swig's SWIG_PackData encoding (see objectListNext above).
+static void
+tclObjectHandleUpdateString(Tcl_Obj *obj)
+{
+  static const char hex_digits[] = "0123456789abcdef";
+  void *object = obj->internalRep.twoPtrValue.ptr1;
+  const char *type_name =
+    static_cast<const char*>(obj->internalRep.twoPtrValue.ptr2);
+  // type_name begins with "_p_".
+  size_t name_length = strlen(type_name);
+  size_t length = 1 + sizeof(void*) * 2 + name_length;
+  char *bytes = static_cast<char*>(Tcl_Alloc(length + 1));
+  char *b = bytes;
+  *b++ = '_';
+  const unsigned char *u = reinterpret_cast<const unsigned char*>(&object);
+  for (size_t i = 0; i < sizeof(void*); i++) {
+    *b++ = hex_digits[(u[i] & 0xf0) >> 4];
+    *b++ = hex_digits[u[i] & 0x0f];
+  }
+  memcpy(b, type_name, name_length + 1);
+  obj->bytes = bytes;
+  obj->length = length;
+}
+
+////////////////////////////////////////////////////////////////
+
 Tcl_Obj *
 tclArcDcalcArg(ArcDcalcArg &gate,
                Tcl_Interp *interp)
@@ -168,6 +168,54 @@ proc trace_pocv_enabled { name1 name2 op } {
     pocv_enabled set_pocv_enabled
 }
 
+trace variable ::sta_liberty_cache_enabled "rw" \
+  sta::trace_liberty_cache_enabled
+
+proc trace_liberty_cache_enabled { name1 name2 op } {
+  trace_boolean_var $op ::sta_liberty_cache_enabled \
+    liberty_cache_enabled set_liberty_cache_enabled
+}
+
+trace variable ::sta_liberty_lazy_enabled "rw" \
+  sta::trace_liberty_lazy_enabled
+
+proc trace_liberty_lazy_enabled { name1 name2 op } {
+  trace_boolean_var $op ::sta_liberty_lazy_enabled \
+    liberty_lazy_enabled set_liberty_lazy_enabled
+}
+
+trace variable ::sta_spef_cache_enabled "rw" \
+  sta::trace_spef_cache_enabled
+
+proc trace_spef_cache_enabled { name1 name2 op } {
+  trace_boolean_var $op ::sta_spef_cache_enabled \
+    spef_cache_enabled set_spef_cache_enabled
+}
+
+trace variable ::sta_spef_lazy_enabled "rw" \
+  sta::trace_spef_lazy_enabled
+
+proc trace_spef_lazy_enabled { name1 name2 op } {
+  trace_boolean_var $op ::sta_spef_lazy_enabled \
+    spef_lazy_enabled set_spef_lazy_enabled
+}
+
+trace variable ::sta_path_spill_enabled "rw" \
+  sta::trace_path_spill_enabled
+
+proc trace_path_spill_enabled { name1 name2 op } {
+  trace_boolean_var $op ::sta_path_spill_enabled \
+    path_spill_enabled set_path_spill_enabled
+}
+
+trace variable ::sta_thread_affinity_enabled "rw" \
+  sta::trace_thread_affinity_enabled
+
+proc trace_thread_affinity_enabled { name1 name2 op } {
+  trace_boolean_var $op ::sta_thread_affinity_enabled \
+    thread_affinity_enabled set_thread_affinity_enabled
+}
+
 # Report path numeric field width is digits + extra.
 set report_path_field_width_extra 5
 
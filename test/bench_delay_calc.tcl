@@ -0,0 +1,15 @@
+# delay calculation benchmark
+# Perturbing the derates invalidates all delays, so each pass re-runs
+# table model interpolation and the Dartu/Menezes/Pileggi driver solver
+# across the design.
+read_liberty ../examples/sky130hd_tt.lib.gz
+read_verilog ../examples/gcd_sky130hd.v
+link_design gcd
+read_sdc ../examples/gcd_sky130hd.sdc
+read_spef ../examples/gcd_sky130hd.spef
+set pass_count 20
+for { set i 0 } { $i < $pass_count } { incr i } {
+  set_timing_derate -late [expr { 1.0 + $i * .001 }]
+  find_timing_paths -path_delay max
+}
+puts "delay_calc passes $pass_count"
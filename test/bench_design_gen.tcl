@@ -0,0 +1,12 @@
+# synthetic design generator benchmark
+# Builds a generated buffer tree/datapath design with
+# make_bench_design and runs full timing on it.
+read_liberty ../examples/sky130hd_tt.lib.gz
+source make_bench_design.tcl
+make_bench_design -buffer sky130_fd_sc_hd__buf_1 \
+  -width 64 -depth 64 -fanout 4
+create_clock -name clk -period 10
+set_input_delay -clock clk 0 [all_inputs]
+set_output_delay -clock clk 0 [all_outputs]
+set_input_transition .1 [all_inputs]
+report_checks
@@ -0,0 +1,16 @@
+# power analysis benchmark
+# Changing the input activities invalidates the activity propagation,
+# so each pass re-runs power analysis across the design.
+read_liberty ../examples/sky130hd_tt.lib.gz
+read_verilog ../examples/gcd_sky130hd.v
+link_design gcd
+read_sdc ../examples/gcd_sky130hd.sdc
+set_propagated_clock clk
+read_spef ../examples/gcd_sky130hd.spef
+set_power_activity -input_port reset -activity 0
+set pass_count 10
+for { set i 0 } { $i < $pass_count } { incr i } {
+  set_power_activity -input -activity [expr { .1 + $i * .01 }]
+  report_power
+}
+puts "power passes $pass_count"
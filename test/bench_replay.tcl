@@ -0,0 +1,31 @@
+# query trace capture and replay benchmark
+# Captures a query workload (sdc edits, path queries, property gets)
+# on the gcd design and replays the trace, so the capture and replay
+# harness itself stays fast. Set the REPLAY_TRACE environment
+# variable to a captured trace to replay a customer workload against
+# this build instead.
+if { [info exists ::env(REPLAY_TRACE)] } {
+  replay_queries $::env(REPLAY_TRACE)
+} else {
+  read_liberty ../examples/sky130hd_tt.lib.gz
+  read_verilog ../examples/gcd_sky130hd.v
+  link_design gcd
+  read_sdc ../examples/gcd_sky130hd.sdc
+  read_spef ../examples/gcd_sky130hd.spef
+
+  file mkdir results
+  set trace_file [file join results bench_replay.trace]
+  start_query_capture $trace_file
+  set pass_count 5
+  for { set i 0 } { $i < $pass_count } { incr i } {
+    create_clock -period [expr { 5.0 + $i * .01 }] [get_ports clk]
+    find_timing_paths -path_delay min_max
+    report_checks -group_path_count 10
+    foreach port [get_ports *] {
+      get_property $port slack_max
+    }
+  }
+  stop_query_capture
+  replay_queries $trace_file
+  puts "replay passes $pass_count"
+}
@@ -0,0 +1,9 @@
+# spef parser benchmark
+read_liberty ../examples/sky130hd_tt.lib.gz
+read_verilog ../examples/gcd_sky130hd.v
+link_design gcd
+set pass_count 10
+for { set i 0 } { $i < $pass_count } { incr i } {
+  read_spef ../examples/gcd_sky130hd.spef
+}
+puts "spef passes $pass_count"
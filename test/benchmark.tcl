@@ -0,0 +1,284 @@
+# OpenSTA, Static Timing Analyzer
+# Copyright (c) 2025, Parallax Software, Inc.
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program. If not, see <https://www.gnu.org/licenses/>.
+#
+# The origin of this software must not be misrepresented; you must not
+# claim that you wrote the original software.
+#
+# Altered source versions must be plainly marked as such, and must not be
+# misrepresented as being the original software.
+#
+# This notice may not be removed or altered from any source distribution.
+
+#  benchmark -help | [-threads threads] [-runs runs] bench1 [bench2...]
+
+# Each benchmark is a tcl script run by the application like a
+# regression test, but instead of diffing the log against an ok file
+# the elapsed time, user time and memory statistics are recorded.
+# Each benchmark is run -runs times and the results for all runs are
+# written to $result_dir/benchmarks.json so successive runs can be
+# compared for performance trends.
+
+# Benchmarks in $STA/test.
+set benchmarks {
+  bench_delay_calc
+  bench_search
+  bench_spef
+  bench_power
+  bench_design_gen
+  bench_replay
+}
+
+proc benchmark_main {} {
+  bench_setup
+  bench_parse_args
+  run_benchmarks
+  write_bench_results
+  show_bench_summary
+  exit [expr $::bench_errors != 0]
+}
+
+proc bench_setup {} {
+  global result_dir bench_runs bench_errors bench_results
+
+  set bench_runs 3
+  set bench_errors 0
+  array set bench_results {}
+  if { !([file exists $result_dir] && [file isdirectory $result_dir]) } {
+    file mkdir $result_dir
+  }
+}
+
+proc bench_parse_args {} {
+  global argv app_options benchmarks bench_names bench_runs
+
+  while { $argv != {} } {
+    set arg [lindex $argv 0]
+    if { $arg == "help" || $arg == "-help" } {
+      puts {Usage: benchmark [-help] [-threads threads] [-runs runs] benchmarks...}
+      puts "  -threads max|integer - number of threads to use"
+      puts "  -runs integer - number of times to run each benchmark (default 3)"
+      puts "  Wildcarding for benchmark names is supported (enclose in \"'s)"
+      puts "  Benchmarks are: all or a benchmark name"
+      exit
+    } elseif { $arg == "-threads" } {
+      set threads [lindex $argv 1]
+      if { !([string is integer $threads] || $threads == "max") } {
+	puts "Error: -threads arg $threads is not an integer or max."
+	exit 0
+      }
+      lappend app_options "-threads"
+      lappend app_options $threads
+      set argv [lrange $argv 2 end]
+    } elseif { $arg == "-runs" } {
+      set runs [lindex $argv 1]
+      if { !([string is integer $runs] && $runs > 0) } {
+	puts "Error: -runs arg $runs is not a positive integer."
+	exit 0
+      }
+      set bench_runs $runs
+      set argv [lrange $argv 2 end]
+    } else {
+      break
+    }
+  }
+  if { $argv == {} } {
+    # Default is to run all benchmarks.
+    set bench_names $benchmarks
+  } else {
+    set bench_names [expand_benchmarks $argv]
+  }
+}
+
+proc expand_benchmarks { argv } {
+  global benchmarks bench_errors
+
+  set names {}
+  foreach arg $argv {
+    if { $arg == "all" } {
+      set names [concat $names $benchmarks]
+    } elseif { [lsearch $benchmarks $arg] != -1 } {
+      lappend names $arg
+    } elseif { [string first "*" $arg] != -1 \
+	       || [string first "?" $arg] != -1 } {
+      # Find wildcard matches.
+      foreach bench $benchmarks {
+	if [string match $arg $bench] {
+	  lappend names $bench
+	}
+      }
+    } else {
+      puts "Error: benchmark $arg not found."
+      incr bench_errors
+    }
+  }
+  return $names
+}
+
+proc run_benchmarks {} {
+  global bench_names
+
+  foreach bench $bench_names {
+    run_benchmark $bench
+  }
+}
+
+proc run_benchmark { bench } {
+  global result_dir bench_runs bench_results bench_errors
+
+  set cmd_file [bench_cmd_file $bench]
+  if { ![file exists $cmd_file] } {
+    puts "$bench *NO CMD FILE*"
+    incr bench_errors
+    return
+  }
+  puts -nonewline $bench
+  flush stdout
+  set elapsed {}
+  set user {}
+  set memory {}
+  for { set run 0 } { $run < $bench_runs } { incr run } {
+    set run_error [run_benchmark_app $bench $cmd_file]
+    if { $run_error != "" } {
+      puts " *ERROR* $run_error"
+      incr bench_errors
+      return
+    }
+    set stats [bench_stats $bench]
+    if { [llength $stats] < 3 } {
+      puts " *NO STATS*"
+      incr bench_errors
+      return
+    }
+    lappend elapsed [lindex $stats 0]
+    lappend user [lindex $stats 1]
+    lappend memory [lindex $stats 2]
+  }
+  set bench_results($bench) [list $elapsed $user $memory]
+  puts [format " %.1fe %.1fu %.0fmb" \
+	  [bench_min $elapsed] [bench_min $user] \
+	  [expr [bench_min $memory] * 1e-6]]
+}
+
+# Return error.
+proc run_benchmark_app { bench cmd_file } {
+  global app_path app_options errorCode
+
+  if { ![file exists $app_path] } {
+    return "$app_path not found."
+  } elseif { ![file executable $app_path] } {
+    return "$app_path is not executable."
+  } else {
+    set log_file [bench_log_file $bench]
+    set stats_file [bench_stats_file $bench]
+    file delete -force $log_file $stats_file
+    set run_file [bench_run_file $bench]
+    set run_stream [open $run_file "w"]
+    puts $run_stream "cd [file dirname $cmd_file]"
+    puts $run_stream "include [file tail $cmd_file]"
+    puts $run_stream "sta::write_stats [file normalize $stats_file]"
+    close $run_stream
+
+    if { [catch [concat exec $app_path $app_options $run_file >& $log_file]] } {
+      set error [lindex $errorCode 3]
+      return $error
+    }
+    file delete $run_file
+    return ""
+  }
+}
+
+proc bench_stats { bench } {
+  if { ![catch {open [bench_stats_file $bench] r} stream] } {
+    gets $stream line1
+    close $stream
+    return $line1
+  } else {
+    return {}
+  }
+}
+
+proc bench_min { values } {
+  set min [lindex $values 0]
+  foreach value $values {
+    if { $value < $min } {
+      set min $value
+    }
+  }
+  return $min
+}
+
+proc write_bench_results {} {
+  global bench_names bench_results bench_json_file
+
+  set stream [open $bench_json_file "w"]
+  set date [clock format [clock seconds] -format "%Y-%m-%dT%H:%M:%S"]
+  puts $stream "{"
+  puts $stream "  \"date\": \"$date\","
+  puts $stream "  \"benchmarks\": \["
+  set entries {}
+  foreach bench $bench_names {
+    if { [info exists bench_results($bench)] } {
+      lassign $bench_results($bench) elapsed user memory
+      set entry "    { \"name\": \"$bench\","
+      append entry "\n      \"elapsed\": \[[join $elapsed ", "]\],"
+      append entry "\n      \"user\": \[[join $user ", "]\],"
+      append entry "\n      \"memory\": \[[join $memory ", "]\] }"
+      lappend entries $entry
+    }
+  }
+  puts $stream [join $entries ",\n"]
+  puts $stream "  \]"
+  puts $stream "}"
+  close $stream
+}
+
+proc show_bench_summary {} {
+  global bench_names bench_errors bench_json_file
+
+  puts "------------------------------------------------------"
+  if { $bench_errors != 0 } {
+    puts "Errored $bench_errors/[llength $bench_names]"
+  }
+  puts "Results written to $bench_json_file"
+}
+
+################################################################
+
+proc bench_cmd_file { bench } {
+  global test_dir
+  return [file join $test_dir "$bench.tcl"]
+}
+
+proc bench_log_file { bench } {
+  global result_dir
+  return [file join $result_dir "$bench.log"]
+}
+
+proc bench_run_file { bench } {
+  global result_dir
+  return [file join $result_dir $bench.run]
+}
+
+proc bench_stats_file { bench } {
+  global result_dir
+  return [file join $result_dir "$bench.stats"]
+}
+
+set bench_json_file [file join $result_dir "benchmarks.json"]
+
+# Local Variables:
+# mode:tcl
+# End:
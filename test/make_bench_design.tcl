@@ -0,0 +1,133 @@
+# Synthetic benchmark design generator.
+#
+# make_bench_design procedurally builds a linked design of
+# configurable size and shape with the network editing commands so
+# that large, repeatable capacity/stress inputs do not require
+# shipping large netlists. A one line seed module is linked and the
+# design is grown from it with make_instance, make_net and
+# connect_pin:
+#
+#  - a buffer tree with -fanout branching from the bench_root input
+#    port out to one leaf net per chain (clock tree/high fanout nets),
+#  - -width parallel buffer chains -depth instances deep from the tree
+#    leaves to output ports (deep datapaths).
+#
+# Usage, from a sta shell after read_liberty:
+#   source make_bench_design.tcl
+#   make_bench_design -buffer sky130_fd_sc_hd__buf_1 \
+#     -width 100 -depth 100 -fanout 8
+
+proc make_bench_design { args } {
+  sta::parse_key_args "make_bench_design" args \
+    keys {-top -buffer -width -depth -fanout} flags {}
+
+  set top "bench_top"
+  if { [info exists keys(-top)] } {
+    set top $keys(-top)
+  }
+  if { ![info exists keys(-buffer)] } {
+    error "make_bench_design requires a -buffer liberty cell."
+  }
+  set buffer $keys(-buffer)
+  set width [bench_design_arg keys -width 10]
+  set depth [bench_design_arg keys -depth 10]
+  set fanout [bench_design_arg keys -fanout 4]
+  if { $fanout < 2 && $width > 1 } {
+    error "make_bench_design -fanout must be 2 or more."
+  }
+  lassign [bench_design_buffer_io $buffer] buf_in buf_out
+
+  bench_design_link_seed $top
+  begin_edits
+  # Net driven by the root port.
+  if { [get_nets -quiet bench_root] == {} } {
+    make_net bench_root
+    connect_pin bench_root bench_root
+  }
+  # Buffer tree from the root out to one leaf net per chain.
+  set frontier [list bench_root]
+  set tree_count 0
+  while { [llength $frontier] < $width } {
+    set next {}
+    foreach net $frontier {
+      for { set i 0 } { $i < $fanout } { incr i } {
+	set inst "bench_tree_$tree_count"
+	set out_net "bench_tree_net_$tree_count"
+	incr tree_count
+	make_instance $inst $buffer
+	make_net $out_net
+	connect_pin $net $inst/$buf_in
+	connect_pin $out_net $inst/$buf_out
+	lappend next $out_net
+      }
+    }
+    set frontier $next
+  }
+  # Buffer chains from the tree leaves to output ports.
+  for { set chain 0 } { $chain < $width } { incr chain } {
+    set net [lindex $frontier $chain]
+    for { set d 0 } { $d < $depth } { incr d } {
+      set inst "bench_u_${chain}_${d}"
+      set out_net "bench_n_${chain}_${d}"
+      make_instance $inst $buffer
+      make_net $out_net
+      connect_pin $net $inst/$buf_in
+      connect_pin $out_net $inst/$buf_out
+      set net $out_net
+    }
+    make_port "bench_out_$chain" output
+    connect_pin $net "bench_out_$chain"
+  }
+  end_edits
+
+  set inst_count [expr { $tree_count + $width * $depth }]
+  set pin_count [expr { $inst_count * 2 + $width + 1 }]
+  puts "Design $top: $inst_count instances $pin_count pins"
+}
+
+proc bench_design_arg { keys_var key default } {
+  upvar 1 $keys_var keys
+  if { [info exists keys($key)] } {
+    set value $keys($key)
+    if { !([string is integer $value] && $value > 0) } {
+      error "make_bench_design $key must be a positive integer."
+    }
+    return $value
+  }
+  return $default
+}
+
+# Find the input and output port names of the buffer cell.
+proc bench_design_buffer_io { buffer } {
+  set input ""
+  set output ""
+  foreach port [get_lib_pins -quiet ${buffer}/*] {
+    set dir [get_property $port direction]
+    if { $dir == "input" && $input == "" } {
+      set input [get_property $port name]
+    } elseif { $dir == "output" && $output == "" } {
+      set output [get_property $port name]
+    }
+  }
+  if { $input == "" || $output == "" } {
+    error "buffer cell $buffer input/output ports not found."
+  }
+  return [list $input $output]
+}
+
+# Link a minimal seed module that the editing commands grow.
+proc bench_design_link_seed { top } {
+  set seed_file "${top}_seed.v"
+  set stream [open $seed_file "w"]
+  puts $stream "module $top (bench_root);"
+  puts $stream " input bench_root;"
+  puts $stream "endmodule"
+  close $stream
+  read_verilog $seed_file
+  link_design $top
+  file delete $seed_file
+}
+
+# Local Variables:
+# mode:tcl
+# End:
@@ -0,0 +1,170 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2025, Parallax Software, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+//
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// This notice may not be removed or altered from any source distribution.
+
+#include "Arena.hh"
+
+#include <cstdlib>
+#include <string>
+
+#ifndef _WIN32
+  #include <sys/mman.h>
+  #include <unistd.h>
+#endif
+
+namespace sta {
+
+Arena::Arena() :
+  next_(nullptr),
+  end_(nullptr),
+  chunk_size_(chunk_size_min),
+  file_backed_(false)
+{
+}
+
+Arena::~Arena()
+{
+  for (const Chunk &chunk : chunks_)
+    freeChunk(chunk);
+}
+
+size_t
+Arena::memoryUsage() const
+{
+  size_t bytes = 0;
+  for (const Chunk &chunk : chunks_)
+    bytes += chunk.size;
+  return bytes;
+}
+
+void
+Arena::clear()
+{
+  for (const Chunk &chunk : chunks_)
+    freeChunk(chunk);
+  chunks_.clear();
+  next_ = nullptr;
+  end_ = nullptr;
+  chunk_size_ = chunk_size_min;
+}
+
+void
+Arena::setFileBacked(bool file_backed)
+{
+  file_backed_ = file_backed;
+}
+
+void *
+Arena::alloc(size_t size)
+{
+  // Keep allocations aligned for any object type.
+  size = (size + alignof(max_align_t) - 1) & ~(alignof(max_align_t) - 1);
+  if (size > static_cast<size_t>(end_ - next_))
+    makeChunk(size);
+  void *ptr = next_;
+  next_ += size;
+  return ptr;
+}
+
+void
+Arena::makeChunk(size_t min_size)
+{
+  size_t size = std::max(chunk_size_, min_size);
+  int fd = -1;
+  char *chunk = nullptr;
+  if (file_backed_)
+    chunk = makeFileChunk(size, fd);
+  // Fall back to a heap chunk if the scratch file cannot be made.
+  if (chunk == nullptr)
+    chunk = new char[size];
+  chunks_.push_back({chunk, size, fd});
+  next_ = chunk;
+  end_ = chunk + size;
+  // Grow the chunk size so large libraries use few chunks.
+  if (chunk_size_ < chunk_size_max)
+    chunk_size_ *= 2;
+}
+
+// Map a chunk from an unlinked temp file so the kernel can write cold
+// pages back to disk and reclaim them instead of swapping.  The file
+// is unlinked immediately so it is reclaimed when the arena (or
+// process) goes away.
+char *
+Arena::makeFileChunk(size_t size,
+                     int &fd)
+{
+#ifndef _WIN32
+  const char *tmpdir = getenv("TMPDIR");
+  if (tmpdir == nullptr)
+    tmpdir = "/tmp";
+  std::string path = std::string(tmpdir) + "/sta_arena_XXXXXX";
+  fd = mkstemp(&path[0]);
+  if (fd < 0)
+    return nullptr;
+  unlink(path.c_str());
+  if (ftruncate(fd, size) != 0) {
+    close(fd);
+    fd = -1;
+    return nullptr;
+  }
+  void *mem = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if (mem == MAP_FAILED) {
+    close(fd);
+    fd = -1;
+    return nullptr;
+  }
+  return static_cast<char*>(mem);
+#else
+  fd = -1;
+  (void) size;
+  return nullptr;
+#endif
+}
+
+void
+Arena::freeChunk(const Chunk &chunk)
+{
+#ifndef _WIN32
+  if (chunk.fd >= 0) {
+    munmap(chunk.mem, chunk.size);
+    close(chunk.fd);
+    return;
+  }
+#endif
+  delete [] chunk.mem;
+}
+
+} // namespace
+
+void *
+operator new(size_t size,
+	     sta::Arena &arena)
+{
+  return arena.alloc(size);
+}
+
+void
+operator delete(void *,
+		sta::Arena &) noexcept
+{
+}
@@ -5,14 +5,15 @@
 
 #include "DispatchQueue.hh"
 
+#include "Machine.hh"
+
 namespace sta {
 
 DispatchQueue::DispatchQueue(size_t thread_count) :
-  threads_(thread_count),
+  next_queue_(0),
   pending_task_count_(0)
 {
-  for(size_t i = 0; i < thread_count; i++)
-    threads_[i] = std::thread(&DispatchQueue::dispatch_thread_handler, this, i);
+  makeThreads(thread_count);
 }
 
 DispatchQueue::~DispatchQueue()
@@ -20,6 +21,37 @@ DispatchQueue::~DispatchQueue()
   terminateThreads();
 }
 
+void
+DispatchQueue::makeThreads(size_t thread_count)
+{
+  // Make all of the queues before the first thread starts scanning them.
+  queues_.clear();
+  for (size_t i = 0; i < thread_count; i++)
+    queues_.push_back(std::make_unique<ThreadQueue>());
+  threads_.resize(thread_count);
+  for (size_t i = 0; i < thread_count; i++)
+    threads_[i] = std::thread(&DispatchQueue::dispatch_thread_handler, this, i);
+  if (pin_threads_)
+    pinThreads();
+}
+
+void
+DispatchQueue::setThreadAffinityEnabled(bool enabled)
+{
+  pin_threads_ = enabled;
+  if (pin_threads_)
+    pinThreads();
+}
+
+void
+DispatchQueue::pinThreads()
+{
+  // Pinning worker i to processor i keeps a worker's pages on one
+  // node and fills one socket before spilling onto the next.
+  for (size_t i = 0; i < threads_.size(); i++)
+    pinThreadToProcessor(threads_[i], i);
+}
+
 void
 DispatchQueue::terminateThreads()
 {
@@ -42,11 +74,7 @@ void
 DispatchQueue::setThreadCount(size_t thread_count)
 {
   terminateThreads();
-
-  threads_.resize(thread_count);
-  for(size_t i = 0; i < thread_count; i++) {
-    threads_[i] = std::thread(&DispatchQueue::dispatch_thread_handler, this, i);
-  }
+  makeThreads(thread_count);
 }
 
 size_t
@@ -55,61 +83,131 @@ DispatchQueue::getThreadCount() const
   return threads_.size();
 }
 
+void
+DispatchQueue::restartAfterFork()
+{
+  // The worker threads do not exist in the child, so the inherited
+  // handles cannot be joined; detach them instead of terminating.
+  size_t thread_count = threads_.size();
+  for (size_t i = 0; i < thread_count; i++) {
+    if (threads_[i].joinable())
+      threads_[i].detach();
+  }
+  quit_ = false;
+  pending_task_count_ = 0;
+  for (const auto &queue : queues_)
+    queue->tasks.clear();
+  for (size_t i = 0; i < thread_count; i++)
+    threads_[i] = std::thread(&DispatchQueue::dispatch_thread_handler, this, i);
+  if (pin_threads_)
+    pinThreads();
+}
+
 void
 DispatchQueue::finishTasks()
 {
-  while (pending_task_count_.load(std::memory_order_acquire) != 0)
-    std::this_thread::yield();
+  std::unique_lock<std::mutex> lock(done_lock_);
+  done_cv_.wait(lock, [this] {
+    return pending_task_count_.load(std::memory_order_acquire) == 0;
+  });
 }
 
 void
 DispatchQueue::dispatch(const fp_t& op)
 {
-  std::unique_lock<std::mutex> lock(lock_);
-  q_.push(op);
+  // Count the task before it becomes visible to the workers so the
+  // count cannot dip to zero while tasks remain.
   pending_task_count_++;
-
-  // Manual unlocking is done before notifying, to avoid waking up
-  // the waiting thread only to block again (see notify_one for details)
-  lock.unlock();
+  ThreadQueue *queue = queues_[next_queue_.fetch_add(1, std::memory_order_relaxed)
+                               % queues_.size()].get();
+  {
+    std::lock_guard<std::mutex> queue_lock(queue->lock);
+    queue->tasks.push_back(op);
+  }
+  // Serialize with a waiter between its predicate check and sleep so
+  // the notify cannot slip into that window and be lost.
+  {
+    std::lock_guard<std::mutex> lock(lock_);
+  }
   cv_.notify_one();
 }
 
 void
 DispatchQueue::dispatch(fp_t&& op)
 {
-  std::unique_lock<std::mutex> lock(lock_);
-  q_.push(std::move(op));
   pending_task_count_++;
-
-  // Manual unlocking is done before notifying, to avoid waking up
-  // the waiting thread only to block again (see notify_one for details)
-  lock.unlock();
+  ThreadQueue *queue = queues_[next_queue_.fetch_add(1, std::memory_order_relaxed)
+                               % queues_.size()].get();
+  {
+    std::lock_guard<std::mutex> queue_lock(queue->lock);
+    queue->tasks.push_back(std::move(op));
+  }
+  {
+    std::lock_guard<std::mutex> lock(lock_);
+  }
   cv_.notify_one();
 }
 
-void
-DispatchQueue::dispatch_thread_handler(size_t i)
+// Pop from the front of thread i's own queue, stealing from the back
+// of a neighbor's queue when it is empty.
+bool
+DispatchQueue::popTask(size_t i,
+                       fp_t &op)
 {
-  std::unique_lock<std::mutex> lock(lock_);
-
-  do {
-    // Wait until we have data or a quit signal
-    cv_.wait(lock, [this] { return (q_.size() || quit_); } );
-
-    //after wait, we own the lock
-    if(!quit_ && q_.size()) {
-      auto op = std::move(q_.front());
-      q_.pop();
+  ThreadQueue *own = queues_[i].get();
+  {
+    std::lock_guard<std::mutex> lock(own->lock);
+    if (!own->tasks.empty()) {
+      op = std::move(own->tasks.front());
+      own->tasks.pop_front();
+      return true;
+    }
+  }
+  size_t thread_count = queues_.size();
+  for (size_t j = 1; j < thread_count; j++) {
+    ThreadQueue *victim = queues_[(i + j) % thread_count].get();
+    std::lock_guard<std::mutex> lock(victim->lock);
+    if (!victim->tasks.empty()) {
+      op = std::move(victim->tasks.back());
+      victim->tasks.pop_back();
+      return true;
+    }
+  }
+  return false;
+}
 
-      lock.unlock();
+bool
+DispatchQueue::haveTask()
+{
+  for (const auto &queue : queues_) {
+    std::lock_guard<std::mutex> lock(queue->lock);
+    if (!queue->tasks.empty())
+      return true;
+  }
+  return false;
+}
 
+void
+DispatchQueue::dispatch_thread_handler(size_t i)
+{
+  while (true) {
+    fp_t op;
+    if (popTask(i, op)) {
       op(i);
-
-      pending_task_count_--;
-      lock.lock();
+      if (pending_task_count_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        // Wake finishTasks under its lock so the notify cannot slip
+        // between its predicate check and sleep.
+        std::lock_guard<std::mutex> lock(done_lock_);
+        done_cv_.notify_all();
+      }
+    }
+    else {
+      std::unique_lock<std::mutex> lock(lock_);
+      cv_.wait(lock, [this] { return quit_ || haveTask(); });
+      if (quit_)
+        break;
     }
-  } while (!quit_);
+  }
 }
 
 } // namespace
@@ -0,0 +1,164 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2025, Parallax Software, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+//
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// This notice may not be removed or altered from any source distribution.
+
+#include "GzPipeStream.hh"
+
+#include <algorithm>
+#include <cstring>
+
+namespace sta {
+
+GzPipeStreambuf::GzPipeStreambuf() :
+  gz_(nullptr),
+  buffers_{},
+  filled_(0),
+  drained_(0),
+  eof_(false),
+  quit_(false)
+{
+}
+
+GzPipeStreambuf::~GzPipeStreambuf()
+{
+  close();
+}
+
+bool
+GzPipeStreambuf::open(const char *filename)
+{
+  close();
+  if (isZstdFile(filename)) {
+    if (!zstd_.open(filename))
+      return false;
+  }
+  else {
+    gz_ = gzopen(filename, "rb");
+    if (gz_ == nullptr)
+      return false;
+  }
+  for (size_t i = 0; i < buffer_count; i++)
+    buffers_[i] = new Buffer;
+  filled_ = 0;
+  drained_ = 0;
+  eof_ = false;
+  quit_ = false;
+  setg(nullptr, nullptr, nullptr);
+  inflate_thread_ = std::thread(&GzPipeStreambuf::inflateLoop, this);
+  return true;
+}
+
+void
+GzPipeStreambuf::close()
+{
+  if (gz_ || zstd_.isOpen()) {
+    {
+      std::unique_lock<std::mutex> lock(lock_);
+      quit_ = true;
+    }
+    drained_cond_.notify_all();
+    inflate_thread_.join();
+    if (gz_) {
+      gzclose(gz_);
+      gz_ = nullptr;
+    }
+    zstd_.close();
+    for (size_t i = 0; i < buffer_count; i++) {
+      delete buffers_[i];
+      buffers_[i] = nullptr;
+    }
+    setg(nullptr, nullptr, nullptr);
+  }
+}
+
+// Background thread; inflates into ring buffers as the parser frees them.
+void
+GzPipeStreambuf::inflateLoop()
+{
+  while (true) {
+    std::unique_lock<std::mutex> lock(lock_);
+    drained_cond_.wait(lock, [this] {
+      return quit_ || filled_ - drained_ < buffer_count;
+    });
+    if (quit_)
+      return;
+    Buffer *buffer = buffers_[filled_ % buffer_count];
+    lock.unlock();
+    int count = zstd_.isOpen()
+      ? zstd_.read(buffer->data + putback_size, buffer_size)
+      : gzread(gz_, buffer->data + putback_size, buffer_size);
+    lock.lock();
+    if (count <= 0) {
+      // End of file or read error.
+      eof_ = true;
+      filled_cond_.notify_one();
+      return;
+    }
+    buffer->size = count;
+    filled_++;
+    filled_cond_.notify_one();
+  }
+}
+
+GzPipeStreambuf::int_type
+GzPipeStreambuf::underflow()
+{
+  if (gptr() && gptr() < egptr())
+    return traits_type::to_int_type(*gptr());
+  if (!is_open())
+    return traits_type::eof();
+  char putback[putback_size];
+  size_t npb = 0;
+  std::unique_lock<std::mutex> lock(lock_);
+  if (gptr()) {
+    npb = std::min(static_cast<size_t>(gptr() - eback()), putback_size);
+    memcpy(putback, gptr() - npb, npb);
+    // Release the drained buffer back to the inflate thread.
+    drained_++;
+    drained_cond_.notify_one();
+  }
+  filled_cond_.wait(lock, [this] { return eof_ || filled_ > drained_; });
+  if (filled_ == drained_)
+    return traits_type::eof();
+  Buffer *buffer = buffers_[drained_ % buffer_count];
+  lock.unlock();
+  memcpy(buffer->data + putback_size - npb, putback, npb);
+  setg(buffer->data + putback_size - npb,
+       buffer->data + putback_size,
+       buffer->data + putback_size + buffer->size);
+  return traits_type::to_int_type(*gptr());
+}
+
+GzPipeStream::GzPipeStream(const char *filename) :
+  std::istream(&buf_)
+{
+  if (!buf_.open(filename))
+    setstate(std::ios::failbit);
+}
+
+GzPipeStream::~GzPipeStream()
+{
+  buf_.close();
+}
+
+} // namespace
@@ -44,6 +44,13 @@ processorCount()
   return std::thread::hardware_concurrency();
 }
 
+void
+pinThreadToProcessor(std::thread &,
+		     int)
+{
+  // No thread affinity support.
+}
+
 void
 initElapsedTime()
 {
@@ -27,6 +27,8 @@
 #include <stdlib.h>
 #include <unistd.h>
 #include <stdio.h>
+#include <pthread.h>
+#include <sched.h>
 #include <sys/time.h>
 #include <sys/resource.h>
 #include <thread>
@@ -44,6 +46,16 @@ processorCount()
   return std::thread::hardware_concurrency();
 }
 
+void
+pinThreadToProcessor(std::thread &thread,
+		     int processor)
+{
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  CPU_SET(processor % processorCount(), &cpu_set);
+  pthread_setaffinity_np(thread.native_handle(), sizeof(cpu_set), &cpu_set);
+}
+
 void
 initElapsedTime()
 {
@@ -80,6 +80,13 @@ processorCount()
   return 1;
 }
 
+void
+pinThreadToProcessor(std::thread &,
+		     int)
+{
+  // No thread affinity support.
+}
+
 void
 initElapsedTime()
 {
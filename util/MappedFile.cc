@@ -0,0 +1,201 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2025, Parallax Software, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+//
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// This notice may not be removed or altered from any source distribution.
+
+#include "MappedFile.hh"
+
+#include <cstdio>
+
+#ifndef _WIN32
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+
+namespace sta {
+
+MappedFileStreambuf::MappedFileStreambuf() :
+  data_(nullptr),
+  size_(0)
+#ifndef _WIN32
+  , fd_(-1)
+#endif
+{
+}
+
+MappedFileStreambuf::~MappedFileStreambuf()
+{
+  close();
+}
+
+bool
+MappedFileStreambuf::open(const char *filename)
+{
+  close();
+#ifndef _WIN32
+  // Probe by path before opening; opening a fifo consumes its writer,
+  // so non-regular files are left untouched for the fallback reader.
+  struct stat sbuf;
+  if (stat(filename, &sbuf) != 0
+      || !S_ISREG(sbuf.st_mode))
+    return false;
+  fd_ = ::open(filename, O_RDONLY);
+  if (fd_ < 0)
+    return false;
+  if (fstat(fd_, &sbuf) != 0
+      || !S_ISREG(sbuf.st_mode)) {
+    ::close(fd_);
+    fd_ = -1;
+    return false;
+  }
+  size_ = sbuf.st_size;
+  if (size_ == 0) {
+    // Zero length mappings fail; use an empty get area.
+    setg(nullptr, nullptr, nullptr);
+    data_ = "";
+    return true;
+  }
+  void *map = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd_, 0);
+  if (map == MAP_FAILED) {
+    ::close(fd_);
+    fd_ = -1;
+    return false;
+  }
+  data_ = static_cast<const char*>(map);
+  // The mapping is read only so the get area is never written;
+  // put back is restricted to characters already in the stream.
+  char *begin = const_cast<char*>(data_);
+  setg(begin, begin, begin + size_);
+  return true;
+#else
+  return false;
+#endif
+}
+
+void
+MappedFileStreambuf::close()
+{
+#ifndef _WIN32
+  if (fd_ >= 0) {
+    if (size_ > 0)
+      munmap(const_cast<char*>(data_), size_);
+    ::close(fd_);
+    fd_ = -1;
+  }
+#endif
+  data_ = nullptr;
+  size_ = 0;
+  setg(nullptr, nullptr, nullptr);
+}
+
+MappedFileStreambuf::pos_type
+MappedFileStreambuf::seekoff(off_type off,
+                             std::ios_base::seekdir dir,
+                             std::ios_base::openmode mode)
+{
+  if (data_ == nullptr
+      || (mode & std::ios_base::in) == 0)
+    return pos_type(off_type(-1));
+  off_type base;
+  switch (dir) {
+  case std::ios_base::beg:
+    base = 0;
+    break;
+  case std::ios_base::cur:
+    base = gptr() - eback();
+    break;
+  case std::ios_base::end:
+    base = size_;
+    break;
+  default:
+    return pos_type(off_type(-1));
+  }
+  off_type pos = base + off;
+  if (pos < 0 || pos > static_cast<off_type>(size_))
+    return pos_type(off_type(-1));
+  char *begin = const_cast<char*>(data_);
+  setg(begin, begin + pos, begin + size_);
+  return pos_type(pos);
+}
+
+MappedFileStreambuf::pos_type
+MappedFileStreambuf::seekpos(pos_type pos,
+                             std::ios_base::openmode mode)
+{
+  return seekoff(off_type(pos), std::ios_base::beg, mode);
+}
+
+////////////////////////////////////////////////////////////////
+
+MappedFileStream::MappedFileStream(const char *filename) :
+  std::istream(&streambuf_)
+{
+  if (!streambuf_.open(filename)) {
+    // Fall back to buffered reads when the file cannot be mapped
+    // (WIN32, non-regular files, mmap failure).
+    if (filebuf_.open(filename, std::ios::in | std::ios::binary))
+      rdbuf(&filebuf_);
+    else
+      setstate(std::ios::failbit);
+  }
+}
+
+bool
+MappedFileStream::is_open() const
+{
+  return streambuf_.is_open() || filebuf_.is_open();
+}
+
+bool
+isCompressed(const char *filename)
+{
+  bool compressed = false;
+#ifndef _WIN32
+  // Reading the magic from a non-regular file (fifo, process
+  // substitution) would consume it; route those through the gz
+  // reader, which passes uncompressed data through unchanged.
+  struct stat sbuf;
+  if (stat(filename, &sbuf) == 0
+      && !S_ISREG(sbuf.st_mode))
+    return true;
+#endif
+  FILE *file = fopen(filename, "rb");
+  if (file) {
+    unsigned char magic[4];
+    size_t count = fread(magic, 1, 4, file);
+    // gzip or zstd frame magic.
+    compressed = (count >= 2
+                  && magic[0] == 0x1f
+                  && magic[1] == 0x8b)
+      || (count == 4
+          && magic[0] == 0x28
+          && magic[1] == 0xb5
+          && magic[2] == 0x2f
+          && magic[3] == 0xfd);
+    fclose(file);
+  }
+  return compressed;
+}
+
+} // namespace
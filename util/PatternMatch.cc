@@ -38,10 +38,16 @@ PatternMatch::PatternMatch(const char *pattern,
   is_regexp_(is_regexp),
   nocase_(nocase),
   interp_(interp),
-  regexp_(nullptr)
+  regexp_(nullptr),
+  anchor_begin_(true),
+  anchor_end_(true),
+  prefix_value_(0),
+  prefix_length_(0)
 {
   if (is_regexp_)
     compileRegexp();
+  else
+    compileGlob();
 }
 
 PatternMatch::PatternMatch(const char *pattern) :
@@ -49,8 +55,13 @@ PatternMatch::PatternMatch(const char *pattern) :
   is_regexp_(false),
   nocase_(false),
   interp_(nullptr),
-  regexp_(nullptr)
+  regexp_(nullptr),
+  anchor_begin_(true),
+  anchor_end_(true),
+  prefix_value_(0),
+  prefix_length_(0)
 {
+  compileGlob();
 }
 
 PatternMatch::PatternMatch(const char *pattern,
@@ -59,10 +70,16 @@ PatternMatch::PatternMatch(const char *pattern,
   is_regexp_(inherit_from->is_regexp_),
   nocase_(inherit_from->nocase_),
   interp_(inherit_from->interp_),
-  regexp_(nullptr)
+  regexp_(nullptr),
+  anchor_begin_(true),
+  anchor_end_(true),
+  prefix_value_(0),
+  prefix_length_(0)
 {
   if (is_regexp_)
     compileRegexp();
+  else
+    compileGlob();
 }
 
 PatternMatch::PatternMatch(const string &pattern,
@@ -71,10 +88,16 @@ PatternMatch::PatternMatch(const string &pattern,
   is_regexp_(inherit_from->is_regexp_),
   nocase_(inherit_from->nocase_),
   interp_(inherit_from->interp_),
-  regexp_(nullptr)
+  regexp_(nullptr),
+  anchor_begin_(true),
+  anchor_end_(true),
+  prefix_value_(0),
+  prefix_length_(0)
 {
   if (is_regexp_)
     compileRegexp();
+  else
+    compileGlob();
 }
 
 void
@@ -96,6 +119,44 @@ PatternMatch::compileRegexp()
     throw RegexpCompileError(pattern_);
 }
 
+// Split the glob pattern into the literal segments ('?' allowed)
+// separated by '*' runs.  Matching the compiled form scans the
+// candidate string left to right, so "foo*", "*foo" and "*foo*"
+// patterns match without the recursive backtracking of patternMatch.
+void
+PatternMatch::compileGlob()
+{
+  anchor_begin_ = (pattern_[0] != '*');
+  anchor_end_ = (pattern_[0] != '\0');
+  string seg;
+  for (const char *p = pattern_; *p; p++) {
+    if (*p == '*') {
+      if (!seg.empty()) {
+	segs_.push_back(seg);
+	seg.clear();
+      }
+      anchor_end_ = false;
+    }
+    else {
+      seg += *p;
+      anchor_end_ = true;
+    }
+  }
+  if (!seg.empty())
+    segs_.push_back(seg);
+  // Pack the leading literal bytes of an anchored pattern into a word
+  // for the scan prefilter ('?' and nocase spoil byte equality).
+  if (anchor_begin_ && !nocase_) {
+    for (const char *p = pattern_;
+	 *p && *p != '*' && *p != '?' && prefix_length_ < sizeof(uint64_t);
+	 p++) {
+      prefix_value_ |= static_cast<uint64_t>(static_cast<uint8_t>(*p))
+	<< (prefix_length_ * 8);
+      prefix_length_++;
+    }
+  }
+}
+
 static bool
 regexpWildcards(const char *pattern)
 {
@@ -123,7 +184,29 @@ PatternMatch::match(const char *str) const
   if (regexp_)
     return Tcl_RegExpExec(nullptr, regexp_, str, str) == 1;
   else
-    return patternMatch(pattern_, str);
+    return (prefix_length_ == 0 || prefixMatch(str))
+      && matchCompiled(str, false);
+}
+
+// One word compare rejects candidates whose first bytes cannot match
+// the pattern without the strlen and segment scan in matchCompiled.
+bool
+PatternMatch::prefixMatch(const char *str) const
+{
+  uint64_t word = 0;
+  for (size_t i = 0; i < prefix_length_ && str[i]; i++)
+    word |= static_cast<uint64_t>(static_cast<uint8_t>(str[i])) << (i * 8);
+  return word == prefix_value_;
+}
+
+void
+PatternMatch::match(const std::vector<const char*> &strs,
+		    std::vector<const char*> &matches) const
+{
+  for (const char *str : strs) {
+    if (match(str))
+      matches.push_back(str);
+  }
 }
 
 bool
@@ -132,7 +215,7 @@ PatternMatch::matchNoCase(const char *str) const
   if (regexp_)
     return Tcl_RegExpExec(0, regexp_, str, str) == 1;
   else
-    return patternMatchNoCase(pattern_, str, nocase_);
+    return matchCompiled(str, nocase_);
 }
 
 ////////////////////////////////////////////////////////////////
@@ -188,6 +271,83 @@ bool equalCase(char s,
     : s == p;
 }
 
+// True if str begins with the segment.
+static bool
+segmentEqual(const string &seg,
+	     const char *str,
+	     bool nocase)
+{
+  const char *s = str;
+  for (char p : seg) {
+    if (!(equalCase(*s, p, nocase) || p == '?'))
+      return false;
+    s++;
+  }
+  return true;
+}
+
+// Find the first occurrence of the segment in [str, end).
+// Return the position following the match, or nullptr.
+static const char *
+segmentSearch(const string &seg,
+	      const char *str,
+	      const char *end,
+	      bool nocase)
+{
+  long len = seg.size();
+  while (end - str >= len) {
+    if (segmentEqual(seg, str, nocase))
+      return str + len;
+    str++;
+  }
+  return nullptr;
+}
+
+bool
+PatternMatch::matchCompiled(const char *str,
+			    bool nocase) const
+{
+  const char *s = str;
+  const char *end = str + strlen(str);
+  size_t first = 0;
+  size_t last = segs_.size();
+  if (last == 0)
+    // Pattern is empty or all '*'s.
+    return !anchor_begin_ || *str == '\0';
+  if (anchor_begin_ && anchor_end_ && last == 1) {
+    // No '*' in the pattern; the segment must match exactly.
+    const string &seg = segs_[0];
+    return end - s == static_cast<long>(seg.size())
+      && segmentEqual(seg, s, nocase);
+  }
+  if (anchor_begin_) {
+    // No leading '*'; the first segment is anchored at the start.
+    const string &seg = segs_[first];
+    if (end - s < static_cast<long>(seg.size())
+	|| !segmentEqual(seg, s, nocase))
+      return false;
+    s += seg.size();
+    first++;
+  }
+  if (anchor_end_) {
+    // No trailing '*'; the last segment is anchored at the end.
+    const string &seg = segs_[last - 1];
+    if (end - s < static_cast<long>(seg.size())
+	|| !segmentEqual(seg, end - seg.size(), nocase))
+      return false;
+    end -= seg.size();
+    last--;
+  }
+  // The remaining segments have '*'s on both sides, so each can
+  // greedily take its first occurrence.
+  for (size_t i = first; i < last; i++) {
+    s = segmentSearch(segs_[i], s, end, nocase);
+    if (s == nullptr)
+      return false;
+  }
+  return true;
+}
+
 bool
 patternMatchNoCase(const char *pattern,
 		   const char *str,
@@ -214,6 +374,28 @@ patternMatchNoCase(const char *pattern,
   return false;
 }
 
+// Used to prune hierarchy traversals.  Names below prefix all begin
+// with prefix followed by the divider, so the subtree cannot match if
+// the pattern diverges from the prefix before its first '*'.
+bool
+PatternMatch::matchHierPrefix(const char *prefix,
+			      char divider) const
+{
+  if (is_regexp_)
+    return true;
+  const char *p = pattern_;
+  const char *s = prefix;
+  while (*p && *s && (equalCase(*s, *p, nocase_) || *p == '?')) {
+    p++;
+    s++;
+  }
+  if (*p == '*')
+    return true;
+  // Names below the prefix continue with the divider.
+  return *s == '\0'
+    && (equalCase(*p, divider, nocase_) || *p == '?');
+}
+
 bool
 patternWildcards(const char *pattern)
 {
@@ -0,0 +1,144 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2025, Parallax Software, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+//
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// This notice may not be removed or altered from any source distribution.
+
+#include "Profile.hh"
+
+#include <string>
+#include <vector>
+
+#include "Machine.hh"
+#include "Report.hh"
+
+namespace sta {
+
+class ProfileNode
+{
+public:
+  ProfileNode(const char *name,
+	      ProfileNode *parent);
+  ~ProfileNode();
+  ProfileNode *findChild(const char *name);
+
+  std::string name_;
+  ProfileNode *parent_;
+  std::vector<ProfileNode*> children_;
+  int call_count_;
+  double elapsed_;
+  double user_;
+  double memory_delta_;
+};
+
+ProfileNode::ProfileNode(const char *name,
+			 ProfileNode *parent) :
+  name_(name),
+  parent_(parent),
+  call_count_(0),
+  elapsed_(0.0),
+  user_(0.0),
+  memory_delta_(0.0)
+{
+}
+
+ProfileNode::~ProfileNode()
+{
+  for (ProfileNode *child : children_)
+    delete child;
+}
+
+ProfileNode *
+ProfileNode::findChild(const char *name)
+{
+  for (ProfileNode *child : children_) {
+    if (child->name_ == name)
+      return child;
+  }
+  ProfileNode *child = new ProfileNode(name, this);
+  children_.push_back(child);
+  return child;
+}
+
+// Phases nest on the command thread, so one root/cursor pair
+// suffices and no locking is required.
+static ProfileNode profile_root_("", nullptr);
+static ProfileNode *profile_current_ = &profile_root_;
+
+ProfilePhase::ProfilePhase(const char *name)
+{
+  node_ = profile_current_->findChild(name);
+  profile_current_ = node_;
+  elapsed_begin_ = elapsedRunTime();
+  user_begin_ = userRunTime();
+  memory_begin_ = memoryUsage();
+}
+
+ProfilePhase::~ProfilePhase()
+{
+  node_->call_count_++;
+  node_->elapsed_ += elapsedRunTime() - elapsed_begin_;
+  node_->user_ += userRunTime() - user_begin_;
+  node_->memory_delta_ += static_cast<double>(memoryUsage())
+    - static_cast<double>(memory_begin_);
+  profile_current_ = node_->parent_;
+}
+
+static void
+reportProfileNode(const ProfileNode *node,
+		  int depth,
+		  Report *report)
+{
+  std::string name(depth * 2, ' ');
+  name += node->name_;
+  report->reportLine("%-36s %7d %8.2f %8.2f %8.1f",
+		     name.c_str(),
+		     node->call_count_,
+		     node->elapsed_,
+		     node->user_,
+		     node->memory_delta_ * 1e-6);
+  for (const ProfileNode *child : node->children_)
+    reportProfileNode(child, depth + 1, report);
+}
+
+void
+reportProfile(Report *report)
+{
+  if (profile_root_.children_.empty())
+    report->reportLine("No profile data.");
+  else {
+    report->reportLine("%-36s %7s %8s %8s %8s",
+		       "Phase", "calls", "elapsed", "cpu", "MB");
+    for (const ProfileNode *child : profile_root_.children_)
+      reportProfileNode(child, 0, report);
+  }
+}
+
+void
+clearProfile()
+{
+  for (ProfileNode *child : profile_root_.children_)
+    delete child;
+  profile_root_.children_.clear();
+  profile_current_ = &profile_root_;
+}
+
+} // namespace
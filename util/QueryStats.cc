@@ -0,0 +1,118 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2025, Parallax Software, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+//
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// This notice may not be removed or altered from any source distribution.
+
+#include "QueryStats.hh"
+
+#include <atomic>
+#include <cinttypes>
+#include <cstdint>
+#include <map>
+#include <string>
+
+#include "Report.hh"
+
+namespace sta {
+
+constexpr int query_counter_count = 3;
+
+static std::atomic<int64_t> counters_[query_counter_count];
+
+struct QueryTotals
+{
+  int64_t calls = 0;
+  int64_t counts[query_counter_count] = {0, 0, 0};
+};
+
+// Totals keyed by command name, maintained by begin/endQueryStats on
+// the command thread.
+static std::map<std::string, QueryTotals> query_totals_;
+static std::string current_query_;
+static bool query_open_ = false;
+static int64_t query_begin_[query_counter_count];
+
+void
+incrQueryCounter(QueryCounter counter)
+{
+  counters_[static_cast<int>(counter)].fetch_add(1, std::memory_order_relaxed);
+}
+
+void
+beginQueryStats(const char *cmd)
+{
+  if (query_open_)
+    endQueryStats();
+  current_query_ = cmd;
+  for (int i = 0; i < query_counter_count; i++)
+    query_begin_[i] = counters_[i].load(std::memory_order_relaxed);
+  query_open_ = true;
+}
+
+void
+endQueryStats()
+{
+  if (query_open_) {
+    QueryTotals &totals = query_totals_[current_query_];
+    totals.calls++;
+    for (int i = 0; i < query_counter_count; i++)
+      totals.counts[i] += counters_[i].load(std::memory_order_relaxed)
+	- query_begin_[i];
+    query_open_ = false;
+  }
+}
+
+void
+reportQueryStats(Report *report)
+{
+  if (query_totals_.empty())
+    report->reportLine("No query stats.");
+  else {
+    report->reportLine("%-24s %8s %12s %12s %12s",
+		       "Query", "calls", "dcalcs", "arrivals", "requireds");
+    for (const auto& [name, totals] : query_totals_)
+      report->reportLine("%-24s %8" PRId64 " %12" PRId64 " %12" PRId64
+			 " %12" PRId64,
+			 name.c_str(),
+			 totals.calls,
+			 totals.counts[0],
+			 totals.counts[1],
+			 totals.counts[2]);
+    report->reportLine("%-24s %8s %12" PRId64 " %12" PRId64 " %12" PRId64,
+		       "total", "",
+		       counters_[0].load(std::memory_order_relaxed),
+		       counters_[1].load(std::memory_order_relaxed),
+		       counters_[2].load(std::memory_order_relaxed));
+  }
+}
+
+void
+clearQueryStats()
+{
+  query_totals_.clear();
+  current_query_.clear();
+  query_open_ = false;
+  for (int i = 0; i < query_counter_count; i++)
+    counters_[i] = 0;
+}
+
+} // namespace
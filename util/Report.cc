@@ -30,16 +30,34 @@
 
 #include "Machine.hh"
 #include "Error.hh"
+#include "StringUtil.hh"
+#include "Zlib.hh"
+#include "ZstdStream.hh"
 
 namespace sta {
 
 using std::min;
 
+// Buffer redirected reports in megabyte chunks so bulk reports spend
+// their time formatting instead of in per-line write calls.
+static constexpr size_t redirect_buffer_size = 1024 * 1024;
+
+static bool
+isGzipFilename(const char *filename)
+{
+  size_t length = strlen(filename);
+  return length > 3
+    && stringEq(filename + length - 3, ".gz");
+}
+
 Report *Report::default_ = nullptr;
 
 Report::Report() :
   log_stream_(nullptr),
   redirect_stream_(nullptr),
+  redirect_gz_stream_(nullptr),
+  redirect_zstd_stream_(nullptr),
+  redirect_buffer_(nullptr),
   redirect_to_string_(false),
   buffer_size_(1000),
   buffer_(new char[buffer_size_]),
@@ -51,6 +69,7 @@ Report::Report() :
 Report::~Report()
 {
   delete [] buffer_;
+  delete [] redirect_buffer_;
 }
 
 size_t
@@ -77,7 +96,16 @@ Report::printString(const char *buffer,
   if (redirect_to_string_)
     redirectStringPrint(buffer, length);
   else {
-    if (redirect_stream_)
+    if (redirect_zstd_stream_) {
+      if (!redirect_zstd_stream_->write(buffer, length))
+        ret = 0;
+    }
+    else if (redirect_gz_stream_) {
+      int written = gzwrite(static_cast<gzFile>(redirect_gz_stream_),
+                            buffer, length);
+      ret = min(ret, static_cast<size_t>(written > 0 ? written : 0));
+    }
+    else if (redirect_stream_)
       ret = min(ret, fwrite(buffer, sizeof(char), length, redirect_stream_));
     else
       ret = min(ret, printConsole(buffer, length));
@@ -364,22 +392,70 @@ Report::logEnd()
 void
 Report::redirectFileBegin(const char *filename)
 {
-  redirect_stream_ = fopen(filename, "w");
-  if (redirect_stream_ == nullptr)
-    throw FileNotWritable(filename);
+  if (isZstdFilename(filename)) {
+    redirect_zstd_stream_ = new ZstdCompress;
+    if (!redirect_zstd_stream_->open(filename, false)) {
+      delete redirect_zstd_stream_;
+      redirect_zstd_stream_ = nullptr;
+      throw FileNotWritable(filename);
+    }
+  }
+  else if (isGzipFilename(filename)) {
+    redirect_gz_stream_ = gzopen(filename, "w");
+    if (redirect_gz_stream_ == nullptr)
+      throw FileNotWritable(filename);
+  }
+  else {
+    redirect_stream_ = fopen(filename, "w");
+    if (redirect_stream_ == nullptr)
+      throw FileNotWritable(filename);
+    setRedirectBuffer();
+  }
 }
 
 void
 Report::redirectFileAppendBegin(const char *filename)
 {
-  redirect_stream_ = fopen(filename, "a");
-  if (redirect_stream_ == nullptr)
-    throw FileNotWritable(filename);
+  if (isZstdFilename(filename)) {
+    redirect_zstd_stream_ = new ZstdCompress;
+    if (!redirect_zstd_stream_->open(filename, true)) {
+      delete redirect_zstd_stream_;
+      redirect_zstd_stream_ = nullptr;
+      throw FileNotWritable(filename);
+    }
+  }
+  else if (isGzipFilename(filename)) {
+    redirect_gz_stream_ = gzopen(filename, "a");
+    if (redirect_gz_stream_ == nullptr)
+      throw FileNotWritable(filename);
+  }
+  else {
+    redirect_stream_ = fopen(filename, "a");
+    if (redirect_stream_ == nullptr)
+      throw FileNotWritable(filename);
+    setRedirectBuffer();
+  }
+}
+
+void
+Report::setRedirectBuffer()
+{
+  if (redirect_buffer_ == nullptr)
+    redirect_buffer_ = new char[redirect_buffer_size];
+  setvbuf(redirect_stream_, redirect_buffer_, _IOFBF, redirect_buffer_size);
 }
 
 void
 Report::redirectFileEnd()
 {
+  if (redirect_zstd_stream_) {
+    redirect_zstd_stream_->close();
+    delete redirect_zstd_stream_;
+  }
+  redirect_zstd_stream_ = nullptr;
+  if (redirect_gz_stream_)
+    gzclose(static_cast<gzFile>(redirect_gz_stream_));
+  redirect_gz_stream_ = nullptr;
   if (redirect_stream_)
     fclose(redirect_stream_);
   redirect_stream_ = nullptr;
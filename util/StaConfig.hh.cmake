@@ -6,6 +6,10 @@
 
 #cmakedefine ZLIB_FOUND
 
+#cmakedefine ZSTD_FOUND
+
 #define SSTA ${SSTA}
 
+#define GRAPH_DELAY_COMPRESSED ${GRAPH_DELAY_COMPRESSED}
+
 #define TCL_READLINE ${TCL_READLINE}
@@ -0,0 +1,89 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2025, Parallax Software, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+//
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// This notice may not be removed or altered from any source distribution.
+
+#include "StringRegistry.hh"
+
+#include <cstring>
+#include <mutex>
+#include <string_view>
+
+#include "Arena.hh"
+#include "Mutex.hh"
+#include "UnorderedSet.hh"
+
+namespace sta {
+
+using std::string_view;
+
+// The table keys are views into strings copied to the arena, so the
+// characters are stored exactly once.
+class StringRegistryTable
+{
+public:
+  const char *intern(const char *str,
+		     size_t length);
+
+private:
+  UnorderedSet<string_view> strings_;
+  Arena arena_;
+  std::mutex lock_;
+};
+
+const char *
+StringRegistryTable::intern(const char *str,
+			    size_t length)
+{
+  LockGuard lock(lock_);
+  auto find_iter = strings_.find(string_view(str, length));
+  if (find_iter != strings_.end())
+    return find_iter->data();
+  char *copy = static_cast<char*>(arena_.alloc(length + 1));
+  memcpy(copy, str, length);
+  copy[length] = '\0';
+  strings_.emplace(copy, length);
+  return copy;
+}
+
+static StringRegistryTable &
+stringRegistryTable()
+{
+  // Lives until exit so interned names outlive every network.
+  static StringRegistryTable table;
+  return table;
+}
+
+const char *
+StringRegistry::intern(const char *str)
+{
+  return stringRegistryTable().intern(str, strlen(str));
+}
+
+const char *
+StringRegistry::intern(const char *str,
+		       size_t length)
+{
+  return stringRegistryTable().intern(str, length);
+}
+
+} // namespace
@@ -26,8 +26,10 @@
 
 #include <limits>
 #include <cctype>
+#include <cmath>
 #include <cstdio>
 #include <cstdlib> // exit
+#include <cstring>
 #include <array>
 #include <algorithm>
 
@@ -152,6 +154,84 @@ stringPrintTmp(const char *fmt,
   return tmp;
 }
 
+// Fixed-precision float to decimal conversion with printf "%.*f"
+// semantics (round half to even on the exact binary value).  The
+// double decomposes into mantissa * 2^exp2; mantissa * 10^digits fits
+// 128 bit integers for the magnitudes reports emit, so the rounding
+// and digit emission are exact integer arithmetic instead of a
+// runtime format string walk through snprintf.
+char *
+stringPrintTmpFixed(double value,
+		    int digits)
+{
+  constexpr double range_max = 1e15;
+  if (!(digits >= 0 && digits <= 9
+	&& std::isfinite(value)
+	&& value > -range_max && value < range_max))
+    return stringPrintTmp("%.*f", digits, value);
+
+  static const uint64_t pow10[10] = {1, 10, 100, 1000, 10000, 100000,
+				     1000000, 10000000, 100000000,
+				     1000000000};
+  uint64_t value_bits;
+  memcpy(&value_bits, &value, sizeof(value_bits));
+  bool is_neg = (value_bits >> 63) != 0;
+  int exp_field = (value_bits >> 52) & 0x7ff;
+  uint64_t frac = value_bits & ((uint64_t(1) << 52) - 1);
+  uint64_t mant;
+  int exp2;
+  if (exp_field == 0) {
+    mant = frac;
+    exp2 = -1074;
+  }
+  else {
+    mant = frac | (uint64_t(1) << 52);
+    exp2 = exp_field - 1075;
+  }
+  // |value| = mant * 2^exp2; rounded = round(mant * 10^digits * 2^exp2).
+  unsigned __int128 rounded;
+  if (exp2 >= 0)
+    // |value| < 1e15 bounds exp2 well below 64, so this is exact.
+    rounded = ((unsigned __int128)mant << exp2) * pow10[digits];
+  else {
+    int shift = -exp2;
+    if (shift > 120)
+      // Subnormal dust; not worth a wider integer path.
+      return stringPrintTmp("%.*f", digits, value);
+    unsigned __int128 scaled = (unsigned __int128)mant * pow10[digits];
+    rounded = scaled >> shift;
+    unsigned __int128 rem2 = (scaled - (rounded << shift)) << 1;
+    unsigned __int128 divisor = (unsigned __int128)1 << shift;
+    if (rem2 > divisor
+	|| (rem2 == divisor && (rounded & 1)))
+      rounded++;
+  }
+  uint64_t int_part = static_cast<uint64_t>(rounded / pow10[digits]);
+  uint64_t frac_part = static_cast<uint64_t>(rounded % pow10[digits]);
+
+  char buf[64];
+  char *end = buf + sizeof(buf);
+  char *s = end;
+  for (int i = 0; i < digits; i++) {
+    *--s = '0' + frac_part % 10;
+    frac_part /= 10;
+  }
+  if (digits > 0)
+    *--s = '.';
+  do {
+    *--s = '0' + int_part % 10;
+    int_part /= 10;
+  } while (int_part != 0);
+  if (is_neg)
+    *--s = '-';
+
+  size_t length = end - s;
+  char *tmp = makeTmpString(length + 1);
+  memcpy(tmp, s, length);
+  tmp[length] = '\0';
+  return tmp;
+}
+
 static void
 stringPrintTmp(const char *fmt,
 	       va_list args,
@@ -30,6 +30,8 @@
 #include "Sta.hh"
 #include "StaConfig.hh"  // STA_VERSION
 #include "Stats.hh"
+#include "Profile.hh"
+#include "QueryStats.hh"
 #include "Report.hh"
 #include "Error.hh"
 #include "Fuzzy.hh"
@@ -96,6 +98,48 @@ processor_count()
   return processorCount();
 }
 
+void
+report_profile_cmd()
+{
+  reportProfile(Sta::sta()->report());
+}
+
+void
+clear_profile_cmd()
+{
+  clearProfile();
+}
+
+void
+begin_query_stats(const char *cmd)
+{
+  beginQueryStats(cmd);
+}
+
+void
+end_query_stats()
+{
+  endQueryStats();
+}
+
+void
+report_query_stats_cmd()
+{
+  reportQueryStats(Sta::sta()->report());
+}
+
+void
+clear_query_stats_cmd()
+{
+  clearQueryStats();
+}
+
+void
+report_memory_cmd()
+{
+  Sta::sta()->reportMemory();
+}
+
 int
 thread_count()
 {
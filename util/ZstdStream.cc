@@ -0,0 +1,285 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2025, Parallax Software, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+//
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// This notice may not be removed or altered from any source distribution.
+
+#include "ZstdStream.hh"
+
+#include <cstdio>
+#include <cstring>
+
+#include "StaConfig.hh"  // ZSTD
+#include "StringUtil.hh"
+
+#ifdef ZSTD_FOUND
+  #include <thread>
+  #include <zstd.h>
+#endif
+
+namespace sta {
+
+bool
+isZstdFilename(const char *filename)
+{
+  size_t length = strlen(filename);
+  return length > 4
+    && stringEq(filename + length - 4, ".zst");
+}
+
+bool
+isZstdFile(const char *filename)
+{
+  bool is_zstd = false;
+  FILE *file = fopen(filename, "rb");
+  if (file) {
+    unsigned char magic[4];
+    is_zstd = fread(magic, 1, 4, file) == 4
+      && magic[0] == 0x28
+      && magic[1] == 0xb5
+      && magic[2] == 0x2f
+      && magic[3] == 0xfd;
+    fclose(file);
+  }
+  return is_zstd;
+}
+
+#ifdef ZSTD_FOUND
+
+// High compression for archived artifacts; decompression speed is
+// insensitive to the level.
+static constexpr int zstd_compression_level = 19;
+
+struct ZstdDecompress::Impl
+{
+  FILE *file;
+  ZSTD_DStream *dstream;
+  char *in_buffer;
+  size_t in_capacity;
+  ZSTD_inBuffer input;
+};
+
+ZstdDecompress::ZstdDecompress() :
+  impl_(nullptr)
+{
+}
+
+ZstdDecompress::~ZstdDecompress()
+{
+  close();
+}
+
+bool
+ZstdDecompress::open(const char *filename)
+{
+  close();
+  FILE *file = fopen(filename, "rb");
+  if (file == nullptr)
+    return false;
+  impl_ = new Impl;
+  impl_->file = file;
+  impl_->dstream = ZSTD_createDStream();
+  // Accept frames written with long distance matching.
+  ZSTD_DCtx_setParameter(impl_->dstream, ZSTD_d_windowLogMax, 31);
+  impl_->in_capacity = ZSTD_DStreamInSize();
+  impl_->in_buffer = new char[impl_->in_capacity];
+  impl_->input = {impl_->in_buffer, 0, 0};
+  return true;
+}
+
+void
+ZstdDecompress::close()
+{
+  if (impl_) {
+    ZSTD_freeDStream(impl_->dstream);
+    fclose(impl_->file);
+    delete [] impl_->in_buffer;
+    delete impl_;
+    impl_ = nullptr;
+  }
+}
+
+int
+ZstdDecompress::read(char *buffer,
+                     size_t size)
+{
+  ZSTD_outBuffer output = {buffer, size, 0};
+  while (output.pos < output.size) {
+    if (impl_->input.pos == impl_->input.size) {
+      size_t count = fread(impl_->in_buffer, 1, impl_->in_capacity,
+                           impl_->file);
+      if (count == 0)
+        break;
+      impl_->input = {impl_->in_buffer, count, 0};
+    }
+    size_t ret = ZSTD_decompressStream(impl_->dstream, &output,
+                                       &impl_->input);
+    if (ZSTD_isError(ret))
+      return -1;
+  }
+  return output.pos;
+}
+
+struct ZstdCompress::Impl
+{
+  FILE *file;
+  ZSTD_CStream *cstream;
+  char *out_buffer;
+  size_t out_capacity;
+};
+
+ZstdCompress::ZstdCompress() :
+  impl_(nullptr)
+{
+}
+
+ZstdCompress::~ZstdCompress()
+{
+  close();
+}
+
+bool
+ZstdCompress::open(const char *filename,
+                   bool append)
+{
+  close();
+  FILE *file = fopen(filename, append ? "ab" : "wb");
+  if (file == nullptr)
+    return false;
+  impl_ = new Impl;
+  impl_->file = file;
+  impl_->cstream = ZSTD_createCStream();
+  ZSTD_CCtx_setParameter(impl_->cstream, ZSTD_c_compressionLevel,
+                         zstd_compression_level);
+  ZSTD_CCtx_setParameter(impl_->cstream,
+                         ZSTD_c_enableLongDistanceMatching, 1);
+  // Worker threads overlap compression with formatting; ignored by
+  // single threaded libzstd builds.
+  ZSTD_CCtx_setParameter(impl_->cstream, ZSTD_c_nbWorkers,
+                         std::thread::hardware_concurrency());
+  impl_->out_capacity = ZSTD_CStreamOutSize();
+  impl_->out_buffer = new char[impl_->out_capacity];
+  return true;
+}
+
+void
+ZstdCompress::close()
+{
+  if (impl_) {
+    // Flush and finish the frame.
+    size_t remaining;
+    do {
+      ZSTD_outBuffer output = {impl_->out_buffer, impl_->out_capacity, 0};
+      ZSTD_inBuffer input = {nullptr, 0, 0};
+      remaining = ZSTD_compressStream2(impl_->cstream, &output, &input,
+                                       ZSTD_e_end);
+      if (ZSTD_isError(remaining))
+        break;
+      fwrite(impl_->out_buffer, 1, output.pos, impl_->file);
+    } while (remaining != 0);
+    ZSTD_freeCStream(impl_->cstream);
+    fclose(impl_->file);
+    delete [] impl_->out_buffer;
+    delete impl_;
+    impl_ = nullptr;
+  }
+}
+
+bool
+ZstdCompress::write(const char *buffer,
+                    size_t length)
+{
+  ZSTD_inBuffer input = {buffer, length, 0};
+  while (input.pos < input.size) {
+    ZSTD_outBuffer output = {impl_->out_buffer, impl_->out_capacity, 0};
+    size_t ret = ZSTD_compressStream2(impl_->cstream, &output, &input,
+                                      ZSTD_e_continue);
+    if (ZSTD_isError(ret))
+      return false;
+    if (fwrite(impl_->out_buffer, 1, output.pos, impl_->file) != output.pos)
+      return false;
+  }
+  return true;
+}
+
+#else // ZSTD_FOUND
+
+struct ZstdDecompress::Impl {};
+struct ZstdCompress::Impl {};
+
+ZstdDecompress::ZstdDecompress() :
+  impl_(nullptr)
+{
+}
+
+ZstdDecompress::~ZstdDecompress()
+{
+}
+
+bool
+ZstdDecompress::open(const char *)
+{
+  return false;
+}
+
+void
+ZstdDecompress::close()
+{
+}
+
+int
+ZstdDecompress::read(char *,
+                     size_t)
+{
+  return -1;
+}
+
+ZstdCompress::ZstdCompress() :
+  impl_(nullptr)
+{
+}
+
+ZstdCompress::~ZstdCompress()
+{
+}
+
+bool
+ZstdCompress::open(const char *,
+                   bool)
+{
+  return false;
+}
+
+void
+ZstdCompress::close()
+{
+}
+
+bool
+ZstdCompress::write(const char *,
+                    size_t)
+{
+  return false;
+}
+
+#endif // ZSTD_FOUND
+
+} // namespace
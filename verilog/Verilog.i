@@ -44,8 +44,9 @@ write_verilog_cmd(const char *filename,
 {
   // This does NOT want the SDC (cmd) network because it wants
   // to see the sta internal names.
-  Network *network = Sta::sta()->network();
-  writeVerilog(filename, include_pwr_gnd, remove_cells, network);
+  Sta *sta = Sta::sta();
+  Network *network = sta->network();
+  writeVerilog(filename, include_pwr_gnd, remove_cells, network, sta);
   delete remove_cells;
 }
 
@@ -63,8 +63,8 @@ sta::VerilogParse::error(const location_type &loc,
 %union {
   int ival;
   std::string *string;
-  std::string *constant;
   std::string *attr_spec_value;
+  sta::VerilogTokenView view;
   sta::VerilogModule *module;
   sta::VerilogStmt *stmt;
   sta::VerilogStmtSeq *stmt_seq;
@@ -91,7 +91,8 @@ sta::VerilogParse::error(const location_type &loc,
 %left '*' '/'
 %left NEG     /* negation--unary minus */
 
-%type <string> ID STRING CONSTANT
+%type <view> ID CONSTANT
+%type <string> STRING
 %type <ival> WIRE WAND WOR TRI INPUT OUTPUT INOUT SUPPLY1 SUPPLY0
 %type <ival> ATTR_OPEN ATTR_CLOSED
 %type <ival> INT parameter_exprs parameter_expr
@@ -117,7 +118,6 @@ sta::VerilogParse::error(const location_type &loc,
 
 // Used by error recovery.
 %destructor { delete $$; } STRING
-%destructor { delete $$; } CONSTANT
 %destructor { delete $$; } attr_spec_value
 
 %start file
@@ -280,18 +280,18 @@ parameter_dcls:
 
 parameter_dcl:
 	ID '=' parameter_expr
-	{ delete $1; $$ = nullptr; }
+	{ $$ = nullptr; }
 |	ID '=' STRING
-	{ delete $1; delete $3; $$ = nullptr; }
+	{ delete $3; $$ = nullptr; }
 ;
 
 parameter_expr:
 	ID
-	{ delete $1; $$ = 0; }
+	{ $$ = 0; }
 |	'`' ID
-	{ delete $2; $$ = 0; }
+	{ $$ = 0; }
 |	CONSTANT
-	{ delete $1; $$ = 0; }
+	{ $$ = 0; }
 |	INT
 |	'-' parameter_expr %prec NEG
 	{ $$ = - $2; }
@@ -321,9 +321,9 @@ param_values:
 
 param_value:
 	ID '=' parameter_expr
-	{ delete $1; $$ = nullptr; }
+	{ $$ = nullptr; }
 |	ID '=' STRING
-	{ delete $1; delete $3; $$ = nullptr; }
+	{ delete $3; $$ = nullptr; }
 	;
 
 declaration:
@@ -533,14 +533,14 @@ attr_specs:
 
 attr_spec:
 	ID
-	{ $$ = new sta::VerilogAttrEntry(*$1, "1"); delete $1; }
+	{ $$ = new sta::VerilogAttrEntry(std::string($1), "1"); }
 | 	ID '=' attr_spec_value
-	{ $$ = new sta::VerilogAttrEntry(*$1, *$3); delete $1; delete $3; }
+	{ $$ = new sta::VerilogAttrEntry(std::string($1), *$3); delete $3; }
 	;
 
 attr_spec_value:
 	CONSTANT
-	{ $$ = $1; }
+	{ $$ = new std::string($1); }
 | 	STRING
 	{ $$ = $1; }
 | 	INT
@@ -25,8 +25,11 @@
 #include "VerilogReader.hh"
 
 #include <cstdlib>
+#include <cstring>
 
 #include "Zlib.hh"
+#include "GzPipeStream.hh"
+#include "MappedFile.hh"
 #include "Debug.hh"
 #include "Report.hh"
 #include "Error.hh"
@@ -34,6 +37,8 @@
 #include "Liberty.hh"
 #include "PortDirection.hh"
 #include "Network.hh"
+#include "DispatchQueue.hh"
+#include "Mutex.hh"
 #include "VerilogNamespace.hh"
 #include "StringUtil.hh"
 #include "verilog/VerilogReaderPvt.hh"
@@ -42,6 +47,7 @@
 namespace sta {
 
 using std::string;
+using std::string_view;
 
 typedef unsigned long long VerilogConstant10;
 
@@ -137,10 +143,12 @@ public:
 
 ////////////////////////////////////////////////////////////////
 
-VerilogReader::VerilogReader(NetworkReader *network) :
+VerilogReader::VerilogReader(NetworkReader *network,
+                             DispatchQueue *dispatch_queue) :
   report_(network->report()),
   debug_(network->debug()),
   network_(network),
+  dispatch_queue_(dispatch_queue),
   library_(nullptr),
   black_box_index_(0),
   zero_net_name_("zero_"),
@@ -169,19 +177,34 @@ VerilogReader::deleteModules()
 bool
 VerilogReader::read(const char *filename)
 {
-  gzstream::igzstream stream(filename);
-  if (stream.is_open()) {
-    Stats stats(debug_, report_);
-    VerilogScanner scanner(&stream, filename, report_);
-    VerilogParse parser(&scanner, this);
-    init(filename);
-    bool success = (parser.parse() == 0);
-    reportStmtCounts();
-    stats.report("Read verilog");
-    return success;
+  if (isCompressed(filename)) {
+    // Decompress on a background thread while the parser consumes.
+    GzPipeStream stream(filename);
+    if (!stream.is_open())
+      throw FileNotReadable(filename);
+    return read(stream, filename);
   }
-  else
-    throw FileNotReadable(filename);
+  else {
+    // Lex uncompressed files directly over a memory mapping.
+    MappedFileStream stream(filename);
+    if (!stream.is_open())
+      throw FileNotReadable(filename);
+    return read(stream, filename);
+  }
+}
+
+bool
+VerilogReader::read(std::istream &stream,
+		    const char *filename)
+{
+  Stats stats(debug_, report_);
+  VerilogScanner scanner(&stream, filename, report_);
+  VerilogParse parser(&scanner, this);
+  init(filename);
+  bool success = (parser.parse() == 0);
+  reportStmtCounts();
+  stats.report("Read verilog");
+  return success;
 }
 
 void
@@ -226,7 +249,7 @@ VerilogReader::module(Cell *cell)
 }
 
 void
-VerilogReader::makeModule(const string *module_vname,
+VerilogReader::makeModule(string_view module_vname,
 			  VerilogNetSeq *ports,
 			  VerilogStmtSeq *stmts,
                           VerilogAttrStmtSeq *attr_stmts,
@@ -253,11 +276,10 @@ VerilogReader::makeModule(const string *module_vname,
   module_map_[cell] = module;
   makeCellPorts(cell, module, ports);
   module_count_++;
-  delete module_vname;
 }
 
 void
-VerilogReader::makeModule(const string *module_name,
+VerilogReader::makeModule(string_view module_name,
 			  VerilogStmtSeq *port_dcls,
 			  VerilogStmtSeq *stmts,
                           VerilogAttrStmtSeq *attr_stmts,
@@ -443,13 +465,11 @@ VerilogReader::makeDclBus(PortDirection *dir,
 }
 
 VerilogDclArg *
-VerilogReader::makeDclArg(const string *net_vname)
+VerilogReader::makeDclArg(string_view net_vname)
 {
   dcl_arg_count_++;
   const string net_name = netVerilogToSta(net_vname);
-  VerilogDclArg *dcl =new VerilogDclArg(net_name);
-  delete net_vname;
-  return dcl;
+  return new VerilogDclArg(net_name);
 }
 
 VerilogDclArg *
@@ -460,23 +480,19 @@ VerilogReader::makeDclArg(VerilogAssign *assign)
 }
 
 VerilogNetPartSelect *
-VerilogReader::makeNetPartSelect(const string *net_vname,
+VerilogReader::makeNetPartSelect(string_view net_vname,
 				 int from_index,
 				 int to_index)
 {
   net_part_select_count_++;
   if (report_stmt_stats_)
-    net_bus_names_ += net_vname->size() + 1;
+    net_bus_names_ += net_vname.size() + 1;
   const string net_name = netVerilogToSta(net_vname);
-  VerilogNetPartSelect *select = new VerilogNetPartSelect(net_name,
-                                                          from_index,
-                                                          to_index);
-  delete net_vname;
-  return select;
+  return new VerilogNetPartSelect(net_name, from_index, to_index);
 }
 
 VerilogNetConstant *
-VerilogReader::makeNetConstant(const string *constant,
+VerilogReader::makeNetConstant(string_view constant,
                                int line)
 {
   net_constant_count_++;
@@ -484,28 +500,24 @@ VerilogReader::makeNetConstant(const string *constant,
 }
 
 VerilogNetScalar *
-VerilogReader::makeNetScalar(const string *net_vname)
+VerilogReader::makeNetScalar(string_view net_vname)
 {
   net_scalar_count_++;
   if (report_stmt_stats_)
-    net_scalar_names_ += net_vname->size() + 1;
+    net_scalar_names_ += net_vname.size() + 1;
   const string net_name = netVerilogToSta(net_vname);
-  VerilogNetScalar *scalar = new VerilogNetScalar(net_name);
-  delete net_vname;
-  return scalar;
+  return new VerilogNetScalar(net_name);
 }
 
 VerilogNetBitSelect *
-VerilogReader::makeNetBitSelect(const string *net_vname,
+VerilogReader::makeNetBitSelect(string_view net_vname,
 				int index)
 {
   net_bit_select_count_++;
   if (report_stmt_stats_)
-    net_bus_names_ += net_vname->size() + 1;
+    net_bus_names_ += net_vname.size() + 1;
   const string net_name = netVerilogToSta(net_vname);
-  VerilogNetBitSelect *select = new VerilogNetBitSelect(net_name, index);
-  delete net_vname;
-  return select;
+  return new VerilogNetBitSelect(net_name, index);
 }
 
 VerilogAssign *
@@ -518,8 +530,8 @@ VerilogReader::makeAssign(VerilogNet *lhs,
 }
 
 VerilogInst *
-VerilogReader::makeModuleInst(const string *module_vname,
-                              const string *inst_vname,
+VerilogReader::makeModuleInst(string_view module_vname,
+                              string_view inst_vname,
                               VerilogNetSeq *pins,
                               VerilogAttrStmtSeq *attr_stmts,
                               const int line)
@@ -560,8 +572,6 @@ VerilogReader::makeModuleInst(const string *module_vname,
       inst_lib_count_++;
       inst_lib_net_arrays_ += port_count;
     }
-    delete module_vname;
-    delete inst_vname;
     return inst;
   }
   else {
@@ -575,8 +585,6 @@ VerilogReader::makeModuleInst(const string *module_vname,
       inst_names_ += inst_name.size() + 1;
       inst_mod_count_++;
     }
-    delete module_vname;
-    delete inst_vname;
     return inst;
   }
 }
@@ -606,39 +614,33 @@ VerilogReader::hasScalarNamedPortRefs(LibertyCell *liberty_cell,
 }
 
 VerilogNetPortRef *
-VerilogReader::makeNetNamedPortRefScalarNet(const string *port_vname)
+VerilogReader::makeNetNamedPortRefScalarNet(string_view port_vname)
 {
   net_port_ref_scalar_net_count_++;
   if (report_stmt_stats_)
-    port_names_ += port_vname->size() + 1;
+    port_names_ += port_vname.size() + 1;
   const string port_name = portVerilogToSta(port_vname);
-  VerilogNetPortRef *ref = new VerilogNetPortRefScalarNet(port_name.c_str());
-  delete port_vname;
-  return ref;
+  return new VerilogNetPortRefScalarNet(port_name.c_str());
 }
 
 VerilogNetPortRef *
-VerilogReader::makeNetNamedPortRefScalarNet(const string *port_vname,
-					    const string *net_vname)
+VerilogReader::makeNetNamedPortRefScalarNet(string_view port_vname,
+					    string_view net_vname)
 {
   net_port_ref_scalar_net_count_++;
   if (report_stmt_stats_) {
-    if (net_vname)
-      net_scalar_names_ += net_vname->size() + 1;
-    port_names_ += port_vname->size() + 1;
+    net_scalar_names_ += net_vname.size() + 1;
+    port_names_ += port_vname.size() + 1;
   }
   const string port_name = portVerilogToSta(port_vname);
   const string net_name = netVerilogToSta(net_vname);
-  VerilogNetPortRef *ref = new VerilogNetPortRefScalarNet(port_name.c_str(),
-                                                          net_name.c_str());
-  delete port_vname;
-  delete net_vname;
-  return ref;
+  return new VerilogNetPortRefScalarNet(port_name.c_str(),
+                                        net_name.c_str());
 }
 
 VerilogNetPortRef *
-VerilogReader::makeNetNamedPortRefBitSelect(const string *port_vname,
-					    const string *bus_vname,
+VerilogReader::makeNetNamedPortRefBitSelect(string_view port_vname,
+					    string_view bus_vname,
 					    int index)
 {
   net_port_ref_scalar_net_count_++;
@@ -646,55 +648,44 @@ VerilogReader::makeNetNamedPortRefBitSelect(const string *port_vname,
   const string net_name = verilogBusBitName(bus_name, index);
   if (report_stmt_stats_) {
     net_scalar_names_ += net_name.length() + 1;
-    port_names_ += port_vname->size() + 1;
+    port_names_ += port_vname.size() + 1;
   }
   const string port_name = portVerilogToSta(port_vname);
-  VerilogNetPortRef *ref = new VerilogNetPortRefScalarNet(port_name.c_str(),
-                                                          net_name.c_str());
-  delete port_vname;
-  delete bus_vname;
-  return ref;
+  return new VerilogNetPortRefScalarNet(port_name.c_str(),
+                                        net_name.c_str());
 }
 
 VerilogNetPortRef *
-VerilogReader::makeNetNamedPortRefScalar(const string *port_vname,
+VerilogReader::makeNetNamedPortRefScalar(string_view port_vname,
 					 VerilogNet *net)
 {
   net_port_ref_scalar_count_++;
   if (report_stmt_stats_)
-    port_names_ += port_vname->size() + 1;
+    port_names_ += port_vname.size() + 1;
   const string port_name = portVerilogToSta(port_vname);
-  VerilogNetPortRef *ref = new VerilogNetPortRefScalar(port_name.c_str(), net);
-  delete port_vname;
-  return ref;
+  return new VerilogNetPortRefScalar(port_name.c_str(), net);
 }
 
 VerilogNetPortRef *
-VerilogReader::makeNetNamedPortRefBit(const string *port_vname,
+VerilogReader::makeNetNamedPortRefBit(string_view port_vname,
 				      int index,
 				      VerilogNet *net)
 {
   net_port_ref_bit_count_++;
   const string port_name = portVerilogToSta(port_vname);
-  VerilogNetPortRef *ref = new VerilogNetPortRefBit(port_name.c_str(),
-                                                    index, net);
-  delete port_vname;
-  return ref;
+  return new VerilogNetPortRefBit(port_name.c_str(), index, net);
 }
 
 VerilogNetPortRef *
-VerilogReader::makeNetNamedPortRefPart(const string *port_vname,
+VerilogReader::makeNetNamedPortRefPart(string_view port_vname,
 				       int from_index,
 				       int to_index,
 				       VerilogNet *net)
 {
   net_port_ref_part_count_++;
   const string port_name = portVerilogToSta(port_vname);
-  VerilogNetPortRef *ref = new VerilogNetPortRefPart(port_name,
-                                                     from_index,
-                                                     to_index, net);
-  delete port_vname;
-  return ref;
+  return new VerilogNetPortRefPart(port_name, from_index,
+                                   to_index, net);
 }
 
 VerilogNetConcat *
@@ -1379,7 +1370,7 @@ VerilogNetPartSelect::nameIterator(VerilogModule *,
   return new VerilogBusNetNameIterator(name_.c_str(), from_index_, to_index_);
 }
 
-VerilogNetConstant::VerilogNetConstant(const string *constant,
+VerilogNetConstant::VerilogNetConstant(string_view constant,
 				       VerilogReader *reader,
                                        int line)
 {
@@ -1387,13 +1378,13 @@ VerilogNetConstant::VerilogNetConstant(const string *constant,
 }
 
 void
-VerilogNetConstant::parseConstant(const string *constant,
+VerilogNetConstant::parseConstant(string_view constant,
 				  VerilogReader *reader,
                                   int line)
 {
   // Find constant size.
-  size_t csize_end = constant->find('\'');
-  string csize = constant->substr(0, csize_end);
+  size_t csize_end = constant.find('\'');
+  string csize(constant.substr(0, csize_end));
 
   // Read the constant size.
   size_t size = std::stol(csize);
@@ -1401,7 +1392,7 @@ VerilogNetConstant::parseConstant(const string *constant,
 
   // Read the constant base.
   size_t base_idx = csize_end + 1;
-  char base = constant->at(base_idx);
+  char base = constant[base_idx];
   switch (base) {
   case 'b':
   case 'B':
@@ -1425,11 +1416,10 @@ VerilogNetConstant::parseConstant(const string *constant,
                                "unknown constant base.");
     break;
   }
-  delete constant;
 }
 
 void
-VerilogNetConstant::parseConstant(const string *constant,
+VerilogNetConstant::parseConstant(string_view constant,
 				  size_t base_idx,
 				  int base,
 				  int digit_bit_count)
@@ -1440,9 +1430,9 @@ VerilogNetConstant::parseConstant(const string *constant,
   char *end;
   value_digit_str[1] = '\0';
   size_t bit = 0;
-  size_t idx = constant->size() - 1;
+  size_t idx = constant.size() - 1;
   while (bit < size) {
-    char ch = (idx > base_idx) ? constant->at(idx--) : '0';
+    char ch = (idx > base_idx) ? constant[idx--] : '0';
     // Skip underscores.
     if (ch != '_') {
       value_digit_str[0] = ch;
@@ -1458,15 +1448,15 @@ VerilogNetConstant::parseConstant(const string *constant,
 }
 
 void
-VerilogNetConstant::parseConstant10(const string *constant,
+VerilogNetConstant::parseConstant10(string_view constant,
                                     size_t base_idx,
 				    VerilogReader *reader,
                                     int line)
 {
   // Copy the constant skipping underscores.
   string tmp;
-  for (size_t i = base_idx + 1; i < constant->size(); i++) {
-    char ch = constant->at(i);
+  for (size_t i = base_idx + 1; i < constant.size(); i++) {
+    char ch = constant[i];
     if (ch != '_')
       tmp +=  ch;
   }
@@ -1701,6 +1691,44 @@ private:
   BindingMap map_;
 };
 
+// Module instance body whose expansion has been deferred so it can run
+// on a dispatch queue thread.  Owns the instance port bindings made
+// while the instance pins were connected.
+class VerilogDeferredBody
+{
+public:
+  VerilogDeferredBody(VerilogModule *module,
+		      Instance *inst,
+		      VerilogBindingTbl *bindings);
+  ~VerilogDeferredBody();
+  VerilogModule *module() const { return module_; }
+  Instance *instance() const { return inst_; }
+  VerilogBindingTbl *bindings() const { return bindings_; }
+
+private:
+  VerilogModule *module_;
+  Instance *inst_;
+  VerilogBindingTbl *bindings_;
+};
+
+VerilogDeferredBody::VerilogDeferredBody(VerilogModule *module,
+					 Instance *inst,
+					 VerilogBindingTbl *bindings) :
+  module_(module),
+  inst_(inst),
+  bindings_(bindings)
+{
+}
+
+VerilogDeferredBody::~VerilogDeferredBody()
+{
+  delete bindings_;
+}
+
+// Serializes network state shared across parallel link tasks
+// (constant nets, net merges, attributes and link errors).
+static std::mutex link_lock;
+
 Instance *
 VerilogReader::linkNetwork(const char *top_cell_name,
                            bool make_black_boxes,
@@ -1730,7 +1758,13 @@ VerilogReader::linkNetwork(const char *top_cell_name,
 	}
 	delete net_name_iter;
       }
-      makeModuleInstBody(module, top_instance, &bindings, make_black_boxes);
+      module_resolved_.clear();
+      if (dispatch_queue_ && dispatch_queue_->getThreadCount() > 1)
+	makeModuleInstBodyParallel(module, top_instance, &bindings,
+				   make_black_boxes);
+      else
+	makeModuleInstBody(module, top_instance, &bindings, make_black_boxes,
+			   nullptr);
       bool errors = reportLinkErrors();
       if (delete_modules)
         deleteModules();
@@ -1756,14 +1790,16 @@ void
 VerilogReader::makeModuleInstBody(VerilogModule *module,
 				  Instance *inst,
 				  VerilogBindingTbl *bindings,
-				  bool make_black_boxes)
+				  bool make_black_boxes,
+				  VerilogDeferredBodySeq *deferred)
 {
   VerilogStmtSeq::Iterator stmt_iter(module->stmts());
   while (stmt_iter.hasNext()) {
     VerilogStmt *stmt = stmt_iter.next();
     if (stmt->isModuleInst())
       makeModuleInstNetwork(dynamic_cast<VerilogModuleInst*>(stmt),
-			    inst, module, bindings, make_black_boxes);
+			    inst, module, bindings, make_black_boxes,
+			    deferred);
     else if (stmt->isLibertyInst())
       makeLibertyInst(dynamic_cast<VerilogLibertyInst*>(stmt),
 		      inst, module, bindings);
@@ -1778,10 +1814,12 @@ VerilogReader::makeModuleInstBody(VerilogModule *module,
 	  mergeAssignNet(assign, module, inst, bindings);
 	if (dir->isGround()) {
 	  Net *net = bindings->ensureNetBinding(arg->netName().c_str(),inst,network_);
+	  LockGuard lock(link_lock);
 	  network_->addConstantNet(net, LogicValue::zero);
 	}
 	if (dir->isPower()) {
 	  Net *net = bindings->ensureNetBinding(arg->netName().c_str(),inst,network_);
+	  LockGuard lock(link_lock);
 	  network_->addConstantNet(net, LogicValue::one);
 	}
       }
@@ -1792,12 +1830,82 @@ VerilogReader::makeModuleInstBody(VerilogModule *module,
   }
 }
 
+// Expand the hierarchy breadth-first, deferring module instance bodies
+// until there are enough independent subtrees to keep the dispatch
+// queue threads busy, then expand the deferred subtrees in parallel.
+void
+VerilogReader::makeModuleInstBodyParallel(VerilogModule *module,
+					  Instance *inst,
+					  VerilogBindingTbl *bindings,
+					  bool make_black_boxes)
+{
+  VerilogDeferredBodySeq deferred;
+  makeModuleInstBody(module, inst, bindings, make_black_boxes, &deferred);
+  // Widen the frontier serially until there is enough parallel slack.
+  size_t min_tasks = dispatch_queue_->getThreadCount() * 4;
+  size_t next = 0;
+  while (next < deferred.size()
+	 && deferred.size() - next < min_tasks) {
+    VerilogDeferredBody *body = deferred[next++];
+    makeModuleInstBody(body->module(), body->instance(), body->bindings(),
+		       make_black_boxes, &deferred);
+  }
+  for (size_t i = next; i < deferred.size(); i++) {
+    VerilogDeferredBody *body = deferred[i];
+    dispatch_queue_->dispatch([this, body, make_black_boxes](int) {
+      makeModuleInstBody(body->module(), body->instance(), body->bindings(),
+			 make_black_boxes, nullptr);
+    });
+  }
+  dispatch_queue_->finishTasks();
+  deferred.deleteContents();
+}
+
+// True if no module in the subtree instantiates an undefined cell.
+// Black boxes for undefined cells modify the library, so unresolved
+// subtrees are expanded on the main thread.
+bool
+VerilogReader::moduleCellsResolved(VerilogModule *module)
+{
+  bool exists;
+  bool resolved = false;
+  module_resolved_.findKey(module, resolved, exists);
+  if (exists)
+    return resolved;
+  // Break module instantiation cycles.
+  module_resolved_[module] = true;
+  resolved = true;
+  VerilogStmtSeq::Iterator stmt_iter(module->stmts());
+  while (stmt_iter.hasNext()) {
+    VerilogStmt *stmt = stmt_iter.next();
+    if (stmt->isModuleInst()) {
+      VerilogModuleInst *mod_inst = dynamic_cast<VerilogModuleInst*>(stmt);
+      Cell *cell = network_->findAnyCell(mod_inst->moduleName().c_str());
+      if (cell == nullptr) {
+	resolved = false;
+	break;
+      }
+      if (!network_->isLeaf(cell)) {
+	VerilogModule *child_module = this->module(cell);
+	if (child_module
+	    && !moduleCellsResolved(child_module)) {
+	  resolved = false;
+	  break;
+	}
+      }
+    }
+  }
+  module_resolved_[module] = resolved;
+  return resolved;
+}
+
 void
 VerilogReader::makeModuleInstNetwork(VerilogModuleInst *mod_inst,
 				     Instance *parent,
 				     VerilogModule *parent_module,
 				     VerilogBindingTbl *parent_bindings,
-				     bool make_black_boxes)
+				     bool make_black_boxes,
+				     VerilogDeferredBodySeq *deferred)
 {
   const string &module_name = mod_inst->moduleName();
   Cell *cell = network_->findAnyCell(module_name.c_str());
@@ -1823,9 +1931,12 @@ VerilogReader::makeModuleInstNetwork(VerilogModuleInst *mod_inst,
     Instance *inst = network_->makeInstance(cell, mod_inst->instanceName().c_str(),
 					    parent);
     VerilogAttrStmtSeq *attr_stmts = mod_inst->attrStmts();
-    for (VerilogAttrStmt *stmt : *attr_stmts) {
-      for (VerilogAttrEntry *entry : *stmt->attrs()) {
-        network_->setAttribute(inst, entry->key(), entry->value());
+    if (!attr_stmts->empty()) {
+      LockGuard lock(link_lock);
+      for (VerilogAttrStmt *stmt : *attr_stmts) {
+        for (VerilogAttrEntry *entry : *stmt->attrs()) {
+          network_->setAttribute(inst, entry->key(), entry->value());
+        }
       }
     }
 
@@ -1838,19 +1949,27 @@ VerilogReader::makeModuleInstNetwork(VerilogModuleInst *mod_inst,
       }
     }
     bool is_leaf = network_->isLeaf(cell);
-    VerilogBindingTbl bindings(zero_net_name_, one_net_name_);
+    VerilogModule *module = is_leaf ? nullptr : this->module(cell);
+    // Subtrees free of undefined cells can be expanded on another thread.
+    bool defer = deferred && module && moduleCellsResolved(module);
+    VerilogBindingTbl inst_bindings(zero_net_name_, one_net_name_);
+    VerilogBindingTbl *bindings = defer
+      ? new VerilogBindingTbl(zero_net_name_, one_net_name_)
+      : &inst_bindings;
     if (mod_inst->hasPins()) {
       if (mod_inst->namedPins())
-	makeNamedInstPins(cell, inst, mod_inst, &bindings, parent,
+	makeNamedInstPins(cell, inst, mod_inst, bindings, parent,
 			  parent_module, parent_bindings, is_leaf);
       else
-	makeOrderedInstPins(cell, inst, mod_inst, &bindings, parent,
+	makeOrderedInstPins(cell, inst, mod_inst, bindings, parent,
 			    parent_module, parent_bindings, is_leaf);
     }
-    if (!is_leaf) {
-      VerilogModule *module = this->module(cell);
-      if (module)
-        makeModuleInstBody(module, inst, &bindings, make_black_boxes);
+    if (module) {
+      if (defer)
+	deferred->push_back(new VerilogDeferredBody(module, inst, bindings));
+      else
+	makeModuleInstBody(module, inst, bindings, make_black_boxes,
+			   deferred);
     }
   }
 }
@@ -2007,9 +2126,12 @@ VerilogReader::makeLibertyInst(VerilogLibertyInst *lib_inst,
   Instance *inst = network_->makeInstance(cell, lib_inst->instanceName().c_str(),
 					  parent);
   VerilogAttrStmtSeq *attr_stmts = lib_inst->attrStmts();
-  for (VerilogAttrStmt *stmt : *attr_stmts) {
-    for (VerilogAttrEntry *entry : *stmt->attrs()) {
-      network_->setAttribute(inst, entry->key(), entry->value());
+  if (!attr_stmts->empty()) {
+    LockGuard lock(link_lock);
+    for (VerilogAttrStmt *stmt : *attr_stmts) {
+      for (VerilogAttrEntry *entry : *stmt->attrs()) {
+        network_->setAttribute(inst, entry->key(), entry->value());
+      }
     }
   }
   const StdStringSeq &net_names = lib_inst->netNames();
@@ -2119,6 +2241,8 @@ VerilogReader::mergeAssignNet(VerilogAssign *assign,
       // Merge lower level net into higher level net so that deleting
       // instances from the bottom up does not reference deleted nets
       // by referencing the mergedInto field.
+      // Merging clears the network net->driver map, which is shared state.
+      LockGuard lock(link_lock);
       if (hierarchyLevel(lhs_net,network_) >= hierarchyLevel(rhs_net,network_))
 	network_->mergeInto(lhs_net, rhs_net);
       else
@@ -2186,10 +2310,14 @@ VerilogBindingTbl::ensureNetBinding(const char *net_name,
   if (net == nullptr) {
     net = network->makeNet(net_name, inst);
     map_[network->name(net)] = net;
-    if (net_name == zero_net_name_)
+    if (net_name == zero_net_name_) {
+      LockGuard lock(link_lock);
       network->addConstantNet(net, LogicValue::zero);
-    if (net_name == one_net_name_)
+    }
+    if (net_name == one_net_name_) {
+      LockGuard lock(link_lock);
       network->addConstantNet(net, LogicValue::one);
+    }
   }
   return net;
 }
@@ -2206,6 +2334,7 @@ VerilogReader::linkWarn(int id,
   va_start(args, msg);
   char *msg_str = stringPrintArgs(msg, args);
   VerilogError *error = new VerilogError(id, filename, line, msg_str, true);
+  LockGuard lock(link_lock);
   link_errors_.push_back(error);
   va_end(args);
 }
@@ -2220,6 +2349,7 @@ VerilogReader::linkError(int id,
   va_start(args, msg);
   char *msg_str = stringPrintArgs(msg, args);
   VerilogError *error = new VerilogError(id, filename, line, msg_str, false);
+  LockGuard lock(link_lock);
   link_errors_.push_back(error);
   va_end(args);
 }
@@ -2254,6 +2384,16 @@ VerilogScanner::VerilogScanner(std::istream *stream,
 {
 }
 
+VerilogTokenView
+VerilogScanner::saveToken(const char *text,
+                          size_t length)
+{
+  // Copy the token text into the arena so it outlives the flex buffer.
+  char *copy = static_cast<char*>(token_arena_.alloc(length));
+  memcpy(copy, text, length);
+  return VerilogTokenView{copy, length};
+}
+
 void
 VerilogScanner::error(const char *msg)
 {
@@ -24,7 +24,9 @@
 
 #pragma once
 
+#include <istream>
 #include <string>
+#include <string_view>
 
 #include "StringSet.hh"
 #include "Vector.hh"
@@ -60,7 +62,9 @@ class VerilogBindingTbl;
 class VerilogNetNameIterator;
 class VerilogNetPortRef;
 class VerilogError;
+class VerilogDeferredBody;
 class LibertyCell;
+class DispatchQueue;
 
 typedef Map<Cell*, VerilogModule*> VerilogModuleMap;
 typedef Vector<VerilogStmt*> VerilogStmtSeq;
@@ -69,20 +73,35 @@ typedef Vector<VerilogDclArg*> VerilogDclArgSeq;
 typedef Vector<VerilogAttrStmt*> VerilogAttrStmtSeq;
 typedef Vector<VerilogAttrEntry*> VerilogAttrEntrySeq;
 typedef Vector<VerilogError*> VerilogErrorSeq;
+typedef Vector<VerilogDeferredBody*> VerilogDeferredBodySeq;
+
+// Token text from the verilog scanner.  The characters belong to the
+// scanner, which outlives the parse, so tokens can sit on the parser
+// stack as views without owning their own copies.
+struct VerilogTokenView
+{
+  operator std::string_view() const { return std::string_view(str, length); }
+
+  const char *str;
+  size_t length;
+};
 
 class VerilogReader
 {
 public:
-  VerilogReader(NetworkReader *network);
+  VerilogReader(NetworkReader *network,
+                DispatchQueue *dispatch_queue = nullptr);
   ~VerilogReader();
   bool read(const char *filename);
+  bool read(std::istream &stream,
+            const char *filename);
 
-  void makeModule(const std::string *module_name,
+  void makeModule(std::string_view module_name,
                   VerilogNetSeq *ports,
                   VerilogStmtSeq *stmts,
                   VerilogAttrStmtSeq *attr_stmts,
                   int line);
-  void makeModule(const std::string *module_name,
+  void makeModule(std::string_view module_name,
                   VerilogStmtSeq *port_dcls,
                   VerilogStmtSeq *stmts,
                   VerilogAttrStmtSeq *attr_stmts,
@@ -95,7 +114,7 @@ public:
                       VerilogDclArg *arg,
                       VerilogAttrStmtSeq *attr_stmts,
                       int line);
-  VerilogDclArg *makeDclArg(const std::string *net_name);
+  VerilogDclArg *makeDclArg(std::string_view net_name);
   VerilogDclArg*makeDclArg(VerilogAssign *assign);
   VerilogDclBus *makeDclBus(PortDirection *dir,
                             int from_index,
@@ -109,36 +128,36 @@ public:
                             VerilogDclArgSeq *args,
                             VerilogAttrStmtSeq *attr_stmts,
                             int line);
-  VerilogInst *makeModuleInst(const std::string *module_name,
-                              const std::string *inst_name,
+  VerilogInst *makeModuleInst(std::string_view module_name,
+                              std::string_view inst_name,
                               VerilogNetSeq *pins,
                               VerilogAttrStmtSeq *attr_stmts,
                               const int line);
   VerilogAssign *makeAssign(VerilogNet *lhs,
 			    VerilogNet *rhs,
 			    int line);
-  VerilogNetScalar *makeNetScalar(const std::string *name);
-  VerilogNetPortRef *makeNetNamedPortRefScalarNet(const std::string *port_vname);
-  VerilogNetPortRef *makeNetNamedPortRefScalarNet(const std::string *port_name,
-						  const std::string *net_name);
-  VerilogNetPortRef *makeNetNamedPortRefBitSelect(const std::string *port_name,
-						  const std::string *bus_name,
+  VerilogNetScalar *makeNetScalar(std::string_view name);
+  VerilogNetPortRef *makeNetNamedPortRefScalarNet(std::string_view port_vname);
+  VerilogNetPortRef *makeNetNamedPortRefScalarNet(std::string_view port_name,
+						  std::string_view net_name);
+  VerilogNetPortRef *makeNetNamedPortRefBitSelect(std::string_view port_name,
+						  std::string_view bus_name,
 						  int index);
-  VerilogNetPortRef *makeNetNamedPortRefScalar(const std::string *port_name,
+  VerilogNetPortRef *makeNetNamedPortRefScalar(std::string_view port_name,
 					       VerilogNet *net);
-  VerilogNetPortRef *makeNetNamedPortRefBit(const std::string *port_name,
+  VerilogNetPortRef *makeNetNamedPortRefBit(std::string_view port_name,
 					    int index,
 					    VerilogNet *net);
-  VerilogNetPortRef *makeNetNamedPortRefPart(const std::string *port_name,
+  VerilogNetPortRef *makeNetNamedPortRefPart(std::string_view port_name,
 					     int from_index,
 					     int to_index,
 					     VerilogNet *net);
   VerilogNetConcat *makeNetConcat(VerilogNetSeq *nets);
-  VerilogNetConstant *makeNetConstant(const std::string *constant,
+  VerilogNetConstant *makeNetConstant(std::string_view constant,
                                   int line);
-  VerilogNetBitSelect *makeNetBitSelect(const std::string *name,
+  VerilogNetBitSelect *makeNetBitSelect(std::string_view name,
 					int index);
-  VerilogNetPartSelect *makeNetPartSelect(const std::string *name,
+  VerilogNetPartSelect *makeNetPartSelect(std::string_view name,
 					  int from_index,
 					  int to_index);
   VerilogModule *module(Cell *cell);
@@ -179,12 +198,19 @@ protected:
   void makeModuleInstBody(VerilogModule *module,
 			  Instance *inst,
 			  VerilogBindingTbl *bindings,
-			  bool make_black_boxes);
+			  bool make_black_boxes,
+			  VerilogDeferredBodySeq *deferred);
+  void makeModuleInstBodyParallel(VerilogModule *module,
+				  Instance *inst,
+				  VerilogBindingTbl *bindings,
+				  bool make_black_boxes);
+  bool moduleCellsResolved(VerilogModule *module);
   void makeModuleInstNetwork(VerilogModuleInst *mod_inst,
 			     Instance *parent,
 			     VerilogModule *parent_module,
 			     VerilogBindingTbl *parent_bindings,
-			     bool make_black_boxes);
+			     bool make_black_boxes,
+			     VerilogDeferredBodySeq *deferred);
   void makeLibertyInst(VerilogLibertyInst *lib_inst,
 		       Instance *parent,
 		       VerilogModule *parent_module,
@@ -259,10 +285,13 @@ protected:
   Report *report_;
   Debug *debug_;
   NetworkReader *network_;
+  DispatchQueue *dispatch_queue_;
 
   Library *library_;
   int black_box_index_;
   VerilogModuleMap module_map_;
+  // Cache of modules whose subtrees contain no undefined cells.
+  Map<VerilogModule*, bool> module_resolved_;
   VerilogErrorSeq link_errors_;
   const std::string zero_net_name_;
   const std::string one_net_name_;
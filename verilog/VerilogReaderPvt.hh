@@ -25,6 +25,7 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 
 #include "Map.hh"
 #include "Vector.hh"
@@ -314,7 +315,7 @@ private:
 class VerilogNetConstant : public VerilogNetUnnamed
 {
 public:
-  VerilogNetConstant(const std::string *constant,
+  VerilogNetConstant(std::string_view constant,
 		     VerilogReader *reader,
                      int line);
   virtual ~VerilogNetConstant();
@@ -323,14 +324,14 @@ public:
 					       VerilogReader *reader);
 
 private:
-  void parseConstant(const std::string *constant,
+  void parseConstant(std::string_view constant,
 		     VerilogReader *reader,
                      int line);
-  void parseConstant(const std::string *constant,
+  void parseConstant(std::string_view constant,
 		     size_t base_idx,
 		     int base,
 		     int digit_bit_count);
-  void parseConstant10(const std::string *constant,
+  void parseConstant10(std::string_view constant,
                        size_t base_idx,
 		       VerilogReader *reader,
                        int line);
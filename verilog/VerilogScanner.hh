@@ -24,6 +24,8 @@
 
 #pragma once
 
+#include "Arena.hh"
+#include "VerilogReader.hh"
 #include "VerilogLocation.hh"
 #include "VerilogParse.hh"
 
@@ -51,6 +53,10 @@ public:
   // Method body created by flex in VerilogLex.cc
 
   void error(const char *msg);
+  // Copy token text into the scanner arena so it can be passed through
+  // the parser as a view instead of a heap allocated string.
+  VerilogTokenView saveToken(const char *text,
+                             size_t length);
 
   // Get rid of override virtual function warning.
   using yyFlexLexer::yylex;
@@ -58,6 +64,8 @@ public:
 private:
   const char *filename_;
   Report *report_;
+  // Owns the token text for the life of the parse.
+  Arena token_arena_;
 };
 
 } // namespace
@@ -26,12 +26,16 @@
 
 #include <cstdlib>
 #include <algorithm>
+#include <vector>
 
+#include "DispatchQueue.hh"
 #include "Error.hh"
 #include "Liberty.hh"
 #include "PortDirection.hh"
 #include "Network.hh"
 #include "NetworkCmp.hh"
+#include "StaState.hh"
+#include "StringUtil.hh"
 #include "VerilogNamespace.hh"
 #include "ParseBus.hh"
 
@@ -48,31 +52,47 @@ public:
 		bool include_pwr_gnd,
 		CellSeq *remove_cells,
 		FILE *stream,
-		Network *network);
+		Network *network,
+		DispatchQueue *dispatch_queue,
+		size_t thread_count);
   void writeModules();
 
 protected:
-  void writeModule(const Instance *inst);
+  void writeModule(const Instance *inst,
+		   string &result);
   InstanceSeq findHierChildren();
   void findHierChildren(const Instance *inst,
                         InstanceSeq &children,
                         CellSet &cells);
-  void writePorts(const Cell *cell);
-  void writePortDcls(const Cell *cell);
-  void writeWireDcls(const Instance *inst);
+  void writePorts(const Cell *cell,
+		  string &result);
+  void writePortDcls(const Cell *cell,
+		     string &result);
+  void writeWireDcls(const Instance *inst,
+		     string &result);
   const char *verilogPortDir(PortDirection *dir);
-  void writeChildren(const Instance *inst);
-  void writeChild(const Instance *child);
+  void writeChildren(const Instance *inst,
+		     int &unconnected_net_index,
+		     string &result);
+  void writeChild(const Instance *child,
+		  int &unconnected_net_index,
+		  string &result);
   void writeInstPin(const Instance *inst,
 		    const Port *port,
-		    bool &first_port);
+		    bool &first_port,
+		    string &result);
   void writeInstBusPin(const Instance *inst,
 		       const Port *port,
-		       bool &first_port);
+		       bool &first_port,
+		       int &unconnected_net_index,
+		       string &result);
   void writeInstBusPinBit(const Instance *inst,
 			  const Port *port,
-			  bool &first_member);
-  void writeAssigns(const Instance *inst);
+			  bool &first_member,
+			  int &unconnected_net_index,
+			  string &result);
+  void writeAssigns(const Instance *inst,
+		    string &result);
 
   int findUnconnectedNetCount(const Instance *inst);
   int findChildNCcount(const Instance *child);
@@ -84,20 +104,23 @@ protected:
   CellSet remove_cells_;
   FILE *stream_;
   Network *network_;
-  int unconnected_net_index_;
+  DispatchQueue *dispatch_queue_;
+  size_t thread_count_;
 };
 
 void
 writeVerilog(const char *filename,
 	     bool include_pwr_gnd,
 	     CellSeq *remove_cells,
-	     Network *network)
+	     Network *network,
+	     StaState *sta)
 {
   if (network->topInstance()) {
     FILE *stream = fopen(filename, "w");
     if (stream) {
       VerilogWriter writer(filename, include_pwr_gnd,
-			   remove_cells, stream, network);
+			   remove_cells, stream, network,
+			   sta->dispatchQueue(), sta->threadCount());
       writer.writeModules();
       fclose(stream);
     }
@@ -110,13 +133,16 @@ VerilogWriter::VerilogWriter(const char *filename,
 			     bool include_pwr_gnd,
 			     CellSeq *remove_cells,
 			     FILE *stream,
-			     Network *network) :
+			     Network *network,
+			     DispatchQueue *dispatch_queue,
+			     size_t thread_count) :
   filename_(filename),
   include_pwr_gnd_(include_pwr_gnd),
   remove_cells_(network),
   stream_(stream),
   network_(network),
-  unconnected_net_index_(1)
+  dispatch_queue_(dispatch_queue),
+  thread_count_(thread_count)
 {
   if (remove_cells) {
     for(Cell *lib_cell : *remove_cells)
@@ -124,14 +150,43 @@ VerilogWriter::VerilogWriter(const char *filename,
   }
 }
 
+// Module bodies are independent text units, so they are formatted
+// into per module buffers across the thread pool and the buffers
+// written to the stream in declaration order.
 void
 VerilogWriter::writeModules()
 {
-  // Write the top level modeule first.
-  writeModule(network_->topInstance());
-  InstanceSeq hier_childrenn = findHierChildren();
-  for (const Instance *child : hier_childrenn)
-    writeModule(child);
+  // Write the top level module first.
+  InstanceSeq modules;
+  modules.push_back(network_->topInstance());
+  InstanceSeq hier_children = findHierChildren();
+  for (const Instance *child : hier_children)
+    modules.push_back(child);
+
+  size_t module_count = modules.size();
+  std::vector<string> module_texts(module_count);
+  if (dispatch_queue_
+      && thread_count_ > 1
+      && module_count > 1) {
+    size_t thread_count = min(thread_count_, module_count);
+    size_t chunk_size = module_count / thread_count + 1;
+    size_t from = 0;
+    for (size_t k = 0; k < thread_count && from < module_count; k++) {
+      size_t to = min(from + chunk_size, module_count);
+      dispatch_queue_->dispatch([&, from, to](int) {
+	for (size_t i = from; i < to; i++)
+	  writeModule(modules[i], module_texts[i]);
+      });
+      from = to;
+    }
+    dispatch_queue_->finishTasks();
+  }
+  else {
+    for (size_t i = 0; i < module_count; i++)
+      writeModule(modules[i], module_texts[i]);
+  }
+  for (const string &text : module_texts)
+    fwrite(text.data(), sizeof(char), text.size(), stream_);
 }
 
 InstanceSeq
@@ -171,23 +226,28 @@ VerilogWriter::findHierChildren(const Instance *inst,
 }
 
 void
-VerilogWriter::writeModule(const Instance *inst)
+VerilogWriter::writeModule(const Instance *inst,
+			   string &result)
 {
   Cell *cell = network_->cell(inst);
   std::string cell_vname = cellVerilogName(network_->name(cell));
-  fprintf(stream_, "module %s (", cell_vname.c_str());
-  writePorts(cell);
-  writePortDcls(cell);
-  fprintf(stream_, "\n");
-  writeWireDcls(inst);
-  fprintf(stream_, "\n");
-  writeChildren(inst);
-  writeAssigns(inst);
-  fprintf(stream_, "endmodule\n");
+  stringAppend(result, "module %s (", cell_vname.c_str());
+  writePorts(cell, result);
+  writePortDcls(cell, result);
+  result += "\n";
+  writeWireDcls(inst, result);
+  result += "\n";
+  // Unconnected bus bits are tied to per module _NC nets by
+  // writeInstBusPinBit.
+  int unconnected_net_index = 1;
+  writeChildren(inst, unconnected_net_index, result);
+  writeAssigns(inst, result);
+  result += "endmodule\n";
 }
 
 void
-VerilogWriter::writePorts(const Cell *cell)
+VerilogWriter::writePorts(const Cell *cell,
+			  string &result)
 {
   bool first = true;
   CellPortIterator *port_iter = network_->portIterator(cell);
@@ -196,18 +256,18 @@ VerilogWriter::writePorts(const Cell *cell)
     if (include_pwr_gnd_
         || !network_->direction(port)->isPowerGround()) {
       if (!first)
-        fprintf(stream_, ",\n    ");
-      std::string verilog_name = portVerilogName(network_->name(port));
-      fprintf(stream_, "%s", verilog_name.c_str());
+        result += ",\n    ";
+      result += portVerilogName(network_->name(port));
       first = false;
     }
   }
   delete port_iter;
-  fprintf(stream_, ");\n");
+  result += ");\n";
 }
 
 void
-VerilogWriter::writePortDcls(const Cell *cell)
+VerilogWriter::writePortDcls(const Cell *cell,
+			     string &result)
 {
   CellPortIterator *port_iter = network_->portIterator(cell);
   while (port_iter->hasNext()) {
@@ -218,19 +278,19 @@ VerilogWriter::writePortDcls(const Cell *cell)
       std::string port_vname = portVerilogName(network_->name(port));
       const char *vtype = verilogPortDir(dir);
       if (vtype) {
-        fprintf(stream_, " %s", vtype);
+        stringAppend(result, " %s", vtype);
         if (network_->isBus(port))
-          fprintf(stream_, " [%d:%d]",
-                  network_->fromIndex(port),
-                  network_->toIndex(port));
-        fprintf(stream_, " %s;\n", port_vname.c_str());
+          stringAppend(result, " [%d:%d]",
+                       network_->fromIndex(port),
+                       network_->toIndex(port));
+        stringAppend(result, " %s;\n", port_vname.c_str());
         if (dir->isTristate()) {
-          fprintf(stream_, " tri");
+          result += " tri";
           if (network_->isBus(port))
-            fprintf(stream_, " [%d:%d]",
-                    network_->fromIndex(port),
-                    network_->toIndex(port));
-          fprintf(stream_, " %s;\n", port_vname.c_str());
+            stringAppend(result, " [%d:%d]",
+                         network_->fromIndex(port),
+                         network_->toIndex(port));
+          stringAppend(result, " %s;\n", port_vname.c_str());
         }
       }
     }
@@ -265,7 +325,8 @@ VerilogWriter::verilogPortDir(PortDirection *dir)
 typedef std::pair<int, int> BusIndexRange;
 
 void
-VerilogWriter::writeWireDcls(const Instance *inst)
+VerilogWriter::writeWireDcls(const Instance *inst,
+			     string &result)
 {
   Cell *cell = network_->cell(inst);
   char escape = network_->pathEscape();
@@ -288,7 +349,7 @@ VerilogWriter::writeWireDcls(const Instance *inst)
         }
         else {
           std::string net_vname = netVerilogName(net_name);
-          fprintf(stream_, " wire %s;\n", net_vname.c_str());;
+          stringAppend(result, " wire %s;\n", net_vname.c_str());
         }
       }
     }
@@ -298,20 +359,22 @@ VerilogWriter::writeWireDcls(const Instance *inst)
   for (const auto& [bus_name1, range] : bus_ranges) {
     const char *bus_name = bus_name1.c_str();
     std::string net_vname = netVerilogName(bus_name);
-    fprintf(stream_, " wire [%d:%d] %s;\n",
-            range.first,
-            range.second,
-            net_vname.c_str());;
+    stringAppend(result, " wire [%d:%d] %s;\n",
+                 range.first,
+                 range.second,
+                 net_vname.c_str());
   }
 
   // Wire net dcls for writeInstBusPinBit.
   int nc_count = findUnconnectedNetCount(inst);
   for (int i = 1; i < nc_count + 1; i++)
-    fprintf(stream_, " wire _NC%d;\n", i);
+    stringAppend(result, " wire _NC%d;\n", i);
 }
 
 void
-VerilogWriter::writeChildren(const Instance *inst)
+VerilogWriter::writeChildren(const Instance *inst,
+			     int &unconnected_net_index,
+			     string &result)
 {
   Vector<Instance*> children;
   InstanceChildIterator *child_iter = network_->childIterator(inst);
@@ -327,20 +390,22 @@ VerilogWriter::writeChildren(const Instance *inst)
   });
 
   for (auto child : children)
-    writeChild(child);
+    writeChild(child, unconnected_net_index, result);
 }
 
 void
-VerilogWriter::writeChild(const Instance *child)
+VerilogWriter::writeChild(const Instance *child,
+			  int &unconnected_net_index,
+			  string &result)
 {
   Cell *child_cell = network_->cell(child);
   if (!remove_cells_.hasKey(child_cell)) {
     const char *child_name = network_->name(child);
     string child_vname = instanceVerilogName(child_name);
     string child_cell_vname = cellVerilogName(network_->name(child_cell));
-    fprintf(stream_, " %s %s (",
-	    child_cell_vname.c_str(),
-	    child_vname.c_str());
+    stringAppend(result, " %s %s (",
+		 child_cell_vname.c_str(),
+		 child_vname.c_str());
     bool first_port = true;
     CellPortIterator *port_iter = network_->portIterator(child_cell);
     while (port_iter->hasNext()) {
@@ -348,20 +413,22 @@ VerilogWriter::writeChild(const Instance *child)
       if (include_pwr_gnd_
 	  || !network_->direction(port)->isPowerGround()) {
 	if (network_->hasMembers(port))
-	  writeInstBusPin(child, port, first_port);
+	  writeInstBusPin(child, port, first_port,
+			  unconnected_net_index, result);
 	else
-	  writeInstPin(child, port, first_port);
+	  writeInstPin(child, port, first_port, result);
       }
     }
     delete port_iter;
-    fprintf(stream_, ");\n");
+    result += ");\n";
   }
 }
 
 void
 VerilogWriter::writeInstPin(const Instance *inst,
 			    const Port *port,
-			    bool &first_port)
+			    bool &first_port,
+			    string &result)
 {
   Pin *pin = network_->findPin(inst, port);
   if (pin) {
@@ -370,11 +437,11 @@ VerilogWriter::writeInstPin(const Instance *inst,
       const char *net_name = network_->name(net);
       string net_vname = netVerilogName(net_name);
       if (!first_port)
-	fprintf(stream_, ",\n    ");
+	result += ",\n    ";
       string port_vname = portVerilogName(network_->name(port));
-      fprintf(stream_, ".%s(%s)",
-	      port_vname.c_str(),
-	      net_vname.c_str());
+      stringAppend(result, ".%s(%s)",
+		   port_vname.c_str(),
+		   net_vname.c_str());
       first_port = false;
     }
   }
@@ -383,12 +450,14 @@ VerilogWriter::writeInstPin(const Instance *inst,
 void
 VerilogWriter::writeInstBusPin(const Instance *inst,
 			       const Port *port,
-			       bool &first_port)
+			       bool &first_port,
+			       int &unconnected_net_index,
+			       string &result)
 {
   if (!first_port)
-    fprintf(stream_, ",\n    ");
+    result += ",\n    ";
 
-  fprintf(stream_, ".%s({", network_->name(port));
+  stringAppend(result, ".%s({", network_->name(port));
   first_port = false;
   bool first_member = true;
 
@@ -400,24 +469,28 @@ VerilogWriter::writeInstBusPin(const Instance *inst,
     while (member_iter.hasNext()) {
       LibertyPort *lib_member = member_iter.next();
       Port *member = network_->findPort(cell, lib_member->name());
-      writeInstBusPinBit(inst, member, first_member);
+      writeInstBusPinBit(inst, member, first_member,
+			 unconnected_net_index, result);
     }
   }
   else {
     PortMemberIterator *member_iter = network_->memberIterator(port);
     while (member_iter->hasNext()) {
       Port *member = member_iter->next();
-      writeInstBusPinBit(inst, member, first_member);
+      writeInstBusPinBit(inst, member, first_member,
+			 unconnected_net_index, result);
     }
     delete member_iter;
   }
-  fprintf(stream_, "})");
+  result += "})";
 }
 
 void
 VerilogWriter::writeInstBusPinBit(const Instance *inst,
 				  const Port *port,
-				  bool &first_member)
+				  bool &first_member,
+				  int &unconnected_net_index,
+				  string &result)
 {
   Pin *pin = network_->findPin(inst, port);
   Net *net = pin ? network_->net(pin) : nullptr;
@@ -426,11 +499,11 @@ VerilogWriter::writeInstBusPinBit(const Instance *inst,
     net_name = network_->name(net);
   else
     // There is no verilog syntax to "skip" a bit in the concatentation.
-    stringPrint(net_name, "_NC%d", unconnected_net_index_++);
+    stringPrint(net_name, "_NC%d", unconnected_net_index++);
   string net_vname = netVerilogName(net_name.c_str());
   if (!first_member)
-    fprintf(stream_, ",\n    ");
-  fprintf(stream_, "%s", net_vname.c_str());
+    result += ",\n    ";
+  result += net_vname;
   first_member = false;
 }
 
@@ -438,7 +511,8 @@ VerilogWriter::writeInstBusPinBit(const Instance *inst,
 // Use an assign statement to alias the net when it is connected to
 // multiple output ports.
 void
-VerilogWriter::writeAssigns(const Instance *inst)
+VerilogWriter::writeAssigns(const Instance *inst,
+			    string &result)
 {
   InstancePinIterator *pin_iter = network_->pinIterator(inst);
   while (pin_iter->hasNext()) {
@@ -456,9 +530,9 @@ VerilogWriter::writeAssigns(const Instance *inst)
         // Port name is different from net name.
         string port_vname = netVerilogName(network_->name(port));
         string net_vname = netVerilogName(network_->name(net));
-        fprintf(stream_, " assign %s = %s;\n",
-                port_vname.c_str(),
-                net_vname.c_str());
+        stringAppend(result, " assign %s = %s;\n",
+                     port_vname.c_str(),
+                     net_vname.c_str());
       }
     }
   }